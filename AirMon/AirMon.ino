@@ -13,14 +13,21 @@
 #include <TimeUtils.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <ChunkedResponse.h>
 #include <HtmlWriter.h>
+#include <JsonWriter.h>
+#include <BinaryLogWriter.h>
+#include <LogCursor.h>
 #include <Navigation.h>
 #include <Log.h>
+#include <FlashLog.h>
+#include <Rollup.h>
 #include <Wire.h>
 #include <bsec.h>
 #include <s8_uart.h>
 #include "PersistentData.h"
 #include "MonitoredTopics.h"
+#include "StaticFiles.h"
 
 #define SECONDS_PER_DAY (24 * 3600)
 #define BSEC_STATE_SAVE_INTERVAL (24 * 3600)
@@ -28,10 +35,12 @@
 #define HTTP_POLL_INTERVAL 60
 #define DISPLAY_INTERVAL 2.0F
 #define EVENT_LOG_LENGTH 50
+#define EVENT_LOG_ARENA_SIZE 2048
 #define FTP_RETRY_INTERVAL (30 * 60)
 #define HOUR_LOG_INTERVAL (30 * 60)
 #define IAQ_LOG_SIZE 250
 #define IAQ_LOG_PAGE_SIZE 50
+#define IAQ_LOG_SEGMENTS 4
 #define BME_SENSOR_COUNT 3
 
 #define FAN_PIN 14
@@ -58,6 +67,7 @@
 const char* ContentTypeHtml = "text/html;charset=UTF-8";
 const char* ContentTypeJson = "application/json";
 const char* ContentTypeText = "text/plain";
+const char* ContentTypeBinary = "application/octet-stream";
 const char* ButtonClass = "button";
 
 enum FileId
@@ -86,11 +96,18 @@ const char* Files[] PROGMEM =
 ESPWebServer WebServer(80); // Default HTTP port
 WiFiNTP TimeServer;
 WiFiFTPClient FTPClient(2000); // 2 sec timeout
-StringBuilder HttpResponse(16384); // 16KB HTTP response buffer
+ChunkedResponse HttpResponse(WebServer, 1536); // 1.5KB HTTP response buffer (larger responses are sent in chunks)
 HtmlWriter Html(HttpResponse, Files[Logo], Files[Styles], 60);
-Log<const char> EventLog(EVENT_LOG_LENGTH);
-StaticLog<TopicLogEntry> IAQLog(IAQ_LOG_SIZE);
-StaticLog<TopicLogEntry> HourStats(24 * 2); // 24 hrs
+JsonWriter Json(HttpResponse);
+StringArenaLog EventLog(EVENT_LOG_LENGTH, EVENT_LOG_ARENA_SIZE);
+FlashLog<TopicLogEntry> IAQLog("iaqlog", IAQ_LOG_SEGMENTS, IAQ_LOG_SIZE);
+const BinaryField IAQLogFields[] =
+{
+    BINARY_FIELD(TopicLogEntry, time),
+    BINARY_FIELD(TopicLogEntry, count),
+    BINARY_FIELD(TopicLogEntry, topicValues)
+};
+Rollup<NUMBER_OF_MONITORED_TOPICS> HourStats(HOUR_LOG_INTERVAL, 24 * 2); // 24 hrs
 WiFiStateMachine WiFiSM(TimeServer, WebServer, EventLog);
 Adafruit_SSD1306 Display(128, 64, &Wire);
 Ticker DisplayTicker;
@@ -111,7 +128,6 @@ float currentTopicValues[NUMBER_OF_MONITORED_TOPICS];
 TopicLogEntry newLogEntry;
 
 TopicLogEntry* lastLogEntryPtr = nullptr;
-TopicLogEntry* lastStatsEntryPtr = nullptr;
 
 Bsec IAQSensor;
 const uint8_t iaqSensorConfig[] =
@@ -189,9 +205,14 @@ void setup()
     Nav.registerHttpHandlers(WebServer);
 
     WebServer.on("/json", handleHttpJsonRequest);
+    WebServer.on("/iaqlog.bin", handleHttpIAQLogBinaryRequest);
     WebServer.onNotFound(handleHttpNotFound);
 
-    WiFiSM.registerStaticFiles(Files, _LastFile);
+    WiFiSM.registerStaticFiles(StaticFiles, StaticFileCount);
+    if (SPIFFS.begin())
+        IAQLog.load();
+    else
+        WiFiSM.logEvent(F("Starting SPIFFS failed"));
     WiFiSM.on(WiFiInitState::TimeServerInitializing, onWiFiConnected);
     WiFiSM.on(WiFiInitState::TimeServerSynced, onWiFiTimeSynced);
     WiFiSM.on(WiFiInitState::Initialized, onWiFiInitialized);
@@ -489,20 +510,13 @@ void updateIAQ()
     currentTopicValues[TopicId::Fan] = fanIsOn ? 1.0F : 0.0F;
     newLogEntry.aggregate(currentTopicValues);
 
-    if (lastStatsEntryPtr == nullptr || currentTime >= (lastStatsEntryPtr->time + HOUR_LOG_INTERVAL))
-    {
-        TopicLogEntry statsEntry;
-        statsEntry.time = currentTime - currentTime % HOUR_LOG_INTERVAL;
-        statsEntry.reset();
-        lastStatsEntryPtr = HourStats.add(&statsEntry);
-    }
-    lastStatsEntryPtr->aggregate(currentTopicValues);
+    HourStats.update(currentTime, currentTopicValues);
 }
 
 
-void writeIAQLogCsv(TopicLogEntry* logEntryPtr, Print& destination)
+void writeIAQLogCsv(StaticLog<TopicLogEntry>::Range logEntries, Print& destination)
 {
-    while (logEntryPtr != nullptr)
+    for (TopicLogEntry* logEntryPtr : logEntries)
     {
         destination.print(formatTime("%F %H:%M", logEntryPtr->time));
 
@@ -512,8 +526,6 @@ void writeIAQLogCsv(TopicLogEntry* logEntryPtr, Print& destination)
             destination.print(MonitoredTopics[i].formatValue(logEntryPtr->getAverage(i), false, 1));
         }
         destination.println();
-
-        logEntryPtr = IAQLog.getNextEntry();
     }
 }
 
@@ -541,8 +553,7 @@ bool trySyncFTP(Print* printTo)
     {
         if (ftpSyncEntries > 0)
         {
-            TopicLogEntry* firstLogEntryPtr = IAQLog.getEntryFromEnd(ftpSyncEntries);
-            writeIAQLogCsv(firstLogEntryPtr, dataClient);
+            writeIAQLogCsv(IAQLog.getEntriesFromEnd(ftpSyncEntries), dataClient);
             ftpSyncEntries = 0;            
         }
         else if (printTo != nullptr)
@@ -595,15 +606,15 @@ void test(String message)
     }
     else if (message.startsWith("testH"))
     {
+        HourStats.clear();
         for (int i = 0; i < 48; i++)
         {
-            TopicLogEntry statsEntry;
-            statsEntry.time = currentTime + i * 1800;
-            statsEntry.count = 1;
-            statsEntry.topicValues[TopicId::Temperature] = i % 30;
-            statsEntry.topicValues[TopicId::CO2] = 400 + i * 10;
-            statsEntry.topicValues[TopicId::Fan] = float(i) / 48;
-            lastStatsEntryPtr = HourStats.add(&statsEntry);
+            float topicValues[NUMBER_OF_MONITORED_TOPICS];
+            memset(topicValues, 0, sizeof(topicValues));
+            topicValues[TopicId::Temperature] = i % 30;
+            topicValues[TopicId::CO2] = 400 + i * 10;
+            topicValues[TopicId::Fan] = float(i) / 48;
+            HourStats.update(currentTime + i * 1800, topicValues);
         }
     }
     else if (message.startsWith("testN"))
@@ -642,6 +653,7 @@ void handleHttpRootRequest()
     else
         ftpSync = formatTime("%H:%M", lastFTPSyncTime);
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Home"), Nav, HTTP_POLL_INTERVAL);
 
     Html.writeDivStart(F("flex-container"));
@@ -673,7 +685,7 @@ void handleHttpRootRequest()
     Html.writeDivEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -723,12 +735,11 @@ void writeHourStats()
 
     HttpResponse.printf(F("<p>Min CO<sub>2</sub>: %0.0f, Max CO<sub>2</sub>: %0.0f</p>"), minCO2, maxCO2);
 
-    TopicLogEntry* statsEntryPtr = HourStats.getFirstEntry();
-    while (statsEntryPtr != nullptr)
+    for (RollupEntry<NUMBER_OF_MONITORED_TOPICS>* statsEntryPtr : HourStats.getLog())
     {
-        float t = statsEntryPtr->getAverage(TopicId::Temperature);
-        float fan = statsEntryPtr->getAverage(TopicId::Fan) * 100;
-        float co2 = statsEntryPtr->getAverage(TopicId::CO2);
+        float t = statsEntryPtr->getAvg(TopicId::Temperature);
+        float fan = statsEntryPtr->getAvg(TopicId::Fan) * 100;
+        float co2 = statsEntryPtr->getAvg(TopicId::CO2);
 
         float barValue = (co2 - minCO2) / (maxCO2 - minCO2);
 
@@ -745,8 +756,6 @@ void writeHourStats()
         Html.writeBar(barValue, barClass, false);
         Html.writeCellEnd();
         Html.writeRowEnd();
-
-        statsEntryPtr = HourStats.getNextEntry();
     }
 
     Html.writeTableEnd();
@@ -759,13 +768,11 @@ void getCO2Range(float& min, float& max)
     min = 6666;
     max = 0;
 
-    TopicLogEntry* statsEntryPtr = HourStats.getFirstEntry();
-    while (statsEntryPtr != nullptr)
+    for (RollupEntry<NUMBER_OF_MONITORED_TOPICS>* statsEntryPtr : HourStats.getLog())
     {
-        float co2 = statsEntryPtr->getAverage(TopicId::CO2);
+        float co2 = statsEntryPtr->getAvg(TopicId::CO2);
         min = std::min(min, co2);
         max = std::max(max, co2);
-        statsEntryPtr = HourStats.getNextEntry();
     }
 
     if (max == min) max += 1.0F; // Prevent division by zero
@@ -776,24 +783,32 @@ void handleHttpJsonRequest()
 {
     Tracer tracer(F(__func__));
 
-    HttpResponse.clear();
-    HttpResponse.print(F("{ "));
+    HttpResponse.begin(200, ContentTypeJson);
+    Json.beginObject();
 
     for (int i = 0; i < NUMBER_OF_MONITORED_TOPICS; i++)
     {
-        MonitoredTopic topic = MonitoredTopics[i];
-        float topicValue = currentTopicValues[i];
-
-        if (i > 0) HttpResponse.print(F(", "));
-        HttpResponse.printf(
-            F(" \"%s\": %s"),
-            topic.label,
-            topic.formatValue(topicValue, false));
+        const MonitoredTopic& topic = MonitoredTopics[i];
+        Json.writeMember(FPSTR(topic.label), currentTopicValues[i], topic.decimals);
     }
 
-    HttpResponse.println(F(" }"));
+    Json.endObject();
+
+    HttpResponse.end();
+}
+
+
+void handleHttpIAQLogBinaryRequest()
+{
+    Tracer tracer(F(__func__));
+
+    time_t since = WebServer.hasArg("since") ? WebServer.arg("since").toInt() : 0;
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, IAQLog, cursor);
 
-    WebServer.send(200, ContentTypeJson, HttpResponse.c_str());
+    HttpResponse.begin(200, ContentTypeBinary);
+    writeBinaryLog(HttpResponse, incremental ? IAQLog.getEntriesSince(cursor) : IAQLog.getRange(), IAQLogFields, since);
+    HttpResponse.end();
 }
 
 
@@ -804,6 +819,10 @@ void handleHttpIAQLogRequest()
     int currentPage = WebServer.hasArg("page") ? WebServer.arg("page").toInt() : 0;
     int totalPages = ((IAQLog.count() - 1) / IAQ_LOG_PAGE_SIZE) + 1;
 
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, IAQLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("IAQ log"), Nav);
     Html.writePager(totalPages, currentPage);
     Html.writeTableStart();
@@ -816,12 +835,10 @@ void handleHttpIAQLogRequest()
     }
     Html.writeRowEnd();
 
-    TopicLogEntry* logEntryPtr = IAQLog.getFirstEntry();
-    for (int i = 0; i < (currentPage * IAQ_LOG_PAGE_SIZE) && logEntryPtr != nullptr; i++)
-    {
-        logEntryPtr = IAQLog.getNextEntry();
-    }
-    for (int i = 0; i < IAQ_LOG_PAGE_SIZE && logEntryPtr != nullptr; i++)
+    auto logEntries = incremental
+        ? IAQLog.getEntriesSince(cursor)
+        : IAQLog.getRange(currentPage * IAQ_LOG_PAGE_SIZE, IAQ_LOG_PAGE_SIZE);
+    for (TopicLogEntry* logEntryPtr : logEntries)
     {
         Html.writeRowStart();
         Html.writeCell(formatTime("%H:%M", logEntryPtr->time));
@@ -830,14 +847,12 @@ void handleHttpIAQLogRequest()
             Html.writeCell(MonitoredTopics[k].formatValue(logEntryPtr->getAverage(k), false, 1));
         }
         Html.writeRowEnd();
-
-        logEntryPtr = IAQLog.getNextEntry();
     }
 
     Html.writeTableEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -845,6 +860,7 @@ void handleHttpFtpSyncRequest()
 {
     Tracer tracer(F(__func__));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("FTP Sync"), Nav);
 
     HttpResponse.println(F("<pre>"));
@@ -870,7 +886,7 @@ void handleHttpFtpSyncRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -884,20 +900,21 @@ void handleHttpEventLogRequest()
         WiFiSM.logEvent(F("Event log cleared."));
     }
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Event log"), Nav);
 
-    const char* event = EventLog.getFirstEntry();
-    while (event != nullptr)
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, EventLog, cursor);
+    for (const char* event : incremental ? EventLog.getEntriesSince(cursor) : EventLog.getRange())
     {
         Html.writeDiv(event);
-        event = EventLog.getNextEntry();
     }
 
     Html.writeActionLink(F("clear"), F("Clear event log"), currentTime, ButtonClass);
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -905,6 +922,7 @@ void handleHttpConfigFormRequest()
 {
     Tracer tracer(F(__func__));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Settings"), Nav);
 
     Html.writeFormStart(F("/config"), F("grid"));
@@ -925,13 +943,16 @@ void handleHttpConfigFormRequest()
     Html.writeFormEnd();
 
     if (WiFiSM.shouldPerformAction(F("reset")))
+    {
+        IAQLog.flush();
         WiFiSM.reset();
+    }
     else
         Html.writeActionLink(F("reset"), F("Reset ESP"), currentTime, ButtonClass);
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -0,0 +1,537 @@
+// Generated by tools/embed_static_files.py from data/; do not edit.
+#ifndef STATIC_FILES_H
+#define STATIC_FILES_H
+
+#include <StaticFile.h>
+
+// Graph.svg: 493 bytes, 302 bytes gzipped
+static const char Graph_svg_Path[] PROGMEM = "/Graph.svg";
+static const char Graph_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Graph_svg_ETag[] PROGMEM = "\"03a7c9b308f8d649\"";
+static const uint8_t Graph_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x90, 0xCB, 0x6E, 0xC2, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xE9, 0x74, 0x4B, 0x1C, 0x3B, 0x71, 0x44, 0x82, 0x30, 0x48, 0xAD,
+    0x54, 0xBA, 0x80, 0x4D, 0x1F, 0xEC, 0x23, 0x62, 0x12, 0xB7, 0xC1, 0x13, 0x39, 0x86, 0xE4, 0xF3,
+    0x6B, 0x50, 0x4B, 0xDB, 0x0F, 0xE8, 0x95, 0x65, 0x69, 0x8E, 0x6D, 0xDD, 0x23, 0xCF, 0x97, 0xE3,
+    0xA1, 0x85, 0x93, 0x76, 0xBD, 0x21, 0xAB, 0x50, 0x30, 0x8E, 0xA0, 0xED, 0x8E, 0x2A, 0x63, 0x6B,
+    0x85, 0x47, 0xBF, 0x8F, 0x72, 0x5C, 0x2E, 0xE6, 0xB7, 0x51, 0x04, 0x6F, 0x5D, 0x4B, 0x65, 0xA5,
+    0x2B, 0xF0, 0x34, 0x83, 0x97, 0xED, 0x0A, 0x9E, 0x75, 0x47, 0x13, 0x18, 0x86, 0x81, 0xF5, 0xA7,
+    0xDA, 0x85, 0x81, 0xED, 0xE8, 0x30, 0x81, 0x95, 0xB6, 0xDA, 0x95, 0x9E, 0xDC, 0xCF, 0x2D, 0xD8,
+    0x98, 0x51, 0x3B, 0x78, 0x25, 0x6A, 0x7B, 0x88, 0xA2, 0xC5, 0xCD, 0x3C, 0xBC, 0x80, 0xC1, 0x54,
+    0xBE, 0x51, 0x98, 0x73, 0xDE, 0x8D, 0x08, 0x8D, 0x36, 0x75, 0xE3, 0xAF, 0xE3, 0xC9, 0xE8, 0xE1,
+    0x9E, 0x46, 0x85, 0x1C, 0x38, 0x24, 0x32, 0x2C, 0x84, 0xBD, 0x69, 0x5B, 0x85, 0x77, 0xFC, 0x12,
+    0x84, 0x60, 0x6E, 0x7B, 0x85, 0x8D, 0xF7, 0xDD, 0x2C, 0x8E, 0xCF, 0x1E, 0x43, 0xCA, 0xC8, 0xD5,
+    0x71, 0x12, 0x8E, 0xE3, 0xD0, 0x80, 0xA1, 0xA8, 0x2B, 0x7D, 0x03, 0x95, 0xC2, 0x8D, 0x84, 0x6C,
+    0x2B, 0x8A, 0x07, 0x09, 0xA2, 0x60, 0x59, 0x96, 0xA4, 0x20, 0x99, 0x94, 0xD3, 0x69, 0x02, 0x09,
+    0x87, 0x2C, 0x6C, 0x4F, 0xA2, 0x40, 0xE8, 0xBD, 0xA3, 0x0F, 0x1D, 0x3A, 0x1E, 0x2F, 0xF9, 0x06,
+    0xD1, 0x97, 0x6A, 0x72, 0x05, 0xAD, 0xB1, 0x7A, 0x57, 0x76, 0x0A, 0x1D, 0x1D, 0x6D, 0xF5, 0x07,
+    0xBF, 0x93, 0xB1, 0xDF, 0x3C, 0xFE, 0x6D, 0x20, 0x72, 0x28, 0xD6, 0x22, 0x05, 0x91, 0xB2, 0x22,
+    0x64, 0x2D, 0x38, 0xCB, 0x40, 0x08, 0x26, 0x8B, 0x22, 0x5F, 0x4F, 0x41, 0xC8, 0x33, 0xCE, 0xFF,
+    0x47, 0xE2, 0xFC, 0x1D, 0x8B, 0x4F, 0x9B, 0x87, 0x3D, 0xE7, 0xED, 0x01, 0x00, 0x00,
+};
+
+// Home.svg: 1891 bytes, 864 bytes gzipped
+static const char Home_svg_Path[] PROGMEM = "/Home.svg";
+static const char Home_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Home_svg_ETag[] PROGMEM = "\"7fcea6beaa9c719f\"";
+static const uint8_t Home_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x65, 0x55, 0x4D, 0x6F, 0x23, 0x37,
+    0x0C, 0xBD, 0xF7, 0x57, 0xA8, 0xD3, 0xEB, 0x5A, 0xA6, 0x24, 0xEA, 0x83, 0x8B, 0x38, 0x0B, 0x74,
+    0x80, 0x6E, 0x0E, 0xD9, 0x4B, 0x3F, 0x72, 0xE8, 0x2D, 0x58, 0x7B, 0x63, 0x03, 0x5E, 0x8F, 0xE1,
+    0xB8, 0x71, 0x7E, 0x7E, 0x49, 0x4A, 0xF2, 0x6C, 0xDD, 0x20, 0xF0, 0xE8, 0x49, 0x24, 0xDF, 0x1B,
+    0xF2, 0xC9, 0xBE, 0xFB, 0xF4, 0xFE, 0x7D, 0x6F, 0xDE, 0x36, 0xA7, 0xD7, 0xDD, 0x74, 0x58, 0x0D,
+    0xCE, 0xC2, 0x60, 0x36, 0x87, 0xAF, 0xD3, 0x7A, 0x77, 0x78, 0x59, 0x0D, 0xFF, 0x9C, 0xBF, 0x2D,
+    0xCA, 0xF0, 0xE9, 0xFE, 0xEE, 0xE7, 0xC5, 0xC2, 0xFC, 0x75, 0xDC, 0x4F, 0xCF, 0xEB, 0xCD, 0xDA,
+    0x9C, 0xA7, 0x8F, 0xE6, 0x8F, 0xA7, 0xCF, 0xE6, 0xF7, 0xCD, 0x71, 0xFA, 0x60, 0x2E, 0x97, 0x8B,
+    0x7D, 0x7D, 0x7B, 0x39, 0x31, 0xB0, 0x5F, 0xA7, 0xEF, 0x1F, 0xCC, 0xE7, 0xCD, 0x61, 0x73, 0x7A,
+    0x3E, 0x4F, 0xA7, 0x39, 0xCA, 0x7C, 0xD9, 0xBD, 0x6F, 0x4E, 0xE6, 0xCF, 0x69, 0xDA, 0xBF, 0x9A,
+    0xC5, 0xE2, 0xFE, 0xA7, 0x3B, 0xCE, 0x30, 0x97, 0xDD, 0xFA, 0xBC, 0x5D, 0x0D, 0x05, 0xE0, 0xF8,
+    0x3E, 0x98, 0xED, 0x66, 0xF7, 0xB2, 0x3D, 0x5F, 0xE1, 0xDB, 0x6E, 0x73, 0xF9, 0x75, 0x7A, 0x5F,
+    0x0D, 0x60, 0xC0, 0x78, 0xE4, 0xFF, 0xC1, 0x7C, 0xDB, 0xED, 0xF7, 0xAB, 0xE1, 0x97, 0xDF, 0xF4,
+    0x6F, 0x30, 0xAC, 0xFC, 0xF0, 0xBA, 0x1A, 0xB6, 0xE7, 0xF3, 0xF1, 0xE3, 0x72, 0x29, 0x3A, 0x2E,
+    0xC1, 0x4E, 0xA7, 0x97, 0xA5, 0x07, 0x80, 0x25, 0x33, 0x0C, 0x4C, 0x74, 0x7C, 0x3E, 0x6F, 0xCD,
+    0x7A, 0x35, 0x7C, 0xF1, 0x60, 0x9C, 0xB3, 0x39, 0x8E, 0x8E, 0x6C, 0x09, 0x39, 0x55, 0x04, 0xD9,
+    0x30, 0x4E, 0x99, 0xA2, 0xE0, 0x44, 0x45, 0x60, 0xAC, 0xE0, 0xD1, 0x79, 0x13, 0x2D, 0xE1, 0x23,
+    0x5A, 0xAC, 0x3B, 0x23, 0x5A, 0x4F, 0x50, 0xB2, 0xE6, 0x3A, 0x0A, 0x06, 0x2D, 0x30, 0xD6, 0xC3,
+    0x9C, 0x21, 0x99, 0x60, 0x0B, 0x05, 0x42, 0xC5, 0xE8, 0xE3, 0x18, 0xB8, 0x64, 0x06, 0x5F, 0xE3,
+    0x31, 0xF0, 0x79, 0xE4, 0xB4, 0x5A, 0x0C, 0xC8, 0x31, 0xD6, 0x58, 0x94, 0x48, 0x5F, 0x20, 0xA9,
+    0x2A, 0xA6, 0x20, 0x3E, 0xF1, 0x9E, 0xD0, 0x09, 0x16, 0x0A, 0xC1, 0x31, 0x47, 0x8E, 0x06, 0xA5,
+    0xD0, 0xF8, 0x98, 0xB2, 0x60, 0xA6, 0xE0, 0xE3, 0x50, 0x85, 0x81, 0x32, 0x08, 0x51, 0x14, 0x80,
+    0x8F, 0x5C, 0x80, 0x97, 0xFC, 0x0A, 0xA3, 0x90, 0x66, 0x7E, 0x43, 0xB4, 0x01, 0x7C, 0x0A, 0x52,
+    0x9A, 0x1B, 0x91, 0x19, 0x7B, 0x8E, 0xF5, 0xFA, 0x1C, 0x9D, 0xB7, 0x2E, 0xF9, 0xD0, 0x37, 0x6D,
+    0xF0, 0xE0, 0xE7, 0x0C, 0x2F, 0x9D, 0xE0, 0x5A, 0x8F, 0x1E, 0xB4, 0x27, 0xFC, 0x39, 0xF2, 0x32,
+    0x52, 0xF4, 0x95, 0x3A, 0x93, 0xF1, 0xA2, 0xC8, 0x39, 0x55, 0x56, 0xA2, 0xE2, 0xEC, 0x0A, 0xA9,
+    0xF2, 0x0C, 0x24, 0xF1, 0x19, 0xEB, 0x9B, 0x42, 0x6C, 0xE7, 0x80, 0xDA, 0x23, 0x8F, 0x98, 0x34,
+    0x5F, 0x9B, 0xA2, 0x95, 0x43, 0x15, 0x1A, 0x21, 0xC8, 0x01, 0x62, 0xD1, 0xC0, 0x58, 0x4A, 0x11,
+    0x1C, 0x30, 0x68, 0x6C, 0x42, 0x2A, 0x12, 0xEE, 0x03, 0xD5, 0x5E, 0x83, 0x1E, 0x3B, 0xEF, 0xEA,
+    0x28, 0x58, 0x5E, 0x9F, 0xFF, 0xDF, 0x83, 0x59, 0xFE, 0xE8, 0x0B, 0xA7, 0x23, 0xCF, 0xF1, 0x21,
+    0x8D, 0xD1, 0x16, 0x50, 0xA5, 0x8C, 0x31, 0x23, 0x0F, 0x3F, 0x39, 0x7D, 0x6D, 0x76, 0x48, 0x62,
+    0xC7, 0x44, 0x8B, 0xD9, 0x47, 0xC5, 0xD1, 0xB3, 0x93, 0xA2, 0x0D, 0x81, 0x25, 0x0B, 0x0E, 0x45,
+    0xE3, 0x7D, 0xF4, 0x51, 0xF3, 0x1D, 0x15, 0xA7, 0x98, 0xC1, 0x13, 0x87, 0x8F, 0xBA, 0xE6, 0x38,
+    0x70, 0x3C, 0x5C, 0x4E, 0xE4, 0x21, 0x7B, 0xC6, 0xCE, 0x41, 0x10, 0x97, 0x61, 0x22, 0x1E, 0x66,
+    0xB1, 0x24, 0xCF, 0x51, 0x88, 0x65, 0xBF, 0xD8, 0xA2, 0x71, 0x2A, 0x8C, 0xF3, 0x0A, 0xEB, 0x34,
+    0x49, 0x1F, 0x63, 0x12, 0x0E, 0xB6, 0x50, 0xDD, 0x63, 0x01, 0x94, 0xCA, 0x35, 0x21, 0x71, 0xE3,
+    0x20, 0x84, 0x6B, 0xC1, 0xC4, 0x93, 0x07, 0x1E, 0x7D, 0x27, 0x4C, 0x92, 0xD4, 0xD5, 0x34, 0x10,
+    0x9F, 0x5C, 0x61, 0x91, 0x0F, 0x2E, 0xF3, 0xA7, 0x6A, 0xD6, 0xD5, 0x35, 0x8C, 0x11, 0xAB, 0xBE,
+    0x96, 0x60, 0x88, 0xE2, 0xBC, 0x4E, 0xC1, 0x58, 0x44, 0x5F, 0x25, 0x30, 0x66, 0xD1, 0x4D, 0x9F,
+    0x2B, 0x55, 0x34, 0x33, 0x88, 0xEA, 0xBE, 0x29, 0xAA, 0xF3, 0x9C, 0x51, 0x54, 0xF5, 0x5C, 0xB1,
+    0xB0, 0x6A, 0x37, 0x13, 0x96, 0x1F, 0x45, 0x77, 0xC4, 0xAA, 0x49, 0x22, 0x75, 0x60, 0xBD, 0xF1,
+    0x92, 0x29, 0x03, 0xEB, 0x83, 0x91, 0xCA, 0x5E, 0x18, 0xDB, 0xE0, 0x94, 0xB9, 0xC6, 0xD7, 0xB8,
+    0xD2, 0xF2, 0xDA, 0xE0, 0xBB, 0x27, 0xFE, 0xE7, 0x15, 0xAC, 0xFB, 0xA3, 0x0B, 0xF2, 0x72, 0xB3,
+    0x53, 0x18, 0x8B, 0x55, 0xE6, 0x82, 0x41, 0xAD, 0x32, 0x13, 0x06, 0xB5, 0xCA, 0x2C, 0x48, 0xAE,
+    0x73, 0x8D, 0xAF, 0xC4, 0xA1, 0x59, 0x85, 0x6F, 0x18, 0x5B, 0x91, 0xAF, 0x4A, 0xAE, 0x2F, 0x06,
+    0xB6, 0xCA, 0xD6, 0xAE, 0xC9, 0x8D, 0xCA, 0xAE, 0x16, 0xA1, 0x7A, 0xD7, 0xA5, 0x5F, 0x42, 0xC2,
+    0x4F, 0x09, 0xAE, 0xFB, 0x54, 0xC3, 0xA0, 0x65, 0x91, 0xD6, 0x80, 0x26, 0x9D, 0x9A, 0x97, 0xEA,
+    0x36, 0x35, 0xA7, 0xB5, 0x1C, 0x6A, 0x46, 0xEC, 0x25, 0xA9, 0x19, 0xB5, 0x53, 0x52, 0x95, 0x59,
+    0x0B, 0xD3, 0x55, 0xF3, 0x48, 0xDD, 0xF9, 0xAE, 0xF6, 0x85, 0xFA, 0xCD, 0x70, 0xB5, 0x2F, 0xD4,
+    0x6F, 0x8E, 0xD3, 0xC5, 0x48, 0xFD, 0x66, 0xB9, 0xDA, 0x17, 0xEA, 0x37, 0xCF, 0xB5, 0xBE, 0x40,
+    0x5D, 0x3E, 0x38, 0xFE, 0xDA, 0xC2, 0xD6, 0xA3, 0x7E, 0x86, 0xAD, 0x87, 0x2D, 0x97, 0x71, 0x1D,
+    0x6E, 0xAB, 0xCD, 0xB8, 0xCE, 0xA0, 0x71, 0x33, 0xAE, 0x33, 0x6A, 0xDA, 0x04, 0xCB, 0x57, 0x9B,
+    0xF6, 0x17, 0x6F, 0x8C, 0x83, 0x37, 0xC6, 0xC1, 0x1B, 0xE3, 0xE0, 0x8D, 0x71, 0xF0, 0xC6, 0x38,
+    0xF8, 0x1F, 0xE3, 0xC8, 0x8F, 0xD0, 0xFD, 0xBF, 0x00, 0x20, 0x89, 0x5E, 0x63, 0x07, 0x00, 0x00,
+};
+
+// LogFile.svg: 1064 bytes, 392 bytes gzipped
+static const char LogFile_svg_Path[] PROGMEM = "/LogFile.svg";
+static const char LogFile_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char LogFile_svg_ETag[] PROGMEM = "\"e9ab3d26f6d62e2e\"";
+static const uint8_t LogFile_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x93, 0xCB, 0x4E, 0xC3, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xC1, 0x6C, 0x9B, 0x89, 0x1F, 0x79, 0x56, 0x49, 0x90, 0x58, 0x40,
+    0x37, 0x6C, 0x78, 0x74, 0xC1, 0xA6, 0xAA, 0x1A, 0x37, 0x89, 0x94, 0xC6, 0x51, 0x62, 0x9A, 0xF2,
+    0xF7, 0x38, 0x6D, 0x45, 0x03, 0x12, 0x90, 0x2E, 0xB0, 0x2C, 0x59, 0x33, 0x9A, 0xA3, 0x7B, 0xEF,
+    0x48, 0x8E, 0x6E, 0xF6, 0xDB, 0x12, 0x76, 0xB2, 0x69, 0x0B, 0x55, 0xC5, 0x84, 0x21, 0x25, 0x20,
+    0xAB, 0xB5, 0x4A, 0x8B, 0x2A, 0x8B, 0xC9, 0x9B, 0xDE, 0x58, 0x01, 0xB9, 0x49, 0xA2, 0x2B, 0xCB,
+    0x82, 0x97, 0xBA, 0x54, 0xAB, 0x54, 0xA6, 0xA0, 0xD5, 0x0C, 0x9E, 0x16, 0xF7, 0xF0, 0x28, 0x6B,
+    0x35, 0x85, 0xAE, 0xEB, 0xB0, 0xDD, 0x65, 0x8D, 0x29, 0x70, 0xAD, 0xB6, 0x53, 0xB8, 0x97, 0x95,
+    0x6C, 0x56, 0x5A, 0x35, 0xE7, 0x29, 0x78, 0x28, 0xF6, 0xB2, 0x81, 0x67, 0xA5, 0xCA, 0x16, 0x2C,
+    0x2B, 0x99, 0x44, 0x86, 0x80, 0x4D, 0x51, 0x96, 0x31, 0xB9, 0xBE, 0x3B, 0x1C, 0x02, 0x5D, 0x91,
+    0xEA, 0x3C, 0x26, 0x01, 0xA5, 0xF5, 0x9E, 0x40, 0x2E, 0x8B, 0x2C, 0xD7, 0x9F, 0xE5, 0xAE, 0x90,
+    0xDD, 0xAD, 0xDA, 0xC7, 0x84, 0x02, 0x05, 0xC1, 0xCD, 0x25, 0x60, 0x9C, 0x57, 0x6D, 0x4C, 0x72,
+    0xAD, 0xEB, 0x99, 0x6D, 0xF7, 0x3E, 0x3A, 0x81, 0xAA, 0xC9, 0x6C, 0x4E, 0x29, 0xB5, 0x8D, 0x02,
+    0x31, 0x42, 0xBA, 0xD0, 0xA5, 0x4C, 0x8C, 0x94, 0x5C, 0xEA, 0xF7, 0x5A, 0x2E, 0x4B, 0x95, 0x45,
+    0xF6, 0xB1, 0x39, 0x89, 0xEA, 0x95, 0xCE, 0x21, 0x8D, 0xC9, 0x03, 0x0F, 0xD1, 0x99, 0x72, 0x1F,
+    0xBD, 0x39, 0x47, 0x77, 0xE1, 0xA0, 0x3B, 0xEF, 0x3B, 0xAF, 0x5B, 0x8B, 0xBB, 0x18, 0x5A, 0x6C,
+    0xCE, 0x03, 0x74, 0x16, 0xAE, 0x69, 0x0B, 0x74, 0x5F, 0x89, 0x6D, 0xD0, 0x46, 0xAE, 0x35, 0x18,
+    0x3F, 0x66, 0x9E, 0xC0, 0x7B, 0x4C, 0xDC, 0xFE, 0x3D, 0x45, 0xE0, 0x1E, 0x86, 0xE7, 0x04, 0xAC,
+    0x2F, 0x86, 0x08, 0x63, 0x28, 0x84, 0x38, 0x50, 0xE1, 0x80, 0x0A, 0x90, 0x79, 0xFE, 0x00, 0xFB,
+    0x11, 0x62, 0x1C, 0x69, 0x20, 0x3E, 0x39, 0x76, 0xB0, 0x30, 0x02, 0x73, 0xD0, 0x3F, 0xAB, 0x31,
+    0x8A, 0x1E, 0x1B, 0x27, 0xE7, 0xA3, 0x3B, 0x94, 0x73, 0xC6, 0xFA, 0xE4, 0x74, 0x90, 0x2E, 0xC4,
+    0x40, 0x38, 0xBF, 0x51, 0xC7, 0x35, 0x72, 0xF1, 0x3D, 0xDB, 0x6F, 0x62, 0xEE, 0x89, 0x1A, 0xAE,
+    0xD1, 0x39, 0xEA, 0xFF, 0x41, 0x7C, 0xDB, 0xE1, 0x7F, 0x42, 0x0E, 0x7A, 0x7D, 0x84, 0xCB, 0x20,
+    0x1F, 0xF9, 0xA5, 0x91, 0xBE, 0xAC, 0x7B, 0x24, 0x22, 0x46, 0x04, 0xEA, 0x7F, 0x52, 0xF2, 0x01,
+    0x93, 0x18, 0xC4, 0xA1, 0x28, 0x04, 0x00, 0x00,
+};
+
+// Logo.png: 2662 bytes, 2685 bytes gzipped (stored uncompressed)
+static const char Logo_png_Path[] PROGMEM = "/Logo.png";
+static const char Logo_png_ContentType[] PROGMEM = "image/png";
+static const char Logo_png_ETag[] PROGMEM = "\"bf1244bc0f171fe2\"";
+static const uint8_t Logo_png_Data[] PROGMEM =
+{
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x08, 0x06, 0x00, 0x00, 0x00, 0xC3, 0x3E, 0x61,
+    0xCB, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
+    0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00,
+    0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0E, 0xC3, 0x00, 0x00, 0x0E, 0xC3, 0x01, 0xC7,
+    0x6F, 0xA8, 0x64, 0x00, 0x00, 0x09, 0xFB, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x9D, 0x67,
+    0xA8, 0xE5, 0x44, 0x14, 0xC7, 0xDF, 0x73, 0xD7, 0x6D, 0xEA, 0xBA, 0x96, 0xC5, 0xBE, 0xB6, 0xD5,
+    0x0F, 0xB6, 0x15, 0x15, 0x51, 0x14, 0x0B, 0x16, 0xEC, 0xF8, 0xC1, 0x5E, 0xB0, 0x23, 0xA2, 0xA2,
+    0x82, 0x05, 0x0B, 0x7E, 0x50, 0x51, 0xB1, 0x21, 0x2A, 0x88, 0x82, 0x0D, 0x0B, 0x76, 0x41, 0xC5,
+    0xB6, 0x36, 0x44, 0x51, 0xB1, 0xA0, 0xA8, 0x88, 0x0D, 0xEC, 0x62, 0xD7, 0xB5, 0x77, 0xFF, 0xFF,
+    0x7B, 0x33, 0x4B, 0xDE, 0x7B, 0xE7, 0x66, 0x66, 0x92, 0x99, 0xDC, 0x4C, 0x72, 0x7E, 0xF0, 0x63,
+    0xEF, 0x7D, 0x7B, 0x4B, 0x92, 0x73, 0x32, 0x99, 0x9C, 0x99, 0xE4, 0x8E, 0x34, 0x85, 0x67, 0xFF,
+    0x9B, 0xF9, 0x5F, 0xF6, 0x50, 0xA9, 0x91, 0x45, 0xB2, 0x7F, 0x95, 0x8E, 0xA2, 0x09, 0xD0, 0x71,
+    0x34, 0x01, 0x94, 0xE1, 0xA3, 0xC7, 0xFF, 0xE1, 0xA1, 0x2D, 0x80, 0xA2, 0x28, 0x8A, 0xD2, 0x51,
+    0xE6, 0xC1, 0xD1, 0xFE, 0x43, 0xA5, 0x6B, 0x9C, 0x0C, 0xFF, 0x86, 0x97, 0xC0, 0xC9, 0xFC, 0x83,
+    0xD2, 0x0D, 0xD8, 0xF1, 0xBD, 0x00, 0xFE, 0x03, 0x79, 0xF6, 0x41, 0x6F, 0x80, 0xD3, 0xA0, 0xD2,
+    0x72, 0xA6, 0xC0, 0x2B, 0xA1, 0x09, 0x7C, 0xDE, 0x7B, 0xE1, 0xE2, 0x50, 0x69, 0x29, 0x33, 0xE0,
+    0xAD, 0x50, 0x0A, 0xBE, 0xF1, 0x69, 0x38, 0x1B, 0x2A, 0x2D, 0x63, 0x29, 0xF8, 0x28, 0x94, 0x82,
+    0x3E, 0xDE, 0x57, 0xE1, 0x6A, 0x50, 0x69, 0x09, 0x2B, 0xC1, 0xE7, 0xA1, 0x14, 0xEC, 0x41, 0x7E,
+    0x04, 0xD7, 0x81, 0x4A, 0xE2, 0xAC, 0x05, 0xDF, 0x86, 0x52, 0x90, 0x6D, 0x7E, 0x07, 0x37, 0x83,
+    0x4A, 0xA2, 0x6C, 0x02, 0x3F, 0x83, 0x52, 0x70, 0x5D, 0xFD, 0x0D, 0xEE, 0x0A, 0x95, 0xC4, 0xD8,
+    0x01, 0x7E, 0x03, 0xA5, 0xA0, 0x1A, 0x3F, 0x86, 0xBB, 0xC1, 0x37, 0x72, 0x7F, 0x93, 0x64, 0xAD,
+    0xE0, 0x00, 0xA8, 0x24, 0xC2, 0x3E, 0xF0, 0x67, 0x28, 0x05, 0xD3, 0xF8, 0x0E, 0x5C, 0x1B, 0x92,
+    0x59, 0xF0, 0x39, 0x28, 0xBD, 0x2E, 0xEF, 0xF1, 0x50, 0x69, 0x30, 0x2C, 0xE9, 0x1E, 0x0B, 0xFF,
+    0x84, 0x52, 0x00, 0x8D, 0x2F, 0xC1, 0x15, 0x60, 0x9E, 0xA9, 0xF0, 0x41, 0x28, 0xBD, 0x3E, 0xEF,
+    0x79, 0x50, 0x47, 0x50, 0x1B, 0x08, 0x83, 0x72, 0x26, 0x64, 0x73, 0x2D, 0x05, 0xCE, 0xF8, 0x18,
+    0x5C, 0x06, 0x4A, 0x4C, 0x82, 0xB7, 0x41, 0xE9, 0x7D, 0x79, 0x59, 0x48, 0x62, 0x41, 0x49, 0x69,
+    0x08, 0x0C, 0x3E, 0xEB, 0xF9, 0xFF, 0x42, 0x29, 0x60, 0xC6, 0xBB, 0xA0, 0x4B, 0xA5, 0xEF, 0x2A,
+    0x28, 0xBD, 0x3F, 0xEF, 0x2D, 0x70, 0x3A, 0x54, 0x86, 0x0C, 0xEB, 0xF7, 0xD7, 0x41, 0x29, 0x48,
+    0x79, 0xAF, 0x86, 0x8B, 0x42, 0x57, 0xCE, 0x86, 0xF9, 0xB1, 0x02, 0xC9, 0x47, 0xE0, 0x92, 0x50,
+    0x19, 0x12, 0x33, 0x21, 0xF7, 0x6A, 0x29, 0x38, 0x46, 0xB6, 0x0A, 0x17, 0x42, 0x36, 0xEF, 0xBE,
+    0x9C, 0x08, 0x6D, 0xFD, 0x09, 0x76, 0x1E, 0x57, 0x84, 0x4A, 0xCD, 0x2C, 0x0D, 0x9F, 0x82, 0x52,
+    0x50, 0x8C, 0xDC, 0x83, 0x4F, 0x87, 0x55, 0xC6, 0xFB, 0x0F, 0x83, 0xBF, 0x43, 0xE9, 0xF3, 0x8D,
+    0x6F, 0xC1, 0x35, 0xA1, 0x52, 0x13, 0xAB, 0xC2, 0xD7, 0xA0, 0x14, 0x0C, 0xE3, 0x1F, 0xF0, 0x18,
+    0x18, 0x82, 0xDD, 0xE1, 0x02, 0x28, 0x7D, 0x8F, 0xF1, 0x4B, 0xB8, 0x21, 0x54, 0x22, 0xB3, 0x3E,
+    0x7C, 0x0F, 0x4A, 0x41, 0x30, 0xB2, 0x06, 0x70, 0x10, 0x0C, 0xC9, 0xB6, 0x90, 0x41, 0x96, 0xBE,
+    0xCF, 0xC8, 0x24, 0xE1, 0xEB, 0x94, 0x48, 0x6C, 0x0E, 0x6D, 0x41, 0xF8, 0x11, 0xEE, 0x04, 0x63,
+    0xB0, 0x11, 0x64, 0xF5, 0x50, 0xFA, 0x5E, 0x23, 0x0F, 0x17, 0x7B, 0x42, 0x25, 0x30, 0x2E, 0xCD,
+    0xF0, 0xE7, 0x30, 0xF6, 0xE0, 0x0D, 0x0F, 0x3F, 0xB6, 0xC1, 0x25, 0x76, 0x3C, 0x8F, 0x80, 0x4A,
+    0x20, 0x0E, 0x87, 0xBF, 0x40, 0x69, 0x63, 0x1B, 0x79, 0x58, 0xE0, 0xE1, 0xA1, 0x0E, 0x38, 0x61,
+    0xE4, 0x05, 0x28, 0x2D, 0x87, 0x91, 0x49, 0x70, 0x1A, 0xD4, 0xAA, 0x61, 0x05, 0xD8, 0x7B, 0x3F,
+    0x01, 0xFE, 0x05, 0xA5, 0x8D, 0x6C, 0xE4, 0x60, 0xCE, 0x1C, 0x58, 0x27, 0x2C, 0x28, 0x3D, 0x0E,
+    0xA5, 0xE5, 0xC9, 0x7B, 0x11, 0xD4, 0x24, 0x28, 0x01, 0x37, 0xDA, 0x39, 0xD0, 0x56, 0xDD, 0xE3,
+    0x14, 0xAE, 0x41, 0xA5, 0xDD, 0xD8, 0x30, 0x41, 0xEF, 0x86, 0xD2, 0x72, 0xE5, 0x65, 0xA1, 0x8A,
+    0x63, 0x0D, 0x8A, 0x23, 0xAC, 0xD8, 0xB1, 0xDE, 0x6E, 0x0B, 0xFE, 0x3D, 0x70, 0xD8, 0x95, 0x38,
+    0x26, 0xEA, 0x35, 0xD0, 0xB6, 0xAC, 0x77, 0x42, 0x16, 0xAE, 0x14, 0x0B, 0xAC, 0xAF, 0xDF, 0x0C,
+    0xA5, 0x8D, 0x98, 0xF7, 0x26, 0xD8, 0xA4, 0x69, 0xDC, 0x9C, 0x66, 0x6E, 0x4B, 0x02, 0x1E, 0x32,
+    0x58, 0xC0, 0x52, 0x06, 0xC0, 0x71, 0x79, 0xDB, 0x90, 0x2C, 0x37, 0xF2, 0x65, 0xB0, 0x4C, 0x69,
+    0x37, 0x36, 0xA7, 0x40, 0xDB, 0x68, 0x24, 0x0B, 0x58, 0xAB, 0x40, 0x65, 0x1C, 0x1C, 0x9F, 0xB7,
+    0x4D, 0xDC, 0x64, 0x69, 0xF7, 0x2C, 0xD8, 0xE4, 0x4E, 0xD5, 0x91, 0xD0, 0x56, 0x3A, 0xFE, 0x00,
+    0xAE, 0x0B, 0x95, 0x0C, 0xD6, 0xD1, 0x59, 0x4F, 0x97, 0x36, 0x96, 0x91, 0x67, 0x02, 0x1C, 0x9C,
+    0x49, 0xE1, 0x3A, 0x3E, 0xCE, 0x48, 0xB2, 0x9D, 0xB6, 0x7E, 0x0D, 0x37, 0x85, 0x9D, 0xC7, 0xA5,
+    0xBA, 0xC6, 0x89, 0x99, 0x1C, 0x94, 0x49, 0x89, 0xED, 0xE1, 0xB7, 0x50, 0x5A, 0x1F, 0x23, 0xD7,
+    0x8B, 0x73, 0x17, 0x3B, 0xCB, 0x76, 0xD0, 0x36, 0x71, 0x93, 0xD5, 0xBF, 0x3D, 0x60, 0x8A, 0xB0,
+    0x2A, 0xF9, 0x09, 0x94, 0xD6, 0xCB, 0xC8, 0x96, 0xED, 0x40, 0xD8, 0x39, 0xF6, 0x82, 0x3F, 0x41,
+    0x69, 0xA3, 0x18, 0xBF, 0x82, 0xDB, 0xC0, 0x94, 0xE1, 0xC4, 0xD3, 0xF7, 0xA1, 0xB4, 0x7E, 0x46,
+    0x76, 0x6C, 0x39, 0x97, 0x31, 0x85, 0xC3, 0x5B, 0x10, 0x8E, 0x86, 0x1C, 0xAE, 0x95, 0x36, 0x86,
+    0x91, 0x57, 0xE6, 0xB4, 0x65, 0x78, 0x75, 0x79, 0x68, 0x1B, 0xBE, 0xA6, 0x9C, 0x85, 0xD4, 0xEA,
+    0xAA, 0x21, 0x33, 0xFC, 0x0C, 0x68, 0x3B, 0x55, 0x62, 0x87, 0x70, 0x75, 0xD8, 0x26, 0x58, 0x04,
+    0x7A, 0x12, 0x4A, 0xEB, 0x9B, 0x97, 0x05, 0xB0, 0x56, 0xDE, 0xAB, 0x80, 0x2B, 0x75, 0x3E, 0xB4,
+    0x15, 0x4B, 0x78, 0x2A, 0x38, 0x7E, 0xCA, 0x76, 0x5B, 0x60, 0x39, 0xF8, 0x7E, 0x28, 0xAD, 0x77,
+    0x5E, 0x16, 0xC2, 0x5A, 0x35, 0xE1, 0x94, 0xA5, 0xDD, 0x6B, 0xA1, 0xB4, 0xB2, 0x79, 0x1F, 0x86,
+    0x2C, 0x06, 0xB5, 0x19, 0xB6, 0x82, 0xAC, 0x62, 0x4A, 0xEB, 0x9F, 0xF7, 0x01, 0xD8, 0x8A, 0x09,
+    0xA7, 0x1C, 0x35, 0x63, 0xCD, 0x5E, 0x5A, 0xC9, 0xBC, 0xAD, 0xCB, 0x7A, 0x0B, 0x17, 0x43, 0x5B,
+    0x6B, 0xF8, 0x2C, 0x64, 0xFF, 0x21, 0x59, 0x38, 0x6E, 0xCE, 0x0B, 0x31, 0xA4, 0x95, 0x33, 0x72,
+    0x23, 0x70, 0x1E, 0xBE, 0xCF, 0x94, 0xED, 0xB6, 0xC0, 0xAA, 0xA6, 0xAD, 0x3F, 0xF4, 0x26, 0x4C,
+    0x72, 0xC2, 0x29, 0xAF, 0xC9, 0x7F, 0x05, 0x4A, 0x2B, 0x65, 0x64, 0xF0, 0x79, 0xA9, 0x55, 0xE5,
+    0xBA, 0x3E, 0xEF, 0x34, 0x2A, 0x89, 0xFF, 0xDA, 0xB1, 0xFF, 0x8A, 0xC6, 0x72, 0x1C, 0xB4, 0x4D,
+    0x3D, 0x67, 0x2D, 0x81, 0x77, 0x33, 0x8B, 0x42, 0x8C, 0x73, 0x4F, 0xDE, 0x58, 0x81, 0xC7, 0xB0,
+    0x35, 0x7A, 0xCF, 0x64, 0x58, 0xD7, 0xE7, 0x8C, 0x19, 0x0E, 0xEC, 0x70, 0x25, 0xBD, 0xC8, 0x82,
+    0xEB, 0xC4, 0x96, 0xA3, 0x0B, 0x9A, 0x7E, 0x7E, 0xBD, 0x1F, 0xBC, 0x1E, 0x16, 0x1D, 0x02, 0x39,
+    0xD1, 0x95, 0x97, 0xA9, 0x3F, 0xD3, 0x7B, 0x16, 0x90, 0xD0, 0xE7, 0x9D, 0x5B, 0xC0, 0xF9, 0xB0,
+    0x28, 0xF8, 0x1C, 0x2C, 0x61, 0xE1, 0xE3, 0x52, 0xE8, 0x13, 0xFC, 0xD1, 0xDC, 0x9E, 0xDD, 0x26,
+    0x6E, 0x87, 0x7B, 0xC3, 0x1F, 0x7A, 0xCF, 0x64, 0xD8, 0x97, 0xE2, 0x76, 0xE5, 0xDC, 0xC8, 0xA0,
+    0x84, 0xDC, 0x3B, 0x76, 0x86, 0xBC, 0xB8, 0xB2, 0xA8, 0x27, 0xFF, 0x2B, 0x3C, 0x14, 0xF2, 0x8A,
+    0x1E, 0x67, 0xCA, 0x06, 0x1D, 0x7B, 0x3F, 0x13, 0xBC, 0xCE, 0x84, 0x61, 0x92, 0xF2, 0xD0, 0xD6,
+    0x03, 0xDF, 0xCF, 0xF3, 0x7F, 0x56, 0x3C, 0x5D, 0xD8, 0x12, 0x72, 0x86, 0xD1, 0x72, 0xBD, 0x67,
+    0x32, 0x6C, 0x39, 0x39, 0xE2, 0x78, 0x63, 0xEF, 0x59, 0x00, 0x42, 0x25, 0xC0, 0xC1, 0x90, 0xA7,
+    0x7A, 0x45, 0x93, 0x34, 0x78, 0xCB, 0x15, 0x8E, 0x94, 0x3D, 0xD1, 0x7B, 0xE6, 0x48, 0x95, 0x3D,
+    0x3E, 0x76, 0xF3, 0xEF, 0xB2, 0x6C, 0x58, 0x06, 0x5E, 0x3A, 0xF6, 0x45, 0xFF, 0x99, 0x95, 0xF5,
+    0x20, 0x0F, 0x9F, 0xB6, 0x9B, 0x54, 0x9D, 0x0A, 0x79, 0x41, 0x6C, 0xE5, 0xE4, 0x0E, 0xB1, 0x81,
+    0x78, 0x31, 0x04, 0xEF, 0xC0, 0x55, 0xD4, 0x93, 0x67, 0x47, 0x86, 0xCD, 0xDC, 0x8B, 0xBD, 0x67,
+    0x1E, 0x34, 0x30, 0x01, 0x26, 0x63, 0x99, 0x38, 0x88, 0xE3, 0x0C, 0x96, 0x83, 0xDB, 0x86, 0x3D,
+    0x7E, 0x17, 0x38, 0x61, 0xE4, 0x21, 0xC8, 0x64, 0x28, 0x62, 0x7F, 0xC8, 0xC3, 0x47, 0x25, 0x42,
+    0xF4, 0x01, 0x58, 0xB0, 0x28, 0x0A, 0x3E, 0x07, 0x43, 0x38, 0xEC, 0xE9, 0x1D, 0xFC, 0x86, 0x31,
+    0x89, 0xC9, 0xE8, 0x1B, 0x7C, 0xE2, 0xF9, 0x1E, 0xEE, 0x2C, 0x5B, 0x43, 0x56, 0x45, 0x8B, 0x08,
+    0x52, 0x23, 0x88, 0x3D, 0xF8, 0xC0, 0x53, 0xC1, 0xAD, 0x20, 0x6F, 0xC9, 0x92, 0x2C, 0x59, 0xE0,
+    0x5D, 0xF7, 0xE0, 0x41, 0xF8, 0xDC, 0x54, 0x82, 0x87, 0x4B, 0x8E, 0x84, 0xB2, 0x3A, 0x1A, 0x95,
+    0xD8, 0x09, 0xC0, 0x6B, 0xF4, 0x5C, 0x8F, 0x7F, 0x4D, 0xA4, 0xB7, 0xD7, 0x67, 0x8F, 0x2B, 0x81,
+    0xCF, 0xE1, 0x08, 0xA8, 0x0F, 0xAC, 0x0F, 0xB0, 0xD7, 0xCF, 0xB3, 0xA6, 0x68, 0xC4, 0x4E, 0x00,
+    0xF6, 0xFA, 0x53, 0x65, 0x5A, 0x80, 0xBD, 0xBE, 0x2A, 0xE6, 0x26, 0x15, 0xD1, 0x88, 0x9D, 0x00,
+    0xA9, 0x32, 0x03, 0xC1, 0xE7, 0x94, 0xAD, 0xA0, 0x84, 0x6A, 0x4D, 0x42, 0xD2, 0xF8, 0x04, 0x88,
+    0x7D, 0x2A, 0x27, 0x30, 0x15, 0x81, 0xE2, 0xA4, 0xCE, 0x4E, 0xA0, 0x2D, 0xC0, 0x38, 0x10, 0xFC,
+    0xA8, 0xC7, 0xDC, 0xA6, 0xD1, 0xEA, 0x04, 0xF0, 0x6D, 0x72, 0x9B, 0xD8, 0x44, 0xC7, 0x26, 0x89,
+    0x04, 0xC0, 0x61, 0x20, 0xFA, 0x72, 0x76, 0x31, 0xF8, 0x24, 0x95, 0x16, 0xA0, 0x93, 0xC1, 0xA9,
+    0x83, 0xD6, 0xF7, 0x01, 0x5C, 0xF6, 0xEC, 0xAE, 0xEE, 0xFD, 0x24, 0x99, 0x04, 0x18, 0xC2, 0xD9,
+    0x40, 0x27, 0x48, 0xAA, 0x05, 0x40, 0x12, 0x94, 0x9D, 0x32, 0x3D, 0xF0, 0x7D, 0x21, 0xF7, 0x7E,
+    0x26, 0xA9, 0x31, 0xFB, 0xD3, 0x18, 0xF0, 0xF7, 0xE8, 0xA5, 0x5D, 0x5F, 0x42, 0xEC, 0x55, 0x9C,
+    0xC6, 0xBD, 0x4B, 0xFF, 0xE1, 0x04, 0xEE, 0x80, 0x9C, 0xCD, 0x12, 0x8C, 0xB2, 0x01, 0x1B, 0x14,
+    0x94, 0x32, 0x9F, 0x37, 0xE8, 0xB3, 0x22, 0x71, 0x08, 0x94, 0x12, 0x98, 0xF7, 0x29, 0xE2, 0x35,
+    0x14, 0x95, 0x48, 0xB2, 0x59, 0x0D, 0x98, 0x04, 0x63, 0x26, 0x70, 0xD8, 0xA8, 0x39, 0xF0, 0xB5,
+    0xD0, 0x94, 0x43, 0x80, 0xD7, 0x72, 0x54, 0x08, 0xC4, 0x98, 0x3D, 0xC9, 0x35, 0xF8, 0xFC, 0xBE,
+    0x36, 0x06, 0x9F, 0x34, 0x22, 0x01, 0x66, 0xBE, 0xBE, 0x03, 0x07, 0x3D, 0xBC, 0xAE, 0x08, 0x2A,
+    0x13, 0x10, 0x04, 0xDC, 0x77, 0x22, 0xC7, 0xD4, 0xB6, 0x06, 0xDE, 0x10, 0x6A, 0xE5, 0x26, 0x21,
+    0x88, 0xDE, 0x23, 0x67, 0x0B, 0xE6, 0xCD, 0x1F, 0xC5, 0xFB, 0x16, 0x36, 0xE7, 0x78, 0xBE, 0x04,
+    0xFE, 0xF1, 0xEA, 0x33, 0x54, 0x39, 0x86, 0x17, 0xBD, 0x17, 0xAF, 0xE1, 0xCE, 0x51, 0xEA, 0x50,
+    0xD3, 0x40, 0xD8, 0xF2, 0xAD, 0xF0, 0xCD, 0xCA, 0x73, 0x79, 0x2F, 0x86, 0x91, 0x65, 0x3F, 0x7D,
+    0x9F, 0xB3, 0xB3, 0x38, 0xFF, 0xB0, 0x74, 0x02, 0x30, 0x70, 0xCE, 0xC7, 0x4E, 0x1F, 0x90, 0x04,
+    0x5C, 0x58, 0xB6, 0x08, 0xCE, 0xF8, 0x26, 0x41, 0x6E, 0xAF, 0x5E, 0x04, 0xEF, 0x9D, 0xF0, 0x5D,
+    0x09, 0xEF, 0xF5, 0x53, 0x10, 0x64, 0xA7, 0x79, 0x07, 0x48, 0x82, 0xDE, 0x3A, 0xFA, 0xAE, 0xE8,
+    0x14, 0x04, 0xDE, 0x77, 0x62, 0x83, 0x37, 0x6C, 0x19, 0xB2, 0x87, 0xCE, 0xF8, 0x24, 0xC1, 0x90,
+    0x02, 0xBC, 0x14, 0x82, 0xC3, 0x99, 0x3E, 0xDC, 0xF8, 0x31, 0x5A, 0x97, 0x7D, 0xF1, 0xF9, 0x4E,
+    0x73, 0x04, 0xF1, 0xFD, 0x9C, 0x9D, 0xD4, 0x3B, 0x1C, 0xBA, 0x6E, 0x88, 0xE9, 0x08, 0x7C, 0xAD,
+    0x93, 0x3B, 0xCA, 0x24, 0x01, 0x71, 0x49, 0x04, 0x4B, 0x02, 0x6C, 0x8B, 0xCF, 0xE0, 0xA5, 0xDC,
+    0x3D, 0x42, 0x25, 0x0B, 0x82, 0x33, 0x61, 0xB9, 0x10, 0x08, 0xFE, 0xA4, 0x6D, 0xD1, 0xF5, 0x00,
+    0x3E, 0x8C, 0xE2, 0x3B, 0x9C, 0x5A, 0x65, 0xB3, 0xF7, 0x13, 0xDB, 0xCA, 0x45, 0x6B, 0xEA, 0x5D,
+    0x28, 0x9B, 0x04, 0xA4, 0x28, 0x11, 0x8A, 0x82, 0x5A, 0xF6, 0x7D, 0x16, 0x66, 0x21, 0x38, 0xDF,
+    0x67, 0x8F, 0x45, 0x10, 0x94, 0x65, 0xF1, 0x0F, 0xEF, 0x2B, 0x54, 0x06, 0x2E, 0xD7, 0x1C, 0x7C,
+    0xC7, 0x87, 0xFD, 0xA7, 0x83, 0xC1, 0xF7, 0xF0, 0xD7, 0x54, 0x39, 0x51, 0xB7, 0x47, 0xD1, 0x0A,
+    0xCD, 0x42, 0xF0, 0x0B, 0x17, 0xBA, 0x0E, 0xAA, 0x24, 0x01, 0x91, 0x02, 0x5A, 0x36, 0x01, 0x0C,
+    0xBE, 0x89, 0x20, 0xED, 0xFD, 0x2E, 0x20, 0x58, 0xBC, 0x5C, 0x2C, 0x7F, 0xED, 0x20, 0xE1, 0x77,
+    0xF3, 0x10, 0x32, 0x1B, 0x9F, 0xEB, 0x3D, 0xDF, 0x32, 0xBF, 0xF7, 0x13, 0x71, 0x45, 0x10, 0xF8,
+    0x52, 0x0B, 0x1C, 0x03, 0x24, 0x00, 0xAF, 0x34, 0xE2, 0xEF, 0x00, 0x54, 0x86, 0xC1, 0x45, 0xF0,
+    0x0A, 0x8F, 0xBF, 0x2E, 0x09, 0x40, 0xF0, 0x39, 0xBC, 0xA8, 0xD5, 0xA5, 0x75, 0x5C, 0x0C, 0x81,
+    0x0A, 0x5A, 0x0D, 0xAD, 0x82, 0x35, 0x01, 0xCA, 0x06, 0x1F, 0x81, 0x5A, 0xD8, 0xB1, 0x70, 0xC1,
+    0xE7, 0x7B, 0xF0, 0xD9, 0xB5, 0x9D, 0x92, 0xB9, 0x26, 0x80, 0xC1, 0xA1, 0x35, 0x58, 0x0B, 0x09,
+    0xF0, 0x6E, 0xF6, 0x78, 0xA8, 0x20, 0xF8, 0x13, 0x4E, 0xB3, 0xC7, 0x2C, 0xBC, 0x6F, 0xF0, 0xCB,
+    0x06, 0x66, 0xC8, 0xC1, 0x9F, 0x89, 0x20, 0xF7, 0x5A, 0x14, 0xA9, 0x35, 0xF0, 0x4D, 0x00, 0xE2,
+    0x90, 0x04, 0xCE, 0x1D, 0xB4, 0x98, 0x8C, 0xDF, 0xFB, 0xC9, 0xC2, 0x3F, 0x78, 0x06, 0xC5, 0xB6,
+    0xC2, 0x36, 0x36, 0xC6, 0xF7, 0xBD, 0x9C, 0x3D, 0x5E, 0x48, 0x80, 0xCF, 0xB5, 0xB1, 0x22, 0x02,
+    0xCC, 0x5F, 0x14, 0x1F, 0x03, 0x02, 0xC8, 0x3B, 0x74, 0x9D, 0xDB, 0x7F, 0x36, 0x32, 0x1D, 0xAF,
+    0xF1, 0x3E, 0xE3, 0x71, 0x48, 0x02, 0xC3, 0x5C, 0x24, 0x03, 0x7F, 0xE0, 0xA2, 0x76, 0x8A, 0x12,
+    0xC0, 0xA9, 0xB7, 0x8F, 0x00, 0xF1, 0x46, 0x47, 0xEC, 0x94, 0x24, 0x87, 0x6D, 0xCF, 0xCE, 0x07,
+    0xB0, 0x4C, 0x2B, 0x40, 0x3C, 0x92, 0x80, 0x4C, 0x42, 0x22, 0x44, 0xB9, 0xEE, 0x00, 0x81, 0xCE,
+    0xF7, 0x9B, 0x36, 0xC0, 0xF7, 0xBC, 0x8E, 0xBF, 0x89, 0x2D, 0x69, 0x7E, 0x81, 0x0B, 0xCB, 0xB9,
+    0x35, 0xEC, 0x9D, 0xB1, 0x58, 0x14, 0x01, 0xB5, 0x26, 0xED, 0xF8, 0xE0, 0xD5, 0x94, 0x04, 0x79,
+    0x96, 0x44, 0xA0, 0x4A, 0xD7, 0x04, 0x10, 0xE0, 0xA2, 0x9A, 0x02, 0xAF, 0xDF, 0x14, 0x3B, 0xD2,
+    0x13, 0x16, 0x56, 0x3A, 0x14, 0x24, 0x1A, 0xFC, 0xCA, 0x43, 0xBD, 0x43, 0x48, 0x82, 0xF1, 0x98,
+    0xCF, 0xE1, 0x19, 0x87, 0xB9, 0x00, 0x37, 0x7F, 0x93, 0xCD, 0xCA, 0x88, 0x0B, 0x9A, 0x4F, 0x82,
+    0x21, 0x05, 0xDF, 0x34, 0x61, 0xDE, 0x2B, 0x59, 0x26, 0x68, 0x08, 0x98, 0x78, 0x4A, 0x57, 0x21,
+    0x01, 0x6A, 0x3B, 0x6B, 0xA9, 0xCA, 0x30, 0x82, 0xEB, 0xC2, 0xB9, 0xD8, 0xF8, 0xBC, 0x8B, 0xD6,
+    0x04, 0xB2, 0x60, 0xF1, 0x6A, 0xDD, 0x60, 0xBD, 0xEA, 0xA2, 0x3D, 0xB6, 0x01, 0xAD, 0x40, 0x54,
+    0x1A, 0xB9, 0x90, 0x65, 0x37, 0x7A, 0x59, 0x22, 0x25, 0x40, 0x12, 0x1D, 0x66, 0x36, 0x55, 0x9D,
+    0xC6, 0xB6, 0xA7, 0x96, 0xDD, 0x93, 0x91, 0x38, 0xD1, 0x47, 0x4D, 0x43, 0xD0, 0xE9, 0x04, 0x40,
+    0x70, 0x59, 0x19, 0x8B, 0x49, 0xE3, 0x0F, 0x03, 0x5D, 0x6F, 0x01, 0xA2, 0xD6, 0xE8, 0x43, 0xF6,
+    0x53, 0x62, 0xD1, 0xD9, 0x04, 0xC0, 0xDE, 0xEF, 0xBC, 0xEE, 0x65, 0x0F, 0x03, 0x29, 0xD0, 0xC9,
+    0x04, 0xC8, 0x9A, 0xFE, 0x24, 0x4E, 0xD3, 0x62, 0xD3, 0xC8, 0x04, 0xA8, 0x61, 0x8F, 0xAB, 0x6D,
+    0x78, 0xB6, 0xEE, 0x33, 0x1A, 0x5F, 0x42, 0x24, 0x00, 0x7F, 0xD4, 0x89, 0x77, 0xD4, 0x90, 0x6C,
+    0xDC, 0x8F, 0x24, 0x26, 0xD8, 0x9C, 0xF3, 0x87, 0xB5, 0xA4, 0x6D, 0xCB, 0xDB, 0xED, 0x56, 0x26,
+    0x44, 0x02, 0xF0, 0x33, 0x66, 0x0C, 0xB0, 0x51, 0x1B, 0x3B, 0xD1, 0x63, 0xB9, 0xB4, 0x5D, 0x69,
+    0x90, 0x5B, 0xEC, 0x77, 0xA2, 0x0F, 0x80, 0xC0, 0x2F, 0x9E, 0x68, 0xF0, 0xA3, 0xD3, 0xD8, 0x04,
+    0x08, 0x15, 0x30, 0x7C, 0x0E, 0xD7, 0x91, 0x4D, 0xA6, 0x22, 0xD0, 0xDA, 0x16, 0x00, 0x81, 0x9F,
+    0x96, 0x25, 0x91, 0xF6, 0xF6, 0x0B, 0x68, 0x74, 0x02, 0x94, 0x69, 0x05, 0xF0, 0x9E, 0xC9, 0xD9,
+    0xFB, 0x92, 0x28, 0xC5, 0x0E, 0x9B, 0xC6, 0xB7, 0x00, 0xAE, 0x49, 0xC0, 0xD7, 0x65, 0xAF, 0xF5,
+    0xBA, 0xAC, 0x2C, 0x36, 0xAE, 0xCB, 0x3F, 0x2C, 0x92, 0x38, 0x04, 0xE4, 0x37, 0xA2, 0x09, 0xF4,
+    0x78, 0xB3, 0xFF, 0x8E, 0x42, 0x85, 0x11, 0xC1, 0x46, 0x07, 0x9F, 0x24, 0xD3, 0x07, 0xA8, 0x23,
+    0xD0, 0xA1, 0x48, 0x69, 0x59, 0x5B, 0xDB, 0x09, 0x0C, 0x09, 0x82, 0xB9, 0x53, 0xF6, 0x70, 0x20,
+    0x26, 0xE8, 0xA9, 0x04, 0x3E, 0x24, 0x7B, 0x42, 0x36, 0x91, 0x92, 0x73, 0xA0, 0x52, 0x0D, 0x4E,
+    0x51, 0x97, 0xB6, 0xED, 0x89, 0xB0, 0x32, 0xDA, 0x02, 0x74, 0x1C, 0x4D, 0x80, 0x8E, 0xA3, 0x09,
+    0xD0, 0x71, 0x34, 0x01, 0x3A, 0x4E, 0x88, 0x1E, 0x2B, 0x3B, 0x81, 0xF7, 0xF5, 0x1F, 0x4E, 0x80,
+    0xBF, 0x0A, 0xDE, 0x98, 0x4B, 0xA3, 0x13, 0xE5, 0x28, 0x28, 0xDD, 0x28, 0xF2, 0x24, 0x78, 0x79,
+    0xFF, 0xE1, 0x70, 0x29, 0x3A, 0x0B, 0x50, 0xE3, 0xA9, 0x67, 0x01, 0x4A, 0x75, 0x34, 0x01, 0x3A,
+    0x8E, 0x26, 0x40, 0xC7, 0xD1, 0x04, 0xE8, 0x38, 0x21, 0xCE, 0x02, 0xB6, 0x83, 0x57, 0xF4, 0x1F,
+    0x2A, 0x35, 0x72, 0x21, 0xE4, 0x59, 0x96, 0xA2, 0x28, 0x8A, 0xA2, 0x28, 0x8A, 0xA2, 0x28, 0x8A,
+    0xA2, 0x28, 0x8A, 0xA2, 0x28, 0x8A, 0xA2, 0x28, 0x8A, 0xA2, 0x28, 0x8A, 0xA2, 0x8C, 0x65, 0x64,
+    0xE4, 0x7F, 0xB8, 0x16, 0x30, 0x41, 0x9E, 0xCA, 0xD5, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+// Settings.svg: 3119 bytes, 1546 bytes gzipped
+static const char Settings_svg_Path[] PROGMEM = "/Settings.svg";
+static const char Settings_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Settings_svg_ETag[] PROGMEM = "\"d3fcd6b67580bb45\"";
+static const uint8_t Settings_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x56, 0xDB, 0x6E, 0xDB, 0x46,
+    0x10, 0x7D, 0xB6, 0xBF, 0x82, 0x65, 0x5F, 0x97, 0xD4, 0xDE, 0x2F, 0x81, 0xE5, 0x00, 0x71, 0xDA,
+    0xA4, 0x40, 0xD2, 0x06, 0x75, 0xE2, 0xA2, 0x4F, 0x85, 0x42, 0x2B, 0x96, 0x10, 0x46, 0x12, 0x24,
+    0x45, 0x76, 0xF3, 0xF5, 0x3D, 0x67, 0x48, 0xF9, 0x92, 0x26, 0x8E, 0xE9, 0x59, 0xEE, 0x70, 0x2E,
+    0x67, 0xCE, 0xCC, 0xEE, 0xD9, 0xF3, 0xBB, 0x2F, 0x7D, 0x75, 0x98, 0x6F, 0x77, 0xCB, 0xF5, 0x6A,
+    0x5A, 0x9B, 0x56, 0xD7, 0xD5, 0x7C, 0xD5, 0xAD, 0xAF, 0x97, 0xAB, 0x9B, 0x69, 0xFD, 0x75, 0xFF,
+    0xA9, 0xC9, 0xF5, 0xF3, 0xF3, 0xD3, 0xD3, 0xB3, 0x9F, 0x5E, 0xFE, 0x71, 0xF1, 0xFE, 0xEF, 0x77,
+    0xBF, 0x54, 0xBB, 0xC3, 0x4D, 0xF5, 0xEE, 0xC3, 0x8B, 0x37, 0xBF, 0x5D, 0x54, 0x75, 0x33, 0x99,
+    0xFC, 0xE5, 0x2E, 0x26, 0x93, 0x97, 0xEF, 0x5F, 0x56, 0x97, 0x57, 0xAF, 0x2A, 0xD3, 0x9A, 0xC9,
+    0xE4, 0x97, 0xDF, 0xEB, 0xAA, 0x5E, 0xEC, 0xF7, 0x9B, 0x67, 0x93, 0xC9, 0xED, 0xED, 0x6D, 0x7B,
+    0xEB, 0xDA, 0xF5, 0xF6, 0x66, 0xF2, 0x6A, 0x3B, 0xDB, 0x2C, 0x96, 0xDD, 0x6E, 0x02, 0xC5, 0x09,
+    0x15, 0xF1, 0xD1, 0x04, 0xC6, 0x8C, 0x69, 0xAF, 0xF7, 0xD7, 0xF5, 0x39, 0x5C, 0x34, 0x4D, 0xF5,
+    0x61, 0xD3, 0xAF, 0x67, 0xD7, 0xF3, 0xEB, 0x6A, 0xBF, 0x7E, 0x26, 0x26, 0xFF, 0x9C, 0x6F, 0xD6,
+    0xAA, 0xA2, 0x1D, 0xE8, 0x6E, 0xB1, 0x68, 0xBB, 0xF5, 0x17, 0x55, 0xBD, 0x9A, 0xAF, 0xE6, 0xDB,
+    0xD9, 0x7E, 0xBD, 0x7D, 0xD0, 0xAA, 0xDE, 0x2E, 0xEF, 0xE6, 0xDB, 0xEA, 0xFD, 0x7A, 0xDD, 0xEF,
+    0xAA, 0xA6, 0x81, 0x41, 0x86, 0xFA, 0x69, 0xD9, 0xF7, 0xD3, 0xFA, 0xE7, 0x5F, 0xE5, 0x5F, 0xFD,
+    0x38, 0x53, 0x53, 0x57, 0xCB, 0xEB, 0x69, 0xFD, 0x66, 0xF6, 0xEF, 0x7C, 0xFB, 0x0F, 0x16, 0x00,
+    0x62, 0xB5, 0x9B, 0xFE, 0x20, 0x72, 0xAB, 0xB5, 0x66, 0xA4, 0xA3, 0xCA, 0xB3, 0xBB, 0x7E, 0xB9,
+    0xFA, 0xFC, 0x23, 0x45, 0x53, 0x4A, 0x99, 0xC8, 0x6E, 0x5D, 0x9D, 0x9E, 0x54, 0xB7, 0xCB, 0xEB,
+    0xFD, 0x62, 0x5A, 0x67, 0xAD, 0x37, 0x77, 0x75, 0xB5, 0x98, 0x2F, 0x6F, 0x16, 0xFB, 0xFB, 0xE5,
+    0x61, 0x39, 0xBF, 0x7D, 0xB1, 0xBE, 0x9B, 0xD6, 0xBA, 0xD2, 0x55, 0xE2, 0x7F, 0x02, 0x3F, 0xFB,
+    0xD8, 0xCF, 0x9B, 0x8F, 0xB3, 0xEE, 0xF3, 0xCD, 0x76, 0xFD, 0x75, 0x85, 0xE8, 0x56, 0xF3, 0xDB,
+    0xEA, 0x91, 0x06, 0x02, 0x78, 0xB6, 0xDB, 0xCC, 0xBA, 0xF9, 0xB4, 0xDE, 0x6C, 0xE7, 0xBB, 0xF9,
+    0xF6, 0x30, 0x27, 0x72, 0x37, 0xE7, 0xA7, 0x27, 0x67, 0x9B, 0xD9, 0x7E, 0x51, 0xE1, 0x93, 0xB7,
+    0x2E, 0xB4, 0x2E, 0x26, 0x65, 0x63, 0xEB, 0x6D, 0xEE, 0x1A, 0xDF, 0xC6, 0x9C, 0x94, 0x6E, 0x72,
+    0x1B, 0x94, 0x6B, 0xB3, 0x71, 0x22, 0xE1, 0x77, 0x27, 0x2B, 0x35, 0xAE, 0xE4, 0x0D, 0x7E, 0x9B,
+    0xFB, 0xB7, 0xD4, 0xBB, 0xF4, 0xBA, 0xD5, 0xC1, 0x8F, 0xC6, 0xD4, 0x13, 0xD3, 0xDF, 0x4E, 0x4F,
+    0x4E, 0xAA, 0xA3, 0x37, 0x6F, 0x06, 0x6F, 0xAE, 0x0D, 0x05, 0xCE, 0x22, 0x3E, 0xB7, 0x6D, 0x31,
+    0x22, 0xE0, 0x77, 0x77, 0x5C, 0xA8, 0xE3, 0x0B, 0xCA, 0x7C, 0xA9, 0xC6, 0x97, 0x97, 0x2E, 0xB7,
+    0x25, 0x1C, 0x0D, 0xA9, 0x27, 0x66, 0xBF, 0xD5, 0x93, 0x27, 0x19, 0x7A, 0x87, 0x0F, 0x11, 0x86,
+    0x69, 0x4B, 0x81, 0x4F, 0xDD, 0xFA, 0x68, 0xF0, 0x74, 0x3A, 0x36, 0x60, 0x70, 0xB6, 0x90, 0x4D,
+    0x86, 0xE8, 0x72, 0x54, 0xBA, 0xB5, 0xD9, 0x76, 0xB2, 0x1B, 0x14, 0x35, 0xB9, 0x99, 0x8A, 0xA2,
+    0xE2, 0xB0, 0xA9, 0x44, 0x11, 0xC9, 0x74, 0xAE, 0xC5, 0x86, 0x6D, 0x83, 0x61, 0x54, 0x4C, 0x3B,
+    0xB6, 0xC9, 0x1E, 0x65, 0x10, 0xD5, 0x46, 0xDB, 0x69, 0x7C, 0x14, 0x82, 0xA3, 0x29, 0x9F, 0x94,
+    0xE1, 0xCF, 0x8E, 0xCE, 0x65, 0xD5, 0x98, 0x8B, 0xA0, 0xDB, 0x4C, 0x88, 0x4A, 0x9B, 0x8C, 0x57,
+    0x3E, 0xB7, 0x16, 0x0B, 0xDF, 0xE6, 0x6C, 0xD4, 0x93, 0xB0, 0xBF, 0xCF, 0xE9, 0x08, 0xED, 0x80,
+    0xA3, 0x6E, 0x8B, 0x57, 0x1A, 0x91, 0x65, 0x06, 0xA9, 0x4B, 0x46, 0x58, 0xA9, 0x04, 0x09, 0xB8,
+    0x60, 0x57, 0xC7, 0xC2, 0xF7, 0x86, 0x6F, 0x8C, 0x13, 0x1D, 0x04, 0x8A, 0x5D, 0x1D, 0x07, 0xB9,
+    0x63, 0xAA, 0x88, 0x12, 0xAB, 0x9C, 0x0A, 0xD3, 0xB7, 0x8C, 0xB9, 0xA4, 0x0C, 0x19, 0x96, 0x98,
+    0x2E, 0x3E, 0x05, 0x1B, 0x90, 0x8E, 0xC7, 0xC3, 0x3A, 0x4B, 0xF0, 0x12, 0xB7, 0x93, 0x83, 0x68,
+    0xB2, 0xEF, 0xF8, 0xC6, 0xF3, 0x6B, 0x6B, 0x0D, 0xEA, 0x69, 0x2C, 0xB7, 0x1D, 0x34, 0x1D, 0x3C,
+    0x85, 0x41, 0x26, 0xB6, 0x02, 0x48, 0x63, 0x06, 0x50, 0xF0, 0xD7, 0x5C, 0x3A, 0xA4, 0x8C, 0xFC,
+    0xED, 0x93, 0x6A, 0xDA, 0x1F, 0x56, 0x33, 0xFA, 0xD6, 0x1A, 0xE0, 0x9E, 0xDA, 0x90, 0xDD, 0x02,
+    0xE4, 0xB0, 0x31, 0x0E, 0x45, 0x45, 0x0D, 0x19, 0x08, 0x3C, 0x87, 0xC0, 0xD2, 0x66, 0x94, 0xD6,
+    0xB7, 0x5A, 0x9B, 0xDE, 0xC2, 0x90, 0x67, 0x44, 0xC1, 0x74, 0xA6, 0x0D, 0x91, 0x01, 0xE3, 0xA9,
+    0x06, 0x19, 0x38, 0x07, 0xC1, 0x44, 0x9B, 0x26, 0xB4, 0xC1, 0x9A, 0x9E, 0xAC, 0x2E, 0x91, 0x4F,
+    0x9B, 0x98, 0x3A, 0xB3, 0x0C, 0xC3, 0xC3, 0xB4, 0x89, 0x8E, 0x00, 0x63, 0x81, 0xC1, 0x6C, 0xCB,
+    0x20, 0xEF, 0xB0, 0xD0, 0x89, 0x28, 0xFB, 0xE3, 0x86, 0x22, 0x28, 0xA5, 0xC7, 0x22, 0xB2, 0x8C,
+    0xD8, 0x10, 0x84, 0xBC, 0x17, 0x4B, 0x99, 0x7E, 0x93, 0x27, 0x8A, 0x1E, 0xD8, 0xF8, 0x51, 0xCE,
+    0xC9, 0x5F, 0x25, 0xA6, 0x2D, 0x88, 0xE3, 0x5B, 0xAB, 0x8B, 0xA8, 0x18, 0xA8, 0x64, 0xCF, 0x7E,
+    0x8B, 0xA3, 0xC8, 0xDC, 0x83, 0x06, 0xA1, 0x45, 0x09, 0x80, 0x3A, 0x66, 0x0C, 0xAF, 0xD1, 0xC5,
+    0x51, 0x76, 0xD4, 0x3B, 0x8C, 0x10, 0x59, 0xE1, 0x33, 0x83, 0x8B, 0x41, 0x82, 0x83, 0x19, 0xA3,
+    0xBD, 0xB0, 0xC6, 0xF5, 0x62, 0x85, 0x5D, 0xE8, 0x6D, 0xFC, 0x5F, 0xCA, 0x31, 0x24, 0xA6, 0x99,
+    0x2C, 0xF6, 0x93, 0xF4, 0x0A, 0x64, 0x29, 0x77, 0x44, 0x15, 0x99, 0xBA, 0xD0, 0xC5, 0x5B, 0x51,
+    0x48, 0xB4, 0x09, 0x05, 0x81, 0x31, 0x66, 0x25, 0x60, 0x76, 0x4F, 0x20, 0xC7, 0xD3, 0x67, 0x85,
+    0xE2, 0x08, 0x49, 0x49, 0xCC, 0x40, 0x27, 0x70, 0xCC, 0x5A, 0x39, 0xC3, 0xA0, 0x92, 0xF4, 0x6A,
+    0x92, 0x94, 0x08, 0x1A, 0x51, 0x48, 0x30, 0xC6, 0x32, 0x71, 0x3B, 0x28, 0x29, 0xEE, 0xEB, 0x48,
+    0x3E, 0x3C, 0x46, 0x01, 0xF9, 0xAB, 0xA1, 0xFA, 0x83, 0x4C, 0x37, 0xE6, 0x40, 0xB0, 0x12, 0xFA,
+    0x71, 0xD0, 0x63, 0x9E, 0x34, 0xE6, 0xB5, 0xC5, 0x3E, 0xB5, 0x44, 0x46, 0x00, 0x8B, 0x00, 0xB8,
+    0x82, 0x34, 0x44, 0x61, 0xBB, 0x02, 0x23, 0x33, 0x2A, 0x0A, 0x52, 0x8A, 0xE0, 0xC7, 0x5E, 0x90,
+    0xF2, 0x6C, 0xFF, 0xE4, 0x1F, 0xE7, 0x66, 0x46, 0x19, 0xD8, 0x46, 0xB6, 0x02, 0x22, 0x44, 0x6E,
+    0xC9, 0x99, 0x5E, 0x60, 0x80, 0xA5, 0xE2, 0xDC, 0xD0, 0x4E, 0x89, 0xB9, 0xE3, 0x21, 0x94, 0xA2,
+    0xA3, 0x62, 0xD5, 0x3D, 0x73, 0x8A, 0xDD, 0x09, 0xA3, 0xC8, 0x6C, 0x76, 0xC6, 0x91, 0x6A, 0xD1,
+    0xF7, 0x18, 0x08, 0xD9, 0x8B, 0xFF, 0x4E, 0x90, 0x51, 0x42, 0x27, 0xA8, 0x0C, 0xD5, 0xF4, 0x86,
+    0xC8, 0x1E, 0x2B, 0x9B, 0x0E, 0xCC, 0x47, 0x4A, 0xFA, 0x90, 0x7B, 0x4C, 0x0E, 0x81, 0x98, 0x40,
+    0x08, 0x07, 0x9E, 0x40, 0x46, 0xE2, 0xA4, 0xD3, 0x88, 0xA3, 0x12, 0xA2, 0x71, 0xB0, 0xC4, 0x41,
+    0x14, 0x9D, 0x43, 0x23, 0xD6, 0x3A, 0x19, 0x61, 0xC0, 0x07, 0x8D, 0x5D, 0x84, 0x1A, 0xEA, 0x9E,
+    0xC0, 0xE0, 0x12, 0x40, 0xB1, 0xEA, 0x9E, 0x49, 0x8F, 0x13, 0xCD, 0xE8, 0x04, 0xE1, 0x06, 0x13,
+    0x92, 0xB1, 0x4A, 0x22, 0x8D, 0x3C, 0x92, 0x0C, 0xC4, 0xB2, 0x95, 0xFD, 0x60, 0x07, 0xA2, 0x01,
+    0xB9, 0x82, 0x2E, 0x18, 0x68, 0x44, 0x74, 0xED, 0x23, 0xBC, 0x63, 0x73, 0xCF, 0x22, 0xED, 0x1B,
+    0xB2, 0x88, 0x4E, 0xA5, 0x3C, 0x86, 0x5C, 0x4F, 0xD6, 0x77, 0xC2, 0x22, 0x69, 0x3D, 0x27, 0xF8,
+    0x48, 0x7B, 0xF8, 0x81, 0x24, 0x41, 0x9A, 0x29, 0x8E, 0x55, 0x7F, 0x48, 0xDE, 0x45, 0x4F, 0xEF,
+    0xC5, 0x8D, 0xB2, 0x30, 0x80, 0xE9, 0x83, 0x45, 0x70, 0x70, 0x11, 0x23, 0xE7, 0x8F, 0x72, 0xC4,
+    0x01, 0x27, 0xD2, 0x70, 0xE0, 0x0D, 0x43, 0x49, 0x3D, 0x19, 0x51, 0xDF, 0xAA, 0xB7, 0xD1, 0x0E,
+    0xBA, 0xE3, 0xC8, 0x4A, 0x70, 0x68, 0x64, 0x64, 0xA1, 0x00, 0xEC, 0x85, 0xC4, 0x43, 0x23, 0x26,
+    0x3A, 0x49, 0x90, 0x0B, 0x5C, 0xF9, 0x1E, 0xAC, 0x2C, 0x52, 0x1F, 0xEF, 0xC7, 0x79, 0x44, 0xEE,
+    0x24, 0x2B, 0xD9, 0xE1, 0x75, 0xE1, 0x51, 0x1D, 0x0D, 0x89, 0x9F, 0x1C, 0xF1, 0xD2, 0xC0, 0x05,
+    0xBD, 0x50, 0x58, 0x15, 0x87, 0x21, 0x5D, 0x46, 0x39, 0x9B, 0x43, 0x02, 0xC3, 0x2D, 0xE6, 0xC5,
+    0xA1, 0x11, 0x09, 0xE7, 0xEE, 0xE0, 0x1D, 0xE9, 0x94, 0x21, 0x00, 0x9C, 0xDE, 0x51, 0x46, 0x21,
+    0x02, 0xA0, 0x79, 0x2F, 0xED, 0x15, 0x4B, 0x7A, 0x63, 0xE8, 0x46, 0x05, 0x92, 0x8E, 0xAE, 0x3D,
+    0x27, 0x82, 0xC7, 0x91, 0xE4, 0xE8, 0x19, 0x75, 0x13, 0xFF, 0x9C, 0xF0, 0x11, 0xDE, 0x11, 0x38,
+    0x6D, 0x98, 0xD0, 0x48, 0x12, 0xAF, 0x05, 0xA4, 0x43, 0x13, 0x17, 0x05, 0x87, 0x87, 0xED, 0x06,
+    0xA7, 0x2C, 0x42, 0xE2, 0xA8, 0xCD, 0xD2, 0x82, 0x49, 0xBC, 0x87, 0x48, 0xB7, 0x48, 0x99, 0xCE,
+    0xAD, 0xED, 0x8F, 0x13, 0x38, 0xC5, 0xC1, 0xAB, 0xC5, 0x99, 0x0A, 0xDF, 0x31, 0x75, 0x92, 0xAF,
+    0xF8, 0xB6, 0x9C, 0x1A, 0x12, 0xB5, 0xF5, 0x45, 0xDD, 0x67, 0xA0, 0xFD, 0x95, 0xF8, 0x5D, 0xC4,
+    0x43, 0xC1, 0x41, 0x66, 0x3A, 0x99, 0x4D, 0x41, 0xEE, 0x0D, 0x31, 0x8A, 0x73, 0x75, 0x04, 0x87,
+    0xE9, 0xC2, 0x6C, 0xB1, 0xE2, 0x3C, 0x91, 0x6A, 0x3E, 0x0C, 0x13, 0x6B, 0x04, 0x9A, 0xBD, 0x82,
+    0x76, 0xF2, 0xEC, 0x0C, 0xD2, 0x74, 0x80, 0x1B, 0x10, 0x7B, 0x36, 0x76, 0x60, 0x55, 0x12, 0x6A,
+    0xC3, 0x0C, 0x16, 0x52, 0xD9, 0xAB, 0xA1, 0xCE, 0xDF, 0x9F, 0x5B, 0x36, 0x23, 0x2F, 0xF4, 0x09,
+    0x42, 0xC6, 0x99, 0xCC, 0x38, 0x49, 0x4F, 0x5C, 0x1E, 0x1A, 0xB9, 0x30, 0x34, 0x72, 0x79, 0x18,
+    0xE5, 0xE3, 0xE5, 0x61, 0x38, 0x2B, 0x9B, 0xF1, 0x9C, 0xE4, 0xCF, 0xEE, 0xF1, 0xB1, 0x89, 0x8E,
+    0x06, 0x6D, 0x65, 0x3A, 0x04, 0x9C, 0xF9, 0x06, 0x3D, 0x80, 0x6B, 0x45, 0xC4, 0x71, 0xA6, 0x0C,
+    0x2E, 0x4B, 0xE3, 0x98, 0x41, 0xCB, 0xF1, 0xE8, 0xE6, 0xF8, 0x77, 0x6C, 0x33, 0xCC, 0x90, 0x28,
+    0xB7, 0x92, 0x51, 0xEE, 0x78, 0xDA, 0x7B, 0x39, 0xFB, 0xA3, 0xA7, 0x33, 0x13, 0xF8, 0x45, 0x76,
+    0x41, 0x1C, 0xE7, 0x0B, 0x5C, 0x4E, 0x34, 0x6E, 0x3F, 0x1E, 0x1C, 0xC5, 0xA0, 0x46, 0x1E, 0x1C,
+    0x19, 0xC8, 0xA3, 0x14, 0x59, 0x3D, 0x64, 0x25, 0x29, 0x9F, 0x4D, 0x6E, 0xF8, 0xC0, 0x0D, 0xF8,
+    0xFC, 0x3F, 0x3D, 0x3D, 0xE7, 0xA3, 0x2F, 0x0C, 0x00, 0x00,
+};
+
+// Upload.svg: 1184 bytes, 605 bytes gzipped
+static const char Upload_svg_Path[] PROGMEM = "/Upload.svg";
+static const char Upload_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Upload_svg_ETag[] PROGMEM = "\"b159a9612bc4888c\"";
+static const uint8_t Upload_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5D, 0x53, 0xCB, 0x6E, 0xDB, 0x30,
+    0x10, 0xBC, 0xF7, 0x2B, 0xB6, 0xEC, 0x35, 0xA6, 0xB9, 0x24, 0xC5, 0x47, 0x10, 0x25, 0x40, 0x05,
+    0xB4, 0x3E, 0x38, 0x97, 0x3E, 0x7C, 0xC8, 0x2D, 0x88, 0x14, 0x5B, 0x80, 0x62, 0x19, 0xB2, 0x62,
+    0xFB, 0xF3, 0xBB, 0x4B, 0xEB, 0x61, 0xD4, 0x30, 0xC8, 0x1D, 0x6A, 0x76, 0x67, 0x76, 0x45, 0x3D,
+    0x3C, 0x5D, 0x3E, 0x1A, 0x38, 0x55, 0xDD, 0xB1, 0x6E, 0xF7, 0xB9, 0x40, 0xA9, 0x04, 0x54, 0xFB,
+    0xB7, 0xB6, 0xAC, 0xF7, 0xDB, 0x5C, 0x7C, 0xF6, 0xEF, 0x8B, 0x20, 0x9E, 0x1E, 0x1F, 0xBE, 0x2E,
+    0x16, 0xF0, 0xF7, 0xD0, 0xB4, 0xAF, 0x65, 0x55, 0x42, 0xDF, 0xDE, 0xC3, 0xEF, 0xCD, 0x4F, 0xF8,
+    0x55, 0x1D, 0xDA, 0x3B, 0x38, 0x9F, 0xCF, 0xF2, 0x78, 0xDA, 0x76, 0x04, 0xE4, 0x5B, 0xFB, 0x71,
+    0x07, 0x3F, 0xAB, 0x7D, 0xD5, 0xBD, 0xF6, 0x6D, 0x37, 0xB3, 0xE0, 0xB9, 0xBE, 0x54, 0x1D, 0xFC,
+    0x69, 0xDB, 0xE6, 0x08, 0x8B, 0xC5, 0xE3, 0x97, 0x07, 0xCA, 0x80, 0x73, 0x5D, 0xF6, 0xBB, 0x5C,
+    0x04, 0xA5, 0x0E, 0x17, 0x01, 0xBB, 0xAA, 0xDE, 0xEE, 0xFA, 0x09, 0x9E, 0xEA, 0xEA, 0xFC, 0xBD,
+    0xBD, 0xE4, 0x42, 0x81, 0x02, 0x6D, 0xE9, 0x2F, 0xE0, 0xBD, 0x6E, 0x9A, 0x5C, 0x7C, 0xFB, 0x91,
+    0x7E, 0x02, 0xC8, 0xF9, 0xFE, 0x98, 0x8B, 0x5D, 0xDF, 0x1F, 0xEE, 0x97, 0x4B, 0xF6, 0x71, 0x36,
+    0xB2, 0xED, 0xB6, 0x4B, 0xAD, 0x94, 0x5A, 0x92, 0x82, 0x20, 0xA1, 0xC3, 0x6B, 0xBF, 0x4B, 0x89,
+    0x8B, 0xEE, 0xB3, 0xA9, 0x72, 0x51, 0x9D, 0xAA, 0x7D, 0x5B, 0x96, 0x02, 0xDE, 0x9A, 0xFA, 0xF0,
+    0xFF, 0x59, 0x99, 0x8B, 0xE7, 0x00, 0xA8, 0x8A, 0x00, 0x5E, 0xFA, 0xA8, 0x82, 0x83, 0x38, 0xEC,
+    0x0E, 0x50, 0x83, 0x2B, 0xD0, 0x4A, 0xAD, 0x22, 0x32, 0x74, 0x13, 0x87, 0x42, 0x54, 0x1B, 0xC4,
+    0x15, 0xFA, 0x02, 0x83, 0x8C, 0xC6, 0x00, 0x22, 0x68, 0x25, 0x33, 0x4A, 0x92, 0x99, 0xF3, 0x43,
+    0x6C, 0x65, 0x56, 0x5C, 0x23, 0x27, 0x2D, 0x93, 0x06, 0x2E, 0x49, 0x7A, 0x5A, 0x57, 0x48, 0xF5,
+    0x33, 0x69, 0xAD, 0xF7, 0xE9, 0x2C, 0x63, 0xC2, 0x15, 0x51, 0x18, 0x8B, 0xB4, 0xCA, 0x2C, 0xD3,
+    0x94, 0x32, 0xD0, 0xB4, 0x62, 0x71, 0xAD, 0x58, 0x99, 0x2A, 0x2B, 0xE3, 0x19, 0x81, 0xD6, 0x2C,
+    0xE2, 0x65, 0x96, 0xB0, 0x9E, 0xB4, 0x53, 0x84, 0xD2, 0xFB, 0x68, 0x92, 0x25, 0x6D, 0x33, 0x6A,
+    0x30, 0xC3, 0x18, 0x3D, 0xD3, 0xA3, 0x8E, 0xDC, 0xB0, 0xF2, 0x41, 0xDB, 0x82, 0xB0, 0x0D, 0x8E,
+    0x7A, 0xA6, 0x86, 0x35, 0x26, 0x49, 0x1A, 0xAB, 0x01, 0xCB, 0x83, 0xB0, 0x05, 0x59, 0xA7, 0x2C,
+    0x4B, 0xD0, 0x51, 0x01, 0x13, 0x70, 0x22, 0x3A, 0x2A, 0xA0, 0xCC, 0x5C, 0xC8, 0x48, 0xEB, 0xB3,
+    0x0C, 0x67, 0xA1, 0x1B, 0x13, 0x38, 0x5A, 0xC3, 0x1B, 0xC3, 0x46, 0x46, 0xA7, 0x2D, 0x3B, 0x04,
+    0xEE, 0x70, 0x15, 0x48, 0x8C, 0xBA, 0xD6, 0x81, 0x4F, 0xE2, 0x34, 0x03, 0x8E, 0x8A, 0x38, 0xCD,
+    0x68, 0xE4, 0xD0, 0xE4, 0x78, 0x59, 0xF9, 0x82, 0x0C, 0xBB, 0x34, 0x49, 0x33, 0x8F, 0xDC, 0x8C,
+    0x82, 0x66, 0x7E, 0x39, 0x03, 0x0F, 0x81, 0x97, 0x55, 0xD8, 0xA0, 0x7A, 0x79, 0xA6, 0x6E, 0xBD,
+    0xF2, 0x08, 0x68, 0xA4, 0xA6, 0xB1, 0xAC, 0x89, 0x7A, 0xC5, 0x2A, 0xE1, 0x82, 0xB0, 0x41, 0xC7,
+    0x4D, 0x46, 0xA5, 0x0D, 0x27, 0x4A, 0x17, 0x8C, 0xBD, 0xC5, 0xCC, 0x1B, 0xF9, 0xEB, 0xC0, 0x5B,
+    0x88, 0x63, 0xBD, 0xC2, 0x8F, 0x3C, 0x73, 0xCD, 0x9B, 0xB0, 0xBD, 0xD6, 0x9D, 0xF8, 0x36, 0xE9,
+    0xD2, 0x04, 0x98, 0xA6, 0xD3, 0x5B, 0x88, 0x9E, 0x75, 0x89, 0x96, 0x85, 0x1B, 0xCC, 0x34, 0x1C,
+    0xF9, 0x6B, 0x4C, 0xD6, 0x2D, 0x5A, 0xBD, 0xE1, 0x9B, 0x83, 0xF3, 0xCD, 0xC1, 0xF9, 0xE6, 0x68,
+    0x5A, 0xB9, 0x93, 0xF4, 0x80, 0x0F, 0xCC, 0x4C, 0xE3, 0x70, 0x33, 0x94, 0x58, 0xF3, 0xAD, 0x4F,
+    0xDD, 0x0C, 0x6E, 0x68, 0x4F, 0xAE, 0x47, 0x75, 0xDA, 0x93, 0xEB, 0x1B, 0x7C, 0x9D, 0xD6, 0xC8,
+    0x77, 0xC3, 0xF9, 0xD0, 0xDD, 0x84, 0xCD, 0x54, 0xE7, 0x76, 0xDA, 0x2F, 0x62, 0x49, 0x5F, 0x2E,
+    0x7F, 0xC1, 0x8F, 0xFF, 0x00, 0xAD, 0x8D, 0x35, 0x6E, 0xA0, 0x04, 0x00, 0x00,
+};
+
+// styles.css: 3207 bytes, 968 bytes gzipped
+static const char styles_css_Path[] PROGMEM = "/styles.css";
+static const char styles_css_ContentType[] PROGMEM = "text/css";
+static const char styles_css_ETag[] PROGMEM = "\"717e8b76de3bcffd\"";
+static const uint8_t styles_css_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x57, 0xC1, 0x8E, 0xDB, 0x38,
+    0x0C, 0x3D, 0x4F, 0xBE, 0x42, 0x97, 0x05, 0xDA, 0x62, 0xED, 0x26, 0x5D, 0x0C, 0x50, 0x64, 0x2E,
+    0xC5, 0x02, 0xDB, 0x16, 0x8B, 0x2E, 0xB0, 0x40, 0xBF, 0x80, 0xB6, 0x18, 0x5B, 0xA8, 0x2C, 0xB9,
+    0xB2, 0x3C, 0x49, 0xBA, 0x98, 0x7F, 0x5F, 0xCA, 0x92, 0x6C, 0x39, 0x8E, 0x33, 0x83, 0x99, 0x93,
+    0x43, 0x93, 0x4F, 0xE4, 0xE3, 0x23, 0xE5, 0xA9, 0x6D, 0x23, 0xD9, 0xE6, 0xBF, 0x0D, 0xA3, 0xBF,
+    0x52, 0x4B, 0x6D, 0xF6, 0xAC, 0x90, 0x50, 0xFE, 0x78, 0x18, 0x2C, 0x05, 0x3D, 0x55, 0x46, 0xF7,
+    0x8A, 0x67, 0xE1, 0xA5, 0x14, 0x55, 0x6D, 0x0B, 0xD9, 0xA3, 0x77, 0x38, 0x68, 0x65, 0xB3, 0x03,
+    0x34, 0x42, 0x9E, 0xF7, 0xAC, 0x03, 0xD5, 0x65, 0x1D, 0x1A, 0x71, 0x78, 0xD8, 0x3C, 0x6D, 0x36,
+    0x35, 0x02, 0x47, 0x13, 0xC1, 0x07, 0xCF, 0x4E, 0xFC, 0xC2, 0x3D, 0xFB, 0x80, 0x4D, 0x12, 0x7D,
+    0x44, 0x07, 0x49, 0xC7, 0x6A, 0xC9, 0xD7, 0x4E, 0xE5, 0x60, 0xC8, 0x82, 0xA8, 0x1E, 0xD2, 0x44,
+    0x8F, 0xB5, 0xB0, 0x21, 0x8F, 0x16, 0x38, 0x17, 0xAA, 0xDA, 0xB3, 0x6D, 0xFE, 0xE1, 0x3E, 0xC2,
+    0x37, 0x60, 0x2A, 0xA1, 0xB2, 0x42, 0x5B, 0xAB, 0x1B, 0xF7, 0x6A, 0x78, 0x33, 0x65, 0x96, 0xEB,
+    0x16, 0x55, 0x61, 0xD5, 0xBC, 0x7C, 0x7F, 0x16, 0x9C, 0x3D, 0x86, 0xC5, 0x93, 0xCD, 0x38, 0x96,
+    0xDA, 0x80, 0x15, 0x5A, 0xED, 0x99, 0xD2, 0x6A, 0x7E, 0x66, 0x66, 0x7C, 0xFE, 0x4B, 0x78, 0xA9,
+    0x2B, 0x3D, 0x62, 0x2B, 0x8B, 0x8A, 0xBC, 0x7A, 0x23, 0xDF, 0x7C, 0x23, 0x7B, 0xDE, 0xAA, 0xEA,
+    0xAD, 0xC7, 0xA9, 0x03, 0x01, 0xBB, 0x24, 0xF5, 0x83, 0xD4, 0x40, 0xA6, 0x01, 0x7A, 0xC0, 0x54,
+    0xF0, 0xB8, 0x24, 0x72, 0x97, 0x8F, 0x01, 0x23, 0xC8, 0x76, 0xFB, 0x9B, 0xB7, 0x1C, 0x05, 0xB7,
+    0x35, 0xA5, 0xF5, 0xC0, 0xDE, 0xBF, 0x63, 0xDF, 0x2D, 0x18, 0xCB, 0x6A, 0xC1, 0x39, 0x71, 0xC8,
+    0xCA, 0x1A, 0x54, 0x85, 0x9C, 0x15, 0x67, 0xF6, 0x37, 0x3C, 0xC2, 0xF7, 0xD2, 0x88, 0xD6, 0xB2,
+    0x77, 0xEF, 0x7D, 0x59, 0xBA, 0x13, 0xBE, 0xD4, 0x83, 0x38, 0x61, 0x68, 0xC9, 0xAF, 0x4C, 0x28,
+    0x8E, 0x27, 0xC2, 0x0F, 0xB4, 0xE8, 0xD6, 0x41, 0x0F, 0xCF, 0x12, 0x0F, 0x76, 0xFC, 0xB1, 0xEC,
+    0x5D, 0x22, 0x27, 0xFD, 0x88, 0x86, 0x2A, 0x3B, 0x66, 0x04, 0x14, 0x72, 0x99, 0x31, 0x39, 0xA0,
+    0x8E, 0xEA, 0xB0, 0x86, 0xF4, 0x14, 0x52, 0x21, 0x72, 0x3B, 0xC7, 0x03, 0x63, 0x8E, 0x09, 0x96,
+    0x97, 0x52, 0x77, 0x38, 0xB5, 0x6E, 0xCA, 0x19, 0x8A, 0x4E, 0xCB, 0x3E, 0xCA, 0x22, 0x4D, 0x73,
+    0xD1, 0x26, 0x07, 0x04, 0x11, 0x60, 0xD2, 0xCF, 0x48, 0xE9, 0x8D, 0xD6, 0x87, 0xD2, 0x26, 0x99,
+    0x70, 0xD1, 0xB5, 0x12, 0xCE, 0xAE, 0x5A, 0xED, 0xAA, 0x1D, 0x33, 0x85, 0x7D, 0xED, 0xAA, 0x9E,
+    0x4B, 0x2C, 0x08, 0x97, 0x72, 0xC8, 0x05, 0x29, 0x23, 0x8E, 0x48, 0xE8, 0xD8, 0x2E, 0x26, 0xB0,
+    0x10, 0xD8, 0x42, 0x1F, 0x8E, 0x7A, 0x8F, 0x53, 0xF4, 0x24, 0xF2, 0x48, 0xC7, 0x98, 0x8D, 0x50,
+    0x52, 0x28, 0xCC, 0x42, 0x52, 0x6B, 0x63, 0xF8, 0x7C, 0xA1, 0xC9, 0xA4, 0x2D, 0x1B, 0x9C, 0x0C,
+    0xE6, 0x35, 0x1A, 0x0B, 0x6D, 0x68, 0x1A, 0x52, 0x50, 0x6F, 0xC9, 0x0C, 0x70, 0xD1, 0x77, 0x33,
+    0xDF, 0x30, 0xB1, 0xBE, 0x6D, 0x63, 0xA3, 0xF2, 0x83, 0xC4, 0x53, 0xE6, 0x46, 0x08, 0xA8, 0x1A,
+    0x73, 0x59, 0xA4, 0x7B, 0x1B, 0x59, 0x21, 0x3F, 0x27, 0x30, 0x9A, 0x1C, 0x7D, 0x64, 0x47, 0x03,
+    0xED, 0x00, 0xD0, 0x61, 0xE9, 0x0A, 0x0B, 0x81, 0x2B, 0x4B, 0x6D, 0x6A, 0xA6, 0x6E, 0xA1, 0x14,
+    0x96, 0x90, 0x3F, 0xC6, 0x59, 0x7A, 0xB6, 0x86, 0xDD, 0xB6, 0x3D, 0x5D, 0x50, 0x30, 0x99, 0x2E,
+    0xF6, 0xD0, 0xE2, 0x85, 0x89, 0xA3, 0xEB, 0xEC, 0x53, 0xBA, 0xAC, 0xDE, 0xDD, 0x1C, 0xF9, 0xA1,
+    0x6D, 0x40, 0xB9, 0x53, 0xC7, 0x4A, 0x5A, 0x2E, 0x68, 0xAE, 0x90, 0xF8, 0xCC, 0x26, 0xCC, 0x5B,
+    0xA8, 0x46, 0x46, 0xAF, 0x1F, 0x33, 0x16, 0x74, 0xBF, 0x52, 0xCF, 0x7D, 0x48, 0xDB, 0x63, 0xB1,
+    0xAE, 0x05, 0x75, 0x39, 0x55, 0x63, 0xE8, 0xB5, 0xF5, 0xD0, 0x5F, 0xD5, 0xDA, 0x04, 0x08, 0xAB,
+    0x68, 0x2B, 0xC2, 0x4D, 0x42, 0x9F, 0x99, 0xBE, 0xCA, 0x08, 0x7E, 0x29, 0x27, 0x67, 0xF3, 0xF0,
+    0xEE, 0x29, 0xB3, 0xD8, 0x90, 0xDD, 0xA2, 0xCB, 0xB7, 0x6F, 0xD4, 0xD0, 0x6B, 0x6C, 0x18, 0xF4,
+    0x56, 0x47, 0x36, 0x4E, 0x59, 0x98, 0xDC, 0x3F, 0xB6, 0x91, 0xB4, 0x21, 0xB4, 0x82, 0xB9, 0x8C,
+    0x9D, 0x91, 0x49, 0x28, 0x70, 0xBC, 0x71, 0xD3, 0x16, 0x4E, 0xBB, 0xDE, 0x3B, 0x0A, 0xD5, 0xF6,
+    0x36, 0xF8, 0x0D, 0x70, 0x3E, 0x01, 0x9A, 0xDB, 0xC1, 0xA9, 0x35, 0x78, 0xAD, 0x6D, 0xD3, 0x8A,
+    0x58, 0x52, 0x9D, 0x4C, 0xF1, 0x7C, 0x37, 0x13, 0x9C, 0x85, 0x42, 0x46, 0xC0, 0xA0, 0x6D, 0xF2,
+    0x91, 0xD0, 0x76, 0x04, 0x1B, 0x9F, 0xBC, 0x27, 0xFF, 0xDD, 0xD6, 0xE4, 0x79, 0x17, 0xD7, 0x53,
+    0xD8, 0xFF, 0xBE, 0xCE, 0xBB, 0xEB, 0xB7, 0x62, 0x3A, 0x44, 0xB6, 0x16, 0x8A, 0xD1, 0x96, 0xA6,
+    0x1A, 0xFD, 0xCC, 0x0D, 0xA0, 0x37, 0x19, 0xB1, 0x9C, 0x38, 0x81, 0xB6, 0x9E, 0x25, 0x98, 0x8E,
+    0x63, 0x1A, 0x36, 0x2E, 0xC5, 0x4F, 0x0D, 0x72, 0x01, 0xAC, 0x2B, 0xDD, 0x82, 0x62, 0xA0, 0x38,
+    0x7B, 0x93, 0x34, 0x8B, 0x6E, 0x4A, 0x1A, 0xB8, 0xB7, 0xF1, 0xDC, 0x78, 0x82, 0xFB, 0xE1, 0x4D,
+    0x33, 0x55, 0x4C, 0x47, 0x3D, 0x0D, 0x2D, 0x72, 0xB2, 0x40, 0x92, 0x5D, 0x6F, 0xF0, 0x4F, 0x70,
+    0x02, 0xBB, 0x5B, 0xF2, 0x7D, 0x46, 0x49, 0xBB, 0x68, 0x46, 0x78, 0x34, 0x0D, 0x12, 0x35, 0xD8,
+    0x75, 0xB7, 0xE2, 0x97, 0x5F, 0x3C, 0xC1, 0xE2, 0xA2, 0xEB, 0xBE, 0x11, 0x9C, 0xB6, 0xD4, 0x6A,
+    0xF4, 0x62, 0xB0, 0xBC, 0xC1, 0xC5, 0x42, 0x59, 0xF6, 0x06, 0xCA, 0xF5, 0xD8, 0xA5, 0x52, 0xD2,
+    0x2B, 0x0B, 0x7E, 0xFE, 0x75, 0x2A, 0xA9, 0x10, 0xDA, 0x39, 0xAB, 0x08, 0x61, 0xA5, 0x5E, 0x16,
+    0x90, 0x9A, 0x03, 0xD6, 0x17, 0xAD, 0xF9, 0xEB, 0x28, 0xA0, 0xE0, 0x6F, 0x0E, 0x4F, 0x9E, 0xFF,
+    0x25, 0x81, 0xD2, 0xA5, 0xCF, 0x5F, 0xDB, 0x0A, 0x42, 0xFA, 0x47, 0x73, 0xD7, 0x4F, 0x7C, 0x01,
+    0x18, 0xAD, 0x1B, 0xFA, 0x7C, 0x9A, 0x81, 0x45, 0x53, 0x00, 0xFB, 0x8A, 0xF0, 0x28, 0x5E, 0x80,
+    0x64, 0xE2, 0xF7, 0x55, 0xFA, 0x7B, 0xD0, 0x46, 0xDB, 0xBC, 0xF6, 0xF8, 0x03, 0xA8, 0x1B, 0x9A,
+    0x18, 0xBF, 0xC5, 0x16, 0x1B, 0x20, 0x2F, 0xC0, 0x7C, 0x16, 0x52, 0xAE, 0x35, 0x22, 0xDE, 0x8E,
+    0x33, 0x83, 0x8B, 0xA3, 0x49, 0x88, 0x32, 0x7C, 0xD1, 0xFF, 0x0C, 0x4B, 0xEB, 0xD3, 0xE6, 0x7F,
+    0x0B, 0x87, 0x6A, 0x97, 0x87, 0x0C, 0x00, 0x00,
+};
+
+const StaticFile StaticFiles[] =
+{
+    { Graph_svg_Path, Graph_svg_ContentType, Graph_svg_ETag, Graph_svg_Data, sizeof(Graph_svg_Data), true },
+    { Home_svg_Path, Home_svg_ContentType, Home_svg_ETag, Home_svg_Data, sizeof(Home_svg_Data), true },
+    { LogFile_svg_Path, LogFile_svg_ContentType, LogFile_svg_ETag, LogFile_svg_Data, sizeof(LogFile_svg_Data), true },
+    { Logo_png_Path, Logo_png_ContentType, Logo_png_ETag, Logo_png_Data, sizeof(Logo_png_Data), false },
+    { Settings_svg_Path, Settings_svg_ContentType, Settings_svg_ETag, Settings_svg_Data, sizeof(Settings_svg_Data), true },
+    { Upload_svg_Path, Upload_svg_ContentType, Upload_svg_ETag, Upload_svg_Data, sizeof(Upload_svg_Data), true },
+    { styles_css_Path, styles_css_ContentType, styles_css_ETag, styles_css_Data, sizeof(styles_css_Data), true },
+};
+
+const size_t StaticFileCount = sizeof(StaticFiles) / sizeof(StaticFiles[0]);
+
+#endif
@@ -5,26 +5,36 @@
 #include <WiFiStateMachine.h>
 #include <WiFiNTP.h>
 #include <WiFiFTP.h>
+#include <WiFiMQTT.h>
 #include <TimeUtils.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <ChunkedResponse.h>
 #include <HtmlWriter.h>
+#include <JsonWriter.h>
+#include <LogCursor.h>
 #include <Log.h>
+#include <CompressedLog.h>
 #include <AsyncHTTPRequest_Generic.h>
 #include "PersistentData.h"
 #include "Aquarea.h"
 #include "MonitoredTopics.h"
 #include "DayStatsEntry.h"
 #include "OTGWClient.h"
+#include "TopicPublisher.h"
+#include "StaticFiles.h"
 
 #define SECONDS_PER_DAY (24 * 3600)
 #define HTTP_POLL_INTERVAL 60
 #define EVENT_LOG_LENGTH 50
-#define TOPIC_LOG_SIZE 200
+#define EVENT_LOG_ARENA_SIZE 2048
+#define TOPIC_LOG_SIZE 1000
+#define TOPIC_LOG_BUFFER_SIZE 12800
 #define TOPIC_LOG_PAGE_SIZE 50
 #define DEFAULT_BAR_LENGTH 60
 #define WIFI_TIMEOUT_MS 2000
 #define FTP_RETRY_INTERVAL (15 * 60)
+#define MQTT_RETRY_INTERVAL 60
 #define QUERY_AQUAREA_INTERVAL 6
 #define AGGREGATION_INTERVAL 60
 #define ANTI_FREEZE_DELTA_T 5
@@ -46,6 +56,10 @@
 #define CFG_LOG_PACKET_ERRORS F("LogPacketErrors")
 #define CFG_ZONE1_OFFSET F("Zone1Offset")
 #define CFG_OTGW_HOST F("OTGW")
+#define CFG_MQTT_BROKER F("MQTTBroker")
+#define CFG_MQTT_USER F("MQTTUser")
+#define CFG_MQTT_PASSWORD F("MQTTPassword")
+#define CFG_MQTT_INTERVAL F("MQTTInterval")
 
 const char* ContentTypeHtml = "text/html;charset=UTF-8";
 const char* ContentTypeText = "text/plain";
@@ -83,13 +97,44 @@ ESPWebServer WebServer(80); // Default HTTP port
 WiFiNTP TimeServer;
 WiFiFTPClient FTPClient(WIFI_TIMEOUT_MS);
 OTGWClient OTGW;
-StringBuilder HttpResponse(4 * 1024); // 4 kB HTTP response buffer (we're using chunked responses)
+ChunkedResponse HttpResponse(WebServer, 1536); // 1.5KB HTTP response buffer (larger responses are sent in chunks)
 HtmlWriter Html(HttpResponse, Files[Logo], Files[Styles], DEFAULT_BAR_LENGTH);
-Log<const char> EventLog(EVENT_LOG_LENGTH);
-StaticLog<TopicLogEntry> TopicLog(TOPIC_LOG_SIZE);
+JsonWriter Json(HttpResponse);
+StringArenaLog EventLog(EVENT_LOG_LENGTH, EVENT_LOG_ARENA_SIZE);
+CompressedLog<TopicLogEntry, float, NUMBER_OF_MONITORED_TOPICS, 100> TopicLog(TOPIC_LOG_SIZE, TOPIC_LOG_BUFFER_SIZE);
 StaticLog<DayStatsEntry> DayStats(7);
 WiFiStateMachine WiFiSM(TimeServer, WebServer, EventLog);
 Aquarea HeatPump;
+WiFiMQTTClient MQTTClient(WIFI_TIMEOUT_MS);
+TopicPublisher MQTTPublisher(HeatPump, MQTTClient);
+
+// Measured values which change with almost every packet; published at most once per MQTT interval.
+const TopicId RateLimitedTopics[] =
+{
+    TopicId::Pump_Flow,
+    TopicId::Main_Inlet_Temp,
+    TopicId::Main_Outlet_Temp,
+    TopicId::Main_Hex_Outlet_Temp,
+    TopicId::Compressor_Freq,
+    TopicId::Compressor_Current,
+    TopicId::Compressor_Power,
+    TopicId::Heat_Power,
+    TopicId::DHW_Temp,
+    TopicId::Outside_Temp,
+    TopicId::Outside_Pipe_Temp,
+    TopicId::Inside_Pipe_Temp,
+    TopicId::Discharge_Temp,
+    TopicId::Defrost_Temp,
+    TopicId::Eva_Outlet_Temp,
+    TopicId::Bypass_Outlet_Temp,
+    TopicId::Ipm_Temp,
+    TopicId::High_Pressure,
+    TopicId::Low_Pressure,
+    TopicId::Fan1_Motor_Speed,
+    TopicId::Pump_Speed,
+    TopicId::Pump_Duty,
+    TopicId::EEV
+};
 Navigation Nav;
 
 TopicLogEntry newTopicLogEntry;
@@ -106,6 +151,7 @@ bool testAntiFreeze = false;
 bool testDefrost = false;
 bool pumpPrime = false;
 int otgwAttempt = 0;
+int lastAquareaError = 0;
 
 time_t currentTime = 0;
 time_t queryAquareaTime = 0;
@@ -114,6 +160,8 @@ time_t lastPacketErrorTime = 0;
 time_t topicLogAggregationTime = 0;
 time_t syncFTPTime = 0;
 time_t lastFTPSyncTime = 0;
+time_t mqttConnectTime = 0;
+time_t mqttPublishTime = 0;
 
 
 // Boot code
@@ -193,7 +241,7 @@ void setup()
     WebServer.on("/json", handleHttpAquaMonJsonRequest);
     WebServer.onNotFound(handleHttpNotFound);
 
-    WiFiSM.registerStaticFiles(Files, _LastFile);    
+    WiFiSM.registerStaticFiles(StaticFiles, StaticFileCount);
     WiFiSM.on(WiFiInitState::TimeServerSynced, onTimeServerSynced);
     WiFiSM.on(WiFiInitState::Initialized, onWiFiInitialized);
     WiFiSM.scanAccessPoints();
@@ -202,8 +250,14 @@ void setup()
     Tracer::traceFreeHeap();
 
     HeatPump.setZone1Offset(PersistentData.zone1Offset);
+    HeatPump.onTopicsChanged(makeTopicSet({TopicId::Error}), onAquareaErrorChanged);
+    HeatPump.onTopicsChanged(TopicSet().set(), onAquareaTopicsChanged);
+    HeatPump.onCommandFailed(onAquareaCommandFailed);
     HeatPump.begin();
 
+    MQTTPublisher.begin(PersistentData.hostName);
+    setMqttIntervals();
+
     if (PersistentData.otgwHost[0] != 0)
     {
         OTGW.begin(PersistentData.otgwHost);
@@ -248,10 +302,11 @@ void onTimeServerSynced()
 
 void onWiFiInitialized()
 {
-    if (Serial.available())
+    // Receive Aquarea packet without blocking; built-in LED is on while receiving
+    bool wasReceiving = HeatPump.isReceiving();
+    if (HeatPump.receive())
     {
-        digitalWrite(LED_BUILTIN, LED_ON);
-        if (HeatPump.readPacket())
+        if (HeatPump.isPacketValid())
             handleNewAquareaData();
         else
         {
@@ -259,19 +314,22 @@ void onWiFiInitialized()
             if (PersistentData.logPacketErrors)
                 WiFiSM.logEvent(HeatPump.getLastError());
         }
-        digitalWrite(LED_BUILTIN, LED_OFF);
     }
+    if (HeatPump.isReceiving() != wasReceiving)
+        digitalWrite(LED_BUILTIN, wasReceiving ? LED_OFF : LED_ON);
 
     if (currentTime >= queryAquareaTime)
     {
         queryAquareaTime += QUERY_AQUAREA_INTERVAL;
-        if (!HeatPump.sendQuery())
-            WiFiSM.logEvent(F("Failed sending Aquarea query"));
+        HeatPump.sendQuery();
     }
 
     if (!WiFiSM.isConnected())
         return;
 
+    if (PersistentData.mqttIsEnabled())
+        publishMqtt();
+
     if (OTGW.isInitialized && OTGW.isRequestPending())
     {
         int otgwResult = OTGW.requestData();
@@ -308,12 +366,12 @@ void handleNewAquareaData()
     uint32_t secondsSinceLastUpdate = (lastPacketReceivedTime == 0) ? 0 : (currentTime - lastPacketReceivedTime);
     lastPacketReceivedTime = currentTime;
 
-    float inletTemp = HeatPump.getTopic(TopicId::Main_Inlet_Temp).getValue().toFloat();
-    float outletTemp = HeatPump.getTopic(TopicId::Main_Outlet_Temp).getValue().toFloat();
-    float compPower = HeatPump.getTopic(TopicId::Compressor_Power).getValue().toFloat();
-    float heatPower = HeatPump.getTopic(TopicId::Heat_Power).getValue().toFloat();
-    int defrostingState = HeatPump.getTopic(TopicId::Defrosting_State).getValue().toInt();
-    float pumpFlow = HeatPump.getTopic(TopicId::Pump_Flow).getValue().toFloat();
+    float inletTemp = HeatPump.getTopicValue(TopicId::Main_Inlet_Temp);
+    float outletTemp = HeatPump.getTopicValue(TopicId::Main_Outlet_Temp);
+    float compPower = HeatPump.getTopicValue(TopicId::Compressor_Power);
+    float heatPower = HeatPump.getTopicValue(TopicId::Heat_Power);
+    int defrostingState = HeatPump.getTopicValue(TopicId::Defrosting_State);
+    float pumpFlow = HeatPump.getTopicValue(TopicId::Pump_Flow);
 
     if (testDefrost) defrostingState = 1;
 
@@ -333,6 +391,67 @@ void handleNewAquareaData()
 }
 
 
+void onAquareaTopicsChanged(const TopicSet& changedTopics)
+{
+    if (PersistentData.mqttIsEnabled())
+        MQTTPublisher.addChangedTopics(changedTopics);
+}
+
+
+void setMqttIntervals()
+{
+    for (TopicId topicId : RateLimitedTopics)
+        MQTTPublisher.setMinInterval(topicId, PersistentData.mqttInterval);
+}
+
+
+void publishMqtt()
+{
+    if (!MQTTClient.isConnected())
+    {
+        if (currentTime < mqttConnectTime)
+            return;
+        if (!MQTTClient.begin(PersistentData.mqttBroker, PersistentData.hostName, PersistentData.mqttUser, PersistentData.mqttPassword))
+        {
+            WiFiSM.logEvent(F("MQTT: %s"), MQTTClient.getLastError());
+            mqttConnectTime = currentTime + MQTT_RETRY_INTERVAL;
+            return;
+        }
+        WiFiSM.logEvent(F("MQTT connected to %s"), PersistentData.mqttBroker);
+        MQTTPublisher.publishAll();
+    }
+
+    MQTTClient.run();
+
+    // Changes are collected and published once per second (at most)
+    if ((currentTime != mqttPublishTime) && (lastPacketReceivedTime != 0))
+    {
+        mqttPublishTime = currentTime;
+        MQTTPublisher.publish();
+    }
+}
+
+
+void onAquareaCommandFailed(CommandId commandId, const char* error)
+{
+    if (commandId == CommandId::SetPump)
+        WiFiSM.logEvent(F("Unable to %s pump: %s"), HeatPump.isPumpOnRequested() ? "activate" : "deactivate", error);
+    else
+        WiFiSM.logEvent(F("Failed sending Aquarea query: %s"), error);
+}
+
+
+void onAquareaErrorChanged(const TopicSet& changedTopics)
+{
+    int errorCode = HeatPump.getTopicValue(TopicId::Error);
+    if (errorCode != lastAquareaError)
+    {
+        lastAquareaError = errorCode;
+        WiFiSM.logEvent(F("Aquarea: %s"), HeatPump.getTopic(TopicId::Error).getValue().c_str());
+    }
+}
+
+
 bool otgwSetPump(bool on, const String& reason = "")
 {
     if (on)
@@ -389,8 +508,7 @@ void antiFreezeControl(float inletTemp, float outletTemp, float compPower)
         {
             antiFreezeActivated = true;
             WiFiSM.logEvent(F("Anti-freeze activated."));
-            if (!HeatPump.setPump(true))
-                WiFiSM.logEvent(F("Unable to activate pump."));
+            HeatPump.setPump(true);
         }  
     }
     else
@@ -403,10 +521,7 @@ void antiFreezeControl(float inletTemp, float outletTemp, float compPower)
 
             // Don't stop pump if compressor started in the meantime.
             if (compPower == 0)
-            {
-                if (!HeatPump.setPump(false))
-                    WiFiSM.logEvent(F("Unable to deactivate pump."));
-            }
+                HeatPump.setPump(false);
             else
                 WiFiSM.logEvent(F("Compressor is on."));
         }  
@@ -437,7 +552,7 @@ void updateTopicLog()
     for (int i = 0; i < NUMBER_OF_MONITORED_TOPICS; i++)
     {
         TopicId topicId = MonitoredTopics[i].id;
-        newTopicLogEntry.topicValues[i] += HeatPump.getTopic(topicId).getValue().toFloat();
+        newTopicLogEntry.topicValues[i] += HeatPump.getTopicValue(topicId);
     }
 
     topicLogAggregations++;
@@ -487,8 +602,7 @@ bool trySyncFTP(Print* printTo)
     {
         if (ftpSyncEntries > 0)
         {
-            TopicLogEntry* firstEntryPtr = TopicLog.getEntryFromEnd(ftpSyncEntries);
-            writeTopicLogCsv(firstEntryPtr, dataClient);
+            writeTopicLogCsv(TopicLog.getEntriesFromEnd(ftpSyncEntries), dataClient);
             ftpSyncEntries = 0;
         }
         else if (printTo != nullptr)
@@ -510,9 +624,9 @@ bool trySyncFTP(Print* printTo)
 }
 
 
-void writeTopicLogCsv(TopicLogEntry* logEntryPtr, Print& destination)
+void writeTopicLogCsv(CompressedLog<TopicLogEntry, float, NUMBER_OF_MONITORED_TOPICS, 100>::Range logEntries, Print& destination)
 {
-    while (logEntryPtr != nullptr)
+    for (TopicLogEntry* logEntryPtr : logEntries)
     {
         destination.print(formatTime("%F %H:%M", logEntryPtr->time));
 
@@ -522,22 +636,10 @@ void writeTopicLogCsv(TopicLogEntry* logEntryPtr, Print& destination)
             destination.print(MonitoredTopics[i].formatValue(logEntryPtr->topicValues[i], false, 1));
         }
         destination.println();
-
-        logEntryPtr = TopicLog.getNextEntry();
     }
 }
 
 
-void sendChunk(bool isLast = false)
-{
-    TRACE(F("Chunk size: %d\n"), HttpResponse.length());
-    WebServer.sendContent(HttpResponse);
-    HttpResponse.clear();
-    if (isLast)
-        WebServer.chunkedResponseFinalize();
-}
-
-
 void handleHttpRootRequest()
 {
     Tracer tracer(F("handleHttpRootRequest"));
@@ -560,7 +662,7 @@ void handleHttpRootRequest()
         ? "Not yet"
         : formatTime("%H:%M:%S", lastPacketReceivedTime);
 
-    WebServer.chunkedResponseModeStart(200, ContentTypeHtml);
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Home"), Nav, HTTP_POLL_INTERVAL);
 
     Html.writeDivStart(F("flex-container"));
@@ -575,22 +677,26 @@ void handleHttpRootRequest()
     Html.writeRow(F("Packet errors"), F("%0.1f %%"), HeatPump.getPacketErrorRatio() * 100);
     Html.writeRow(F("FTP Sync"), ftpSync);
     Html.writeRow(F("Sync entries"), F("%d / %d"), ftpSyncEntries, PersistentData.ftpSyncEntries);
+    if (PersistentData.mqttIsEnabled())
+    {
+        Html.writeRow(
+            F("MQTT"),
+            F("%s, %u messages"),
+            MQTTClient.isConnected() ? "Connected" : "Disconnected",
+            MQTTClient.getPublishedMessages());
+    }
     Html.writeTableEnd();
     Html.writeSectionEnd();
 
-    sendChunk();
-
     if (lastPacketReceivedTime != 0)
         writeCurrentValues();
-    
-    sendChunk();
 
     writeStatisticsPerDay();
 
     Html.writeDivEnd();
     Html.writeFooter();
 
-    sendChunk(true);
+    HttpResponse.end();
 }
 
 
@@ -601,7 +707,7 @@ void writeCurrentValues()
     for (int i = 0; i < NUMBER_OF_MONITORED_TOPICS; i++)
     {
         MonitoredTopic topic = MonitoredTopics[i];
-        float topicValue = HeatPump.getTopic(topic.id).getValue().toFloat();
+        float topicValue = HeatPump.getTopicValue(topic.id);
         float barValue = (topicValue - topic.minValue) / (topic.maxValue - topic.minValue);
 
         String barCssClass = topic.style;
@@ -624,11 +730,9 @@ void writeStatisticsPerDay()
 {
     // Auto-ranging: determine max energy
     float maxEnergy = 1.0; // Prevent division by zero
-    DayStatsEntry* dayStatsEntryPtr = DayStats.getFirstEntry();
-    while (dayStatsEntryPtr != nullptr)
+    for (DayStatsEntry* dayStatsEntryPtr : DayStats)
     {
         maxEnergy = std::max(maxEnergy, dayStatsEntryPtr->energyOut);
-        dayStatsEntryPtr = DayStats.getNextEntry();
     }
 
     Html.writeSectionStart(F("Statistics per day"));
@@ -648,8 +752,7 @@ void writeStatisticsPerDay()
     Html.writeHeaderCell(F("COP"));
     Html.writeRowEnd();
 
-    dayStatsEntryPtr = DayStats.getFirstEntry();
-    while (dayStatsEntryPtr != nullptr)
+    for (DayStatsEntry* dayStatsEntryPtr : DayStats)
     {
         Html.writeRowStart();
         Html.writeCell(formatTime("%a", dayStatsEntryPtr->startTime));
@@ -675,8 +778,6 @@ void writeStatisticsPerDay()
         Html.writeCellEnd();
 
         Html.writeRowEnd();
-
-        dayStatsEntryPtr = DayStats.getNextEntry();
     }
 
     Html.writeTableEnd();
@@ -688,7 +789,7 @@ void handleHttpTopicsRequest()
 {
     Tracer tracer(F("handleHttpTopicsRequest"));
 
-    WebServer.chunkedResponseModeStart(200, ContentTypeHtml);
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Topics"), Nav);
 
     if (lastPacketReceivedTime != 0)
@@ -699,7 +800,6 @@ void handleHttpTopicsRequest()
 
         Html.writeTableStart();
 
-        int i = 0;
         for (TopicId topicId : HeatPump.getAllTopicIds())
         {
             Topic topic = HeatPump.getTopic(topicId);
@@ -709,16 +809,13 @@ void handleHttpTopicsRequest()
             Html.writeCell(topic.getValue());
             Html.writeCell(topic.getDescription());
             Html.writeRowEnd();
-
-            if (i++ % 20 == 0)
-                sendChunk();
         }
 
         Html.writeTableEnd();
     }
 
     Html.writeFooter();
-    sendChunk(true);
+    HttpResponse.end();
 }
 
 
@@ -729,7 +826,10 @@ void handleHttpTopicLogRequest()
     int currentPage = WebServer.hasArg("page") ? WebServer.arg("page").toInt() : 0;
     int totalPages = ((TopicLog.count() - 1) / TOPIC_LOG_PAGE_SIZE) + 1;
 
-    WebServer.chunkedResponseModeStart(200, ContentTypeHtml);
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, TopicLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeHtml);
 
     Html.writeHeader(F("Aquarea log"), Nav);
     Html.writePager(totalPages, currentPage);
@@ -743,12 +843,10 @@ void handleHttpTopicLogRequest()
     }
     Html.writeRowEnd();
 
-    TopicLogEntry* logEntryPtr = TopicLog.getFirstEntry();
-    for (int i = 0; i < (currentPage * TOPIC_LOG_PAGE_SIZE) && logEntryPtr != nullptr; i++)
-    {
-        logEntryPtr = TopicLog.getNextEntry();
-    }
-    for (int i = 0; i < TOPIC_LOG_PAGE_SIZE && logEntryPtr != nullptr; i++)
+    auto logEntries = incremental
+        ? TopicLog.getEntriesSince(cursor)
+        : TopicLog.getRange(currentPage * TOPIC_LOG_PAGE_SIZE, TOPIC_LOG_PAGE_SIZE);
+    for (TopicLogEntry* logEntryPtr : logEntries)
     {
         Html.writeRowStart();
         Html.writeCell(formatTime("%H:%M", logEntryPtr->time));
@@ -757,17 +855,12 @@ void handleHttpTopicLogRequest()
             Html.writeCell(MonitoredTopics[k].formatValue(logEntryPtr->topicValues[k], false, 1));
         }
         Html.writeRowEnd();
-
-        if (i % 10 == 0)
-            sendChunk();
-
-        logEntryPtr = TopicLog.getNextEntry();
     }
 
     Html.writeTableEnd();
     Html.writeFooter();
 
-    sendChunk(true);
+    HttpResponse.end();
 }
 
 
@@ -777,13 +870,23 @@ void handleHttpHexDumpRequest()
 
     if (WebServer.hasArg("raw"))
     {
-        HttpResponse.clear();
+        HttpResponse.begin(200, ContentTypeText);
         HeatPump.writeHexDump(HttpResponse, false);
 
-        WebServer.send(200, ContentTypeText, HttpResponse);
+        HttpResponse.end();
+    }
+    else if (WebServer.hasArg("capture"))
+    {
+        // Poll this to record packets for replay on the host
+        HttpResponse.begin(200, ContentTypeText);
+        if (lastPacketReceivedTime != 0)
+            HeatPump.writeCaptureLine(HttpResponse, lastPacketReceivedTime);
+
+        HttpResponse.end();
     }
     else
     {
+        HttpResponse.begin(200, ContentTypeHtml);
         Html.writeHeader(F("Hex dump"), Nav);
 
         Html.writeParagraph(
@@ -799,7 +902,23 @@ void handleHttpHexDumpRequest()
         Html.writeParagraph(
             F("Last error @ %s : %s"),
             formatTime("%H:%M:%S", lastPacketErrorTime),
-            HeatPump.getLastError().c_str());
+            HeatPump.getLastError());
+
+        for (int i = 0; i < NUMBER_OF_COMMANDS; i++)
+        {
+            CommandId commandId = static_cast<CommandId>(i);
+            const CommandStats& commandStats = HeatPump.getCommandStats(commandId);
+            Html.writeParagraph(
+                F("%s: %u sent, %u coalesced, %u timeouts, %u retries, %u failed. Latency: %u ms (max %u ms)."),
+                Aquarea::getCommandName(commandId),
+                commandStats.sent,
+                commandStats.coalesced,
+                commandStats.timeouts,
+                commandStats.retries,
+                commandStats.failures,
+                commandStats.lastLatency,
+                commandStats.maxLatency);
+        }
 
         if (lastPacketReceivedTime != 0)
         {
@@ -818,7 +937,7 @@ void handleHttpHexDumpRequest()
 
         Html.writeFooter();
 
-        WebServer.send(200, ContentTypeHtml, HttpResponse);
+        HttpResponse.end();
     }
 }
 
@@ -827,6 +946,7 @@ void handleHttpTestRequest()
 {
     Tracer tracer(F("handleHttpTestRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Test"), Nav);
 
     if (WiFiSM.shouldPerformAction(F("antiFreeze")))
@@ -890,7 +1010,7 @@ void handleHttpTestRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -898,25 +1018,19 @@ void handleHttpAquaMonJsonRequest()
 {
     Tracer tracer(F("handleHttpAquaMonJsonRequest"));
 
-    HttpResponse.clear();
-    HttpResponse.print(F("{ "));
+    HttpResponse.begin(200, ContentTypeJson);
+    Json.beginObject();
 
     for (int i = 0; i < NUMBER_OF_MONITORED_TOPICS; i++)
     {
-        MonitoredTopic topic = MonitoredTopics[i];
-        String label = FPSTR(topic.label);
-        float topicValue = HeatPump.getTopic(topic.id).getValue().toFloat();
-
-        if (i > 0) HttpResponse.print(F(", "));
-        HttpResponse.printf(
-            F(" \"%s\": %s"),
-            label.c_str(),
-            topic.formatValue(topicValue, false));
+        const MonitoredTopic& topic = MonitoredTopics[i];
+        float topicValue = HeatPump.getTopicValue(topic.id);
+        Json.writeMember(FPSTR(topic.label), topicValue, topic.decimals);
     }
 
-    HttpResponse.println(F(" }"));
+    Json.endObject();
 
-    WebServer.send(200, ContentTypeJson, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -924,6 +1038,7 @@ void handleHttpFtpSyncRequest()
 {
     Tracer tracer(F("handleHttpFtpSyncRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("FTP Sync"), Nav);
 
     Html.writePreStart();
@@ -951,7 +1066,7 @@ void handleHttpFtpSyncRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 
 }
 
@@ -960,29 +1075,27 @@ void handleHttpEventLogRequest()
 {
     Tracer tracer(F("handleHttpEventLogRequest"));
 
-    WebServer.chunkedResponseModeStart(200, ContentTypeHtml);
-    Html.writeHeader(F("Event log"), Nav);
-
     if (WiFiSM.shouldPerformAction(F("clear")))
     {
         EventLog.clear();
         WiFiSM.logEvent(F("Event log cleared."));
     }
 
-    int i = 0;
-    const char* event = EventLog.getFirstEntry();
-    while (event != nullptr)
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, EventLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeHtml);
+    Html.writeHeader(F("Event log"), Nav);
+
+    for (const char* event : incremental ? EventLog.getEntriesSince(cursor) : EventLog.getRange())
     {
         Html.writeDiv(F("%s"), event);
-        event = EventLog.getNextEntry();
-        if (i++ % 20 == 0)
-            sendChunk();
     }
 
     Html.writeActionLink(F("clear"), F("Clear event log"), currentTime, ButtonClass);
 
     Html.writeFooter();
-    sendChunk(true);
+    HttpResponse.end();
 }
 
 
@@ -990,6 +1103,7 @@ void handleHttpConfigFormRequest()
 {
     Tracer tracer(F("handleHttpConfigFormRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Settings"), Nav);
 
     Html.writeFormStart(F("/config"), F("grid"));
@@ -1005,6 +1119,10 @@ void handleHttpConfigFormRequest()
     Html.writeNumberBox(CFG_ZONE1_OFFSET, F("Zone1 offset"), PersistentData.zone1Offset, -5, 5, 1);
     Html.writeCheckbox(CFG_LOG_PACKET_ERRORS, F("Log packet errors"), PersistentData.logPacketErrors);
     Html.writeTextBox(CFG_OTGW_HOST, F("OTGW host"), PersistentData.otgwHost, sizeof(PersistentData.otgwHost) - 1);
+    Html.writeTextBox(CFG_MQTT_BROKER, F("MQTT broker"), PersistentData.mqttBroker, sizeof(PersistentData.mqttBroker) - 1);
+    Html.writeTextBox(CFG_MQTT_USER, F("MQTT user"), PersistentData.mqttUser, sizeof(PersistentData.mqttUser) - 1);
+    Html.writeTextBox(CFG_MQTT_PASSWORD, F("MQTT password"), PersistentData.mqttPassword, sizeof(PersistentData.mqttPassword) - 1, F("password"));
+    Html.writeNumberBox(CFG_MQTT_INTERVAL, F("MQTT interval"), PersistentData.mqttInterval, 0, 3600);
     Html.writeSubmitButton(F("Save"));
     Html.writeFormEnd();
 
@@ -1018,7 +1136,7 @@ void handleHttpConfigFormRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -1041,17 +1159,27 @@ void handleHttpConfigFormPost()
     copyString(WebServer.arg(CFG_FTP_USER), PersistentData.ftpUser, sizeof(PersistentData.ftpUser)); 
     copyString(WebServer.arg(CFG_FTP_PASSWORD), PersistentData.ftpPassword, sizeof(PersistentData.ftpPassword)); 
     copyString(WebServer.arg(CFG_OTGW_HOST), PersistentData.otgwHost, sizeof(PersistentData.otgwHost)); 
+    copyString(WebServer.arg(CFG_MQTT_BROKER), PersistentData.mqttBroker, sizeof(PersistentData.mqttBroker)); 
+    copyString(WebServer.arg(CFG_MQTT_USER), PersistentData.mqttUser, sizeof(PersistentData.mqttUser)); 
+    copyString(WebServer.arg(CFG_MQTT_PASSWORD), PersistentData.mqttPassword, sizeof(PersistentData.mqttPassword)); 
 
     PersistentData.ftpSyncEntries = WebServer.arg(CFG_FTP_SYNC_ENTRIES).toInt();
     PersistentData.antiFreezeTemp = WebServer.arg(CFG_ANTI_FREEZE_TEMP).toInt();
     PersistentData.zone1Offset = WebServer.arg(CFG_ZONE1_OFFSET).toFloat();
     PersistentData.logPacketErrors = WebServer.arg(CFG_LOG_PACKET_ERRORS) == "true";
+    PersistentData.mqttInterval = WebServer.arg(CFG_MQTT_INTERVAL).toInt();
 
     PersistentData.validate();
     PersistentData.writeToEEPROM();
 
     HeatPump.setZone1Offset(PersistentData.zone1Offset);
 
+    // Reconnect with the new settings
+    MQTTClient.end();
+    MQTTPublisher.begin(PersistentData.hostName);
+    setMqttIntervals();
+    mqttConnectTime = 0;
+
     handleHttpConfigFormRequest();
 }
 
@@ -2,12 +2,17 @@
 #include <Tracer.h>
 #include "Aquarea.h"
 
-#define NUMBER_OF_TOPICS 110
 #define AQUAREA_COMMAND_DATA_SIZE 108
 #define AQUAREA_RESPONSE_DATA_SIZE 200
+#define AQUAREA_PACKET_SIZE (AQUAREA_RESPONSE_DATA_SIZE + 3)
+#define AQUAREA_RECEIVE_GAP_MS 100 // Bytes received after such gap are a new packet
+#define AQUAREA_PACKET_WORDS ((AQUAREA_PACKET_SIZE + 3) / 4)
+#define AQUAREA_RESPONSE_TIMEOUT_MS 2000
+#define AQUAREA_COMMAND_INTERVAL_MS 500 // Minimum time between a response and the next command
 
 #define AQUAREA_QUERY_MAGIC 0x71
 #define AQUAREA_RESPONSE_MAGIC 0x71
+#define AQUAREA_COMMAND_MAGIC 0xF1
 
 float Aquarea::_zone1Offset = 0;
 
@@ -91,315 +96,226 @@ static const uint8_t _knownModels[21][10] PROGMEM =
 };
 
 
-String getPumpFlow(uint8_t* dataPtr)
+static float getPumpFlow(const uint8_t* dataPtr)
 {
-    int pumpFlowInt = (int)dataPtr[1];
-    float pumpFlowFract = (((float)dataPtr[0] - 1) / 256);
-    float pumpFlow = pumpFlowInt + pumpFlowFract;
-    return String(pumpFlow, 2);
+    return dataPtr[1] + (float(dataPtr[0]) - 1) / 256;
 }
 
-String getModel(uint8_t* dataPtr)
+static int getModel(const uint8_t* dataPtr)
 {
-    for (int i = 0 ; i < sizeof(_knownModels) / sizeof(_knownModels[0]) ; i++)
+    for (size_t i = 0 ; i < sizeof(_knownModels) / sizeof(_knownModels[0]) ; i++)
     {
         if (memcmp_P(dataPtr, _knownModels[i], 10) == 0)
-        {
-            return String(i);
-        }
+            return i;
     }
-    return F("-1");
+    return -1;
 }
 
-String getErrorInfo(uint8_t* dataPtr)
+// Error code: 0 if no error; otherwise the error type ('F' or 'H') * 256 + the error number.
+static int getErrorCode(const uint8_t* dataPtr)
 {
-    int errorType = (int)(dataPtr[0]);
-    int errorNumber = ((int)(dataPtr[1])) - 17;
-    char errorString[8];
-    switch (errorType) 
+    uint8_t errorNumber = dataPtr[1] - 17;
+    switch (dataPtr[0])
     {
         case 177: //B1=F type error
-            sprintf(errorString, "F%02X", errorNumber);
-            break;
+            return 'F' * 256 + errorNumber;
         case 161: //A1=H type error
-            sprintf(errorString, "H%02X", errorNumber);
-            break;
+            return 'H' * 256 + errorNumber;
         default:
-            return F("No error");
+            return 0;
     }
-    return String(errorString);
-}
-
-String getWordValue(uint8_t* dataPtr)
-{
-    return String(word(dataPtr[1], dataPtr[0]) - 1);
-}
-
-String getBit1and2(uint8_t* dataPtr)
-{
-    return String((*dataPtr >> 6) - 1);
-}
-
-String getBit3and4(uint8_t* dataPtr)
-{
-    return String(((*dataPtr >> 4) & 0b11) - 1);
-}
-
-String getBit5and6(uint8_t* dataPtr)
-{
-    return String(((*dataPtr >> 2) & 0b11) - 1);
-}
-
-String getBit7and8(uint8_t* dataPtr)
-{
-    return String((*dataPtr & 0b11) - 1);
-}
-
-String getBit3and4and5(uint8_t* dataPtr)
-{
-    return String(((*dataPtr >> 3) & 0b111) - 1);
-}
-
-String getLeft5bits(uint8_t* dataPtr)
-{
-    return String((*dataPtr >> 3) - 1);
-}
-
-String getRight3bits(uint8_t* dataPtr)
-{
-    return String((*dataPtr & 0b111) - 1);
-}
-
-String getIntMinus1(uint8_t* dataPtr)
-{
-    int value = (int)*dataPtr - 1;
-    return (String)value;
 }
 
-String getIntMinus128(uint8_t* dataPtr)
-{
-    int value = (int)*dataPtr - 128;
-    return (String)value;
-}
-
-String getIntMinus1Div5(uint8_t* dataPtr)
-{
-    return String((((float)*dataPtr - 1) / 5), 1);
-}
-
-String getIntMinus1Times10(uint8_t* dataPtr)
-{
-    int value = (int)*dataPtr - 1;
-    return (String)(value * 10);
-}
-
-String getIntMinus1Times50(uint8_t* dataPtr)
-{
-    int value = (int)*dataPtr - 1;
-    return (String)(value * 50);
-}
-
-String getOpMode(uint8_t* dataPtr)
+static int getOpMode(const uint8_t* dataPtr)
 {
     switch ((int)(*dataPtr & 0b111111))
     {
         case 18:
-            return "0";
+            return 0;
         case 19:
-            return "1";
+            return 1;
         case 25:
-            return "2";
+            return 2;
         case 33:
-            return "3";
+            return 3;
         case 34:
-            return "4";
+            return 4;
         case 35:
-            return "5";
+            return 5;
         case 41:
-            return "6";
+            return 6;
         case 26:
-            return "7";
+            return 7;
         case 42:
-            return "8";
+            return 8;
         default:
-            return "-1";
+            return -1;
     }
 }
 
-float getFraction(uint8_t data)
+static float getFraction(uint8_t data)
 {
     return 0.25F * ((data & 0b111) - 1);
 }
 
-String getInletTemp(uint8_t* dataPtr)
+static float getInletTemp(const uint8_t* dataPtr)
 {
-    float value = getFraction(dataPtr[118]) + dataPtr[143] - 128;
-    return (String)value;
+    return getFraction(dataPtr[118]) + dataPtr[143] - 128;
 }
 
-String getOutletTemp(uint8_t* dataPtr)
+static float getOutletTemp(const uint8_t* dataPtr)
 {
-    float value = getFraction(dataPtr[118] >> 3) + dataPtr[144] - 128;
-    return (String)value;
+    return getFraction(dataPtr[118] >> 3) + dataPtr[144] - 128;
 }
 
-String getZone1Temp(uint8_t* dataPtr)
-{
-    float value = Aquarea::_zone1Offset + (int)*dataPtr - 128;
-    return (String)value;
-}
 
-String getEnergy(uint8_t* dataPtr)
+TopicDesc _topicDescriptors[] PROGMEM = 
 {
-    int value = ((int)*dataPtr - 1) * 200;
-    return (String)value;
-}
+    { "Heatpump_State", 4, TopicDecoder::Bit7and8, 0, OffOn },
+    { "Pump_Flow", 169, TopicDecoder::PumpFlow, 2, LitersPerMin },
+    { "Force_DHW_State", 4, TopicDecoder::Bit1and2, 0, DisabledEnabled },
+    { "Quiet_Mode_Schedule", 7, TopicDecoder::Bit1and2, 0, DisabledEnabled },
+    { "Operating_Mode_State", 6, TopicDecoder::OpMode, 0, OpModeDesc },
+    { "Main_Inlet_Temp", 0, TopicDecoder::InletTemp, 2, Celsius },
+    { "Main_Outlet_Temp", 0, TopicDecoder::OutletTemp, 2, Celsius },
+    { "Main_Target_Temp", 153, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Compressor_Freq", 166, TopicDecoder::IntMinus1, 0, Hertz },
+    { "DHW_Target_Temp", 42, TopicDecoder::IntMinus128, 0, Celsius },
+    { "DHW_Temp", 141, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Operations_Hours", 182, TopicDecoder::Word, 0, Hours },
+    { "Operations_Counter", 179, TopicDecoder::Word, 0, Counter },
+    { "Main_Schedule_State", 5, TopicDecoder::Bit1and2, 0, DisabledEnabled },
+    { "Outside_Temp", 142, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Heat_Energy_Production", 194, TopicDecoder::Energy, 0, Watt },
+    { "Heat_Energy_Consumption", 193, TopicDecoder::Energy, 0, Watt },
+    { "Powerful_Mode_Time", 7, TopicDecoder::Right3bits, 0, Powerfulmode },
+    { "Quiet_Mode_Level", 7, TopicDecoder::Bit3and4and5, 0, Quietmode },
+    { "Holiday_Mode_State", 5, TopicDecoder::Bit3and4, 0, HolidayState },
+    { "ThreeWay_Valve_State", 111, TopicDecoder::Bit7and8, 0, Valve },
+    { "Outside_Pipe_Temp", 158, TopicDecoder::IntMinus128, 0, Celsius },
+    { "DHW_Heat_Delta", 99, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Heat_Delta", 84, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Cool_Delta", 94, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "DHW_Holiday_Shift_Temp", 44, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Defrosting_State", 111, TopicDecoder::Bit5and6, 0, DisabledEnabled },
+    { "Z1_Heat_Request_Temp", 38, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Cool_Request_Temp", 39, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Heat_Curve_Target_High_Temp", 75, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Heat_Curve_Target_Low_Temp", 76, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Heat_Curve_Outside_High_Temp", 78, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Heat_Curve_Outside_Low_Temp", 77, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Room_Thermostat_Temp", 156, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Heat_Request_Temp", 40, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Cool_Request_Temp", 41, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Water_Temp", 145, TopicDecoder::Zone1Temp, 2, Celsius },
+    { "Z2_Water_Temp", 146, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Cool_Energy_Production", 196, TopicDecoder::Energy, 0, Watt },
+    { "Cool_Energy_Consumption", 195, TopicDecoder::Energy, 0, Watt },
+    { "DHW_Energy_Production", 198, TopicDecoder::Energy, 0, Watt },
+    { "DHW_Energy_Consumption", 197, TopicDecoder::Energy, 0, Watt },
+    { "Z1_Water_Target_Temp", 147, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Water_Target_Temp", 148, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Error", 113, TopicDecoder::Error, 0, ErrorState },
+    { "Room_Holiday_Shift_Temp", 43, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Buffer_Temp", 149, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Solar_Temp", 150, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Pool_Temp", 151, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Main_Hex_Outlet_Temp", 154, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Discharge_Temp", 155, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Inside_Pipe_Temp", 157, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Defrost_Temp", 159, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Eva_Outlet_Temp", 160, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Bypass_Outlet_Temp", 161, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Ipm_Temp", 162, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Temp", 139, TopicDecoder::Zone1Temp, 2, Celsius },
+    { "Z2_Temp", 140, TopicDecoder::IntMinus128, 0, Celsius },
+    { "DHW_Heater_State", 9, TopicDecoder::Bit5and6, 0, BlockedFree },
+    { "Room_Heater_State", 9, TopicDecoder::Bit7and8, 0, BlockedFree },
+    { "Internal_Heater_State", 112, TopicDecoder::Bit7and8, 0, InactiveActive },
+    { "External_Heater_State", 112, TopicDecoder::Bit5and6, 0, InactiveActive },
+    { "Fan1_Motor_Speed", 173, TopicDecoder::IntMinus1Times10, 0, RotationsPerMin },
+    { "Fan2_Motor_Speed", 174, TopicDecoder::IntMinus1Times10, 0, RotationsPerMin },
+    { "High_Pressure", 163, TopicDecoder::IntMinus1Div5, 1, Pressure },
+    { "Pump_Speed", 171, TopicDecoder::IntMinus1Times50, 0, RotationsPerMin },
+    { "Low_Pressure", 164, TopicDecoder::IntMinus1, 0, Pressure },
+    { "Compressor_Current", 165, TopicDecoder::IntMinus1Div5, 1, Ampere },
+    { "Force_Heater_State", 5, TopicDecoder::Bit5and6, 0, InactiveActive },
+    { "Sterilization_State", 117, TopicDecoder::Bit5and6, 0, InactiveActive },
+    { "Sterilization_Temp", 100, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Sterilization_Max_Time", 101, TopicDecoder::IntMinus1, 0, Minutes },
+    { "Z1_Cool_Curve_Target_High_Temp", 86, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Cool_Curve_Target_Low_Temp", 87, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Cool_Curve_Outside_High_Temp", 89, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z1_Cool_Curve_Outside_Low_Temp", 88, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Heating_Mode", 28, TopicDecoder::Bit7and8, 0, HeatCoolModeDesc },
+    { "Heating_Off_Outdoor_Temp", 83, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Heater_On_Outdoor_Temp", 85, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Heat_To_Cool_Temp", 95, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Cool_To_Heat_Temp", 96, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Cooling_Mode", 28, TopicDecoder::Bit5and6, 0, HeatCoolModeDesc },
+    { "Z2_Heat_Curve_Target_High_Temp", 79, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Heat_Curve_Target_Low_Temp", 80, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Heat_Curve_Outside_High_Temp", 82, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Heat_Curve_Outside_Low_Temp", 81, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Cool_Curve_Target_High_Temp", 90, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Cool_Curve_Target_Low_Temp", 91, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Cool_Curve_Outside_High_Temp", 93, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Z2_Cool_Curve_Outside_Low_Temp", 92, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Room_Heater_Operations_Hours", 185, TopicDecoder::Word, 0, Hours },
+    { "DHW_Heater_Operations_Hours", 188, TopicDecoder::Word, 0, Hours },
+    { "Heat_Pump_Model", 129, TopicDecoder::Model, 0, Model },
+    { "Pump_Duty", 172, TopicDecoder::IntMinus1, 0, Duty },
+    { "Zones_State", 6, TopicDecoder::Bit1and2, 0, ZonesState },
+    { "Max_Pump_Duty", 45, TopicDecoder::IntMinus1, 0, Duty },
+    { "Heater_Delay_Time", 104, TopicDecoder::IntMinus1, 0, Minutes },
+    { "Heater_Start_Delta", 105, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Heater_Stop_Delta", 106, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Buffer_Installed", 24, TopicDecoder::Bit5and6, 0, DisabledEnabled },
+    { "DHW_Installed", 24, TopicDecoder::Bit7and8, 0, DisabledEnabled },
+    { "Solar_Mode", 24, TopicDecoder::Bit3and4, 0, SolarModeDesc },
+    { "Solar_On_Delta", 61, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Solar_Off_Delta", 62, TopicDecoder::IntMinus128, 0, Kelvin },
+    { "Solar_Frost_Protection", 63, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Solar_High_Limit", 64, TopicDecoder::IntMinus128, 0, Celsius },
+    { "Solar_DeltaT", 0, TopicDecoder::SolarDeltaT, 0, Celsius },
+    { "Compressor_Power", 165, TopicDecoder::Power, 1, KW },
+    { "Heat_Power", 0, TopicDecoder::HeatPower, 1, KW },
+    { "EEV", 175, TopicDecoder::IntMinus1, 0, Duty },
+};
 
-String getSolarDeltaT(uint8_t* dataPtr)
-{
-    int solarTemp = static_cast<int>(dataPtr[150]) - 128;
-    int bufferTemp = static_cast<int>(dataPtr[149]) - 128;
-    return String(solarTemp - bufferTemp);
-}
+static_assert(sizeof(_topicDescriptors) / sizeof(TopicDesc) == NUMBER_OF_TOPICS, "Topic descriptors don't match TopicId");
 
-String getPower(uint8_t* dataPtr)
-{
-    float current = float(*dataPtr - 1) / 5;
-    float powerKW = current * 230 / 1000;
-    return String(powerKW, 1);
-}
+static const float DecimalScales[] = { 1, 10, 100 };
 
-String getHeatPower(uint8_t* dataPtr)
+
+String Topic::getId()
 {
-    float pumpFlow = getPumpFlow(dataPtr + 169).toFloat();
-    if (pumpFlow < 0.5) return F("0.0");
-    float inletTemp = getInletTemp(dataPtr).toFloat();
-    float outletTemp = getOutletTemp(dataPtr).toFloat();
-    float heatPowerKW = 4.186 * (pumpFlow / 60) * std::max(outletTemp - inletTemp, 0.0F);
-    return String(heatPowerKW, 1);
+    String result = F("TOP");
+    result += static_cast<int>(_topicId);
+    return result;
 }
 
 
-TopicDesc _topicDescriptors[] PROGMEM = 
+String Topic::getValue()
 {
-    { "Heatpump_State", 4, getBit7and8, OffOn },
-    { "Pump_Flow", 169, getPumpFlow, LitersPerMin },
-    { "Force_DHW_State", 4, getBit1and2, DisabledEnabled },
-    { "Quiet_Mode_Schedule", 7, getBit1and2, DisabledEnabled },
-    { "Operating_Mode_State", 6, getOpMode, OpModeDesc },
-    { "Main_Inlet_Temp", 0, getInletTemp, Celsius },
-    { "Main_Outlet_Temp", 0, getOutletTemp, Celsius },
-    { "Main_Target_Temp", 153, getIntMinus128, Celsius },
-    { "Compressor_Freq", 166, getIntMinus1, Hertz },
-    { "DHW_Target_Temp", 42, getIntMinus128, Celsius },
-    { "DHW_Temp", 141, getIntMinus128, Celsius },
-    { "Operations_Hours", 182, getWordValue, Hours },
-    { "Operations_Counter", 179, getWordValue, Counter },
-    { "Main_Schedule_State", 5, getBit1and2, DisabledEnabled },
-    { "Outside_Temp", 142, getIntMinus128, Celsius },
-    { "Heat_Energy_Production", 194, getEnergy, Watt },
-    { "Heat_Energy_Consumption", 193, getEnergy, Watt },
-    { "Powerful_Mode_Time", 7, getRight3bits, Powerfulmode },
-    { "Quiet_Mode_Level", 7, getBit3and4and5, Quietmode },
-    { "Holiday_Mode_State", 5, getBit3and4, HolidayState },
-    { "ThreeWay_Valve_State", 111, getBit7and8, Valve },
-    { "Outside_Pipe_Temp", 158, getIntMinus128, Celsius },
-    { "DHW_Heat_Delta", 99, getIntMinus128, Kelvin },
-    { "Heat_Delta", 84, getIntMinus128, Kelvin },
-    { "Cool_Delta", 94, getIntMinus128, Kelvin },
-    { "DHW_Holiday_Shift_Temp", 44, getIntMinus128, Kelvin },
-    { "Defrosting_State", 111, getBit5and6, DisabledEnabled },
-    { "Z1_Heat_Request_Temp", 38, getIntMinus128, Celsius },
-    { "Z1_Cool_Request_Temp", 39, getIntMinus128, Celsius },
-    { "Z1_Heat_Curve_Target_High_Temp", 75, getIntMinus128, Celsius },
-    { "Z1_Heat_Curve_Target_Low_Temp", 76, getIntMinus128, Celsius },
-    { "Z1_Heat_Curve_Outside_High_Temp", 78, getIntMinus128, Celsius },
-    { "Z1_Heat_Curve_Outside_Low_Temp", 77, getIntMinus128, Celsius },
-    { "Room_Thermostat_Temp", 156, getIntMinus128, Celsius },
-    { "Z2_Heat_Request_Temp", 40, getIntMinus128, Celsius },
-    { "Z2_Cool_Request_Temp", 41, getIntMinus128, Celsius },
-    { "Z1_Water_Temp", 145, getZone1Temp, Celsius },
-    { "Z2_Water_Temp", 146, getIntMinus128, Celsius },
-    { "Cool_Energy_Production", 196, getEnergy, Watt },
-    { "Cool_Energy_Consumption", 195, getEnergy, Watt },
-    { "DHW_Energy_Production", 198, getEnergy, Watt },
-    { "DHW_Energy_Consumption", 197, getEnergy, Watt },
-    { "Z1_Water_Target_Temp", 147, getIntMinus128, Celsius },
-    { "Z2_Water_Target_Temp", 148, getIntMinus128, Celsius },
-    { "Error", 113, getErrorInfo, ErrorState },
-    { "Room_Holiday_Shift_Temp", 43, getIntMinus128, Kelvin },
-    { "Buffer_Temp", 149, getIntMinus128, Celsius },
-    { "Solar_Temp", 150, getIntMinus128, Celsius },
-    { "Pool_Temp", 151, getIntMinus128, Celsius },
-    { "Main_Hex_Outlet_Temp", 154, getIntMinus128, Celsius },
-    { "Discharge_Temp", 155, getIntMinus128, Celsius },
-    { "Inside_Pipe_Temp", 157, getIntMinus128, Celsius },
-    { "Defrost_Temp", 159, getIntMinus128, Celsius },
-    { "Eva_Outlet_Temp", 160, getIntMinus128, Celsius },
-    { "Bypass_Outlet_Temp", 161, getIntMinus128, Celsius },
-    { "Ipm_Temp", 162, getIntMinus128, Celsius },
-    { "Z1_Temp", 139, getZone1Temp, Celsius },
-    { "Z2_Temp", 140, getIntMinus128, Celsius },
-    { "DHW_Heater_State", 9, getBit5and6, BlockedFree },
-    { "Room_Heater_State", 9, getBit7and8, BlockedFree },
-    { "Internal_Heater_State", 112, getBit7and8, InactiveActive },
-    { "External_Heater_State", 112, getBit5and6, InactiveActive },
-    { "Fan1_Motor_Speed", 173, getIntMinus1Times10, RotationsPerMin },
-    { "Fan2_Motor_Speed", 174, getIntMinus1Times10, RotationsPerMin },
-    { "High_Pressure", 163, getIntMinus1Div5, Pressure },
-    { "Pump_Speed", 171, getIntMinus1Times50, RotationsPerMin },
-    { "Low_Pressure", 164, getIntMinus1, Pressure },
-    { "Compressor_Current", 165, getIntMinus1Div5, Ampere },
-    { "Force_Heater_State", 5, getBit5and6, InactiveActive },
-    { "Sterilization_State", 117, getBit5and6, InactiveActive },
-    { "Sterilization_Temp", 100, getIntMinus128, Celsius },
-    { "Sterilization_Max_Time", 101, getIntMinus1, Minutes },
-    { "Z1_Cool_Curve_Target_High_Temp", 86, getIntMinus128, Celsius },
-    { "Z1_Cool_Curve_Target_Low_Temp", 87, getIntMinus128, Celsius },
-    { "Z1_Cool_Curve_Outside_High_Temp", 89, getIntMinus128, Celsius },
-    { "Z1_Cool_Curve_Outside_Low_Temp", 88, getIntMinus128, Celsius },
-    { "Heating_Mode", 28, getBit7and8, HeatCoolModeDesc },
-    { "Heating_Off_Outdoor_Temp", 83, getIntMinus128, Celsius },
-    { "Heater_On_Outdoor_Temp", 85, getIntMinus128, Celsius },
-    { "Heat_To_Cool_Temp", 95, getIntMinus128, Celsius },
-    { "Cool_To_Heat_Temp", 96, getIntMinus128, Celsius },
-    { "Cooling_Mode", 28, getBit5and6, HeatCoolModeDesc },
-    { "Z2_Heat_Curve_Target_High_Temp", 79, getIntMinus128, Celsius },
-    { "Z2_Heat_Curve_Target_Low_Temp", 80, getIntMinus128, Celsius },
-    { "Z2_Heat_Curve_Outside_High_Temp", 82, getIntMinus128, Celsius },
-    { "Z2_Heat_Curve_Outside_Low_Temp", 81, getIntMinus128, Celsius },
-    { "Z2_Cool_Curve_Target_High_Temp", 90, getIntMinus128, Celsius },
-    { "Z2_Cool_Curve_Target_Low_Temp", 91, getIntMinus128, Celsius },
-    { "Z2_Cool_Curve_Outside_High_Temp", 93, getIntMinus128, Celsius },
-    { "Z2_Cool_Curve_Outside_Low_Temp", 92, getIntMinus128, Celsius },
-    { "Room_Heater_Operations_Hours", 185, getWordValue, Hours },
-    { "DHW_Heater_Operations_Hours", 188, getWordValue, Hours },
-    { "Heat_Pump_Model", 129, getModel, Model },
-    { "Pump_Duty", 172, getIntMinus1, Duty },
-    { "Zones_State", 6, getBit1and2, ZonesState },
-    { "Max_Pump_Duty", 45, getIntMinus1, Duty },
-    { "Heater_Delay_Time", 104, getIntMinus1, Minutes },
-    { "Heater_Start_Delta", 105, getIntMinus128, Kelvin },
-    { "Heater_Stop_Delta", 106, getIntMinus128, Kelvin },
-    { "Buffer_Installed", 24, getBit5and6, DisabledEnabled },
-    { "DHW_Installed", 24, getBit7and8, DisabledEnabled },
-    { "Solar_Mode", 24, getBit3and4, SolarModeDesc },
-    { "Solar_On_Delta", 61, getIntMinus128, Kelvin },
-    { "Solar_Off_Delta", 62, getIntMinus128, Kelvin },
-    { "Solar_Frost_Protection", 63, getIntMinus128, Celsius },
-    { "Solar_High_Limit", 64, getIntMinus128, Celsius },
-    { "Solar_DeltaT", 0, getSolarDeltaT, Celsius },
-    { "Compressor_Power", 165, getPower, KW },
-    { "Heat_Power", 0, getHeatPower, KW },
-    { "EEV", 175, getIntMinus1, Duty },
-};
+    char buffer[16];
+    formatValue(buffer, sizeof(buffer));
+    return String(buffer);
+}
 
 
-String Topic::getId()
+void Topic::formatValue(char* buffer, size_t bufferSize)
 {
-    String result = F("TOP");
-    result += static_cast<int>(_topicId);
-    return result;
+    if (_descriptor.decoder == TopicDecoder::Error)
+    {
+        int errorCode = static_cast<int>(_value);
+        if (errorCode == 0)
+            strncpy(buffer, "No error", bufferSize);
+        else
+            snprintf(buffer, bufferSize, "%c%02X", errorCode / 256, errorCode % 256);
+    }
+    else
+        snprintf(buffer, bufferSize, "%0.*f", _descriptor.decimals, _value);
 }
 
 
@@ -412,7 +328,8 @@ String Topic::getName()
 String Topic::getDescription()
 {
     char descriptionMapType[8];
-    strncpy_P(descriptionMapType, _descriptor.descriptionMapping[0], sizeof(descriptionMapType));
+    strncpy_P(descriptionMapType, _descriptor.descriptionMapping[0], sizeof(descriptionMapType) - 1);
+    descriptionMapType[sizeof(descriptionMapType) - 1] = 0;
 
     const __FlashStringHelper* description;
     if (strcmp(descriptionMapType, "value") == 0)
@@ -423,7 +340,7 @@ String Topic::getDescription()
     else 
     {
         // Map topic value to a description
-        int topicValue = _value.toInt();
+        int topicValue = static_cast<int>(_value);
         int maxValue = atoi(descriptionMapType);
         if ((topicValue < 0) || (topicValue > maxValue))
             description = F("???");
@@ -442,9 +359,15 @@ Aquarea::Aquarea()
     _debugOutputOnSerial = (&DEBUG_ESP_PORT == &Serial);
 #endif
 
+    _lastError[0] = 0;
+    memset(_data, 0, sizeof(_data));
+    memset(_previousData, 0, sizeof(_previousData));
+    memset(&_topicValues, 0, sizeof(_topicValues));
     memset(_queryData, 0, AQUAREA_COMMAND_DATA_SIZE);
     _queryData[0] = 0x01;
     _queryData[1] = 0x10;
+    memcpy(_commandData, _queryData, AQUAREA_COMMAND_DATA_SIZE);
+    memset(_commandStats, 0, sizeof(_commandStats));
 }
 
 
@@ -453,6 +376,7 @@ void Aquarea::resetPacketStats()
     _validPackets = 0;
     _repairedPackets = 0;
     _invalidPackets = 0;
+    memset(_commandStats, 0, sizeof(_commandStats));
 }
 
 
@@ -481,7 +405,6 @@ bool Aquarea::begin()
     }
 
     Serial.setRxBufferSize(512);
-    Serial.setTimeout(500);
     return true;
 }
 
@@ -494,52 +417,8 @@ uint8_t Aquarea::checkSum(uint8_t magic, uint8_t dataSize, uint8_t* dataPtr)
 }
 
 
-bool Aquarea::validateCheckSum()
-{
-    int packetSize = _data[1] + 3;
-
-    uint8_t sum = 0;
-    for (int i = 0; i < packetSize; i++)
-        sum += _data[i];
-
-    if (sum == 0)
-    {
-        _validPackets++;
-        return true;
-    }
-    else
-    {
-        _invalidPackets++;
-        _lastError = F("Checksum error: sum = 0x");
-        _lastError += String(sum, 16);
-        return false;           
-    }
-}
-
-
 bool Aquarea::sendCommand(uint8_t magic, uint8_t dataSize, uint8_t* dataPtr)
 {
-    if (_commandSentMillis != 0)
-    {
-        uint32_t timeoutMillis = _commandSentMillis + 2000;
-        if (millis() >= timeoutMillis)
-            TRACE(F("No response received for earlier command.\n"));
-        else
-        {
-            TRACE(F("Awaiting response of earlier command...\n"));
-            while ((_commandSentMillis != 0)  && (millis() < timeoutMillis))
-            {
-                delay(100);
-                if (Serial.available()) readPacket();
-            }
-            if (_commandSentMillis != 0)
-            {
-                TRACE(F("Timeout after %u ms.\n"), millis() - _commandSentMillis);
-            }
-        }
-        _commandSentMillis = 0;
-    }
-
     uint8_t checkSum = Aquarea::checkSum(magic, dataSize, dataPtr); 
 
     int bytesSent = Serial.write(magic);
@@ -554,29 +433,136 @@ bool Aquarea::sendCommand(uint8_t magic, uint8_t dataSize, uint8_t* dataPtr)
         static_cast<int>(dataSize),
         static_cast<int>(checkSum));
 
-    _commandSentMillis = millis();
     return (bytesSent == dataSize + 3);
 }
 
 
-bool Aquarea::sendQuery()
+const char* Aquarea::getCommandName(CommandId id)
 {
-    Tracer tracer(F("Aquarea::sendQuery"));
+    static const char* commandNames[] = { "Set pump", "Query" };
+    static_assert(sizeof(commandNames) / sizeof(commandNames[0]) == NUMBER_OF_COMMANDS, "Missing command names");
+    return commandNames[static_cast<int>(id)];
+}
+
+
+void Aquarea::queueCommand(CommandId id)
+{
+    int commandBit = 1 << static_cast<int>(id);
+    if (_queuedCommands & commandBit)
+    {
+        _commandStats[static_cast<int>(id)].coalesced++;
+        return;
+    }
+    _queuedCommands |= commandBit;
+    _commandQueuedMillis[static_cast<int>(id)] = millis();
+}
+
 
-    return sendCommand(AQUAREA_QUERY_MAGIC, AQUAREA_COMMAND_DATA_SIZE, _queryData);
+void Aquarea::sendQuery()
+{
+    queueCommand(CommandId::Query);
 }
 
 
-bool Aquarea::setPump(bool pumpOn)
+void Aquarea::setPump(bool pumpOn)
 {
     Tracer tracer(F("Aquarea::setPump"), pumpOn ? "on" : "off");
 
-    memset(_commandData, 0, AQUAREA_COMMAND_DATA_SIZE);
-    _commandData[0] = 0x01;
-    _commandData[1] = 0x10;
-    _commandData[2] = pumpOn ? 32 : 16;
+    bool isSent = !isCommandQueued(CommandId::SetPump) && _awaitingResponse && (_sentCommand == CommandId::SetPump);
+    if (isSent && (pumpOn == _pumpOn))
+    {
+        _commandStats[static_cast<int>(CommandId::SetPump)].coalesced++;
+        return;
+    }
 
-    return sendCommand(0xF1, AQUAREA_COMMAND_DATA_SIZE, _commandData);
+    _pumpOn = pumpOn;
+    _setPumpFailures = 0;
+    queueCommand(CommandId::SetPump);
+}
+
+
+// Sends the queued command with the highest priority if the bus is free.
+void Aquarea::sendQueuedCommand()
+{
+    uint32_t currentMillis = millis();
+    if (_awaitingResponse)
+    {
+        if (currentMillis - _commandSentMillis < AQUAREA_RESPONSE_TIMEOUT_MS)
+            return;
+        TRACE(F("No response for command '%s'.\n"), getCommandName(_sentCommand));
+        _commandStats[static_cast<int>(_sentCommand)].timeouts++;
+        _awaitingResponse = false;
+        _lastResponseMillis = currentMillis;
+        if (_sentCommand == CommandId::SetPump)
+            failCommand(CommandId::SetPump, "No response");
+    }
+
+    if ((_queuedCommands == 0) || (_state != ReceiveState::Idle) || (currentMillis - _lastResponseMillis < AQUAREA_COMMAND_INTERVAL_MS))
+        return;
+
+    CommandId id = static_cast<CommandId>(__builtin_ctz(_queuedCommands));
+    _queuedCommands &= ~(1 << static_cast<int>(id));
+    bool isSent;
+    switch (id)
+    {
+        case CommandId::SetPump:
+            _commandData[2] = _pumpOn ? 32 : 16;
+            isSent = sendCommand(AQUAREA_COMMAND_MAGIC, AQUAREA_COMMAND_DATA_SIZE, _commandData);
+            break;
+        default:
+            isSent = sendCommand(AQUAREA_QUERY_MAGIC, AQUAREA_COMMAND_DATA_SIZE, _queryData);
+    }
+
+    _sentCommand = id;
+    _commandSentMillis = currentMillis;
+    _commandStats[static_cast<int>(id)].sent++;
+    if (isSent)
+        _awaitingResponse = true;
+    else
+    {
+        _lastResponseMillis = currentMillis;
+        failCommand(id, "Write failed");
+    }
+}
+
+
+// Retries a failed Set pump command (unless setPump was called again meanwhile) or reports the failure.
+void Aquarea::failCommand(CommandId id, const char* error)
+{
+    CommandStats& stats = _commandStats[static_cast<int>(id)];
+    if (id == CommandId::SetPump)
+    {
+        if (isCommandQueued(CommandId::SetPump))
+            return;
+        if (++_setPumpFailures <= AQUAREA_SET_PUMP_RETRIES)
+        {
+            TRACE(F("Retrying command '%s' (%d)\n"), getCommandName(id), _setPumpFailures);
+            stats.retries++;
+            _queuedCommands |= 1 << static_cast<int>(id);
+            return;
+        }
+    }
+
+    stats.failures++;
+    if (_commandFailedHandler != nullptr)
+        _commandFailedHandler(id, error);
+}
+
+
+// Some kind of response is received; allow next command to be sent.
+void Aquarea::completeCommand()
+{
+    _lastResponseMillis = _lastReceiveMillis;
+    if (!_awaitingResponse)
+        return;
+
+    if (_sentCommand == CommandId::SetPump)
+        _setPumpFailures = 0;
+
+    CommandStats& stats = _commandStats[static_cast<int>(_sentCommand)];
+    stats.lastLatency = _lastReceiveMillis - _commandQueuedMillis[static_cast<int>(_sentCommand)];
+    stats.maxLatency = std::max(stats.maxLatency, stats.lastLatency);
+    _awaitingResponse = false;
 }
 
 
@@ -589,141 +575,248 @@ const char* formatPacketInfo(uint8_t magic, uint8_t dataSize, size_t readBytes)
         "Magic: 0x%02X. Data size: %d. Received: %u.",
         static_cast<int>(magic),
         static_cast<int>(dataSize),
-        readBytes);
+        static_cast<unsigned int>(readBytes));
     return result;
 }
 
 
-bool Aquarea::readPacket()
+void Aquarea::setLastError(const char* format, ...)
 {
-    Tracer tracer(F("Aquarea::readPacket"));
-
-    PacketHeader header;
-    if (readBytes((uint8_t*)&header, sizeof(header)) != sizeof(header))
-    {
-        _lastError = F("Timeout reading packet header");
-        _invalidPackets++;
-        return false;
-    }
+    va_list args;
+    va_start(args, format);
+    vsnprintf(_lastError, sizeof(_lastError), format, args);
+    va_end(args);
+}
 
-    // Some kind of response is received; allow next command to be sent.
-    _commandSentMillis = 0; 
 
-    size_t bytesRead;
-    if (_debugOutputOnSerial && (header.magic == 't'))
+bool Aquarea::receive()
+{
+    bool packetReceived = false;
+    if (Serial.available())
+        _lastReceiveMillis = millis();
+    while (!packetReceived && Serial.available())
     {
-        // Test packet for debug purposes
-        bytesRead = readTestData(header);
-        if (bytesRead < 0) 
+        uint8_t byte = Serial.read();
+
+        switch (_state)
         {
-            _invalidPackets++;
-            return false;
+            case ReceiveState::Idle:
+                if (_debugOutputOnSerial)
+                {
+                    // Test command for debug purposes (see test.txt)
+                    if (byte == 't')
+                        _state = ReceiveState::TestCommand;
+                    break;
+                }
+                startReceiving();
+                packetReceived = receiveByte(byte);
+                break;
+
+            case ReceiveState::Receiving:
+                packetReceived = receiveByte(byte);
+                break;
+
+            default:
+                packetReceived = receiveTestByte(byte);
         }
     }
-    else
+
+    if (!packetReceived && (_state != ReceiveState::Idle) && (millis() - _lastReceiveMillis >= AQUAREA_RECEIVE_GAP_MS))
     {
-        uint8_t* dataPtr = (header.magic == AQUAREA_RESPONSE_MAGIC) && (header.dataSize == AQUAREA_RESPONSE_DATA_SIZE)
-            ? _data
-            : _invalidData;
+        // No more bytes; try to recover a packet from what has been received.
+        if (_state == ReceiveState::TestCommand)
+            packetReceived = completePacket(false);
+        else if (_state == ReceiveState::TestTopicValue)
+            packetReceived = receiveTestByte('\n');
+        else
+            packetReceived = repairPacket();
+    }
 
-        memset(dataPtr, 0xEE, DATA_BUFFER_SIZE); // Mark "Empty" bytes in hex dump
-        dataPtr[0] = header.magic;
-        dataPtr[1] = header.dataSize;
+    if ((_queuedCommands != 0) || _awaitingResponse)
+        sendQueuedCommand();
 
-        // Always try to read more bytes than expected to ensure the RX buffer is flushed
-        // Timeout is set to 500 ms, so this won't block too long.
-        bytesRead = readBytes(dataPtr + 2, DATA_BUFFER_SIZE - 2);
-    }
+    return packetReceived;
+}
+
+
+void Aquarea::startReceiving()
+{
+    _state = ReceiveState::Receiving;
+    _receivedLength = 0;
+    _windowSum = 0;
+}
 
-    TRACE(F("Received packet. %s\n"), formatPacketInfo(header.magic, header.dataSize, bytesRead));
 
-    if ((header.magic == AQUAREA_RESPONSE_MAGIC) || (header.dataSize == AQUAREA_RESPONSE_DATA_SIZE))
+bool Aquarea::receiveByte(uint8_t byte)
+{
+    if (_receivedLength == DATA_BUFFER_SIZE)
     {
-        if (bytesRead != header.dataSize + 1)
-        {
-            _lastError = formatPacketInfo(header.magic, header.dataSize, bytesRead);
-            _invalidPackets++;
-            return false;
-        }
+        // Too much garbage; keep the bytes which may still be the start of a packet.
+        _receivedLength = AQUAREA_PACKET_SIZE - 1;
+        memmove(_invalidData, _invalidData + DATA_BUFFER_SIZE - _receivedLength, _receivedLength);
+        _windowSum = 0;
+        for (size_t i = 0; i < _receivedLength; i++)
+            _windowSum += _invalidData[i];
     }
-    else
+
+    // The window sum is the checksum of the last AQUAREA_PACKET_SIZE bytes received.
+    _invalidData[_receivedLength++] = byte;
+    _windowSum += byte;
+    if (_receivedLength > AQUAREA_PACKET_SIZE)
+        _windowSum -= _invalidData[_receivedLength - AQUAREA_PACKET_SIZE - 1];
+    else if (_receivedLength < AQUAREA_PACKET_SIZE)
+        return false;
+
+    uint8_t* packetPtr = _invalidData + _receivedLength - AQUAREA_PACKET_SIZE;
+    if ((_windowSum != 0) || (packetPtr[0] != AQUAREA_RESPONSE_MAGIC) || (packetPtr[1] != AQUAREA_RESPONSE_DATA_SIZE))
+        return false;
+
+    // Packet found; any preceding bytes are garbage (resynchronized)
+    bool resynchronized = (packetPtr != _invalidData);
+    if (resynchronized)
+        TRACE(F("Skipped %d bytes before packet.\n"), packetPtr - _invalidData);
+
+    memcpy(_data, packetPtr, AQUAREA_PACKET_SIZE);
+    return completePacket(resynchronized);
+}
+
+
+bool Aquarea::repairPacket()
+{
+    memset(_invalidData + _receivedLength, 0xEE, DATA_BUFFER_SIZE - _receivedLength); // Mark "Empty" bytes in hex dump
+
+    // Typical packet mutilation: the header bytes are garbled or lost, but the data is intact.
+    // The data (starting with 0x10) and checksum are at the end of the received bytes.
+    if (_receivedLength >= AQUAREA_RESPONSE_DATA_SIZE)
     {
-        // Typical packet mutilations which can be repaired:
-        if ((header.dataSize == 190) && (bytesRead == 200) & (_invalidData[2] == 0x10))
+        uint8_t* dataPtr = _invalidData + _receivedLength - AQUAREA_RESPONSE_DATA_SIZE;
+        uint8_t sum = uint8_t(AQUAREA_RESPONSE_MAGIC + AQUAREA_RESPONSE_DATA_SIZE + 1);
+        for (int i = 0; i < AQUAREA_RESPONSE_DATA_SIZE; i++)
+            sum += dataPtr[i];
+        if ((dataPtr[0] == 0x10) && (sum == 0))
         {
             TRACE(F("Repairing packet.\n"));
             _data[0] = AQUAREA_RESPONSE_MAGIC;
             _data[1] = AQUAREA_RESPONSE_DATA_SIZE;
             _data[2] = 1;
-            memcpy(_data + 3, _invalidData + 2, 200);
-            _repairedPackets++;
-        }
-        else
-        {
-            _lastError = formatPacketInfo(header.magic, header.dataSize, bytesRead);
-            _invalidPackets++;
-            return false;
+            memcpy(_data + 3, dataPtr, AQUAREA_RESPONSE_DATA_SIZE);
+            return completePacket(true);
         }
     }
 
-    return validateCheckSum();  
+    if ((_receivedLength == AQUAREA_PACKET_SIZE) && (_invalidData[0] == AQUAREA_RESPONSE_MAGIC))
+        setLastError("Checksum error: sum = 0x%02X", _windowSum);
+    else
+        setLastError("%s", formatPacketInfo(_invalidData[0], _invalidData[1], _receivedLength));
+    return rejectPacket();
 }
 
 
-int Aquarea::readTestData(PacketHeader& header)
+bool Aquarea::completePacket(bool repaired)
 {
-    char testCommand = header.dataSize;
-    TRACE(F("Aquarea::readTestData(). testCommand: '%c'\n"), testCommand);
+    uint8_t sum = 0;
+    for (int i = 0; i < AQUAREA_PACKET_SIZE; i++)
+        sum += _data[i];
 
-    size_t bytesRead = AQUAREA_RESPONSE_DATA_SIZE + 1;
-    if (testCommand == 'o')
+    if (sum != 0)
     {
-        TRACE(F("Setting topic value...\n"));
-        bool success = setTopicValue();
-        if (!success) return -2;
-        header.magic = _data[0];
-        header.dataSize = _data[1];
+        setLastError("Checksum error: sum = 0x%02X", sum);
+        return rejectPacket();
     }
-    else if (testCommand == ' ')
-    {
-        TRACE(F("Receiving packet data in hexdump form...\n"));
 
-        if (readHexBytes((uint8_t*)&header, sizeof(header)) != sizeof(header))
-        {
-            _lastError = F("Timeout reading packet header");
-            return -1;
-        }
-
-        uint8_t* dataPtr = (header.magic == AQUAREA_RESPONSE_MAGIC) && (header.dataSize == AQUAREA_RESPONSE_DATA_SIZE)
-            ? _data
-            : _invalidData;
+    completeCommand();
+    _state = ReceiveState::Idle;
+    _isPacketValid = true;
+    _validPackets++;
+    if (repaired)
+        _repairedPackets++;
+    decodeTopics();
+    notifySubscribers();
+    return true;
+}
 
-        memset(dataPtr, 0xEE, DATA_BUFFER_SIZE); // Mark "Empty" bytes in hex dump
-        dataPtr[0] = header.magic;
-        dataPtr[1] = header.dataSize;
 
-        // Always try to read more bytes than expected to ensure the RX buffer is flushed
-        // Timeout is set to 500 ms, so this won't block too long.
-        bytesRead = readHexBytes(dataPtr + 2, DATA_BUFFER_SIZE - 2);
-    }
-    else
-        TRACE(F("Repeating last packet.\n"));
+bool Aquarea::rejectPacket()
+{
+    TRACE(F("Rejected packet: %s\n"), _lastError);
 
-    return bytesRead; 
+    completeCommand();
+    _state = ReceiveState::Idle;
+    _isPacketValid = false;
+    _invalidPackets++;
+    return true;
 }
 
 
-bool Aquarea::setTopicValue()
+bool Aquarea::receiveTestByte(char c)
 {
-    String topicName = Serial.readStringUntil('=');
-    topicName.trim();
+    switch (_state)
+    {
+        case ReceiveState::TestCommand:
+            if (c == ' ')
+            {
+                TRACE(F("Receiving packet data in hexdump form...\n"));
+                startReceiving();
+                _state = ReceiveState::TestHexData;
+                _testLineLength = 0;
+                return false;
+            }
+            if (c == 'o')
+            {
+                TRACE(F("Setting topic value...\n"));
+                _state = ReceiveState::TestTopicValue;
+                _testLineLength = 0;
+                return false;
+            }
+            TRACE(F("Repeating last packet.\n"));
+            return completePacket(false);
 
-    uint8_t value;
-    if (readHexBytes(&value, 1) != 1)
+        case ReceiveState::TestHexData:
+            if (isxdigit(c))
+            {
+                // Two hex digits per byte; the first digit is kept in the line buffer.
+                _testLine[_testLineLength++] = c;
+                if (_testLineLength == 2)
+                {
+                    _testLine[2] = 0;
+                    _testLineLength = 0;
+                    return receiveByte(strtoul(_testLine, nullptr, 16));
+                }
+            }
+            else if (c == '\n')
+                return repairPacket();
+            return false;
+
+        case ReceiveState::TestTopicValue:
+            if ((c != '\n') && (_testLineLength < sizeof(_testLine) - 1))
+            {
+                _testLine[_testLineLength++] = c;
+                return false;
+            }
+            _testLine[_testLineLength] = 0;
+            if (setTopicValue(_testLine))
+                return completePacket(false);
+            return rejectPacket();
+
+        default:
+            return false;
+    }
+}
+
+
+// Sets the topic's byte in the packet data, e.g. "Defrosting_State=09".
+bool Aquarea::setTopicValue(char* assignment)
+{
+    char* valuePtr = strchr(assignment, '=');
+    if (valuePtr == nullptr)
     {
-        _lastError = F("Timeout reading byte value");
+        setLastError("Invalid topic assignment: %s", assignment);
         return false;
     }
+    *valuePtr++ = 0;
+    String topicName = assignment;
+    topicName.trim();
+    uint8_t value = strtoul(valuePtr, nullptr, 16);
 
     bool knownTopic = false;
     TopicDesc topicDescriptor;
@@ -738,8 +831,7 @@ bool Aquarea::setTopicValue()
     }
     if (!knownTopic)
     {
-        _lastError = F("Unknown Topic: ");
-        _lastError += topicName;
+        setLastError("Unknown Topic: %s", topicName.c_str());
         return false;
     }
 
@@ -762,37 +854,6 @@ bool Aquarea::setTopicValue()
 }
 
 
-size_t Aquarea::readBytes(uint8_t* bufferPtr, size_t count)
-{
-    size_t bytesRead = Serial.readBytes(bufferPtr, count);
-    if (bytesRead != count)
-        TRACE(F("Timeout reading %d bytes. %d bytes read.\n"), count, bytesRead);
-    return bytesRead;
-}
-
-
-size_t Aquarea::readHexBytes(uint8_t* bufferPtr, size_t count)
-{
-    char hexDigits[3];
-    hexDigits[2] = 0;
-
-    for (int i = 0; i < count; i++)
-    {
-        if (Serial.readBytes((uint8_t*)hexDigits, 2) != 2)
-        {
-            TRACE(F("Timeout reading %d hex bytes. %d hex bytes read.\n"), count, i);
-            return i;
-        }
-
-        uint32_t byte;
-        sscanf(hexDigits, "%X", &byte);
-        bufferPtr[i] = byte; 
-    }
-
-    return count;
-}
-
-
 void Aquarea::writeHexDump(Print& printTo, bool showInvalidData)
 {
     uint8_t* dataPtr;
@@ -823,14 +884,195 @@ void Aquarea::writeHexDump(Print& printTo, bool showInvalidData)
 }
 
 
+void Aquarea::writeCaptureLine(Print& printTo, time_t time)
+{
+    printTo.printf("%u ", static_cast<uint32_t>(time));
+    int length = std::min(_data[1] + 3, DATA_BUFFER_SIZE);
+    for (int i = 0; i < length; i++)
+        printTo.printf("%02X", _data[i]);
+    printTo.println();
+}
+
+
+float Aquarea::decodeTopic(const TopicDesc& descriptor)
+{
+    const uint8_t* dataPtr = _data + descriptor.index;
+    switch (descriptor.decoder)
+    {
+        case TopicDecoder::Bit1and2:
+            return (*dataPtr >> 6) - 1;
+        case TopicDecoder::Bit3and4:
+            return ((*dataPtr >> 4) & 0b11) - 1;
+        case TopicDecoder::Bit5and6:
+            return ((*dataPtr >> 2) & 0b11) - 1;
+        case TopicDecoder::Bit7and8:
+            return (*dataPtr & 0b11) - 1;
+        case TopicDecoder::Bit3and4and5:
+            return ((*dataPtr >> 3) & 0b111) - 1;
+        case TopicDecoder::Right3bits:
+            return (*dataPtr & 0b111) - 1;
+        case TopicDecoder::IntMinus1:
+            return int(*dataPtr) - 1;
+        case TopicDecoder::IntMinus128:
+            return int(*dataPtr) - 128;
+        case TopicDecoder::IntMinus1Div5:
+            return (float(*dataPtr) - 1) / 5;
+        case TopicDecoder::IntMinus1Times10:
+            return (int(*dataPtr) - 1) * 10;
+        case TopicDecoder::IntMinus1Times50:
+            return (int(*dataPtr) - 1) * 50;
+        case TopicDecoder::Word:
+            return word(dataPtr[1], dataPtr[0]) - 1;
+        case TopicDecoder::PumpFlow:
+            return getPumpFlow(dataPtr);
+        case TopicDecoder::OpMode:
+            return getOpMode(dataPtr);
+        case TopicDecoder::InletTemp:
+            return getInletTemp(_data);
+        case TopicDecoder::OutletTemp:
+            return getOutletTemp(_data);
+        case TopicDecoder::Zone1Temp:
+            return _zone1Offset + int(*dataPtr) - 128;
+        case TopicDecoder::Energy:
+            return (int(*dataPtr) - 1) * 200;
+        case TopicDecoder::SolarDeltaT:
+            return int(_data[150]) - int(_data[149]);
+        case TopicDecoder::Power:
+            return (float(*dataPtr) - 1) / 5 * 230 / 1000; // kW
+        case TopicDecoder::HeatPower:
+        {
+            // Uses the (rounded) pump flow and temperatures decoded before
+            float pumpFlow = _topicValues.get(TopicId::Pump_Flow);
+            if (pumpFlow < 0.5) return 0;
+            float deltaT = _topicValues.get(TopicId::Main_Outlet_Temp) - _topicValues.get(TopicId::Main_Inlet_Temp);
+            return 4.186 * (pumpFlow / 60) * std::max(deltaT, 0.0F);
+        }
+        case TopicDecoder::Error:
+            return getErrorCode(dataPtr);
+        case TopicDecoder::Model:
+            return getModel(dataPtr);
+    }
+    return 0;
+}
+
+
+static inline bool isByteChanged(const uint32_t* changedBytes, int index)
+{
+    return changedBytes[index / 32] & (1UL << (index % 32));
+}
+
+
+bool Aquarea::isTopicDataChanged(const TopicDesc& descriptor, const uint32_t* changedBytes)
+{
+    int index = descriptor.index;
+    switch (descriptor.decoder)
+    {
+        case TopicDecoder::InletTemp:
+            return isByteChanged(changedBytes, 118) || isByteChanged(changedBytes, 143);
+        case TopicDecoder::OutletTemp:
+            return isByteChanged(changedBytes, 118) || isByteChanged(changedBytes, 144);
+        case TopicDecoder::SolarDeltaT:
+            return isByteChanged(changedBytes, 149) || isByteChanged(changedBytes, 150);
+        case TopicDecoder::HeatPower:
+            return isTopicChanged(TopicId::Pump_Flow)
+                || isTopicChanged(TopicId::Main_Inlet_Temp)
+                || isTopicChanged(TopicId::Main_Outlet_Temp);
+        case TopicDecoder::Word:
+        case TopicDecoder::PumpFlow:
+        case TopicDecoder::Error:
+            return isByteChanged(changedBytes, index) || isByteChanged(changedBytes, index + 1);
+        case TopicDecoder::Model:
+            for (int i = index; i < index + 10; i++)
+            {
+                if (isByteChanged(changedBytes, i)) return true;
+            }
+            return false;
+        default:
+            return isByteChanged(changedBytes, index);
+    }
+}
+
+
+// Only decodes the topics for which the packet data changed since the previous packet.
+// Most of the packet doesn't change between queries, so typically only a few topics are decoded.
+void Aquarea::decodeTopics()
+{
+    // Compare with the previous packet a word at a time; collect the changed bytes in a bitmask.
+    uint32_t changedBytes[(AQUAREA_PACKET_WORDS * 4 + 31) / 32];
+    memset(changedBytes, 0, sizeof(changedBytes));
+    for (int i = 0; i < AQUAREA_PACKET_WORDS; i++)
+    {
+        uint32_t dataWord;
+        memcpy(&dataWord, _data + i * 4, 4);
+        uint32_t diff = dataWord ^ _previousData[i];
+        if (diff == 0) continue;
+        _previousData[i] = dataWord;
+        for (int j = 0; j < 4; j++)
+        {
+            // Little endian; the first byte is in the least significant bits.
+            if (diff & (0xFFUL << (j * 8)))
+            {
+                int index = i * 4 + j;
+                changedBytes[index / 32] |= 1UL << (index % 32);
+            }
+        }
+    }
+
+    _changedTopics.reset();
+    for (int i = 0; i < NUMBER_OF_TOPICS; i++)
+    {
+        TopicDesc topicDescriptor;
+        memcpy_P(&topicDescriptor, &_topicDescriptors[i], sizeof(TopicDesc));
+
+        if (!_decodeAllTopics && !isTopicDataChanged(topicDescriptor, changedBytes))
+            continue;
+
+        // Round to the topic's resolution, so values are the same as presented.
+        // This way, a topic only changes if its presented value changes.
+        float scale = DecimalScales[topicDescriptor.decimals];
+        float value = roundf(decodeTopic(topicDescriptor) * scale) / scale;
+        if (_decodeAllTopics || (value != _topicValues.values[i]))
+        {
+            _topicValues.values[i] = value;
+            _changedTopics.set(i);
+        }
+    }
+
+    _decodeAllTopics = false;
+}
+
+
+bool Aquarea::onTopicsChanged(const TopicSet& topics, TopicsChangedHandler handler)
+{
+    if (_numSubscriptions == AQUAREA_MAX_SUBSCRIPTIONS)
+        return false;
+
+    Subscription& subscription = _subscriptions[_numSubscriptions++];
+    subscription.topics = topics;
+    subscription.handler = handler;
+    return true;
+}
+
+
+void Aquarea::notifySubscribers()
+{
+    if (_changedTopics.none())
+        return;
+
+    for (int i = 0; i < _numSubscriptions; i++)
+    {
+        if ((_subscriptions[i].topics & _changedTopics).any())
+            _subscriptions[i].handler(_changedTopics);
+    }
+}
+
+
 Topic Aquarea::getTopic(TopicId id)
 {
     TopicDesc topicDescriptor;
     memcpy_P(&topicDescriptor, &_topicDescriptors[static_cast<int>(id)], sizeof(TopicDesc));
 
-    String topicValue = topicDescriptor.conversion(_data + topicDescriptor.index);
-
-    return Topic(id, topicValue, topicDescriptor);
+    return Topic(id, _topicValues.get(id), topicDescriptor);
 }
 
 
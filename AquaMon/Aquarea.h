@@ -1,7 +1,13 @@
 #ifndef AQUAREA_H
 #define AQUAREA_H
 
+#include <bitset>
+#include <initializer_list>
+
 #define DATA_BUFFER_SIZE 256
+#define NUMBER_OF_TOPICS 110
+#define AQUAREA_MAX_SUBSCRIPTIONS 4
+#define AQUAREA_SET_PUMP_RETRIES 2
 
 enum struct TopicId
 {
@@ -113,14 +119,37 @@ enum struct TopicId
     Solar_High_Limit = 105,
     Solar_DeltaT = 106,
     Compressor_Power = 107,
-    Heat_Power = 108
+    Heat_Power = 108,
+    EEV = 109
 };
 
 
-struct __attribute__ ((packed)) PacketHeader
+// Conversion of the packet data at a topic's index to a numeric value
+enum struct TopicDecoder : uint8_t
 {
-    uint8_t magic;
-    uint8_t dataSize;
+    Bit1and2,
+    Bit3and4,
+    Bit5and6,
+    Bit7and8,
+    Bit3and4and5,
+    Right3bits,
+    IntMinus1,
+    IntMinus128,
+    IntMinus1Div5,
+    IntMinus1Times10,
+    IntMinus1Times50,
+    Word,
+    PumpFlow,
+    OpMode,
+    InletTemp,
+    OutletTemp,
+    Zone1Temp,
+    Energy,
+    SolarDeltaT,
+    Power,
+    HeatPower,
+    Error,
+    Model
 };
 
 
@@ -128,15 +157,69 @@ struct TopicDesc
 {
     PGM_P name;
     uint8_t index;
-    String (*conversion)(uint8_t*);
+    TopicDecoder decoder;
+    uint8_t decimals;
     PGM_P* descriptionMapping;
 };
 
 
+// Decoded values of all topics in the last packet (see Aquarea::receive)
+struct TopicValues
+{
+    float values[NUMBER_OF_TOPICS];
+
+    float inline get(TopicId id) const
+    {
+        return values[static_cast<int>(id)];
+    }
+};
+
+
+// Commands sent to the heat pump; in order of priority (highest first).
+enum struct CommandId : uint8_t
+{
+    SetPump = 0,
+    Query,
+    _EndMarker
+};
+
+#define NUMBER_OF_COMMANDS static_cast<int>(CommandId::_EndMarker)
+
+struct CommandStats
+{
+    uint32_t sent;
+    uint32_t coalesced; // Queued while the same command was already queued
+    uint32_t timeouts;
+    uint32_t retries;
+    uint32_t failures; // Not sent or (for Set pump) no response after the retries
+    uint32_t lastLatency; // ms from queued until the response is received
+    uint32_t maxLatency;
+};
+
+
+// Set of topics, indexed by TopicId
+typedef std::bitset<NUMBER_OF_TOPICS> TopicSet;
+
+inline TopicSet makeTopicSet(std::initializer_list<TopicId> topicIds)
+{
+    TopicSet result;
+    for (TopicId id : topicIds)
+        result.set(static_cast<int>(id));
+    return result;
+}
+
+// Called after a packet is received in which any of the subscribed topics changed.
+typedef void (*TopicsChangedHandler)(const TopicSet& changedTopics);
+
+// Called when a command could not be sent or (for Set pump) got no response after the retries.
+typedef void (*CommandFailedHandler)(CommandId id, const char* error);
+
+
+// Topic value with its descriptor, for presentation purposes
 class Topic
 {
     public:
-        Topic(TopicId topicId, String& value, TopicDesc& descriptor)
+        Topic(TopicId topicId, float value, const TopicDesc& descriptor)
             : _topicId(topicId), _value(value), _descriptor(descriptor)  {}
 
         TopicId inline getTopicId()
@@ -144,18 +227,28 @@ class Topic
             return _topicId;
         }
 
-        String inline getValue()
+        float inline getNumericValue()
         {
             return _value;
         }
 
+        String getValue();
         String getId();
+
+        // Formats the value like getValue, without allocating a String.
+        void formatValue(char* buffer, size_t bufferSize);
+
+        inline PGM_P getNameP()
+        {
+            return _descriptor.name;
+        }
+
         String getName();
         String getDescription();
 
     private:
         TopicId _topicId;
-        String _value;
+        float _value;
         TopicDesc _descriptor;
 };
 
@@ -168,14 +261,28 @@ class Aquarea
 
         void setZone1Offset(float offset)
         {
-            _zone1Offset = offset;
+            if (offset != _zone1Offset)
+            {
+                _zone1Offset = offset;
+                _decodeAllTopics = true;
+            }
         }
 
-        String inline getLastError()
+        const char* getLastError()
         {
             return _lastError;
         }
 
+        bool isReceiving()
+        {
+            return _state != ReceiveState::Idle;
+        }
+
+        bool isPacketValid()
+        {
+            return _isPacketValid;
+        }
+
         uint32_t inline getValidPackets()
         {
             return _validPackets;
@@ -196,37 +303,146 @@ class Aquarea
             return float(_invalidPackets) / (_validPackets + _invalidPackets);
         }
 
+        const TopicValues& getTopicValues()
+        {
+            return _topicValues;
+        }
+
+        float inline getTopicValue(TopicId id)
+        {
+            return _topicValues.get(id);
+        }
+
+        // Returns the topics which changed value in the last packet (all topics for the first packet).
+        const TopicSet& getChangedTopics()
+        {
+            return _changedTopics;
+        }
+
+        bool inline isTopicChanged(TopicId id)
+        {
+            return _changedTopics.test(static_cast<int>(id));
+        }
+
+        // Registers a handler which is called when any of the given topics changed.
+        // Returns false if there are already AQUAREA_MAX_SUBSCRIPTIONS handlers.
+        bool onTopicsChanged(const TopicSet& topics, TopicsChangedHandler handler);
+
         static std::vector<TopicId> getAllTopicIds();
 
         Topic getTopic(TopicId id);
 
         bool begin();
-        bool sendQuery();
-        bool setPump(bool pumpOn);
-        bool readPacket();
+
+        // Commands are queued and sent by receive(), one at a time: the next command is sent
+        // when the response to the previous one is received (or timed out) and the bus has been quiet for a while.
+        // A command which is already queued is not queued again; for setPump the last value wins.
+        // Queued commands are sent in order of priority (see CommandId).
+        // A Set pump command without response is retried (AQUAREA_SET_PUMP_RETRIES); Query is sent periodically anyway.
+        void sendQuery();
+        void setPump(bool pumpOn);
+
+        // The pump state of the last setPump call
+        bool isPumpOnRequested()
+        {
+            return _pumpOn;
+        }
+
+        void onCommandFailed(CommandFailedHandler handler)
+        {
+            _commandFailedHandler = handler;
+        }
+
+        bool isCommandQueued(CommandId id)
+        {
+            return _queuedCommands & (1 << static_cast<int>(id));
+        }
+
+        const CommandStats& getCommandStats(CommandId id)
+        {
+            return _commandStats[static_cast<int>(id)];
+        }
+
+        static const char* getCommandName(CommandId id);
+
+        // Receives the bytes available on Serial, without waiting for more, and sends the next queued command.
+        // Returns true if a packet has been received completely or has been rejected (see isPacketValid and getLastError).
+        bool receive();
+
         void writeHexDump(Print& printTo, bool unknownData);
+
+        // Writes the last valid packet as a capture line: "<time> <packet bytes in hex>".
+        // A file with such lines can be replayed on the host (see HostBench/replay).
+        void writeCaptureLine(Print& printTo, time_t time);
         void resetPacketStats();
 
     private:
-        uint8_t _data[DATA_BUFFER_SIZE];
-        uint8_t _invalidData[DATA_BUFFER_SIZE];
+        enum class ReceiveState : uint8_t
+        {
+            Idle,
+            Receiving,
+            TestCommand,
+            TestHexData,
+            TestTopicValue
+        };
+
+        struct Subscription
+        {
+            TopicSet topics;
+            TopicsChangedHandler handler;
+        };
+
+        uint8_t _data[DATA_BUFFER_SIZE] __attribute__((aligned(4)));
+        uint32_t _previousData[DATA_BUFFER_SIZE / 4]; // The packet data decoded before, for word-wide compares
+        uint8_t _invalidData[DATA_BUFFER_SIZE]; // Receive buffer; contains the last invalid packet after it has been rejected
+        ReceiveState _state = ReceiveState::Idle;
+        size_t _receivedLength = 0;
+        uint8_t _windowSum;
+        uint32_t _lastReceiveMillis = 0;
+        bool _isPacketValid = false;
+        char _testLine[48];
+        size_t _testLineLength;
+        TopicValues _topicValues;
+        TopicSet _changedTopics;
+        bool _decodeAllTopics = true;
+        Subscription _subscriptions[AQUAREA_MAX_SUBSCRIPTIONS];
+        int _numSubscriptions = 0;
         uint32_t _validPackets = 0;
         uint32_t _repairedPackets = 0;
         uint32_t _invalidPackets = 0;
-        String _lastError;
+        char _lastError[64];
+        uint8_t _queuedCommands = 0; // Bit per CommandId
+        uint32_t _commandQueuedMillis[NUMBER_OF_COMMANDS];
+        CommandStats _commandStats[NUMBER_OF_COMMANDS];
+        bool _pumpOn = false;
+        uint8_t _setPumpFailures = 0;
+        CommandFailedHandler _commandFailedHandler = nullptr;
+        bool _awaitingResponse = false;
+        CommandId _sentCommand = CommandId::Query;
         uint32_t _commandSentMillis = 0;
+        uint32_t _lastResponseMillis = 0;
         bool _debugOutputOnSerial = false;
         static float _zone1Offset;
 
         static TopicDesc getTopicDescriptor(TopicId topicId);
         static uint8_t checkSum(uint8_t magic, uint8_t dataSize, uint8_t* dataPtr);
-        bool validateCheckSum();
+        void decodeTopics();
+        bool isTopicDataChanged(const TopicDesc& descriptor, const uint32_t* changedBytes);
+        void notifySubscribers();
+        float decodeTopic(const TopicDesc& descriptor);
+        void queueCommand(CommandId id);
+        void sendQueuedCommand();
         bool sendCommand(uint8_t magic, uint8_t dataSize, uint8_t* dataPtr);
-        int readTestData(PacketHeader& header);
-        bool setTopicValue();
-        static size_t readBytes(uint8_t* bufferPtr, size_t count);
-        static size_t readHexBytes(uint8_t* bufferPtr, size_t count);
-        friend String getZone1Temp(uint8_t*);
+        void completeCommand();
+        void failCommand(CommandId id, const char* error);
+        void setLastError(const char* format, ...);
+        void startReceiving();
+        bool receiveByte(uint8_t byte);
+        bool repairPacket();
+        bool completePacket(bool repaired);
+        bool rejectPacket();
+        bool receiveTestByte(char c);
+        bool setTopicValue(char* assignment);
 };
 
 #endif
\ No newline at end of file
@@ -14,13 +14,21 @@ struct __attribute__ ((packed)) PersistentDataStruct : PersistentDataBase
     bool logPacketErrors;
     float zone1Offset;
     char otgwHost[32];
-
+    char mqttBroker[32];
+    char mqttUser[32];
+    char mqttPassword[32];
+    uint16_t mqttInterval;
 
     bool inline ftpIsEnabled()
     {
         return ftpSyncEntries > 0;
     }
 
+    bool inline mqttIsEnabled()
+    {
+        return mqttBroker[0] != 0;
+    }
+
     PersistentDataStruct() : PersistentDataBase(
         sizeof(wifiSSID) +
         sizeof(wifiKey) +  
@@ -33,7 +41,11 @@ struct __attribute__ ((packed)) PersistentDataStruct : PersistentDataBase
         sizeof(antiFreezeTemp) +
         sizeof(logPacketErrors) + 
         sizeof(zone1Offset) +
-        sizeof(otgwHost)
+        sizeof(otgwHost) +
+        sizeof(mqttBroker) +
+        sizeof(mqttUser) +
+        sizeof(mqttPassword) +
+        sizeof(mqttInterval)
         ) {}
 
     virtual void initialize()
@@ -50,6 +62,10 @@ struct __attribute__ ((packed)) PersistentDataStruct : PersistentDataBase
         logPacketErrors = false;
         zone1Offset = 0;
         otgwHost[0] = 0;
+        mqttBroker[0] = 0;
+        mqttUser[0] = 0;
+        mqttPassword[0] = 0;
+        mqttInterval = 60;
     }
 
     virtual void validate()
@@ -63,10 +79,32 @@ struct __attribute__ ((packed)) PersistentDataStruct : PersistentDataBase
         ftpUser[sizeof(ftpUser) - 1] = 0;
         ftpPassword[sizeof(ftpPassword) - 1] = 0;
         otgwHost[sizeof(otgwHost) - 1] = 0;
+        mqttBroker[sizeof(mqttBroker) - 1] = 0;
+        mqttUser[sizeof(mqttUser) - 1] = 0;
+        mqttPassword[sizeof(mqttPassword) - 1] = 0;
+
+        // The MQTT settings were added later; after an upgrade they contain uninitialized EEPROM.
+        clearIfNotPrintable(mqttBroker);
+        clearIfNotPrintable(mqttUser);
+        clearIfNotPrintable(mqttPassword);
 
         ftpSyncEntries = std::min(ftpSyncEntries, (uint16_t)250);
         antiFreezeTemp = std::min(antiFreezeTemp, (uint16_t)10);
         zone1Offset = std::max(std::min(zone1Offset, 5.0F), -5.0F);
+        mqttInterval = std::min(mqttInterval, (uint16_t)3600);
+    }
+
+    template<size_t size>
+    static void clearIfNotPrintable(char (&str)[size])
+    {
+        for (size_t i = 0; (i < size) && (str[i] != 0); i++)
+        {
+            if (!isprint(static_cast<uint8_t>(str[i])))
+            {
+                str[0] = 0;
+                return;
+            }
+        }
     }
 };
 
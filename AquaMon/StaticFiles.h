@@ -0,0 +1,639 @@
+// Generated by tools/embed_static_files.py from data/; do not edit.
+#ifndef STATIC_FILES_H
+#define STATIC_FILES_H
+
+#include <StaticFile.h>
+
+// Binary.svg: 739 bytes, 362 bytes gzipped
+static const char Binary_svg_Path[] PROGMEM = "/Binary.svg";
+static const char Binary_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Binary_svg_ETag[] PROGMEM = "\"38cb53c0daca1e7b\"";
+static const uint8_t Binary_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x92, 0x4F, 0x6F, 0x82, 0x40,
+    0x10, 0xC5, 0xEF, 0xFD, 0x14, 0xD3, 0xED, 0x75, 0x56, 0x76, 0x59, 0x44, 0x6A, 0x44, 0x63, 0x0F,
+    0xF5, 0xC4, 0xA5, 0x7F, 0x38, 0x70, 0x23, 0xB2, 0x0A, 0x09, 0xB0, 0x04, 0x28, 0xF8, 0xF1, 0x3B,
+    0xD2, 0x46, 0x50, 0x9B, 0x94, 0xE1, 0xF2, 0xE0, 0xF7, 0xDE, 0xBC, 0x2C, 0xAC, 0x36, 0xA7, 0x22,
+    0x87, 0x4E, 0xD7, 0x4D, 0x66, 0x4A, 0x9F, 0xC9, 0x99, 0x60, 0xA0, 0xCB, 0xBD, 0x49, 0xB2, 0xF2,
+    0xE8, 0xB3, 0xAF, 0xF6, 0xC0, 0x3D, 0xB6, 0x59, 0x3F, 0xAC, 0x1E, 0x39, 0x87, 0xCF, 0x2A, 0x37,
+    0x71, 0xA2, 0x13, 0x68, 0xCD, 0x12, 0xDE, 0xC3, 0x1D, 0xBC, 0xE9, 0xCA, 0x20, 0xF4, 0x7D, 0x3F,
+    0x6B, 0xBA, 0x63, 0x4D, 0x62, 0xB6, 0x37, 0x05, 0xC2, 0x4E, 0x97, 0xBA, 0x8E, 0x5B, 0x53, 0x8F,
+    0x14, 0x04, 0xD9, 0x49, 0xD7, 0xF0, 0x61, 0x4C, 0xDE, 0x00, 0xE7, 0x14, 0x48, 0x0E, 0x38, 0x64,
+    0x79, 0xEE, 0xB3, 0xA7, 0xD7, 0xE1, 0x62, 0xD0, 0x67, 0x49, 0x9B, 0xFA, 0xCC, 0x13, 0xA2, 0x3A,
+    0x31, 0x48, 0x75, 0x76, 0x4C, 0xDB, 0x8B, 0xEC, 0x32, 0xDD, 0xBF, 0x98, 0x93, 0xCF, 0x04, 0x08,
+    0xB0, 0x1D, 0xBA, 0x19, 0x50, 0xF5, 0xB2, 0xF1, 0x59, 0xDA, 0xB6, 0xD5, 0xD2, 0xB2, 0xCE, 0x3D,
+    0x7A, 0x35, 0x33, 0xF5, 0xD1, 0xB2, 0x85, 0x10, 0x16, 0x6D, 0x60, 0xB4, 0xA8, 0x8A, 0xDB, 0x14,
+    0x12, 0x9F, 0x05, 0x0E, 0x4A, 0xB9, 0x55, 0xA8, 0x50, 0x0C, 0xB3, 0x40, 0x2F, 0x74, 0x27, 0x5A,
+    0xA2, 0x1B, 0x7A, 0x13, 0x7D, 0xC6, 0xA3, 0x40, 0xA1, 0xBB, 0x95, 0xF4, 0xEE, 0x87, 0x98, 0x0F,
+    0xCC, 0xA8, 0x15, 0x7A, 0x51, 0x20, 0x9F, 0xD1, 0x8D, 0x2F, 0x3E, 0xEE, 0xA2, 0x08, 0xBD, 0x51,
+    0x23, 0x69, 0x62, 0x68, 0x5B, 0x7C, 0xF1, 0x71, 0x9B, 0x18, 0x77, 0xD4, 0x48, 0x3A, 0x2A, 0xF8,
+    0x02, 0xD5, 0x84, 0xA1, 0x09, 0x9D, 0x6B, 0xA6, 0x9B, 0x76, 0x91, 0x62, 0x28, 0x68, 0x2B, 0x74,
+    0x3A, 0xF7, 0x26, 0xFB, 0xC6, 0x17, 0x05, 0x0B, 0x94, 0x5E, 0x28, 0x6F, 0x6A, 0x76, 0xF6, 0x6D,
+    0x4D, 0xF5, 0x8B, 0x5D, 0x6F, 0xB5, 0xAF, 0xD3, 0xA3, 0x82, 0xD8, 0x6B, 0xE7, 0x5D, 0x74, 0x54,
+    0xD8, 0xDC, 0xFE, 0x2F, 0x46, 0x12, 0x73, 0x57, 0x5D, 0x3A, 0x77, 0xE7, 0x32, 0xE7, 0x72, 0xF2,
+    0x8C, 0xE6, 0x0F, 0xD3, 0xF4, 0x60, 0x3C, 0x94, 0x2A, 0x62, 0x16, 0x7D, 0xFB, 0xF3, 0x3F, 0xB0,
+    0xFE, 0x06, 0x92, 0x3A, 0xB2, 0x80, 0xE3, 0x02, 0x00, 0x00,
+};
+
+// Graph.svg: 493 bytes, 302 bytes gzipped
+static const char Graph_svg_Path[] PROGMEM = "/Graph.svg";
+static const char Graph_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Graph_svg_ETag[] PROGMEM = "\"03a7c9b308f8d649\"";
+static const uint8_t Graph_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x90, 0xCB, 0x6E, 0xC2, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xE9, 0x74, 0x4B, 0x1C, 0x3B, 0x71, 0x44, 0x82, 0x30, 0x48, 0xAD,
+    0x54, 0xBA, 0x80, 0x4D, 0x1F, 0xEC, 0x23, 0x62, 0x12, 0xB7, 0xC1, 0x13, 0x39, 0x86, 0xE4, 0xF3,
+    0x6B, 0x50, 0x4B, 0xDB, 0x0F, 0xE8, 0x95, 0x65, 0x69, 0x8E, 0x6D, 0xDD, 0x23, 0xCF, 0x97, 0xE3,
+    0xA1, 0x85, 0x93, 0x76, 0xBD, 0x21, 0xAB, 0x50, 0x30, 0x8E, 0xA0, 0xED, 0x8E, 0x2A, 0x63, 0x6B,
+    0x85, 0x47, 0xBF, 0x8F, 0x72, 0x5C, 0x2E, 0xE6, 0xB7, 0x51, 0x04, 0x6F, 0x5D, 0x4B, 0x65, 0xA5,
+    0x2B, 0xF0, 0x34, 0x83, 0x97, 0xED, 0x0A, 0x9E, 0x75, 0x47, 0x13, 0x18, 0x86, 0x81, 0xF5, 0xA7,
+    0xDA, 0x85, 0x81, 0xED, 0xE8, 0x30, 0x81, 0x95, 0xB6, 0xDA, 0x95, 0x9E, 0xDC, 0xCF, 0x2D, 0xD8,
+    0x98, 0x51, 0x3B, 0x78, 0x25, 0x6A, 0x7B, 0x88, 0xA2, 0xC5, 0xCD, 0x3C, 0xBC, 0x80, 0xC1, 0x54,
+    0xBE, 0x51, 0x98, 0x73, 0xDE, 0x8D, 0x08, 0x8D, 0x36, 0x75, 0xE3, 0xAF, 0xE3, 0xC9, 0xE8, 0xE1,
+    0x9E, 0x46, 0x85, 0x1C, 0x38, 0x24, 0x32, 0x2C, 0x84, 0xBD, 0x69, 0x5B, 0x85, 0x77, 0xFC, 0x12,
+    0x84, 0x60, 0x6E, 0x7B, 0x85, 0x8D, 0xF7, 0xDD, 0x2C, 0x8E, 0xCF, 0x1E, 0x43, 0xCA, 0xC8, 0xD5,
+    0x71, 0x12, 0x8E, 0xE3, 0xD0, 0x80, 0xA1, 0xA8, 0x2B, 0x7D, 0x03, 0x95, 0xC2, 0x8D, 0x84, 0x6C,
+    0x2B, 0x8A, 0x07, 0x09, 0xA2, 0x60, 0x59, 0x96, 0xA4, 0x20, 0x99, 0x94, 0xD3, 0x69, 0x02, 0x09,
+    0x87, 0x2C, 0x6C, 0x4F, 0xA2, 0x40, 0xE8, 0xBD, 0xA3, 0x0F, 0x1D, 0x3A, 0x1E, 0x2F, 0xF9, 0x06,
+    0xD1, 0x97, 0x6A, 0x72, 0x05, 0xAD, 0xB1, 0x7A, 0x57, 0x76, 0x0A, 0x1D, 0x1D, 0x6D, 0xF5, 0x07,
+    0xBF, 0x93, 0xB1, 0xDF, 0x3C, 0xFE, 0x6D, 0x20, 0x72, 0x28, 0xD6, 0x22, 0x05, 0x91, 0xB2, 0x22,
+    0x64, 0x2D, 0x38, 0xCB, 0x40, 0x08, 0x26, 0x8B, 0x22, 0x5F, 0x4F, 0x41, 0xC8, 0x33, 0xCE, 0xFF,
+    0x47, 0xE2, 0xFC, 0x1D, 0x8B, 0x4F, 0x9B, 0x87, 0x3D, 0xE7, 0xED, 0x01, 0x00, 0x00,
+};
+
+// Home.svg: 1891 bytes, 864 bytes gzipped
+static const char Home_svg_Path[] PROGMEM = "/Home.svg";
+static const char Home_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Home_svg_ETag[] PROGMEM = "\"7fcea6beaa9c719f\"";
+static const uint8_t Home_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x65, 0x55, 0x4D, 0x6F, 0x23, 0x37,
+    0x0C, 0xBD, 0xF7, 0x57, 0xA8, 0xD3, 0xEB, 0x5A, 0xA6, 0x24, 0xEA, 0x83, 0x8B, 0x38, 0x0B, 0x74,
+    0x80, 0x6E, 0x0E, 0xD9, 0x4B, 0x3F, 0x72, 0xE8, 0x2D, 0x58, 0x7B, 0x63, 0x03, 0x5E, 0x8F, 0xE1,
+    0xB8, 0x71, 0x7E, 0x7E, 0x49, 0x4A, 0xF2, 0x6C, 0xDD, 0x20, 0xF0, 0xE8, 0x49, 0x24, 0xDF, 0x1B,
+    0xF2, 0xC9, 0xBE, 0xFB, 0xF4, 0xFE, 0x7D, 0x6F, 0xDE, 0x36, 0xA7, 0xD7, 0xDD, 0x74, 0x58, 0x0D,
+    0xCE, 0xC2, 0x60, 0x36, 0x87, 0xAF, 0xD3, 0x7A, 0x77, 0x78, 0x59, 0x0D, 0xFF, 0x9C, 0xBF, 0x2D,
+    0xCA, 0xF0, 0xE9, 0xFE, 0xEE, 0xE7, 0xC5, 0xC2, 0xFC, 0x75, 0xDC, 0x4F, 0xCF, 0xEB, 0xCD, 0xDA,
+    0x9C, 0xA7, 0x8F, 0xE6, 0x8F, 0xA7, 0xCF, 0xE6, 0xF7, 0xCD, 0x71, 0xFA, 0x60, 0x2E, 0x97, 0x8B,
+    0x7D, 0x7D, 0x7B, 0x39, 0x31, 0xB0, 0x5F, 0xA7, 0xEF, 0x1F, 0xCC, 0xE7, 0xCD, 0x61, 0x73, 0x7A,
+    0x3E, 0x4F, 0xA7, 0x39, 0xCA, 0x7C, 0xD9, 0xBD, 0x6F, 0x4E, 0xE6, 0xCF, 0x69, 0xDA, 0xBF, 0x9A,
+    0xC5, 0xE2, 0xFE, 0xA7, 0x3B, 0xCE, 0x30, 0x97, 0xDD, 0xFA, 0xBC, 0x5D, 0x0D, 0x05, 0xE0, 0xF8,
+    0x3E, 0x98, 0xED, 0x66, 0xF7, 0xB2, 0x3D, 0x5F, 0xE1, 0xDB, 0x6E, 0x73, 0xF9, 0x75, 0x7A, 0x5F,
+    0x0D, 0x60, 0xC0, 0x78, 0xE4, 0xFF, 0xC1, 0x7C, 0xDB, 0xED, 0xF7, 0xAB, 0xE1, 0x97, 0xDF, 0xF4,
+    0x6F, 0x30, 0xAC, 0xFC, 0xF0, 0xBA, 0x1A, 0xB6, 0xE7, 0xF3, 0xF1, 0xE3, 0x72, 0x29, 0x3A, 0x2E,
+    0xC1, 0x4E, 0xA7, 0x97, 0xA5, 0x07, 0x80, 0x25, 0x33, 0x0C, 0x4C, 0x74, 0x7C, 0x3E, 0x6F, 0xCD,
+    0x7A, 0x35, 0x7C, 0xF1, 0x60, 0x9C, 0xB3, 0x39, 0x8E, 0x8E, 0x6C, 0x09, 0x39, 0x55, 0x04, 0xD9,
+    0x30, 0x4E, 0x99, 0xA2, 0xE0, 0x44, 0x45, 0x60, 0xAC, 0xE0, 0xD1, 0x79, 0x13, 0x2D, 0xE1, 0x23,
+    0x5A, 0xAC, 0x3B, 0x23, 0x5A, 0x4F, 0x50, 0xB2, 0xE6, 0x3A, 0x0A, 0x06, 0x2D, 0x30, 0xD6, 0xC3,
+    0x9C, 0x21, 0x99, 0x60, 0x0B, 0x05, 0x42, 0xC5, 0xE8, 0xE3, 0x18, 0xB8, 0x64, 0x06, 0x5F, 0xE3,
+    0x31, 0xF0, 0x79, 0xE4, 0xB4, 0x5A, 0x0C, 0xC8, 0x31, 0xD6, 0x58, 0x94, 0x48, 0x5F, 0x20, 0xA9,
+    0x2A, 0xA6, 0x20, 0x3E, 0xF1, 0x9E, 0xD0, 0x09, 0x16, 0x0A, 0xC1, 0x31, 0x47, 0x8E, 0x06, 0xA5,
+    0xD0, 0xF8, 0x98, 0xB2, 0x60, 0xA6, 0xE0, 0xE3, 0x50, 0x85, 0x81, 0x32, 0x08, 0x51, 0x14, 0x80,
+    0x8F, 0x5C, 0x80, 0x97, 0xFC, 0x0A, 0xA3, 0x90, 0x66, 0x7E, 0x43, 0xB4, 0x01, 0x7C, 0x0A, 0x52,
+    0x9A, 0x1B, 0x91, 0x19, 0x7B, 0x8E, 0xF5, 0xFA, 0x1C, 0x9D, 0xB7, 0x2E, 0xF9, 0xD0, 0x37, 0x6D,
+    0xF0, 0xE0, 0xE7, 0x0C, 0x2F, 0x9D, 0xE0, 0x5A, 0x8F, 0x1E, 0xB4, 0x27, 0xFC, 0x39, 0xF2, 0x32,
+    0x52, 0xF4, 0x95, 0x3A, 0x93, 0xF1, 0xA2, 0xC8, 0x39, 0x55, 0x56, 0xA2, 0xE2, 0xEC, 0x0A, 0xA9,
+    0xF2, 0x0C, 0x24, 0xF1, 0x19, 0xEB, 0x9B, 0x42, 0x6C, 0xE7, 0x80, 0xDA, 0x23, 0x8F, 0x98, 0x34,
+    0x5F, 0x9B, 0xA2, 0x95, 0x43, 0x15, 0x1A, 0x21, 0xC8, 0x01, 0x62, 0xD1, 0xC0, 0x58, 0x4A, 0x11,
+    0x1C, 0x30, 0x68, 0x6C, 0x42, 0x2A, 0x12, 0xEE, 0x03, 0xD5, 0x5E, 0x83, 0x1E, 0x3B, 0xEF, 0xEA,
+    0x28, 0x58, 0x5E, 0x9F, 0xFF, 0xDF, 0x83, 0x59, 0xFE, 0xE8, 0x0B, 0xA7, 0x23, 0xCF, 0xF1, 0x21,
+    0x8D, 0xD1, 0x16, 0x50, 0xA5, 0x8C, 0x31, 0x23, 0x0F, 0x3F, 0x39, 0x7D, 0x6D, 0x76, 0x48, 0x62,
+    0xC7, 0x44, 0x8B, 0xD9, 0x47, 0xC5, 0xD1, 0xB3, 0x93, 0xA2, 0x0D, 0x81, 0x25, 0x0B, 0x0E, 0x45,
+    0xE3, 0x7D, 0xF4, 0x51, 0xF3, 0x1D, 0x15, 0xA7, 0x98, 0xC1, 0x13, 0x87, 0x8F, 0xBA, 0xE6, 0x38,
+    0x70, 0x3C, 0x5C, 0x4E, 0xE4, 0x21, 0x7B, 0xC6, 0xCE, 0x41, 0x10, 0x97, 0x61, 0x22, 0x1E, 0x66,
+    0xB1, 0x24, 0xCF, 0x51, 0x88, 0x65, 0xBF, 0xD8, 0xA2, 0x71, 0x2A, 0x8C, 0xF3, 0x0A, 0xEB, 0x34,
+    0x49, 0x1F, 0x63, 0x12, 0x0E, 0xB6, 0x50, 0xDD, 0x63, 0x01, 0x94, 0xCA, 0x35, 0x21, 0x71, 0xE3,
+    0x20, 0x84, 0x6B, 0xC1, 0xC4, 0x93, 0x07, 0x1E, 0x7D, 0x27, 0x4C, 0x92, 0xD4, 0xD5, 0x34, 0x10,
+    0x9F, 0x5C, 0x61, 0x91, 0x0F, 0x2E, 0xF3, 0xA7, 0x6A, 0xD6, 0xD5, 0x35, 0x8C, 0x11, 0xAB, 0xBE,
+    0x96, 0x60, 0x88, 0xE2, 0xBC, 0x4E, 0xC1, 0x58, 0x44, 0x5F, 0x25, 0x30, 0x66, 0xD1, 0x4D, 0x9F,
+    0x2B, 0x55, 0x34, 0x33, 0x88, 0xEA, 0xBE, 0x29, 0xAA, 0xF3, 0x9C, 0x51, 0x54, 0xF5, 0x5C, 0xB1,
+    0xB0, 0x6A, 0x37, 0x13, 0x96, 0x1F, 0x45, 0x77, 0xC4, 0xAA, 0x49, 0x22, 0x75, 0x60, 0xBD, 0xF1,
+    0x92, 0x29, 0x03, 0xEB, 0x83, 0x91, 0xCA, 0x5E, 0x18, 0xDB, 0xE0, 0x94, 0xB9, 0xC6, 0xD7, 0xB8,
+    0xD2, 0xF2, 0xDA, 0xE0, 0xBB, 0x27, 0xFE, 0xE7, 0x15, 0xAC, 0xFB, 0xA3, 0x0B, 0xF2, 0x72, 0xB3,
+    0x53, 0x18, 0x8B, 0x55, 0xE6, 0x82, 0x41, 0xAD, 0x32, 0x13, 0x06, 0xB5, 0xCA, 0x2C, 0x48, 0xAE,
+    0x73, 0x8D, 0xAF, 0xC4, 0xA1, 0x59, 0x85, 0x6F, 0x18, 0x5B, 0x91, 0xAF, 0x4A, 0xAE, 0x2F, 0x06,
+    0xB6, 0xCA, 0xD6, 0xAE, 0xC9, 0x8D, 0xCA, 0xAE, 0x16, 0xA1, 0x7A, 0xD7, 0xA5, 0x5F, 0x42, 0xC2,
+    0x4F, 0x09, 0xAE, 0xFB, 0x54, 0xC3, 0xA0, 0x65, 0x91, 0xD6, 0x80, 0x26, 0x9D, 0x9A, 0x97, 0xEA,
+    0x36, 0x35, 0xA7, 0xB5, 0x1C, 0x6A, 0x46, 0xEC, 0x25, 0xA9, 0x19, 0xB5, 0x53, 0x52, 0x95, 0x59,
+    0x0B, 0xD3, 0x55, 0xF3, 0x48, 0xDD, 0xF9, 0xAE, 0xF6, 0x85, 0xFA, 0xCD, 0x70, 0xB5, 0x2F, 0xD4,
+    0x6F, 0x8E, 0xD3, 0xC5, 0x48, 0xFD, 0x66, 0xB9, 0xDA, 0x17, 0xEA, 0x37, 0xCF, 0xB5, 0xBE, 0x40,
+    0x5D, 0x3E, 0x38, 0xFE, 0xDA, 0xC2, 0xD6, 0xA3, 0x7E, 0x86, 0xAD, 0x87, 0x2D, 0x97, 0x71, 0x1D,
+    0x6E, 0xAB, 0xCD, 0xB8, 0xCE, 0xA0, 0x71, 0x33, 0xAE, 0x33, 0x6A, 0xDA, 0x04, 0xCB, 0x57, 0x9B,
+    0xF6, 0x17, 0x6F, 0x8C, 0x83, 0x37, 0xC6, 0xC1, 0x1B, 0xE3, 0xE0, 0x8D, 0x71, 0xF0, 0xC6, 0x38,
+    0xF8, 0x1F, 0xE3, 0xC8, 0x8F, 0xD0, 0xFD, 0xBF, 0x00, 0x20, 0x89, 0x5E, 0x63, 0x07, 0x00, 0x00,
+};
+
+// List.svg: 509 bytes, 332 bytes gzipped
+static const char List_svg_Path[] PROGMEM = "/List.svg";
+static const char List_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char List_svg_ETag[] PROGMEM = "\"d7b9730b1f1ac658\"";
+static const uint8_t List_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x65, 0x50, 0x4D, 0x6F, 0xC2, 0x30,
+    0x0C, 0xBD, 0xF3, 0x2B, 0x3C, 0xEF, 0x4A, 0xDB, 0x34, 0xDB, 0xC4, 0x87, 0x08, 0x48, 0x93, 0x36,
+    0x38, 0xC0, 0x65, 0x1B, 0x3D, 0xEC, 0x32, 0x55, 0x4D, 0x68, 0xB3, 0x95, 0xB8, 0x4A, 0x03, 0xED,
+    0xCF, 0x5F, 0x0A, 0x14, 0x34, 0x2D, 0x8A, 0xE2, 0xF7, 0x9E, 0x5F, 0x1C, 0xC7, 0xB3, 0x45, 0xBB,
+    0x2F, 0xE1, 0xA8, 0x6C, 0xAD, 0xC9, 0x08, 0x8C, 0x43, 0x86, 0xA0, 0x4C, 0x46, 0x52, 0x9B, 0x5C,
+    0xE0, 0xC1, 0xED, 0x82, 0x31, 0x2E, 0xE6, 0x83, 0xC1, 0xEC, 0x2E, 0x08, 0x60, 0x5B, 0x95, 0x94,
+    0x4A, 0x25, 0xC1, 0xD1, 0x14, 0xDE, 0x93, 0x25, 0xBC, 0xA9, 0x8A, 0x86, 0xD0, 0x34, 0x4D, 0x58,
+    0x1F, 0x73, 0xEB, 0x49, 0x98, 0xD1, 0x7E, 0x08, 0x4B, 0x65, 0x94, 0x4D, 0x1D, 0xD9, 0x9B, 0x0B,
+    0x36, 0xBA, 0x55, 0x16, 0x3E, 0x88, 0xCA, 0x1A, 0x82, 0x60, 0x3E, 0x98, 0xF9, 0x1B, 0xD0, 0x68,
+    0xE9, 0x0A, 0x81, 0x63, 0xC6, 0xAA, 0x16, 0xA1, 0x50, 0x3A, 0x2F, 0xDC, 0x95, 0x1E, 0xB5, 0x6A,
+    0x9E, 0xA9, 0x15, 0xC8, 0x80, 0x01, 0x7F, 0xF4, 0x1B, 0x61, 0xA7, 0xCB, 0x52, 0xA0, 0x21, 0xA3,
+    0x10, 0x7C, 0xE3, 0xA6, 0x16, 0x58, 0x38, 0x57, 0x4D, 0xA3, 0xA8, 0x6B, 0xA2, 0x79, 0x08, 0xC9,
+    0xE6, 0x11, 0x67, 0x8C, 0x45, 0xBE, 0x3C, 0xFA, 0x57, 0x72, 0xD0, 0x52, 0xE0, 0x8B, 0xD4, 0x0E,
+    0x22, 0x58, 0xEB, 0xDA, 0x7D, 0x6D, 0x0D, 0x59, 0xA9, 0xAC, 0x92, 0x5D, 0xBA, 0x4A, 0x5D, 0x71,
+    0x72, 0x24, 0x2A, 0xF3, 0xFD, 0x22, 0x78, 0xB8, 0x99, 0x40, 0x3C, 0x5A, 0xC5, 0x93, 0x2E, 0xF2,
+    0x73, 0x3C, 0xD1, 0xA7, 0x90, 0xB1, 0x78, 0xF2, 0xE4, 0x93, 0x49, 0x3C, 0xF2, 0x98, 0xAF, 0x3B,
+    0xDC, 0x01, 0xCF, 0x57, 0x97, 0xEC, 0xE7, 0xCD, 0xE6, 0x65, 0xDE, 0xDB, 0xF8, 0xD9, 0xC6, 0xFF,
+    0xDB, 0x46, 0x49, 0x5F, 0x6B, 0x74, 0x56, 0x92, 0x5B, 0x2D, 0x84, 0xDA, 0x59, 0xFA, 0x51, 0x02,
+    0xEF, 0x5F, 0x4F, 0xAB, 0x17, 0x82, 0xCB, 0xE0, 0xF8, 0x55, 0x28, 0xB5, 0x51, 0x59, 0x5A, 0x09,
+    0xB4, 0x74, 0x30, 0xF2, 0x8F, 0xFC, 0x4D, 0xDA, 0xF4, 0x7A, 0xE4, 0xFF, 0x1C, 0xE5, 0xDD, 0xE1,
+    0xE7, 0x33, 0xFF, 0x05, 0x7C, 0xA2, 0xB7, 0x88, 0xFD, 0x01, 0x00, 0x00,
+};
+
+// LogFile.svg: 1064 bytes, 392 bytes gzipped
+static const char LogFile_svg_Path[] PROGMEM = "/LogFile.svg";
+static const char LogFile_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char LogFile_svg_ETag[] PROGMEM = "\"e9ab3d26f6d62e2e\"";
+static const uint8_t LogFile_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x93, 0xCB, 0x4E, 0xC3, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xC1, 0x6C, 0x9B, 0x89, 0x1F, 0x79, 0x56, 0x49, 0x90, 0x58, 0x40,
+    0x37, 0x6C, 0x78, 0x74, 0xC1, 0xA6, 0xAA, 0x1A, 0x37, 0x89, 0x94, 0xC6, 0x51, 0x62, 0x9A, 0xF2,
+    0xF7, 0x38, 0x6D, 0x45, 0x03, 0x12, 0x90, 0x2E, 0xB0, 0x2C, 0x59, 0x33, 0x9A, 0xA3, 0x7B, 0xEF,
+    0x48, 0x8E, 0x6E, 0xF6, 0xDB, 0x12, 0x76, 0xB2, 0x69, 0x0B, 0x55, 0xC5, 0x84, 0x21, 0x25, 0x20,
+    0xAB, 0xB5, 0x4A, 0x8B, 0x2A, 0x8B, 0xC9, 0x9B, 0xDE, 0x58, 0x01, 0xB9, 0x49, 0xA2, 0x2B, 0xCB,
+    0x82, 0x97, 0xBA, 0x54, 0xAB, 0x54, 0xA6, 0xA0, 0xD5, 0x0C, 0x9E, 0x16, 0xF7, 0xF0, 0x28, 0x6B,
+    0x35, 0x85, 0xAE, 0xEB, 0xB0, 0xDD, 0x65, 0x8D, 0x29, 0x70, 0xAD, 0xB6, 0x53, 0xB8, 0x97, 0x95,
+    0x6C, 0x56, 0x5A, 0x35, 0xE7, 0x29, 0x78, 0x28, 0xF6, 0xB2, 0x81, 0x67, 0xA5, 0xCA, 0x16, 0x2C,
+    0x2B, 0x99, 0x44, 0x86, 0x80, 0x4D, 0x51, 0x96, 0x31, 0xB9, 0xBE, 0x3B, 0x1C, 0x02, 0x5D, 0x91,
+    0xEA, 0x3C, 0x26, 0x01, 0xA5, 0xF5, 0x9E, 0x40, 0x2E, 0x8B, 0x2C, 0xD7, 0x9F, 0xE5, 0xAE, 0x90,
+    0xDD, 0xAD, 0xDA, 0xC7, 0x84, 0x02, 0x05, 0xC1, 0xCD, 0x25, 0x60, 0x9C, 0x57, 0x6D, 0x4C, 0x72,
+    0xAD, 0xEB, 0x99, 0x6D, 0xF7, 0x3E, 0x3A, 0x81, 0xAA, 0xC9, 0x6C, 0x4E, 0x29, 0xB5, 0x8D, 0x02,
+    0x31, 0x42, 0xBA, 0xD0, 0xA5, 0x4C, 0x8C, 0x94, 0x5C, 0xEA, 0xF7, 0x5A, 0x2E, 0x4B, 0x95, 0x45,
+    0xF6, 0xB1, 0x39, 0x89, 0xEA, 0x95, 0xCE, 0x21, 0x8D, 0xC9, 0x03, 0x0F, 0xD1, 0x99, 0x72, 0x1F,
+    0xBD, 0x39, 0x47, 0x77, 0xE1, 0xA0, 0x3B, 0xEF, 0x3B, 0xAF, 0x5B, 0x8B, 0xBB, 0x18, 0x5A, 0x6C,
+    0xCE, 0x03, 0x74, 0x16, 0xAE, 0x69, 0x0B, 0x74, 0x5F, 0x89, 0x6D, 0xD0, 0x46, 0xAE, 0x35, 0x18,
+    0x3F, 0x66, 0x9E, 0xC0, 0x7B, 0x4C, 0xDC, 0xFE, 0x3D, 0x45, 0xE0, 0x1E, 0x86, 0xE7, 0x04, 0xAC,
+    0x2F, 0x86, 0x08, 0x63, 0x28, 0x84, 0x38, 0x50, 0xE1, 0x80, 0x0A, 0x90, 0x79, 0xFE, 0x00, 0xFB,
+    0x11, 0x62, 0x1C, 0x69, 0x20, 0x3E, 0x39, 0x76, 0xB0, 0x30, 0x02, 0x73, 0xD0, 0x3F, 0xAB, 0x31,
+    0x8A, 0x1E, 0x1B, 0x27, 0xE7, 0xA3, 0x3B, 0x94, 0x73, 0xC6, 0xFA, 0xE4, 0x74, 0x90, 0x2E, 0xC4,
+    0x40, 0x38, 0xBF, 0x51, 0xC7, 0x35, 0x72, 0xF1, 0x3D, 0xDB, 0x6F, 0x62, 0xEE, 0x89, 0x1A, 0xAE,
+    0xD1, 0x39, 0xEA, 0xFF, 0x41, 0x7C, 0xDB, 0xE1, 0x7F, 0x42, 0x0E, 0x7A, 0x7D, 0x84, 0xCB, 0x20,
+    0x1F, 0xF9, 0xA5, 0x91, 0xBE, 0xAC, 0x7B, 0x24, 0x22, 0x46, 0x04, 0xEA, 0x7F, 0x52, 0xF2, 0x01,
+    0x93, 0x18, 0xC4, 0xA1, 0x28, 0x04, 0x00, 0x00,
+};
+
+// Logo.png: 3361 bytes, 3384 bytes gzipped (stored uncompressed)
+static const char Logo_png_Path[] PROGMEM = "/Logo.png";
+static const char Logo_png_ContentType[] PROGMEM = "image/png";
+static const char Logo_png_ETag[] PROGMEM = "\"69eabb66f314b60b\"";
+static const uint8_t Logo_png_Data[] PROGMEM =
+{
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x08, 0x06, 0x00, 0x00, 0x00, 0xC3, 0x3E, 0x61,
+    0xCB, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
+    0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00,
+    0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0E, 0xC3, 0x00, 0x00, 0x0E, 0xC3, 0x01, 0xC7,
+    0x6F, 0xA8, 0x64, 0x00, 0x00, 0x0C, 0xB6, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x9D, 0x05,
+    0xCC, 0x3C, 0x47, 0x19, 0x87, 0xFF, 0xB8, 0xBB, 0x7B, 0x71, 0x8A, 0x14, 0x0B, 0x81, 0xE0, 0x4E,
+    0x71, 0x0D, 0x16, 0x34, 0xC1, 0x21, 0xB8, 0x6B, 0x80, 0x02, 0x45, 0x83, 0xB5, 0x25, 0xB8, 0x04,
+    0x77, 0xA7, 0x38, 0x14, 0x77, 0x82, 0x43, 0x4A, 0x71, 0x87, 0xE2, 0x14, 0x2B, 0xFC, 0x9E, 0xBB,
+    0x6F, 0x9B, 0xBD, 0xBD, 0x77, 0x77, 0x66, 0x76, 0x67, 0xF6, 0x76, 0xEF, 0xDE, 0x27, 0x79, 0xFA,
+    0xDD, 0x6D, 0xFF, 0x7B, 0xBB, 0x77, 0x37, 0x3B, 0x3B, 0xF3, 0xCE, 0x3B, 0x73, 0xFB, 0x1C, 0xC7,
+    0x71, 0x1C, 0xC7, 0x71, 0x1C, 0xC7, 0x71, 0x1C, 0xC7, 0x71, 0x1C, 0xC7, 0x71, 0x1C, 0xC7, 0x71,
+    0x9C, 0xED, 0xE5, 0x78, 0x7B, 0x7F, 0x2B, 0x4E, 0x2E, 0x0F, 0x94, 0x97, 0x94, 0xA7, 0x64, 0x83,
+    0xB3, 0x15, 0x1C, 0x2B, 0x8F, 0x96, 0x5F, 0x90, 0x1F, 0x97, 0xFF, 0x91, 0x6B, 0xDC, 0x45, 0xFE,
+    0x4A, 0xFE, 0xCF, 0xDD, 0x6A, 0xBF, 0x23, 0xAF, 0x2E, 0x57, 0x78, 0x90, 0xB4, 0xFE, 0xB1, 0xBB,
+    0xBD, 0xDE, 0x5C, 0x2E, 0x6E, 0x01, 0x97, 0x96, 0x54, 0x0D, 0x27, 0x64, 0x83, 0xB3, 0x33, 0x70,
+    0x1B, 0xD8, 0xEF, 0x04, 0xFA, 0xCF, 0x53, 0xE5, 0x65, 0xD9, 0xE2, 0xEC, 0x14, 0xC7, 0x97, 0xC7,
+    0x52, 0x03, 0xFC, 0x44, 0x9E, 0x8B, 0x2D, 0xCE, 0xCE, 0x71, 0x24, 0x05, 0xE0, 0xDF, 0xD2, 0xAB,
+    0xFF, 0x71, 0xF9, 0xBA, 0x7C, 0xB3, 0xFC, 0xD3, 0xE2, 0x59, 0x59, 0xCE, 0x28, 0x6F, 0x27, 0x2F,
+    0xB4, 0x78, 0xB6, 0x0A, 0x6D, 0x81, 0xB5, 0xC6, 0x81, 0x5B, 0xD6, 0xF7, 0xC8, 0x13, 0xC9, 0x31,
+    0xE1, 0x42, 0xFF, 0xAA, 0x5C, 0x3B, 0x1F, 0xEE, 0x03, 0xCE, 0xB8, 0xBC, 0x48, 0x52, 0xEB, 0x8E,
+    0x09, 0x5F, 0xF6, 0xA1, 0xCB, 0x87, 0xAB, 0x50, 0x32, 0xF8, 0x9F, 0x53, 0xE4, 0x0F, 0xF2, 0xBB,
+    0xF2, 0x07, 0x7B, 0x7F, 0x7F, 0x2C, 0xFF, 0x2C, 0xFF, 0x26, 0xFF, 0x22, 0xFF, 0x21, 0x4F, 0x21,
+    0x4F, 0x2D, 0x4F, 0x25, 0xA9, 0xEA, 0xCE, 0x2B, 0xA9, 0xEA, 0x2E, 0x28, 0x2F, 0x2C, 0x4F, 0x2A,
+    0xA7, 0xC6, 0xF5, 0xE5, 0x07, 0x96, 0x0F, 0x47, 0xE5, 0x4E, 0xF2, 0x55, 0xCB, 0x87, 0xAB, 0xAC,
+    0x54, 0x09, 0x1B, 0xF4, 0x77, 0xF2, 0x4D, 0xF2, 0x9E, 0xF2, 0x52, 0x92, 0xC2, 0x39, 0x04, 0x7A,
+    0x38, 0xD7, 0x94, 0x8F, 0x93, 0x1F, 0x91, 0xFF, 0x94, 0xD6, 0x71, 0xC7, 0xF6, 0xF5, 0x72, 0x6C,
+    0x68, 0xE3, 0x7D, 0x56, 0xAE, 0x9D, 0xCF, 0xA6, 0x6B, 0x00, 0xAE, 0xE6, 0x77, 0x49, 0xBE, 0xF8,
+    0xF7, 0xCA, 0x92, 0x55, 0x23, 0xA1, 0x6D, 0xAE, 0x82, 0x5B, 0xCB, 0xAB, 0xC8, 0x4D, 0xDE, 0xFE,
+    0xDE, 0x29, 0xDF, 0x2E, 0x09, 0xCF, 0x96, 0x86, 0x9A, 0xF1, 0xF6, 0xF2, 0x5A, 0x8B, 0x67, 0x06,
+    0x6B, 0xA5, 0x62, 0x04, 0x7F, 0x24, 0xEF, 0x25, 0x37, 0x35, 0xDE, 0x70, 0x4E, 0xF9, 0x3C, 0xF9,
+    0x57, 0x69, 0x9D, 0xDF, 0x2E, 0x69, 0x6E, 0x2C, 0x25, 0x71, 0xE8, 0x3B, 0xCA, 0xB1, 0x5B, 0xC1,
+    0x6D, 0x50, 0x00, 0x9F, 0x20, 0xFF, 0x28, 0xAD, 0xF3, 0xDD, 0x7A, 0xC7, 0xBA, 0x05, 0xD0, 0xDF,
+    0xE5, 0x5E, 0xBC, 0x89, 0x16, 0x70, 0x0C, 0xA7, 0x91, 0xCF, 0x96, 0x77, 0x95, 0x63, 0xDC, 0x1A,
+    0x68, 0xCC, 0x7E, 0x4A, 0xD2, 0xD0, 0x2D, 0xCD, 0x99, 0x25, 0xB7, 0xBC, 0x93, 0x2D, 0x9E, 0x19,
+    0xAC, 0x95, 0x8A, 0xCC, 0xBE, 0x4C, 0x9E, 0x45, 0xCE, 0x81, 0x2B, 0xCB, 0x2F, 0x4B, 0xEB, 0x7D,
+    0xE4, 0xF2, 0x7B, 0x92, 0x5B, 0xD0, 0x98, 0xD0, 0x23, 0xFA, 0xA5, 0x5C, 0x3B, 0x9F, 0x92, 0x35,
+    0x00, 0x57, 0x3D, 0xA3, 0x8C, 0xAF, 0x58, 0x3C, 0xCB, 0x03, 0xDD, 0x3A, 0xDE, 0xCC, 0x45, 0x25,
+    0x85, 0x8A, 0x2E, 0x20, 0xB7, 0x13, 0x1A, 0x93, 0x5C, 0x55, 0x47, 0xCA, 0x6F, 0xCB, 0x9F, 0xCA,
+    0x21, 0x3C, 0x53, 0x3E, 0x58, 0x96, 0xA8, 0x0D, 0x68, 0x88, 0xBE, 0x66, 0xF9, 0x70, 0x54, 0x1E,
+    0x22, 0x9F, 0xB5, 0x7C, 0xB8, 0xCA, 0x5A, 0xA9, 0xC8, 0xE0, 0x67, 0x24, 0x7D, 0xF2, 0x1C, 0xF0,
+    0x25, 0xDF, 0x5F, 0xD2, 0x4B, 0xA0, 0xEF, 0x6F, 0x1D, 0xAF, 0x29, 0xA5, 0xFD, 0x30, 0x49, 0x37,
+    0xB0, 0x2F, 0x37, 0x91, 0x25, 0xF2, 0x23, 0xD6, 0xC6, 0xE2, 0x47, 0xE2, 0xB6, 0xD2, 0x3A, 0x1F,
+    0x73, 0xE3, 0x10, 0xB9, 0xE2, 0x73, 0x04, 0x60, 0x78, 0x8D, 0x67, 0x48, 0x6A, 0x12, 0xEB, 0x38,
+    0xB1, 0x7E, 0x45, 0x5E, 0x47, 0xF6, 0xE1, 0x7C, 0x92, 0x86, 0xAB, 0xF5, 0xBA, 0x7D, 0x35, 0xAF,
+    0xC2, 0x11, 0xA0, 0xAB, 0xBD, 0x76, 0x3E, 0xB9, 0x6F, 0x01, 0x07, 0x49, 0x5A, 0xD5, 0xA4, 0x20,
+    0x0D, 0x81, 0x7B, 0x24, 0x57, 0xFC, 0x01, 0x8B, 0x67, 0x79, 0xA0, 0xDB, 0x57, 0x25, 0xBE, 0xA4,
+    0x40, 0x41, 0xFC, 0xA0, 0xA4, 0x21, 0x95, 0x8B, 0x27, 0xCA, 0x37, 0xC8, 0x31, 0x1A, 0x81, 0x67,
+    0x92, 0x74, 0xB9, 0xEF, 0xB7, 0x78, 0x66, 0xB0, 0x52, 0x22, 0x06, 0x48, 0x2B, 0x3F, 0x07, 0x84,
+    0x77, 0x09, 0xFF, 0x5A, 0xC7, 0x18, 0xEA, 0xD3, 0x65, 0x5F, 0x0E, 0x97, 0xD6, 0x6B, 0xCE, 0x5D,
+    0x73, 0x63, 0xAA, 0x5C, 0xF9, 0xB9, 0x28, 0x9D, 0x9E, 0x66, 0x0D, 0x8B, 0xC6, 0x40, 0x6D, 0x79,
+    0x84, 0xB4, 0x5E, 0x73, 0xCE, 0x9A, 0x1B, 0x53, 0xA4, 0xFF, 0x9C, 0x93, 0xD2, 0x57, 0xDA, 0xBD,
+    0x65, 0x5F, 0x88, 0xA9, 0xE7, 0xEA, 0x26, 0xFE, 0x57, 0xD2, 0xA8, 0x2D, 0x2D, 0xB7, 0x63, 0xEB,
+    0xF8, 0x95, 0xE6, 0xC6, 0x58, 0x89, 0xE3, 0x33, 0xE8, 0x92, 0x13, 0xEE, 0xB7, 0xD6, 0xB1, 0x72,
+    0x79, 0x03, 0x39, 0x84, 0xB3, 0xC9, 0xDF, 0x48, 0xEB, 0xB5, 0x63, 0xFC, 0xBB, 0xBC, 0x9B, 0x1C,
+    0x2B, 0x0C, 0xCE, 0x2D, 0xF5, 0x01, 0x92, 0x1C, 0x40, 0xEB, 0x7C, 0xCC, 0x8D, 0x31, 0x92, 0x4A,
+    0x46, 0x03, 0x23, 0x37, 0xAF, 0x94, 0xD6, 0xF1, 0x72, 0xF8, 0x16, 0x49, 0x55, 0x3E, 0x94, 0x1B,
+    0xC9, 0xB6, 0x0F, 0x34, 0x24, 0x39, 0x98, 0x9B, 0xE0, 0xF9, 0xD2, 0x3A, 0x1F, 0x73, 0x63, 0xC8,
+    0x7F, 0xC9, 0x2B, 0xC8, 0x12, 0x3C, 0x4A, 0x5A, 0xC7, 0x1C, 0xEA, 0xEB, 0x64, 0xCE, 0xFC, 0x80,
+    0x47, 0x4B, 0xEB, 0x38, 0x21, 0x73, 0xF6, 0x26, 0x52, 0xB8, 0x8D, 0xB4, 0xCE, 0xC7, 0xDC, 0x18,
+    0xB2, 0x64, 0x5F, 0x96, 0xAB, 0xCB, 0x3A, 0xE6, 0x10, 0xE9, 0x9A, 0x96, 0x88, 0xEA, 0x7D, 0x51,
+    0x5A, 0xC7, 0xEB, 0xF2, 0x1E, 0x72, 0x13, 0xD0, 0x50, 0xB7, 0xCE, 0xC7, 0xDC, 0xD8, 0x25, 0xD9,
+    0x39, 0xAD, 0x03, 0x0B, 0x19, 0x20, 0xC4, 0x6B, 0x1D, 0xB7, 0x8F, 0xC7, 0x48, 0x12, 0x4C, 0x4A,
+    0x41, 0x2D, 0xC8, 0xE0, 0x96, 0x75, 0xEC, 0x36, 0x7F, 0x2F, 0x49, 0x78, 0x19, 0x13, 0xDA, 0x3D,
+    0x34, 0x08, 0xD7, 0xCE, 0xA7, 0x4F, 0x20, 0x88, 0xA8, 0xDA, 0x87, 0x97, 0x0F, 0x8B, 0xF1, 0x0B,
+    0x49, 0x63, 0x6B, 0x08, 0x8C, 0xF5, 0x93, 0x0D, 0x4B, 0x12, 0x66, 0x49, 0x18, 0x37, 0x78, 0xE8,
+    0xF2, 0x61, 0x12, 0x8C, 0x59, 0x90, 0x05, 0x55, 0x1A, 0x12, 0x42, 0xF6, 0x97, 0xAD, 0x6D, 0x9F,
+    0xB5, 0x52, 0xD1, 0xE1, 0xDB, 0xE4, 0x18, 0xBC, 0x55, 0x5A, 0xC7, 0x8F, 0x95, 0xF1, 0xFD, 0x2B,
+    0xC9, 0x31, 0x38, 0x89, 0x24, 0xA2, 0x67, 0x9D, 0xC7, 0xE4, 0x4D, 0xBD, 0x2F, 0x1E, 0xBC, 0xF7,
+    0xB7, 0x34, 0x9F, 0xDF, 0xFB, 0xDB, 0x07, 0xAA, 0x3A, 0xE6, 0xBD, 0x7D, 0x7A, 0xF1, 0xAC, 0x3C,
+    0xE4, 0x1A, 0x3E, 0x77, 0xF9, 0x70, 0x7E, 0xA4, 0xDC, 0x02, 0xB8, 0xFA, 0x6F, 0xB9, 0x7C, 0x58,
+    0x1C, 0x46, 0xCC, 0x3E, 0xB6, 0x7C, 0x98, 0x04, 0x5D, 0x33, 0x5A, 0xBB, 0x63, 0xD5, 0x54, 0x15,
+    0xD4, 0x02, 0x8C, 0x40, 0x9E, 0x6E, 0xF1, 0xAC, 0x1B, 0x02, 0x33, 0x84, 0xA4, 0xDF, 0x27, 0xC7,
+    0x18, 0x0B, 0xA0, 0x4D, 0x75, 0xE7, 0x3D, 0x4D, 0xD6, 0xAA, 0x85, 0x16, 0x53, 0x86, 0x31, 0x2F,
+    0x21, 0xE9, 0xEE, 0xF4, 0xED, 0x76, 0x11, 0x71, 0x23, 0x60, 0x62, 0x9D, 0x47, 0x97, 0xB9, 0xC6,
+    0x23, 0xFA, 0xC0, 0x97, 0x6A, 0x9D, 0x53, 0xD3, 0x43, 0xE4, 0x26, 0x20, 0x06, 0x62, 0x9D, 0x8F,
+    0xB9, 0xB1, 0x29, 0x2D, 0xFF, 0x98, 0x00, 0xCA, 0x7E, 0xF2, 0xDD, 0xB2, 0xDA, 0x8F, 0x86, 0x0E,
+    0x09, 0x1C, 0x7D, 0xA0, 0xA1, 0x59, 0x3F, 0x07, 0xA4, 0xC5, 0xCD, 0x0C, 0x97, 0xF7, 0x4B, 0x32,
+    0x6B, 0x3F, 0x29, 0x7F, 0x2B, 0xF9, 0x7F, 0x2F, 0x97, 0x9B, 0xE4, 0x22, 0xB2, 0x79, 0xBE, 0x96,
+    0xD7, 0x90, 0x9B, 0x80, 0xCC, 0x60, 0xEB, 0x7C, 0xCC, 0x8D, 0x4D, 0x9F, 0x2C, 0x43, 0x9C, 0x43,
+    0xFE, 0x50, 0x36, 0xF7, 0x25, 0x3B, 0xE7, 0xEC, 0x32, 0x95, 0xC7, 0x48, 0xF6, 0x27, 0x66, 0x4E,
+    0x75, 0xC9, 0xED, 0xA7, 0x2D, 0x7C, 0xCA, 0x8A, 0x26, 0x84, 0x3C, 0x37, 0x0D, 0x89, 0x30, 0xCD,
+    0xF7, 0xDF, 0x94, 0xB4, 0xF4, 0x4D, 0x40, 0x77, 0xD8, 0x3A, 0x1F, 0x73, 0x63, 0x5D, 0xEE, 0x59,
+    0xE7, 0x91, 0x21, 0xE8, 0x6E, 0x59, 0xFB, 0xE3, 0x47, 0x65, 0xEA, 0xED, 0x80, 0xFC, 0xBC, 0x2F,
+    0xC9, 0xAB, 0x2E, 0x9E, 0xCD, 0x83, 0xFB, 0x4A, 0xEB, 0xFD, 0xD7, 0x65, 0x2D, 0x86, 0x98, 0xB6,
+    0x42, 0x4E, 0xCE, 0x2A, 0x8F, 0x92, 0x6B, 0xE7, 0x13, 0xD3, 0x08, 0x64, 0x26, 0x6B, 0x28, 0x70,
+    0xC1, 0xD5, 0xC9, 0x3D, 0xA6, 0x0B, 0xF2, 0xE0, 0x68, 0x88, 0x84, 0x8E, 0x57, 0x87, 0x81, 0x26,
+    0x6A, 0x80, 0x31, 0x39, 0xBD, 0x24, 0x21, 0x85, 0xBF, 0x24, 0x70, 0xD2, 0xB8, 0x8B, 0x85, 0x9A,
+    0xEE, 0xE7, 0xCB, 0x87, 0x9D, 0x90, 0xBF, 0x48, 0x43, 0x95, 0xEE, 0x6A, 0x69, 0xF8, 0xF2, 0xAF,
+    0x2B, 0x79, 0x3F, 0x26, 0x2B, 0x25, 0xC2, 0xF0, 0x85, 0x32, 0x04, 0x53, 0xAF, 0xAC, 0x7D, 0x9B,
+    0x92, 0x09, 0x33, 0x25, 0xF8, 0xC2, 0x6E, 0x25, 0x09, 0x6D, 0x73, 0x9B, 0xF9, 0x99, 0x6C, 0x9E,
+    0x33, 0xC3, 0xDD, 0x29, 0xF3, 0x18, 0x28, 0x34, 0xCD, 0xD7, 0x98, 0xB2, 0xE6, 0xC6, 0xBA, 0x37,
+    0x94, 0x5D, 0x90, 0xFC, 0x19, 0x1A, 0x73, 0xAE, 0xFB, 0x40, 0x39, 0x84, 0x13, 0x4B, 0x72, 0xF5,
+    0x58, 0xDA, 0x86, 0x68, 0x61, 0x4C, 0xE3, 0xB4, 0x82, 0x06, 0x29, 0xF9, 0x00, 0xE4, 0xC7, 0x91,
+    0x41, 0x6C, 0x9D, 0x9F, 0x25, 0x03, 0x49, 0xB1, 0x31, 0x13, 0x2E, 0x18, 0xEB, 0x35, 0xA6, 0xAA,
+    0xB9, 0xB1, 0x2E, 0x93, 0x26, 0xBA, 0x60, 0x75, 0x31, 0x6B, 0xBF, 0x2E, 0xFB, 0x14, 0x82, 0xCB,
+    0x49, 0x16, 0x55, 0x60, 0x66, 0x70, 0xFD, 0xB5, 0x08, 0x1B, 0x93, 0x3C, 0x4A, 0xC8, 0xB3, 0x8D,
+    0x27, 0x49, 0xA6, 0xA3, 0xD5, 0xF7, 0x4B, 0x35, 0x36, 0x91, 0xE4, 0x0E, 0xD2, 0xDA, 0x7F, 0xAA,
+    0x9A, 0x1B, 0x2B, 0x19, 0xF3, 0x0F, 0xC1, 0x94, 0x63, 0x6B, 0xDF, 0x90, 0x7C, 0x29, 0x31, 0x10,
+    0x13, 0xA0, 0x1A, 0x0E, 0xD5, 0x32, 0x0C, 0xFC, 0x30, 0x92, 0x68, 0x41, 0x64, 0xD0, 0xDA, 0x27,
+    0x45, 0x5E, 0x9F, 0x14, 0xF5, 0x10, 0xC4, 0x40, 0xAC, 0xFD, 0xA7, 0xAA, 0xB9, 0xB1, 0x92, 0xEC,
+    0x9C, 0x10, 0x7D, 0x86, 0x44, 0x2B, 0x49, 0xFE, 0x60, 0x71, 0xCA, 0x2E, 0x98, 0x4E, 0x66, 0xED,
+    0xDB, 0x66, 0x5B, 0xB4, 0xF2, 0x13, 0xD2, 0xFA, 0xF7, 0x29, 0x92, 0xAF, 0x18, 0x82, 0x5B, 0x14,
+    0x0D, 0x57, 0x6B, 0xFF, 0x29, 0x6A, 0x6E, 0xAC, 0x34, 0x57, 0x95, 0x68, 0x30, 0x74, 0x62, 0xE5,
+    0xE7, 0xE4, 0xF9, 0xA5, 0x05, 0xA9, 0x53, 0xD6, 0x3E, 0x5D, 0xF2, 0xE1, 0x5B, 0xDD, 0x56, 0xE6,
+    0xFD, 0x59, 0xFF, 0x3E, 0x45, 0xF2, 0x01, 0x63, 0x48, 0x69, 0x5F, 0x6C, 0x5A, 0x73, 0x63, 0x25,
+    0x59, 0x2F, 0x5D, 0xD0, 0x30, 0x4A, 0x69, 0x00, 0xB6, 0xF9, 0x0E, 0xD9, 0x84, 0xF8, 0x3A, 0xF7,
+    0x77, 0xEB, 0xDF, 0x87, 0x7C, 0x89, 0x6C, 0x42, 0xA0, 0x28, 0xC7, 0x95, 0x49, 0xC0, 0x2B, 0x04,
+    0x13, 0x3F, 0xAD, 0x7D, 0x27, 0x67, 0xA8, 0x65, 0x4B, 0x83, 0xAB, 0x0B, 0x96, 0x66, 0x49, 0x69,
+    0x85, 0xB7, 0xC1, 0x15, 0xD3, 0xE4, 0x7A, 0xB2, 0x6F, 0x4E, 0x00, 0xF3, 0xEF, 0x9A, 0x49, 0x2B,
+    0xCC, 0x1F, 0x24, 0x34, 0x3D, 0x14, 0x02, 0x54, 0x21, 0xE8, 0xE7, 0xCF, 0x82, 0x50, 0x01, 0x08,
+    0xBD, 0x91, 0x5C, 0x53, 0xBD, 0xAD, 0x60, 0xCB, 0x90, 0x9C, 0x43, 0xEE, 0xC3, 0xD6, 0xE2, 0x97,
+    0x84, 0xAA, 0x87, 0x72, 0xB1, 0xBD, 0xBF, 0x5D, 0x84, 0x2E, 0x9C, 0xC9, 0x30, 0xB4, 0x06, 0x60,
+    0xC4, 0x2E, 0x47, 0xA4, 0x8E, 0x31, 0xFC, 0x26, 0x43, 0x33, 0x82, 0xAC, 0xFD, 0x73, 0x64, 0xE0,
+    0xB4, 0xB5, 0x57, 0xEA, 0x6C, 0x4D, 0x01, 0x88, 0x89, 0x80, 0x31, 0x1A, 0x37, 0x14, 0x6B, 0x90,
+    0xC7, 0x2A, 0x14, 0x29, 0x58, 0xFB, 0x87, 0xDE, 0x6F, 0x0C, 0x31, 0x71, 0xFC, 0xA9, 0xAC, 0x80,
+    0x12, 0x24, 0x34, 0x16, 0x40, 0x06, 0xAB, 0xD5, 0xA0, 0xAA, 0xC3, 0x40, 0xCF, 0xD0, 0x21, 0x4E,
+    0x26, 0x6E, 0x36, 0x83, 0x43, 0x0F, 0x93, 0x04, 0x78, 0xFA, 0x72, 0x71, 0xF9, 0xAD, 0xE5, 0xC3,
+    0xE3, 0x60, 0x22, 0xCB, 0x8D, 0x97, 0x0F, 0x7B, 0xC3, 0x88, 0x5F, 0x28, 0xDD, 0x8C, 0x38, 0xFF,
+    0x62, 0x35, 0xEE, 0x0E, 0x28, 0xA0, 0xCC, 0x3C, 0x2E, 0x0D, 0x71, 0x89, 0xCE, 0x02, 0xB9, 0xD6,
+    0x32, 0xAC, 0xC9, 0x22, 0x09, 0x21, 0x48, 0x87, 0xB2, 0xF6, 0x4D, 0xF1, 0x43, 0xB2, 0x09, 0x89,
+    0x8C, 0xD6, 0xBF, 0x8D, 0xF1, 0xFB, 0xD2, 0x22, 0x47, 0x9C, 0x3E, 0x26, 0x53, 0xC9, 0xCA, 0x65,
+    0x68, 0xFA, 0x0D, 0x39, 0x06, 0xE6, 0xCA, 0x20, 0x95, 0xA1, 0x2A, 0x31, 0x14, 0x06, 0x06, 0x7E,
+    0x81, 0x62, 0x28, 0x0C, 0xF9, 0xD2, 0x70, 0xAB, 0xC3, 0xD5, 0x11, 0x13, 0x88, 0xB2, 0x60, 0x59,
+    0x9A, 0x26, 0x5C, 0x05, 0x39, 0x26, 0x86, 0xD0, 0x9B, 0x08, 0x11, 0xF3, 0xB9, 0x4D, 0x06, 0xB3,
+    0x64, 0xEC, 0xF9, 0x6A, 0x19, 0x82, 0x0F, 0x36, 0xC7, 0x72, 0x6B, 0xD6, 0xA0, 0x13, 0xC3, 0xD0,
+    0xCD, 0xD8, 0x7F, 0x48, 0x12, 0x4A, 0x89, 0x21, 0x58, 0xD0, 0x6D, 0x8D, 0x1D, 0xB9, 0x6C, 0x93,
+    0xE8, 0x65, 0x88, 0x98, 0x2C, 0xE1, 0x59, 0xD4, 0x00, 0xDC, 0x47, 0x43, 0xD0, 0x15, 0x34, 0x97,
+    0x20, 0x4D, 0x84, 0x41, 0x94, 0x26, 0x5F, 0x93, 0xF4, 0xE9, 0xE9, 0x6D, 0xC4, 0xC0, 0xBA, 0x02,
+    0x0C, 0xEF, 0x92, 0xA9, 0x6B, 0x41, 0x61, 0x62, 0xC1, 0xC4, 0x21, 0x33, 0x9B, 0x42, 0xB1, 0x04,
+    0x86, 0x98, 0xC7, 0x4E, 0xF8, 0x18, 0x84, 0x59, 0x32, 0xF6, 0xE4, 0x83, 0x8F, 0x09, 0xF4, 0x30,
+    0x3C, 0x4B, 0xA3, 0xC6, 0x7A, 0x8D, 0x14, 0x49, 0xED, 0xB2, 0xA0, 0xD1, 0xD5, 0x35, 0xE6, 0x40,
+    0x57, 0x94, 0xA5, 0x69, 0x52, 0x3E, 0x78, 0xDA, 0x37, 0x7D, 0xA2, 0x98, 0x04, 0xA8, 0xBA, 0x60,
+    0x5D, 0x22, 0x6B, 0xBF, 0xA6, 0x93, 0xA8, 0x01, 0xA4, 0xB9, 0xB1, 0xEE, 0x05, 0x64, 0x0C, 0x55,
+    0x0E, 0x5F, 0xAA, 0xDC, 0x3E, 0x68, 0x04, 0x3E, 0x42, 0x86, 0x82, 0x2C, 0x2C, 0xB4, 0xCC, 0x2C,
+    0x57, 0xD6, 0x10, 0x60, 0x0C, 0x81, 0x56, 0xFD, 0x23, 0x65, 0xDF, 0xA9, 0x56, 0x8C, 0x35, 0xA4,
+    0x84, 0x87, 0x19, 0x11, 0x0C, 0xE5, 0x1E, 0xC6, 0xA4, 0x85, 0xE1, 0x6C, 0x0A, 0x40, 0xCA, 0xDC,
+    0xBA, 0xD7, 0x4A, 0xEB, 0x35, 0xEA, 0x52, 0x0D, 0xB3, 0x5A, 0x36, 0xDD, 0x3C, 0x1A, 0x7F, 0x9B,
+    0xEE, 0x33, 0xB3, 0x76, 0x8E, 0x75, 0x9E, 0x96, 0x64, 0x3C, 0x87, 0x60, 0x5C, 0xC3, 0xDA, 0xB7,
+    0xE9, 0x6C, 0x0A, 0x40, 0xEA, 0xEA, 0xD6, 0x2C, 0xE9, 0x46, 0x6C, 0x9F, 0xEA, 0x95, 0xC8, 0x1B,
+    0x49, 0x90, 0x2F, 0x96, 0x77, 0x97, 0x57, 0x94, 0x53, 0x0C, 0x92, 0x90, 0xAA, 0x66, 0xBD, 0xF7,
+    0xA6, 0x37, 0x95, 0x5D, 0x90, 0xBB, 0x10, 0x3B, 0x3A, 0x3A, 0x9B, 0x02, 0xC0, 0x32, 0x6D, 0x7D,
+    0x56, 0x01, 0x69, 0x6B, 0x89, 0x8F, 0xC1, 0xE5, 0xF7, 0xFE, 0xA6, 0xF0, 0x46, 0x69, 0xBD, 0xFF,
+    0x4A, 0xE6, 0x23, 0x84, 0x3E, 0x07, 0x6A, 0x34, 0x6B, 0x5F, 0xCB, 0xD9, 0x14, 0x00, 0xBC, 0xB6,
+    0x9C, 0x3A, 0x8C, 0xFE, 0x91, 0x73, 0x4F, 0xEC, 0x80, 0xFB, 0x7A, 0x9F, 0x79, 0x02, 0xA4, 0xA1,
+    0x5B, 0xEF, 0x9F, 0x29, 0x67, 0xD4, 0x5E, 0x21, 0x9E, 0x26, 0xAD, 0xFD, 0x2D, 0x27, 0x51, 0x00,
+    0x62, 0xD2, 0xC2, 0x81, 0xBE, 0x2F, 0x09, 0x15, 0x9B, 0x84, 0x55, 0xC6, 0x99, 0x7D, 0x43, 0x7E,
+    0x3B, 0xED, 0x08, 0xBA, 0xB0, 0xB4, 0xFA, 0xF9, 0x75, 0x10, 0x96, 0x8E, 0x65, 0x98, 0xB6, 0x9E,
+    0x5D, 0x44, 0x6B, 0x3D, 0x35, 0x90, 0xC4, 0xC2, 0xCA, 0xC4, 0x11, 0x98, 0xE1, 0x54, 0xC1, 0xE7,
+    0xC3, 0x1A, 0x3B, 0x2F, 0x58, 0x3C, 0x6B, 0x87, 0x5B, 0x1B, 0x93, 0x60, 0x62, 0xD7, 0x45, 0xFE,
+    0xA6, 0x24, 0x4C, 0x5B, 0x1A, 0x0A, 0x00, 0xA9, 0xE1, 0xAD, 0xAC, 0x94, 0x88, 0x16, 0xB9, 0x02,
+    0x4E, 0x2B, 0x37, 0xC5, 0xD5, 0x64, 0xEA, 0x2F, 0x7E, 0x70, 0x35, 0xF6, 0x81, 0x9F, 0xD0, 0x63,
+    0x91, 0x4A, 0x82, 0x39, 0x4C, 0x3D, 0x23, 0xA7, 0x3E, 0x06, 0x52, 0xD1, 0xAC, 0xF3, 0x68, 0x73,
+    0x56, 0xB7, 0x00, 0x6C, 0x5D, 0x69, 0xB2, 0x30, 0x5C, 0x51, 0x56, 0xBE, 0x7E, 0x48, 0x7E, 0x22,
+    0x65, 0x4C, 0xBA, 0x66, 0x46, 0x59, 0xCE, 0xAE, 0x00, 0xF0, 0x42, 0x63, 0x37, 0xEC, 0x18, 0x26,
+    0x8E, 0x99, 0x6F, 0x67, 0x49, 0x2F, 0x24, 0x94, 0x70, 0x9A, 0x0B, 0xDA, 0x07, 0xA9, 0x41, 0xA5,
+    0xD9, 0x15, 0x00, 0xBC, 0x8F, 0x1C, 0x0B, 0x0A, 0x1B, 0x55, 0xB1, 0x75, 0x1E, 0xB1, 0x8E, 0x35,
+    0xAF, 0x90, 0x99, 0xCA, 0xD6, 0xF1, 0xBB, 0x9C, 0x65, 0x01, 0xE0, 0xC5, 0x72, 0x2E, 0xB5, 0xD6,
+    0x06, 0x2D, 0xFA, 0x50, 0xB7, 0x2C, 0xC6, 0x87, 0xCB, 0xD2, 0xD0, 0xF8, 0xEC, 0x13, 0x52, 0x9E,
+    0x65, 0x01, 0xC0, 0xA7, 0xC8, 0x92, 0x30, 0x94, 0x4A, 0x68, 0xD8, 0x3A, 0x76, 0xAA, 0x4C, 0x01,
+    0x2B, 0x09, 0x71, 0x01, 0x7A, 0x0D, 0xD6, 0xB1, 0x43, 0xCE, 0xB6, 0x00, 0x60, 0xCC, 0x28, 0x61,
+    0x1F, 0x18, 0x54, 0xE2, 0x83, 0xB1, 0x8E, 0xD9, 0xC7, 0x98, 0x99, 0x4D, 0x43, 0x88, 0x8D, 0xFB,
+    0x5B, 0xCE, 0xBA, 0x00, 0x90, 0xF1, 0x92, 0x7B, 0x8D, 0x60, 0x46, 0xD1, 0x86, 0xAC, 0xC1, 0xDB,
+    0x66, 0xA9, 0xEE, 0xEB, 0xB9, 0x25, 0x59, 0xD3, 0xD6, 0x31, 0x63, 0x9C, 0x75, 0x01, 0xC0, 0x98,
+    0x55, 0x43, 0x62, 0x61, 0xC0, 0x89, 0xE5, 0x67, 0xAD, 0xE3, 0x0C, 0xB5, 0x44, 0x43, 0x90, 0xA0,
+    0xCF, 0x11, 0xD2, 0x3A, 0x5E, 0xAC, 0xB3, 0x2F, 0x00, 0xD8, 0x36, 0x19, 0x33, 0x05, 0x56, 0xB1,
+    0xCC, 0x31, 0x63, 0xA7, 0xCD, 0xD6, 0xD5, 0xB1, 0x06, 0x90, 0x12, 0xF2, 0x6D, 0x73, 0x12, 0x05,
+    0x60, 0x68, 0x9A, 0x34, 0xAB, 0x82, 0xC4, 0xE4, 0xC9, 0x77, 0xC1, 0x17, 0x94, 0x23, 0x5D, 0xBB,
+    0x8D, 0xA1, 0xF3, 0x0B, 0x9A, 0x90, 0x43, 0x40, 0x0E, 0xC2, 0x56, 0x30, 0xF4, 0x83, 0xA7, 0xAF,
+    0x4E, 0x72, 0x46, 0xCC, 0x7C, 0xB9, 0x36, 0x08, 0x33, 0x97, 0x84, 0x5F, 0xFE, 0xCA, 0xC5, 0xCD,
+    0xE4, 0xA6, 0x96, 0x79, 0x2B, 0x86, 0x59, 0x35, 0x24, 0xCA, 0x2F, 0x73, 0x75, 0x2D, 0xD0, 0xD0,
+    0x05, 0xB7, 0x00, 0xEB, 0x35, 0x73, 0xC8, 0xD8, 0x3C, 0x03, 0x3C, 0x39, 0xA0, 0x91, 0x4A, 0x46,
+    0xB0, 0x75, 0x9C, 0x3E, 0x6E, 0x45, 0x1B, 0xA0, 0x2E, 0x33, 0x62, 0x63, 0x47, 0xC2, 0x9A, 0x3C,
+    0x47, 0x5A, 0xAF, 0x39, 0x44, 0xDA, 0x15, 0x54, 0xD7, 0x39, 0x60, 0x30, 0x6A, 0xE8, 0x34, 0xF8,
+    0xA6, 0x5B, 0x57, 0x00, 0x90, 0x4C, 0x20, 0x86, 0x6C, 0xFB, 0x40, 0x4E, 0x60, 0x8E, 0xC4, 0x52,
+    0x24, 0x13, 0x89, 0x6C, 0xE2, 0x1C, 0xB0, 0x04, 0x4E, 0xAE, 0xF3, 0xAA, 0xBB, 0x95, 0x05, 0x00,
+    0xF9, 0xB0, 0xB8, 0x62, 0xFA, 0xC0, 0x6C, 0x20, 0xB2, 0x7B, 0xFB, 0x7E, 0xE0, 0x5C, 0xA5, 0xB4,
+    0xD0, 0x73, 0x55, 0xFB, 0x2C, 0x3D, 0x5B, 0xAA, 0x87, 0xB2, 0xB5, 0x05, 0xA0, 0xF2, 0xB1, 0xB2,
+    0x6F, 0xB0, 0x88, 0x70, 0x30, 0x09, 0x28, 0xAC, 0x2D, 0xC8, 0xFC, 0xBE, 0xB6, 0x18, 0x01, 0x69,
+    0xEB, 0xCC, 0x1D, 0x20, 0xE7, 0xF0, 0x16, 0x32, 0xD7, 0x0F, 0x31, 0x9D, 0x41, 0xC6, 0x24, 0xB8,
+    0x0E, 0x71, 0xEB, 0x0B, 0x00, 0xB2, 0xA6, 0x2F, 0x11, 0xB3, 0xA1, 0xD0, 0x5B, 0x61, 0xC2, 0x05,
+    0xCB, 0xBC, 0xB1, 0x3C, 0x1C, 0x7F, 0xE9, 0xDE, 0x95, 0xE8, 0x3E, 0x92, 0xFE, 0xD6, 0x27, 0xFF,
+    0x20, 0xD5, 0x9D, 0x28, 0x00, 0xC8, 0xD5, 0x4B, 0x0A, 0x78, 0x73, 0xEE, 0xDF, 0xD4, 0xA0, 0x01,
+    0xFB, 0x52, 0x59, 0x32, 0x28, 0x55, 0x77, 0x67, 0x0A, 0x40, 0x25, 0x53, 0xAA, 0x86, 0xFE, 0x66,
+    0x5F, 0x09, 0x28, 0x98, 0x4C, 0x6A, 0xC9, 0xDD, 0xCA, 0x0F, 0xB9, 0x73, 0x05, 0xA0, 0x92, 0x18,
+    0x3A, 0xF9, 0x73, 0x25, 0xA3, 0x7F, 0x31, 0x30, 0x51, 0x94, 0x45, 0xB0, 0x18, 0x31, 0xB4, 0xCE,
+    0xB3, 0xB4, 0x3B, 0x5B, 0x00, 0x2A, 0x99, 0xAB, 0x4F, 0xB6, 0x6D, 0x67, 0xC6, 0x6A, 0x01, 0xC8,
+    0xC4, 0x65, 0x41, 0x8A, 0xA3, 0xA5, 0x75, 0x5E, 0x63, 0xB9, 0xF3, 0x05, 0xA0, 0x2E, 0x09, 0x95,
+    0xF4, 0xB7, 0x73, 0xC7, 0xED, 0x81, 0xD4, 0x77, 0xE6, 0x1C, 0xF2, 0xDB, 0x81, 0xB9, 0x7E, 0xF7,
+    0x37, 0x87, 0x93, 0x28, 0x00, 0xB1, 0xF3, 0x02, 0xC6, 0x84, 0x60, 0x52, 0x35, 0xF9, 0x93, 0x45,
+    0x22, 0x98, 0xF2, 0xCD, 0xEC, 0xA4, 0x18, 0x78, 0x3F, 0xD4, 0x28, 0xFC, 0x42, 0x38, 0x33, 0x8D,
+    0x89, 0x47, 0x90, 0xB0, 0x39, 0x76, 0x2D, 0x13, 0xC3, 0x24, 0xE6, 0x05, 0x4C, 0xB1, 0x00, 0x58,
+    0xB0, 0x10, 0x15, 0x4B, 0xBC, 0x51, 0x10, 0x98, 0x4D, 0x8C, 0xF4, 0x2E, 0x98, 0xFD, 0x43, 0xDF,
+    0x9F, 0xBF, 0xC4, 0x0E, 0x98, 0x24, 0x12, 0xB3, 0x9E, 0xEF, 0x14, 0xF8, 0xB5, 0x8C, 0x59, 0x8A,
+    0x7F, 0x28, 0x44, 0x58, 0x5B, 0xE3, 0x23, 0x73, 0x29, 0x00, 0x4E, 0x21, 0x36, 0xDD, 0x12, 0x77,
+    0x36, 0x0C, 0x05, 0xA0, 0x6D, 0x39, 0x15, 0x67, 0xFB, 0x39, 0x86, 0x02, 0xC0, 0x64, 0x4B, 0x67,
+    0x37, 0x39, 0x8A, 0x02, 0x10, 0xB3, 0xEA, 0x85, 0xB3, 0x9D, 0x1C, 0x4E, 0x23, 0x90, 0xD6, 0x33,
+    0x2D, 0xEC, 0xD6, 0x5F, 0x95, 0x72, 0xB6, 0x12, 0x66, 0x3F, 0xEF, 0x4F, 0x0D, 0x40, 0xD7, 0x8A,
+    0xE4, 0x09, 0xBA, 0x56, 0xCE, 0x6E, 0xC0, 0x77, 0xCD, 0x4F, 0xEB, 0x33, 0x0F, 0xE3, 0x38, 0x18,
+    0x66, 0x65, 0x41, 0x85, 0x3E, 0xF3, 0xDC, 0xDC, 0x79, 0xC8, 0x77, 0xCB, 0x77, 0x7C, 0x80, 0x5C,
+    0xC0, 0x2D, 0xA0, 0x09, 0xD9, 0x34, 0x97, 0x91, 0x5D, 0x01, 0x15, 0x22, 0x4B, 0xC4, 0xD3, 0xFB,
+    0xC0, 0x62, 0x51, 0xB3, 0xF9, 0x41, 0x85, 0x91, 0x61, 0x48, 0x9A, 0x65, 0xF0, 0xFA, 0xC0, 0x34,
+    0xB5, 0xB6, 0xE5, 0xF0, 0xF9, 0xF2, 0xA9, 0xE9, 0xF9, 0x0D, 0xE8, 0x2C, 0xD3, 0xE5, 0x48, 0xF2,
+    0x68, 0x96, 0xAE, 0x58, 0x73, 0xA5, 0x6B, 0x6D, 0x23, 0xFC, 0x62, 0xA9, 0xF5, 0x99, 0xC5, 0xD8,
+    0x2B, 0xF1, 0xC6, 0x03, 0x41, 0x3B, 0x8E, 0x17, 0x80, 0x1D, 0xC7, 0x0B, 0xC0, 0x8E, 0xE3, 0x05,
+    0x60, 0xC7, 0xF1, 0x02, 0xB0, 0xE3, 0x78, 0x01, 0xD8, 0x71, 0xAC, 0x38, 0x40, 0x0C, 0xAC, 0xD0,
+    0xC9, 0xC4, 0x8F, 0x3E, 0x90, 0x9A, 0xE5, 0x51, 0x47, 0x1B, 0xC2, 0xF2, 0x8F, 0x5F, 0x3E, 0x4C,
+    0xE6, 0x20, 0x49, 0x9E, 0xA3, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38,
+    0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0x38, 0x8E, 0xE3, 0xC0, 0xBE, 0x7D, 0xFF, 0x07, 0x76, 0x24, 0x9E,
+    0x91, 0xB8, 0xEB, 0x1D, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60,
+    0x82,
+};
+
+// Settings.svg: 3119 bytes, 1546 bytes gzipped
+static const char Settings_svg_Path[] PROGMEM = "/Settings.svg";
+static const char Settings_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Settings_svg_ETag[] PROGMEM = "\"d3fcd6b67580bb45\"";
+static const uint8_t Settings_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x56, 0xDB, 0x6E, 0xDB, 0x46,
+    0x10, 0x7D, 0xB6, 0xBF, 0x82, 0x65, 0x5F, 0x97, 0xD4, 0xDE, 0x2F, 0x81, 0xE5, 0x00, 0x71, 0xDA,
+    0xA4, 0x40, 0xD2, 0x06, 0x75, 0xE2, 0xA2, 0x4F, 0x85, 0x42, 0x2B, 0x96, 0x10, 0x46, 0x12, 0x24,
+    0x45, 0x76, 0xF3, 0xF5, 0x3D, 0x67, 0x48, 0xF9, 0x92, 0x26, 0x8E, 0xE9, 0x59, 0xEE, 0x70, 0x2E,
+    0x67, 0xCE, 0xCC, 0xEE, 0xD9, 0xF3, 0xBB, 0x2F, 0x7D, 0x75, 0x98, 0x6F, 0x77, 0xCB, 0xF5, 0x6A,
+    0x5A, 0x9B, 0x56, 0xD7, 0xD5, 0x7C, 0xD5, 0xAD, 0xAF, 0x97, 0xAB, 0x9B, 0x69, 0xFD, 0x75, 0xFF,
+    0xA9, 0xC9, 0xF5, 0xF3, 0xF3, 0xD3, 0xD3, 0xB3, 0x9F, 0x5E, 0xFE, 0x71, 0xF1, 0xFE, 0xEF, 0x77,
+    0xBF, 0x54, 0xBB, 0xC3, 0x4D, 0xF5, 0xEE, 0xC3, 0x8B, 0x37, 0xBF, 0x5D, 0x54, 0x75, 0x33, 0x99,
+    0xFC, 0xE5, 0x2E, 0x26, 0x93, 0x97, 0xEF, 0x5F, 0x56, 0x97, 0x57, 0xAF, 0x2A, 0xD3, 0x9A, 0xC9,
+    0xE4, 0x97, 0xDF, 0xEB, 0xAA, 0x5E, 0xEC, 0xF7, 0x9B, 0x67, 0x93, 0xC9, 0xED, 0xED, 0x6D, 0x7B,
+    0xEB, 0xDA, 0xF5, 0xF6, 0x66, 0xF2, 0x6A, 0x3B, 0xDB, 0x2C, 0x96, 0xDD, 0x6E, 0x02, 0xC5, 0x09,
+    0x15, 0xF1, 0xD1, 0x04, 0xC6, 0x8C, 0x69, 0xAF, 0xF7, 0xD7, 0xF5, 0x39, 0x5C, 0x34, 0x4D, 0xF5,
+    0x61, 0xD3, 0xAF, 0x67, 0xD7, 0xF3, 0xEB, 0x6A, 0xBF, 0x7E, 0x26, 0x26, 0xFF, 0x9C, 0x6F, 0xD6,
+    0xAA, 0xA2, 0x1D, 0xE8, 0x6E, 0xB1, 0x68, 0xBB, 0xF5, 0x17, 0x55, 0xBD, 0x9A, 0xAF, 0xE6, 0xDB,
+    0xD9, 0x7E, 0xBD, 0x7D, 0xD0, 0xAA, 0xDE, 0x2E, 0xEF, 0xE6, 0xDB, 0xEA, 0xFD, 0x7A, 0xDD, 0xEF,
+    0xAA, 0xA6, 0x81, 0x41, 0x86, 0xFA, 0x69, 0xD9, 0xF7, 0xD3, 0xFA, 0xE7, 0x5F, 0xE5, 0x5F, 0xFD,
+    0x38, 0x53, 0x53, 0x57, 0xCB, 0xEB, 0x69, 0xFD, 0x66, 0xF6, 0xEF, 0x7C, 0xFB, 0x0F, 0x16, 0x00,
+    0x62, 0xB5, 0x9B, 0xFE, 0x20, 0x72, 0xAB, 0xB5, 0x66, 0xA4, 0xA3, 0xCA, 0xB3, 0xBB, 0x7E, 0xB9,
+    0xFA, 0xFC, 0x23, 0x45, 0x53, 0x4A, 0x99, 0xC8, 0x6E, 0x5D, 0x9D, 0x9E, 0x54, 0xB7, 0xCB, 0xEB,
+    0xFD, 0x62, 0x5A, 0x67, 0xAD, 0x37, 0x77, 0x75, 0xB5, 0x98, 0x2F, 0x6F, 0x16, 0xFB, 0xFB, 0xE5,
+    0x61, 0x39, 0xBF, 0x7D, 0xB1, 0xBE, 0x9B, 0xD6, 0xBA, 0xD2, 0x55, 0xE2, 0x7F, 0x02, 0x3F, 0xFB,
+    0xD8, 0xCF, 0x9B, 0x8F, 0xB3, 0xEE, 0xF3, 0xCD, 0x76, 0xFD, 0x75, 0x85, 0xE8, 0x56, 0xF3, 0xDB,
+    0xEA, 0x91, 0x06, 0x02, 0x78, 0xB6, 0xDB, 0xCC, 0xBA, 0xF9, 0xB4, 0xDE, 0x6C, 0xE7, 0xBB, 0xF9,
+    0xF6, 0x30, 0x27, 0x72, 0x37, 0xE7, 0xA7, 0x27, 0x67, 0x9B, 0xD9, 0x7E, 0x51, 0xE1, 0x93, 0xB7,
+    0x2E, 0xB4, 0x2E, 0x26, 0x65, 0x63, 0xEB, 0x6D, 0xEE, 0x1A, 0xDF, 0xC6, 0x9C, 0x94, 0x6E, 0x72,
+    0x1B, 0x94, 0x6B, 0xB3, 0x71, 0x22, 0xE1, 0x77, 0x27, 0x2B, 0x35, 0xAE, 0xE4, 0x0D, 0x7E, 0x9B,
+    0xFB, 0xB7, 0xD4, 0xBB, 0xF4, 0xBA, 0xD5, 0xC1, 0x8F, 0xC6, 0xD4, 0x13, 0xD3, 0xDF, 0x4E, 0x4F,
+    0x4E, 0xAA, 0xA3, 0x37, 0x6F, 0x06, 0x6F, 0xAE, 0x0D, 0x05, 0xCE, 0x22, 0x3E, 0xB7, 0x6D, 0x31,
+    0x22, 0xE0, 0x77, 0x77, 0x5C, 0xA8, 0xE3, 0x0B, 0xCA, 0x7C, 0xA9, 0xC6, 0x97, 0x97, 0x2E, 0xB7,
+    0x25, 0x1C, 0x0D, 0xA9, 0x27, 0x66, 0xBF, 0xD5, 0x93, 0x27, 0x19, 0x7A, 0x87, 0x0F, 0x11, 0x86,
+    0x69, 0x4B, 0x81, 0x4F, 0xDD, 0xFA, 0x68, 0xF0, 0x74, 0x3A, 0x36, 0x60, 0x70, 0xB6, 0x90, 0x4D,
+    0x86, 0xE8, 0x72, 0x54, 0xBA, 0xB5, 0xD9, 0x76, 0xB2, 0x1B, 0x14, 0x35, 0xB9, 0x99, 0x8A, 0xA2,
+    0xE2, 0xB0, 0xA9, 0x44, 0x11, 0xC9, 0x74, 0xAE, 0xC5, 0x86, 0x6D, 0x83, 0x61, 0x54, 0x4C, 0x3B,
+    0xB6, 0xC9, 0x1E, 0x65, 0x10, 0xD5, 0x46, 0xDB, 0x69, 0x7C, 0x14, 0x82, 0xA3, 0x29, 0x9F, 0x94,
+    0xE1, 0xCF, 0x8E, 0xCE, 0x65, 0xD5, 0x98, 0x8B, 0xA0, 0xDB, 0x4C, 0x88, 0x4A, 0x9B, 0x8C, 0x57,
+    0x3E, 0xB7, 0x16, 0x0B, 0xDF, 0xE6, 0x6C, 0xD4, 0x93, 0xB0, 0xBF, 0xCF, 0xE9, 0x08, 0xED, 0x80,
+    0xA3, 0x6E, 0x8B, 0x57, 0x1A, 0x91, 0x65, 0x06, 0xA9, 0x4B, 0x46, 0x58, 0xA9, 0x04, 0x09, 0xB8,
+    0x60, 0x57, 0xC7, 0xC2, 0xF7, 0x86, 0x6F, 0x8C, 0x13, 0x1D, 0x04, 0x8A, 0x5D, 0x1D, 0x07, 0xB9,
+    0x63, 0xAA, 0x88, 0x12, 0xAB, 0x9C, 0x0A, 0xD3, 0xB7, 0x8C, 0xB9, 0xA4, 0x0C, 0x19, 0x96, 0x98,
+    0x2E, 0x3E, 0x05, 0x1B, 0x90, 0x8E, 0xC7, 0xC3, 0x3A, 0x4B, 0xF0, 0x12, 0xB7, 0x93, 0x83, 0x68,
+    0xB2, 0xEF, 0xF8, 0xC6, 0xF3, 0x6B, 0x6B, 0x0D, 0xEA, 0x69, 0x2C, 0xB7, 0x1D, 0x34, 0x1D, 0x3C,
+    0x85, 0x41, 0x26, 0xB6, 0x02, 0x48, 0x63, 0x06, 0x50, 0xF0, 0xD7, 0x5C, 0x3A, 0xA4, 0x8C, 0xFC,
+    0xED, 0x93, 0x6A, 0xDA, 0x1F, 0x56, 0x33, 0xFA, 0xD6, 0x1A, 0xE0, 0x9E, 0xDA, 0x90, 0xDD, 0x02,
+    0xE4, 0xB0, 0x31, 0x0E, 0x45, 0x45, 0x0D, 0x19, 0x08, 0x3C, 0x87, 0xC0, 0xD2, 0x66, 0x94, 0xD6,
+    0xB7, 0x5A, 0x9B, 0xDE, 0xC2, 0x90, 0x67, 0x44, 0xC1, 0x74, 0xA6, 0x0D, 0x91, 0x01, 0xE3, 0xA9,
+    0x06, 0x19, 0x38, 0x07, 0xC1, 0x44, 0x9B, 0x26, 0xB4, 0xC1, 0x9A, 0x9E, 0xAC, 0x2E, 0x91, 0x4F,
+    0x9B, 0x98, 0x3A, 0xB3, 0x0C, 0xC3, 0xC3, 0xB4, 0x89, 0x8E, 0x00, 0x63, 0x81, 0xC1, 0x6C, 0xCB,
+    0x20, 0xEF, 0xB0, 0xD0, 0x89, 0x28, 0xFB, 0xE3, 0x86, 0x22, 0x28, 0xA5, 0xC7, 0x22, 0xB2, 0x8C,
+    0xD8, 0x10, 0x84, 0xBC, 0x17, 0x4B, 0x99, 0x7E, 0x93, 0x27, 0x8A, 0x1E, 0xD8, 0xF8, 0x51, 0xCE,
+    0xC9, 0x5F, 0x25, 0xA6, 0x2D, 0x88, 0xE3, 0x5B, 0xAB, 0x8B, 0xA8, 0x18, 0xA8, 0x64, 0xCF, 0x7E,
+    0x8B, 0xA3, 0xC8, 0xDC, 0x83, 0x06, 0xA1, 0x45, 0x09, 0x80, 0x3A, 0x66, 0x0C, 0xAF, 0xD1, 0xC5,
+    0x51, 0x76, 0xD4, 0x3B, 0x8C, 0x10, 0x59, 0xE1, 0x33, 0x83, 0x8B, 0x41, 0x82, 0x83, 0x19, 0xA3,
+    0xBD, 0xB0, 0xC6, 0xF5, 0x62, 0x85, 0x5D, 0xE8, 0x6D, 0xFC, 0x5F, 0xCA, 0x31, 0x24, 0xA6, 0x99,
+    0x2C, 0xF6, 0x93, 0xF4, 0x0A, 0x64, 0x29, 0x77, 0x44, 0x15, 0x99, 0xBA, 0xD0, 0xC5, 0x5B, 0x51,
+    0x48, 0xB4, 0x09, 0x05, 0x81, 0x31, 0x66, 0x25, 0x60, 0x76, 0x4F, 0x20, 0xC7, 0xD3, 0x67, 0x85,
+    0xE2, 0x08, 0x49, 0x49, 0xCC, 0x40, 0x27, 0x70, 0xCC, 0x5A, 0x39, 0xC3, 0xA0, 0x92, 0xF4, 0x6A,
+    0x92, 0x94, 0x08, 0x1A, 0x51, 0x48, 0x30, 0xC6, 0x32, 0x71, 0x3B, 0x28, 0x29, 0xEE, 0xEB, 0x48,
+    0x3E, 0x3C, 0x46, 0x01, 0xF9, 0xAB, 0xA1, 0xFA, 0x83, 0x4C, 0x37, 0xE6, 0x40, 0xB0, 0x12, 0xFA,
+    0x71, 0xD0, 0x63, 0x9E, 0x34, 0xE6, 0xB5, 0xC5, 0x3E, 0xB5, 0x44, 0x46, 0x00, 0x8B, 0x00, 0xB8,
+    0x82, 0x34, 0x44, 0x61, 0xBB, 0x02, 0x23, 0x33, 0x2A, 0x0A, 0x52, 0x8A, 0xE0, 0xC7, 0x5E, 0x90,
+    0xF2, 0x6C, 0xFF, 0xE4, 0x1F, 0xE7, 0x66, 0x46, 0x19, 0xD8, 0x46, 0xB6, 0x02, 0x22, 0x44, 0x6E,
+    0xC9, 0x99, 0x5E, 0x60, 0x80, 0xA5, 0xE2, 0xDC, 0xD0, 0x4E, 0x89, 0xB9, 0xE3, 0x21, 0x94, 0xA2,
+    0xA3, 0x62, 0xD5, 0x3D, 0x73, 0x8A, 0xDD, 0x09, 0xA3, 0xC8, 0x6C, 0x76, 0xC6, 0x91, 0x6A, 0xD1,
+    0xF7, 0x18, 0x08, 0xD9, 0x8B, 0xFF, 0x4E, 0x90, 0x51, 0x42, 0x27, 0xA8, 0x0C, 0xD5, 0xF4, 0x86,
+    0xC8, 0x1E, 0x2B, 0x9B, 0x0E, 0xCC, 0x47, 0x4A, 0xFA, 0x90, 0x7B, 0x4C, 0x0E, 0x81, 0x98, 0x40,
+    0x08, 0x07, 0x9E, 0x40, 0x46, 0xE2, 0xA4, 0xD3, 0x88, 0xA3, 0x12, 0xA2, 0x71, 0xB0, 0xC4, 0x41,
+    0x14, 0x9D, 0x43, 0x23, 0xD6, 0x3A, 0x19, 0x61, 0xC0, 0x07, 0x8D, 0x5D, 0x84, 0x1A, 0xEA, 0x9E,
+    0xC0, 0xE0, 0x12, 0x40, 0xB1, 0xEA, 0x9E, 0x49, 0x8F, 0x13, 0xCD, 0xE8, 0x04, 0xE1, 0x06, 0x13,
+    0x92, 0xB1, 0x4A, 0x22, 0x8D, 0x3C, 0x92, 0x0C, 0xC4, 0xB2, 0x95, 0xFD, 0x60, 0x07, 0xA2, 0x01,
+    0xB9, 0x82, 0x2E, 0x18, 0x68, 0x44, 0x74, 0xED, 0x23, 0xBC, 0x63, 0x73, 0xCF, 0x22, 0xED, 0x1B,
+    0xB2, 0x88, 0x4E, 0xA5, 0x3C, 0x86, 0x5C, 0x4F, 0xD6, 0x77, 0xC2, 0x22, 0x69, 0x3D, 0x27, 0xF8,
+    0x48, 0x7B, 0xF8, 0x81, 0x24, 0x41, 0x9A, 0x29, 0x8E, 0x55, 0x7F, 0x48, 0xDE, 0x45, 0x4F, 0xEF,
+    0xC5, 0x8D, 0xB2, 0x30, 0x80, 0xE9, 0x83, 0x45, 0x70, 0x70, 0x11, 0x23, 0xE7, 0x8F, 0x72, 0xC4,
+    0x01, 0x27, 0xD2, 0x70, 0xE0, 0x0D, 0x43, 0x49, 0x3D, 0x19, 0x51, 0xDF, 0xAA, 0xB7, 0xD1, 0x0E,
+    0xBA, 0xE3, 0xC8, 0x4A, 0x70, 0x68, 0x64, 0x64, 0xA1, 0x00, 0xEC, 0x85, 0xC4, 0x43, 0x23, 0x26,
+    0x3A, 0x49, 0x90, 0x0B, 0x5C, 0xF9, 0x1E, 0xAC, 0x2C, 0x52, 0x1F, 0xEF, 0xC7, 0x79, 0x44, 0xEE,
+    0x24, 0x2B, 0xD9, 0xE1, 0x75, 0xE1, 0x51, 0x1D, 0x0D, 0x89, 0x9F, 0x1C, 0xF1, 0xD2, 0xC0, 0x05,
+    0xBD, 0x50, 0x58, 0x15, 0x87, 0x21, 0x5D, 0x46, 0x39, 0x9B, 0x43, 0x02, 0xC3, 0x2D, 0xE6, 0xC5,
+    0xA1, 0x11, 0x09, 0xE7, 0xEE, 0xE0, 0x1D, 0xE9, 0x94, 0x21, 0x00, 0x9C, 0xDE, 0x51, 0x46, 0x21,
+    0x02, 0xA0, 0x79, 0x2F, 0xED, 0x15, 0x4B, 0x7A, 0x63, 0xE8, 0x46, 0x05, 0x92, 0x8E, 0xAE, 0x3D,
+    0x27, 0x82, 0xC7, 0x91, 0xE4, 0xE8, 0x19, 0x75, 0x13, 0xFF, 0x9C, 0xF0, 0x11, 0xDE, 0x11, 0x38,
+    0x6D, 0x98, 0xD0, 0x48, 0x12, 0xAF, 0x05, 0xA4, 0x43, 0x13, 0x17, 0x05, 0x87, 0x87, 0xED, 0x06,
+    0xA7, 0x2C, 0x42, 0xE2, 0xA8, 0xCD, 0xD2, 0x82, 0x49, 0xBC, 0x87, 0x48, 0xB7, 0x48, 0x99, 0xCE,
+    0xAD, 0xED, 0x8F, 0x13, 0x38, 0xC5, 0xC1, 0xAB, 0xC5, 0x99, 0x0A, 0xDF, 0x31, 0x75, 0x92, 0xAF,
+    0xF8, 0xB6, 0x9C, 0x1A, 0x12, 0xB5, 0xF5, 0x45, 0xDD, 0x67, 0xA0, 0xFD, 0x95, 0xF8, 0x5D, 0xC4,
+    0x43, 0xC1, 0x41, 0x66, 0x3A, 0x99, 0x4D, 0x41, 0xEE, 0x0D, 0x31, 0x8A, 0x73, 0x75, 0x04, 0x87,
+    0xE9, 0xC2, 0x6C, 0xB1, 0xE2, 0x3C, 0x91, 0x6A, 0x3E, 0x0C, 0x13, 0x6B, 0x04, 0x9A, 0xBD, 0x82,
+    0x76, 0xF2, 0xEC, 0x0C, 0xD2, 0x74, 0x80, 0x1B, 0x10, 0x7B, 0x36, 0x76, 0x60, 0x55, 0x12, 0x6A,
+    0xC3, 0x0C, 0x16, 0x52, 0xD9, 0xAB, 0xA1, 0xCE, 0xDF, 0x9F, 0x5B, 0x36, 0x23, 0x2F, 0xF4, 0x09,
+    0x42, 0xC6, 0x99, 0xCC, 0x38, 0x49, 0x4F, 0x5C, 0x1E, 0x1A, 0xB9, 0x30, 0x34, 0x72, 0x79, 0x18,
+    0xE5, 0xE3, 0xE5, 0x61, 0x38, 0x2B, 0x9B, 0xF1, 0x9C, 0xE4, 0xCF, 0xEE, 0xF1, 0xB1, 0x89, 0x8E,
+    0x06, 0x6D, 0x65, 0x3A, 0x04, 0x9C, 0xF9, 0x06, 0x3D, 0x80, 0x6B, 0x45, 0xC4, 0x71, 0xA6, 0x0C,
+    0x2E, 0x4B, 0xE3, 0x98, 0x41, 0xCB, 0xF1, 0xE8, 0xE6, 0xF8, 0x77, 0x6C, 0x33, 0xCC, 0x90, 0x28,
+    0xB7, 0x92, 0x51, 0xEE, 0x78, 0xDA, 0x7B, 0x39, 0xFB, 0xA3, 0xA7, 0x33, 0x13, 0xF8, 0x45, 0x76,
+    0x41, 0x1C, 0xE7, 0x0B, 0x5C, 0x4E, 0x34, 0x6E, 0x3F, 0x1E, 0x1C, 0xC5, 0xA0, 0x46, 0x1E, 0x1C,
+    0x19, 0xC8, 0xA3, 0x14, 0x59, 0x3D, 0x64, 0x25, 0x29, 0x9F, 0x4D, 0x6E, 0xF8, 0xC0, 0x0D, 0xF8,
+    0xFC, 0x3F, 0x3D, 0x3D, 0xE7, 0xA3, 0x2F, 0x0C, 0x00, 0x00,
+};
+
+// Upload.svg: 1184 bytes, 605 bytes gzipped
+static const char Upload_svg_Path[] PROGMEM = "/Upload.svg";
+static const char Upload_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Upload_svg_ETag[] PROGMEM = "\"b159a9612bc4888c\"";
+static const uint8_t Upload_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5D, 0x53, 0xCB, 0x6E, 0xDB, 0x30,
+    0x10, 0xBC, 0xF7, 0x2B, 0xB6, 0xEC, 0x35, 0xA6, 0xB9, 0x24, 0xC5, 0x47, 0x10, 0x25, 0x40, 0x05,
+    0xB4, 0x3E, 0x38, 0x97, 0x3E, 0x7C, 0xC8, 0x2D, 0x88, 0x14, 0x5B, 0x80, 0x62, 0x19, 0xB2, 0x62,
+    0xFB, 0xF3, 0xBB, 0x4B, 0xEB, 0x61, 0xD4, 0x30, 0xC8, 0x1D, 0x6A, 0x76, 0x67, 0x76, 0x45, 0x3D,
+    0x3C, 0x5D, 0x3E, 0x1A, 0x38, 0x55, 0xDD, 0xB1, 0x6E, 0xF7, 0xB9, 0x40, 0xA9, 0x04, 0x54, 0xFB,
+    0xB7, 0xB6, 0xAC, 0xF7, 0xDB, 0x5C, 0x7C, 0xF6, 0xEF, 0x8B, 0x20, 0x9E, 0x1E, 0x1F, 0xBE, 0x2E,
+    0x16, 0xF0, 0xF7, 0xD0, 0xB4, 0xAF, 0x65, 0x55, 0x42, 0xDF, 0xDE, 0xC3, 0xEF, 0xCD, 0x4F, 0xF8,
+    0x55, 0x1D, 0xDA, 0x3B, 0x38, 0x9F, 0xCF, 0xF2, 0x78, 0xDA, 0x76, 0x04, 0xE4, 0x5B, 0xFB, 0x71,
+    0x07, 0x3F, 0xAB, 0x7D, 0xD5, 0xBD, 0xF6, 0x6D, 0x37, 0xB3, 0xE0, 0xB9, 0xBE, 0x54, 0x1D, 0xFC,
+    0x69, 0xDB, 0xE6, 0x08, 0x8B, 0xC5, 0xE3, 0x97, 0x07, 0xCA, 0x80, 0x73, 0x5D, 0xF6, 0xBB, 0x5C,
+    0x04, 0xA5, 0x0E, 0x17, 0x01, 0xBB, 0xAA, 0xDE, 0xEE, 0xFA, 0x09, 0x9E, 0xEA, 0xEA, 0xFC, 0xBD,
+    0xBD, 0xE4, 0x42, 0x81, 0x02, 0x6D, 0xE9, 0x2F, 0xE0, 0xBD, 0x6E, 0x9A, 0x5C, 0x7C, 0xFB, 0x91,
+    0x7E, 0x02, 0xC8, 0xF9, 0xFE, 0x98, 0x8B, 0x5D, 0xDF, 0x1F, 0xEE, 0x97, 0x4B, 0xF6, 0x71, 0x36,
+    0xB2, 0xED, 0xB6, 0x4B, 0xAD, 0x94, 0x5A, 0x92, 0x82, 0x20, 0xA1, 0xC3, 0x6B, 0xBF, 0x4B, 0x89,
+    0x8B, 0xEE, 0xB3, 0xA9, 0x72, 0x51, 0x9D, 0xAA, 0x7D, 0x5B, 0x96, 0x02, 0xDE, 0x9A, 0xFA, 0xF0,
+    0xFF, 0x59, 0x99, 0x8B, 0xE7, 0x00, 0xA8, 0x8A, 0x00, 0x5E, 0xFA, 0xA8, 0x82, 0x83, 0x38, 0xEC,
+    0x0E, 0x50, 0x83, 0x2B, 0xD0, 0x4A, 0xAD, 0x22, 0x32, 0x74, 0x13, 0x87, 0x42, 0x54, 0x1B, 0xC4,
+    0x15, 0xFA, 0x02, 0x83, 0x8C, 0xC6, 0x00, 0x22, 0x68, 0x25, 0x33, 0x4A, 0x92, 0x99, 0xF3, 0x43,
+    0x6C, 0x65, 0x56, 0x5C, 0x23, 0x27, 0x2D, 0x93, 0x06, 0x2E, 0x49, 0x7A, 0x5A, 0x57, 0x48, 0xF5,
+    0x33, 0x69, 0xAD, 0xF7, 0xE9, 0x2C, 0x63, 0xC2, 0x15, 0x51, 0x18, 0x8B, 0xB4, 0xCA, 0x2C, 0xD3,
+    0x94, 0x32, 0xD0, 0xB4, 0x62, 0x71, 0xAD, 0x58, 0x99, 0x2A, 0x2B, 0xE3, 0x19, 0x81, 0xD6, 0x2C,
+    0xE2, 0x65, 0x96, 0xB0, 0x9E, 0xB4, 0x53, 0x84, 0xD2, 0xFB, 0x68, 0x92, 0x25, 0x6D, 0x33, 0x6A,
+    0x30, 0xC3, 0x18, 0x3D, 0xD3, 0xA3, 0x8E, 0xDC, 0xB0, 0xF2, 0x41, 0xDB, 0x82, 0xB0, 0x0D, 0x8E,
+    0x7A, 0xA6, 0x86, 0x35, 0x26, 0x49, 0x1A, 0xAB, 0x01, 0xCB, 0x83, 0xB0, 0x05, 0x59, 0xA7, 0x2C,
+    0x4B, 0xD0, 0x51, 0x01, 0x13, 0x70, 0x22, 0x3A, 0x2A, 0xA0, 0xCC, 0x5C, 0xC8, 0x48, 0xEB, 0xB3,
+    0x0C, 0x67, 0xA1, 0x1B, 0x13, 0x38, 0x5A, 0xC3, 0x1B, 0xC3, 0x46, 0x46, 0xA7, 0x2D, 0x3B, 0x04,
+    0xEE, 0x70, 0x15, 0x48, 0x8C, 0xBA, 0xD6, 0x81, 0x4F, 0xE2, 0x34, 0x03, 0x8E, 0x8A, 0x38, 0xCD,
+    0x68, 0xE4, 0xD0, 0xE4, 0x78, 0x59, 0xF9, 0x82, 0x0C, 0xBB, 0x34, 0x49, 0x33, 0x8F, 0xDC, 0x8C,
+    0x82, 0x66, 0x7E, 0x39, 0x03, 0x0F, 0x81, 0x97, 0x55, 0xD8, 0xA0, 0x7A, 0x79, 0xA6, 0x6E, 0xBD,
+    0xF2, 0x08, 0x68, 0xA4, 0xA6, 0xB1, 0xAC, 0x89, 0x7A, 0xC5, 0x2A, 0xE1, 0x82, 0xB0, 0x41, 0xC7,
+    0x4D, 0x46, 0xA5, 0x0D, 0x27, 0x4A, 0x17, 0x8C, 0xBD, 0xC5, 0xCC, 0x1B, 0xF9, 0xEB, 0xC0, 0x5B,
+    0x88, 0x63, 0xBD, 0xC2, 0x8F, 0x3C, 0x73, 0xCD, 0x9B, 0xB0, 0xBD, 0xD6, 0x9D, 0xF8, 0x36, 0xE9,
+    0xD2, 0x04, 0x98, 0xA6, 0xD3, 0x5B, 0x88, 0x9E, 0x75, 0x89, 0x96, 0x85, 0x1B, 0xCC, 0x34, 0x1C,
+    0xF9, 0x6B, 0x4C, 0xD6, 0x2D, 0x5A, 0xBD, 0xE1, 0x9B, 0x83, 0xF3, 0xCD, 0xC1, 0xF9, 0xE6, 0x68,
+    0x5A, 0xB9, 0x93, 0xF4, 0x80, 0x0F, 0xCC, 0x4C, 0xE3, 0x70, 0x33, 0x94, 0x58, 0xF3, 0xAD, 0x4F,
+    0xDD, 0x0C, 0x6E, 0x68, 0x4F, 0xAE, 0x47, 0x75, 0xDA, 0x93, 0xEB, 0x1B, 0x7C, 0x9D, 0xD6, 0xC8,
+    0x77, 0xC3, 0xF9, 0xD0, 0xDD, 0x84, 0xCD, 0x54, 0xE7, 0x76, 0xDA, 0x2F, 0x62, 0x49, 0x5F, 0x2E,
+    0x7F, 0xC1, 0x8F, 0xFF, 0x00, 0xAD, 0x8D, 0x35, 0x6E, 0xA0, 0x04, 0x00, 0x00,
+};
+
+// styles.css: 2932 bytes, 909 bytes gzipped
+static const char styles_css_Path[] PROGMEM = "/styles.css";
+static const char styles_css_ContentType[] PROGMEM = "text/css";
+static const char styles_css_ETag[] PROGMEM = "\"5a7f5aa3af1ddd10\"";
+static const uint8_t styles_css_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x85, 0x56, 0xCB, 0x6E, 0xDB, 0x30,
+    0x10, 0x3C, 0xC7, 0x5F, 0xC1, 0x4B, 0x81, 0x24, 0xA8, 0x14, 0x3B, 0x41, 0x80, 0xC2, 0xBE, 0x14,
+    0x3D, 0xF4, 0x50, 0xF4, 0x96, 0x2F, 0x58, 0x89, 0xB4, 0x44, 0x94, 0x22, 0x55, 0x8A, 0x8A, 0xED,
+    0x14, 0xF9, 0xF7, 0x2E, 0x5F, 0x12, 0x65, 0x59, 0xB6, 0x4F, 0xF2, 0x8A, 0x3B, 0x3B, 0x3B, 0xFB,
+    0xA0, 0x6A, 0xD3, 0x08, 0xB2, 0xFA, 0xB7, 0x22, 0xF8, 0x2B, 0xA0, 0xFC, 0x53, 0x69, 0xD5, 0x4B,
+    0x9A, 0x95, 0x4A, 0x28, 0xBD, 0x25, 0x82, 0x57, 0xB5, 0xA9, 0x34, 0x63, 0x72, 0xE7, 0x4E, 0xEC,
+    0x95, 0x34, 0xD9, 0x1E, 0x1A, 0x2E, 0x4E, 0x5B, 0xD2, 0x81, 0xEC, 0xB2, 0x8E, 0x69, 0xBE, 0xDF,
+    0xAD, 0x3E, 0x57, 0xAB, 0x9A, 0x01, 0x65, 0x3A, 0x62, 0xB9, 0x93, 0x1D, 0xFF, 0x60, 0x5B, 0xF2,
+    0xCC, 0x9A, 0xC4, 0xFB, 0xC0, 0x2C, 0xE6, 0x96, 0x14, 0x4A, 0xD0, 0xDD, 0x42, 0xD8, 0x24, 0x62,
+    0xB0, 0x1C, 0x6A, 0x6E, 0x98, 0xB7, 0xB4, 0x40, 0x29, 0x97, 0xD5, 0x96, 0xAC, 0xF3, 0xE7, 0xD7,
+    0x08, 0xDD, 0x80, 0xAE, 0xB8, 0xCC, 0x0A, 0x65, 0x8C, 0x6A, 0xEC, 0x2B, 0xF7, 0x66, 0x64, 0x95,
+    0xAB, 0x96, 0xC9, 0xC2, 0xC8, 0xC0, 0x2E, 0xA0, 0x52, 0xD0, 0x18, 0x19, 0x4E, 0x1E, 0xC3, 0xB0,
+    0xA3, 0xC9, 0x28, 0x2B, 0x95, 0x06, 0xC3, 0x95, 0xDC, 0x12, 0xA9, 0xE4, 0x34, 0x66, 0xA6, 0x3D,
+    0xF7, 0x39, 0xBC, 0x50, 0x95, 0x1A, 0xB0, 0xA5, 0x61, 0x12, 0x4F, 0xF5, 0x5A, 0xDC, 0xFF, 0x46,
+    0x7B, 0xDE, 0xCA, 0xEA, 0xC1, 0xE3, 0xD4, 0x21, 0xF9, 0x4D, 0x42, 0x7D, 0x2F, 0x14, 0xA0, 0xC9,
+    0x41, 0x3B, 0x4C, 0x09, 0xEF, 0x73, 0x11, 0x37, 0xF9, 0xE0, 0x30, 0x80, 0xAC, 0xD7, 0x5F, 0xBC,
+    0xE5, 0xC0, 0xA9, 0xA9, 0x91, 0xD6, 0x8E, 0x3C, 0x3D, 0x92, 0x37, 0x03, 0xDA, 0x90, 0x9A, 0x53,
+    0x8A, 0x1A, 0x92, 0xB2, 0x06, 0x59, 0x31, 0x4A, 0x8A, 0x13, 0xF9, 0x05, 0xEF, 0xF0, 0x56, 0x6A,
+    0xDE, 0x1A, 0xF2, 0xF8, 0xE4, 0xD3, 0x52, 0x1D, 0xF7, 0xA9, 0xEE, 0xF9, 0x91, 0x85, 0x72, 0x7C,
+    0x64, 0x5C, 0x52, 0x76, 0x44, 0xFC, 0x20, 0x8B, 0x6A, 0x2D, 0xB4, 0x7B, 0x16, 0x6C, 0x6F, 0x86,
+    0x3F, 0xF3, 0xBA, 0x15, 0x02, 0x4D, 0xFE, 0xA5, 0x7A, 0x67, 0x1A, 0x33, 0x3B, 0x64, 0x08, 0x14,
+    0xB8, 0x4C, 0x94, 0x74, 0xA8, 0x43, 0x67, 0x18, 0x8D, 0xBD, 0x14, 0xA8, 0xA0, 0xB8, 0x9D, 0xD5,
+    0x81, 0x10, 0xAB, 0x04, 0xC9, 0x4B, 0xA1, 0x3A, 0x36, 0x96, 0x6E, 0xE4, 0x0C, 0x45, 0xA7, 0x44,
+    0x1F, 0xDB, 0x22, 0xA5, 0x39, 0x2B, 0x93, 0x05, 0x82, 0x08, 0x30, 0xF6, 0xCF, 0x20, 0xE9, 0x95,
+    0xD2, 0x0F, 0x2D, 0x19, 0xDB, 0x84, 0xF2, 0xAE, 0x15, 0x70, 0xB2, 0xD9, 0x2A, 0x9B, 0xED, 0xC0,
+    0x14, 0xB6, 0xB5, 0xCD, 0x7A, 0xDA, 0x62, 0xA1, 0x71, 0x91, 0x43, 0xCE, 0xB1, 0x33, 0xE2, 0x78,
+    0x84, 0x8A, 0x6D, 0x22, 0x81, 0x59, 0x83, 0xCD, 0xFA, 0xC3, 0x4A, 0xEF, 0x71, 0x8A, 0x1E, 0x9B,
+    0x3C, 0xCA, 0x31, 0xB0, 0xE1, 0x52, 0x70, 0xC9, 0xB2, 0x40, 0x6A, 0x69, 0x04, 0x6F, 0x27, 0x9A,
+    0x4C, 0xDA, 0xD5, 0xC1, 0xBC, 0x24, 0x63, 0xA1, 0x34, 0x4E, 0x43, 0x0A, 0xEA, 0x2D, 0x99, 0x06,
+    0xCA, 0xFB, 0x6E, 0x72, 0xD6, 0x4F, 0x6C, 0x5A, 0xA4, 0x7C, 0x2F, 0xD8, 0x31, 0xB3, 0xE3, 0x03,
+    0x98, 0x89, 0x3E, 0x4F, 0xD0, 0xBE, 0x8D, 0x8A, 0xE0, 0x39, 0xDB, 0x5C, 0x38, 0x35, 0xEA, 0x40,
+    0x0E, 0x1A, 0x5A, 0x07, 0xD0, 0xB1, 0xD2, 0x26, 0x75, 0x6B, 0x9B, 0xC5, 0x42, 0xAA, 0x16, 0x4A,
+    0x6E, 0x10, 0xF9, 0x5B, 0x9C, 0xA3, 0x9B, 0xFC, 0x37, 0xEB, 0xF6, 0x78, 0x96, 0xFE, 0x68, 0x3A,
+    0xDB, 0x41, 0xB3, 0x17, 0x3A, 0x8E, 0xAD, 0xB5, 0x8F, 0x74, 0x49, 0xBD, 0xB9, 0x3A, 0xEE, 0xAE,
+    0x64, 0x80, 0xDC, 0x51, 0xAC, 0x12, 0x17, 0x0B, 0xD3, 0x13, 0xD4, 0xB4, 0xEF, 0x17, 0xB7, 0x60,
+    0xDE, 0x42, 0x35, 0x28, 0x7A, 0x39, 0xCC, 0x90, 0xD0, 0xEB, 0x42, 0x3E, 0xAF, 0x81, 0xB6, 0xC7,
+    0x22, 0x5D, 0x0B, 0xF2, 0x7C, 0xA2, 0x06, 0xD7, 0xB9, 0xF6, 0x27, 0x26, 0xB0, 0x60, 0x93, 0x4E,
+    0x0B, 0xDB, 0x62, 0x84, 0x84, 0x45, 0xBC, 0x85, 0xB6, 0x4D, 0x5C, 0x6F, 0xCC, 0x5E, 0xA5, 0x39,
+    0x3D, 0x6F, 0x28, 0x6B, 0xF3, 0xF0, 0xF6, 0x29, 0x33, 0xAC, 0x41, 0xBB, 0x61, 0x96, 0x71, 0xDF,
+    0x48, 0x57, 0x6D, 0xD6, 0x10, 0xE8, 0x8D, 0x8A, 0x7A, 0x1C, 0xB3, 0x30, 0xB7, 0x2F, 0xEB, 0x28,
+    0x9B, 0x73, 0xAD, 0xA0, 0x9D, 0xA8, 0x6D, 0x8D, 0x44, 0x40, 0xC1, 0x86, 0xAB, 0x35, 0x2D, 0xE2,
+    0xB8, 0xE9, 0xFD, 0x41, 0x2E, 0xDB, 0xDE, 0x84, 0x73, 0x0E, 0xCE, 0x13, 0xC0, 0xA9, 0x75, 0x87,
+    0x5A, 0xCD, 0x2E, 0x15, 0x6E, 0x5C, 0x10, 0x73, 0xB1, 0x93, 0x19, 0x9E, 0x6F, 0xE6, 0xF3, 0xC1,
+    0xC5, 0x10, 0x06, 0x0A, 0x11, 0x83, 0x84, 0x8E, 0x47, 0x3F, 0x01, 0x6D, 0x87, 0xA1, 0xE2, 0x93,
+    0x3F, 0x49, 0xBF, 0x9A, 0x1A, 0x4F, 0xDE, 0xC5, 0x85, 0x15, 0x6E, 0x04, 0x0F, 0x75, 0x77, 0xF9,
+    0x9E, 0x4C, 0x47, 0xCB, 0xD4, 0x5C, 0x12, 0xDC, 0xDB, 0x98, 0xB7, 0x9F, 0x44, 0x07, 0x7A, 0x55,
+    0x25, 0x43, 0x51, 0x27, 0x68, 0xEB, 0x09, 0xC1, 0x74, 0x48, 0x53, 0xB7, 0x61, 0x4D, 0x7E, 0x6F,
+    0x18, 0xE5, 0x40, 0xBA, 0xD2, 0xAE, 0x2C, 0x02, 0x92, 0x92, 0xFB, 0xA4, 0x80, 0x78, 0x77, 0xE2,
+    0x18, 0x3E, 0xC4, 0xB8, 0x31, 0x82, 0xFD, 0xE3, 0x4D, 0x93, 0x4E, 0x19, 0x43, 0x7D, 0xBA, 0xB2,
+    0xD9, 0x56, 0xD9, 0xFC, 0x00, 0xDB, 0x6E, 0x77, 0x73, 0xF5, 0xB1, 0x49, 0xF1, 0xCA, 0x9D, 0xC8,
+    0x1F, 0x4D, 0xD1, 0xF9, 0x79, 0xD1, 0xF9, 0xC2, 0x9C, 0x44, 0x53, 0x74, 0x7E, 0x59, 0x74, 0x2E,
+    0x44, 0x7F, 0x5E, 0xF6, 0x3E, 0x44, 0xA5, 0x4C, 0x18, 0x30, 0x37, 0xC2, 0xCE, 0xBF, 0xBB, 0x26,
+    0x76, 0xBF, 0xA3, 0xD5, 0x61, 0x11, 0xC5, 0x2D, 0xD8, 0x19, 0x89, 0xC4, 0xEA, 0x10, 0x34, 0xFB,
+    0xBB, 0x88, 0x60, 0xBF, 0xC8, 0x66, 0x00, 0xA3, 0xD1, 0xFA, 0xAB, 0x7E, 0x39, 0x8D, 0x79, 0x02,
+    0x09, 0x75, 0x2E, 0x17, 0xFD, 0x74, 0xFC, 0xF8, 0x49, 0xFF, 0xBB, 0xBB, 0x16, 0xF4, 0x4F, 0x2E,
+    0xC4, 0x52, 0xB4, 0x78, 0x95, 0x4C, 0x0C, 0xD6, 0x0F, 0xCB, 0x64, 0x4E, 0x3E, 0xDC, 0xE4, 0xAA,
+    0x59, 0xDB, 0xD7, 0xFF, 0x01, 0xC2, 0x67, 0x8B, 0x89, 0x74, 0x0B, 0x00, 0x00,
+};
+
+const StaticFile StaticFiles[] =
+{
+    { Binary_svg_Path, Binary_svg_ContentType, Binary_svg_ETag, Binary_svg_Data, sizeof(Binary_svg_Data), true },
+    { Graph_svg_Path, Graph_svg_ContentType, Graph_svg_ETag, Graph_svg_Data, sizeof(Graph_svg_Data), true },
+    { Home_svg_Path, Home_svg_ContentType, Home_svg_ETag, Home_svg_Data, sizeof(Home_svg_Data), true },
+    { List_svg_Path, List_svg_ContentType, List_svg_ETag, List_svg_Data, sizeof(List_svg_Data), true },
+    { LogFile_svg_Path, LogFile_svg_ContentType, LogFile_svg_ETag, LogFile_svg_Data, sizeof(LogFile_svg_Data), true },
+    { Logo_png_Path, Logo_png_ContentType, Logo_png_ETag, Logo_png_Data, sizeof(Logo_png_Data), false },
+    { Settings_svg_Path, Settings_svg_ContentType, Settings_svg_ETag, Settings_svg_Data, sizeof(Settings_svg_Data), true },
+    { Upload_svg_Path, Upload_svg_ContentType, Upload_svg_ETag, Upload_svg_Data, sizeof(Upload_svg_Data), true },
+    { styles_css_Path, styles_css_ContentType, styles_css_ETag, styles_css_Data, sizeof(styles_css_Data), true },
+};
+
+const size_t StaticFileCount = sizeof(StaticFiles) / sizeof(StaticFiles[0]);
+
+#endif
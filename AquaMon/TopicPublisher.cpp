@@ -0,0 +1,57 @@
+#include <Arduino.h>
+#include "TopicPublisher.h"
+
+// Constructor
+TopicPublisher::TopicPublisher(Aquarea& heatPump, WiFiMQTTClient& mqttClient)
+    : _heatPump(heatPump), _mqttClient(mqttClient)
+{
+    _topicPrefix[0] = 0;
+    memset(_minIntervals, 0, sizeof(_minIntervals));
+    memset(_lastPublishMillis, 0, sizeof(_lastPublishMillis));
+}
+
+
+void TopicPublisher::begin(const char* topicPrefix)
+{
+    strncpy(_topicPrefix, topicPrefix, sizeof(_topicPrefix) - 1);
+    _topicPrefix[sizeof(_topicPrefix) - 1] = 0;
+    publishAll();
+}
+
+
+int TopicPublisher::publish()
+{
+    if (_pendingTopics.none())
+        return 0;
+
+    char topicName[MQTT_TOPIC_PREFIX_SIZE + 40];
+    size_t prefixLength = strlen(_topicPrefix);
+    memcpy(topicName, _topicPrefix, prefixLength);
+    topicName[prefixLength++] = '/';
+    topicName[sizeof(topicName) - 1] = 0;
+
+    uint32_t currentMillis = millis();
+    int published = 0;
+    for (int i = 0; i < NUMBER_OF_TOPICS; i++)
+    {
+        if (!_pendingTopics.test(i))
+            continue;
+        if (_publishedTopics.test(i) && (currentMillis - _lastPublishMillis[i] < _minIntervals[i] * 1000UL))
+            continue;
+
+        Topic topic = _heatPump.getTopic(static_cast<TopicId>(i));
+        strncpy_P(topicName + prefixLength, topic.getNameP(), sizeof(topicName) - prefixLength - 1);
+        char value[16];
+        topic.formatValue(value, sizeof(value));
+        if (!_mqttClient.publish(topicName, value, true))
+            break;
+
+        _pendingTopics.reset(i);
+        _publishedTopics.set(i);
+        _lastPublishMillis[i] = currentMillis;
+        published++;
+    }
+
+    _mqttClient.flush();
+    return published;
+}
@@ -0,0 +1,47 @@
+#include <WiFiMQTT.h>
+#include "Aquarea.h"
+
+#define MQTT_TOPIC_PREFIX_SIZE 32
+
+// Publishes the Aquarea topics which changed to an MQTT broker, as "<prefix>/<topic name>" (retained).
+// Changed topics are collected (see addChangedTopics) and published in one batch.
+// A topic which changes again within its minimum interval is published once the interval has passed (with its last value).
+class TopicPublisher
+{
+    public:
+        // Constructor
+        TopicPublisher(Aquarea& heatPump, WiFiMQTTClient& mqttClient);
+
+        void begin(const char* topicPrefix);
+
+        // Minimum time (s) between publishing a topic; 0 by default.
+        void setMinInterval(TopicId id, uint16_t seconds)
+        {
+            _minIntervals[static_cast<int>(id)] = seconds;
+        }
+
+        void addChangedTopics(const TopicSet& topics)
+        {
+            _pendingTopics |= topics;
+        }
+
+        // Publishes all topics (e.g. after (re)connecting), regardless of the minimum intervals.
+        void publishAll()
+        {
+            _pendingTopics.set();
+            _publishedTopics.reset();
+        }
+
+        // Publishes the pending topics for which the minimum interval has passed.
+        // Returns the number of topics published.
+        int publish();
+
+    private:
+        Aquarea& _heatPump;
+        WiFiMQTTClient& _mqttClient;
+        char _topicPrefix[MQTT_TOPIC_PREFIX_SIZE];
+        TopicSet _pendingTopics;
+        TopicSet _publishedTopics;
+        uint16_t _minIntervals[NUMBER_OF_TOPICS];
+        uint32_t _lastPublishMillis[NUMBER_OF_TOPICS];
+};
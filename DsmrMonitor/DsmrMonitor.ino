@@ -7,21 +7,36 @@
 #include <TimeUtils.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <ChunkedResponse.h>
 #include <HtmlWriter.h>
+#include <JsonWriter.h>
+#include <BinaryLogWriter.h>
+#include <LogCursor.h>
 #include <Log.h>
+#include <CompressedLog.h>
+#include <FlashLog.h>
+#include <Rollup.h>
 #include <WiFiStateMachine.h>
 #include "PersistentData.h"
 #include "PhaseData.h"
 #include "GasData.h"
-#include "EnergyLogEntry.h"
 #include "PowerLogEntry.h"
+#include "EnergyAccounting.h"
+#include "LoadProfile.h"
 #include "P1Telegram.h"
+#include "StaticFiles.h"
 
 #define REFRESH_INTERVAL 30
 #define FTP_RETRY_INTERVAL (15 * 60)
 #define SECONDS_PER_HOUR 3600
+#define ENERGY_HOUR_LEVEL 0
+#define ENERGY_DAY_LEVEL 1
+#define ENERGY_WEEK_LEVEL 2
+#define ENERGY_MONTH_LEVEL 3
 #define SECONDS_PER_DAY (3600 * 24)
-#define MAX_POWER_LOG_SIZE 250
+#define MAX_POWER_LOG_SIZE 1000
+#define POWER_LOG_BUFFER_SIZE 6000
+#define POWER_LOG_SEGMENTS 4
 #define POWER_LOG_PAGE_SIZE 50
 #define POWER_LOG_INTERVAL 60
 
@@ -30,10 +45,6 @@
 #define P1_ENABLE 5
 
 #define SHOW_ENERGY "showEnergy"
-#define HOUR F("hour")
-#define DAY F("day")
-#define WEEK F("week")
-#define MONTH F("month")
 
 #define CFG_WIFI_SSID F("WifiSSID")
 #define CFG_WIFI_KEY F("WifiKey")
@@ -50,6 +61,7 @@
 
 const char* ContentTypeHtml = "text/html;charset=UTF-8";
 const char* ContentTypeText = "text/plain";
+const char* ContentTypeBinary = "application/octet-stream";
 const char* ContentTypeJson = "application/json";
 const char* ButtonClass = "button";
 
@@ -89,24 +101,28 @@ const char* Units[] PROGMEM =
 ESPWebServer WebServer(80); // Default HTTP port
 WiFiNTP TimeServer;
 WiFiFTPClient FTPClient(2000); // 2 sec timeout
-StringBuilder HttpResponse(16384); // 16KB HTTP response buffer
+ChunkedResponse HttpResponse(WebServer, 1536); // 1.5KB HTTP response buffer (larger responses are sent in chunks)
 HtmlWriter Html(HttpResponse, Files[Logo], Files[Styles], 45);
-Log<const char> EventLog(50); // Max 50 log entries
+JsonWriter Json(HttpResponse);
+StringArenaLog EventLog(50, 2048); // Max 50 log entries in 2 KB
 WiFiStateMachine WiFiSM(TimeServer, WebServer, EventLog);
 Navigation Nav;
 
 P1Telegram LastP1Telegram;
-StaticLog<PowerLogEntry> PowerLog(MAX_POWER_LOG_SIZE);
-StaticLog<EnergyLogEntry> EnergyPerHourLog(24);
-StaticLog<EnergyLogEntry> EnergyPerDayLog(7);
-StaticLog<EnergyLogEntry> EnergyPerWeekLog(12);
-StaticLog<EnergyLogEntry> EnergyPerMonthLog(12);
+FlashLog<PowerLogEntry, CompressedLog<PowerLogEntry, uint16_t, 7>> PowerLog("powerlog", POWER_LOG_SEGMENTS, MAX_POWER_LOG_SIZE, POWER_LOG_BUFFER_SIZE);
+const BinaryField PowerLogFields[] =
+{
+    BINARY_FIELD(PowerLogEntry, time),
+    BINARY_FIELD(PowerLogEntry, powerDelivered),
+    BINARY_FIELD(PowerLogEntry, powerReturned),
+    BINARY_FIELD(PowerLogEntry, powerGas)
+};
+const uint32_t EnergyIntervals[] = { SECONDS_PER_HOUR, SECONDS_PER_DAY, ROLLUP_WEEK, ROLLUP_MONTH };
+const uint16_t EnergyLogSizes[] = { 24, 7, 12, 12 };
+EnergyAccounting EnergyStats(4, EnergyIntervals, EnergyLogSizes);
+LoadProfile PhaseLoad;
 
 PowerLogEntry* powerLogEntryPtr = nullptr;
-EnergyLogEntry* energyPerHourLogEntryPtr = nullptr;
-EnergyLogEntry* energyPerDayLogEntryPtr = nullptr;
-EnergyLogEntry* energyPerWeekLogEntryPtr = nullptr;
-EnergyLogEntry* energyPerMonthLogEntryPtr = nullptr;
 
 uint32_t lastTelegramReceivedMillis = 0;
 time_t lastTelegramReceivedTime = 0;
@@ -133,7 +149,7 @@ void setup()
     pinMode(P1_ENABLE, OUTPUT);
 
     // ESMR 5.0: 115200 8N1, telegram each second (approx. 900 bytes)
-    Serial.setTimeout(1500); // Timeout allows for skipping one telegram
+    Serial.setTimeout(1500); // Incomplete telegram is rejected if no data is received within timeout
     Serial.setRxBufferSize(1024); // Ensure RX buffer fits full telegram
     Serial.begin(115200);
     Serial.println();
@@ -195,9 +211,14 @@ void setup()
     Nav.registerHttpHandlers(WebServer);
 
     WebServer.on("/json", handleHttpJsonRequest);
+    WebServer.on("/powerlog.bin", handleHttpPowerLogBinaryRequest);
     WebServer.onNotFound(handleHttpNotFound);
 
-    WiFiSM.registerStaticFiles(Files, _LastFile);
+    WiFiSM.registerStaticFiles(StaticFiles, StaticFileCount);
+    if (SPIFFS.begin())
+        PowerLog.load();
+    else
+        WiFiSM.logEvent(F("Starting SPIFFS failed"));
     WiFiSM.on(WiFiInitState::TimeServerSynced, onTimeServerSynced);
     WiFiSM.on(WiFiInitState::Initialized, onWiFiInitialized);
     WiFiSM.scanAccessPoints();
@@ -226,51 +247,7 @@ void loop()
 }
 
 
-void newEnergyPerHourLogEntry()
-{
-    Tracer tracer(F("newEnergyPerHourLogEntry"));
-    
-    EnergyLogEntry newEnergyLogEntry;
-    newEnergyLogEntry.time = currentTime - currentTime % SECONDS_PER_HOUR;
-
-    energyPerHourLogEntryPtr = EnergyPerHourLog.add(&newEnergyLogEntry);
-}
-
-
-void newEnergyPerDayLogEntry()
-{
-    Tracer tracer(F("newEnergyPerDayLogEntry"));
-
-    EnergyLogEntry newEnergyLogEntry;
-    newEnergyLogEntry.time = currentTime - currentTime % SECONDS_PER_DAY;
-
-    energyPerDayLogEntryPtr = EnergyPerDayLog.add(&newEnergyLogEntry);
-}
-
-
-void newEnergyPerWeekLogEntry()
-{
-    Tracer tracer(F("newEnergyPerWeekLogEntry"));
-    
-    EnergyLogEntry newEnergyLogEntry;
-    newEnergyLogEntry.time = currentTime;
-
-    energyPerWeekLogEntryPtr = EnergyPerWeekLog.add(&newEnergyLogEntry);
-}
-
-
-void newEnergyPerMonthLogEntry()
-{
-    Tracer tracer(F("newEnergyPerMonthLogEntry"));
-    
-    EnergyLogEntry newEnergyLogEntry;
-    newEnergyLogEntry.time = currentTime;
-
-    energyPerMonthLogEntryPtr = EnergyPerMonthLog.add(&newEnergyLogEntry);
-}
-
-
-void updateStatistics(P1Telegram& p1Telegram, float hoursSinceLastUpdate)
+void updateStatistics(P1Telegram& p1Telegram, uint32_t millisSinceLastUpdate)
 {
     Tracer tracer(F("updateStatistics"));
 
@@ -303,43 +280,21 @@ void updateStatistics(P1Telegram& p1Telegram, float hoursSinceLastUpdate)
     total.powerDelivered = phaseData[0].powerDelivered + phaseData[1].powerDelivered + phaseData[2].powerDelivered;
     total.powerReturned = phaseData[0].powerReturned + phaseData[1].powerReturned + phaseData[2].powerReturned;
 
-    String gasTimestamp;
-    float gasEnergy = p1Telegram.getFloatValue(P1Telegram::PropertyId::Gas, &gasTimestamp) * PersistentData.gasCalorificValue;
-    TRACE(F("Gas: %0.3f kWh @ %s.\n"), gasEnergy, gasTimestamp.c_str());
-    if (gasTimestamp != gasData.timestamp)
+    char gasTimestamp[P1_TIMESTAMP_SIZE];
+    p1Telegram.getTimestamp(P1Telegram::PropertyId::Gas, gasTimestamp);
+    float gasEnergy = p1Telegram.getFloatValue(P1Telegram::PropertyId::Gas) * PersistentData.gasCalorificValue;
+    TRACE(F("Gas: %0.3f kWh @ %s.\n"), gasEnergy, gasTimestamp);
+    if (strcmp(gasTimestamp, gasData.timestamp) != 0)
         gasData.update(gasTimestamp, currentTime, gasEnergy);
 
-    energyPerHourLogEntryPtr->update(
-        total.powerDelivered,
-        total.powerReturned,
-        gasData.power,
-        hoursSinceLastUpdate,
-        1 // Wh
-        );  
-
-    energyPerDayLogEntryPtr->update(
-        total.powerDelivered,
-        total.powerReturned,
-        gasData.power,
-        hoursSinceLastUpdate,
-        1000 // kWh
-        );
-
-    energyPerWeekLogEntryPtr->update(
-        total.powerDelivered,
-        total.powerReturned,
-        gasData.power,
-        hoursSinceLastUpdate,
-        1000 // kWh
-        );
+    float power[3] = { total.powerDelivered, total.powerReturned, gasData.power };
+    EnergyStats.update(currentTime, p1Telegram, millisSinceLastUpdate, power, PersistentData.gasCalorificValue);
 
-    energyPerMonthLogEntryPtr->update(
-        total.powerDelivered,
-        total.powerReturned,
-        gasData.power,
-        hoursSinceLastUpdate,
-        1000 // kWh
-        );
+    uint16_t loadPower[LOAD_PHASES];
+    for (int phase = 0; phase < 3; phase++)
+        loadPower[phase] = phaseData[phase].powerDelivered + 0.5F;
+    loadPower[3] = total.powerDelivered + 0.5F;
+    PhaseLoad.update(currentTime, loadPower, millisSinceLastUpdate);
 }
 
 
@@ -397,28 +352,17 @@ void testFillLogs()
 {
     Tracer tracer(F("testFillLogs"));
 
-    for (int hour = 0; hour <= 24; hour++)
+    EnergyStats.clear();
+    time_t time = currentTime - 8 * SECONDS_PER_DAY;
+    for (int hour = 0; hour <= 8 * 24; hour++)
     {
-        newEnergyPerHourLogEntry();
-        energyPerHourLogEntryPtr->time += hour * SECONDS_PER_HOUR;
-        energyPerHourLogEntryPtr->maxPowerDelivered = hour * 10;
-        energyPerHourLogEntryPtr->maxPowerReturned = 240 - hour * 10;
-        energyPerHourLogEntryPtr->maxPowerGas = 2400 / (hour + 1);
-        energyPerHourLogEntryPtr->energyDelivered = hour;
-        energyPerHourLogEntryPtr->energyReturned = 24 - hour;
-        energyPerHourLogEntryPtr->energyGas = hour;
+        float power[3] = { float(hour % 24) * 10, 240.0F - (hour % 24) * 10, 2400.0F / (hour % 24 + 1) };
+        uint32_t energy[EnergyChannelCount] = { 0, uint32_t(power[0]), 0, uint32_t(power[1]), uint32_t(power[2]) };
+        EnergyStats.add(time, energy, power);
+        time += SECONDS_PER_HOUR;
     }
 
-    for (int day = 0; day <= 7; day++)
-    {
-        newEnergyPerDayLogEntry();
-        energyPerDayLogEntryPtr->time += day * SECONDS_PER_DAY;
-        energyPerDayLogEntryPtr->energyDelivered = day;
-        energyPerDayLogEntryPtr->energyReturned = 7 - day;
-        energyPerDayLogEntryPtr->energyGas = day;
-    }
-
-    time_t time = currentTime;
+    time = currentTime;
     for (int i = 0; i < MAX_POWER_LOG_SIZE; i++)
     {
         float f = float(i) / 1000;
@@ -427,6 +371,9 @@ void testFillLogs()
         phaseData[2].update(232, 1, f, f + 1);
         gasData.power = i * 2;
         updatePowerLog(time);
+
+        uint16_t loadPower[LOAD_PHASES] = { uint16_t(i * 10), uint16_t(i * 5), uint16_t(i), uint16_t(i * 16) };
+        PhaseLoad.update(time, loadPower, POWER_LOG_INTERVAL * 1000);
         time += POWER_LOG_INTERVAL;
     }
 }
@@ -438,11 +385,6 @@ void onTimeServerSynced()
 
     updatePowerLogTime = currentTime + POWER_LOG_INTERVAL;
 
-    newEnergyPerHourLogEntry();
-    newEnergyPerDayLogEntry();
-    newEnergyPerWeekLogEntry();
-    newEnergyPerMonthLogEntry();
-
     // Flush any garbage from Serial input
     while (Serial.available())
     {
@@ -456,25 +398,13 @@ void onTimeServerSynced()
 
 void onWiFiInitialized()
 {
-    if (currentTime >= energyPerHourLogEntryPtr->time + SECONDS_PER_HOUR)
-    {
-        newEnergyPerHourLogEntry();
-
-        if (currentTime >= energyPerDayLogEntryPtr->time + SECONDS_PER_DAY)
-        {
-            newEnergyPerDayLogEntry();
-
-            if (currentTime >= energyPerWeekLogEntryPtr->time + (SECONDS_PER_DAY * 7))
-                newEnergyPerWeekLogEntry();
+    // Receive P1 telegram without blocking; built-in LED is on while receiving
+    bool wasReceiving = LastP1Telegram.isReceiving();
+    bool telegramReceived = LastP1Telegram.receive(Serial);
+    if (LastP1Telegram.isReceiving() != wasReceiving)
+        digitalWrite(LED_BUILTIN, wasReceiving ? LED_OFF : LED_ON);
 
-            int currentMonth = gmtime(&currentTime)->tm_mon;
-            int lastLogMonth = gmtime(&energyPerMonthLogEntryPtr->time)->tm_mon;
-            if (currentMonth != lastLogMonth)
-                newEnergyPerMonthLogEntry();
-        }
-    }
-
-    if (Serial.available())
+    if (telegramReceived)
     {
         uint32_t currentMillis = millis();
         int32_t millisSinceLastTelegram = (lastTelegramReceivedMillis == 0) ? 0 :  currentMillis - lastTelegramReceivedMillis; 
@@ -486,21 +416,14 @@ void onWiFiInitialized()
         lastTelegramReceivedMillis = currentMillis;
         lastTelegramReceivedTime = currentTime;
 
-        // Turn on built-in LED while receiving P1 telegram
-        digitalWrite(LED_BUILTIN, LED_ON);
-        String message = LastP1Telegram.readFrom(Serial); 
-        digitalWrite(LED_BUILTIN, LED_OFF);
-
-        if (message.length() > 0)
+        const char* message = LastP1Telegram.getMessage();
+        if (message[0] != 0)
             WiFiSM.logEvent(message);
 
-        if (message.startsWith(F("/testFill")))
+        if (strncmp(message, "/testFill", 9) == 0)
             testFillLogs();
-        else if (!message.startsWith(F("ERROR")))
-        {
-            float hoursSinceLastUpdate = float(millisSinceLastTelegram) / 3600000;
-            updateStatistics(LastP1Telegram, hoursSinceLastUpdate);
-        }
+        else if (LastP1Telegram.isValid())
+            updateStatistics(LastP1Telegram, millisSinceLastTelegram);
     }
 
     if (currentTime >= updatePowerLogTime)
@@ -548,8 +471,7 @@ bool trySyncFTP(Print* printTo)
     {
         if (logEntriesToSync > 0)
         {
-            PowerLogEntry* firstLogEntryPtr = PowerLog.getEntryFromEnd(logEntriesToSync);
-            writeCsvPowerLogEntries(firstLogEntryPtr, dataClient);
+            writeCsvPowerLogEntries(PowerLog.getEntriesFromEnd(logEntriesToSync), dataClient);
             logEntriesToSync = 0;
         }
         else if (printTo != nullptr)
@@ -580,16 +502,14 @@ void writeCsvPowerLogHeader(Print& destination)
 }
 
 
-void writeCsvPowerLogEntries(PowerLogEntry* logEntryPtr, Print& destination)
+void writeCsvPowerLogEntries(CompressedLog<PowerLogEntry, uint16_t, 7>::Range logEntries, Print& destination)
 {
-    while (logEntryPtr != nullptr)
+    for (PowerLogEntry* logEntryPtr : logEntries)
     {
         destination.print(formatTime("%F %H:%M", logEntryPtr->time));
         for (int phase = 0; phase < PersistentData.phaseCount; phase++)
             destination.printf(";%d;%d", logEntryPtr->powerDelivered[phase], logEntryPtr->powerReturned[phase]);
         destination.printf(";%d\r\n", logEntryPtr->powerGas);
-        
-        logEntryPtr = PowerLog.getNextEntry();
     }
 }
 
@@ -626,75 +546,123 @@ void writeHtmlGasData(float maxPower)
 }
 
 
+void writeHtmlLoadProfileRow(StringRef label, LoadProfileEntry* loadProfileEntryPtr, int phase)
+{
+    LoadHistogram& histogram = loadProfileEntryPtr->histogram[phase];
+    Html.writeRowStart();
+    Html.writeHeaderCell(label);
+    Html.writeCell(histogram.getQuantile(0.5F));
+    Html.writeCell(histogram.getQuantile(0.95F));
+    Html.writeCell(histogram.getQuantile(0.99F));
+    Html.writeCell(histogram.max);
+    Html.writeCell(PhaseLoad.getLastDemand(phase));
+    Html.writeCell(F("%d (%s)"), loadProfileEntryPtr->peakDemand[phase], formatTime("%d %H:%M", loadProfileEntryPtr->peakDemandTime[phase]));
+    Html.writeRowEnd();
+}
+
+
+void writeHtmlLoadProfile()
+{
+    LoadProfileEntry* loadProfileEntryPtr = PhaseLoad.getCurrentEntry();
+    if (loadProfileEntryPtr == nullptr)
+        return;
+
+    Html.writeSectionStart(F("Load profile"));
+    Html.writeTableStart();
+    Html.writeRowStart();
+    Html.writeHeaderCell(formatTime("%b", loadProfileEntryPtr->time));
+    Html.writeHeaderCell(F("P50 (W)"));
+    Html.writeHeaderCell(F("P95 (W)"));
+    Html.writeHeaderCell(F("P99 (W)"));
+    Html.writeHeaderCell(F("Max (W)"));
+    Html.writeHeaderCell(F("P<sub>15m</sub> (W)"));
+    Html.writeHeaderCell(F("Peak P<sub>15m</sub> (W)"));
+    Html.writeRowEnd();
+    if (PersistentData.phaseCount == 3)
+    {
+        for (int phase = 0; phase < 3; phase++)
+            writeHtmlLoadProfileRow(phaseData[phase].label, loadProfileEntryPtr, phase);
+    }
+    writeHtmlLoadProfileRow(total.label, loadProfileEntryPtr, 3);
+    Html.writeTableEnd();
+    Html.writeSectionEnd();
+}
+
+
 void writeHtmlEnergyRow(
     EnergyLogEntry* energyLogEntryPtr,
     const char* timeFormat,
+    float scale,
     float maxValue)
 {
+    float energyDelivered = energyLogEntryPtr->getDelivered() / scale;
+    float energyReturned = energyLogEntryPtr->getReturned() / scale;
+    float energyGas = energyLogEntryPtr->getGas() / scale;
+
     Html.writeRowStart();
     Html.writeCell(formatTime(timeFormat, energyLogEntryPtr->time));
     HttpResponse.printf(
-        F("<td><div>+%d</div><div>-%d</div><div>%d</div></td>"),
-        energyLogEntryPtr->maxPowerDelivered,
-        energyLogEntryPtr->maxPowerReturned,
-        energyLogEntryPtr->maxPowerGas);
+        F("<td><div>+%0.0f</div><div>-%0.0f</div><div>%0.0f</div></td>"),
+        energyLogEntryPtr->maxPower[0],
+        energyLogEntryPtr->maxPower[1],
+        energyLogEntryPtr->maxPower[2]);
     HttpResponse.printf(
         F("<td><div>+%0.1f</div><div>-%0.1f</div><div>%0.1f</div></td>"),
-        energyLogEntryPtr->energyDelivered,
-        energyLogEntryPtr->energyReturned,
-        energyLogEntryPtr->energyGas);
+        energyDelivered,
+        energyReturned,
+        energyGas);
     Html.writeCellStart(F("graph"));
-    Html.writeBar(energyLogEntryPtr->energyDelivered / maxValue, F("deliveredBar"), false);
-    Html.writeBar(energyLogEntryPtr->energyReturned / maxValue, F("returnedBar"), false);
-    Html.writeBar(energyLogEntryPtr->energyGas / maxValue, F("gasBar"), false);
+    Html.writeBar(energyDelivered / maxValue, F("deliveredBar"), false);
+    Html.writeBar(energyReturned / maxValue, F("returnedBar"), false);
+    Html.writeBar(energyGas / maxValue, F("gasBar"), false);
     Html.writeCellEnd();
     Html.writeRowEnd();
 }
 
 
 void writeHtmlEnergyLogTable(
-    String unit,
-    StaticLog<EnergyLogEntry>& energyLog,
+    uint8_t level,
     const char* timeFormat,
-    const char* unitOfMeasure)
+    const char* unitOfMeasure,
+    float scale)
 {
+    StaticLog<EnergyLogEntry>& energyLog = EnergyStats.getLog(level);
+
     // Auto-ranging: determine max value from the log entries
     float maxValue = 1; // Prevent division by zero
-    EnergyLogEntry* energyLogEntryPtr = energyLog.getFirstEntry();
-    while (energyLogEntryPtr != nullptr)
+    for (EnergyLogEntry* energyLogEntryPtr : energyLog)
     {
-        maxValue = std::max(maxValue, energyLogEntryPtr->energyDelivered);
-        maxValue = std::max(maxValue, energyLogEntryPtr->energyReturned);
-        maxValue = std::max(maxValue, energyLogEntryPtr->energyGas);
-        energyLogEntryPtr = energyLog.getNextEntry();
+        uint32_t maxEnergy = std::max(std::max(energyLogEntryPtr->getDelivered(), energyLogEntryPtr->getReturned()), energyLogEntryPtr->getGas());
+        maxValue = std::max(maxValue, maxEnergy / scale);
     }
 
     HttpResponse.println(F("<section>"));
-    HttpResponse.printf(
-        F("<h1>Energy per <span class=\"dropdown\"><span>%s</span>"),
-        unit.c_str());
+    HttpResponse.print(F("<h1>Energy per <span class=\"dropdown\"><span>"));
+    HttpResponse.print(FPSTR(Units[level]));
+    HttpResponse.print(F("</span>"));
     Html.writeDivStart(F("dropdown-list"));
     for (int i = 0; i < 4; i++)
     {
-        String u = FPSTR(Units[i]);
-        if (u == unit) continue;
-        HttpResponse.printf(F("<a href=\"?showEnergy=%s\">%s</a>\r\n"), u.c_str(), u.c_str());
+        if (i == level) continue;
+        HttpResponse.print(F("<a href=\"?showEnergy="));
+        HttpResponse.print(FPSTR(Units[i]));
+        HttpResponse.print(F("\">"));
+        HttpResponse.print(FPSTR(Units[i]));
+        HttpResponse.println(F("</a>"));
     }
     Html.writeDivEnd();
     HttpResponse.println(F("</span></h1>"));
 
     Html.writeTableStart();
     Html.writeRowStart();
-    Html.writeHeaderCell(unit);
+    Html.writeHeaderCell(FPSTR(Units[level]));
     Html.writeHeaderCell(F("P<sub>max</sub> (W)"));
     HttpResponse.printf(F("<th>E (%s)</th>"), unitOfMeasure);
     Html.writeRowEnd();
 
-    energyLogEntryPtr = energyLog.getFirstEntry();
-    while (energyLogEntryPtr != nullptr)
+    for (EnergyLogEntry* energyLogEntryPtr : energyLog)
     {
-        writeHtmlEnergyRow(energyLogEntryPtr, timeFormat, maxValue);
-        energyLogEntryPtr = energyLog.getNextEntry();
+        writeHtmlEnergyRow(energyLogEntryPtr, timeFormat, scale, maxValue);
     }
 
     Html.writeTableEnd();
@@ -712,7 +680,7 @@ void handleHttpRootRequest()
         return;
     }
 
-    String ftpSync;
+    StringRef ftpSync;
     if (!PersistentData.isFTPEnabled())
         ftpSync = F("Disabled");
     else if (lastFTPSyncTime == 0)
@@ -720,6 +688,7 @@ void handleHttpRootRequest()
     else
         ftpSync = formatTime("%H:%M", lastFTPSyncTime);
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Home"), Nav, REFRESH_INTERVAL);
 
     Html.writeDivStart(F("flex-container"));
@@ -730,6 +699,7 @@ void handleHttpRootRequest()
     Html.writeRow(F("Free Heap"), F("%0.1f kB"), float(ESP.getFreeHeap()) / 1024);
     Html.writeRow(F("Uptime"), F("%0.1f days"), float(WiFiSM.getUptime()) / SECONDS_PER_DAY);
     Html.writeRow(F("Last Telegram"), formatTime("%H:%M:%S", lastTelegramReceivedTime));
+    Html.writeRow(F("Telegram errors"), F("%0.1f %%"), LastP1Telegram.getErrorRatio() * 100);
     Html.writeRow(F("Gas update"), formatTime("%H:%M:%S", gasData.time));
     Html.writeRow(F("FTP Sync"), ftpSync);
     if (PersistentData.isFTPEnabled())
@@ -752,20 +722,31 @@ void handleHttpRootRequest()
     Html.writeTableEnd();
     Html.writeSectionEnd();
 
-    String showEnergy = WebServer.hasArg(SHOW_ENERGY) ? WebServer.arg(SHOW_ENERGY) : DAY;
-    if (showEnergy == HOUR)
-        writeHtmlEnergyLogTable(showEnergy, EnergyPerHourLog, "%H:%M", "Wh");
-    if (showEnergy == DAY)
-        writeHtmlEnergyLogTable(showEnergy, EnergyPerDayLog, "%a", "kWh");
-    if (showEnergy == WEEK)
-        writeHtmlEnergyLogTable(showEnergy, EnergyPerWeekLog, "%d %b", "kWh");
-    if (showEnergy == MONTH)
-        writeHtmlEnergyLogTable(showEnergy, EnergyPerMonthLog, "%b", "kWh");
+    writeHtmlLoadProfile();
+
+    int energyLevel = ENERGY_DAY_LEVEL;
+    if (WebServer.hasArg(SHOW_ENERGY))
+    {
+        const String& showEnergy = WebServer.arg(SHOW_ENERGY);
+        energyLevel = -1;
+        for (int i = 0; i < 4; i++)
+        {
+            if (strcmp_P(showEnergy.c_str(), Units[i]) == 0) energyLevel = i;
+        }
+    }
+    if (energyLevel == ENERGY_HOUR_LEVEL)
+        writeHtmlEnergyLogTable(ENERGY_HOUR_LEVEL, "%H:%M", "Wh", 1);
+    if (energyLevel == ENERGY_DAY_LEVEL)
+        writeHtmlEnergyLogTable(ENERGY_DAY_LEVEL, "%a", "kWh", 1000);
+    if (energyLevel == ENERGY_WEEK_LEVEL)
+        writeHtmlEnergyLogTable(ENERGY_WEEK_LEVEL, "%d %b", "kWh", 1000);
+    if (energyLevel == ENERGY_MONTH_LEVEL)
+        writeHtmlEnergyLogTable(ENERGY_MONTH_LEVEL, "%b", "kWh", 1000);
 
     Html.writeDivEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -773,39 +754,63 @@ void handleHttpJsonRequest()
 {
     Tracer tracer(F("handleHttpJsonRequest"));
 
-    HttpResponse.clear();
-    HttpResponse.print(F("{ \"Electricity\": [ "));
+    HttpResponse.begin(200, ContentTypeJson);
+    Json.beginObject();
+    Json.writeName(F("Electricity"));
+    Json.beginArray();
 
     if (PersistentData.phaseCount == 3)
     {
         for (int i = 0; i < 3; i++)
-        {
-            if (i > 0) HttpResponse.print(F(", "));
-            writeJsonPhaseData(phaseData[i]);
-        }
-        HttpResponse.print(F(", "));
+            writeJsonPhaseData(phaseData[i], i);
     }
 
-    writeJsonPhaseData(total);
+    writeJsonPhaseData(total, 3);
 
-    HttpResponse.printf(
-        F(" ], \"Egas\": %0.1f, \"Pgas\": %0.0f }"),
-        gasData.energy,
-        gasData.power);
+    Json.endArray();
+    Json.writeMember(F("Egas"), gasData.energy, 1);
+    Json.writeMember(F("Pgas"), gasData.power, 0);
+    Json.endObject();
 
-    WebServer.send(200, ContentTypeJson, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
-void writeJsonPhaseData(PhaseData& phaseData)
+void writeJsonPhaseData(PhaseData& phaseData, int phase)
 {
-    HttpResponse.printf(
-        F("{ \"Phase\": \"%s\", \"U\": %0.1f, \"I\": %0.0f, \"Pdelivered\": %0.0f, \"Preturned\": %0.0f }"),
-        phaseData.label.c_str(),
-        phaseData.voltage,
-        phaseData.current,
-        phaseData.powerDelivered,
-        phaseData.powerReturned);
+    Json.beginObject();
+    Json.writeMember(F("Phase"), phaseData.label);
+    Json.writeMember(F("U"), phaseData.voltage, 1);
+    Json.writeMember(F("I"), phaseData.current, 0);
+    Json.writeMember(F("Pdelivered"), phaseData.powerDelivered, 0);
+    Json.writeMember(F("Preturned"), phaseData.powerReturned, 0);
+
+    LoadProfileEntry* loadProfileEntryPtr = PhaseLoad.getCurrentEntry();
+    if (loadProfileEntryPtr != nullptr)
+    {
+        LoadHistogram& histogram = loadProfileEntryPtr->histogram[phase];
+        Json.writeMember(F("P50"), uint32_t(histogram.getQuantile(0.5F)));
+        Json.writeMember(F("P95"), uint32_t(histogram.getQuantile(0.95F)));
+        Json.writeMember(F("P99"), uint32_t(histogram.getQuantile(0.99F)));
+        Json.writeMember(F("Pmax"), uint32_t(histogram.max));
+        Json.writeMember(F("P15m"), uint32_t(PhaseLoad.getLastDemand(phase)));
+        Json.writeMember(F("Ppeak15m"), uint32_t(loadProfileEntryPtr->peakDemand[phase]));
+    }
+    Json.endObject();
+}
+
+
+void handleHttpPowerLogBinaryRequest()
+{
+    Tracer tracer(F("handleHttpPowerLogBinaryRequest"));
+
+    time_t since = WebServer.hasArg("since") ? WebServer.arg("since").toInt() : 0;
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, PowerLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeBinary);
+    writeBinaryLog(HttpResponse, incremental ? PowerLog.getEntriesSince(cursor) : PowerLog.getRange(), PowerLogFields, since);
+    HttpResponse.end();
 }
 
 
@@ -813,25 +818,26 @@ void handleHttpViewTelegramRequest()
 {
     Tracer tracer(F("handleHttpViewTelegramRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("P1 Telegram"), Nav, REFRESH_INTERVAL);
     
     HttpResponse.printf(
         F("<p>Received %d data lines at %s:</p>"),
-        LastP1Telegram._numDataLines,
+        LastP1Telegram.getDataLineCount(),
         formatTime("%H:%M:%S", lastTelegramReceivedTime)
         );
 
-    HttpResponse.println(F("<pre>"));
-
-    for (int i = 0; i < LastP1Telegram._numDataLines; i++)
+    if (LastP1Telegram.isReceiving())
+        Html.writeParagraph(F("Receiving next telegram..."));
+    else
     {
-        HttpResponse.print(LastP1Telegram._dataLines[i]);
+        HttpResponse.println(F("<pre>"));
+        HttpResponse.write(reinterpret_cast<const uint8_t*>(LastP1Telegram.getData()), LastP1Telegram.getLength());
+        HttpResponse.println(F("</pre>"));
     }
-
-    HttpResponse.println(F("</pre>"));
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -842,6 +848,10 @@ void handleHttpPowerLogRequest()
     int currentPage = WebServer.hasArg("page") ? WebServer.arg("page").toInt() : 0;
     int totalPages = ((PowerLog.count() - 1) / POWER_LOG_PAGE_SIZE) + 1;
 
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, PowerLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Power log"), Nav);
     Html.writePager(totalPages, currentPage);
     Html.writeTableStart();
@@ -853,12 +863,10 @@ void handleHttpPowerLogRequest()
     Html.writeHeaderCell(F("Pgas (W)"));
     Html.writeRowEnd();
 
-    PowerLogEntry* logEntryPtr = PowerLog.getFirstEntry();
-    for (int i = 0; i < (currentPage * POWER_LOG_PAGE_SIZE) && logEntryPtr != nullptr; i++)
-    {
-        logEntryPtr = PowerLog.getNextEntry();
-    }
-    for (int i = 0; i < POWER_LOG_PAGE_SIZE && logEntryPtr != nullptr; i++)
+    auto logEntries = incremental
+        ? PowerLog.getEntriesSince(cursor)
+        : PowerLog.getRange(currentPage * POWER_LOG_PAGE_SIZE, POWER_LOG_PAGE_SIZE);
+    for (PowerLogEntry* logEntryPtr : logEntries)
     {
         Html.writeRowStart();
         Html.writeCell(formatTime("%H:%M", logEntryPtr->time));
@@ -869,14 +877,12 @@ void handleHttpPowerLogRequest()
         }
         Html.writeCell(logEntryPtr->powerGas);
         Html.writeRowEnd();
-
-        logEntryPtr = PowerLog.getNextEntry();
     }
 
     Html.writeTableEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -884,6 +890,7 @@ void handleHttpSyncFTPRequest()
 {
     Tracer tracer(F("handleHttpSyncFTPRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("FTP Sync"), Nav);
 
     HttpResponse.println("<pre>");
@@ -905,7 +912,7 @@ void handleHttpSyncFTPRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -913,25 +920,27 @@ void handleHttpEventLogRequest()
 {
     Tracer tracer(F("handleHttpEventLogRequest"));
 
-    Html.writeHeader(F("Event log"), Nav);
-
     if (WiFiSM.shouldPerformAction(F("clear")))
     {
         EventLog.clear();
         WiFiSM.logEvent(F("Event log cleared."));
     }
 
-    const char* event = EventLog.getFirstEntry();
-    while (event != nullptr)
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, EventLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeHtml);
+    Html.writeHeader(F("Event log"), Nav);
+
+    for (const char* event : incremental ? EventLog.getEntriesSince(cursor) : EventLog.getRange())
     {
         HttpResponse.printf(F("<div>%s</div>\r\n"), event);
-        event = EventLog.getNextEntry();
     }
 
     Html.writeActionLink(F("clear"), "Clear event log", currentTime, ButtonClass);
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -939,6 +948,7 @@ void handleHttpConfigFormRequest()
 {
     Tracer tracer(F("handleHttpConfigFormRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Settings"), Nav);
 
     Html.writeFormStart(F("/config"), F("grid"));
@@ -960,6 +970,7 @@ void handleHttpConfigFormRequest()
     if (WiFiSM.shouldPerformAction(F("reset")))
     {
         Html.writeParagraph(F("Resetting..."));
+        PowerLog.flush();
         WiFiSM.reset();
     }
     else
@@ -967,7 +978,7 @@ void handleHttpConfigFormRequest()
         
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 void copyString(const String& input, char* buffer, size_t bufferSize)
@@ -0,0 +1,175 @@
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <Rollup.h>
+#include "P1Telegram.h"
+
+enum EnergyChannel
+{
+    EnergyDeliveredT1 = 0, // Tariff 1 (low)
+    EnergyDeliveredT2, // Tariff 2 (normal)
+    EnergyReturnedT1,
+    EnergyReturnedT2,
+    EnergyGas,
+    EnergyChannelCount
+};
+
+// Energy per interval (Wh) and max power (W) for delivered, returned and gas.
+struct EnergyLogEntry
+{
+    time_t time;
+    uint32_t energy[EnergyChannelCount];
+    float maxPower[3];
+
+    uint32_t getDelivered() const
+    {
+        return energy[EnergyDeliveredT1] + energy[EnergyDeliveredT2];
+    }
+
+    uint32_t getReturned() const
+    {
+        return energy[EnergyReturnedT1] + energy[EnergyReturnedT2];
+    }
+
+    uint32_t getGas() const
+    {
+        return energy[EnergyGas];
+    }
+
+    void reset(time_t startTime)
+    {
+        time = startTime;
+        memset(energy, 0, sizeof(energy));
+        memset(maxPower, 0, sizeof(maxPower));
+    }
+
+    void update(const uint32_t* deltaEnergy, const float* power)
+    {
+        for (int i = 0; i < EnergyChannelCount; i++)
+            energy[i] += deltaEnergy[i];
+        for (int i = 0; i < 3; i++)
+        {
+            if (power[i] > maxPower[i]) maxPower[i] = power[i];
+        }
+    }
+};
+
+
+// Energy accounting anchored on the meter's cumulative registers (1-0:1.8.x, 1-0:2.8.x and gas).
+// Per telegram, the register deltas are added to the current entry of all levels in a single pass.
+// The deltas are integers (Wh and dm3), so the totals per interval match the meter readings (and the bill) exactly;
+// telegrams which are missed or rejected are covered by the next register delta.
+// Channels for which the meter doesn't provide a register (e.g. DSMR 2.2 or test telegrams) are integrated
+// from the power instead, in fixed-point (W * ms) with the remainder carried over to the next telegram.
+class EnergyAccounting : public RollupBase<EnergyLogEntry>
+{
+    public:
+        // Constructor
+        EnergyAccounting(uint8_t levels, const uint32_t* intervals, const uint16_t* sizes)
+            : RollupBase<EnergyLogEntry>(levels, intervals, sizes)
+        {
+            reset();
+        }
+
+        void reset()
+        {
+            clear();
+            memset(_isAnchored, 0, sizeof(_isAnchored));
+            memset(_registers, 0, sizeof(_registers));
+            memset(_remainders, 0, sizeof(_remainders));
+        }
+
+        // Updates with a received telegram.
+        // power: delivered, returned and gas power (W); gasKWhPerM3: gas calorific value.
+        void update(time_t time, const P1Telegram& telegram, uint32_t millisSinceLastUpdate, const float* power, float gasKWhPerM3)
+        {
+            bool isLowTariff = (telegram.getFixedValue(P1Telegram::PropertyId::TariffIndicator) == 1);
+            uint32_t deltaEnergy[EnergyChannelCount];
+
+            for (int i = EnergyDeliveredT1; i <= EnergyReturnedT2; i++)
+            {
+                if (isAnchored(i, telegram))
+                    deltaEnergy[i] = getRegisterDelta(i, telegram);
+                else
+                {
+                    bool isDelivered = (i <= EnergyDeliveredT2);
+                    bool isLowTariffChannel = (i == EnergyDeliveredT1) || (i == EnergyReturnedT1);
+                    deltaEnergy[i] = (isLowTariffChannel == isLowTariff)
+                        ? integratePower(i, power[isDelivered ? 0 : 1], millisSinceLastUpdate)
+                        : 0;
+                }
+            }
+
+            if (isAnchored(EnergyGas, telegram))
+            {
+                // Gas register is in dm3; calorific value in kWh/m3 equals Wh/dm3. The remainder is in mWh.
+                _remainders[EnergyGas] += uint64_t(getRegisterDelta(EnergyGas, telegram)) * uint32_t(gasKWhPerM3 * 1000 + 0.5F);
+                deltaEnergy[EnergyGas] = _remainders[EnergyGas] / 1000;
+                _remainders[EnergyGas] %= 1000;
+            }
+            else
+                deltaEnergy[EnergyGas] = integratePower(EnergyGas, power[2], millisSinceLastUpdate);
+
+            RollupBase<EnergyLogEntry>::update(time, deltaEnergy, power);
+        }
+
+        // Adds the given energy (Wh) directly (e.g. for testing).
+        void add(time_t time, const uint32_t* energy, const float* power)
+        {
+            RollupBase<EnergyLogEntry>::update(time, energy, power);
+        }
+
+    private:
+        static const uint32_t WattMillisPerWh = 3600000; // W * ms
+
+        bool _isAnchored[EnergyChannelCount];
+        int32_t _registers[EnergyChannelCount];
+        uint64_t _remainders[EnergyChannelCount];
+
+        static P1Telegram::PropertyId getRegisterId(int channel)
+        {
+            static const P1Telegram::PropertyId registerIds[] =
+            {
+                P1Telegram::PropertyId::EnergyDeliveredTariff1,
+                P1Telegram::PropertyId::EnergyDeliveredTariff2,
+                P1Telegram::PropertyId::EnergyReturnedTariff1,
+                P1Telegram::PropertyId::EnergyReturnedTariff2,
+                P1Telegram::PropertyId::Gas
+            };
+            return registerIds[channel];
+        }
+
+        // Once a channel is anchored it only uses the register; a telegram without the register
+        // (e.g. the gas value is missing) contributes nothing, the next delta covers it.
+        bool isAnchored(int channel, const P1Telegram& telegram)
+        {
+            if (!_isAnchored[channel] && telegram.hasValue(getRegisterId(channel)))
+            {
+                _isAnchored[channel] = true;
+                _registers[channel] = telegram.getFixedValue(getRegisterId(channel));
+            }
+            return _isAnchored[channel];
+        }
+
+        uint32_t getRegisterDelta(int channel, const P1Telegram& telegram)
+        {
+            if (!telegram.hasValue(getRegisterId(channel)))
+                return 0;
+
+            int32_t newRegister = telegram.getFixedValue(getRegisterId(channel));
+            int32_t delta = newRegister - _registers[channel];
+            _registers[channel] = newRegister;
+
+            // A register which decreases means the meter has been replaced; re-anchor.
+            return (delta < 0) ? 0 : delta;
+        }
+
+        uint32_t integratePower(int channel, float power, uint32_t duration)
+        {
+            if (power > 0)
+                _remainders[channel] += uint64_t(power + 0.5F) * duration;
+            uint32_t energy = _remainders[channel] / WattMillisPerWh;
+            _remainders[channel] %= WattMillisPerWh;
+            return energy;
+        }
+};
@@ -1,16 +1,16 @@
-#include <WString.h>
 #include <Tracer.h>
+#include "P1Telegram.h"
 
 struct GasData
 {
-    String timestamp;
+    char timestamp[P1_TIMESTAMP_SIZE] = { 0 };
     time_t time = 0;
     float energy = 0; // kWh
     float power = 0;
 
-    void update(String& newTimestamp, time_t newTime, float newEnergy)
+    void update(const char* newTimestamp, time_t newTime, float newEnergy)
     {
-        timestamp = newTimestamp;
+        strncpy(timestamp, newTimestamp, sizeof(timestamp) - 1);
         if (time > 0)
         {
             float deltaEnergy = (newEnergy - energy) * 1000; // Wh
@@ -0,0 +1,172 @@
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <time.h>
+#include <Rollup.h>
+
+#define LOAD_PHASES 4 // L1, L2, L3 and total
+#define LOAD_SUB_BUCKET_BITS 3
+#define LOAD_SUB_BUCKETS (1 << LOAD_SUB_BUCKET_BITS)
+#define LOAD_BUCKETS 112 // Covers 0 - 65535 W
+#define DEMAND_INTERVAL (15 * 60)
+
+// Histogram of power samples (W) with log-sized buckets: each power of 2 is divided in 8 buckets,
+// so a quantile is off by at most 1/16 (6%). Adding a sample is O(1).
+struct LoadHistogram
+{
+    uint32_t counts[LOAD_BUCKETS];
+    uint32_t count;
+    uint16_t max;
+
+    static int getBucket(uint16_t power)
+    {
+        if (power < 2 * LOAD_SUB_BUCKETS)
+            return power;
+        int shift = (31 - __builtin_clz(power)) - LOAD_SUB_BUCKET_BITS;
+        return (shift + 1) * LOAD_SUB_BUCKETS + (power >> shift) - LOAD_SUB_BUCKETS;
+    }
+
+    // Returns the middle of the bucket's power range.
+    static uint16_t getBucketPower(int bucket)
+    {
+        if (bucket < 2 * LOAD_SUB_BUCKETS)
+            return bucket;
+        int shift = bucket / LOAD_SUB_BUCKETS - 1;
+        uint32_t start = uint32_t(bucket % LOAD_SUB_BUCKETS + LOAD_SUB_BUCKETS) << shift;
+        return start + ((1 << shift) - 1) / 2;
+    }
+
+    void reset()
+    {
+        memset(counts, 0, sizeof(counts));
+        count = 0;
+        max = 0;
+    }
+
+    void add(uint16_t power)
+    {
+        counts[getBucket(power)]++;
+        count++;
+        if (power > max) max = power;
+    }
+
+    // Returns the power (W) which is not exceeded by the given fraction of the samples (e.g. 0.95).
+    uint16_t getQuantile(float fraction) const
+    {
+        if (count == 0)
+            return 0;
+        uint32_t rank = uint32_t(fraction * count + 0.5F);
+        if (rank == 0) rank = 1;
+        uint32_t cumulative = 0;
+        for (int i = 0; i < LOAD_BUCKETS; i++)
+        {
+            cumulative += counts[i];
+            if (cumulative >= rank)
+                return std::min(getBucketPower(i), max);
+        }
+        return max;
+    }
+};
+
+
+// Load profile over one interval (month): power histograms and highest 15 minute demand per phase.
+struct LoadProfileEntry
+{
+    time_t time;
+    LoadHistogram histogram[LOAD_PHASES];
+    uint16_t peakDemand[LOAD_PHASES];
+    time_t peakDemandTime[LOAD_PHASES];
+
+    void reset(time_t startTime)
+    {
+        time = startTime;
+        for (int i = 0; i < LOAD_PHASES; i++)
+            histogram[i].reset();
+        memset(peakDemand, 0, sizeof(peakDemand));
+        memset(peakDemandTime, 0, sizeof(peakDemandTime));
+    }
+
+    void update(const uint16_t* power, const uint16_t* demand, time_t demandTime)
+    {
+        for (int i = 0; i < LOAD_PHASES; i++)
+        {
+            if (power != nullptr)
+                histogram[i].add(power[i]);
+            if ((demand != nullptr) && (demand[i] > peakDemand[i]))
+            {
+                peakDemand[i] = demand[i];
+                peakDemandTime[i] = demandTime;
+            }
+        }
+    }
+};
+
+
+// Per-phase load profile for the current month, updated with each telegram.
+// Short peaks which don't make it into the power log are still visible in the quantiles (e.g. P95, P99).
+// The demand is the average power per quarter hour (aligned to the clock), as used for capacity tariffs.
+class LoadProfile : public RollupBase<LoadProfileEntry>
+{
+    public:
+        // Constructor
+        LoadProfile()
+            : RollupBase<LoadProfileEntry>(ROLLUP_MONTH, 1)
+        {
+            _demandEndTime = 0;
+            resetDemand();
+            memset(_lastDemand, 0, sizeof(_lastDemand));
+        }
+
+        // power: delivered power (W) for L1, L2, L3 and total.
+        void update(time_t time, const uint16_t* power, uint32_t millisSinceLastUpdate)
+        {
+            if (time >= _demandEndTime)
+            {
+                time_t demandStartTime = _demandEndTime - DEMAND_INTERVAL;
+                if (_demandMillis > 0)
+                {
+                    for (int i = 0; i < LOAD_PHASES; i++)
+                        _lastDemand[i] = _demandSums[i] / _demandMillis;
+                    // Add the demand to the interval it belongs to (before a new month is started)
+                    RollupBase<LoadProfileEntry>::update(demandStartTime, static_cast<const uint16_t*>(nullptr), _lastDemand, demandStartTime);
+                }
+                resetDemand();
+                _demandEndTime = time - time % DEMAND_INTERVAL + DEMAND_INTERVAL;
+            }
+
+            for (int i = 0; i < LOAD_PHASES; i++)
+                _demandSums[i] += uint64_t(power[i]) * millisSinceLastUpdate;
+            _demandMillis += millisSinceLastUpdate;
+
+            RollupBase<LoadProfileEntry>::update(time, power, static_cast<const uint16_t*>(nullptr), time_t(0));
+        }
+
+        LoadProfileEntry* getCurrentEntry()
+        {
+            return _currentEntryPtrs[0];
+        }
+
+        // Returns the average power (W) in the current quarter hour so far.
+        uint16_t getDemand(int phase) const
+        {
+            return (_demandMillis == 0) ? 0 : _demandSums[phase] / _demandMillis;
+        }
+
+        // Returns the average power (W) in the last complete quarter hour.
+        uint16_t getLastDemand(int phase) const
+        {
+            return _lastDemand[phase];
+        }
+
+    private:
+        time_t _demandEndTime;
+        uint64_t _demandSums[LOAD_PHASES]; // W * ms
+        uint32_t _demandMillis;
+        uint16_t _lastDemand[LOAD_PHASES];
+
+        void resetDemand()
+        {
+            memset(_demandSums, 0, sizeof(_demandSums));
+            _demandMillis = 0;
+        }
+};
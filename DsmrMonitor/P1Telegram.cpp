@@ -1,26 +1,178 @@
 #include "P1Telegram.h"
 #include <Tracer.h>
 
+// CRC16/ARC lookup table (polynomial 0x8005 reflected, i.e. 0xA001)
+static const uint16_t Crc16Table[256] PROGMEM =
+{
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+
+// CRC16 as used by DSMR 4+ telegrams: from '/' up to and including '!'. Initial value 0.
+static uint16_t updateCrc16(uint16_t crc, const char* data, size_t length)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++)
+        crc = (crc >> 8) ^ pgm_read_word(&Crc16Table[(crc ^ bytes[i]) & 0xFF]);
+    return crc;
+}
+
+#define FIXED(decimals, unit) P1ValueType::Fixed, decimals, P1Unit::unit
+#define INTEGER P1ValueType::Integer, 0, P1Unit::None
+#define TEXT P1ValueType::Text, 0, P1Unit::None
+
+// DSMR 5.0.2 P1 Companion Standard, table 6.1 - 6.3.
+// Must be in the same order as P1Telegram::PropertyId (checked at compile time).
+static constexpr P1Telegram::PropertyDescriptor P1Properties[] PROGMEM =
+{
+    { getObisKey(1, 3, 0, 2, 8), P1Telegram::PropertyId::Version, INTEGER },
+    { getObisKey(0, 0, 1, 0, 0), P1Telegram::PropertyId::Timestamp, P1ValueType::Timestamp, 0, P1Unit::None },
+    { getObisKey(0, 0, 96, 1, 1), P1Telegram::PropertyId::EquipmentId, TEXT },
+    { getObisKey(1, 0, 1, 8, 1), P1Telegram::PropertyId::EnergyDeliveredTariff1, FIXED(3, kWh) },
+    { getObisKey(1, 0, 1, 8, 2), P1Telegram::PropertyId::EnergyDeliveredTariff2, FIXED(3, kWh) },
+    { getObisKey(1, 0, 2, 8, 1), P1Telegram::PropertyId::EnergyReturnedTariff1, FIXED(3, kWh) },
+    { getObisKey(1, 0, 2, 8, 2), P1Telegram::PropertyId::EnergyReturnedTariff2, FIXED(3, kWh) },
+    { getObisKey(0, 0, 96, 14, 0), P1Telegram::PropertyId::TariffIndicator, INTEGER },
+    { getObisKey(1, 0, 1, 7, 0), P1Telegram::PropertyId::PowerDeliveredTotal, FIXED(3, kW) },
+    { getObisKey(1, 0, 2, 7, 0), P1Telegram::PropertyId::PowerReturnedTotal, FIXED(3, kW) },
+    { getObisKey(0, 0, 96, 7, 21), P1Telegram::PropertyId::PowerFailures, INTEGER },
+    { getObisKey(0, 0, 96, 7, 9), P1Telegram::PropertyId::LongPowerFailures, INTEGER },
+    { getObisKey(1, 0, 99, 97, 0), P1Telegram::PropertyId::PowerFailureLog, INTEGER }, // Number of entries
+    { getObisKey(1, 0, 32, 32, 0), P1Telegram::PropertyId::VoltageSagsL1, INTEGER },
+    { getObisKey(1, 0, 52, 32, 0), P1Telegram::PropertyId::VoltageSagsL2, INTEGER },
+    { getObisKey(1, 0, 72, 32, 0), P1Telegram::PropertyId::VoltageSagsL3, INTEGER },
+    { getObisKey(1, 0, 32, 36, 0), P1Telegram::PropertyId::VoltageSwellsL1, INTEGER },
+    { getObisKey(1, 0, 52, 36, 0), P1Telegram::PropertyId::VoltageSwellsL2, INTEGER },
+    { getObisKey(1, 0, 72, 36, 0), P1Telegram::PropertyId::VoltageSwellsL3, INTEGER },
+    { getObisKey(0, 0, 96, 13, 0), P1Telegram::PropertyId::TextMessage, TEXT },
+    { getObisKey(1, 0, 32, 7, 0), P1Telegram::PropertyId::VoltageL1, FIXED(1, V) },
+    { getObisKey(1, 0, 52, 7, 0), P1Telegram::PropertyId::VoltageL2, FIXED(1, V) },
+    { getObisKey(1, 0, 72, 7, 0), P1Telegram::PropertyId::VoltageL3, FIXED(1, V) },
+    { getObisKey(1, 0, 31, 7, 0), P1Telegram::PropertyId::CurrentL1, FIXED(0, A) },
+    { getObisKey(1, 0, 51, 7, 0), P1Telegram::PropertyId::CurrentL2, FIXED(0, A) },
+    { getObisKey(1, 0, 71, 7, 0), P1Telegram::PropertyId::CurrentL3, FIXED(0, A) },
+    { getObisKey(1, 0, 21, 7, 0), P1Telegram::PropertyId::PowerDeliveredL1, FIXED(3, kW) },
+    { getObisKey(1, 0, 41, 7, 0), P1Telegram::PropertyId::PowerDeliveredL2, FIXED(3, kW) },
+    { getObisKey(1, 0, 61, 7, 0), P1Telegram::PropertyId::PowerDeliveredL3, FIXED(3, kW) },
+    { getObisKey(1, 0, 22, 7, 0), P1Telegram::PropertyId::PowerReturnedL1, FIXED(3, kW) },
+    { getObisKey(1, 0, 42, 7, 0), P1Telegram::PropertyId::PowerReturnedL2, FIXED(3, kW) },
+    { getObisKey(1, 0, 62, 7, 0), P1Telegram::PropertyId::PowerReturnedL3, FIXED(3, kW) },
+    // M-Bus devices (gas, water, ...); the value unit is assumed to be m3
+    { getObisKey(0, 1, 24, 1, 0), P1Telegram::PropertyId::MBus1DeviceType, INTEGER },
+    { getObisKey(0, 1, 96, 1, 0), P1Telegram::PropertyId::MBus1EquipmentId, TEXT },
+    { getObisKey(0, 1, 24, 2, 1), P1Telegram::PropertyId::MBus1Value, P1ValueType::TimestampedFixed, 3, P1Unit::m3 },
+    { getObisKey(0, 2, 24, 1, 0), P1Telegram::PropertyId::MBus2DeviceType, INTEGER },
+    { getObisKey(0, 2, 96, 1, 0), P1Telegram::PropertyId::MBus2EquipmentId, TEXT },
+    { getObisKey(0, 2, 24, 2, 1), P1Telegram::PropertyId::MBus2Value, P1ValueType::TimestampedFixed, 3, P1Unit::m3 },
+    { getObisKey(0, 3, 24, 1, 0), P1Telegram::PropertyId::MBus3DeviceType, INTEGER },
+    { getObisKey(0, 3, 96, 1, 0), P1Telegram::PropertyId::MBus3EquipmentId, TEXT },
+    { getObisKey(0, 3, 24, 2, 1), P1Telegram::PropertyId::MBus3Value, P1ValueType::TimestampedFixed, 3, P1Unit::m3 },
+    { getObisKey(0, 4, 24, 1, 0), P1Telegram::PropertyId::MBus4DeviceType, INTEGER },
+    { getObisKey(0, 4, 96, 1, 0), P1Telegram::PropertyId::MBus4EquipmentId, TEXT },
+    { getObisKey(0, 4, 24, 2, 1), P1Telegram::PropertyId::MBus4Value, P1ValueType::TimestampedFixed, 3, P1Unit::m3 }
+};
+
+#undef FIXED
+#undef INTEGER
+#undef TEXT
+
+constexpr bool isPropertyTableComplete()
+{
+    if (sizeof(P1Properties) / sizeof(P1Properties[0]) != P1Telegram::PropertyCount)
+        return false;
+    for (size_t i = 0; i < P1Telegram::PropertyCount; i++)
+    {
+        if (static_cast<size_t>(P1Properties[i].id) != i)
+            return false;
+    }
+    return true;
+}
+
+static_assert(isPropertyTableComplete(), "P1Properties must match P1Telegram::PropertyId");
+
+struct ObisHashTable
+{
+    uint32_t multiplier;
+    uint8_t slots[1 << P1_OBIS_HASH_BITS]; // Property index + 1; 0 if empty
+};
+
+constexpr size_t getObisHash(uint32_t obisKey, uint32_t multiplier)
+{
+    return uint32_t(obisKey * multiplier) >> (32 - P1_OBIS_HASH_BITS);
+}
+
+// Searches a multiplier for which the (multiplicative) hash has no collisions for the OBIS IDs of all properties.
+constexpr ObisHashTable buildObisHashTable()
+{
+    ObisHashTable result = { 0x9E3779B1, {} };
+    for (int attempt = 0; attempt < 1000; attempt++)
+    {
+        bool collision = false;
+        for (size_t i = 0; i < sizeof(result.slots); i++)
+            result.slots[i] = 0;
+        for (size_t i = 0; (i < P1Telegram::PropertyCount) && !collision; i++)
+        {
+            size_t hash = getObisHash(P1Properties[i].obisKey, result.multiplier);
+            if (result.slots[hash] == 0)
+                result.slots[hash] = i + 1;
+            else
+                collision = true;
+        }
+        if (!collision)
+            return result;
+        result.multiplier = (result.multiplier * 1664525 + 1013904223) | 1;
+    }
+    result.multiplier = 0;
+    return result;
+}
+
+static constexpr ObisHashTable ObisHash PROGMEM = buildObisHashTable();
+
+static_assert(ObisHash.multiplier != 0, "No perfect hash found for the OBIS IDs");
+
+static const char* const UnitNames[] = { "", "kWh", "kW", "V", "A", "m3" };
+
+static const float DecimalDivisors[] = { 1.0F, 10.0F, 100.0F, 1000.0F };
+
+
 // Constructor
 P1Telegram::P1Telegram()
 {
-    addProperty(PropertyId::PowerDeliveredTotal, F("1-0:1.7.0"), F("Total delivered power"));
-    addProperty(PropertyId::PowerReturnedTotal, F("1-0:2.7.0"), F("Total returned power"));
-    addProperty(PropertyId::VoltageL1, F("1-0:32.7.0"), F("Voltage L1"));
-    addProperty(PropertyId::VoltageL2, F("1-0:52.7.0"), F("Voltage L2"));
-    addProperty(PropertyId::VoltageL3, F("1-0:72.7.0"), F("Voltage L3"));
-    addProperty(PropertyId::CurrentL1, F("1-0:31.7.0"), F("Current L1"));
-    addProperty(PropertyId::CurrentL2, F("1-0:51.7.0"), F("Current L2"));
-    addProperty(PropertyId::CurrentL3, F("1-0:71.7.0"), F("Current L3"));
-    addProperty(PropertyId::PowerDeliveredL1, F("1-0:21.7.0"), F("Power delivered L1"));
-    addProperty(PropertyId::PowerDeliveredL2, F("1-0:41.7.0"), F("Power delivered L2"));
-    addProperty(PropertyId::PowerDeliveredL3, F("1-0:61.7.0"), F("Power delivered L3"));
-    addProperty(PropertyId::PowerReturnedL1, F("1-0:22.7.0"), F("Power returned L1"));
-    addProperty(PropertyId::PowerReturnedL2, F("1-0:42.7.0"), F("Power returned L2"));
-    addProperty(PropertyId::PowerReturnedL3, F("1-0:62.7.0"), F("Power returned L3"));
-    addProperty(PropertyId::Gas, F("0-1:24.2.1"), F("Gas"));
-
+    _data[0] = 0;
+    _length = 0;
     _numDataLines = 0;
+    _message[0] = 0;
+    clearValues();
 }
 
 static float _testGasKWh = 0;
@@ -31,134 +183,323 @@ void P1Telegram::populateTestData()
     snprintf(gasDataLine, sizeof(gasDataLine), "0-1:24.2.1(201205%dW)(%0.3f*m3)\r\n", millis(), _testGasKWh);
     _testGasKWh += 0.123;
 
-    _dataLines[0] = F("1-0:32.7.0(233.1*V)\r\n");
-    _dataLines[1] = F("1-0:31.7.0(025*A)\r\n");
-    _dataLines[2] = F("1-0:21.7.0(05.828*kW)\r\n");
-    _dataLines[3] = F("1-0:22.7.0(01.234*kW)\r\n");
-    _dataLines[4] = F("1-0:52.7.0(232.6*V)\r\n");
-    _dataLines[5] = F("1-0:51.7.0(015*A)\r\n");
-    _dataLines[6] = F("1-0:41.7.0(03.489*kW)\r\n");
-    _dataLines[7] = F("1-0:42.7.0(00.001*kW)\r\n");
-    _dataLines[8] = gasDataLine;
-    _numDataLines = 9;
+    appendDataLine("1-0:32.7.0(233.1*V)\r\n");
+    appendDataLine("1-0:31.7.0(025*A)\r\n");
+    appendDataLine("1-0:21.7.0(05.828*kW)\r\n");
+    appendDataLine("1-0:22.7.0(01.234*kW)\r\n");
+    appendDataLine("1-0:52.7.0(232.6*V)\r\n");
+    appendDataLine("1-0:51.7.0(015*A)\r\n");
+    appendDataLine("1-0:41.7.0(03.489*kW)\r\n");
+    appendDataLine("1-0:42.7.0(00.001*kW)\r\n");
+    appendDataLine(gasDataLine);
 }
 
-void P1Telegram::addProperty(PropertyId propertyId, String obisId, String label)
+// Parses an OBIS ID "A-B:C.D.E" into a key (A and B 4 bits, C, D and E 8 bits).
+// Returns a pointer to the first char after the OBIS ID or nullptr if it is not an OBIS ID.
+const char* P1Telegram::parseObisId(const char* str, uint32_t& obisKey)
 {
-    int propertyIndex = static_cast<int>(propertyId);
-    _obisIds[propertyIndex] = obisId;
-    _labels[propertyIndex] = label;
+    static const char separators[] = { '-', ':', '.', '.' };
+
+    obisKey = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        uint32_t value = 0;
+        const char* start = str;
+        while (*str >= '0' && *str <= '9')
+            value = value * 10 + (*str++ - '0');
+
+        if ((str == start) || (value > ((i < 2) ? 15 : 255)))
+            return nullptr;
+        if (i < 4)
+        {
+            if (*str != separators[i])
+                return nullptr;
+            str++;
+        }
+
+        obisKey = (obisKey << ((i < 2) ? 4 : 8)) | value;
+    }
+    return str;
 }
 
-const char* P1Telegram::readDataLine(Stream& stream)
+// Parses a decimal number like "00.498" or "-1.5" in place into a fixed-point integer with the given decimals.
+// Stops at the first other char (e.g. '*' or ')').
+int32_t P1Telegram::parseFixed(const char* str, uint8_t decimals)
 {
-    static char dataLine[64];
-    size_t bytesRead = stream.readBytesUntil('\n', dataLine, sizeof(dataLine) - 1);
-    dataLine[bytesRead] = 0;
-    return dataLine;
+    bool negative = (*str == '-');
+    if (negative)
+        str++;
+
+    int32_t result = 0;
+    int fractionDigits = -1;
+    for (;; str++)
+    {
+        char c = *str;
+        if (c >= '0' && c <= '9')
+        {
+            if (fractionDigits < 0)
+                result = result * 10 + (c - '0');
+            else if (fractionDigits < decimals)
+            {
+                result = result * 10 + (c - '0');
+                fractionDigits++;
+            }
+        }
+        else if (c == '.' && fractionDigits < 0)
+            fractionDigits = 0;
+        else
+            break;
+    }
+
+    for (int i = std::max(fractionDigits, 0); i < decimals; i++)
+        result *= 10;
+
+    return negative ? -result : result;
 }
 
+void P1Telegram::indexDataLine(size_t offset)
+{
+    _numDataLines++;
+
+    uint32_t obisKey;
+    const char* valuePtr = parseObisId(_data + offset, obisKey);
+    if (valuePtr == nullptr || *valuePtr != '(')
+        return;
+
+    uint8_t slot = pgm_read_byte(&ObisHash.slots[getObisHash(obisKey, pgm_read_dword(&ObisHash.multiplier))]);
+    if (slot == 0)
+        return;
+
+    PropertyDescriptor descriptor;
+    memcpy_P(&descriptor, &P1Properties[slot - 1], sizeof(descriptor));
+    if (descriptor.obisKey != obisKey)
+        return;
+
+    size_t propertyIndex = slot - 1;
+    _valueOffsets[propertyIndex] = valuePtr - _data;
+
+    switch (descriptor.type)
+    {
+        case P1ValueType::Integer:
+        case P1ValueType::Fixed:
+            _values[propertyIndex] = parseFixed(valuePtr + 1, descriptor.decimals);
+            break;
 
-String P1Telegram::readFrom(Stream& stream)
+        case P1ValueType::TimestampedFixed:
+            valuePtr = strstr(valuePtr, ")(");
+            if (valuePtr != nullptr)
+                _values[propertyIndex] = parseFixed(valuePtr + 2, descriptor.decimals);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void P1Telegram::appendDataLine(const char* dataLine)
 {
-    Tracer tracer(F("P1Telegram::readFrom"));
+    size_t lineLength = strlen(dataLine);
+    if (_length + lineLength >= P1_TELEGRAM_SIZE)
+        return;
+
+    memcpy(_data + _length, dataLine, lineLength + 1);
+    indexDataLine(_length);
+    _length += lineLength;
+}
 
-    _numDataLines = 0;
 
-    // Find telegram header
-    const char* dataLine;
-    do
+bool P1Telegram::receive(Stream& stream)
+{
+    uint32_t currentMillis = millis();
+    int bytesAvailable = stream.available();
+    if (bytesAvailable <= 0)
     {
-        dataLine = readDataLine(stream);
-        if (dataLine[0] == 0)
+        if ((_state == ReceiveState::Receiving) && (currentMillis - _lastReceiveMillis > stream.getTimeout()))
         {
-            return F("ERROR: No P1 header found.");
+            strncpy_P(_message, PSTR("ERROR: P1 Timeout."), sizeof(_message));
+            rejectTelegram();
+            return true;
         }
-    } while (dataLine[0] != '/');
-    
-    if (strncmp(dataLine, "/test", 5) == 0)
-    {
-        populateTestData();
-        return String(dataLine);
+        return false;
     }
+    _lastReceiveMillis = currentMillis;
 
-    do
+    while (bytesAvailable-- > 0)
     {
-        dataLine = readDataLine(stream);
-        if (dataLine[0] == 0)
+        int c = stream.read();
+        if (c < 0)
+            break;
+
+        if (_state != ReceiveState::Receiving)
         {
-            return F("ERROR: P1 Timeout.");
+            // Skip anything until the telegram header
+            if (c != '/')
+                continue;
+            startTelegram();
         }
 
-        if (dataLine[0] == '!')
+        if (_length == P1_TELEGRAM_SIZE - 1)
         {
-            // TODO: verify CRC
-            return String();
+            strncpy_P(_message, PSTR("ERROR: P1 telegram too large."), sizeof(_message));
+            rejectTelegram();
+            return true;
         }
 
-        if (strlen(dataLine) > 2)
+        _data[_length++] = c;
+        _data[_length] = 0;
+        if ((c == '\n') && processDataLine())
+            return true;
+    }
+
+    return false;
+}
+
+
+void P1Telegram::startTelegram()
+{
+    _state = ReceiveState::Receiving;
+    _length = 0;
+    _lineStart = 0;
+    _numDataLines = 0;
+    _crc = 0;
+    _message[0] = 0;
+    clearValues();
+}
+
+
+// Processes the line just received; returns true if the telegram is complete.
+bool P1Telegram::processDataLine()
+{
+    const char* dataLine = _data + _lineStart;
+    size_t lineLength = _length - _lineStart;
+
+    if (_lineStart == 0)
+    {
+        // Telegram header
+        if (strncmp(dataLine, "/test", 5) == 0)
         {
-            _dataLines[_numDataLines++] = dataLine;
+            size_t messageLength = std::min(strcspn(dataLine, "\r\n"), sizeof(_message) - 1);
+            memcpy(_message, dataLine, messageLength);
+            _message[messageLength] = 0;
+            populateTestData();
+            _state = ReceiveState::Complete;
+            return true;
         }
+    }
+    else if (dataLine[0] == '!')
+    {
+        verifyCrc(updateCrc16(_crc, "!", 1), dataLine + 1);
+        return true;
+    }
+    else if (lineLength > 3)
+        indexDataLine(_lineStart);
 
-    } while (_numDataLines < MAX_DATA_LINES);
-    
-    return F("ERROR: Too many data lines received.");
+    _crc = updateCrc16(_crc, dataLine, lineLength);
+    _lineStart = _length;
+    return false;
 }
 
-String P1Telegram::getPropertyValue(PropertyId id, String* timestampPtr)
+
+void P1Telegram::verifyCrc(uint16_t crc, const char* crcPtr)
 {
-    String obisId = _obisIds[static_cast<int>(id)];
-    String label = _labels[static_cast<int>(id)];
+    size_t crcLength = strcspn(crcPtr, "\r\n");
+    if ((crcLength == 0) && !hasValue(PropertyId::Version))
+    {
+        // Telegrams without CRC and version (DSMR 2.2/3) are accepted as well
+        _state = ReceiveState::Complete;
+        _validTelegrams++;
+        return;
+    }
 
-    for (int i = 0; i < _numDataLines; i++)
+    if ((crcLength != 4) || (strspn(crcPtr, "0123456789ABCDEFabcdef") != 4))
     {
-        if (_dataLines[i].startsWith(obisId))
-        {
-            String dataLine = _dataLines[i];
+        strncpy_P(_message, PSTR("ERROR: P1 CRC missing or invalid."), sizeof(_message));
+        rejectTelegram();
+        return;
+    }
 
-            int valueStartIndex = dataLine.indexOf('(');
-            if (valueStartIndex < 0)
-            {
-                TRACE(F("ERROR: No value start marker: %s"), dataLine.c_str());
-                break;
-            }
+    uint16_t telegramCrc = strtoul(crcPtr, nullptr, 16);
+    if (telegramCrc != crc)
+    {
+        snprintf(_message, sizeof(_message), "ERROR: P1 CRC error (%04X, expected %04X).", telegramCrc, crc);
+        rejectTelegram();
+        return;
+    }
 
-            if (timestampPtr != nullptr)
-            {
-                int timestampEndIndex = dataLine.indexOf(')', valueStartIndex);
-                if (timestampEndIndex < 0)
-                {
-                    TRACE(F("ERROR: No timestamp end marker: %s\n"), dataLine.c_str());
-                    break;
-                }
-                *timestampPtr = dataLine.substring(valueStartIndex + 1, timestampEndIndex);
-                valueStartIndex = timestampEndIndex + 1;
-            }
+    _state = ReceiveState::Complete;
+    _validTelegrams++;
+}
 
-            int valueEndIndex = dataLine.indexOf('*', valueStartIndex);
-            if (valueEndIndex < 0)
-            {
-                valueEndIndex = dataLine.indexOf(')', valueStartIndex);
-                if (valueEndIndex < 0)
-                {
-                    TRACE(F("ERROR: No value end marker: %s\n"), dataLine.c_str());
-                    break;
-                }
-            }
 
-            String value = dataLine.substring(valueStartIndex + 1, valueEndIndex);
-            TRACE(F("'%s' = '%s'\n"), label.c_str() ,value.c_str()); 
-            return value;
-        }
+void P1Telegram::clearValues()
+{
+    memset(_valueOffsets, 0, sizeof(_valueOffsets));
+    memset(_values, 0, sizeof(_values));
+}
+
+
+void P1Telegram::rejectTelegram()
+{
+    _state = ReceiveState::Rejected;
+    _invalidTelegrams++;
+    clearValues();
+}
+
+
+P1Telegram::PropertyDescriptor P1Telegram::getDescriptor(PropertyId id)
+{
+    PropertyDescriptor result;
+    memcpy_P(&result, &P1Properties[static_cast<size_t>(id)], sizeof(result));
+    return result;
+}
+
+
+const char* P1Telegram::getUnitName(P1Unit unit)
+{
+    return UnitNames[static_cast<size_t>(unit)];
+}
+
+
+float P1Telegram::getFloatValue(PropertyId id) const
+{
+    if (!hasValue(id))
+    {
+        uint32_t obisKey = getDescriptor(id).obisKey;
+        TRACE(
+            F("ERROR: No value found for %u-%u:%u.%u.%u\n"),
+            obisKey >> 28, (obisKey >> 24) & 0xF, (obisKey >> 16) & 0xFF, (obisKey >> 8) & 0xFF, obisKey & 0xFF);
+        return 0.0;
     }
 
-    TRACE(F("ERROR: No value found for '%s' (%s)\n"), label.c_str(), obisId.c_str());
-    return String();
+    return _values[static_cast<size_t>(id)] / DecimalDivisors[getDescriptor(id).decimals];
 }
 
-float P1Telegram::getFloatValue(PropertyId id, String* timestampPtr)
+
+bool P1Telegram::getTimestamp(PropertyId id, char* timestamp) const
+{
+    timestamp[0] = 0;
+
+    P1ValueType type = getDescriptor(id).type;
+    if (!hasValue(id) || (type != P1ValueType::Timestamp && type != P1ValueType::TimestampedFixed))
+        return false;
+
+    const char* valuePtr = getRawValue(id) + 1;
+    size_t timestampLength = strcspn(valuePtr, ")\n");
+    if (valuePtr[timestampLength] != ')')
+    {
+        TRACE(F("ERROR: No timestamp end marker\n"));
+        return false;
+    }
+
+    size_t copyLength = std::min(timestampLength, size_t(P1_TIMESTAMP_SIZE - 1));
+    memcpy(timestamp, valuePtr, copyLength);
+    timestamp[copyLength] = 0;
+    return true;
+}
+
+
+const char* P1Telegram::getRawValue(PropertyId id) const
 {
-    String propertyValue = getPropertyValue(id, timestampPtr);
-    return (propertyValue.length() == 0) ? 0.0 : propertyValue.toFloat(); 
+    uint16_t valueOffset = _valueOffsets[static_cast<size_t>(id)];
+    return (valueOffset == 0) ? nullptr : _data + valueOffset;
 }
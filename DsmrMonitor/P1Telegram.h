@@ -1,15 +1,68 @@
+#ifndef P1TELEGRAM_H
+#define P1TELEGRAM_H
+
 #include <Stream.h>
-#include <String.h>
+#include <WString.h>
+
+#define P1_TELEGRAM_SIZE 1536
+#define P1_TIMESTAMP_SIZE 14
+#define P1_OBIS_HASH_BITS 8
 
-#define MAX_DATA_LINES 50
+enum struct P1ValueType : uint8_t
+{
+    Integer,            // e.g. 0-0:96.14.0(0002)
+    Fixed,              // e.g. 1-0:1.8.1(003808.351*kWh)
+    TimestampedFixed,   // e.g. 0-1:24.2.1(181106140010W)(01569.646*m3)
+    Timestamp,          // e.g. 0-0:1.0.0(181106140429W)
+    Text                // e.g. 0-0:96.1.1(4530303334303036383130353136343136)
+};
 
+enum struct P1Unit : uint8_t
+{
+    None,
+    kWh,
+    kW,
+    V,
+    A,
+    m3
+};
+
+// OBIS ID "A-B:C.D.E" packed in 32 bits (A and B 4 bits, C, D and E 8 bits)
+constexpr uint32_t getObisKey(uint8_t a, uint8_t b, uint8_t c, uint8_t d, uint8_t e)
+{
+    return (uint32_t(a) << 28) | (uint32_t(b) << 24) | (uint32_t(c) << 16) | (uint32_t(d) << 8) | e;
+}
+
+// P1 telegram (DSMR 5 / ESMR5) received in a fixed buffer.
+// The telegram is received incrementally (see receive), so it doesn't block the main loop.
+// The telegram's CRC16 is calculated and verified while it is received; telegrams with a CRC error are rejected.
+// The telegram is indexed while it is received: the properties are described by a constexpr table (see P1Telegram.cpp)
+// and found using a perfect hash on the OBIS ID. Numeric values are parsed in place into fixed-point integers.
 class P1Telegram
 {
     public:
-        enum class PropertyId
+        enum class PropertyId : uint8_t
         {
-            PowerDeliveredTotal = 0,
+            Version = 0,
+            Timestamp,
+            EquipmentId,
+            EnergyDeliveredTariff1,
+            EnergyDeliveredTariff2,
+            EnergyReturnedTariff1,
+            EnergyReturnedTariff2,
+            TariffIndicator,
+            PowerDeliveredTotal,
             PowerReturnedTotal,
+            PowerFailures,
+            LongPowerFailures,
+            PowerFailureLog,
+            VoltageSagsL1,
+            VoltageSagsL2,
+            VoltageSagsL3,
+            VoltageSwellsL1,
+            VoltageSwellsL2,
+            VoltageSwellsL3,
+            TextMessage,
             VoltageL1,
             VoltageL2,
             VoltageL3,
@@ -22,26 +75,144 @@ class P1Telegram
             PowerReturnedL1,
             PowerReturnedL2,
             PowerReturnedL3,
-            Gas,
+            MBus1DeviceType,
+            MBus1EquipmentId,
+            MBus1Value,
+            Gas = MBus1Value,
+            MBus2DeviceType,
+            MBus2EquipmentId,
+            MBus2Value,
+            MBus3DeviceType,
+            MBus3EquipmentId,
+            MBus3Value,
+            MBus4DeviceType,
+            MBus4EquipmentId,
+            MBus4Value,
             _EndMarker
         };
 
-        String _dataLines[MAX_DATA_LINES];
-        size_t _numDataLines;
+        static const size_t PropertyCount = static_cast<size_t>(PropertyId::_EndMarker);
+
+        struct PropertyDescriptor
+        {
+            uint32_t obisKey;
+            PropertyId id;
+            P1ValueType type;
+            uint8_t decimals; // Fixed-point values are stored multiplied by 10^decimals
+            P1Unit unit;
+        };
 
         // Constructor
         P1Telegram();
 
-        String readFrom(Stream& stream);
+        // Receives the bytes available on the given stream, without waiting for more.
+        // Returns true if a telegram has been received completely or has been rejected (see isValid and getMessage).
+        bool receive(Stream& stream);
+
+        bool isReceiving() const
+        {
+            return _state == ReceiveState::Receiving;
+        }
+
+        bool isValid() const
+        {
+            return _state == ReceiveState::Complete;
+        }
+
+        // Returns the error message for a rejected telegram or the header of a test telegram ("/test...").
+        const char* getMessage() const
+        {
+            return _message;
+        }
+
+        // The raw telegram as received (including line endings)
+        const char* getData() const
+        {
+            return _data;
+        }
+
+        size_t getLength() const
+        {
+            return _length;
+        }
+
+        size_t getDataLineCount() const
+        {
+            return _numDataLines;
+        }
+
+        uint32_t getValidTelegrams() const
+        {
+            return _validTelegrams;
+        }
+
+        uint32_t getInvalidTelegrams() const
+        {
+            return _invalidTelegrams;
+        }
+
+        float getErrorRatio() const
+        {
+            uint32_t telegrams = _validTelegrams + _invalidTelegrams;
+            return (telegrams == 0) ? 0.0F : float(_invalidTelegrams) / telegrams;
+        }
+
+        bool hasValue(PropertyId id) const
+        {
+            return _valueOffsets[static_cast<size_t>(id)] != 0;
+        }
 
-        String getPropertyValue(PropertyId propertyId, String* timestampPtr = nullptr);
-        float getFloatValue(PropertyId id, String* timestampPtr = nullptr);
+        // Returns the numeric value multiplied by 10^decimals (e.g. Wh for kWh with 3 decimals); 0 if not present.
+        int32_t getFixedValue(PropertyId id) const
+        {
+            return _values[static_cast<size_t>(id)];
+        }
+
+        float getFloatValue(PropertyId id) const;
+
+        // Copies the timestamp (e.g. "181106140010W") of a Timestamp or TimestampedFixed property.
+        // The buffer must have room for P1_TIMESTAMP_SIZE chars.
+        bool getTimestamp(PropertyId id, char* timestamp) const;
+
+        // Returns a pointer to the first '(' following the OBIS ID in the telegram, or nullptr if not present.
+        const char* getRawValue(PropertyId id) const;
+
+        static PropertyDescriptor getDescriptor(PropertyId id);
+        static const char* getUnitName(P1Unit unit);
 
     private:
-        String _obisIds[static_cast<size_t>(PropertyId::_EndMarker)];
-        String _labels[static_cast<size_t>(PropertyId::_EndMarker)];
+        enum class ReceiveState : uint8_t
+        {
+            Idle,
+            Receiving,
+            Complete,
+            Rejected
+        };
+
+        ReceiveState _state = ReceiveState::Idle;
+        char _data[P1_TELEGRAM_SIZE];
+        size_t _length;
+        size_t _numDataLines;
+        uint16_t _valueOffsets[PropertyCount]; // Offset of the '(' following the OBIS ID; 0 if not present
+        int32_t _values[PropertyCount];
+        uint32_t _validTelegrams = 0;
+        uint32_t _invalidTelegrams = 0;
+        size_t _lineStart;
+        uint16_t _crc;
+        uint32_t _lastReceiveMillis;
+        char _message[48];
 
-        void addProperty(PropertyId propertyId, String obisId, String label);
-        const char* readDataLine(Stream& stream);
+        void startTelegram();
+        bool processDataLine();
+        void indexDataLine(size_t offset);
+        void appendDataLine(const char* dataLine);
         void populateTestData();
+        void clearValues();
+        void rejectTelegram();
+        void verifyCrc(uint16_t crc, const char* crcPtr);
+
+        static const char* parseObisId(const char* str, uint32_t& obisKey);
+        static int32_t parseFixed(const char* str, uint8_t decimals);
 };
+
+#endif
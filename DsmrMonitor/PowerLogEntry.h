@@ -1,4 +1,4 @@
-struct PowerLogEntry
+struct __attribute__ ((packed)) PowerLogEntry
 {
     time_t time;
     uint16_t powerDelivered[3];
@@ -0,0 +1,1099 @@
+// Generated by tools/embed_static_files.py from data/; do not edit.
+#ifndef STATIC_FILES_H
+#define STATIC_FILES_H
+
+#include <StaticFile.h>
+
+// Calibrate.svg: 951 bytes, 577 bytes gzipped
+static const char Calibrate_svg_Path[] PROGMEM = "/Calibrate.svg";
+static const char Calibrate_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Calibrate_svg_ETag[] PROGMEM = "\"696005dfc9e7601f\"";
+static const uint8_t Calibrate_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x53, 0x4D, 0x8F, 0xDB, 0x20,
+    0x10, 0xBD, 0xE7, 0x57, 0x50, 0x2A, 0xED, 0x09, 0x30, 0x1F, 0xFE, 0x20, 0x59, 0x3B, 0xAB, 0xF6,
+    0xD0, 0xBD, 0x24, 0x97, 0xED, 0xB6, 0x87, 0x5C, 0x56, 0xD4, 0x26, 0x89, 0x25, 0x62, 0x22, 0x9B,
+    0x26, 0xA9, 0xAA, 0xFE, 0xF7, 0x0E, 0x76, 0xBB, 0xEB, 0x4A, 0xB5, 0x61, 0x04, 0x6F, 0x1E, 0x33,
+    0x6F, 0xD0, 0x50, 0x3E, 0xDC, 0x4E, 0x0E, 0x5D, 0x6C, 0x3F, 0xB4, 0xBE, 0xAB, 0xB0, 0x60, 0x1C,
+    0x23, 0xDB, 0xD5, 0xBE, 0x69, 0xBB, 0x43, 0x85, 0xBF, 0x87, 0x3D, 0xD5, 0xF8, 0x61, 0x5D, 0xBE,
+    0xA3, 0x14, 0x7D, 0x39, 0x3B, 0x6F, 0x1A, 0xDB, 0xA0, 0xE0, 0x57, 0xE8, 0xF3, 0xD7, 0x47, 0xF4,
+    0x64, 0xCF, 0x9E, 0xA0, 0xEB, 0xF5, 0xCA, 0x86, 0xCB, 0xA1, 0x87, 0x0D, 0xAB, 0xFD, 0x89, 0xA0,
+    0x47, 0xDB, 0xD9, 0xDE, 0x04, 0xDF, 0xBF, 0xB1, 0xD0, 0xB6, 0xBD, 0xD9, 0x1E, 0x3D, 0x7B, 0xEF,
+    0x06, 0x44, 0xE9, 0x7A, 0x51, 0xC2, 0x09, 0xB4, 0x6F, 0x9D, 0xAB, 0xF0, 0xFB, 0x4F, 0xE3, 0x87,
+    0xD1, 0xB5, 0x6D, 0xC2, 0xB1, 0xC2, 0x9A, 0xF3, 0xF3, 0x0D, 0xA3, 0xA3, 0x6D, 0x0F, 0xC7, 0xF0,
+    0xBA, 0xBD, 0xB4, 0xF6, 0xFA, 0xD1, 0xDF, 0x2A, 0xCC, 0x11, 0x47, 0x4A, 0xC2, 0xC0, 0xA8, 0x6D,
+    0x2A, 0xDC, 0xD6, 0xBE, 0xC3, 0x08, 0x6A, 0xE8, 0x86, 0x0A, 0x1F, 0x43, 0x38, 0xAF, 0x92, 0x24,
+    0x2A, 0xBA, 0x2A, 0xE6, 0xFB, 0x43, 0x22, 0x39, 0xE7, 0x09, 0xE4, 0xC2, 0x90, 0xB2, 0xB1, 0xFB,
+    0x61, 0x5D, 0x0E, 0xE1, 0x87, 0xB3, 0x6B, 0x56, 0xBB, 0x81, 0x8A, 0x9F, 0x51, 0xC1, 0xAA, 0xF3,
+    0x9D, 0xBD, 0xFF, 0x55, 0x26, 0x93, 0xA7, 0x4C, 0x46, 0xDE, 0xA2, 0x0C, 0x6D, 0x80, 0x6D, 0x6D,
+    0x5C, 0xFB, 0x0D, 0xAA, 0xB1, 0x65, 0x32, 0x01, 0x8B, 0xF2, 0x6C, 0xC2, 0x11, 0x41, 0xEA, 0xAD,
+    0xD4, 0x4C, 0x2B, 0x22, 0x05, 0x13, 0x05, 0x91, 0x19, 0x11, 0x05, 0x53, 0x85, 0x63, 0x79, 0x41,
+    0x61, 0x1A, 0x41, 0x04, 0xE1, 0xD3, 0x4F, 0x05, 0x4B, 0x85, 0xA3, 0x39, 0xCD, 0xDF, 0xD0, 0x11,
+    0x23, 0xFC, 0xC8, 0x1D, 0x65, 0xC5, 0x12, 0xC6, 0x46, 0x70, 0x56, 0x08, 0xA2, 0x98, 0x5C, 0xFE,
+    0x97, 0x95, 0x92, 0x94, 0x32, 0x21, 0x99, 0xC8, 0x60, 0x39, 0x0B, 0x44, 0x00, 0x24, 0x82, 0xC9,
+    0xDC, 0x29, 0xA2, 0x66, 0x30, 0x9C, 0x94, 0x84, 0x43, 0x54, 0x22, 0x54, 0x4C, 0x2F, 0x19, 0x5F,
+    0x92, 0x68, 0x68, 0xCA, 0x34, 0x49, 0x21, 0xE3, 0x5C, 0x22, 0x19, 0x25, 0x4A, 0x22, 0x3F, 0xCC,
+    0x22, 0x70, 0x22, 0xD3, 0x79, 0xA2, 0x4C, 0x82, 0x82, 0xCC, 0xA5, 0x4C, 0x29, 0x2A, 0x59, 0x0E,
+    0xD1, 0xD2, 0x34, 0x9A, 0xEC, 0xDF, 0xB4, 0x93, 0xE0, 0xF1, 0x1E, 0x0A, 0xA8, 0xA7, 0x58, 0x82,
+    0xD1, 0xCA, 0x40, 0x01, 0x7F, 0x38, 0x19, 0xCB, 0x73, 0x1A, 0xCD, 0x6E, 0x1B, 0xE5, 0x71, 0x96,
+    0x69, 0x47, 0x33, 0x92, 0x6D, 0x62, 0xF1, 0x51, 0xAE, 0x2E, 0x48, 0xCE, 0x0A, 0x4D, 0x34, 0xCB,
+    0x55, 0x94, 0x91, 0x45, 0x71, 0x79, 0x2C, 0x20, 0x9A, 0x0D, 0x30, 0xE0, 0xB6, 0x53, 0xC6, 0xF5,
+    0xEE, 0xA4, 0x89, 0x10, 0x20, 0x46, 0xA7, 0x93, 0xC9, 0x88, 0xDA, 0x2C, 0x63, 0xE5, 0x12, 0x24,
+    0x41, 0xAC, 0x51, 0x8E, 0x04, 0x3E, 0xAC, 0xF3, 0xDD, 0x69, 0x74, 0x8D, 0x6A, 0x80, 0x31, 0xE9,
+    0x8D, 0xE7, 0xD4, 0x74, 0xC5, 0xE0, 0xA0, 0xA3, 0xDE, 0x08, 0x4D, 0x38, 0x40, 0x63, 0x09, 0x6F,
+    0x7C, 0x98, 0xD1, 0xB3, 0xC3, 0x09, 0xB4, 0x42, 0x6F, 0xEB, 0x30, 0xB6, 0xE1, 0xCB, 0x73, 0x6F,
+    0xBA, 0xE1, 0x6C, 0x7A, 0xDB, 0x85, 0x97, 0x27, 0x40, 0x4D, 0x77, 0x70, 0xF6, 0x05, 0xA3, 0xC6,
+    0x04, 0x43, 0x3B, 0x73, 0xB2, 0x15, 0xBE, 0x73, 0xE1, 0x7E, 0x46, 0x43, 0xAF, 0xB4, 0xBB, 0x43,
+    0xB8, 0xC7, 0xA8, 0x76, 0x66, 0x80, 0x1E, 0x1E, 0x1B, 0xF3, 0xF5, 0x31, 0xC4, 0x36, 0xFF, 0xFB,
+    0x12, 0x60, 0x1D, 0x73, 0xC6, 0x76, 0x5E, 0xFF, 0x06, 0xAF, 0x36, 0x14, 0x45, 0xB7, 0x03, 0x00,
+    0x00,
+};
+
+// Graph.svg: 493 bytes, 302 bytes gzipped
+static const char Graph_svg_Path[] PROGMEM = "/Graph.svg";
+static const char Graph_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Graph_svg_ETag[] PROGMEM = "\"03a7c9b308f8d649\"";
+static const uint8_t Graph_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x90, 0xCB, 0x6E, 0xC2, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xE9, 0x74, 0x4B, 0x1C, 0x3B, 0x71, 0x44, 0x82, 0x30, 0x48, 0xAD,
+    0x54, 0xBA, 0x80, 0x4D, 0x1F, 0xEC, 0x23, 0x62, 0x12, 0xB7, 0xC1, 0x13, 0x39, 0x86, 0xE4, 0xF3,
+    0x6B, 0x50, 0x4B, 0xDB, 0x0F, 0xE8, 0x95, 0x65, 0x69, 0x8E, 0x6D, 0xDD, 0x23, 0xCF, 0x97, 0xE3,
+    0xA1, 0x85, 0x93, 0x76, 0xBD, 0x21, 0xAB, 0x50, 0x30, 0x8E, 0xA0, 0xED, 0x8E, 0x2A, 0x63, 0x6B,
+    0x85, 0x47, 0xBF, 0x8F, 0x72, 0x5C, 0x2E, 0xE6, 0xB7, 0x51, 0x04, 0x6F, 0x5D, 0x4B, 0x65, 0xA5,
+    0x2B, 0xF0, 0x34, 0x83, 0x97, 0xED, 0x0A, 0x9E, 0x75, 0x47, 0x13, 0x18, 0x86, 0x81, 0xF5, 0xA7,
+    0xDA, 0x85, 0x81, 0xED, 0xE8, 0x30, 0x81, 0x95, 0xB6, 0xDA, 0x95, 0x9E, 0xDC, 0xCF, 0x2D, 0xD8,
+    0x98, 0x51, 0x3B, 0x78, 0x25, 0x6A, 0x7B, 0x88, 0xA2, 0xC5, 0xCD, 0x3C, 0xBC, 0x80, 0xC1, 0x54,
+    0xBE, 0x51, 0x98, 0x73, 0xDE, 0x8D, 0x08, 0x8D, 0x36, 0x75, 0xE3, 0xAF, 0xE3, 0xC9, 0xE8, 0xE1,
+    0x9E, 0x46, 0x85, 0x1C, 0x38, 0x24, 0x32, 0x2C, 0x84, 0xBD, 0x69, 0x5B, 0x85, 0x77, 0xFC, 0x12,
+    0x84, 0x60, 0x6E, 0x7B, 0x85, 0x8D, 0xF7, 0xDD, 0x2C, 0x8E, 0xCF, 0x1E, 0x43, 0xCA, 0xC8, 0xD5,
+    0x71, 0x12, 0x8E, 0xE3, 0xD0, 0x80, 0xA1, 0xA8, 0x2B, 0x7D, 0x03, 0x95, 0xC2, 0x8D, 0x84, 0x6C,
+    0x2B, 0x8A, 0x07, 0x09, 0xA2, 0x60, 0x59, 0x96, 0xA4, 0x20, 0x99, 0x94, 0xD3, 0x69, 0x02, 0x09,
+    0x87, 0x2C, 0x6C, 0x4F, 0xA2, 0x40, 0xE8, 0xBD, 0xA3, 0x0F, 0x1D, 0x3A, 0x1E, 0x2F, 0xF9, 0x06,
+    0xD1, 0x97, 0x6A, 0x72, 0x05, 0xAD, 0xB1, 0x7A, 0x57, 0x76, 0x0A, 0x1D, 0x1D, 0x6D, 0xF5, 0x07,
+    0xBF, 0x93, 0xB1, 0xDF, 0x3C, 0xFE, 0x6D, 0x20, 0x72, 0x28, 0xD6, 0x22, 0x05, 0x91, 0xB2, 0x22,
+    0x64, 0x2D, 0x38, 0xCB, 0x40, 0x08, 0x26, 0x8B, 0x22, 0x5F, 0x4F, 0x41, 0xC8, 0x33, 0xCE, 0xFF,
+    0x47, 0xE2, 0xFC, 0x1D, 0x8B, 0x4F, 0x9B, 0x87, 0x3D, 0xE7, 0xED, 0x01, 0x00, 0x00,
+};
+
+// Home.svg: 1891 bytes, 864 bytes gzipped
+static const char Home_svg_Path[] PROGMEM = "/Home.svg";
+static const char Home_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Home_svg_ETag[] PROGMEM = "\"7fcea6beaa9c719f\"";
+static const uint8_t Home_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x65, 0x55, 0x4D, 0x6F, 0x23, 0x37,
+    0x0C, 0xBD, 0xF7, 0x57, 0xA8, 0xD3, 0xEB, 0x5A, 0xA6, 0x24, 0xEA, 0x83, 0x8B, 0x38, 0x0B, 0x74,
+    0x80, 0x6E, 0x0E, 0xD9, 0x4B, 0x3F, 0x72, 0xE8, 0x2D, 0x58, 0x7B, 0x63, 0x03, 0x5E, 0x8F, 0xE1,
+    0xB8, 0x71, 0x7E, 0x7E, 0x49, 0x4A, 0xF2, 0x6C, 0xDD, 0x20, 0xF0, 0xE8, 0x49, 0x24, 0xDF, 0x1B,
+    0xF2, 0xC9, 0xBE, 0xFB, 0xF4, 0xFE, 0x7D, 0x6F, 0xDE, 0x36, 0xA7, 0xD7, 0xDD, 0x74, 0x58, 0x0D,
+    0xCE, 0xC2, 0x60, 0x36, 0x87, 0xAF, 0xD3, 0x7A, 0x77, 0x78, 0x59, 0x0D, 0xFF, 0x9C, 0xBF, 0x2D,
+    0xCA, 0xF0, 0xE9, 0xFE, 0xEE, 0xE7, 0xC5, 0xC2, 0xFC, 0x75, 0xDC, 0x4F, 0xCF, 0xEB, 0xCD, 0xDA,
+    0x9C, 0xA7, 0x8F, 0xE6, 0x8F, 0xA7, 0xCF, 0xE6, 0xF7, 0xCD, 0x71, 0xFA, 0x60, 0x2E, 0x97, 0x8B,
+    0x7D, 0x7D, 0x7B, 0x39, 0x31, 0xB0, 0x5F, 0xA7, 0xEF, 0x1F, 0xCC, 0xE7, 0xCD, 0x61, 0x73, 0x7A,
+    0x3E, 0x4F, 0xA7, 0x39, 0xCA, 0x7C, 0xD9, 0xBD, 0x6F, 0x4E, 0xE6, 0xCF, 0x69, 0xDA, 0xBF, 0x9A,
+    0xC5, 0xE2, 0xFE, 0xA7, 0x3B, 0xCE, 0x30, 0x97, 0xDD, 0xFA, 0xBC, 0x5D, 0x0D, 0x05, 0xE0, 0xF8,
+    0x3E, 0x98, 0xED, 0x66, 0xF7, 0xB2, 0x3D, 0x5F, 0xE1, 0xDB, 0x6E, 0x73, 0xF9, 0x75, 0x7A, 0x5F,
+    0x0D, 0x60, 0xC0, 0x78, 0xE4, 0xFF, 0xC1, 0x7C, 0xDB, 0xED, 0xF7, 0xAB, 0xE1, 0x97, 0xDF, 0xF4,
+    0x6F, 0x30, 0xAC, 0xFC, 0xF0, 0xBA, 0x1A, 0xB6, 0xE7, 0xF3, 0xF1, 0xE3, 0x72, 0x29, 0x3A, 0x2E,
+    0xC1, 0x4E, 0xA7, 0x97, 0xA5, 0x07, 0x80, 0x25, 0x33, 0x0C, 0x4C, 0x74, 0x7C, 0x3E, 0x6F, 0xCD,
+    0x7A, 0x35, 0x7C, 0xF1, 0x60, 0x9C, 0xB3, 0x39, 0x8E, 0x8E, 0x6C, 0x09, 0x39, 0x55, 0x04, 0xD9,
+    0x30, 0x4E, 0x99, 0xA2, 0xE0, 0x44, 0x45, 0x60, 0xAC, 0xE0, 0xD1, 0x79, 0x13, 0x2D, 0xE1, 0x23,
+    0x5A, 0xAC, 0x3B, 0x23, 0x5A, 0x4F, 0x50, 0xB2, 0xE6, 0x3A, 0x0A, 0x06, 0x2D, 0x30, 0xD6, 0xC3,
+    0x9C, 0x21, 0x99, 0x60, 0x0B, 0x05, 0x42, 0xC5, 0xE8, 0xE3, 0x18, 0xB8, 0x64, 0x06, 0x5F, 0xE3,
+    0x31, 0xF0, 0x79, 0xE4, 0xB4, 0x5A, 0x0C, 0xC8, 0x31, 0xD6, 0x58, 0x94, 0x48, 0x5F, 0x20, 0xA9,
+    0x2A, 0xA6, 0x20, 0x3E, 0xF1, 0x9E, 0xD0, 0x09, 0x16, 0x0A, 0xC1, 0x31, 0x47, 0x8E, 0x06, 0xA5,
+    0xD0, 0xF8, 0x98, 0xB2, 0x60, 0xA6, 0xE0, 0xE3, 0x50, 0x85, 0x81, 0x32, 0x08, 0x51, 0x14, 0x80,
+    0x8F, 0x5C, 0x80, 0x97, 0xFC, 0x0A, 0xA3, 0x90, 0x66, 0x7E, 0x43, 0xB4, 0x01, 0x7C, 0x0A, 0x52,
+    0x9A, 0x1B, 0x91, 0x19, 0x7B, 0x8E, 0xF5, 0xFA, 0x1C, 0x9D, 0xB7, 0x2E, 0xF9, 0xD0, 0x37, 0x6D,
+    0xF0, 0xE0, 0xE7, 0x0C, 0x2F, 0x9D, 0xE0, 0x5A, 0x8F, 0x1E, 0xB4, 0x27, 0xFC, 0x39, 0xF2, 0x32,
+    0x52, 0xF4, 0x95, 0x3A, 0x93, 0xF1, 0xA2, 0xC8, 0x39, 0x55, 0x56, 0xA2, 0xE2, 0xEC, 0x0A, 0xA9,
+    0xF2, 0x0C, 0x24, 0xF1, 0x19, 0xEB, 0x9B, 0x42, 0x6C, 0xE7, 0x80, 0xDA, 0x23, 0x8F, 0x98, 0x34,
+    0x5F, 0x9B, 0xA2, 0x95, 0x43, 0x15, 0x1A, 0x21, 0xC8, 0x01, 0x62, 0xD1, 0xC0, 0x58, 0x4A, 0x11,
+    0x1C, 0x30, 0x68, 0x6C, 0x42, 0x2A, 0x12, 0xEE, 0x03, 0xD5, 0x5E, 0x83, 0x1E, 0x3B, 0xEF, 0xEA,
+    0x28, 0x58, 0x5E, 0x9F, 0xFF, 0xDF, 0x83, 0x59, 0xFE, 0xE8, 0x0B, 0xA7, 0x23, 0xCF, 0xF1, 0x21,
+    0x8D, 0xD1, 0x16, 0x50, 0xA5, 0x8C, 0x31, 0x23, 0x0F, 0x3F, 0x39, 0x7D, 0x6D, 0x76, 0x48, 0x62,
+    0xC7, 0x44, 0x8B, 0xD9, 0x47, 0xC5, 0xD1, 0xB3, 0x93, 0xA2, 0x0D, 0x81, 0x25, 0x0B, 0x0E, 0x45,
+    0xE3, 0x7D, 0xF4, 0x51, 0xF3, 0x1D, 0x15, 0xA7, 0x98, 0xC1, 0x13, 0x87, 0x8F, 0xBA, 0xE6, 0x38,
+    0x70, 0x3C, 0x5C, 0x4E, 0xE4, 0x21, 0x7B, 0xC6, 0xCE, 0x41, 0x10, 0x97, 0x61, 0x22, 0x1E, 0x66,
+    0xB1, 0x24, 0xCF, 0x51, 0x88, 0x65, 0xBF, 0xD8, 0xA2, 0x71, 0x2A, 0x8C, 0xF3, 0x0A, 0xEB, 0x34,
+    0x49, 0x1F, 0x63, 0x12, 0x0E, 0xB6, 0x50, 0xDD, 0x63, 0x01, 0x94, 0xCA, 0x35, 0x21, 0x71, 0xE3,
+    0x20, 0x84, 0x6B, 0xC1, 0xC4, 0x93, 0x07, 0x1E, 0x7D, 0x27, 0x4C, 0x92, 0xD4, 0xD5, 0x34, 0x10,
+    0x9F, 0x5C, 0x61, 0x91, 0x0F, 0x2E, 0xF3, 0xA7, 0x6A, 0xD6, 0xD5, 0x35, 0x8C, 0x11, 0xAB, 0xBE,
+    0x96, 0x60, 0x88, 0xE2, 0xBC, 0x4E, 0xC1, 0x58, 0x44, 0x5F, 0x25, 0x30, 0x66, 0xD1, 0x4D, 0x9F,
+    0x2B, 0x55, 0x34, 0x33, 0x88, 0xEA, 0xBE, 0x29, 0xAA, 0xF3, 0x9C, 0x51, 0x54, 0xF5, 0x5C, 0xB1,
+    0xB0, 0x6A, 0x37, 0x13, 0x96, 0x1F, 0x45, 0x77, 0xC4, 0xAA, 0x49, 0x22, 0x75, 0x60, 0xBD, 0xF1,
+    0x92, 0x29, 0x03, 0xEB, 0x83, 0x91, 0xCA, 0x5E, 0x18, 0xDB, 0xE0, 0x94, 0xB9, 0xC6, 0xD7, 0xB8,
+    0xD2, 0xF2, 0xDA, 0xE0, 0xBB, 0x27, 0xFE, 0xE7, 0x15, 0xAC, 0xFB, 0xA3, 0x0B, 0xF2, 0x72, 0xB3,
+    0x53, 0x18, 0x8B, 0x55, 0xE6, 0x82, 0x41, 0xAD, 0x32, 0x13, 0x06, 0xB5, 0xCA, 0x2C, 0x48, 0xAE,
+    0x73, 0x8D, 0xAF, 0xC4, 0xA1, 0x59, 0x85, 0x6F, 0x18, 0x5B, 0x91, 0xAF, 0x4A, 0xAE, 0x2F, 0x06,
+    0xB6, 0xCA, 0xD6, 0xAE, 0xC9, 0x8D, 0xCA, 0xAE, 0x16, 0xA1, 0x7A, 0xD7, 0xA5, 0x5F, 0x42, 0xC2,
+    0x4F, 0x09, 0xAE, 0xFB, 0x54, 0xC3, 0xA0, 0x65, 0x91, 0xD6, 0x80, 0x26, 0x9D, 0x9A, 0x97, 0xEA,
+    0x36, 0x35, 0xA7, 0xB5, 0x1C, 0x6A, 0x46, 0xEC, 0x25, 0xA9, 0x19, 0xB5, 0x53, 0x52, 0x95, 0x59,
+    0x0B, 0xD3, 0x55, 0xF3, 0x48, 0xDD, 0xF9, 0xAE, 0xF6, 0x85, 0xFA, 0xCD, 0x70, 0xB5, 0x2F, 0xD4,
+    0x6F, 0x8E, 0xD3, 0xC5, 0x48, 0xFD, 0x66, 0xB9, 0xDA, 0x17, 0xEA, 0x37, 0xCF, 0xB5, 0xBE, 0x40,
+    0x5D, 0x3E, 0x38, 0xFE, 0xDA, 0xC2, 0xD6, 0xA3, 0x7E, 0x86, 0xAD, 0x87, 0x2D, 0x97, 0x71, 0x1D,
+    0x6E, 0xAB, 0xCD, 0xB8, 0xCE, 0xA0, 0x71, 0x33, 0xAE, 0x33, 0x6A, 0xDA, 0x04, 0xCB, 0x57, 0x9B,
+    0xF6, 0x17, 0x6F, 0x8C, 0x83, 0x37, 0xC6, 0xC1, 0x1B, 0xE3, 0xE0, 0x8D, 0x71, 0xF0, 0xC6, 0x38,
+    0xF8, 0x1F, 0xE3, 0xC8, 0x8F, 0xD0, 0xFD, 0xBF, 0x00, 0x20, 0x89, 0x5E, 0x63, 0x07, 0x00, 0x00,
+};
+
+// LogFile.svg: 1064 bytes, 392 bytes gzipped
+static const char LogFile_svg_Path[] PROGMEM = "/LogFile.svg";
+static const char LogFile_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char LogFile_svg_ETag[] PROGMEM = "\"e9ab3d26f6d62e2e\"";
+static const uint8_t LogFile_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x93, 0xCB, 0x4E, 0xC3, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xC1, 0x6C, 0x9B, 0x89, 0x1F, 0x79, 0x56, 0x49, 0x90, 0x58, 0x40,
+    0x37, 0x6C, 0x78, 0x74, 0xC1, 0xA6, 0xAA, 0x1A, 0x37, 0x89, 0x94, 0xC6, 0x51, 0x62, 0x9A, 0xF2,
+    0xF7, 0x38, 0x6D, 0x45, 0x03, 0x12, 0x90, 0x2E, 0xB0, 0x2C, 0x59, 0x33, 0x9A, 0xA3, 0x7B, 0xEF,
+    0x48, 0x8E, 0x6E, 0xF6, 0xDB, 0x12, 0x76, 0xB2, 0x69, 0x0B, 0x55, 0xC5, 0x84, 0x21, 0x25, 0x20,
+    0xAB, 0xB5, 0x4A, 0x8B, 0x2A, 0x8B, 0xC9, 0x9B, 0xDE, 0x58, 0x01, 0xB9, 0x49, 0xA2, 0x2B, 0xCB,
+    0x82, 0x97, 0xBA, 0x54, 0xAB, 0x54, 0xA6, 0xA0, 0xD5, 0x0C, 0x9E, 0x16, 0xF7, 0xF0, 0x28, 0x6B,
+    0x35, 0x85, 0xAE, 0xEB, 0xB0, 0xDD, 0x65, 0x8D, 0x29, 0x70, 0xAD, 0xB6, 0x53, 0xB8, 0x97, 0x95,
+    0x6C, 0x56, 0x5A, 0x35, 0xE7, 0x29, 0x78, 0x28, 0xF6, 0xB2, 0x81, 0x67, 0xA5, 0xCA, 0x16, 0x2C,
+    0x2B, 0x99, 0x44, 0x86, 0x80, 0x4D, 0x51, 0x96, 0x31, 0xB9, 0xBE, 0x3B, 0x1C, 0x02, 0x5D, 0x91,
+    0xEA, 0x3C, 0x26, 0x01, 0xA5, 0xF5, 0x9E, 0x40, 0x2E, 0x8B, 0x2C, 0xD7, 0x9F, 0xE5, 0xAE, 0x90,
+    0xDD, 0xAD, 0xDA, 0xC7, 0x84, 0x02, 0x05, 0xC1, 0xCD, 0x25, 0x60, 0x9C, 0x57, 0x6D, 0x4C, 0x72,
+    0xAD, 0xEB, 0x99, 0x6D, 0xF7, 0x3E, 0x3A, 0x81, 0xAA, 0xC9, 0x6C, 0x4E, 0x29, 0xB5, 0x8D, 0x02,
+    0x31, 0x42, 0xBA, 0xD0, 0xA5, 0x4C, 0x8C, 0x94, 0x5C, 0xEA, 0xF7, 0x5A, 0x2E, 0x4B, 0x95, 0x45,
+    0xF6, 0xB1, 0x39, 0x89, 0xEA, 0x95, 0xCE, 0x21, 0x8D, 0xC9, 0x03, 0x0F, 0xD1, 0x99, 0x72, 0x1F,
+    0xBD, 0x39, 0x47, 0x77, 0xE1, 0xA0, 0x3B, 0xEF, 0x3B, 0xAF, 0x5B, 0x8B, 0xBB, 0x18, 0x5A, 0x6C,
+    0xCE, 0x03, 0x74, 0x16, 0xAE, 0x69, 0x0B, 0x74, 0x5F, 0x89, 0x6D, 0xD0, 0x46, 0xAE, 0x35, 0x18,
+    0x3F, 0x66, 0x9E, 0xC0, 0x7B, 0x4C, 0xDC, 0xFE, 0x3D, 0x45, 0xE0, 0x1E, 0x86, 0xE7, 0x04, 0xAC,
+    0x2F, 0x86, 0x08, 0x63, 0x28, 0x84, 0x38, 0x50, 0xE1, 0x80, 0x0A, 0x90, 0x79, 0xFE, 0x00, 0xFB,
+    0x11, 0x62, 0x1C, 0x69, 0x20, 0x3E, 0x39, 0x76, 0xB0, 0x30, 0x02, 0x73, 0xD0, 0x3F, 0xAB, 0x31,
+    0x8A, 0x1E, 0x1B, 0x27, 0xE7, 0xA3, 0x3B, 0x94, 0x73, 0xC6, 0xFA, 0xE4, 0x74, 0x90, 0x2E, 0xC4,
+    0x40, 0x38, 0xBF, 0x51, 0xC7, 0x35, 0x72, 0xF1, 0x3D, 0xDB, 0x6F, 0x62, 0xEE, 0x89, 0x1A, 0xAE,
+    0xD1, 0x39, 0xEA, 0xFF, 0x41, 0x7C, 0xDB, 0xE1, 0x7F, 0x42, 0x0E, 0x7A, 0x7D, 0x84, 0xCB, 0x20,
+    0x1F, 0xF9, 0xA5, 0x91, 0xBE, 0xAC, 0x7B, 0x24, 0x22, 0x46, 0x04, 0xEA, 0x7F, 0x52, 0xF2, 0x01,
+    0x93, 0x18, 0xC4, 0xA1, 0x28, 0x04, 0x00, 0x00,
+};
+
+// Logo.png: 10914 bytes, 10937 bytes gzipped (stored uncompressed)
+static const char Logo_png_Path[] PROGMEM = "/Logo.png";
+static const char Logo_png_ContentType[] PROGMEM = "image/png";
+static const char Logo_png_ETag[] PROGMEM = "\"c3d6292e30ff7318\"";
+static const uint8_t Logo_png_Data[] PROGMEM =
+{
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x08, 0x06, 0x00, 0x00, 0x00, 0xC3, 0x3E, 0x61,
+    0xCB, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
+    0x00, 0x04, 0x67, 0x41, 0x4D, 0x41, 0x00, 0x00, 0xB1, 0x8F, 0x0B, 0xFC, 0x61, 0x05, 0x00, 0x00,
+    0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0E, 0xC3, 0x00, 0x00, 0x0E, 0xC3, 0x01, 0xC7,
+    0x6F, 0xA8, 0x64, 0x00, 0x00, 0x2A, 0x37, 0x49, 0x44, 0x41, 0x54, 0x78, 0x5E, 0xED, 0x7D, 0x07,
+    0x60, 0x55, 0xE5, 0xDD, 0xFE, 0x73, 0xEE, 0xCD, 0xCD, 0x84, 0x10, 0xC2, 0x16, 0x90, 0x15, 0x66,
+    0xD8, 0x10, 0xB6, 0x0C, 0x17, 0xCA, 0x96, 0xA5, 0xB5, 0xD6, 0xD9, 0xD6, 0xB6, 0xFA, 0xB5, 0x9F,
+    0x76, 0x38, 0xEA, 0xBF, 0x40, 0xAD, 0xB6, 0xD2, 0xEA, 0xD7, 0x4F, 0xAA, 0xAD, 0x68, 0x2D, 0x8E,
+    0x62, 0x91, 0x8D, 0x88, 0x38, 0x10, 0x50, 0xD9, 0x7B, 0x84, 0xBD, 0xC1, 0x30, 0x82, 0x61, 0x93,
+    0xDC, 0x79, 0xBE, 0xE7, 0x39, 0xE7, 0x46, 0x03, 0x42, 0x72, 0x13, 0xEE, 0x08, 0xFE, 0xF3, 0xE8,
+    0xE1, 0xE6, 0x9E, 0xFD, 0xBE, 0xBF, 0xE7, 0xB7, 0xDE, 0x75, 0x51, 0x81, 0x0A, 0x54, 0xA0, 0x02,
+    0x15, 0xA8, 0x40, 0x05, 0x2A, 0x50, 0x81, 0xFF, 0xFF, 0x60, 0x04, 0x3F, 0xBF, 0xD3, 0x30, 0x4D,
+    0xD3, 0x18, 0x3B, 0x76, 0xAC, 0x33, 0x33, 0x33, 0xD3, 0x71, 0xF8, 0xF0, 0xE1, 0x62, 0xCB, 0x9C,
+    0x98, 0x98, 0x18, 0xC8, 0xC9, 0xC9, 0xF1, 0x8F, 0x1B, 0x37, 0x2E, 0x10, 0xDC, 0xF5, 0x9D, 0xC6,
+    0x77, 0x8A, 0x00, 0x12, 0xF4, 0xD4, 0xA9, 0x53, 0x1D, 0xD9, 0xD9, 0xD9, 0x17, 0x94, 0xEB, 0xC6,
+    0x1B, 0xB3, 0x2A, 0xF7, 0xEC, 0xD6, 0xA3, 0x27, 0x90, 0x9B, 0x85, 0xC0, 0xD1, 0x6A, 0x30, 0x4F,
+    0x3B, 0x00, 0x6F, 0xF0, 0x68, 0x21, 0x5C, 0xAC, 0x8D, 0xD4, 0x00, 0x1C, 0xB5, 0xBE, 0x02, 0xAA,
+    0xAE, 0x3A, 0xB4, 0x7D, 0xED, 0xD2, 0x7F, 0x4E, 0x5D, 0x76, 0x3A, 0x78, 0x10, 0x24, 0x8F, 0xC9,
+    0xFB, 0x9A, 0xDF, 0x35, 0x62, 0x5C, 0xF5, 0x04, 0x08, 0x6A, 0xB7, 0x55, 0x8E, 0x07, 0x1E, 0xB8,
+    0xB3, 0x4E, 0xBD, 0x3A, 0xF9, 0xDD, 0xE0, 0x5D, 0x95, 0x09, 0xDF, 0xB2, 0x54, 0xF8, 0xD6, 0x03,
+    0xBE, 0x1D, 0x40, 0xC0, 0x17, 0x0F, 0x67, 0x46, 0x06, 0x8C, 0x94, 0xD6, 0xFC, 0x92, 0x02, 0xF8,
+    0x79, 0xFE, 0xC5, 0x72, 0xD4, 0x2D, 0x9C, 0xFC, 0x70, 0x16, 0xC0, 0x74, 0x6F, 0x41, 0xE0, 0x00,
+    0x2F, 0xCC, 0x3F, 0x8F, 0xB8, 0x66, 0x40, 0x5C, 0x07, 0x6E, 0xDD, 0x4F, 0xC3, 0xD5, 0x75, 0x73,
+    0x6E, 0x5E, 0xDC, 0xD2, 0x97, 0x5F, 0x9E, 0x7A, 0x8C, 0xCF, 0x34, 0x0D, 0xC3, 0x30, 0xED, 0x6B,
+    0xAF, 0x5E, 0x5C, 0x95, 0x04, 0x28, 0x14, 0xFA, 0x98, 0x31, 0x8F, 0x37, 0x80, 0x67, 0x7D, 0x07,
+    0xC3, 0x37, 0xAB, 0x99, 0xE9, 0x9E, 0x9B, 0x8C, 0xC0, 0xB1, 0xCA, 0x70, 0x34, 0x68, 0x05, 0xD3,
+    0xD7, 0x12, 0xE6, 0xC9, 0x24, 0xE0, 0x14, 0x4F, 0x3E, 0xC3, 0xCD, 0xA7, 0x72, 0xC6, 0x73, 0x4B,
+    0x31, 0x0C, 0x50, 0xFB, 0x2F, 0x0F, 0xD3, 0x84, 0xC9, 0x5A, 0x39, 0xCF, 0x7F, 0xDD, 0x24, 0x43,
+    0x00, 0x46, 0x25, 0xEE, 0xAD, 0x02, 0x38, 0xAA, 0x78, 0x0C, 0x33, 0x71, 0xA7, 0x69, 0xE6, 0x6E,
+    0x82, 0xA3, 0xF2, 0x09, 0xC3, 0x75, 0xD3, 0x79, 0x33, 0x7E, 0xD0, 0x4E, 0x23, 0xA1, 0xFB, 0x9A,
+    0xB1, 0x63, 0xFF, 0x74, 0xE0, 0x6A, 0xB5, 0x0C, 0x57, 0x1D, 0x01, 0x02, 0x81, 0x40, 0x13, 0x78,
+    0xA7, 0x77, 0x41, 0xFE, 0xA4, 0x86, 0xF0, 0xEE, 0xAE, 0x43, 0x01, 0xB5, 0xA3, 0xA0, 0x33, 0x60,
+    0xE6, 0xC6, 0x23, 0x70, 0xD2, 0xC1, 0x12, 0xC5, 0x53, 0x78, 0x12, 0xF4, 0x85, 0x65, 0x2B, 0x6D,
+    0x49, 0x2F, 0xD2, 0xED, 0x20, 0x31, 0xDC, 0xFC, 0xF7, 0x3C, 0x8C, 0x24, 0xBA, 0x8A, 0x3A, 0x3E,
+    0xBA, 0x8A, 0xBD, 0x64, 0xC6, 0x46, 0x23, 0xAE, 0xD6, 0x3E, 0x33, 0xE9, 0xDE, 0xBD, 0x70, 0x0D,
+    0x5C, 0xE9, 0x70, 0x24, 0x71, 0xDF, 0xD5, 0x83, 0x72, 0x4F, 0x00, 0x69, 0xBB, 0x69, 0xBA, 0x33,
+    0x0C, 0xEF, 0xD6, 0xF6, 0x66, 0xC1, 0x8B, 0xF5, 0xE0, 0xDD, 0x5E, 0x97, 0x34, 0xC8, 0x82, 0x79,
+    0xA4, 0x21, 0xCC, 0x9C, 0x24, 0x98, 0x9E, 0x64, 0x0A, 0x9B, 0x66, 0x3D, 0x88, 0x48, 0x97, 0xA8,
+    0x08, 0x31, 0x48, 0x8A, 0x02, 0xFA, 0x86, 0xB3, 0x30, 0xAA, 0xBB, 0xE1, 0xAC, 0x77, 0x10, 0x8E,
+    0xEA, 0x6B, 0xE0, 0x68, 0xBC, 0x1B, 0xC9, 0x3F, 0x3E, 0x00, 0x67, 0xDB, 0x0D, 0x74, 0x11, 0xBB,
+    0xCB, 0xBB, 0x9B, 0x28, 0xB7, 0x04, 0x18, 0x33, 0x66, 0x8C, 0x63, 0xEC, 0xD8, 0x27, 0x9A, 0x99,
+    0x9E, 0x39, 0xED, 0x91, 0x3F, 0xB5, 0x33, 0x02, 0x27, 0xBA, 0xC3, 0x3C, 0x74, 0x2D, 0xFC, 0xFB,
+    0x13, 0x61, 0xE6, 0x4B, 0xE8, 0xC9, 0xC1, 0x53, 0x63, 0x57, 0x8A, 0x0B, 0xC9, 0xE0, 0x81, 0x11,
+    0x7F, 0x86, 0x96, 0x81, 0x9F, 0x4D, 0xBE, 0x84, 0xAB, 0xDE, 0x32, 0x24, 0x0C, 0x5D, 0x4A, 0xAB,
+    0xB0, 0xD6, 0x30, 0x12, 0x76, 0x96, 0x57, 0x22, 0x30, 0xEA, 0x29, 0x5F, 0x90, 0xE0, 0x17, 0x2D,
+    0x7A, 0xAF, 0x79, 0xDF, 0xAE, 0xFB, 0xFB, 0xE2, 0xFC, 0xF8, 0x01, 0xF0, 0x2E, 0x19, 0x0E, 0xDF,
+    0xAA, 0x5E, 0x08, 0x6C, 0x6A, 0x6C, 0x98, 0xC7, 0xAB, 0x19, 0xF0, 0x49, 0xF8, 0x2E, 0x4B, 0xE8,
+    0x85, 0x5B, 0xAC, 0x50, 0xE4, 0x1D, 0xF8, 0xBF, 0xD3, 0x80, 0x3F, 0xD9, 0x30, 0x4F, 0x55, 0x46,
+    0x60, 0x6F, 0x75, 0x04, 0xF6, 0x34, 0x86, 0x6F, 0x7F, 0x2B, 0x78, 0xBE, 0xA8, 0x85, 0xC0, 0xB9,
+    0x94, 0x31, 0x7F, 0x98, 0x4C, 0x97, 0xE1, 0x3C, 0xB9, 0x78, 0xF1, 0xE2, 0x72, 0x45, 0x84, 0x58,
+    0x56, 0xDF, 0x05, 0x78, 0xF7, 0xDD, 0x77, 0x9D, 0x23, 0x47, 0x0E, 0xA1, 0x7F, 0xFF, 0x90, 0x1A,
+    0x3F, 0xB9, 0x0B, 0x02, 0x87, 0x7B, 0xC1, 0x97, 0x5D, 0x0F, 0xF8, 0x8A, 0x42, 0x47, 0xA2, 0x75,
+    0x52, 0xB9, 0x79, 0xDB, 0x10, 0x40, 0x31, 0x9B, 0x01, 0xE6, 0x9A, 0x8E, 0xC4, 0x3C, 0x38, 0x3B,
+    0x1C, 0x84, 0xAB, 0xF9, 0x52, 0x24, 0xDC, 0xB9, 0x04, 0xAE, 0xEB, 0xD6, 0x8C, 0x1B, 0xF7, 0xA7,
+    0xBD, 0xE5, 0x25, 0x68, 0x2C, 0x17, 0x55, 0xFA, 0xCA, 0x2B, 0xAF, 0xB8, 0xEE, 0xF9, 0x5E, 0xCF,
+    0xA6, 0xF1, 0x8E, 0x77, 0x06, 0xC0, 0xB7, 0x7D, 0x28, 0x3C, 0x0B, 0xE9, 0xDF, 0xBF, 0xAA, 0x49,
+    0x4D, 0x57, 0xE4, 0x7E, 0x75, 0x09, 0xFE, 0x62, 0x88, 0x08, 0x26, 0xA8, 0xFD, 0x89, 0xB9, 0x70,
+    0xDD, 0x72, 0x00, 0xF1, 0x1D, 0x67, 0x23, 0xF9, 0xEE, 0xD9, 0x8B, 0x17, 0xEF, 0xDD, 0xD1, 0xAF,
+    0x5F, 0x3F, 0xEE, 0x8F, 0x2D, 0x62, 0x5A, 0xB5, 0xD4, 0xFA, 0xF8, 0x21, 0xFD, 0x3B, 0x36, 0xF0,
+    0x7B, 0xDE, 0xCA, 0x4C, 0x72, 0xED, 0xE8, 0x69, 0xF8, 0x16, 0xF7, 0x33, 0xFD, 0x47, 0x32, 0x0D,
+    0x23, 0x70, 0xF5, 0x69, 0x7C, 0x49, 0xB0, 0x2C, 0x82, 0xE1, 0x83, 0xA3, 0xEA, 0x76, 0xB8, 0x6E,
+    0x5C, 0x80, 0xF8, 0xEE, 0x8B, 0xDD, 0x8E, 0xE1, 0x1B, 0x96, 0x2F, 0xDF, 0xB3, 0x3F, 0x96, 0x44,
+    0x88, 0x59, 0x15, 0x4B, 0xEB, 0xEF, 0xBD, 0xB3, 0x4B, 0x33, 0x57, 0x60, 0x32, 0xB5, 0x7E, 0xED,
+    0x60, 0xF8, 0x96, 0x35, 0x04, 0xCE, 0xD7, 0xFE, 0xDA, 0xBF, 0x7F, 0x47, 0x41, 0xB7, 0xE0, 0x87,
+    0x19, 0x77, 0x0C, 0xF1, 0x59, 0x07, 0x10, 0xD7, 0x7B, 0x8E, 0xD7, 0xB8, 0x67, 0xCE, 0xD2, 0xD5,
+    0x47, 0xB7, 0xC5, 0x8A, 0x04, 0x51, 0xAF, 0xEA, 0xD5, 0xAB, 0x57, 0xBB, 0x32, 0x32, 0x52, 0xAF,
+    0x4D, 0x34, 0x56, 0xB7, 0x88, 0x37, 0x3F, 0xEE, 0x03, 0xEF, 0xAC, 0x1B, 0x60, 0x9E, 0x6C, 0x45,
+    0x3B, 0x99, 0xA0, 0xE3, 0x86, 0x32, 0xF9, 0xEF, 0x3A, 0xEC, 0xF8, 0xC0, 0x07, 0x23, 0x79, 0x07,
+    0x12, 0x46, 0x7D, 0xEC, 0x09, 0xDC, 0xF6, 0x69, 0x81, 0xA3, 0xC3, 0xE6, 0x5D, 0xBB, 0x72, 0x0F,
+    0x76, 0xEE, 0xDC, 0xF9, 0xE2, 0x36, 0xEA, 0x88, 0x22, 0xAA, 0x95, 0x3D, 0x6F, 0xDE, 0xBC, 0x84,
+    0xAC, 0xAC, 0x7A, 0x8D, 0xAA, 0xA5, 0xAC, 0xA7, 0x9F, 0x5F, 0x30, 0x08, 0xEE, 0x69, 0x0D, 0x80,
+    0x73, 0x75, 0xF8, 0x16, 0x4E, 0x6A, 0x7E, 0xE4, 0xDE, 0x45, 0x6D, 0x7F, 0xDA, 0xF4, 0x84, 0xE2,
+    0xDA, 0x01, 0x15, 0x9F, 0x17, 0x6E, 0x0A, 0xD1, 0x22, 0x1C, 0xA6, 0x91, 0x04, 0x01, 0x5A, 0x83,
+    0xA3, 0x48, 0x18, 0x71, 0x00, 0x09, 0x03, 0xE7, 0x7A, 0x7C, 0xDD, 0x66, 0x6C, 0xDE, 0x71, 0x7A,
+    0x67, 0x34, 0x49, 0x10, 0x35, 0x02, 0x2C, 0x5C, 0xB8, 0x30, 0xB1, 0x6D, 0x5B, 0x64, 0x54, 0x4D,
+    0xF8, 0x6C, 0x08, 0xDC, 0xEF, 0x8F, 0x80, 0x6F, 0x5D, 0x6B, 0xC0, 0xEB, 0xD2, 0xB1, 0x88, 0x68,
+    0xBD, 0x12, 0x5C, 0x6E, 0x01, 0x0A, 0xF1, 0xFC, 0x59, 0x20, 0xE7, 0x2B, 0xE6, 0x13, 0xA7, 0x80,
+    0x93, 0x67, 0x48, 0xB9, 0xF3, 0x80, 0x87, 0x55, 0xCC, 0xE0, 0xCC, 0x02, 0xC9, 0x87, 0x78, 0xBE,
+    0x49, 0xA5, 0x14, 0x20, 0xAD, 0x32, 0x50, 0x23, 0x0D, 0xA8, 0x5D, 0x0D, 0x48, 0xE6, 0x77, 0xEB,
+    0xC5, 0xFC, 0xDC, 0x22, 0x44, 0x06, 0x92, 0xC0, 0x84, 0xE9, 0x08, 0x20, 0xAE, 0xDD, 0x56, 0x24,
+    0x0E, 0x9D, 0xE6, 0x35, 0x87, 0x4D, 0xDF, 0xB4, 0xDD, 0xB7, 0x3D, 0x5A, 0x24, 0x88, 0x0A, 0x01,
+    0xA4, 0xF9, 0x37, 0x5C, 0x97, 0x90, 0xE1, 0x32, 0xE7, 0x0F, 0x35, 0x3C, 0xEF, 0x0C, 0x37, 0xFD,
+    0x39, 0x6D, 0x60, 0x04, 0x5C, 0x61, 0xD7, 0x7A, 0xDD, 0x8D, 0x42, 0xF7, 0x53, 0x58, 0x27, 0x28,
+    0xEC, 0x3D, 0x87, 0x81, 0x23, 0x47, 0xF9, 0x77, 0x0E, 0xB0, 0x6E, 0x23, 0xB0, 0x6D, 0x27, 0xB0,
+    0xEF, 0x20, 0x70, 0x34, 0x17, 0x38, 0x7B, 0xCE, 0x26, 0x87, 0x75, 0x19, 0xAF, 0x4B, 0x49, 0x06,
+    0x6A, 0xD5, 0x00, 0xAE, 0x65, 0xE2, 0xD9, 0x3C, 0x03, 0xE8, 0xD0, 0x06, 0xA8, 0x59, 0x1F, 0xA8,
+    0xCB, 0xEF, 0x4D, 0xAE, 0x01, 0x52, 0x49, 0x0C, 0x87, 0x08, 0x23, 0x32, 0x44, 0x00, 0x0C, 0x10,
+    0xFD, 0x30, 0x6A, 0x91, 0x04, 0x23, 0xA6, 0x7A, 0xF0, 0x93, 0xA9, 0xCB, 0xD6, 0x1C, 0xDF, 0x19,
+    0x8D, 0xB8, 0x20, 0xE2, 0x04, 0xB0, 0xCD, 0xFE, 0xF9, 0x46, 0xD5, 0x13, 0x16, 0x0D, 0x33, 0x0B,
+    0x26, 0x8D, 0x80, 0x79, 0xAE, 0x2D, 0x0C, 0x33, 0xFC, 0xC2, 0xA7, 0xE0, 0xF3, 0x3D, 0xD4, 0xF4,
+    0xE3, 0xC0, 0xFE, 0x2F, 0x81, 0xAD, 0xEB, 0x81, 0x59, 0xF3, 0x80, 0xA5, 0xAB, 0x68, 0x67, 0xA4,
+    0xED, 0x14, 0x76, 0x80, 0x02, 0x94, 0xD6, 0x17, 0x6A, 0xFE, 0xA5, 0x20, 0x32, 0x68, 0x73, 0x70,
+    0x8B, 0xA3, 0x55, 0xC8, 0x6A, 0x0F, 0x0C, 0xBD, 0x95, 0x84, 0xE8, 0x02, 0x34, 0x66, 0x98, 0x7A,
+    0x4D, 0x75, 0x5A, 0x0B, 0x59, 0x97, 0x08, 0x10, 0xC1, 0xF4, 0xF3, 0xAE, 0xCE, 0xA4, 0x6C, 0x24,
+    0xDC, 0x33, 0xC5, 0x83, 0x87, 0x66, 0x46, 0x83, 0x04, 0x11, 0x25, 0x80, 0x84, 0xDF, 0xB5, 0x83,
+    0x37, 0xA3, 0x6A, 0xCA, 0xFC, 0x21, 0xC8, 0x7F, 0x7D, 0x38, 0xE0, 0x6E, 0xCB, 0xDD, 0xAE, 0xB0,
+    0x9A, 0x7C, 0xF5, 0xEC, 0x53, 0x18, 0xFB, 0x8F, 0x00, 0x9B, 0xB6, 0x02, 0x9F, 0x7C, 0x08, 0xCC,
+    0x9E, 0x0F, 0xE4, 0xE5, 0x71, 0x3F, 0xAB, 0xCE, 0xC7, 0x2D, 0x2E, 0x8E, 0xA6, 0x3D, 0x95, 0x5B,
+    0x15, 0x9A, 0xF9, 0x4A, 0x34, 0xED, 0x49, 0xB6, 0xC9, 0xFF, 0xBA, 0x1D, 0x94, 0xD7, 0x7B, 0x48,
+    0x9E, 0xF3, 0xF9, 0xC0, 0x69, 0xBA, 0x8B, 0x93, 0xB4, 0x1E, 0xA7, 0x4E, 0x73, 0x37, 0xF7, 0x5B,
+    0x44, 0xE0, 0xF5, 0xE9, 0x55, 0x81, 0x01, 0x37, 0x01, 0x83, 0x86, 0x00, 0x1D, 0xDB, 0xD1, 0x32,
+    0x90, 0x08, 0x71, 0x2A, 0x45, 0x98, 0x5D, 0x83, 0x1D, 0x1C, 0x3A, 0xB6, 0x20, 0xFE, 0x7B, 0xD3,
+    0x3C, 0x8E, 0xC7, 0xA7, 0x45, 0x9A, 0x04, 0x11, 0x23, 0x80, 0x72, 0xFC, 0x7E, 0xFD, 0x52, 0x1B,
+    0x57, 0x4B, 0x98, 0x7E, 0x9B, 0x91, 0x3F, 0x69, 0x84, 0x09, 0x2F, 0xCD, 0x3E, 0x85, 0x1F, 0x4E,
+    0xCD, 0xA7, 0x00, 0x73, 0xE9, 0xD3, 0x77, 0xEC, 0x02, 0x66, 0x4E, 0x07, 0x26, 0xFD, 0x87, 0xA6,
+    0x9D, 0x02, 0x94, 0x7F, 0x77, 0x05, 0x85, 0x56, 0x83, 0x66, 0x3D, 0x9D, 0xC2, 0x6A, 0xD3, 0x02,
+    0x68, 0x9F, 0x49, 0xF3, 0xDE, 0x84, 0x66, 0xBE, 0xAE, 0x7D, 0xCC, 0x61, 0xB7, 0x36, 0x20, 0xE0,
+    0xA6, 0xD0, 0x4F, 0x02, 0x07, 0xE9, 0x2A, 0x76, 0xEC, 0x01, 0xD6, 0x67, 0x03, 0x1B, 0xB7, 0xD0,
+    0x55, 0x90, 0x54, 0x47, 0x8F, 0xD1, 0x85, 0xF0, 0x98, 0x45, 0x06, 0x92, 0x4D, 0xAE, 0xE0, 0x0E,
+    0x52, 0xF9, 0x07, 0xDF, 0x07, 0x32, 0x19, 0xC5, 0x54, 0x51, 0x53, 0x55, 0x98, 0xAD, 0x01, 0x49,
+    0x40, 0x77, 0x40, 0x12, 0x24, 0xCA, 0x12, 0x3C, 0x3E, 0x63, 0xD9, 0x9A, 0x9C, 0x88, 0x91, 0x20,
+    0x22, 0x04, 0x90, 0xF0, 0x6F, 0xB8, 0xAE, 0x72, 0xD3, 0xF4, 0x94, 0xD9, 0x83, 0xA9, 0xF9, 0x23,
+    0x4D, 0x78, 0xC2, 0x2B, 0x7C, 0x0A, 0x42, 0x8A, 0xB7, 0x9F, 0xC2, 0x99, 0x4B, 0x6D, 0x9F, 0xF4,
+    0x2F, 0xDB, 0xBF, 0x4B, 0x83, 0x93, 0xA8, 0xDD, 0x75, 0x6A, 0xD1, 0x5C, 0x37, 0x02, 0x7A, 0x76,
+    0x05, 0x86, 0xD0, 0x7C, 0x37, 0x6E, 0x69, 0x13, 0xC2, 0x49, 0xD3, 0x2F, 0xA5, 0xD7, 0xA7, 0x5E,
+    0xA4, 0xE8, 0xCB, 0x04, 0xF8, 0xC5, 0xE4, 0xA6, 0xA1, 0x22, 0xDA, 0x64, 0x3D, 0xF6, 0xF1, 0x9E,
+    0xF3, 0x68, 0x51, 0x3E, 0x5B, 0x02, 0x6C, 0x26, 0x21, 0x8E, 0x31, 0x76, 0x70, 0xD3, 0x52, 0xC4,
+    0xF1, 0x26, 0xCD, 0x18, 0x27, 0xDC, 0x75, 0x17, 0x89, 0x70, 0x27, 0xDD, 0x82, 0xC8, 0xA4, 0x17,
+    0x2A, 0xC6, 0xB5, 0x94, 0x16, 0xB6, 0x25, 0x70, 0xD2, 0x12, 0xDC, 0x31, 0x1D, 0x49, 0xBF, 0x9D,
+    0xB1, 0x78, 0x69, 0x64, 0xDA, 0x0A, 0x8A, 0xD6, 0x41, 0x58, 0x60, 0x6B, 0x7E, 0x5D, 0x6A, 0xFE,
+    0x94, 0xE1, 0x86, 0xFB, 0xF5, 0xE1, 0x66, 0xE0, 0x6C, 0xD8, 0x85, 0xEF, 0x66, 0x45, 0x1F, 0x38,
+    0x00, 0x8C, 0xFF, 0x1F, 0xE0, 0x9D, 0x19, 0x40, 0x41, 0x01, 0x0B, 0xC2, 0xBB, 0x2B, 0x88, 0x6B,
+    0x4B, 0xAD, 0x1C, 0x4D, 0x0D, 0x1D, 0x36, 0x98, 0x66, 0x9E, 0x51, 0x7C, 0x3C, 0xB5, 0xD3, 0x12,
+    0xB8, 0x9E, 0x5E, 0x1A, 0x01, 0xF1, 0xFC, 0x80, 0xDC, 0x8B, 0x9E, 0xC7, 0xFB, 0x7F, 0x40, 0xA2,
+    0x4D, 0x9E, 0x02, 0x2C, 0x59, 0x61, 0xBB, 0x08, 0x05, 0x90, 0xF1, 0xD4, 0xFE, 0xDB, 0x06, 0x02,
+    0xCF, 0xFC, 0x0E, 0xA8, 0x77, 0x2D, 0xBF, 0x87, 0x9F, 0x04, 0xB4, 0x04, 0x89, 0x5B, 0x8D, 0x84,
+    0xEF, 0x4F, 0x37, 0x2B, 0x3F, 0x3D, 0x65, 0xF1, 0xE2, 0xED, 0x61, 0xB7, 0x04, 0x85, 0x5E, 0x30,
+    0x2C, 0x90, 0xF0, 0x87, 0xDE, 0xDA, 0xAC, 0x59, 0x65, 0xD7, 0x07, 0x43, 0x0C, 0xF7, 0x3B, 0x23,
+    0xCC, 0xC0, 0xF1, 0xB0, 0x0B, 0x3F, 0x9F, 0x15, 0xBC, 0x66, 0x1D, 0x85, 0xFF, 0x02, 0x30, 0x63,
+    0x2E, 0x53, 0x3A, 0x46, 0xF3, 0xF2, 0xED, 0x99, 0x34, 0xF1, 0x0F, 0xDE, 0x07, 0x8C, 0x79, 0x92,
+    0xA6, 0xBE, 0x03, 0x7D, 0x3D, 0x7D, 0xBC, 0x04, 0xA2, 0xC8, 0xBD, 0xAC, 0x0F, 0x57, 0x07, 0x6E,
+    0x1C, 0xB7, 0x04, 0x69, 0x7C, 0x2B, 0xFA, 0xFF, 0xFE, 0x40, 0x55, 0x3E, 0x2B, 0x97, 0x81, 0xA6,
+    0x48, 0x90, 0x4F, 0x62, 0xC8, 0xF2, 0xEC, 0xA1, 0xDB, 0x68, 0x42, 0x8B, 0x53, 0x83, 0xD9, 0x82,
+    0x15, 0x17, 0x84, 0x89, 0x04, 0xAC, 0x37, 0x07, 0x02, 0xBE, 0x6A, 0x08, 0x1C, 0xAA, 0x29, 0x9B,
+    0xD7, 0xB0, 0xE1, 0x80, 0xDC, 0xBE, 0x37, 0x0C, 0xCA, 0x7B, 0xE3, 0x8D, 0x37, 0x44, 0xB5, 0xB0,
+    0x20, 0xAC, 0x04, 0x78, 0xF5, 0x6F, 0xCF, 0x36, 0x4A, 0x4E, 0xFC, 0xE2, 0x36, 0xA3, 0x60, 0xDA,
+    0x48, 0xD3, 0xBF, 0xAD, 0x8D, 0x61, 0x04, 0xE2, 0xC3, 0x29, 0xFC, 0x02, 0xDE, 0x69, 0x25, 0xA3,
+    0xFA, 0xBF, 0xFC, 0x95, 0x1A, 0xF9, 0x89, 0x9D, 0xCF, 0xD7, 0x60, 0xBE, 0x3E, 0x90, 0x82, 0xF9,
+    0xED, 0x63, 0xC0, 0xAD, 0xB7, 0x50, 0x40, 0xF4, 0xEB, 0x8A, 0xEF, 0xC2, 0xDA, 0xFB, 0xCE, 0x7B,
+    0x39, 0x59, 0xE5, 0x89, 0xD4, 0xF8, 0x0E, 0x9D, 0x81, 0x4E, 0x9D, 0xB8, 0x8F, 0x96, 0x65, 0xCB,
+    0x76, 0x5A, 0x07, 0xC6, 0x0F, 0xBB, 0xF6, 0xD2, 0x5D, 0x70, 0xCB, 0x60, 0x7C, 0x51, 0x9B, 0xA9,
+    0x63, 0xA1, 0x8B, 0x09, 0x07, 0x18, 0x30, 0x93, 0x04, 0xF9, 0x24, 0xC1, 0xE9, 0x5A, 0x86, 0x33,
+    0x8D, 0xF7, 0xEF, 0xB5, 0xFF, 0x99, 0x67, 0xFE, 0x72, 0x22, 0x78, 0xF8, 0x8A, 0x11, 0x36, 0x02,
+    0x28, 0xE2, 0x6F, 0x7A, 0xED, 0xE6, 0x2E, 0xCE, 0xC0, 0xC2, 0x07, 0xE0, 0x5D, 0xD0, 0xDE, 0x30,
+    0x7C, 0x09, 0xE1, 0xAB, 0x05, 0x46, 0xF3, 0x7C, 0xD3, 0x15, 0x2B, 0x81, 0x17, 0x5F, 0x02, 0x3E,
+    0x5E, 0x68, 0xFB, 0xFB, 0x9A, 0x34, 0xF9, 0xF7, 0x7E, 0x0F, 0x78, 0x8A, 0xC2, 0x57, 0xE5, 0x27,
+    0xEB, 0x79, 0xE1, 0x14, 0xFC, 0xC5, 0x10, 0x11, 0xB8, 0xD5, 0xAA, 0x0D, 0x74, 0x63, 0x5A, 0x98,
+    0x4A, 0x17, 0xB3, 0x8A, 0xE9, 0x66, 0x3E, 0xDF, 0xE5, 0xC0, 0x21, 0xA6, 0xA0, 0x4C, 0x3F, 0x9B,
+    0x28, 0x55, 0x24, 0x09, 0xAE, 0xC4, 0xF2, 0x5C, 0x0C, 0xCB, 0x12, 0xF8, 0x73, 0xD3, 0x0D, 0xF8,
+    0xAB, 0x78, 0xFC, 0x35, 0x76, 0xDD, 0x74, 0xCB, 0x4F, 0x76, 0x86, 0xCB, 0x0A, 0x84, 0x85, 0x00,
+    0x0B, 0x17, 0x2E, 0x8C, 0xEB, 0xD3, 0xBD, 0x66, 0xF3, 0x04, 0x83, 0x41, 0x9F, 0x7B, 0xEA, 0x75,
+    0xD4, 0xD5, 0xAA, 0xE1, 0x4C, 0xF5, 0x4C, 0xAA, 0xF4, 0x9E, 0xDD, 0xC0, 0x73, 0xF4, 0xF9, 0xF3,
+    0x3E, 0xB6, 0x35, 0x5F, 0x51, 0xFC, 0xAF, 0x1E, 0x05, 0xFE, 0xFB, 0x21, 0xBB, 0xE5, 0x4E, 0xA6,
+    0x3A, 0xA2, 0xC2, 0x2F, 0x02, 0x05, 0x7C, 0x4A, 0x25, 0xDB, 0xD3, 0x12, 0xA4, 0xD3, 0x02, 0x2D,
+    0x59, 0x6A, 0xBB, 0x83, 0x7D, 0x8C, 0x4B, 0x8E, 0x1C, 0x66, 0xF0, 0x49, 0x72, 0x54, 0x4D, 0xA7,
+    0xE0, 0xC2, 0x65, 0xA8, 0x59, 0x93, 0x86, 0x61, 0x3A, 0x4C, 0xFF, 0x5E, 0xA7, 0xCB, 0x69, 0x9C,
+    0x6D, 0xD8, 0x7C, 0x34, 0xA9, 0x96, 0x9A, 0x1B, 0x8E, 0xC1, 0x25, 0x61, 0x11, 0xD2, 0xC9, 0xA3,
+    0x3B, 0x33, 0x52, 0x93, 0x5E, 0x1C, 0x85, 0x82, 0xFF, 0x0C, 0x87, 0x99, 0xDB, 0x8E, 0xC2, 0x97,
+    0x15, 0x0E, 0x0B, 0x4C, 0x9A, 0xFE, 0xE3, 0x4C, 0xED, 0x9E, 0xFA, 0x3D, 0x03, 0x3E, 0x06, 0x61,
+    0x67, 0xF8, 0x77, 0x35, 0x0A, 0xFF, 0x97, 0x8F, 0x00, 0x0F, 0xFC, 0x80, 0x56, 0x80, 0x3E, 0x39,
+    0xDC, 0x69, 0x58, 0xC8, 0xA0, 0xFA, 0xE4, 0xF3, 0xD9, 0x2F, 0xFF, 0x13, 0xF8, 0xFD, 0x33, 0xC0,
+    0x69, 0xA6, 0xA4, 0xCA, 0x36, 0x6E, 0x1F, 0x49, 0x4B, 0xF5, 0xBC, 0xED, 0x8E, 0xC2, 0xD9, 0x4E,
+    0x60, 0x07, 0x85, 0x95, 0xB6, 0x21, 0xF1, 0xCE, 0xA9, 0xA8, 0x34, 0xFE, 0xDF, 0x0E, 0x47, 0x1A,
+    0x13, 0xE0, 0x2B, 0xC3, 0x15, 0x5B, 0x00, 0x69, 0x7F, 0xF3, 0x46, 0x0B, 0x7A, 0xC2, 0xFB, 0xD9,
+    0xFD, 0x08, 0x6C, 0x6B, 0x47, 0x73, 0x15, 0x36, 0xD3, 0x2F, 0x7A, 0xCB, 0xEF, 0xBF, 0x30, 0x01,
+    0x98, 0xC6, 0x68, 0x5F, 0xC1, 0x97, 0xDA, 0xEB, 0x7F, 0xFB, 0x4B, 0x9A, 0x7E, 0xA6, 0x5F, 0xB5,
+    0x48, 0x84, 0x98, 0x09, 0x5F, 0xE0, 0x0B, 0xBA, 0x58, 0x83, 0x1D, 0xDA, 0xDA, 0xEE, 0xE0, 0x33,
+    0x5A, 0x02, 0xA5, 0x89, 0x87, 0xA8, 0x9F, 0x05, 0x8C, 0x0D, 0x7A, 0xF4, 0xB6, 0xE3, 0x91, 0x70,
+    0xC1, 0x0E, 0x0A, 0x3D, 0xB4, 0x2D, 0xFE, 0x34, 0x18, 0xBE, 0xBD, 0x88, 0xEB, 0xBE, 0xF5, 0x4A,
+    0xAD, 0xC0, 0x15, 0x11, 0x80, 0x51, 0xBF, 0x73, 0xC0, 0x4D, 0x2D, 0x5A, 0xC1, 0xFD, 0x9F, 0x81,
+    0xF0, 0x7C, 0x7A, 0x9D, 0x61, 0x78, 0xD3, 0xC3, 0x67, 0xF8, 0xA9, 0x3C, 0x0C, 0xBA, 0x56, 0x2C,
+    0x07, 0x5E, 0x7F, 0x0B, 0xC8, 0xDE, 0xC6, 0xCA, 0x64, 0x6D, 0x3E, 0xC0, 0xDC, 0xFB, 0x2E, 0x0A,
+    0xBF, 0x21, 0xFD, 0xAC, 0xC6, 0xD9, 0xC4, 0x1C, 0x22, 0x01, 0xDF, 0xEB, 0x5A, 0x66, 0x01, 0xF9,
+    0xB4, 0x4E, 0x6B, 0x37, 0xD8, 0xF1, 0xC9, 0x39, 0xFE, 0xDD, 0xA6, 0x25, 0x50, 0x9F, 0x31, 0x81,
+    0x23, 0x8C, 0x24, 0xB5, 0x49, 0x90, 0x47, 0x3B, 0x13, 0x77, 0xB6, 0xEF, 0xF5, 0xFF, 0xEF, 0x20,
+    0x9C, 0x57, 0xE6, 0x0A, 0x68, 0x60, 0xCB, 0x8E, 0x91, 0x23, 0x87, 0x34, 0x36, 0xDC, 0x7F, 0x1D,
+    0x08, 0xDF, 0xC2, 0xEB, 0x59, 0x6C, 0xA6, 0x2A, 0xE1, 0x83, 0xA5, 0xFD, 0xAC, 0xB8, 0xD7, 0xFE,
+    0x6D, 0xA7, 0x7D, 0x01, 0xFE, 0xDD, 0xA9, 0x3D, 0x70, 0x23, 0x23, 0x7D, 0xA5, 0x5C, 0xE5, 0x42,
+    0xF8, 0x85, 0xE0, 0xBB, 0xA8, 0x0D, 0xE2, 0x36, 0x9A, 0xFE, 0xCE, 0x4C, 0x41, 0x05, 0x11, 0x76,
+    0xC2, 0x44, 0xDB, 0x45, 0x5C, 0x59, 0x2D, 0x5F, 0x04, 0x4B, 0xC1, 0x3C, 0x55, 0xE1, 0x5D, 0xDA,
+    0x17, 0xEE, 0xF1, 0xC3, 0xC6, 0x8C, 0x79, 0xBC, 0xB1, 0xB5, 0xBF, 0x8C, 0x28, 0xF3, 0xAB, 0x69,
+    0xF4, 0x2E, 0x3C, 0x1F, 0xB5, 0x35, 0xFD, 0xFB, 0x06, 0xC1, 0x7F, 0xB4, 0x15, 0x99, 0x19, 0xD6,
+    0x91, 0x3C, 0x3E, 0x6A, 0xD5, 0x87, 0xF3, 0x80, 0xCD, 0x9B, 0xEC, 0xA0, 0x2F, 0x81, 0xFE, 0xF4,
+    0x76, 0x46, 0xFC, 0xBD, 0x18, 0x60, 0x59, 0x66, 0xF5, 0x8A, 0x0C, 0x5F, 0xF8, 0xE1, 0x24, 0x09,
+    0xBA, 0x32, 0x28, 0xBC, 0xF7, 0x7E, 0xBB, 0x81, 0x48, 0x7D, 0x0B, 0x1B, 0x68, 0x0D, 0x54, 0x06,
+    0x6F, 0x58, 0x42, 0xED, 0x6F, 0xC0, 0x18, 0x8B, 0x16, 0xE0, 0x44, 0x06, 0xBC, 0x9B, 0x06, 0xC3,
+    0xBB, 0x3C, 0x4B, 0x73, 0x27, 0x82, 0x87, 0x4A, 0x8D, 0x2B, 0x20, 0xC0, 0x13, 0x2D, 0x50, 0x30,
+    0xB5, 0x0B, 0xBC, 0x2B, 0x1A, 0x1A, 0x86, 0x3F, 0x39, 0x9C, 0xC2, 0x57, 0x71, 0xA4, 0xFD, 0x53,
+    0x66, 0x02, 0x3B, 0x19, 0xFD, 0x93, 0x5C, 0x18, 0x4C, 0xCD, 0xEF, 0x99, 0xC5, 0x00, 0x50, 0x41,
+    0x5F, 0x18, 0x03, 0xAB, 0xB0, 0x81, 0x84, 0x4C, 0xA2, 0xA0, 0xFB, 0xF5, 0xB2, 0x7B, 0x0F, 0xD5,
+    0x6F, 0x70, 0x90, 0xA9, 0xE1, 0xDB, 0x0C, 0x5C, 0xF3, 0xD5, 0xB3, 0x1F, 0xC6, 0xFA, 0x11, 0x0C,
+    0x04, 0x12, 0xE0, 0x5F, 0xD3, 0x00, 0x05, 0xAF, 0xF7, 0x64, 0xE4, 0xD1, 0x3C, 0xB8, 0xBB, 0xD4,
+    0x28, 0x13, 0x01, 0x2C, 0xED, 0x2F, 0x98, 0xDC, 0x1E, 0x81, 0x83, 0x4C, 0xF9, 0x72, 0xAB, 0x07,
+    0x77, 0x87, 0x0D, 0x9A, 0xC9, 0xB7, 0x86, 0xBE, 0x7F, 0x17, 0x85, 0xAF, 0xA8, 0x5F, 0xBD, 0x71,
+    0xD7, 0xDF, 0x04, 0xB4, 0x64, 0xAE, 0xFF, 0xAD, 0x49, 0xBD, 0xE5, 0x09, 0x7C, 0xB7, 0x06, 0x75,
+    0x80, 0x41, 0xC3, 0x68, 0x11, 0x48, 0x06, 0x05, 0x84, 0xD9, 0x5B, 0x18, 0x17, 0xAC, 0x62, 0x99,
+    0xC2, 0xE9, 0x06, 0x04, 0x11, 0xCA, 0x3C, 0x93, 0x06, 0x6F, 0x76, 0x0F, 0x33, 0x7F, 0x76, 0xD7,
+    0xB2, 0x5A, 0x81, 0x32, 0x12, 0xE0, 0x89, 0xE6, 0xF0, 0xBC, 0xDF, 0x09, 0xBE, 0xEC, 0xFA, 0x7C,
+    0x6A, 0xF8, 0x1A, 0x7C, 0x82, 0x60, 0xBD, 0x61, 0xC6, 0x7B, 0xB6, 0x06, 0x49, 0x93, 0x6E, 0x60,
+    0x34, 0xDD, 0x36, 0x13, 0x48, 0x61, 0xEE, 0x5D, 0xDE, 0x4C, 0xFF, 0xC5, 0xD0, 0x58, 0x81, 0x8E,
+    0xCC, 0x0A, 0x6E, 0xEC, 0x43, 0x12, 0xF0, 0xDD, 0x35, 0x20, 0x65, 0xD6, 0x5C, 0x96, 0x49, 0x75,
+    0x14, 0xE6, 0x7A, 0xB2, 0xDC, 0x6E, 0x60, 0x5B, 0x3D, 0xB8, 0x67, 0x76, 0xD7, 0xF4, 0xB9, 0xE0,
+    0xEE, 0x52, 0xA1, 0xD4, 0x04, 0xB0, 0xB5, 0xFF, 0xFD, 0x2C, 0x04, 0x72, 0x34, 0xDF, 0x3E, 0xEC,
+    0xDA, 0x2F, 0x1E, 0xFB, 0xCE, 0xD1, 0x7F, 0xD2, 0xF7, 0x9F, 0x38, 0x61, 0x6B, 0xD2, 0xF0, 0xA1,
+    0x40, 0x6B, 0x69, 0x7F, 0x18, 0xA3, 0xE9, 0x88, 0x81, 0xEF, 0xD8, 0xA4, 0x1E, 0xF0, 0xBD, 0xD1,
+    0xB4, 0x5C, 0x0C, 0x56, 0x34, 0xF2, 0x68, 0xDD, 0x7A, 0x1A, 0x07, 0x7E, 0x86, 0x9B, 0x00, 0xD6,
+    0xFD, 0x02, 0xE7, 0xD3, 0xE0, 0xDF, 0xD2, 0x0D, 0x05, 0x9F, 0x94, 0xC9, 0x0A, 0x94, 0x81, 0x00,
+    0x4F, 0x34, 0x85, 0x77, 0x72, 0x67, 0xF8, 0xF6, 0x48, 0xFB, 0x13, 0xC3, 0x5D, 0x28, 0x99, 0xFF,
+    0x8D, 0x1B, 0x81, 0xBC, 0xAF, 0x58, 0x97, 0xAC, 0xCC, 0x9A, 0xA4, 0x58, 0x03, 0x0A, 0x5F, 0xFD,
+    0xF0, 0xE5, 0xD2, 0xF7, 0x5F, 0x0C, 0x5A, 0x28, 0xF5, 0x19, 0x64, 0xB4, 0xB0, 0x33, 0x03, 0x8D,
+    0x3E, 0xD2, 0x98, 0x82, 0x8D, 0x5A, 0xAA, 0x20, 0xCC, 0x75, 0x25, 0x58, 0x8D, 0x6E, 0x81, 0x3D,
+    0xF5, 0xE0, 0x9D, 0x5A, 0x26, 0x2B, 0x50, 0x2A, 0x02, 0x58, 0x0C, 0xF3, 0x66, 0x67, 0xC1, 0x97,
+    0xD3, 0x9D, 0xC5, 0x4A, 0x0F, 0xEE, 0x0E, 0x1F, 0x58, 0x41, 0xAA, 0xA4, 0xCF, 0x57, 0x02, 0x5F,
+    0x51, 0xFB, 0x59, 0x38, 0x74, 0x6A, 0x67, 0x93, 0xE0, 0xAA, 0x02, 0x85, 0xAE, 0xD6, 0xCA, 0x2C,
+    0xA6, 0x84, 0x72, 0x03, 0x1A, 0x50, 0xB2, 0x70, 0x29, 0xDD, 0x80, 0xDC, 0x57, 0xB8, 0x49, 0xA0,
+    0xFB, 0x05, 0xCE, 0xA6, 0xC2, 0xB7, 0xB3, 0x9B, 0xE1, 0xDD, 0xDA, 0xD3, 0xB2, 0xD0, 0xA5, 0x40,
+    0xA9, 0x4E, 0xB6, 0x56, 0xE2, 0x70, 0x4F, 0x6C, 0x00, 0x33, 0xB7, 0x2E, 0x9F, 0x1B, 0x76, 0xED,
+    0x17, 0x94, 0xDE, 0x6B, 0x44, 0x8E, 0x86, 0x64, 0xC9, 0xFF, 0xAB, 0x12, 0x6B, 0xAB, 0xC5, 0xEF,
+    0x6A, 0xD0, 0xFE, 0x42, 0xF0, 0x5D, 0x6B, 0x30, 0x5B, 0xE9, 0xDA, 0xD1, 0x76, 0x61, 0x6A, 0x22,
+    0x5E, 0x43, 0xAB, 0xE6, 0x89, 0x50, 0x19, 0x6C, 0x2B, 0x70, 0xB0, 0xAE, 0xE9, 0x79, 0x53, 0x6D,
+    0x02, 0x91, 0x21, 0x80, 0xB4, 0x9F, 0xE6, 0x3F, 0x03, 0x9E, 0x35, 0x75, 0xE1, 0x3F, 0x64, 0x4D,
+    0xE2, 0x88, 0x04, 0x64, 0x32, 0x73, 0x0E, 0xDB, 0x9D, 0x2B, 0x4A, 0xFF, 0x32, 0x9A, 0x01, 0xE9,
+    0xE5, 0x35, 0xF5, 0xBB, 0x1C, 0xF8, 0xAE, 0x95, 0x93, 0x81, 0xE6, 0xAD, 0x58, 0xC1, 0xC1, 0x6C,
+    0x40, 0xCD, 0xC3, 0x3E, 0x95, 0x21, 0x02, 0x4A, 0x63, 0x21, 0x70, 0x34, 0x1E, 0x9E, 0x15, 0x0D,
+    0xC7, 0x8C, 0x79, 0xA4, 0x41, 0x70, 0x4F, 0x48, 0x08, 0x99, 0x00, 0x5A, 0x7C, 0x89, 0xC1, 0x5F,
+    0x37, 0x16, 0x83, 0x31, 0x6E, 0x81, 0xE2, 0xF1, 0xB0, 0x43, 0x16, 0xD2, 0xCB, 0xB4, 0xCF, 0xE3,
+    0xB6, 0x89, 0x20, 0x24, 0xA7, 0xD9, 0x0D, 0x2B, 0xE5, 0x3D, 0xFA, 0xBF, 0x18, 0x1A, 0x36, 0x56,
+    0x99, 0x96, 0x4B, 0x24, 0x56, 0x59, 0x34, 0xAA, 0xC8, 0xA7, 0xD5, 0x6A, 0x82, 0xC7, 0xC3, 0x0F,
+    0x4F, 0xB2, 0x61, 0x1E, 0x6F, 0x05, 0xEF, 0xA2, 0x6E, 0xA5, 0x71, 0x03, 0x21, 0x9F, 0x68, 0xAD,
+    0xBC, 0xE5, 0x7E, 0xBD, 0x29, 0x23, 0xFF, 0x46, 0x2C, 0x54, 0x52, 0x24, 0x98, 0x2C, 0x05, 0x39,
+    0x95, 0xCB, 0x8A, 0x52, 0x1E, 0x48, 0x28, 0xF0, 0x8B, 0x93, 0xF0, 0x4B, 0x65, 0xD4, 0x2E, 0x42,
+    0x1C, 0x37, 0xF5, 0xCA, 0x69, 0x39, 0x89, 0xA2, 0x9B, 0x28, 0xAC, 0x7B, 0xEB, 0xB8, 0x3E, 0xF5,
+    0xBD, 0xF0, 0x98, 0xCE, 0xD7, 0xFE, 0x2B, 0x01, 0xEB, 0xC7, 0xC5, 0xFB, 0x68, 0x14, 0xB2, 0xE0,
+    0xF3, 0xDA, 0x65, 0x2B, 0x6E, 0x48, 0x7A, 0x99, 0xC1, 0x67, 0x51, 0x26, 0x09, 0xA6, 0x79, 0xFC,
+    0x5A, 0x9C, 0x9F, 0xA4, 0x46, 0xA1, 0x90, 0x6B, 0x2C, 0x24, 0x31, 0xCA, 0xFC, 0x17, 0x14, 0xEC,
+    0x6B, 0x90, 0x70, 0xAE, 0xFF, 0x93, 0xF0, 0xEF, 0x1B, 0x61, 0x18, 0x9E, 0xB0, 0x76, 0xFA, 0x14,
+    0xC2, 0xCA, 0x00, 0x36, 0x00, 0xF7, 0x3C, 0x44, 0xC2, 0x6D, 0xA7, 0xF9, 0xA7, 0x47, 0x7B, 0x65,
+    0x22, 0xD0, 0xAF, 0x33, 0x0F, 0x06, 0x49, 0x11, 0x32, 0x28, 0x40, 0x2F, 0x19, 0x75, 0xE8, 0x10,
+    0xD3, 0xB0, 0xAD, 0xC0, 0xC1, 0xA0, 0x5B, 0xB1, 0x0E, 0x51, 0x3B, 0x35, 0x70, 0xB4, 0x15, 0x63,
+    0xE6, 0xFA, 0xB5, 0xED, 0x79, 0x04, 0x5F, 0x32, 0x52, 0x3F, 0x9B, 0x6F, 0x1F, 0xAB, 0x9A, 0x0A,
+    0x34, 0x66, 0x2A, 0x57, 0x8F, 0x5B, 0x82, 0xDA, 0x9D, 0xD5, 0xF8, 0x54, 0x5A, 0xC1, 0xF1, 0xBA,
+    0x95, 0xDB, 0x80, 0x7B, 0xEF, 0x06, 0xB6, 0xEF, 0x02, 0x1A, 0xD1, 0x30, 0xBF, 0xFD, 0x77, 0x7B,
+    0x34, 0x91, 0xD5, 0x94, 0x1D, 0x6E, 0xE8, 0xFD, 0x4C, 0xE7, 0x29, 0x33, 0xAE, 0xCD, 0xCC, 0x82,
+    0xA4, 0xE9, 0x63, 0x92, 0x92, 0x1A, 0x1F, 0x0C, 0x65, 0x55, 0x12, 0x16, 0xB7, 0x64, 0x64, 0x66,
+    0x66, 0x3A, 0xDB, 0xB6, 0xF4, 0xDD, 0x0A, 0xF7, 0x07, 0x83, 0x60, 0x1E, 0xA9, 0x6F, 0x35, 0x40,
+    0x44, 0x80, 0x00, 0x1A, 0x8D, 0xAB, 0xC6, 0x9F, 0xD9, 0xF3, 0x98, 0x05, 0xE4, 0xD9, 0x42, 0x1A,
+    0x3C, 0xD8, 0x6E, 0x5D, 0x0B, 0xB9, 0x0D, 0x40, 0xEF, 0x45, 0xE1, 0xEF, 0x3E, 0x08, 0xCC, 0x9C,
+    0x0F, 0xCC, 0x99, 0xC3, 0x8A, 0x9F, 0x0C, 0x4C, 0x9B, 0x0E, 0x7C, 0xF0, 0x01, 0xB0, 0x60, 0x81,
+    0xBD, 0x2D, 0x5B, 0x06, 0x6C, 0x25, 0x31, 0xB6, 0x52, 0x48, 0xEF, 0x71, 0xFF, 0x6C, 0x9E, 0x37,
+    0x9F, 0xE7, 0x2F, 0x5A, 0xC4, 0x63, 0xCB, 0x81, 0x4D, 0x9B, 0x49, 0x42, 0x0A, 0x4E, 0xAD, 0x90,
+    0x55, 0x99, 0x85, 0x58, 0x44, 0x28, 0x0D, 0x09, 0x58, 0xB3, 0x87, 0x99, 0xCA, 0x6A, 0x30, 0xE9,
+    0x31, 0x92, 0xAB, 0x0A, 0xE3, 0x98, 0x41, 0x37, 0x91, 0x54, 0x1A, 0x32, 0x16, 0x3C, 0x25, 0xDC,
+    0xD0, 0x1C, 0x33, 0xE6, 0x1F, 0xFE, 0xB8, 0xA4, 0xEB, 0x8F, 0x8C, 0x7B, 0xFA, 0x9F, 0x5B, 0x16,
+    0x2F, 0x5E, 0x5C, 0x62, 0xE4, 0x14, 0x92, 0xA9, 0xB0, 0xCC, 0xBF, 0x67, 0x5E, 0x73, 0x18, 0x05,
+    0x11, 0x33, 0xFF, 0x85, 0xB0, 0x6E, 0xCD, 0x7F, 0x54, 0xD7, 0x1A, 0x79, 0x5B, 0x2A, 0x93, 0xC9,
+    0xEB, 0x34, 0xBC, 0x7B, 0x1B, 0x05, 0xF7, 0xAF, 0x7F, 0x03, 0x7F, 0xFC, 0x23, 0x30, 0xE1, 0x55,
+    0x5A, 0x80, 0x4D, 0x76, 0x83, 0x4C, 0x21, 0x74, 0xDF, 0x9C, 0x23, 0xC0, 0xFB, 0x1F, 0x03, 0x2F,
+    0x50, 0x2B, 0x35, 0xB8, 0x74, 0x2D, 0xA3, 0xF4, 0xDD, 0xFB, 0x80, 0x1D, 0xBB, 0x81, 0x15, 0x6B,
+    0x48, 0x9A, 0xA9, 0xF6, 0x20, 0x8F, 0xDF, 0x8D, 0x03, 0xDE, 0x9A, 0x02, 0x1C, 0xD1, 0x92, 0x91,
+    0x65, 0x90, 0x9C, 0xA9, 0x32, 0x04, 0xFF, 0x8E, 0x64, 0xBD, 0xE9, 0xDE, 0x94, 0x4D, 0x3C, 0x8C,
+    0xD3, 0x0D, 0x29, 0xAB, 0xB6, 0x99, 0x99, 0xA1, 0xC9, 0x36, 0x74, 0xEF, 0xEA, 0xFD, 0xA0, 0x12,
+    0x02, 0xC7, 0x23, 0x16, 0xFD, 0x0B, 0x7A, 0x99, 0x44, 0x3E, 0x41, 0xB3, 0x71, 0x04, 0x0D, 0xF7,
+    0x56, 0x63, 0x50, 0xC8, 0xA0, 0x80, 0x76, 0x51, 0x88, 0xAF, 0xBF, 0x01, 0xFC, 0xE9, 0x2F, 0xC0,
+    0xDE, 0x03, 0x36, 0x81, 0x34, 0x0B, 0x48, 0xE3, 0x07, 0xD4, 0x9C, 0xAC, 0xBE, 0xFB, 0xCB, 0x41,
+    0x69, 0x67, 0x55, 0x06, 0x9D, 0x1A, 0xD5, 0x23, 0xE8, 0xDA, 0x85, 0x4B, 0x80, 0xA7, 0x49, 0xA4,
+    0x97, 0x49, 0xA4, 0x1C, 0xE6, 0xF3, 0xA5, 0xA8, 0x31, 0x6B, 0x56, 0x52, 0xA1, 0xDB, 0x51, 0x7B,
+    0x80, 0xCA, 0x16, 0x49, 0x0E, 0x58, 0x08, 0xE4, 0xB9, 0xE0, 0x9D, 0x97, 0x7A, 0xF8, 0x70, 0x5E,
+    0x48, 0x8F, 0x2A, 0xB1, 0x38, 0xF2, 0xFF, 0x0F, 0xDF, 0x7F, 0x53, 0x4D, 0xF8, 0x0E, 0x24, 0xC3,
+    0x3C, 0x1D, 0xD1, 0xF7, 0x97, 0xE0, 0xAB, 0x57, 0xA3, 0x00, 0x18, 0x94, 0xA9, 0xF2, 0xF3, 0x58,
+    0xE1, 0x4A, 0xA1, 0x42, 0x02, 0x85, 0x2F, 0xB3, 0xFF, 0x26, 0xB5, 0xF5, 0x7F, 0xFE, 0x61, 0x13,
+    0x47, 0x95, 0x9E, 0xD1, 0x08, 0xF8, 0xDE, 0x28, 0xE0, 0xFE, 0x7B, 0x81, 0xD1, 0x43, 0x19, 0x94,
+    0x29, 0xC8, 0x0B, 0x42, 0x02, 0x2F, 0x8A, 0x04, 0x3E, 0x77, 0x70, 0x7F, 0xE0, 0xCE, 0x3B, 0x80,
+    0x5E, 0xDD, 0xED, 0xD1, 0x47, 0x82, 0xDA, 0xF3, 0xFF, 0xF6, 0x12, 0xF0, 0x06, 0xAD, 0xCA, 0x09,
+    0x66, 0x28, 0xA1, 0x92, 0x40, 0x33, 0x94, 0xE4, 0xCA, 0x54, 0x16, 0xB9, 0x12, 0x95, 0xAD, 0x90,
+    0xDC, 0x91, 0x82, 0x61, 0x9E, 0x73, 0x50, 0x56, 0x95, 0x86, 0x0F, 0x1F, 0x5E, 0x23, 0xB8, 0xAB,
+    0x58, 0x94, 0x58, 0x14, 0x2D, 0xB2, 0x5C, 0xBD, 0x6E, 0x6A, 0x4F, 0x38, 0xEA, 0x36, 0x25, 0x7D,
+    0x23, 0xBA, 0x7A, 0x87, 0x42, 0x96, 0xCA, 0xE9, 0x76, 0x65, 0x09, 0x1A, 0x07, 0xE0, 0x65, 0x60,
+    0x56, 0xA2, 0xEF, 0xE5, 0x3B, 0x29, 0xE0, 0xFB, 0x62, 0x25, 0x09, 0xF0, 0xB6, 0xAD, 0x79, 0x12,
+    0xEE, 0xB5, 0x0C, 0xBC, 0x34, 0x85, 0xEB, 0xE5, 0x17, 0x48, 0x02, 0x7E, 0xEE, 0x25, 0x41, 0x34,
+    0x54, 0x4B, 0xA8, 0xCC, 0x0C, 0xE3, 0x16, 0xFA, 0xE4, 0xDE, 0x3D, 0x28, 0xF8, 0xA0, 0x5D, 0x93,
+    0x6B, 0xB8, 0x86, 0xF1, 0xC6, 0x33, 0x7F, 0x00, 0xFE, 0x4C, 0xAD, 0xD7, 0x88, 0x63, 0xCD, 0x03,
+    0x10, 0xD4, 0x9A, 0xF7, 0x2E, 0xC9, 0xB5, 0x8E, 0x41, 0x6A, 0x28, 0x51, 0x9C, 0x4C, 0xBF, 0x8F,
+    0xDA, 0xAF, 0x32, 0x88, 0x00, 0x4E, 0x96, 0x29, 0x95, 0x65, 0x0B, 0x91, 0x3B, 0x65, 0x03, 0xEB,
+    0xC1, 0xB4, 0xDC, 0x40, 0x5A, 0xE3, 0xBA, 0x35, 0x53, 0x7B, 0x69, 0x15, 0x96, 0xE0, 0x91, 0xCB,
+    0xA2, 0xC4, 0xF7, 0x91, 0x2F, 0x31, 0xDD, 0x4B, 0x3B, 0xF0, 0xD6, 0x2D, 0x29, 0x88, 0x22, 0xFA,
+    0x13, 0x19, 0x18, 0x4C, 0xC7, 0x92, 0xA8, 0x79, 0xF4, 0x67, 0x56, 0xC5, 0x9D, 0xA4, 0xF6, 0x79,
+    0x65, 0x05, 0x8A, 0x23, 0x1E, 0xB5, 0xFF, 0x20, 0x23, 0xF9, 0x75, 0xAB, 0x18, 0xF5, 0x33, 0xDA,
+    0x17, 0xEA, 0xD7, 0x65, 0x36, 0x41, 0x01, 0x3E, 0xFA, 0x08, 0x0B, 0xC9, 0x6A, 0xD8, 0xCD, 0xB8,
+    0x60, 0xFA, 0x7B, 0x36, 0x01, 0x92, 0x98, 0x9E, 0x5D, 0x47, 0x0D, 0x7F, 0xF5, 0x65, 0xE0, 0x35,
+    0x6E, 0x1A, 0xC8, 0xA1, 0xE8, 0x5F, 0xD6, 0xE6, 0xEF, 0xAF, 0x03, 0x5B, 0xB2, 0x81, 0xAC, 0x2E,
+    0xC0, 0xF8, 0x67, 0x81, 0x1F, 0xDD, 0xC3, 0x00, 0x4E, 0xFD, 0x10, 0xC4, 0x06, 0xEE, 0x5F, 0xC4,
+    0x00, 0x52, 0x9D, 0x54, 0xC5, 0xD6, 0x1C, 0xDF, 0x55, 0x03, 0x42, 0x4E, 0x33, 0xF8, 0xB3, 0x84,
+    0xCF, 0x73, 0x93, 0x58, 0x73, 0x86, 0xB6, 0xE0, 0x29, 0x91, 0x02, 0xEF, 0xCF, 0x1A, 0xF4, 0x36,
+    0x83, 0x6F, 0x75, 0x56, 0x5A, 0xDA, 0xD9, 0xA0, 0x2A, 0x5D, 0x1E, 0x25, 0x12, 0xC0, 0xF2, 0x25,
+    0xBE, 0xD5, 0x69, 0x30, 0xCF, 0x24, 0x51, 0x28, 0x91, 0x7E, 0x7F, 0xAB, 0xB2, 0x94, 0x32, 0x49,
+    0x48, 0xAA, 0xBC, 0x4D, 0x5B, 0x80, 0xE3, 0x0A, 0xC0, 0x8A, 0x7B, 0x53, 0x16, 0x73, 0x33, 0x05,
+    0xBC, 0xF0, 0x73, 0xFB, 0x1A, 0x99, 0xF2, 0xEE, 0x14, 0xE0, 0xAF, 0x1F, 0x06, 0x52, 0x28, 0x58,
+    0x69, 0xEF, 0xB2, 0xCF, 0xEC, 0xC6, 0x18, 0x1D, 0xAF, 0x46, 0x53, 0xFC, 0xF0, 0x83, 0xB6, 0xBF,
+    0xAF, 0x4F, 0x17, 0xF1, 0xE3, 0x07, 0x80, 0x1A, 0xC1, 0xFE, 0x06, 0xC5, 0x1D, 0x5B, 0xD6, 0x33,
+    0x68, 0x64, 0x04, 0x9F, 0xC8, 0xAA, 0x7C, 0xF8, 0xA7, 0x40, 0x9F, 0x5E, 0x7C, 0x3C, 0x9F, 0xAF,
+    0x6B, 0x35, 0x27, 0x61, 0x65, 0x49, 0x56, 0x80, 0xE7, 0xE6, 0x9D, 0xB1, 0xE7, 0x13, 0xCA, 0xAA,
+    0x24, 0x53, 0xF0, 0x2A, 0x93, 0x9A, 0x85, 0x23, 0x5F, 0x83, 0x84, 0x99, 0x1F, 0x0F, 0xFF, 0xEA,
+    0x74, 0xB7, 0x3B, 0xA7, 0x44, 0xF9, 0x96, 0x78, 0x82, 0x85, 0x00, 0x6B, 0xC4, 0xFC, 0x7A, 0xE5,
+    0xF4, 0x88, 0x42, 0x94, 0xCD, 0x6A, 0x47, 0xAD, 0x63, 0x2E, 0xAE, 0xCA, 0x5B, 0xBE, 0xDA, 0x4E,
+    0xA7, 0x4A, 0x7A, 0xD3, 0xC3, 0xD4, 0x36, 0xE5, 0xDB, 0x42, 0xAD, 0x9A, 0x40, 0xFB, 0xF6, 0x94,
+    0x11, 0x35, 0x57, 0xF5, 0x7D, 0x8A, 0x6E, 0x44, 0x91, 0xBD, 0x26, 0x7C, 0xCA, 0xBD, 0x68, 0x42,
+    0x49, 0x5B, 0x6A, 0x7D, 0x22, 0x05, 0x9A, 0xC8, 0x58, 0xE1, 0xA6, 0x5B, 0x99, 0x72, 0x5E, 0xC3,
+    0x73, 0x79, 0xB2, 0x62, 0x87, 0xD5, 0x2C, 0xEE, 0x57, 0x14, 0xA0, 0xC1, 0xBF, 0x35, 0xC9, 0xA3,
+    0x73, 0xD6, 0x37, 0xAE, 0x40, 0x53, 0xD0, 0x77, 0xED, 0xE7, 0x1F, 0x12, 0xE6, 0xE5, 0xC0, 0x77,
+    0x3D, 0x4A, 0xD2, 0x2D, 0xA1, 0x45, 0xD2, 0x58, 0x46, 0x4D, 0x5D, 0xEB, 0x4A, 0x1B, 0x1A, 0xAF,
+    0x97, 0xE1, 0x33, 0x23, 0x8F, 0x33, 0x7C, 0xF7, 0x75, 0x21, 0x51, 0x2D, 0x34, 0x02, 0x78, 0x59,
+    0x6A, 0x93, 0xCE, 0x2C, 0xD2, 0x60, 0xE5, 0x68, 0x82, 0x87, 0x66, 0xDD, 0x48, 0x3B, 0xA5, 0x71,
+    0x6B, 0xA8, 0x6D, 0x07, 0xE8, 0xBB, 0xC9, 0x85, 0xCB, 0x83, 0xE7, 0x05, 0x18, 0x70, 0x29, 0xE8,
+    0x12, 0xD4, 0x13, 0xD7, 0xB6, 0x05, 0x0B, 0x17, 0xBC, 0x48, 0xA6, 0xFD, 0x00, 0x5D, 0x84, 0xA5,
+    0x8D, 0xD4, 0xEA, 0xF6, 0x6D, 0x82, 0x11, 0x79, 0x50, 0x20, 0xCA, 0x0C, 0xEA, 0xD4, 0xB6, 0x9B,
+    0x9C, 0xB5, 0x88, 0xC4, 0x97, 0x4C, 0x11, 0xCF, 0x05, 0x63, 0x05, 0x4D, 0xEE, 0xE8, 0x4C, 0x42,
+    0xCA, 0xA5, 0x08, 0xF2, 0xE9, 0x9A, 0x82, 0x5E, 0x9C, 0x20, 0xB5, 0x42, 0x89, 0x86, 0xB0, 0x2F,
+    0xD3, 0x48, 0x20, 0x12, 0x40, 0x6D, 0x00, 0xBD, 0x18, 0x6B, 0xC4, 0xEB, 0x9A, 0x62, 0xAE, 0x0B,
+    0x1B, 0x4C, 0xBE, 0xBC, 0x77, 0x1B, 0xFF, 0xA0, 0xFF, 0x2C, 0x01, 0x25, 0x12, 0xA0, 0x7F, 0xFF,
+    0x6E, 0x95, 0x61, 0xFA, 0x59, 0x45, 0x91, 0xE8, 0xCD, 0xFE, 0x36, 0x34, 0xF5, 0x2A, 0xA3, 0x95,
+    0xAD, 0x91, 0x32, 0x99, 0xF2, 0xA5, 0xDB, 0x48, 0x02, 0xF5, 0x0E, 0x5E, 0xF6, 0x6D, 0x25, 0x68,
+    0x6E, 0x22, 0x8C, 0xA0, 0xEB, 0x2A, 0x57, 0xA2, 0xF0, 0x82, 0xDF, 0xF5, 0x21, 0xED, 0xD7, 0x71,
+    0x09, 0x5D, 0xEE, 0xC5, 0x8A, 0xC6, 0x83, 0xC7, 0x05, 0x09, 0x5F, 0xEE, 0x47, 0x90, 0x15, 0x10,
+    0x59, 0x04, 0xDD, 0x43, 0x9D, 0x51, 0x0A, 0x1A, 0x0B, 0x61, 0x8A, 0x68, 0xEA, 0xB6, 0xBC, 0x14,
+    0x78, 0x0F, 0xB9, 0x9C, 0xDD, 0x8C, 0x17, 0x34, 0x6F, 0x50, 0x16, 0xA7, 0x06, 0x2D, 0x52, 0x53,
+    0xA6, 0xA0, 0xD6, 0xC4, 0xD1, 0x68, 0xC0, 0x0C, 0x18, 0xA6, 0x19, 0x88, 0x6F, 0xDF, 0xBE, 0x4F,
+    0xB0, 0x21, 0xFA, 0xF2, 0x28, 0x96, 0x00, 0x63, 0xC6, 0x8C, 0x89, 0x6B, 0xD6, 0xE4, 0xFA, 0x6E,
+    0x30, 0xEA, 0x36, 0xA0, 0x2D, 0x8D, 0x8B, 0x8A, 0xFF, 0x62, 0xC5, 0xAB, 0xD5, 0xAD, 0x6F, 0x4F,
+    0xA6, 0x4D, 0x9A, 0x02, 0xC1, 0xEF, 0x33, 0xDF, 0xA7, 0x5F, 0xDE, 0xCD, 0x63, 0x97, 0x0B, 0x69,
+    0x64, 0x8E, 0x79, 0x8D, 0xA5, 0xD1, 0x84, 0xE6, 0xEA, 0x1D, 0x57, 0xFA, 0x15, 0x2C, 0x5D, 0x3C,
+    0xAF, 0xD3, 0x0A, 0x21, 0x3A, 0x2E, 0xA1, 0x28, 0x60, 0xB4, 0x08, 0xC1, 0xEB, 0x24, 0xE7, 0xFC,
+    0x73, 0xD4, 0x15, 0x2A, 0x8B, 0x2C, 0x88, 0xCE, 0x51, 0xD0, 0xA7, 0x09, 0x1F, 0x82, 0xC6, 0xD8,
+    0x68, 0x5C, 0xA2, 0x15, 0x88, 0x16, 0x42, 0xC7, 0x82, 0xC7, 0xBF, 0x05, 0xEE, 0xDF, 0xC5, 0xFB,
+    0xBF, 0x3B, 0xCB, 0xCE, 0x46, 0x54, 0x86, 0xEB, 0xBA, 0xDA, 0x65, 0x8A, 0x46, 0xF5, 0x59, 0x0F,
+    0xD1, 0xA8, 0x61, 0x47, 0x8D, 0x7A, 0xAD, 0x5B, 0xDE, 0xD0, 0x4D, 0x13, 0x77, 0xEC, 0x03, 0x97,
+    0x46, 0xB1, 0x04, 0xD0, 0x6F, 0xEC, 0x30, 0x9C, 0xC9, 0x82, 0x23, 0x39, 0x93, 0xDA, 0x12, 0xF1,
+    0x0C, 0xA0, 0x10, 0x9A, 0xD6, 0x3D, 0x62, 0x30, 0xD0, 0xF0, 0x5A, 0x0A, 0x80, 0x1A, 0xA8, 0x96,
+    0xBC, 0xF5, 0x8C, 0x05, 0xAC, 0x36, 0x81, 0x4B, 0xBD, 0x31, 0x0B, 0x9D, 0x48, 0xAD, 0x96, 0x59,
+    0x17, 0x24, 0xFC, 0xAD, 0x24, 0x8C, 0x45, 0x00, 0x5E, 0xAF, 0xAE, 0xD9, 0xCC, 0xE6, 0x94, 0x0D,
+    0x85, 0xA3, 0x2C, 0x40, 0x43, 0xB4, 0x56, 0x2F, 0x01, 0xB2, 0xE9, 0xCB, 0x37, 0xED, 0x03, 0x3E,
+    0xFF, 0x94, 0xB9, 0x3E, 0xCD, 0xBE, 0x04, 0xA6, 0x73, 0x34, 0xD5, 0x3C, 0x55, 0x9D, 0x43, 0x62,
+    0x07, 0xEF, 0xB1, 0xF7, 0x10, 0xB5, 0xFA, 0x94, 0xEE, 0xCC, 0x77, 0xA3, 0x20, 0x35, 0xD4, 0xEB,
+    0x92, 0xEF, 0xC1, 0x7D, 0x72, 0x11, 0x3B, 0x19, 0xFC, 0xAD, 0x58, 0xCB, 0xCB, 0xF9, 0x6C, 0xA5,
+    0x95, 0xC3, 0x07, 0x91, 0x00, 0xBA, 0x57, 0x11, 0x8B, 0x13, 0x51, 0x98, 0xEA, 0xCE, 0x8A, 0x6F,
+    0x69, 0x04, 0x4E, 0x77, 0xDF, 0xB7, 0x6F, 0x5F, 0xD9, 0x09, 0x60, 0xFD, 0xC0, 0x92, 0x3F, 0xB7,
+    0x06, 0xED, 0x49, 0x89, 0xBF, 0xB4, 0x11, 0x4E, 0xC8, 0x77, 0x37, 0x68, 0x06, 0xB4, 0x6E, 0x6D,
+    0xFB, 0x6C, 0xF5, 0xA4, 0x4D, 0x7E, 0x97, 0x82, 0x53, 0x28, 0x72, 0xA9, 0xE2, 0xB0, 0x62, 0xEB,
+    0xB1, 0xA2, 0xD5, 0x79, 0x24, 0x1C, 0xA3, 0xFF, 0x5D, 0xC9, 0xA0, 0x4F, 0x84, 0x51, 0x3E, 0x5E,
+    0x83, 0x86, 0x70, 0xC0, 0xCD, 0x24, 0x42, 0xB0, 0x61, 0x47, 0x4B, 0xC1, 0x7C, 0xFF, 0xC7, 0xC0,
+    0xCD, 0x0C, 0xFE, 0xB4, 0xFD, 0xF4, 0x51, 0x60, 0x3F, 0xE3, 0x0C, 0x69, 0xBF, 0x2C, 0x45, 0xBF,
+    0xDE, 0x0C, 0x24, 0x83, 0x31, 0x88, 0xDC, 0x81, 0x96, 0x8B, 0x51, 0xD3, 0xB1, 0xD0, 0x80, 0x41,
+    0xE1, 0xE5, 0x46, 0x28, 0x05, 0x48, 0x9E, 0xEC, 0x3D, 0xC0, 0xBF, 0xA7, 0xD8, 0xD9, 0x84, 0x1A,
+    0x92, 0x9A, 0x36, 0x25, 0x91, 0x59, 0x16, 0x6B, 0x85, 0xB1, 0x28, 0x81, 0xE5, 0xE0, 0x7F, 0x66,
+    0xA2, 0x69, 0xE6, 0xD6, 0x72, 0x12, 0xC1, 0xDD, 0x97, 0x44, 0x08, 0x42, 0x3D, 0x45, 0x37, 0xA8,
+    0x16, 0xF6, 0x28, 0x82, 0x95, 0x45, 0x0A, 0xE3, 0x47, 0x77, 0x03, 0x6D, 0x18, 0x0F, 0xA8, 0xEE,
+    0x14, 0x0C, 0x2E, 0x5D, 0x0C, 0x3B, 0x00, 0xBB, 0xF8, 0xAD, 0xA9, 0xB9, 0x8D, 0x29, 0x18, 0x2D,
+    0xDE, 0x24, 0x48, 0x70, 0x07, 0xF6, 0x52, 0x70, 0x24, 0x81, 0xCC, 0xBC, 0xD2, 0xC2, 0xF6, 0x0C,
+    0x2C, 0x7B, 0x30, 0xF7, 0x17, 0xA1, 0x04, 0x2D, 0xF0, 0x70, 0xF8, 0xB0, 0xDD, 0x51, 0x23, 0x9F,
+    0x2D, 0x9F, 0xAF, 0x68, 0x7D, 0xC8, 0x40, 0x0A, 0x99, 0x42, 0x93, 0x96, 0xCB, 0xFC, 0x7F, 0xC9,
+    0xFB, 0x7C, 0x79, 0x80, 0xCF, 0x0D, 0xF6, 0x25, 0xB4, 0x27, 0x29, 0x9B, 0x35, 0xE4, 0x1F, 0x24,
+    0xC6, 0x05, 0xE0, 0x3B, 0x69, 0x9D, 0xA1, 0x4D, 0xD4, 0xFC, 0xA5, 0x2B, 0xF9, 0x9D, 0xEF, 0xD0,
+    0xB4, 0x09, 0x53, 0x4C, 0x96, 0x41, 0xF3, 0x05, 0xA2, 0x5B, 0x81, 0x82, 0x5E, 0xF0, 0x14, 0xDF,
+    0xAA, 0xF8, 0x40, 0xB0, 0x64, 0x02, 0x28, 0xBC, 0xB6, 0x44, 0x10, 0x5D, 0x28, 0x05, 0x6B, 0xC3,
+    0xD4, 0xA9, 0x27, 0x63, 0x01, 0x8D, 0x0B, 0x90, 0x36, 0xBF, 0xF0, 0x32, 0x30, 0xEB, 0x23, 0xFA,
+    0xE3, 0x8B, 0x6B, 0x93, 0x04, 0x90, 0xBB, 0xE8, 0xA2, 0x56, 0x3D, 0x0A, 0x5B, 0x50, 0xBA, 0xF6,
+    0xFC, 0x4B, 0xAC, 0x02, 0x6A, 0xA2, 0x02, 0xB9, 0xC6, 0x8C, 0xF2, 0xFF, 0xF0, 0x34, 0x30, 0x94,
+    0xE6, 0x58, 0xD6, 0x42, 0x69, 0xA6, 0x34, 0x54, 0x9B, 0xD5, 0x1E, 0xC0, 0x28, 0x7F, 0xD4, 0x6D,
+    0xC0, 0x7F, 0xFD, 0x17, 0xEF, 0xC5, 0x73, 0x55, 0xE4, 0x02, 0x92, 0xE2, 0xF5, 0xFF, 0xD0, 0x5D,
+    0x50, 0xA8, 0x22, 0x95, 0xCC, 0xBF, 0x9A, 0x88, 0xDB, 0x50, 0xA3, 0x2F, 0x98, 0x9F, 0xC0, 0xF7,
+    0xD1, 0x44, 0x96, 0x8F, 0xBF, 0x00, 0xC6, 0xFF, 0xAF, 0x4D, 0x96, 0x34, 0xDE, 0xB3, 0x03, 0x53,
+    0xD1, 0x8E, 0x85, 0x33, 0x99, 0xA2, 0x0D, 0xBD, 0xB0, 0x15, 0xAD, 0x16, 0x8F, 0x10, 0x2C, 0x40,
+    0x34, 0x9D, 0xD7, 0x37, 0x90, 0xD0, 0xA4, 0xAC, 0x8F, 0x3C, 0xC8, 0x4A, 0x67, 0x10, 0x25, 0xF3,
+    0x2C, 0x33, 0xAC, 0x05, 0xA1, 0x56, 0x31, 0x26, 0xF0, 0x07, 0x05, 0x5D, 0x08, 0xD9, 0xB9, 0x2E,
+    0x1D, 0x19, 0x3C, 0xF6, 0xB2, 0xCF, 0xD5, 0xDA, 0x80, 0xCB, 0x57, 0xD0, 0x1C, 0x4F, 0x06, 0xCE,
+    0xF3, 0xBB, 0x8E, 0xB7, 0xA1, 0x8B, 0x78, 0xFE, 0xCF, 0xC0, 0xF4, 0x37, 0x81, 0xA7, 0x7E, 0x69,
+    0x4F, 0x2F, 0x97, 0x95, 0x19, 0xF3, 0x6B, 0x12, 0xEB, 0x6D, 0x60, 0xDC, 0x18, 0xA0, 0x85, 0xD6,
+    0xFA, 0xE1, 0xC9, 0x7E, 0xBA, 0x9A, 0xB5, 0xB4, 0x20, 0x8B, 0x3F, 0xE3, 0x73, 0x83, 0x4A, 0xD4,
+    0xBA, 0xA5, 0x6D, 0xCE, 0x53, 0x48, 0x1E, 0xAB, 0x5A, 0x82, 0xD0, 0x3A, 0x42, 0x6B, 0xE9, 0x26,
+    0xDE, 0xA5, 0x9B, 0xDA, 0x4D, 0x8B, 0xA1, 0xC8, 0xBF, 0x1D, 0x2D, 0xC5, 0xAF, 0x1F, 0x22, 0x79,
+    0x29, 0xFD, 0xC2, 0x6C, 0x24, 0xFA, 0xB8, 0xD8, 0x4C, 0x7D, 0x1B, 0x21, 0x10, 0x20, 0x76, 0x90,
+    0x15, 0xA8, 0x5D, 0xCF, 0x6E, 0xCF, 0x6F, 0xC5, 0x20, 0x4E, 0xA4, 0x96, 0x79, 0x9D, 0xFC, 0x16,
+    0x2B, 0x9A, 0x01, 0x9C, 0x66, 0x0F, 0x7F, 0x0D, 0x0A, 0x5C, 0x4B, 0xC1, 0x8D, 0xBA, 0xFD, 0x1B,
+    0x33, 0x7F, 0x84, 0xE6, 0x7D, 0x12, 0x85, 0xFD, 0x11, 0xAD, 0x86, 0x48, 0x20, 0x3F, 0x5C, 0x9B,
+    0xC2, 0xEB, 0x48, 0xCB, 0xF2, 0xC0, 0x03, 0xC0, 0xE3, 0x8F, 0x03, 0xBF, 0x79, 0x8C, 0xF7, 0x27,
+    0x11, 0x5A, 0xD3, 0xD5, 0xD4, 0x0E, 0x46, 0xFF, 0xAA, 0xB6, 0x43, 0x0C, 0x0E, 0x5F, 0x7A, 0xC5,
+    0x9E, 0xED, 0xAB, 0x38, 0x40, 0x2B, 0x89, 0xDE, 0x3E, 0x9C, 0x64, 0xE4, 0xB5, 0x45, 0x53, 0x40,
+    0x11, 0x65, 0x37, 0x5D, 0xC4, 0x9C, 0xD9, 0xC0, 0x82, 0x45, 0xB6, 0xAA, 0x68, 0x05, 0x31, 0x75,
+    0x40, 0x69, 0x38, 0x7B, 0xD8, 0x16, 0x89, 0x28, 0x13, 0x4A, 0x16, 0x6F, 0x08, 0x04, 0x88, 0x2D,
+    0x47, 0x9C, 0x14, 0xEC, 0xAD, 0x03, 0x80, 0x81, 0xF4, 0xCD, 0xF2, 0xD1, 0x0A, 0xAE, 0xD4, 0x3F,
+    0x3F, 0xE9, 0x75, 0x0A, 0x98, 0xC1, 0x5E, 0x20, 0x18, 0xF9, 0xAB, 0xE6, 0x13, 0x28, 0xE4, 0xA1,
+    0x0C, 0xF6, 0x1E, 0xFB, 0x85, 0x9D, 0x11, 0x58, 0x01, 0x1C, 0xF3, 0xF1, 0x67, 0x9E, 0xD3, 0x12,
+    0x36, 0x34, 0xCD, 0x3C, 0x4D, 0xDA, 0xA8, 0x38, 0x52, 0x8B, 0x37, 0x48, 0xE0, 0xDA, 0xD2, 0xE9,
+    0x06, 0x5C, 0x2C, 0xA6, 0x08, 0x26, 0xF7, 0x92, 0xC3, 0x20, 0xF1, 0x37, 0xBF, 0xB3, 0xD7, 0x21,
+    0x92, 0x39, 0x57, 0xF7, 0xB0, 0xE6, 0x26, 0xF6, 0xEE, 0xC3, 0xEB, 0x8A, 0xAC, 0x49, 0x20, 0xE1,
+    0x1F, 0xCE, 0x05, 0xA6, 0x4D, 0xE5, 0xFB, 0xD0, 0x82, 0xA8, 0xAD, 0x42, 0xEE, 0xA4, 0x0F, 0x83,
+    0xC8, 0xDB, 0x48, 0x16, 0x17, 0x85, 0xCF, 0xDB, 0xC5, 0x10, 0x25, 0x3F, 0x3D, 0x04, 0x8A, 0xC8,
+    0x78, 0xC6, 0xAE, 0x18, 0x12, 0x58, 0x15, 0x9A, 0xD1, 0x9F, 0xD3, 0x9C, 0xF6, 0xEF, 0x6F, 0x9B,
+    0x57, 0x0D, 0xB3, 0xFE, 0xC7, 0x24, 0x60, 0xC2, 0x04, 0x7B, 0x81, 0xA6, 0xAF, 0x49, 0x40, 0xC1,
+    0xA4, 0x53, 0x00, 0xA3, 0xEF, 0xB0, 0x17, 0x73, 0x54, 0xE3, 0x8E, 0x5C, 0xC1, 0x7A, 0xBA, 0x8C,
+    0x71, 0xCF, 0x00, 0xFF, 0xCB, 0xF3, 0x73, 0xF3, 0x79, 0xBE, 0x8A, 0x24, 0x55, 0x95, 0x76, 0x06,
+    0x37, 0x7D, 0x9C, 0xE5, 0x3F, 0xAB, 0x98, 0x6E, 0x3E, 0xF2, 0x24, 0xF0, 0x09, 0x03, 0x4E, 0x09,
+    0x54, 0x31, 0x74, 0x2B, 0x9A, 0xFE, 0x11, 0xD4, 0xE8, 0xD6, 0xB4, 0x30, 0xB2, 0x4A, 0x82, 0x87,
+    0x35, 0xA7, 0xEE, 0xE7, 0x7F, 0x92, 0x88, 0x13, 0xF9, 0x2E, 0x5A, 0x7F, 0x58, 0x0D, 0x4C, 0xBD,
+    0xE8, 0x82, 0x7E, 0xF1, 0x30, 0xDF, 0x83, 0x16, 0x23, 0x9A, 0x91, 0xFF, 0xB7, 0x20, 0x3F, 0x78,
+    0xD9, 0x86, 0x93, 0x6F, 0x10, 0x82, 0x7A, 0x57, 0x31, 0x6D, 0x12, 0xC4, 0x10, 0xAC, 0xF4, 0xBA,
+    0xE9, 0xC0, 0x73, 0xF4, 0xD1, 0xC3, 0x18, 0xC4, 0x09, 0x8A, 0xDC, 0xFF, 0xC1, 0xCA, 0x1F, 0xCB,
+    0xC0, 0x4E, 0xEB, 0x01, 0x5B, 0xBF, 0x31, 0xC2, 0x32, 0x3B, 0x82, 0x19, 0xC1, 0x4F, 0x49, 0x18,
+    0xE5, 0xDF, 0x22, 0x81, 0xF2, 0x7B, 0xAD, 0xE8, 0xF5, 0x02, 0x03, 0xB4, 0x07, 0x7F, 0x06, 0x6C,
+    0xDB, 0xC6, 0x5B, 0x16, 0xE1, 0xB4, 0x72, 0x9C, 0x53, 0xCC, 0xDF, 0x5F, 0xFA, 0x3B, 0xF0, 0x4B,
+    0x0A, 0x5F, 0x1D, 0x3E, 0xBA, 0xBF, 0x7A, 0x08, 0xB5, 0x16, 0xC1, 0xC3, 0xBC, 0xD7, 0xF5, 0x0C,
+    0x46, 0x2B, 0x05, 0x5D, 0x4E, 0x01, 0x6B, 0x6D, 0x3D, 0x7D, 0xFE, 0xF8, 0xBF, 0xD8, 0xC2, 0x57,
+    0xC3, 0x92, 0x9A, 0x93, 0xD5, 0xBD, 0xFC, 0x07, 0x5E, 0x9F, 0x41, 0xB7, 0x15, 0xCE, 0x45, 0x21,
+    0xCA, 0x06, 0x27, 0x39, 0x40, 0xD9, 0x95, 0x80, 0x62, 0x25, 0x7B, 0xFF, 0xFD, 0xF7, 0x3B, 0x5B,
+    0xB5, 0x68, 0x98, 0x05, 0xF7, 0xF4, 0xF6, 0x86, 0x79, 0x2C, 0x25, 0xA6, 0xF6, 0x8C, 0xDA, 0x29,
+    0x17, 0x90, 0xD5, 0xC9, 0x5E, 0x8C, 0x69, 0xE7, 0x2E, 0x20, 0xDF, 0x6D, 0xF7, 0x13, 0x6C, 0xDE,
+    0xCC, 0xE3, 0x2C, 0x6A, 0xBB, 0x36, 0x36, 0xA3, 0xD5, 0x9C, 0x5C, 0x9D, 0xB9, 0xBA, 0xA6, 0x67,
+    0x19, 0x14, 0xBE, 0x16, 0x6B, 0x50, 0x2B, 0x9F, 0x46, 0xE7, 0xEC, 0xA5, 0xC5, 0x38, 0x42, 0x6D,
+    0xBD, 0x89, 0x6E, 0x45, 0xE9, 0x99, 0xCA, 0x74, 0x86, 0xF7, 0x96, 0x9B, 0x98, 0x32, 0x8D, 0xE4,
+    0x20, 0x51, 0x74, 0x9E, 0x88, 0x23, 0xCD, 0xFF, 0x35, 0x03, 0xC4, 0x81, 0x37, 0x02, 0x35, 0xE8,
+    0x2A, 0x04, 0x2D, 0x48, 0x3D, 0x9D, 0xFE, 0xFE, 0xF9, 0x17, 0x81, 0x85, 0xB4, 0x12, 0x6A, 0x73,
+    0xD0, 0x78, 0x82, 0xFE, 0x37, 0x00, 0xBF, 0x63, 0x3C, 0xD1, 0x56, 0x73, 0x01, 0x62, 0x2C, 0x7C,
+    0xBA, 0x32, 0x13, 0x46, 0xFA, 0x19, 0x24, 0xDE, 0xB3, 0xE2, 0xC0, 0x97, 0x5F, 0x7D, 0xFA, 0xCE,
+    0x3B, 0x73, 0x59, 0xFA, 0x4B, 0xA3, 0x24, 0x0B, 0xE0, 0x87, 0xA3, 0xEA, 0x6A, 0x98, 0xFE, 0x6D,
+    0xAC, 0x53, 0x0D, 0xCD, 0x88, 0x2D, 0x58, 0xB1, 0x8D, 0xA8, 0xDD, 0x7F, 0xA5, 0xE6, 0xDD, 0x77,
+    0xAF, 0x9D, 0xC2, 0xC9, 0x1D, 0x2C, 0xA7, 0x05, 0x78, 0xFA, 0x4F, 0xC0, 0xCB, 0xD4, 0x46, 0xEB,
+    0x77, 0x47, 0xF8, 0xB2, 0xFA, 0x68, 0xCB, 0x88, 0xFD, 0x57, 0xBF, 0x02, 0x9E, 0x7D, 0xCA, 0xF6,
+    0xCD, 0x82, 0x88, 0xB0, 0x99, 0x84, 0x90, 0x20, 0x2D, 0x42, 0x73, 0xF3, 0xF2, 0xFC, 0xCF, 0x97,
+    0x01, 0x7B, 0x48, 0x0E, 0x1D, 0x97, 0x40, 0x65, 0x3D, 0x9E, 0xFE, 0x3D, 0x7D, 0x3F, 0x85, 0x5F,
+    0x8B, 0xC4, 0x13, 0x01, 0x4D, 0x92, 0xE2, 0x45, 0x5A, 0x9D, 0x67, 0x9F, 0xE7, 0xF9, 0x4B, 0xEC,
+    0xD6, 0x41, 0xA5, 0xA8, 0xB7, 0xD3, 0x3D, 0x8C, 0x63, 0xCC, 0xD0, 0x81, 0x91, 0xBF, 0xE5, 0x22,
+    0x78, 0xBF, 0x98, 0xC2, 0x80, 0x7E, 0xFF, 0x78, 0x07, 0x9C, 0xA9, 0xAB, 0x0B, 0x0A, 0xAA, 0x16,
+    0x09, 0x59, 0xBF, 0x8D, 0x62, 0x09, 0x30, 0x7A, 0xF4, 0x68, 0xFF, 0xFE, 0x43, 0xEB, 0x56, 0x18,
+    0xE6, 0xE1, 0x3D, 0xAC, 0x00, 0xFD, 0x6C, 0x6A, 0x6C, 0xA1, 0xE7, 0xB3, 0x38, 0xCA, 0xD3, 0xC7,
+    0xFE, 0x16, 0x78, 0x94, 0xC1, 0x5E, 0x33, 0x46, 0xDA, 0x32, 0xF1, 0x6A, 0xC9, 0xD3, 0x6A, 0x22,
+    0x56, 0xB3, 0x85, 0x04, 0xCB, 0x73, 0x5D, 0xDC, 0x1A, 0x32, 0xBF, 0x1F, 0x30, 0xC4, 0xEE, 0x5B,
+    0x28, 0x1C, 0x69, 0x74, 0x31, 0xAC, 0xE0, 0x8F, 0xF7, 0x50, 0xBF, 0x83, 0x7C, 0xBE, 0x16, 0x79,
+    0x78, 0xE0, 0x47, 0xFC, 0x64, 0xCE, 0x5F, 0x4D, 0xDD, 0x29, 0xDC, 0xAF, 0x7B, 0xFA, 0x69, 0x71,
+    0xF6, 0xEE, 0x01, 0xB6, 0xD2, 0x4A, 0x88, 0x28, 0x7A, 0xB6, 0x62, 0x93, 0x47, 0x7F, 0x4E, 0xE1,
+    0xD3, 0x5A, 0x58, 0x11, 0x7F, 0x79, 0xA8, 0x23, 0x93, 0x39, 0x91, 0x79, 0x6C, 0xFF, 0x91, 0x03,
+    0xEB, 0x97, 0x8C, 0x1A, 0x35, 0xEA, 0xB2, 0xDA, 0x2F, 0x94, 0x18, 0x03, 0xCC, 0x99, 0xF3, 0xE1,
+    0x09, 0x13, 0xEE, 0xF3, 0x30, 0x62, 0x1A, 0xD2, 0x5C, 0x08, 0x0A, 0xAB, 0x1E, 0x63, 0x02, 0x55,
+    0xFE, 0xC8, 0x91, 0x76, 0xCF, 0x9F, 0x70, 0x8A, 0x7E, 0xFB, 0xB8, 0x46, 0xE1, 0x14, 0x96, 0x8A,
+    0x6F, 0x2C, 0xA1, 0x68, 0x82, 0x46, 0x2A, 0xD3, 0x3F, 0xF5, 0x00, 0x6A, 0x60, 0x87, 0x1A, 0x8B,
+    0xAC, 0x18, 0xA9, 0x10, 0xFC, 0x5B, 0x5F, 0xAD, 0x8D, 0xFF, 0x68, 0x70, 0x88, 0x06, 0x70, 0x54,
+    0x52, 0x5C, 0x21, 0xA1, 0x0A, 0xBC, 0xEE, 0xD8, 0x51, 0xBA, 0x8B, 0x60, 0x9F, 0x80, 0x9E, 0xA9,
+    0xCC, 0xE4, 0x87, 0xB4, 0x44, 0xED, 0x9A, 0x72, 0x87, 0xAA, 0xB9, 0xDC, 0xD4, 0x90, 0x83, 0xE5,
+    0x70, 0x78, 0x3E, 0xF9, 0x62, 0xD6, 0xF1, 0x92, 0xE6, 0x06, 0x94, 0x48, 0x00, 0x0B, 0x4E, 0x96,
+    0xD0, 0x50, 0x6D, 0x94, 0x23, 0xD0, 0xD4, 0x6A, 0xB9, 0x98, 0x76, 0xED, 0xEC, 0x69, 0xD8, 0x82,
+    0x3A, 0x81, 0x34, 0xC9, 0xE3, 0xE2, 0xC8, 0x46, 0x83, 0x32, 0xB4, 0x72, 0x97, 0x6A, 0x42, 0x24,
+    0x50, 0xC7, 0xD1, 0x05, 0x04, 0xE0, 0x81, 0xAF, 0xBB, 0x8B, 0xF9, 0x35, 0x99, 0xC7, 0xAD, 0x8A,
+    0x29, 0x52, 0x75, 0x6A, 0x52, 0x3E, 0x44, 0x02, 0x68, 0x90, 0xA7, 0xA0, 0x25, 0x6A, 0x5B, 0x52,
+    0xEB, 0x1B, 0x5C, 0xCB, 0x2F, 0xBC, 0xB6, 0x5C, 0x41, 0xB2, 0x72, 0xD2, 0x3C, 0x85, 0x80, 0xD0,
+    0x08, 0xA0, 0xDF, 0xCF, 0x87, 0x9A, 0xBF, 0xCA, 0x19, 0xA8, 0x9D, 0xB5, 0x68, 0x09, 0xAE, 0x51,
+    0xD3, 0x2D, 0x21, 0x02, 0xEC, 0x3B, 0x44, 0x61, 0x5D, 0x54, 0x2A, 0xC9, 0xD1, 0xEA, 0xDF, 0x0F,
+    0x0A, 0xF4, 0x52, 0x49, 0x8D, 0x8E, 0x17, 0xCA, 0x5B, 0xAE, 0xC2, 0x1A, 0x1B, 0x50, 0x84, 0x00,
+    0xAA, 0x29, 0x8D, 0x37, 0xD4, 0x33, 0x04, 0x91, 0xEE, 0x1A, 0xAD, 0x8B, 0x16, 0xE3, 0x80, 0xEF,
+    0xD2, 0xA0, 0x79, 0x72, 0x75, 0xE4, 0x67, 0x2D, 0xFB, 0x6B, 0x31, 0x28, 0x91, 0x00, 0x75, 0xEA,
+    0xA4, 0x9B, 0x46, 0x5C, 0x97, 0xD3, 0x70, 0x54, 0x2E, 0xD6, 0x97, 0xC4, 0x04, 0x14, 0x5A, 0x0D,
+    0x12, 0xA0, 0x76, 0x70, 0x81, 0x3A, 0xFD, 0x4A, 0xC8, 0x81, 0x1C, 0xFE, 0x71, 0x89, 0x52, 0x15,
+    0x55, 0xF8, 0x0B, 0x04, 0x7B, 0x29, 0xF0, 0xF8, 0xB7, 0x4E, 0x91, 0x05, 0x38, 0x52, 0xC4, 0x02,
+    0xD0, 0x4D, 0xD4, 0x56, 0xAF, 0x60, 0xA1, 0x8B, 0x28, 0x4F, 0x30, 0x52, 0xBC, 0x66, 0x5C, 0xC7,
+    0xD3, 0x69, 0xF9, 0x95, 0x4A, 0x2A, 0x69, 0xC9, 0x04, 0xC8, 0xCE, 0x46, 0xC0, 0x8C, 0xEB, 0xB4,
+    0x89, 0xE1, 0xF5, 0x3E, 0x9A, 0x48, 0xC5, 0xCE, 0xE5, 0x07, 0xAC, 0xFC, 0x9A, 0x24, 0x80, 0x86,
+    0x73, 0x09, 0x5A, 0x54, 0x42, 0x43, 0xBF, 0x4A, 0xBF, 0x50, 0x4A, 0x08, 0xE0, 0x3D, 0x2D, 0x02,
+    0x04, 0xD7, 0xE9, 0xD6, 0xB8, 0xC2, 0x3A, 0xE5, 0xD0, 0x02, 0x50, 0xE2, 0xCC, 0x00, 0x9C, 0x7B,
+    0x11, 0xD7, 0x29, 0x3B, 0xAE, 0x7E, 0x7A, 0x89, 0x6F, 0x57, 0x22, 0x01, 0xC6, 0x8E, 0x1D, 0xEB,
+    0x2F, 0xF0, 0xA7, 0x7C, 0xCE, 0x84, 0x6B, 0x0B, 0xEB, 0x20, 0xBF, 0x44, 0xED, 0x89, 0x26, 0x58,
+    0xBC, 0xB4, 0xAA, 0x8C, 0x05, 0x82, 0x16, 0x40, 0x7E, 0x5E, 0x0D, 0x38, 0x56, 0x0C, 0xA0, 0xE1,
+    0x2B, 0xDA, 0xE4, 0xEF, 0x59, 0x4A, 0x6B, 0x12, 0x08, 0x0B, 0x20, 0xDF, 0x6F, 0xF5, 0x90, 0xEB,
+    0xBB, 0x8E, 0xAB, 0xDF, 0xA0, 0x28, 0x61, 0xF8, 0xB7, 0x26, 0xA6, 0x38, 0x94, 0x31, 0x14, 0xDE,
+    0x43, 0x1B, 0xAF, 0x51, 0x57, 0xB4, 0x46, 0x07, 0x09, 0x69, 0x8C, 0x01, 0xAA, 0x95, 0x37, 0x0B,
+    0x20, 0xD9, 0x98, 0x24, 0x00, 0x72, 0xB7, 0x79, 0xF2, 0xAB, 0x2D, 0x5C, 0xB1, 0x22, 0xAF, 0x44,
+    0xAB, 0x7D, 0x09, 0x6F, 0x78, 0x21, 0xC6, 0x8D, 0x1B, 0x47, 0x9F, 0x58, 0xE3, 0x5C, 0xDF, 0xAE,
+    0x5B, 0x7A, 0xC1, 0x3C, 0xD7, 0xDE, 0x30, 0xFC, 0x11, 0x9D, 0x1B, 0x58, 0x5A, 0xE8, 0x77, 0x7F,
+    0xD4, 0x3B, 0xF8, 0xE9, 0x02, 0x96, 0x9D, 0x15, 0xA0, 0x80, 0x4F, 0xF5, 0xA0, 0x15, 0x39, 0x56,
+    0xAD, 0xB3, 0x47, 0xF8, 0xAE, 0x5D, 0x6B, 0x4F, 0x06, 0x55, 0x6F, 0xA2, 0xCE, 0x91, 0x7F, 0x17,
+    0x09, 0x36, 0x6E, 0xB5, 0x8F, 0xAF, 0xE3, 0x79, 0x9A, 0x14, 0x7A, 0x3A, 0x38, 0xF0, 0x59, 0xED,
+    0x00, 0xEA, 0x03, 0xD8, 0xCC, 0x74, 0xCF, 0xBA, 0xC7, 0x06, 0x60, 0xE5, 0x6A, 0xE6, 0xFE, 0x9F,
+    0x31, 0xC6, 0xD8, 0x67, 0x5F, 0xDB, 0xA7, 0x1F, 0x70, 0xF3, 0xF5, 0x3C, 0xB9, 0xBC, 0x39, 0x46,
+    0x23, 0x25, 0x1F, 0x8E, 0xAA, 0xEB, 0x5E, 0x7E, 0xEB, 0xCC, 0x94, 0xC7, 0x1F, 0x1F, 0x5F, 0x62,
+    0x78, 0x1A, 0x92, 0x28, 0x35, 0x36, 0x70, 0xCC, 0xAF, 0x4E, 0x8D, 0x81, 0x7B, 0xDA, 0x83, 0x46,
+    0xE0, 0x50, 0x8D, 0xF2, 0x44, 0x00, 0x69, 0xB0, 0x96, 0x93, 0x7D, 0xFC, 0x09, 0xDB, 0x3F, 0x2B,
+    0x80, 0x53, 0xCF, 0x5D, 0x61, 0x94, 0xAF, 0x0F, 0x11, 0x42, 0x9A, 0xAB, 0xCE, 0x21, 0x41, 0xE7,
+    0xA8, 0x11, 0xA9, 0x10, 0xB2, 0x0E, 0x12, 0xBE, 0x46, 0xF0, 0x0A, 0x4A, 0x13, 0x95, 0x29, 0x28,
+    0x63, 0xD0, 0xB5, 0x82, 0x88, 0xA3, 0x8E, 0x28, 0x8D, 0x4B, 0x50, 0x06, 0xA0, 0x06, 0xA6, 0xDF,
+    0x30, 0xFF, 0x47, 0x14, 0x06, 0x4B, 0x87, 0x0C, 0xBE, 0xA3, 0xE9, 0x68, 0x70, 0x0C, 0xF1, 0x83,
+    0xDF, 0x9E, 0xF0, 0x2F, 0xE3, 0xC9, 0x5F, 0xFC, 0x62, 0x82, 0x3B, 0x78, 0xE4, 0xB2, 0x90, 0x21,
+    0x0C, 0x05, 0x01, 0xC4, 0x0F, 0xD8, 0x01, 0x54, 0xF9, 0xD2, 0x8A, 0x03, 0x0A, 0x6B, 0xA5, 0x3C,
+    0x80, 0xEF, 0xA2, 0x81, 0x97, 0x75, 0x83, 0x71, 0x80, 0x1A, 0x85, 0xD4, 0x89, 0xA3, 0x11, 0x3F,
+    0xDA, 0xD4, 0x5A, 0xA7, 0xCF, 0x42, 0xE1, 0x0B, 0x3A, 0xA7, 0xF0, 0xB8, 0xB6, 0x3C, 0xFA, 0xF5,
+    0x42, 0xE1, 0x0B, 0x12, 0xB2, 0xEE, 0x51, 0x78, 0xAD, 0x36, 0x7D, 0xB7, 0xC6, 0x24, 0x12, 0xF2,
+    0xFF, 0x56, 0xEA, 0x59, 0xCE, 0xEA, 0x81, 0xFF, 0x53, 0xE0, 0x29, 0x87, 0xE0, 0x1A, 0xB8, 0x33,
+    0x31, 0xB1, 0x75, 0x48, 0xCE, 0x29, 0x64, 0x5D, 0x0E, 0x04, 0x8E, 0x66, 0xE0, 0xC4, 0xCD, 0xBF,
+    0x83, 0x77, 0xF3, 0x20, 0xC3, 0xE1, 0xAF, 0x5A, 0x6E, 0xAC, 0x00, 0xB5, 0x79, 0xFB, 0x1E, 0x60,
+    0xC6, 0x0C, 0xBB, 0x89, 0x37, 0xD2, 0xAF, 0x25, 0x4B, 0xA0, 0x0E, 0x22, 0xFD, 0x3C, 0x4D, 0xF7,
+    0x2C, 0xEE, 0x28, 0x2F, 0x2E, 0x40, 0x64, 0x34, 0xE3, 0x4E, 0x99, 0x8E, 0xC6, 0x33, 0x51, 0x6D,
+    0xE9, 0x9F, 0xC7, 0x8D, 0x9B, 0xB0, 0x8D, 0xEE, 0xBB, 0x44, 0x12, 0x84, 0x5C, 0x5F, 0x96, 0x1B,
+    0xF8, 0xEF, 0xE5, 0x63, 0xE1, 0x5B, 0xF5, 0x43, 0xC3, 0xCC, 0xAB, 0x55, 0x6E, 0x08, 0x40, 0xF8,
+    0x58, 0xF8, 0xF3, 0x34, 0xCF, 0x6A, 0xDF, 0x57, 0xC0, 0x17, 0x49, 0x68, 0x90, 0xA9, 0x86, 0x99,
+    0xA7, 0x30, 0x4E, 0xD0, 0x67, 0xB9, 0x81, 0x2C, 0x80, 0x51, 0x2D, 0x17, 0x71, 0xED, 0x5E, 0x1B,
+    0xF7, 0xD7, 0xEB, 0x7E, 0x47, 0xE1, 0x87, 0xD4, 0x3C, 0x55, 0x1A, 0x02, 0x38, 0xC6, 0x3E, 0x9E,
+    0x79, 0xB7, 0x79, 0xEE, 0xF7, 0x3F, 0x87, 0x6F, 0x73, 0x6B, 0x6B, 0x69, 0xB2, 0xF2, 0x40, 0x02,
+    0xBE, 0x83, 0x87, 0xE6, 0x7B, 0x2B, 0xAD, 0xC0, 0x76, 0x8D, 0x12, 0x92, 0x26, 0xD8, 0xBB, 0xC3,
+    0x0E, 0xDD, 0x5A, 0xB1, 0x45, 0x9B, 0xA6, 0x40, 0xD3, 0x6B, 0x99, 0x2D, 0xD8, 0xBB, 0x63, 0x0F,
+    0x09, 0x5F, 0xE6, 0xDF, 0xD1, 0x7C, 0x1B, 0x52, 0x9E, 0x7C, 0x69, 0xDA, 0x7B, 0x49, 0xAF, 0xAB,
+    0x1F, 0x27, 0x78, 0xB4, 0x58, 0x94, 0xAA, 0x9E, 0x4C, 0xB3, 0xA0, 0x85, 0x99, 0x77, 0xCB, 0x63,
+    0xF0, 0x7D, 0x31, 0xCC, 0x30, 0x7C, 0x69, 0xE5, 0x82, 0x00, 0xD4, 0xC2, 0xAD, 0x8C, 0x4E, 0x5E,
+    0xFD, 0x17, 0x30, 0xF1, 0x4D, 0xFA, 0x7A, 0x6A, 0x68, 0xA4, 0x5E, 0x4B, 0x04, 0x50, 0xC0, 0x78,
+    0xE7, 0x08, 0xE0, 0x89, 0x5F, 0x02, 0x8D, 0x1B, 0x70, 0x47, 0x79, 0x68, 0x06, 0x16, 0x01, 0xCC,
+    0xF8, 0x13, 0x70, 0xB6, 0x9C, 0x8B, 0xF4, 0x4F, 0xFF, 0x6C, 0x18, 0xE9, 0x9B, 0x43, 0x59, 0x1F,
+    0x48, 0x28, 0x31, 0x0D, 0xBC, 0x10, 0xCE, 0xBC, 0xBE, 0xBD, 0x92, 0xDA, 0x20, 0x70, 0xB0, 0x93,
+    0x81, 0xB3, 0xB1, 0x1D, 0x1F, 0x50, 0x08, 0x12, 0x60, 0x03, 0x7D, 0xBF, 0x7E, 0xD4, 0x71, 0x0F,
+    0x53, 0x34, 0x05, 0x78, 0x91, 0xDC, 0x34, 0xC2, 0x48, 0x59, 0x42, 0xA3, 0x0C, 0xA0, 0x55, 0x0B,
+    0x3E, 0x3F, 0x24, 0x3D, 0x8B, 0x02, 0x9C, 0x75, 0x4F, 0xC3, 0x95, 0xB5, 0xF8, 0xD5, 0x37, 0xCF,
+    0x4D, 0xEB, 0xDC, 0xB9, 0x73, 0xC8, 0x6F, 0x55, 0x4A, 0x0B, 0x60, 0x1A, 0xA6, 0x67, 0xE5, 0xDD,
+    0x38, 0xF3, 0x8B, 0x5F, 0xC1, 0xB7, 0xBC, 0x85, 0xE1, 0x0C, 0x61, 0xCC, 0x51, 0xA4, 0x41, 0x0A,
+    0xE7, 0x1C, 0x03, 0xA6, 0xCD, 0x02, 0x66, 0xBE, 0xA7, 0x60, 0x35, 0xB8, 0x3F, 0x42, 0x90, 0x05,
+    0xB8, 0x89, 0xF9, 0xBF, 0x06, 0x88, 0xEA, 0x27, 0xE2, 0x62, 0x6E, 0x01, 0x2C, 0xED, 0x67, 0x66,
+    0xE6, 0xEC, 0xB6, 0x15, 0xA9, 0xE3, 0x27, 0x4E, 0x9B, 0x75, 0xE4, 0x95, 0x50, 0xCD, 0xBF, 0x50,
+    0x6A, 0x1D, 0x0E, 0x04, 0x4E, 0xB7, 0xC4, 0xE9, 0x1F, 0x3D, 0x0A, 0xCF, 0xDC, 0xA1, 0x06, 0xCE,
+    0x95, 0x8B, 0x36, 0x01, 0xCD, 0x16, 0xD2, 0x10, 0xAF, 0xF3, 0xE7, 0xA8, 0xA1, 0x0A, 0x04, 0x23,
+    0xF4, 0x4E, 0xCA, 0x00, 0x34, 0xF4, 0x4B, 0x2D, 0x85, 0x1A, 0x3A, 0xAE, 0x1F, 0x93, 0x8C, 0x39,
+    0x44, 0x00, 0xA3, 0x0A, 0x83, 0xBF, 0x1E, 0x33, 0x51, 0x65, 0xF2, 0x2B, 0x86, 0x91, 0xB6, 0x2E,
+    0x54, 0xF3, 0x2F, 0x94, 0xD2, 0x05, 0x08, 0xF1, 0x79, 0x7D, 0xFB, 0xF6, 0xAD, 0x0E, 0xDF, 0xF6,
+    0x4C, 0xF8, 0x73, 0xAA, 0x31, 0x18, 0x8C, 0x70, 0xDC, 0x5D, 0x32, 0x54, 0xDC, 0x13, 0xCC, 0xD3,
+    0x73, 0x49, 0x80, 0xF3, 0x34, 0xD1, 0x91, 0xDA, 0xCE, 0x51, 0xDB, 0xCF, 0x93, 0x60, 0x89, 0x24,
+    0x81, 0x35, 0x9C, 0x2C, 0xD6, 0xB0, 0xB5, 0xDF, 0x0B, 0x47, 0xCB, 0xFD, 0x46, 0xF2, 0x7D, 0xB3,
+    0x5E, 0xFD, 0xD7, 0xA6, 0x0F, 0x4B, 0x63, 0xFE, 0x85, 0x32, 0xE9, 0x4A, 0x20, 0x70, 0xA6, 0x0D,
+    0x4E, 0xDD, 0xFB, 0x30, 0xBC, 0xEF, 0x0D, 0x33, 0xE0, 0xA9, 0x19, 0x53, 0x2B, 0x40, 0xFA, 0xA9,
+    0x21, 0x67, 0xFE, 0x02, 0xFB, 0x87, 0xA4, 0x35, 0x9D, 0x3C, 0xD2, 0x16, 0x40, 0x13, 0x57, 0x47,
+    0x0E, 0x0D, 0xCE, 0x35, 0x8C, 0xA5, 0x15, 0x10, 0x01, 0x90, 0x94, 0x0B, 0x67, 0xD7, 0xB9, 0x46,
+    0xFA, 0xD4, 0x97, 0x0C, 0xA3, 0xC6, 0x9A, 0xE0, 0x91, 0x90, 0x51, 0xA6, 0xAA, 0xD2, 0xCF, 0xC5,
+    0x8D, 0x1C, 0x94, 0x7F, 0x17, 0xF2, 0x5F, 0xFA, 0x6F, 0x78, 0x57, 0xB6, 0x61, 0x2C, 0x10, 0x3B,
+    0x7D, 0x60, 0x3E, 0x3E, 0x7F, 0x21, 0xF0, 0xDC, 0x73, 0xC0, 0xD2, 0xD5, 0xB6, 0x90, 0x22, 0x8D,
+    0xCE, 0xED, 0x81, 0xDF, 0x30, 0x0B, 0x18, 0x36, 0x80, 0x5F, 0x4A, 0x6C, 0x6C, 0x8D, 0x10, 0x0A,
+    0xB5, 0xDF, 0xD9, 0x69, 0x2B, 0x92, 0xEE, 0xFA, 0xC7, 0xFC, 0xC5, 0xCD, 0x5F, 0x1F, 0x30, 0x60,
+    0x40, 0xA9, 0xDF, 0xA6, 0xCC, 0xBA, 0x42, 0x2B, 0x90, 0x89, 0x33, 0x3F, 0x7B, 0x08, 0xEE, 0x29,
+    0x23, 0x69, 0x05, 0x62, 0x17, 0x0B, 0x50, 0x23, 0xD7, 0x6D, 0x01, 0x5E, 0xFC, 0x1B, 0xF0, 0x61,
+    0xB0, 0x43, 0x28, 0x92, 0x50, 0x10, 0xD8, 0xBB, 0x27, 0xF0, 0x93, 0x1F, 0x02, 0x7D, 0x7A, 0x70,
+    0x47, 0xB0, 0x79, 0x38, 0xEA, 0xB0, 0xB4, 0x3F, 0x39, 0x17, 0xF1, 0xBD, 0x67, 0x21, 0xF5, 0xED,
+    0xD7, 0x1C, 0x8E, 0xEA, 0x9A, 0x92, 0x5A, 0x6A, 0x94, 0x59, 0x6C, 0x96, 0x15, 0x18, 0x9A, 0x30,
+    0x1A, 0x67, 0xFF, 0xFA, 0x6B, 0x78, 0x17, 0xD1, 0x0A, 0x5C, 0x72, 0xE2, 0x76, 0x54, 0xA0, 0x49,
+    0x1A, 0x1A, 0x07, 0x90, 0xAD, 0x35, 0xF9, 0xE9, 0xAB, 0x23, 0xE9, 0x02, 0x34, 0x41, 0xB4, 0x49,
+    0x33, 0x7B, 0xFD, 0xC1, 0xC4, 0xE0, 0xFE, 0x58, 0xC0, 0x34, 0x1D, 0x6E, 0x38, 0xBB, 0x6F, 0x47,
+    0xF2, 0xCF, 0x26, 0xCC, 0x5F, 0x58, 0xF5, 0xAD, 0xB2, 0x68, 0xBF, 0x70, 0x45, 0x55, 0x15, 0x08,
+    0x9C, 0x6A, 0x86, 0x73, 0x4F, 0xD1, 0x15, 0xBC, 0x35, 0x02, 0xE6, 0xC9, 0x16, 0xB1, 0x0C, 0x08,
+    0x35, 0xDB, 0x47, 0x3F, 0xD2, 0xE8, 0xA6, 0x4F, 0xB6, 0x1A, 0x83, 0xC2, 0x4C, 0x02, 0x09, 0x5F,
+    0x13, 0x45, 0x12, 0xB8, 0x69, 0x01, 0x0B, 0x6B, 0xB9, 0x97, 0x08, 0x5B, 0x9B, 0xCB, 0xC1, 0xFE,
+    0x0D, 0xE1, 0xF4, 0x9D, 0x46, 0xC2, 0xAD, 0xB3, 0xCD, 0xCA, 0x13, 0xDE, 0x71, 0x38, 0xD2, 0x37,
+    0x04, 0x0F, 0x95, 0x1A, 0x57, 0x54, 0x4D, 0xB6, 0x15, 0xE8, 0xD0, 0x0E, 0xE7, 0x1F, 0xBB, 0x1F,
+    0x9E, 0x39, 0xA3, 0x0D, 0xC3, 0x17, 0x33, 0x57, 0xA0, 0x9F, 0x65, 0xDB, 0x73, 0x10, 0x58, 0xB5,
+    0xC2, 0x5E, 0xE4, 0x29, 0xDC, 0x2B, 0x72, 0x8A, 0x54, 0x1A, 0x7B, 0x78, 0x5D, 0x6F, 0xA0, 0x7E,
+    0x1D, 0xA6, 0x4F, 0xB1, 0xCA, 0xFF, 0x2D, 0xD3, 0x1F, 0xCF, 0xB4, 0xAF, 0xF7, 0x4C, 0x54, 0x7A,
+    0x6A, 0xD2, 0xFC, 0x4F, 0xCE, 0xAF, 0x2D, 0xAB, 0xF6, 0x0B, 0x57, 0x5C, 0x4D, 0x5A, 0x83, 0xA6,
+    0x4B, 0x9B, 0x15, 0xC3, 0x92, 0xF0, 0xEE, 0x93, 0xF0, 0xAD, 0x6D, 0x1B, 0x93, 0x80, 0x90, 0x4F,
+    0xD4, 0x32, 0x71, 0x7F, 0xFF, 0x27, 0xF0, 0xDA, 0x9B, 0xB4, 0x02, 0xAC, 0x8E, 0xB0, 0x5B, 0x00,
+    0x6E, 0xB2, 0x00, 0x0F, 0xD3, 0xF7, 0xFF, 0xF0, 0x3E, 0xA0, 0x8E, 0xBA, 0x83, 0x63, 0xD0, 0x0A,
+    0x48, 0xED, 0xF7, 0xC1, 0xD9, 0x7E, 0x2B, 0x12, 0x6F, 0x79, 0x7E, 0xF1, 0xAA, 0xFE, 0x53, 0xFA,
+    0xF5, 0xEB, 0x57, 0x10, 0x3C, 0x54, 0x26, 0x5C, 0xB1, 0xC9, 0xE6, 0x0B, 0xF8, 0x1C, 0x71, 0x83,
+    0xD6, 0x23, 0xA1, 0xEB, 0xFB, 0x30, 0x92, 0x76, 0xF2, 0x05, 0x63, 0x92, 0x18, 0x69, 0xA9, 0x58,
+    0x0D, 0xD9, 0x52, 0xBF, 0xBD, 0x7A, 0x06, 0x35, 0x3C, 0x2C, 0xDC, 0x9B, 0xD6, 0xFF, 0x39, 0xCE,
+    0x94, 0x53, 0x7F, 0xC7, 0xC2, 0xD2, 0xD9, 0xA6, 0xBF, 0xF2, 0x4E, 0xC4, 0x35, 0xFD, 0x00, 0xAE,
+    0x1F, 0xAD, 0xBB, 0x52, 0xE1, 0x0B, 0x61, 0x29, 0xC6, 0xEA, 0xD5, 0xAB, 0x5D, 0x2D, 0x5A, 0xB8,
+    0xDA, 0x24, 0x7B, 0x9F, 0xBB, 0x0F, 0x9E, 0x29, 0xA3, 0xA9, 0x1A, 0x35, 0x18, 0x0F, 0x44, 0xB5,
+    0x8A, 0xF4, 0xFB, 0xBC, 0x2B, 0xD7, 0x03, 0xB3, 0x67, 0xDA, 0x24, 0x88, 0x44, 0x0C, 0xA0, 0xD5,
+    0xC3, 0x06, 0x0C, 0xB6, 0x17, 0x7D, 0x4C, 0x92, 0xEA, 0x44, 0x33, 0x06, 0x90, 0xE9, 0x37, 0x5D,
+    0xC7, 0x10, 0x3F, 0x60, 0x06, 0x52, 0x7E, 0xFB, 0xD6, 0xFC, 0x4F, 0x8E, 0xAF, 0xB9, 0x12, 0xD3,
+    0x5F, 0x88, 0xB0, 0x55, 0xD3, 0xBC, 0x79, 0xF3, 0x12, 0xFA, 0x74, 0x3F, 0x33, 0x20, 0xC9, 0x9C,
+    0xF4, 0x14, 0x3C, 0x1F, 0xB6, 0x33, 0x1C, 0x0C, 0xCB, 0xA2, 0x49, 0x01, 0x3E, 0x4B, 0x4B, 0xBA,
+    0x9C, 0xA0, 0x15, 0x50, 0xF7, 0xB0, 0x6C, 0x5B, 0xB8, 0x52, 0x42, 0x91, 0x49, 0xAD, 0x8D, 0xF2,
+    0x6D, 0x5A, 0x3D, 0xAC, 0xB2, 0xC2, 0xFF, 0x68, 0xDA, 0x39, 0x09, 0x3F, 0xC0, 0xA8, 0xC3, 0x75,
+    0x63, 0x36, 0x92, 0x86, 0xFD, 0x79, 0xED, 0x96, 0xAC, 0x99, 0x9D, 0x3B, 0x77, 0x0E, 0xCB, 0x60,
+    0xB4, 0xB0, 0x8A, 0xE8, 0xE4, 0xC9, 0xED, 0x8D, 0x53, 0x5D, 0x8B, 0xEF, 0x47, 0xFE, 0x84, 0x11,
+    0xF0, 0x6D, 0x6E, 0xC6, 0xD4, 0x30, 0xBA, 0x59, 0x01, 0x4B, 0xA3, 0x45, 0x1B, 0xCE, 0x33, 0x40,
+    0xD3, 0x22, 0xD3, 0xE1, 0x68, 0x15, 0x14, 0x89, 0xD4, 0xFA, 0x57, 0x8D, 0x81, 0x5F, 0xB2, 0xA6,
+    0x94, 0x49, 0xE7, 0xC2, 0x44, 0xAC, 0x50, 0x61, 0x06, 0x0C, 0x3F, 0xE2, 0xDA, 0xEC, 0x40, 0xFC,
+    0x9D, 0x73, 0xBD, 0x18, 0xF5, 0x76, 0x42, 0xE5, 0x26, 0x4C, 0x78, 0xC3, 0x83, 0xB0, 0x12, 0x80,
+    0x59, 0x41, 0xFC, 0x80, 0x01, 0x99, 0x99, 0xC9, 0xE6, 0xDB, 0x23, 0x90, 0xFF, 0xDA, 0x48, 0x98,
+    0xB9, 0x4D, 0xA3, 0x9A, 0x1A, 0x52, 0xF8, 0x3B, 0xF6, 0x01, 0xFF, 0x99, 0x0A, 0x7C, 0xFC, 0xA9,
+    0xDD, 0x7D, 0x1B, 0x0E, 0x68, 0x14, 0xF1, 0x8D, 0xFD, 0x80, 0xBB, 0x7F, 0x00, 0x34, 0xBE, 0x86,
+    0x3B, 0xA2, 0x18, 0xFC, 0xD9, 0x7E, 0xBF, 0xE6, 0x4E, 0x24, 0xDC, 0x3E, 0x07, 0x49, 0xF7, 0xCE,
+    0x5A, 0xBB, 0xD1, 0xDC, 0x10, 0x2E, 0xED, 0x17, 0xC2, 0x4A, 0x00, 0x41, 0x24, 0x18, 0x7A, 0x6B,
+    0x9B, 0xE6, 0xAE, 0xC0, 0xF8, 0x3B, 0x50, 0x30, 0x79, 0x38, 0x63, 0xF2, 0x66, 0x51, 0x23, 0x01,
+    0x35, 0x74, 0x21, 0xD3, 0xC0, 0xC7, 0x1E, 0xB3, 0x97, 0x95, 0x0B, 0x57, 0xD7, 0xB0, 0xAC, 0x48,
+    0xBB, 0x4C, 0xE0, 0xD9, 0x67, 0x81, 0x5B, 0xFB, 0x70, 0x47, 0x14, 0x5A, 0xFF, 0x68, 0x79, 0xF4,
+    0x5F, 0x00, 0x46, 0xE2, 0x4E, 0xC4, 0x0F, 0x7F, 0x2F, 0x1F, 0x77, 0x4D, 0xDD, 0xBA, 0xAB, 0x66,
+    0x76, 0x38, 0x85, 0x2F, 0x84, 0x3D, 0x65, 0x9B, 0x3A, 0x75, 0xAA, 0x7F, 0xD8, 0x88, 0xFB, 0x4E,
+    0x54, 0xA9, 0xD9, 0xE3, 0xB8, 0xCB, 0x79, 0xDC, 0x01, 0xDF, 0x96, 0x3A, 0x2C, 0x48, 0x3A, 0x2B,
+    0x31, 0xEC, 0x64, 0xBB, 0x14, 0x34, 0xB1, 0xF3, 0xF4, 0x49, 0x60, 0xE7, 0x1E, 0xFE, 0x4D, 0x7F,
+    0x2D, 0xF3, 0xAD, 0xE1, 0xDC, 0xA5, 0x85, 0x84, 0x5E, 0x2D, 0xDD, 0x0E, 0xFC, 0xB4, 0xA4, 0x9C,
+    0x7E, 0x6D, 0x44, 0xD3, 0xC6, 0xAB, 0x69, 0x9D, 0x81, 0x08, 0xFB, 0xFF, 0xAF, 0x85, 0x0F, 0x07,
+    0x35, 0x7F, 0xF0, 0xDC, 0x02, 0x63, 0xC4, 0xCC, 0xAD, 0xBB, 0xEA, 0x6F, 0x0A, 0xB7, 0xF0, 0x85,
+    0x88, 0x09, 0x45, 0x96, 0x60, 0xE4, 0xD0, 0x66, 0x99, 0xC8, 0x7F, 0xEA, 0x0E, 0xB8, 0xE7, 0x0E,
+    0xE3, 0xAE, 0x8C, 0x68, 0x58, 0x02, 0x59, 0xE7, 0xA3, 0x79, 0xC0, 0xDA, 0xED, 0xB6, 0x0B, 0xC8,
+    0xCE, 0x06, 0x7E, 0xFF, 0xB4, 0x1D, 0x0F, 0x94, 0x06, 0x1A, 0xF5, 0xF3, 0xC4, 0x93, 0x40, 0xFB,
+    0xB6, 0x36, 0x19, 0x5A, 0x34, 0x00, 0x1A, 0xD1, 0xFC, 0x17, 0xAE, 0x21, 0x1C, 0x29, 0x14, 0x11,
+    0xFE, 0x2E, 0x24, 0x0C, 0x9D, 0x9D, 0x6F, 0xDC, 0x3E, 0x73, 0xEF, 0xC1, 0xD6, 0x9B, 0x5B, 0xB7,
+    0x6E, 0x1D, 0x9C, 0x93, 0x14, 0x5E, 0x44, 0xAC, 0x38, 0xB2, 0x04, 0x99, 0x6D, 0xAF, 0xCF, 0x6B,
+    0xD5, 0x7A, 0xD4, 0x31, 0x04, 0x8E, 0x51, 0x32, 0xDB, 0x6A, 0x45, 0xC3, 0x12, 0x88, 0x61, 0xEA,
+    0xA6, 0x6D, 0xD6, 0x98, 0x42, 0xCB, 0x80, 0xB5, 0x80, 0xA4, 0xFB, 0x9C, 0xBD, 0xDE, 0x70, 0xA8,
+    0x2E, 0x41, 0xED, 0xFD, 0x0F, 0xDC, 0x05, 0xDC, 0xC7, 0xED, 0xBA, 0x2E, 0x40, 0xF3, 0x46, 0xD4,
+    0xFC, 0x2A, 0x11, 0xAC, 0xAC, 0x20, 0xBE, 0x11, 0xBE, 0x41, 0xCD, 0x1F, 0x36, 0x27, 0x1F, 0xF7,
+    0xD0, 0xEC, 0x37, 0xDC, 0xDC, 0xBE, 0x7D, 0x7B, 0x96, 0x20, 0x32, 0x88, 0xB8, 0x59, 0xB6, 0x2D,
+    0x41, 0xF3, 0xD6, 0xC8, 0x7F, 0xE2, 0x76, 0xB8, 0x17, 0xDC, 0x46, 0x71, 0x34, 0x89, 0x66, 0x60,
+    0xE8, 0xE5, 0xB6, 0xEF, 0x20, 0x30, 0x63, 0xA6, 0x3D, 0x0D, 0xAC, 0xB8, 0x41, 0xA3, 0x0A, 0xEE,
+    0x15, 0xF0, 0x75, 0xA0, 0xD6, 0xDF, 0xD2, 0x1F, 0x68, 0xD9, 0x94, 0xF9, 0x3E, 0xC9, 0x60, 0x1D,
+    0x88, 0x30, 0x8A, 0xF8, 0xFC, 0x5D, 0x88, 0x1F, 0x38, 0x27, 0xDF, 0x18, 0x35, 0x63, 0xE7, 0xDE,
+    0x16, 0x9B, 0x22, 0x29, 0x7C, 0x21, 0xE2, 0x04, 0x10, 0xBE, 0x26, 0x41, 0xC1, 0xF8, 0x91, 0x70,
+    0x7F, 0x74, 0x1B, 0xCC, 0xE3, 0xCC, 0x0E, 0xB4, 0xE4, 0x42, 0x14, 0xC0, 0x12, 0x2A, 0x19, 0x55,
+    0x2B, 0x9E, 0x56, 0xFD, 0xB6, 0x66, 0x00, 0x15, 0xC3, 0x00, 0x99, 0xFB, 0xFA, 0xB5, 0xEC, 0x35,
+    0x85, 0xAC, 0x35, 0x51, 0xA2, 0x94, 0xF2, 0x59, 0xA9, 0x9E, 0x51, 0x83, 0x01, 0x5F, 0x7F, 0x6A,
+    0xFE, 0x88, 0xA9, 0x3B, 0xF7, 0x35, 0xDC, 0x1A, 0x69, 0xE1, 0x0B, 0x51, 0x21, 0x80, 0x60, 0x93,
+    0xA0, 0x43, 0x6B, 0x78, 0x26, 0x8C, 0x84, 0xE7, 0xE3, 0xE1, 0xF0, 0x6E, 0x67, 0x4C, 0x10, 0xC5,
+    0xC6, 0x22, 0xD9, 0x1C, 0x51, 0xAE, 0xA4, 0xE7, 0x49, 0xE0, 0x72, 0x15, 0xD1, 0x4A, 0xF5, 0xF8,
+    0x3C, 0x33, 0xE0, 0xF0, 0xC3, 0xD5, 0x62, 0x17, 0x5C, 0xFD, 0xE6, 0x14, 0x98, 0x37, 0xCC, 0xDC,
+    0xB1, 0xB7, 0xF1, 0xC6, 0x68, 0x08, 0x5F, 0x88, 0x1A, 0x01, 0x04, 0x35, 0x19, 0x77, 0xEC, 0x58,
+    0xAF, 0x25, 0xF2, 0xA7, 0x8F, 0x82, 0xFB, 0xFD, 0x81, 0xF0, 0x7E, 0x5C, 0x8F, 0x46, 0xBA, 0x5C,
+    0x8C, 0x2B, 0x8C, 0x05, 0xAC, 0x1C, 0x1F, 0xF1, 0xC7, 0xE1, 0xBA, 0xE9, 0xB0, 0x91, 0xD0, 0xE7,
+    0xC3, 0xF3, 0xE8, 0x39, 0x7D, 0xE7, 0xCE, 0x94, 0x2D, 0xD1, 0x12, 0xBE, 0x10, 0x1D, 0x33, 0x1C,
+    0xC4, 0xC4, 0x89, 0x13, 0x03, 0x7D, 0xFB, 0x0E, 0xFC, 0xAA, 0x61, 0xC6, 0x2D, 0x39, 0x40, 0xFA,
+    0x41, 0x98, 0x27, 0x0A, 0x10, 0xC8, 0x49, 0x85, 0xE9, 0xAD, 0x42, 0x26, 0x46, 0xB9, 0xF7, 0x20,
+    0x86, 0x90, 0xD6, 0x9B, 0x86, 0x17, 0x8E, 0x94, 0x3D, 0x88, 0xEB, 0xB3, 0x00, 0x49, 0x43, 0xA7,
+    0xC2, 0x39, 0x62, 0xC1, 0x9A, 0x75, 0xA7, 0xB7, 0x64, 0x65, 0x65, 0x85, 0x3D, 0xD5, 0x2B, 0x0E,
+    0x31, 0xAB, 0x72, 0x75, 0x23, 0xF7, 0xE9, 0xD1, 0xA8, 0x2D, 0x0A, 0xC6, 0x0E, 0x83, 0x77, 0xDD,
+    0x20, 0xF8, 0xB7, 0xC8, 0x1A, 0xA4, 0xD3, 0x1A, 0x44, 0x95, 0x94, 0xD1, 0x86, 0xD5, 0x9D, 0x0B,
+    0x57, 0x1E, 0x9C, 0xAD, 0x73, 0xE0, 0x6A, 0x39, 0x1F, 0x49, 0x3F, 0x9B, 0xB3, 0x7C, 0xB5, 0x63,
+    0x7D, 0x8F, 0x1E, 0x3D, 0xD4, 0xC7, 0x18, 0x75, 0xC4, 0xAC, 0xB2, 0xDF, 0x78, 0xE3, 0x8D, 0x40,
+    0xDF, 0x1B, 0x86, 0xE6, 0x36, 0x6C, 0xF6, 0x40, 0x0E, 0x2D, 0x00, 0x2D, 0x82, 0xA7, 0x00, 0xC8,
+    0xAB, 0x8C, 0x80, 0xE7, 0xBB, 0x67, 0x0D, 0x82, 0x81, 0xA4, 0xAD, 0xF5, 0x69, 0x7B, 0xE1, 0xEC,
+    0xB4, 0xC0, 0x88, 0xEF, 0x37, 0x0B, 0x89, 0x8F, 0x7D, 0xB2, 0x78, 0xE9, 0x57, 0x9B, 0x7A, 0xF7,
+    0xEE, 0x7D, 0xC5, 0xDD, 0xBA, 0x65, 0x45, 0xB9, 0xA8, 0x66, 0x59, 0x83, 0xBE, 0x3D, 0x9A, 0x32,
+    0x4B, 0xF8, 0xE3, 0x30, 0xD3, 0xB7, 0x71, 0x28, 0xFC, 0xAB, 0xEA, 0xC1, 0x2C, 0x48, 0x63, 0x44,
+    0x1E, 0x9D, 0x1F, 0xAA, 0x8A, 0x14, 0xBE, 0x16, 0x3C, 0xB3, 0x51, 0x23, 0xF9, 0x24, 0x05, 0x7F,
+    0x18, 0x71, 0x8D, 0xE7, 0x22, 0xE9, 0x91, 0x39, 0x8B, 0x97, 0xAC, 0xDB, 0xD0, 0xAF, 0xDF, 0x7D,
+    0x31, 0x13, 0x7C, 0x21, 0xCA, 0x85, 0xB9, 0x95, 0x35, 0x80, 0xB3, 0xF2, 0xB1, 0x3E, 0x37, 0x3F,
+    0x7D, 0x04, 0x71, 0x75, 0x8F, 0x32, 0x36, 0x38, 0x0F, 0xC3, 0x99, 0x04, 0xF3, 0xAC, 0x03, 0xA6,
+    0x4F, 0xBF, 0xB7, 0x78, 0x75, 0x59, 0x84, 0x6F, 0x04, 0xEF, 0xA1, 0xE0, 0x4F, 0xC0, 0xD9, 0x7C,
+    0x3F, 0x9C, 0xAD, 0x16, 0x21, 0xF9, 0xA7, 0xEF, 0x21, 0xF9, 0xA1, 0x8F, 0xA6, 0xCD, 0x58, 0xB5,
+    0x71, 0xD0, 0xA0, 0xBB, 0xAE, 0xB8, 0x2F, 0x3F, 0x1C, 0x28, 0x77, 0xD5, 0x6A, 0xC5, 0x06, 0x7D,
+    0xB2, 0xDA, 0x20, 0x7F, 0x4A, 0x0F, 0x78, 0x26, 0x77, 0x85, 0xEF, 0x50, 0x67, 0x04, 0xF6, 0xD7,
+    0x01, 0x0A, 0x2A, 0x59, 0x16, 0x41, 0x28, 0x8F, 0x64, 0x08, 0x0A, 0x5D, 0xB0, 0x35, 0x3E, 0xE5,
+    0x2C, 0x8C, 0x7A, 0x47, 0xE0, 0xA8, 0xBE, 0x1A, 0x89, 0x3F, 0x58, 0x8D, 0xA4, 0x3B, 0x96, 0x4F,
+    0x9B, 0xF6, 0xD1, 0x7A, 0x2D, 0xDD, 0x5A, 0x9A, 0xA9, 0x5B, 0x91, 0x46, 0xB9, 0xD5, 0x2B, 0x9B,
+    0x08, 0x9D, 0x5B, 0x19, 0xEE, 0x0F, 0xBA, 0xC1, 0xFD, 0x4E, 0x0F, 0xD3, 0xB7, 0xB7, 0x13, 0x33,
+    0x86, 0x3A, 0x30, 0xF3, 0x5C, 0x80, 0x4F, 0xBF, 0x63, 0xAC, 0x36, 0xBA, 0xD8, 0x96, 0xE0, 0x42,
+    0xA1, 0x7B, 0x0C, 0xC4, 0xE7, 0x9B, 0x8E, 0xEA, 0x14, 0x7E, 0x8D, 0x23, 0x86, 0xB3, 0xDA, 0x1A,
+    0x33, 0xF1, 0xEE, 0xD5, 0x48, 0x18, 0xB8, 0x7C, 0xFE, 0xFC, 0xC9, 0x9B, 0xB4, 0x62, 0x57, 0x28,
+    0x2B, 0x76, 0x44, 0x1B, 0xE5, 0xDE, 0xB0, 0xBE, 0xAB, 0x91, 0xC7, 0x23, 0x6F, 0xCD, 0x84, 0x6F,
+    0x4B, 0x0F, 0x14, 0xBC, 0xDA, 0x0C, 0xEE, 0x95, 0x75, 0x61, 0x9E, 0xCA, 0x04, 0x4E, 0x91, 0x0C,
+    0x67, 0x48, 0x02, 0x7F, 0x62, 0x54, 0xC9, 0x50, 0x54, 0xE8, 0xD0, 0x02, 0xDA, 0x71, 0x34, 0xF3,
+    0xA9, 0x1E, 0x20, 0xF5, 0x08, 0x8C, 0xC4, 0xCD, 0x70, 0x75, 0x3C, 0x42, 0x33, 0xBF, 0x17, 0x71,
+    0x99, 0x4B, 0xA8, 0xF1, 0x1B, 0xB3, 0xB3, 0xB3, 0x7D, 0xE5, 0x51, 0xF0, 0x85, 0x28, 0xF7, 0x04,
+    0x10, 0x34, 0x2D, 0x7D, 0xEC, 0xD8, 0xB1, 0xCE, 0xAE, 0x5D, 0xD3, 0x9D, 0xB7, 0xDC, 0x32, 0x3A,
+    0x03, 0xEE, 0x4F, 0x7B, 0xC1, 0xFD, 0xEF, 0x66, 0xF0, 0xEE, 0xA8, 0x0B, 0x04, 0x9A, 0xC3, 0x3C,
+    0x77, 0x2D, 0x49, 0x41, 0xF7, 0x50, 0xA0, 0xAE, 0x26, 0xC5, 0x0C, 0x5A, 0x2D, 0xFE, 0x42, 0x94,
+    0xB6, 0xA4, 0x97, 0x30, 0xD2, 0xDC, 0x55, 0xC0, 0x7F, 0xBC, 0x40, 0x92, 0x09, 0x23, 0x8D, 0x9A,
+    0x9E, 0x74, 0x90, 0xCF, 0xDF, 0x0A, 0x57, 0xD3, 0xA3, 0x48, 0xB8, 0x6B, 0x8F, 0xE1, 0xE8, 0xFD,
+    0xF9, 0xA4, 0xC9, 0x93, 0xB6, 0xA5, 0xA4, 0xA8, 0x2D, 0x31, 0xD3, 0x5F, 0x9A, 0x69, 0xDA, 0xB1,
+    0xC2, 0x55, 0x41, 0x80, 0x8B, 0x21, 0xAB, 0x00, 0x64, 0xD3, 0x32, 0x3C, 0xD8, 0x04, 0xDE, 0xED,
+    0x3D, 0xE1, 0x7E, 0xBF, 0x9D, 0xE1, 0xFD, 0xA0, 0xB2, 0xE9, 0xCF, 0xA9, 0x44, 0xDF, 0xDB, 0x08,
+    0xA6, 0xBF, 0x11, 0x8C, 0x02, 0x17, 0x33, 0x09, 0x9E, 0xAD, 0xCD, 0x5A, 0x3B, 0x34, 0x8E, 0xC2,
+    0x8B, 0xA7, 0xB5, 0x28, 0xB6, 0xCC, 0x56, 0xA7, 0x8C, 0x61, 0xCD, 0xF8, 0x63, 0xBE, 0xEE, 0x60,
+    0x0D, 0x69, 0x00, 0x20, 0x37, 0x33, 0x89, 0x02, 0x37, 0xF6, 0x22, 0x90, 0xB7, 0xCB, 0x88, 0xAB,
+    0x9F, 0x6F, 0xC6, 0xDF, 0x7C, 0x0E, 0x71, 0x03, 0xB6, 0xC0, 0xD1, 0xFA, 0xF3, 0xF9, 0xFF, 0x18,
+    0xBF, 0xFD, 0x6C, 0x9D, 0x74, 0xF2, 0xE3, 0xEA, 0x10, 0x7A, 0x51, 0x5C, 0x95, 0x04, 0x28, 0x84,
+    0x2C, 0xC3, 0xC4, 0x89, 0x13, 0xE3, 0xD2, 0xD2, 0xCE, 0xC6, 0xE9, 0xB7, 0xF2, 0x47, 0x0D, 0x19,
+    0x50, 0x3B, 0x21, 0x29, 0xBE, 0x17, 0xFC, 0x1B, 0x3A, 0xC0, 0xB7, 0xAA, 0x2A, 0xBC, 0x1B, 0xE9,
+    0x21, 0x76, 0xE8, 0xC4, 0x04, 0x18, 0xD5, 0xF5, 0x83, 0x70, 0xCD, 0xE0, 0xD0, 0x4F, 0x4A, 0x5C,
+    0x4A, 0x46, 0xAA, 0x0A, 0x0A, 0xDC, 0x34, 0xC8, 0x18, 0xF7, 0x0E, 0x04, 0x8E, 0x1E, 0x60, 0x26,
+    0xE2, 0x81, 0x33, 0x83, 0xB9, 0x52, 0x5B, 0x5E, 0xDA, 0xF9, 0x34, 0x9C, 0x1D, 0x37, 0x9C, 0x39,
+    0xE5, 0x5E, 0x3C, 0x7B, 0xFE, 0x9B, 0x39, 0x69, 0xF9, 0x4D, 0xCC, 0xAF, 0xE2, 0x11, 0x48, 0x49,
+    0xC9, 0xF4, 0x5E, 0x6D, 0x42, 0x2F, 0x8A, 0xAB, 0x9A, 0x00, 0x97, 0xC2, 0x2B, 0xAF, 0xBC, 0xE2,
+    0x2A, 0x24, 0x84, 0xBD, 0xE7, 0x28, 0xFA, 0x5F, 0x37, 0xA4, 0x72, 0x8D, 0xFA, 0x9D, 0x7B, 0xC3,
+    0x7F, 0xAA, 0x27, 0x83, 0xC8, 0x9A, 0x4C, 0x33, 0x79, 0x4C, 0x1D, 0xC5, 0x45, 0xA1, 0x30, 0x22,
+    0xD5, 0x64, 0xD4, 0x7E, 0x1C, 0xCE, 0x2A, 0xCB, 0x0E, 0xED, 0x5E, 0xBD, 0x68, 0xD1, 0x8A, 0xF7,
+    0xB4, 0xF0, 0x2C, 0x51, 0x0B, 0x5A, 0x78, 0x59, 0x6B, 0xEF, 0x9E, 0x3D, 0x5B, 0xC7, 0x77, 0x35,
+    0x0B, 0xFC, 0x62, 0x7C, 0xE7, 0x08, 0x70, 0x39, 0xA8, 0x37, 0x92, 0x1F, 0xDC, 0x4E, 0x14, 0xDB,
+    0xF6, 0x51, 0xA9, 0x52, 0xB2, 0x79, 0xE6, 0x4C, 0xBC, 0x77, 0xCB, 0x96, 0x2D, 0xEE, 0xF2, 0x1C,
+    0xBC, 0x55, 0xA0, 0x02, 0x15, 0xA8, 0x40, 0x05, 0x2A, 0x50, 0x81, 0x0A, 0x54, 0xA0, 0x02, 0x15,
+    0xA8, 0x40, 0x05, 0x2A, 0x50, 0x81, 0x0A, 0x54, 0xA0, 0x02, 0xA5, 0x00, 0xF0, 0x7F, 0x85, 0xBB,
+    0x11, 0x1B, 0x39, 0xEA, 0x9B, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
+    0x60, 0x82,
+};
+
+// Settings.svg: 3119 bytes, 1546 bytes gzipped
+static const char Settings_svg_Path[] PROGMEM = "/Settings.svg";
+static const char Settings_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Settings_svg_ETag[] PROGMEM = "\"d3fcd6b67580bb45\"";
+static const uint8_t Settings_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x56, 0xDB, 0x6E, 0xDB, 0x46,
+    0x10, 0x7D, 0xB6, 0xBF, 0x82, 0x65, 0x5F, 0x97, 0xD4, 0xDE, 0x2F, 0x81, 0xE5, 0x00, 0x71, 0xDA,
+    0xA4, 0x40, 0xD2, 0x06, 0x75, 0xE2, 0xA2, 0x4F, 0x85, 0x42, 0x2B, 0x96, 0x10, 0x46, 0x12, 0x24,
+    0x45, 0x76, 0xF3, 0xF5, 0x3D, 0x67, 0x48, 0xF9, 0x92, 0x26, 0x8E, 0xE9, 0x59, 0xEE, 0x70, 0x2E,
+    0x67, 0xCE, 0xCC, 0xEE, 0xD9, 0xF3, 0xBB, 0x2F, 0x7D, 0x75, 0x98, 0x6F, 0x77, 0xCB, 0xF5, 0x6A,
+    0x5A, 0x9B, 0x56, 0xD7, 0xD5, 0x7C, 0xD5, 0xAD, 0xAF, 0x97, 0xAB, 0x9B, 0x69, 0xFD, 0x75, 0xFF,
+    0xA9, 0xC9, 0xF5, 0xF3, 0xF3, 0xD3, 0xD3, 0xB3, 0x9F, 0x5E, 0xFE, 0x71, 0xF1, 0xFE, 0xEF, 0x77,
+    0xBF, 0x54, 0xBB, 0xC3, 0x4D, 0xF5, 0xEE, 0xC3, 0x8B, 0x37, 0xBF, 0x5D, 0x54, 0x75, 0x33, 0x99,
+    0xFC, 0xE5, 0x2E, 0x26, 0x93, 0x97, 0xEF, 0x5F, 0x56, 0x97, 0x57, 0xAF, 0x2A, 0xD3, 0x9A, 0xC9,
+    0xE4, 0x97, 0xDF, 0xEB, 0xAA, 0x5E, 0xEC, 0xF7, 0x9B, 0x67, 0x93, 0xC9, 0xED, 0xED, 0x6D, 0x7B,
+    0xEB, 0xDA, 0xF5, 0xF6, 0x66, 0xF2, 0x6A, 0x3B, 0xDB, 0x2C, 0x96, 0xDD, 0x6E, 0x02, 0xC5, 0x09,
+    0x15, 0xF1, 0xD1, 0x04, 0xC6, 0x8C, 0x69, 0xAF, 0xF7, 0xD7, 0xF5, 0x39, 0x5C, 0x34, 0x4D, 0xF5,
+    0x61, 0xD3, 0xAF, 0x67, 0xD7, 0xF3, 0xEB, 0x6A, 0xBF, 0x7E, 0x26, 0x26, 0xFF, 0x9C, 0x6F, 0xD6,
+    0xAA, 0xA2, 0x1D, 0xE8, 0x6E, 0xB1, 0x68, 0xBB, 0xF5, 0x17, 0x55, 0xBD, 0x9A, 0xAF, 0xE6, 0xDB,
+    0xD9, 0x7E, 0xBD, 0x7D, 0xD0, 0xAA, 0xDE, 0x2E, 0xEF, 0xE6, 0xDB, 0xEA, 0xFD, 0x7A, 0xDD, 0xEF,
+    0xAA, 0xA6, 0x81, 0x41, 0x86, 0xFA, 0x69, 0xD9, 0xF7, 0xD3, 0xFA, 0xE7, 0x5F, 0xE5, 0x5F, 0xFD,
+    0x38, 0x53, 0x53, 0x57, 0xCB, 0xEB, 0x69, 0xFD, 0x66, 0xF6, 0xEF, 0x7C, 0xFB, 0x0F, 0x16, 0x00,
+    0x62, 0xB5, 0x9B, 0xFE, 0x20, 0x72, 0xAB, 0xB5, 0x66, 0xA4, 0xA3, 0xCA, 0xB3, 0xBB, 0x7E, 0xB9,
+    0xFA, 0xFC, 0x23, 0x45, 0x53, 0x4A, 0x99, 0xC8, 0x6E, 0x5D, 0x9D, 0x9E, 0x54, 0xB7, 0xCB, 0xEB,
+    0xFD, 0x62, 0x5A, 0x67, 0xAD, 0x37, 0x77, 0x75, 0xB5, 0x98, 0x2F, 0x6F, 0x16, 0xFB, 0xFB, 0xE5,
+    0x61, 0x39, 0xBF, 0x7D, 0xB1, 0xBE, 0x9B, 0xD6, 0xBA, 0xD2, 0x55, 0xE2, 0x7F, 0x02, 0x3F, 0xFB,
+    0xD8, 0xCF, 0x9B, 0x8F, 0xB3, 0xEE, 0xF3, 0xCD, 0x76, 0xFD, 0x75, 0x85, 0xE8, 0x56, 0xF3, 0xDB,
+    0xEA, 0x91, 0x06, 0x02, 0x78, 0xB6, 0xDB, 0xCC, 0xBA, 0xF9, 0xB4, 0xDE, 0x6C, 0xE7, 0xBB, 0xF9,
+    0xF6, 0x30, 0x27, 0x72, 0x37, 0xE7, 0xA7, 0x27, 0x67, 0x9B, 0xD9, 0x7E, 0x51, 0xE1, 0x93, 0xB7,
+    0x2E, 0xB4, 0x2E, 0x26, 0x65, 0x63, 0xEB, 0x6D, 0xEE, 0x1A, 0xDF, 0xC6, 0x9C, 0x94, 0x6E, 0x72,
+    0x1B, 0x94, 0x6B, 0xB3, 0x71, 0x22, 0xE1, 0x77, 0x27, 0x2B, 0x35, 0xAE, 0xE4, 0x0D, 0x7E, 0x9B,
+    0xFB, 0xB7, 0xD4, 0xBB, 0xF4, 0xBA, 0xD5, 0xC1, 0x8F, 0xC6, 0xD4, 0x13, 0xD3, 0xDF, 0x4E, 0x4F,
+    0x4E, 0xAA, 0xA3, 0x37, 0x6F, 0x06, 0x6F, 0xAE, 0x0D, 0x05, 0xCE, 0x22, 0x3E, 0xB7, 0x6D, 0x31,
+    0x22, 0xE0, 0x77, 0x77, 0x5C, 0xA8, 0xE3, 0x0B, 0xCA, 0x7C, 0xA9, 0xC6, 0x97, 0x97, 0x2E, 0xB7,
+    0x25, 0x1C, 0x0D, 0xA9, 0x27, 0x66, 0xBF, 0xD5, 0x93, 0x27, 0x19, 0x7A, 0x87, 0x0F, 0x11, 0x86,
+    0x69, 0x4B, 0x81, 0x4F, 0xDD, 0xFA, 0x68, 0xF0, 0x74, 0x3A, 0x36, 0x60, 0x70, 0xB6, 0x90, 0x4D,
+    0x86, 0xE8, 0x72, 0x54, 0xBA, 0xB5, 0xD9, 0x76, 0xB2, 0x1B, 0x14, 0x35, 0xB9, 0x99, 0x8A, 0xA2,
+    0xE2, 0xB0, 0xA9, 0x44, 0x11, 0xC9, 0x74, 0xAE, 0xC5, 0x86, 0x6D, 0x83, 0x61, 0x54, 0x4C, 0x3B,
+    0xB6, 0xC9, 0x1E, 0x65, 0x10, 0xD5, 0x46, 0xDB, 0x69, 0x7C, 0x14, 0x82, 0xA3, 0x29, 0x9F, 0x94,
+    0xE1, 0xCF, 0x8E, 0xCE, 0x65, 0xD5, 0x98, 0x8B, 0xA0, 0xDB, 0x4C, 0x88, 0x4A, 0x9B, 0x8C, 0x57,
+    0x3E, 0xB7, 0x16, 0x0B, 0xDF, 0xE6, 0x6C, 0xD4, 0x93, 0xB0, 0xBF, 0xCF, 0xE9, 0x08, 0xED, 0x80,
+    0xA3, 0x6E, 0x8B, 0x57, 0x1A, 0x91, 0x65, 0x06, 0xA9, 0x4B, 0x46, 0x58, 0xA9, 0x04, 0x09, 0xB8,
+    0x60, 0x57, 0xC7, 0xC2, 0xF7, 0x86, 0x6F, 0x8C, 0x13, 0x1D, 0x04, 0x8A, 0x5D, 0x1D, 0x07, 0xB9,
+    0x63, 0xAA, 0x88, 0x12, 0xAB, 0x9C, 0x0A, 0xD3, 0xB7, 0x8C, 0xB9, 0xA4, 0x0C, 0x19, 0x96, 0x98,
+    0x2E, 0x3E, 0x05, 0x1B, 0x90, 0x8E, 0xC7, 0xC3, 0x3A, 0x4B, 0xF0, 0x12, 0xB7, 0x93, 0x83, 0x68,
+    0xB2, 0xEF, 0xF8, 0xC6, 0xF3, 0x6B, 0x6B, 0x0D, 0xEA, 0x69, 0x2C, 0xB7, 0x1D, 0x34, 0x1D, 0x3C,
+    0x85, 0x41, 0x26, 0xB6, 0x02, 0x48, 0x63, 0x06, 0x50, 0xF0, 0xD7, 0x5C, 0x3A, 0xA4, 0x8C, 0xFC,
+    0xED, 0x93, 0x6A, 0xDA, 0x1F, 0x56, 0x33, 0xFA, 0xD6, 0x1A, 0xE0, 0x9E, 0xDA, 0x90, 0xDD, 0x02,
+    0xE4, 0xB0, 0x31, 0x0E, 0x45, 0x45, 0x0D, 0x19, 0x08, 0x3C, 0x87, 0xC0, 0xD2, 0x66, 0x94, 0xD6,
+    0xB7, 0x5A, 0x9B, 0xDE, 0xC2, 0x90, 0x67, 0x44, 0xC1, 0x74, 0xA6, 0x0D, 0x91, 0x01, 0xE3, 0xA9,
+    0x06, 0x19, 0x38, 0x07, 0xC1, 0x44, 0x9B, 0x26, 0xB4, 0xC1, 0x9A, 0x9E, 0xAC, 0x2E, 0x91, 0x4F,
+    0x9B, 0x98, 0x3A, 0xB3, 0x0C, 0xC3, 0xC3, 0xB4, 0x89, 0x8E, 0x00, 0x63, 0x81, 0xC1, 0x6C, 0xCB,
+    0x20, 0xEF, 0xB0, 0xD0, 0x89, 0x28, 0xFB, 0xE3, 0x86, 0x22, 0x28, 0xA5, 0xC7, 0x22, 0xB2, 0x8C,
+    0xD8, 0x10, 0x84, 0xBC, 0x17, 0x4B, 0x99, 0x7E, 0x93, 0x27, 0x8A, 0x1E, 0xD8, 0xF8, 0x51, 0xCE,
+    0xC9, 0x5F, 0x25, 0xA6, 0x2D, 0x88, 0xE3, 0x5B, 0xAB, 0x8B, 0xA8, 0x18, 0xA8, 0x64, 0xCF, 0x7E,
+    0x8B, 0xA3, 0xC8, 0xDC, 0x83, 0x06, 0xA1, 0x45, 0x09, 0x80, 0x3A, 0x66, 0x0C, 0xAF, 0xD1, 0xC5,
+    0x51, 0x76, 0xD4, 0x3B, 0x8C, 0x10, 0x59, 0xE1, 0x33, 0x83, 0x8B, 0x41, 0x82, 0x83, 0x19, 0xA3,
+    0xBD, 0xB0, 0xC6, 0xF5, 0x62, 0x85, 0x5D, 0xE8, 0x6D, 0xFC, 0x5F, 0xCA, 0x31, 0x24, 0xA6, 0x99,
+    0x2C, 0xF6, 0x93, 0xF4, 0x0A, 0x64, 0x29, 0x77, 0x44, 0x15, 0x99, 0xBA, 0xD0, 0xC5, 0x5B, 0x51,
+    0x48, 0xB4, 0x09, 0x05, 0x81, 0x31, 0x66, 0x25, 0x60, 0x76, 0x4F, 0x20, 0xC7, 0xD3, 0x67, 0x85,
+    0xE2, 0x08, 0x49, 0x49, 0xCC, 0x40, 0x27, 0x70, 0xCC, 0x5A, 0x39, 0xC3, 0xA0, 0x92, 0xF4, 0x6A,
+    0x92, 0x94, 0x08, 0x1A, 0x51, 0x48, 0x30, 0xC6, 0x32, 0x71, 0x3B, 0x28, 0x29, 0xEE, 0xEB, 0x48,
+    0x3E, 0x3C, 0x46, 0x01, 0xF9, 0xAB, 0xA1, 0xFA, 0x83, 0x4C, 0x37, 0xE6, 0x40, 0xB0, 0x12, 0xFA,
+    0x71, 0xD0, 0x63, 0x9E, 0x34, 0xE6, 0xB5, 0xC5, 0x3E, 0xB5, 0x44, 0x46, 0x00, 0x8B, 0x00, 0xB8,
+    0x82, 0x34, 0x44, 0x61, 0xBB, 0x02, 0x23, 0x33, 0x2A, 0x0A, 0x52, 0x8A, 0xE0, 0xC7, 0x5E, 0x90,
+    0xF2, 0x6C, 0xFF, 0xE4, 0x1F, 0xE7, 0x66, 0x46, 0x19, 0xD8, 0x46, 0xB6, 0x02, 0x22, 0x44, 0x6E,
+    0xC9, 0x99, 0x5E, 0x60, 0x80, 0xA5, 0xE2, 0xDC, 0xD0, 0x4E, 0x89, 0xB9, 0xE3, 0x21, 0x94, 0xA2,
+    0xA3, 0x62, 0xD5, 0x3D, 0x73, 0x8A, 0xDD, 0x09, 0xA3, 0xC8, 0x6C, 0x76, 0xC6, 0x91, 0x6A, 0xD1,
+    0xF7, 0x18, 0x08, 0xD9, 0x8B, 0xFF, 0x4E, 0x90, 0x51, 0x42, 0x27, 0xA8, 0x0C, 0xD5, 0xF4, 0x86,
+    0xC8, 0x1E, 0x2B, 0x9B, 0x0E, 0xCC, 0x47, 0x4A, 0xFA, 0x90, 0x7B, 0x4C, 0x0E, 0x81, 0x98, 0x40,
+    0x08, 0x07, 0x9E, 0x40, 0x46, 0xE2, 0xA4, 0xD3, 0x88, 0xA3, 0x12, 0xA2, 0x71, 0xB0, 0xC4, 0x41,
+    0x14, 0x9D, 0x43, 0x23, 0xD6, 0x3A, 0x19, 0x61, 0xC0, 0x07, 0x8D, 0x5D, 0x84, 0x1A, 0xEA, 0x9E,
+    0xC0, 0xE0, 0x12, 0x40, 0xB1, 0xEA, 0x9E, 0x49, 0x8F, 0x13, 0xCD, 0xE8, 0x04, 0xE1, 0x06, 0x13,
+    0x92, 0xB1, 0x4A, 0x22, 0x8D, 0x3C, 0x92, 0x0C, 0xC4, 0xB2, 0x95, 0xFD, 0x60, 0x07, 0xA2, 0x01,
+    0xB9, 0x82, 0x2E, 0x18, 0x68, 0x44, 0x74, 0xED, 0x23, 0xBC, 0x63, 0x73, 0xCF, 0x22, 0xED, 0x1B,
+    0xB2, 0x88, 0x4E, 0xA5, 0x3C, 0x86, 0x5C, 0x4F, 0xD6, 0x77, 0xC2, 0x22, 0x69, 0x3D, 0x27, 0xF8,
+    0x48, 0x7B, 0xF8, 0x81, 0x24, 0x41, 0x9A, 0x29, 0x8E, 0x55, 0x7F, 0x48, 0xDE, 0x45, 0x4F, 0xEF,
+    0xC5, 0x8D, 0xB2, 0x30, 0x80, 0xE9, 0x83, 0x45, 0x70, 0x70, 0x11, 0x23, 0xE7, 0x8F, 0x72, 0xC4,
+    0x01, 0x27, 0xD2, 0x70, 0xE0, 0x0D, 0x43, 0x49, 0x3D, 0x19, 0x51, 0xDF, 0xAA, 0xB7, 0xD1, 0x0E,
+    0xBA, 0xE3, 0xC8, 0x4A, 0x70, 0x68, 0x64, 0x64, 0xA1, 0x00, 0xEC, 0x85, 0xC4, 0x43, 0x23, 0x26,
+    0x3A, 0x49, 0x90, 0x0B, 0x5C, 0xF9, 0x1E, 0xAC, 0x2C, 0x52, 0x1F, 0xEF, 0xC7, 0x79, 0x44, 0xEE,
+    0x24, 0x2B, 0xD9, 0xE1, 0x75, 0xE1, 0x51, 0x1D, 0x0D, 0x89, 0x9F, 0x1C, 0xF1, 0xD2, 0xC0, 0x05,
+    0xBD, 0x50, 0x58, 0x15, 0x87, 0x21, 0x5D, 0x46, 0x39, 0x9B, 0x43, 0x02, 0xC3, 0x2D, 0xE6, 0xC5,
+    0xA1, 0x11, 0x09, 0xE7, 0xEE, 0xE0, 0x1D, 0xE9, 0x94, 0x21, 0x00, 0x9C, 0xDE, 0x51, 0x46, 0x21,
+    0x02, 0xA0, 0x79, 0x2F, 0xED, 0x15, 0x4B, 0x7A, 0x63, 0xE8, 0x46, 0x05, 0x92, 0x8E, 0xAE, 0x3D,
+    0x27, 0x82, 0xC7, 0x91, 0xE4, 0xE8, 0x19, 0x75, 0x13, 0xFF, 0x9C, 0xF0, 0x11, 0xDE, 0x11, 0x38,
+    0x6D, 0x98, 0xD0, 0x48, 0x12, 0xAF, 0x05, 0xA4, 0x43, 0x13, 0x17, 0x05, 0x87, 0x87, 0xED, 0x06,
+    0xA7, 0x2C, 0x42, 0xE2, 0xA8, 0xCD, 0xD2, 0x82, 0x49, 0xBC, 0x87, 0x48, 0xB7, 0x48, 0x99, 0xCE,
+    0xAD, 0xED, 0x8F, 0x13, 0x38, 0xC5, 0xC1, 0xAB, 0xC5, 0x99, 0x0A, 0xDF, 0x31, 0x75, 0x92, 0xAF,
+    0xF8, 0xB6, 0x9C, 0x1A, 0x12, 0xB5, 0xF5, 0x45, 0xDD, 0x67, 0xA0, 0xFD, 0x95, 0xF8, 0x5D, 0xC4,
+    0x43, 0xC1, 0x41, 0x66, 0x3A, 0x99, 0x4D, 0x41, 0xEE, 0x0D, 0x31, 0x8A, 0x73, 0x75, 0x04, 0x87,
+    0xE9, 0xC2, 0x6C, 0xB1, 0xE2, 0x3C, 0x91, 0x6A, 0x3E, 0x0C, 0x13, 0x6B, 0x04, 0x9A, 0xBD, 0x82,
+    0x76, 0xF2, 0xEC, 0x0C, 0xD2, 0x74, 0x80, 0x1B, 0x10, 0x7B, 0x36, 0x76, 0x60, 0x55, 0x12, 0x6A,
+    0xC3, 0x0C, 0x16, 0x52, 0xD9, 0xAB, 0xA1, 0xCE, 0xDF, 0x9F, 0x5B, 0x36, 0x23, 0x2F, 0xF4, 0x09,
+    0x42, 0xC6, 0x99, 0xCC, 0x38, 0x49, 0x4F, 0x5C, 0x1E, 0x1A, 0xB9, 0x30, 0x34, 0x72, 0x79, 0x18,
+    0xE5, 0xE3, 0xE5, 0x61, 0x38, 0x2B, 0x9B, 0xF1, 0x9C, 0xE4, 0xCF, 0xEE, 0xF1, 0xB1, 0x89, 0x8E,
+    0x06, 0x6D, 0x65, 0x3A, 0x04, 0x9C, 0xF9, 0x06, 0x3D, 0x80, 0x6B, 0x45, 0xC4, 0x71, 0xA6, 0x0C,
+    0x2E, 0x4B, 0xE3, 0x98, 0x41, 0xCB, 0xF1, 0xE8, 0xE6, 0xF8, 0x77, 0x6C, 0x33, 0xCC, 0x90, 0x28,
+    0xB7, 0x92, 0x51, 0xEE, 0x78, 0xDA, 0x7B, 0x39, 0xFB, 0xA3, 0xA7, 0x33, 0x13, 0xF8, 0x45, 0x76,
+    0x41, 0x1C, 0xE7, 0x0B, 0x5C, 0x4E, 0x34, 0x6E, 0x3F, 0x1E, 0x1C, 0xC5, 0xA0, 0x46, 0x1E, 0x1C,
+    0x19, 0xC8, 0xA3, 0x14, 0x59, 0x3D, 0x64, 0x25, 0x29, 0x9F, 0x4D, 0x6E, 0xF8, 0xC0, 0x0D, 0xF8,
+    0xFC, 0x3F, 0x3D, 0x3D, 0xE7, 0xA3, 0x2F, 0x0C, 0x00, 0x00,
+};
+
+// Upload.svg: 1184 bytes, 605 bytes gzipped
+static const char Upload_svg_Path[] PROGMEM = "/Upload.svg";
+static const char Upload_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Upload_svg_ETag[] PROGMEM = "\"b159a9612bc4888c\"";
+static const uint8_t Upload_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5D, 0x53, 0xCB, 0x6E, 0xDB, 0x30,
+    0x10, 0xBC, 0xF7, 0x2B, 0xB6, 0xEC, 0x35, 0xA6, 0xB9, 0x24, 0xC5, 0x47, 0x10, 0x25, 0x40, 0x05,
+    0xB4, 0x3E, 0x38, 0x97, 0x3E, 0x7C, 0xC8, 0x2D, 0x88, 0x14, 0x5B, 0x80, 0x62, 0x19, 0xB2, 0x62,
+    0xFB, 0xF3, 0xBB, 0x4B, 0xEB, 0x61, 0xD4, 0x30, 0xC8, 0x1D, 0x6A, 0x76, 0x67, 0x76, 0x45, 0x3D,
+    0x3C, 0x5D, 0x3E, 0x1A, 0x38, 0x55, 0xDD, 0xB1, 0x6E, 0xF7, 0xB9, 0x40, 0xA9, 0x04, 0x54, 0xFB,
+    0xB7, 0xB6, 0xAC, 0xF7, 0xDB, 0x5C, 0x7C, 0xF6, 0xEF, 0x8B, 0x20, 0x9E, 0x1E, 0x1F, 0xBE, 0x2E,
+    0x16, 0xF0, 0xF7, 0xD0, 0xB4, 0xAF, 0x65, 0x55, 0x42, 0xDF, 0xDE, 0xC3, 0xEF, 0xCD, 0x4F, 0xF8,
+    0x55, 0x1D, 0xDA, 0x3B, 0x38, 0x9F, 0xCF, 0xF2, 0x78, 0xDA, 0x76, 0x04, 0xE4, 0x5B, 0xFB, 0x71,
+    0x07, 0x3F, 0xAB, 0x7D, 0xD5, 0xBD, 0xF6, 0x6D, 0x37, 0xB3, 0xE0, 0xB9, 0xBE, 0x54, 0x1D, 0xFC,
+    0x69, 0xDB, 0xE6, 0x08, 0x8B, 0xC5, 0xE3, 0x97, 0x07, 0xCA, 0x80, 0x73, 0x5D, 0xF6, 0xBB, 0x5C,
+    0x04, 0xA5, 0x0E, 0x17, 0x01, 0xBB, 0xAA, 0xDE, 0xEE, 0xFA, 0x09, 0x9E, 0xEA, 0xEA, 0xFC, 0xBD,
+    0xBD, 0xE4, 0x42, 0x81, 0x02, 0x6D, 0xE9, 0x2F, 0xE0, 0xBD, 0x6E, 0x9A, 0x5C, 0x7C, 0xFB, 0x91,
+    0x7E, 0x02, 0xC8, 0xF9, 0xFE, 0x98, 0x8B, 0x5D, 0xDF, 0x1F, 0xEE, 0x97, 0x4B, 0xF6, 0x71, 0x36,
+    0xB2, 0xED, 0xB6, 0x4B, 0xAD, 0x94, 0x5A, 0x92, 0x82, 0x20, 0xA1, 0xC3, 0x6B, 0xBF, 0x4B, 0x89,
+    0x8B, 0xEE, 0xB3, 0xA9, 0x72, 0x51, 0x9D, 0xAA, 0x7D, 0x5B, 0x96, 0x02, 0xDE, 0x9A, 0xFA, 0xF0,
+    0xFF, 0x59, 0x99, 0x8B, 0xE7, 0x00, 0xA8, 0x8A, 0x00, 0x5E, 0xFA, 0xA8, 0x82, 0x83, 0x38, 0xEC,
+    0x0E, 0x50, 0x83, 0x2B, 0xD0, 0x4A, 0xAD, 0x22, 0x32, 0x74, 0x13, 0x87, 0x42, 0x54, 0x1B, 0xC4,
+    0x15, 0xFA, 0x02, 0x83, 0x8C, 0xC6, 0x00, 0x22, 0x68, 0x25, 0x33, 0x4A, 0x92, 0x99, 0xF3, 0x43,
+    0x6C, 0x65, 0x56, 0x5C, 0x23, 0x27, 0x2D, 0x93, 0x06, 0x2E, 0x49, 0x7A, 0x5A, 0x57, 0x48, 0xF5,
+    0x33, 0x69, 0xAD, 0xF7, 0xE9, 0x2C, 0x63, 0xC2, 0x15, 0x51, 0x18, 0x8B, 0xB4, 0xCA, 0x2C, 0xD3,
+    0x94, 0x32, 0xD0, 0xB4, 0x62, 0x71, 0xAD, 0x58, 0x99, 0x2A, 0x2B, 0xE3, 0x19, 0x81, 0xD6, 0x2C,
+    0xE2, 0x65, 0x96, 0xB0, 0x9E, 0xB4, 0x53, 0x84, 0xD2, 0xFB, 0x68, 0x92, 0x25, 0x6D, 0x33, 0x6A,
+    0x30, 0xC3, 0x18, 0x3D, 0xD3, 0xA3, 0x8E, 0xDC, 0xB0, 0xF2, 0x41, 0xDB, 0x82, 0xB0, 0x0D, 0x8E,
+    0x7A, 0xA6, 0x86, 0x35, 0x26, 0x49, 0x1A, 0xAB, 0x01, 0xCB, 0x83, 0xB0, 0x05, 0x59, 0xA7, 0x2C,
+    0x4B, 0xD0, 0x51, 0x01, 0x13, 0x70, 0x22, 0x3A, 0x2A, 0xA0, 0xCC, 0x5C, 0xC8, 0x48, 0xEB, 0xB3,
+    0x0C, 0x67, 0xA1, 0x1B, 0x13, 0x38, 0x5A, 0xC3, 0x1B, 0xC3, 0x46, 0x46, 0xA7, 0x2D, 0x3B, 0x04,
+    0xEE, 0x70, 0x15, 0x48, 0x8C, 0xBA, 0xD6, 0x81, 0x4F, 0xE2, 0x34, 0x03, 0x8E, 0x8A, 0x38, 0xCD,
+    0x68, 0xE4, 0xD0, 0xE4, 0x78, 0x59, 0xF9, 0x82, 0x0C, 0xBB, 0x34, 0x49, 0x33, 0x8F, 0xDC, 0x8C,
+    0x82, 0x66, 0x7E, 0x39, 0x03, 0x0F, 0x81, 0x97, 0x55, 0xD8, 0xA0, 0x7A, 0x79, 0xA6, 0x6E, 0xBD,
+    0xF2, 0x08, 0x68, 0xA4, 0xA6, 0xB1, 0xAC, 0x89, 0x7A, 0xC5, 0x2A, 0xE1, 0x82, 0xB0, 0x41, 0xC7,
+    0x4D, 0x46, 0xA5, 0x0D, 0x27, 0x4A, 0x17, 0x8C, 0xBD, 0xC5, 0xCC, 0x1B, 0xF9, 0xEB, 0xC0, 0x5B,
+    0x88, 0x63, 0xBD, 0xC2, 0x8F, 0x3C, 0x73, 0xCD, 0x9B, 0xB0, 0xBD, 0xD6, 0x9D, 0xF8, 0x36, 0xE9,
+    0xD2, 0x04, 0x98, 0xA6, 0xD3, 0x5B, 0x88, 0x9E, 0x75, 0x89, 0x96, 0x85, 0x1B, 0xCC, 0x34, 0x1C,
+    0xF9, 0x6B, 0x4C, 0xD6, 0x2D, 0x5A, 0xBD, 0xE1, 0x9B, 0x83, 0xF3, 0xCD, 0xC1, 0xF9, 0xE6, 0x68,
+    0x5A, 0xB9, 0x93, 0xF4, 0x80, 0x0F, 0xCC, 0x4C, 0xE3, 0x70, 0x33, 0x94, 0x58, 0xF3, 0xAD, 0x4F,
+    0xDD, 0x0C, 0x6E, 0x68, 0x4F, 0xAE, 0x47, 0x75, 0xDA, 0x93, 0xEB, 0x1B, 0x7C, 0x9D, 0xD6, 0xC8,
+    0x77, 0xC3, 0xF9, 0xD0, 0xDD, 0x84, 0xCD, 0x54, 0xE7, 0x76, 0xDA, 0x2F, 0x62, 0x49, 0x5F, 0x2E,
+    0x7F, 0xC1, 0x8F, 0xFF, 0x00, 0xAD, 0x8D, 0x35, 0x6E, 0xA0, 0x04, 0x00, 0x00,
+};
+
+// styles.css: 3134 bytes, 976 bytes gzipped
+static const char styles_css_Path[] PROGMEM = "/styles.css";
+static const char styles_css_ContentType[] PROGMEM = "text/css";
+static const char styles_css_ETag[] PROGMEM = "\"d364bf18389d0fc7\"";
+static const uint8_t styles_css_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x56, 0xDB, 0x8E, 0xDB, 0x36,
+    0x10, 0x7D, 0x5E, 0x7F, 0x05, 0x81, 0xA0, 0xC0, 0x6E, 0x10, 0x29, 0xF6, 0x06, 0xDB, 0x04, 0xF6,
+    0x4B, 0xD1, 0x87, 0x3E, 0x14, 0x7D, 0xCB, 0x17, 0x8C, 0x44, 0x5A, 0x22, 0x42, 0x91, 0x02, 0x49,
+    0xAD, 0xED, 0x14, 0xF9, 0xF7, 0x0E, 0x6F, 0xBA, 0x5B, 0x46, 0x77, 0xB1, 0x0B, 0x69, 0xC8, 0x39,
+    0x9C, 0xCB, 0x99, 0x43, 0xD5, 0xB6, 0x11, 0x64, 0xF7, 0xEF, 0x8E, 0xE0, 0x4F, 0x01, 0xE5, 0x8F,
+    0x4A, 0xAB, 0x4E, 0xD2, 0xAC, 0x54, 0x42, 0xE9, 0x23, 0x11, 0xBC, 0xAA, 0x6D, 0xA5, 0x19, 0x93,
+    0x27, 0xBF, 0xE3, 0xAC, 0xA4, 0xCD, 0xCE, 0xD0, 0x70, 0x71, 0x3B, 0x12, 0x03, 0xD2, 0x64, 0x86,
+    0x69, 0x7E, 0x3E, 0xED, 0x7E, 0xED, 0x76, 0x35, 0x03, 0xCA, 0x74, 0xC2, 0xF2, 0x3B, 0x0D, 0xFF,
+    0xC9, 0x8E, 0xE4, 0x95, 0x35, 0x23, 0xEF, 0x0B, 0x73, 0x98, 0x47, 0x52, 0x28, 0x41, 0x4F, 0x77,
+    0x8E, 0xA5, 0xA0, 0x7F, 0x14, 0xA2, 0x63, 0x61, 0x3D, 0x1A, 0x2F, 0x35, 0xB7, 0xD1, 0xD2, 0x02,
+    0xA5, 0x5C, 0x56, 0x47, 0xB2, 0xCF, 0x5F, 0xDF, 0x12, 0x7A, 0x03, 0xBA, 0xE2, 0x32, 0x2B, 0x94,
+    0xB5, 0xAA, 0x71, 0x4B, 0x7E, 0x65, 0x08, 0x2C, 0x57, 0x2D, 0x93, 0x85, 0x95, 0x31, 0xC0, 0xD1,
+    0x51, 0x95, 0x86, 0x5B, 0xC0, 0xB0, 0xEC, 0x6A, 0x33, 0xCA, 0x4A, 0xA5, 0xC1, 0x72, 0x25, 0x8F,
+    0x44, 0x2A, 0x39, 0x3D, 0x33, 0xD3, 0x21, 0xFC, 0x25, 0xBC, 0x50, 0x95, 0xEA, 0xB1, 0xA5, 0x65,
+    0x12, 0x77, 0x75, 0x5A, 0x3C, 0xFF, 0x83, 0xF6, 0xBC, 0x95, 0xD5, 0x4B, 0xC0, 0xA9, 0x63, 0xFE,
+    0x87, 0x51, 0xE8, 0x67, 0xA1, 0x00, 0x4D, 0x1E, 0xDA, 0x63, 0x4A, 0x78, 0x5F, 0xD6, 0xF1, 0x90,
+    0xF7, 0x0E, 0x3D, 0xC8, 0x7E, 0xFF, 0x5B, 0xB0, 0x5C, 0x38, 0xB5, 0x35, 0x86, 0x75, 0x22, 0x9F,
+    0x3F, 0x92, 0xEF, 0x16, 0xB4, 0x25, 0x35, 0xA7, 0x14, 0x1B, 0x47, 0xCA, 0x1A, 0x64, 0xC5, 0x28,
+    0x29, 0x6E, 0xE4, 0x6F, 0x78, 0x87, 0xEF, 0xA5, 0xE6, 0xAD, 0x25, 0x1F, 0x3F, 0x87, 0xB4, 0x94,
+    0xE1, 0x21, 0xD5, 0x33, 0xBF, 0xB2, 0xD8, 0x91, 0x9F, 0x19, 0x97, 0x94, 0x5D, 0x11, 0x3F, 0x96,
+    0x45, 0xB5, 0x0E, 0xDA, 0x3F, 0x0B, 0x76, 0xB6, 0xFD, 0xCB, 0xB2, 0x75, 0x85, 0x40, 0x53, 0x58,
+    0x54, 0xEF, 0x4C, 0x63, 0x66, 0x97, 0x0C, 0x81, 0x62, 0x2C, 0x93, 0x4A, 0x7A, 0xD4, 0x9E, 0x1C,
+    0x56, 0x23, 0x9D, 0x62, 0x28, 0x58, 0x5C, 0xE3, 0xEA, 0x40, 0x88, 0xAB, 0x04, 0xC9, 0x4B, 0xA1,
+    0x0C, 0x1B, 0x5A, 0x37, 0xC4, 0x0C, 0x85, 0x51, 0xA2, 0x4B, 0xB4, 0x18, 0x87, 0xB9, 0x68, 0x93,
+    0x03, 0x82, 0x04, 0x30, 0xF0, 0xA7, 0x2F, 0xE9, 0x46, 0xEB, 0x63, 0x6A, 0x03, 0x4D, 0x28, 0x37,
+    0xAD, 0x80, 0x9B, 0xCB, 0x56, 0xB9, 0x6C, 0xFB, 0x48, 0xE1, 0x58, 0xBB, 0xAC, 0xA7, 0x14, 0x8B,
+    0xC4, 0xC5, 0x18, 0x72, 0x8E, 0xCC, 0x48, 0x13, 0x12, 0x3B, 0x76, 0x48, 0x01, 0x2C, 0x08, 0xB6,
+    0xE0, 0x87, 0x2B, 0x7D, 0xC0, 0x29, 0x3A, 0x24, 0x79, 0x2A, 0x47, 0x1F, 0x0D, 0x97, 0x82, 0x4B,
+    0x96, 0xC5, 0xA0, 0xEE, 0x4D, 0xE1, 0xE3, 0x44, 0x47, 0x93, 0xB6, 0x6C, 0xF0, 0x48, 0x0D, 0xD6,
+    0xCA, 0x58, 0x28, 0x8D, 0xD3, 0x30, 0x06, 0x0D, 0x96, 0x4C, 0x03, 0xE5, 0x9D, 0x99, 0xEC, 0x8D,
+    0x13, 0x1B, 0xDA, 0xD6, 0x37, 0x2A, 0x3F, 0x0B, 0x76, 0xCD, 0xDC, 0x08, 0x01, 0x66, 0xA3, 0xE7,
+    0x49, 0xBA, 0xD5, 0x54, 0x15, 0xDC, 0xE7, 0x08, 0x86, 0x93, 0xA3, 0x2E, 0xE4, 0xA2, 0xA1, 0xF5,
+    0x00, 0x86, 0x95, 0x2E, 0xB1, 0x47, 0xA2, 0x96, 0x9A, 0xA9, 0x5A, 0x28, 0xB9, 0x45, 0xE4, 0x6F,
+    0x69, 0x96, 0x1E, 0xE6, 0x70, 0xD8, 0xB7, 0xD7, 0x59, 0x09, 0x06, 0xD3, 0x4C, 0x87, 0x16, 0x0B,
+    0x3A, 0x8D, 0xAE, 0xB3, 0x0F, 0xE1, 0x92, 0xFA, 0xB0, 0x39, 0xF2, 0xBE, 0x6D, 0x80, 0xB1, 0x63,
+    0xC7, 0x4A, 0x14, 0x17, 0xA6, 0x57, 0x8A, 0xF8, 0x40, 0x09, 0x73, 0xAA, 0x55, 0x4B, 0xD5, 0x65,
+    0x39, 0x48, 0x9A, 0x09, 0x64, 0xC3, 0x3B, 0x3B, 0x6D, 0x31, 0xCA, 0xD3, 0xBC, 0xC7, 0xC8, 0x04,
+    0x37, 0x76, 0xDE, 0x1D, 0x5F, 0xB2, 0x4D, 0x09, 0xEA, 0xFD, 0xC3, 0xA8, 0x90, 0x82, 0x61, 0x07,
+    0x97, 0x6A, 0x34, 0x9D, 0xEC, 0x65, 0x13, 0xC7, 0x1C, 0x55, 0xD7, 0xCC, 0xD4, 0x40, 0x1D, 0x11,
+    0xB0, 0xA8, 0xE4, 0x1B, 0xFE, 0x1D, 0x7E, 0xC7, 0x7F, 0xEE, 0x45, 0x57, 0x05, 0x3C, 0xEF, 0x3F,
+    0xF9, 0xDF, 0xFC, 0xF5, 0x65, 0xA9, 0x6F, 0xD3, 0xA4, 0x62, 0x50, 0xDB, 0x49, 0xF6, 0xE5, 0x98,
+    0x15, 0xA3, 0xD7, 0x97, 0xA5, 0x16, 0xFE, 0x4F, 0xC5, 0x59, 0x15, 0x98, 0xF9, 0x61, 0x13, 0xAD,
+    0x59, 0x56, 0xE8, 0x03, 0xA5, 0x34, 0x79, 0xB6, 0x50, 0xF5, 0x3B, 0xD7, 0xE9, 0xD5, 0x07, 0xF8,
+    0x76, 0x87, 0xC7, 0x6F, 0x91, 0xAE, 0x01, 0x8B, 0x98, 0x16, 0xE4, 0x5C, 0x4D, 0x7B, 0xD7, 0x65,
+    0x30, 0x37, 0x26, 0xB0, 0xCD, 0xA7, 0x95, 0xEA, 0x0C, 0x90, 0x70, 0x17, 0xEF, 0x4E, 0xA5, 0x46,
+    0xAE, 0x0F, 0x74, 0xB7, 0xD2, 0x9C, 0xCE, 0xBB, 0xE8, 0x6C, 0x01, 0xDE, 0x3D, 0x65, 0x96, 0x35,
+    0x68, 0xB7, 0xCC, 0x45, 0xDC, 0x35, 0xD2, 0x4F, 0x39, 0x6B, 0x08, 0x74, 0x56, 0xA5, 0x7A, 0x5C,
+    0xB3, 0xA8, 0xD9, 0x5F, 0xF6, 0xA9, 0x6C, 0xDE, 0xB5, 0x82, 0xA9, 0x80, 0x39, 0x23, 0x11, 0x80,
+    0xCC, 0x4E, 0x5A, 0x3F, 0x1E, 0xDE, 0xE1, 0x96, 0x0F, 0x1B, 0xB9, 0x6C, 0xBB, 0x44, 0x31, 0x0F,
+    0x17, 0x02, 0x40, 0xC5, 0xF6, 0x9B, 0x5A, 0xCD, 0xD6, 0x1A, 0x37, 0x5C, 0x0E, 0x9B, 0xB3, 0xB1,
+    0xC1, 0xC4, 0xD4, 0x50, 0x0B, 0x85, 0x48, 0x47, 0x44, 0x9D, 0x43, 0x2F, 0x01, 0xAD, 0xC1, 0x83,
+    0xD2, 0x53, 0xD8, 0x49, 0x3F, 0xD9, 0x1A, 0x77, 0x3E, 0xA5, 0xAB, 0x2A, 0x7E, 0x0B, 0x84, 0xCC,
+    0x9F, 0xD6, 0xBF, 0x90, 0xC6, 0x82, 0x6A, 0x6B, 0x2E, 0x09, 0xCE, 0x35, 0x66, 0x1D, 0xF4, 0xD7,
+    0x83, 0x6E, 0xD6, 0xC8, 0x52, 0xAC, 0x12, 0xB4, 0xF5, 0x24, 0xC0, 0xF1, 0xA8, 0x8C, 0xDD, 0xFA,
+    0x0B, 0xF2, 0x8F, 0x86, 0x51, 0x0E, 0xC4, 0x94, 0xEE, 0xB2, 0x22, 0x20, 0x29, 0x79, 0x1E, 0xB5,
+    0xEF, 0xEB, 0x1E, 0x95, 0xE1, 0x25, 0x1D, 0x9B, 0x0E, 0x70, 0x2F, 0xC1, 0xB4, 0x54, 0x34, 0x6F,
+    0xFE, 0x15, 0x26, 0x9E, 0x09, 0xD4, 0x49, 0xCD, 0xE8, 0x9F, 0xE0, 0xF8, 0xF6, 0xB4, 0xF6, 0x09,
+    0xD4, 0xCD, 0xAB, 0xDF, 0x45, 0x1E, 0x6A, 0x66, 0x3B, 0x2D, 0x37, 0x7C, 0x57, 0xE6, 0x24, 0x99,
+    0x3C, 0x61, 0xC0, 0xDC, 0x75, 0xC5, 0xE1, 0x40, 0x8D, 0x9D, 0xB8, 0x26, 0x93, 0xFF, 0x64, 0x00,
+    0xFD, 0x17, 0x17, 0x62, 0xDD, 0x77, 0xB8, 0x0D, 0x27, 0x06, 0xE7, 0x87, 0x63, 0x61, 0x6F, 0xE1,
+    0xD0, 0xC9, 0x6D, 0xB9, 0x77, 0xCB, 0xFF, 0x01, 0x5C, 0x04, 0xBA, 0x8C, 0x3E, 0x0C, 0x00, 0x00,
+};
+
+const StaticFile StaticFiles[] =
+{
+    { Calibrate_svg_Path, Calibrate_svg_ContentType, Calibrate_svg_ETag, Calibrate_svg_Data, sizeof(Calibrate_svg_Data), true },
+    { Graph_svg_Path, Graph_svg_ContentType, Graph_svg_ETag, Graph_svg_Data, sizeof(Graph_svg_Data), true },
+    { Home_svg_Path, Home_svg_ContentType, Home_svg_ETag, Home_svg_Data, sizeof(Home_svg_Data), true },
+    { LogFile_svg_Path, LogFile_svg_ContentType, LogFile_svg_ETag, LogFile_svg_Data, sizeof(LogFile_svg_Data), true },
+    { Logo_png_Path, Logo_png_ContentType, Logo_png_ETag, Logo_png_Data, sizeof(Logo_png_Data), false },
+    { Settings_svg_Path, Settings_svg_ContentType, Settings_svg_ETag, Settings_svg_Data, sizeof(Settings_svg_Data), true },
+    { Upload_svg_Path, Upload_svg_ContentType, Upload_svg_ETag, Upload_svg_Data, sizeof(Upload_svg_Data), true },
+    { styles_css_Path, styles_css_ContentType, styles_css_ETag, styles_css_Data, sizeof(styles_css_Data), true },
+};
+
+const size_t StaticFileCount = sizeof(StaticFiles) / sizeof(StaticFiles[0]);
+
+#endif
@@ -11,7 +11,9 @@
 #include <WiFiFTP.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <ChunkedResponse.h>
 #include <HtmlWriter.h>
+#include <LogCursor.h>
 #include <Log.h>
 #include <WiFiStateMachine.h>
 #include <BluetoothAudio.h>
@@ -59,9 +61,9 @@
 ESPWebServer WebServer(80); // Default HTTP port
 WiFiNTP TimeServer(3600 * 24); // Synchronize daily
 WiFiFTPClient FTPClient(2000); // 2 sec timeout
-StringBuilder HttpResponse(16384); // 16KB HTTP response buffer
+ChunkedResponse HttpResponse(WebServer, 1536); // 1.5KB HTTP response buffer (larger responses are sent in chunks)
 HtmlWriter Html(HttpResponse, ICON, CSS, 60); // Max bar length: 60
-Log<const char> EventLog(50); // Max 50 log entries
+StringArenaLog EventLog(50, 2048); // Max 50 log entries in 2 KB
 WiFiStateMachine WiFiSM(TimeServer, WebServer, EventLog);
 DSP32 DSP(/*tracePerformance*/ false);
 BluetoothAudio BTAudio;
@@ -477,6 +479,7 @@ void handleHttpRootRequest()
         return;
     }
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("Home"), false, false, REFRESH_INTERVAL);
 
     HttpResponse.println(F("<h1>Device Status</h1>"));
@@ -520,7 +523,7 @@ void handleHttpRootRequest()
     
     Html.writeFooter();
 
-    WebServer.send(200, "text/html", HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -551,6 +554,7 @@ void handleHttpBluetoothRequest()
     lastBTSamples = a2dpSamples;
     lastBTMillis = millis();
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("Bluetooth"), true, true, 5);
 
     HttpResponse.println(F("<table class=\"status\">"));
@@ -701,7 +705,7 @@ void handleHttpBluetoothRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, "text/html", HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -724,6 +728,7 @@ void handleHttpMicRequest()
     else
         micGain = Mic.getGain();
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("Microphone"), true, true, refreshInterval);
 
     HttpResponse.println(F("<form method=\"POST\">"));
@@ -748,7 +753,7 @@ void handleHttpMicRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, "text/html", HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -771,6 +776,7 @@ void handleHttpFxRequest()
 {
     Tracer tracer(F(__func__));
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("Sound Effects"), true, true);
 
     HttpResponse.println(F("<form method=\"POST\">"));
@@ -790,7 +796,7 @@ void handleHttpFxRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, "text/html", HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -885,6 +891,7 @@ void handleHttpWaveRequest()
     bool isRecording = Mic.isRecording() || BTAudio.isSinkStarted();
     uint16_t refreshInterval = isRecording ? 2 : 0;
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("Wave Buffer"), true, true, refreshInterval);
 
     if (WaveBuffer.getNumSamples() != 0)
@@ -947,7 +954,7 @@ void handleHttpWaveRequest()
     writeHtmlSampleDump(dspBuffer, numSamples);
 
     Html.writeFooter();
-    WebServer.send(200, F("text/html"), HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -1041,6 +1048,7 @@ void handleHttpWaveDspRequest()
 {
     Tracer tracer(F(__func__));
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("Wave DSP"), true, true);
 
     if (WaveBuffer.getNumSamples() < DSP_FRAME_SIZE)
@@ -1049,7 +1057,7 @@ void handleHttpWaveDspRequest()
         writeHtmlDspResult();
 
     Html.writeFooter();
-    WebServer.send(200, F("text/html"), HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -1057,6 +1065,7 @@ void handleHttpWaveFtpRequest()
 {
     Tracer tracer(F(__func__));
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("FTP Wave File"), true, true);
 
     HttpResponse.println(F("<div><pre class=\"ftplog\">"));
@@ -1070,7 +1079,7 @@ void handleHttpWaveFtpRequest()
  
     Html.writeFooter();
 
-    WebServer.send(200, F("text/html"), HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -1078,26 +1087,28 @@ void handleHttpEventLogRequest()
 {
     Tracer tracer(F(__func__));
 
-    Html.writeHeader(F("Event log"), true, true, REFRESH_INTERVAL);
-
     if (shouldPerformAction(F("clear")))
     {
         EventLog.clear();
         logEvent(F("Event log cleared."));
     }
 
-    const char* event = EventLog.getFirstEntry();
-    while (event != nullptr)
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, EventLog, cursor);
+
+    HttpResponse.begin(200, "text/html");
+    Html.writeHeader(F("Event log"), true, true, REFRESH_INTERVAL);
+
+    for (const char* event : incremental ? EventLog.getEntriesSince(cursor) : EventLog.getRange())
     {
         HttpResponse.printf(F("<div>%s</div>\r\n"), event);
-        event = EventLog.getNextEntry();
     }
 
     HttpResponse.printf(F("<p><a href=\"?clear=%u\">Clear event log</a></p>\r\n"), currentTime);
 
     Html.writeFooter();
 
-    WebServer.send(200, F("text/html"), HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -1105,6 +1116,7 @@ void handleHttpConfigFormRequest()
 {
     Tracer tracer(F(__func__));
 
+    HttpResponse.begin(200, "text/html");
     Html.writeHeader(F("Configuration"), true, true);
 
     HttpResponse.println(F("<form action=\"/config\" method=\"POST\">"));
@@ -1123,7 +1135,7 @@ void handleHttpConfigFormRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, F("text/html"), HttpResponse);
+    HttpResponse.end();
 }
 
 
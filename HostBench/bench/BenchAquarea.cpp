@@ -0,0 +1,86 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <Aquarea.h>
+
+// Receiving and decoding an Aquarea response packet (AquaMon/test.txt) vs. presenting all topics as Strings.
+// AquareaReceive receives the same packet each time, so no topics change (the typical case);
+// AquareaReceiveChanged alternates the inlet/outlet temperatures and pump flow.
+
+static const char TestPacket[] =
+    "71C80110565552890055000100000000000000005A151155691555555529000000000000000080808080B4717141990000000000"
+    "0000000000008083158A887BDA7B781F7E1F1F79798D8DB2A8808AB7A37B8F998A7B8F8A949E8F8A949E858F8A113D78C10B7E7C"
+    "3D767B000000555555214715A9051412650000000000000000C2D30B3365B2D30B9465B100007EADB2B132B2B4B0893280B7B5D5"
+    "98AD7C617D229AAA012F320000830A1B5145012E79C9C9E20500E6030003000001000006010B1101010101020000ED";
+
+
+static size_t getTestPacket(uint8_t* buffer)
+{
+    size_t size = strlen(TestPacket) / 2;
+    for (size_t i = 0; i < size; i++)
+    {
+        unsigned int byte;
+        sscanf(TestPacket + i * 2, "%2X", &byte);
+        buffer[i] = byte;
+    }
+    return size;
+}
+
+
+BENCHMARK(AquareaReceive)
+{
+    uint8_t packet[DATA_BUFFER_SIZE];
+    size_t packetSize = getTestPacket(packet);
+    Aquarea heatPump;
+
+    bool isValid = true;
+    while (state.keepRunning())
+    {
+        Serial.hostFeed(packet, packetSize);
+        isValid &= heatPump.receive() && heatPump.isPacketValid();
+    }
+    doNotOptimize(isValid);
+    doNotOptimize(heatPump.getTopicValue(TopicId::Heat_Power));
+}
+
+
+BENCHMARK(AquareaReceiveChanged)
+{
+    uint8_t packets[2][DATA_BUFFER_SIZE];
+    size_t packetSize = getTestPacket(packets[0]);
+    memcpy(packets[1], packets[0], packetSize);
+    packets[1][143]++; // Main_Inlet_Temp
+    packets[1][144]++; // Main_Outlet_Temp
+    packets[1][170]++; // Pump_Flow
+    packets[1][packetSize - 1] -= 3; // Checksum
+    Aquarea heatPump;
+
+    bool isValid = true;
+    size_t changedTopics = 0;
+    int i = 0;
+    while (state.keepRunning())
+    {
+        Serial.hostFeed(packets[i++ & 1], packetSize);
+        isValid &= heatPump.receive() && heatPump.isPacketValid();
+        changedTopics += heatPump.getChangedTopics().count();
+    }
+    doNotOptimize(isValid);
+    doNotOptimize(changedTopics);
+}
+
+
+BENCHMARK(AquareaTopicStrings)
+{
+    uint8_t packet[DATA_BUFFER_SIZE];
+    size_t packetSize = getTestPacket(packet);
+    Aquarea heatPump;
+    Serial.hostFeed(packet, packetSize);
+    heatPump.receive();
+
+    size_t length = 0;
+    while (state.keepRunning())
+    {
+        for (TopicId topicId : Aquarea::getAllTopicIds())
+            length += heatPump.getTopic(topicId).getValue().length();
+    }
+    doNotOptimize(length);
+}
@@ -0,0 +1,101 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <Log.h>
+#include <StringBuilder.h>
+#include <BinaryLogWriter.h>
+
+// Exporting a day of OpenThermLog-like entries (1440 entries) as CSV (like the FTP sync) vs. binary.
+// The output column shows the export size.
+
+struct __attribute__ ((packed)) OTSample
+{
+    time_t time;
+    uint16_t values[12];
+};
+
+static const BinaryField OTSampleFields[] =
+{
+    BINARY_FIELD(OTSample, time),
+    BINARY_FIELD(OTSample, values)
+};
+
+
+static void fillLog(StaticLog<OTSample>& log)
+{
+    OTSample sample;
+    for (int i = 0; i < 1440; i++)
+    {
+        sample.time = 1700000000 + i * 60;
+        for (int k = 0; k < 12; k++)
+            sample.values[k] = (20 + k + (i * (k + 3)) % 17) << 8;
+        log.add(&sample);
+    }
+}
+
+
+BENCHMARK(BinaryLogCsvExport)
+{
+    StaticLog<OTSample> log(1440);
+    fillLog(log);
+    StringBuilder output(128 * 1024);
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        for (OTSample* samplePtr : log)
+        {
+            output.printf(F("%ld"), long(samplePtr->time));
+            for (int k = 0; k < 12; k++)
+                output.printf(F(";%0.1f"), float(int16_t(samplePtr->values[k])) / 256);
+            output.println();
+        }
+    }
+    state.setOutputSize(output.length());
+}
+
+
+BENCHMARK(BinaryLogExport)
+{
+    StaticLog<OTSample> log(1440);
+    fillLog(log);
+    StringBuilder output(128 * 1024);
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        writeBinaryLog(output, log, OTSampleFields);
+    }
+    state.setOutputSize(output.length());
+}
+
+
+BENCHMARK(BinaryLogExportSince)
+{
+    StaticLog<OTSample> log(1440);
+    fillLog(log);
+    StringBuilder output(128 * 1024);
+    time_t since = 1700000000 + 1380 * 60; // Last hour
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        writeBinaryLog(output, log, OTSampleFields, since);
+    }
+    state.setOutputSize(output.length());
+}
+
+
+BENCHMARK(BinaryLogExportCursor)
+{
+    StaticLog<OTSample> log(1440);
+    fillLog(log);
+    StringBuilder output(128 * 1024);
+    uint32_t cursor = log.sequence() - 60; // Last hour
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        writeBinaryLog(output, log.getEntriesSince(cursor), OTSampleFields);
+    }
+    state.setOutputSize(output.length());
+}
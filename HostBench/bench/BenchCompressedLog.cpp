@@ -0,0 +1,147 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <Log.h>
+#include <CompressedLog.h>
+
+// Compressed vs. uncompressed time series logs, modelled after DsmrMonitor's PowerLog and AquaMon's TopicLog.
+// The output column shows the RAM used for 250 entries.
+
+struct __attribute__ ((packed)) PowerSample
+{
+    time_t time;
+    uint16_t powerDelivered[3];
+    uint16_t powerReturned[3];
+    uint16_t powerGas;
+};
+
+struct __attribute__ ((packed)) TopicSample
+{
+    time_t time;
+    float topicValues[15];
+};
+
+
+static void nextPowerSample(PowerSample& sample, uint32_t i)
+{
+    sample.time += (i % 7 == 0) ? 60 : 3600; // Either after threshold exceeded or hourly
+    sample.powerDelivered[0] = 300 + (i * 37) % 900;
+    sample.powerReturned[0] = (i % 5 == 0) ? 0 : 1200 - (i * 13) % 400;
+    sample.powerGas = (i % 3 == 0) ? 0 : 2400;
+}
+
+
+static void nextTopicSample(TopicSample& sample, uint32_t i)
+{
+    sample.time += 60;
+    for (int k = 0; k < 9; k++)
+        sample.topicValues[k] = 20.0F + k + ((i * (k + 3)) % 17) / 10.0F; // Temperatures
+    sample.topicValues[10] = (i % 20 < 10) ? 0 : 650; // Fan
+    sample.topicValues[11] = 12.4F; // Pump flow
+    sample.topicValues[12] = (i % 20 < 10) ? 0 : 34; // Compressor frequency
+}
+
+
+BENCHMARK(PowerLogStaticAdd)
+{
+    StaticLog<PowerSample> log(250);
+    PowerSample sample;
+    memset(&sample, 0, sizeof(sample));
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        nextPowerSample(sample, i++);
+        log.add(&sample);
+    }
+    state.setOutputSize(250 * sizeof(PowerSample));
+}
+
+
+BENCHMARK(PowerLogCompressedAdd)
+{
+    CompressedLog<PowerSample, uint16_t, 7> log(1000, 6000);
+    PowerSample sample;
+    memset(&sample, 0, sizeof(sample));
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        nextPowerSample(sample, i++);
+        log.add(&sample);
+    }
+    state.setOutputSize(log.bytesUsed() * 250 / log.count());
+}
+
+
+BENCHMARK(PowerLogCompressedIterate)
+{
+    CompressedLog<PowerSample, uint16_t, 7> log(250, 6000);
+    PowerSample sample;
+    memset(&sample, 0, sizeof(sample));
+    for (uint32_t i = 0; i < 250; i++)
+    {
+        nextPowerSample(sample, i);
+        log.add(&sample);
+    }
+
+    while (state.keepRunning())
+    {
+        uint32_t sum = 0;
+        for (PowerSample* samplePtr : log)
+            sum += samplePtr->powerDelivered[0];
+        doNotOptimize(sum);
+    }
+}
+
+
+BENCHMARK(PowerLogCompressedLastPage)
+{
+    CompressedLog<PowerSample, uint16_t, 7> log(250, 6000);
+    PowerSample sample;
+    memset(&sample, 0, sizeof(sample));
+    for (uint32_t i = 0; i < 250; i++)
+    {
+        nextPowerSample(sample, i);
+        log.add(&sample);
+    }
+
+    while (state.keepRunning())
+    {
+        uint32_t sum = 0;
+        for (PowerSample* samplePtr : log.getRange(200, 50))
+            sum += samplePtr->powerDelivered[0];
+        doNotOptimize(sum);
+    }
+}
+
+
+BENCHMARK(TopicLogStaticAdd)
+{
+    StaticLog<TopicSample> log(250);
+    TopicSample sample;
+    memset(&sample, 0, sizeof(sample));
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        nextTopicSample(sample, i++);
+        log.add(&sample);
+    }
+    state.setOutputSize(250 * sizeof(TopicSample));
+}
+
+
+BENCHMARK(TopicLogCompressedAdd)
+{
+    CompressedLog<TopicSample, float, 15, 100> log(1000, 12800);
+    TopicSample sample;
+    memset(&sample, 0, sizeof(sample));
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        nextTopicSample(sample, i++);
+        log.add(&sample);
+    }
+    state.setOutputSize(log.bytesUsed() * 250 / log.count());
+}
@@ -0,0 +1,61 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <FS.h>
+#include <Log.h>
+#include <FlashLog.h>
+
+// Flash-backed log, modelled after TempMon's TempLog (200 entries in 4 segments).
+// For FlashLogAdd the output column shows the number of flash writes per 1000 entries.
+
+struct TempSample
+{
+    time_t time;
+    int count;
+    float sumTinside;
+    float sumToutside;
+};
+
+
+BENCHMARK(FlashLogAdd)
+{
+    SPIFFS.hostFormat();
+    FlashLog<TempSample> log("bench", 4, 200);
+    log.load();
+    TempSample sample;
+    memset(&sample, 0, sizeof(sample));
+
+    uint32_t writes = SPIFFS.hostWrites();
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        sample.time += 60;
+        sample.count = 10;
+        sample.sumTinside = 200.0F + i % 13;
+        sample.sumToutside = 100.0F - i % 29;
+        log.add(&sample);
+        i++;
+    }
+    state.setOutputSize((SPIFFS.hostWrites() - writes) * 1000ULL / i);
+}
+
+
+BENCHMARK(FlashLogLoad)
+{
+    SPIFFS.hostFormat();
+    FlashLog<TempSample> log("bench", 4, 200);
+    log.load();
+    TempSample sample;
+    memset(&sample, 0, sizeof(sample));
+    for (uint32_t i = 0; i < 5000; i++)
+    {
+        sample.time += 60;
+        log.add(&sample);
+    }
+    log.flush();
+
+    while (state.keepRunning())
+    {
+        log.load();
+        doNotOptimize(log.count());
+    }
+}
@@ -0,0 +1,188 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <HtmlWriter.h>
+#include <ChunkedResponse.h>
+
+// Page renders modelled after the DsmrMonitor home page and power log page.
+
+static const char* Files[] PROGMEM =
+{
+    "Logo.png",
+    "styles.css",
+    "Home.svg",
+    "Graph.svg",
+    "Upload.svg",
+    "Settings.svg"
+};
+
+
+static Navigation createNavigation()
+{
+    Navigation nav;
+    nav.width = F("10em");
+    nav.menuItems = std::vector<MenuItem>
+    {
+        MenuItem { .icon = Files[2], .label = PSTR("Home"), .urlPath = nullptr, .handler = nullptr, .postHandler = nullptr },
+        MenuItem { .icon = Files[3], .label = PSTR("Power log"), .urlPath = PSTR("powerlog"), .handler = nullptr, .postHandler = nullptr },
+        MenuItem { .icon = Files[4], .label = PSTR("FTP Sync"), .urlPath = PSTR("sync"), .handler = nullptr, .postHandler = nullptr },
+        MenuItem { .icon = Files[5], .label = PSTR("Settings"), .urlPath = PSTR("config"), .handler = nullptr, .postHandler = nullptr },
+    };
+    return nav;
+}
+
+
+static void writePhaseRow(StringBuilder& output, HtmlWriter& html, const char* label, float voltage, float current, float power)
+{
+    html.writeRowStart();
+    html.writeHeaderCell(label);
+    html.writeCell(voltage, F("%0.1f V"));
+    html.writeCell(current, F("%0.0f A"));
+    output.printf(F("<td><div>+%0.0f W</div><div>-%0.0f W</div></td>"), power, 0.0F);
+    html.writeCellStart(F("graph"));
+    html.writeBar(power / 5750, F("deliveredBar"), true);
+    html.writeBar(0, F("returnedBar"), true);
+    html.writeCellEnd();
+    html.writeRowEnd();
+}
+
+
+static void renderHomePage(StringBuilder& output, HtmlWriter& html, const Navigation& nav)
+{
+    html.writeHeader(F("Home"), nav, 30);
+
+    html.writeDivStart(F("flex-container"));
+
+    html.writeSectionStart(F("Status"));
+    html.writeTableStart();
+    html.writeRow(F("WiFi RSSI"), F("%d dBm"), -67);
+    html.writeRow(F("Free Heap"), F("%0.1f kB"), float(ESP.getFreeHeap()) / 1024);
+    html.writeRow(F("Uptime"), F("%0.1f days"), 12.3F);
+    html.writeRow(F("Last Telegram"), "12:34:56");
+    html.writeRow(F("Gas update"), "12:30:00");
+    html.writeRow(F("FTP Sync"), "12:00");
+    html.writeRow(F("Sync entries"), F("%d / %d"), 7, 30);
+    html.writeTableEnd();
+    html.writeSectionEnd();
+
+    html.writeSectionStart(F("Current power"));
+    html.writeTableStart();
+    writePhaseRow(output, html, "L1", 231.2, 3, 690);
+    writePhaseRow(output, html, "L2", 230.7, 1, 230);
+    writePhaseRow(output, html, "L3", 229.9, 5, 1150);
+    writePhaseRow(output, html, "Total", 230.6, 9, 2070);
+    html.writeTableEnd();
+    html.writeSectionEnd();
+
+    html.writeSectionStart(F("Energy per day"));
+    html.writeTableStart();
+    for (int i = 0; i < 7; i++)
+    {
+        html.writeRowStart();
+        html.writeCell("Mon");
+        output.printf(F("<td><div>+%d</div><div>-%d</div><div>%d</div></td>"), 3000 + i, 100 * i, 2000);
+        output.printf(F("<td><div>+%0.1f</div><div>-%0.1f</div><div>%0.1f</div></td>"), 8.5F + i, 1.5F * i, 12.0F);
+        html.writeCellStart(F("graph"));
+        html.writeBar((8.5F + i) / 20, F("deliveredBar"), false);
+        html.writeBar((1.5F * i) / 20, F("returnedBar"), false);
+        html.writeBar(12.0F / 20, F("gasBar"), false);
+        html.writeCellEnd();
+        html.writeRowEnd();
+    }
+    html.writeTableEnd();
+    html.writeSectionEnd();
+
+    html.writeDivEnd();
+    html.writeFooter();
+}
+
+
+static void renderLogPage(HtmlWriter& html, const Navigation& nav)
+{
+    html.writeHeader(F("Power log"), nav);
+    html.writePager(5, 0);
+
+    html.writeTableStart();
+    html.writeRowStart();
+    html.writeHeaderCell(F("Time"));
+    html.writeHeaderCell(F("P<sub>delivered</sub> (W)"), 3);
+    html.writeHeaderCell(F("P<sub>returned</sub> (W)"), 3);
+    html.writeHeaderCell(F("P<sub>gas</sub> (W)"));
+    html.writeRowEnd();
+
+    for (int i = 0; i < 50; i++)
+    {
+        html.writeRowStart();
+        html.writeCell("12:34");
+        for (int phase = 0; phase < 3; phase++)
+            html.writeCell(100 * phase + i);
+        for (int phase = 0; phase < 3; phase++)
+            html.writeCell(10 * phase);
+        html.writeCell(1200 + i);
+        html.writeGraphCell(float(i) / 50, F("deliveredBar"), false);
+        html.writeRowEnd();
+    }
+
+    html.writeTableEnd();
+    html.writeFooter();
+}
+
+
+BENCHMARK(HtmlWriterHomePage)
+{
+    StringBuilder output(16384);
+    HtmlWriter html(output, Files[0], Files[1], 45);
+    Navigation nav = createNavigation();
+
+    while (state.keepRunning())
+        renderHomePage(output, html, nav);
+
+    state.setOutputSize(output.length());
+}
+
+
+BENCHMARK(HtmlWriterLogPage)
+{
+    StringBuilder output(16384);
+    HtmlWriter html(output, Files[0], Files[1], 45);
+    Navigation nav = createNavigation();
+
+    while (state.keepRunning())
+        renderLogPage(html, nav);
+
+    state.setOutputSize(output.length());
+}
+
+
+BENCHMARK(HtmlWriterLogPageChunked)
+{
+    ESP8266WebServer webServer;
+    ChunkedResponse output(webServer, 1536);
+    HtmlWriter html(output, Files[0], Files[1], 45);
+    Navigation nav = createNavigation();
+
+    size_t responseSize = 0;
+    while (state.keepRunning())
+    {
+        webServer.hostResponse().body = String();
+        output.begin(200, "text/html");
+        renderLogPage(html, nav);
+        output.end();
+        responseSize = webServer.hostResponse().body.length();
+    }
+
+    state.setOutputSize(responseSize);
+}
+
+
+BENCHMARK(HtmlWriterBar)
+{
+    StringBuilder output(16384);
+    HtmlWriter html(output, Files[0], Files[1], 45);
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        if ((i++ & 0x3F) == 0) output.clear();
+        html.writeBar(0.42F, F("deliveredBar"), true);
+    }
+}
@@ -0,0 +1,77 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <JsonWriter.h>
+
+// DsmrMonitor's /json response: printf-based (as before) vs. JsonWriter.
+
+struct PhaseSample
+{
+    const char* label;
+    float voltage;
+    float current;
+    float powerDelivered;
+    float powerReturned;
+};
+
+static const PhaseSample Phases[] =
+{
+    { "L1", 231.4F, 3.0F, 712.0F, 0.0F },
+    { "L2", 229.8F, 1.0F, 184.0F, 0.0F },
+    { "L3", 230.6F, 0.0F, 0.0F, 2140.0F },
+    { "Total", 230.6F, 4.0F, 896.0F, 2140.0F }
+};
+
+
+BENCHMARK(JsonPrintf)
+{
+    StringBuilder output(1536);
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        output.print(F("{ \"Electricity\": [ "));
+        for (int i = 0; i < 4; i++)
+        {
+            if (i > 0) output.print(F(", "));
+            output.printf(
+                F("{ \"Phase\": \"%s\", \"U\": %0.1f, \"I\": %0.0f, \"Pdelivered\": %0.0f, \"Preturned\": %0.0f }"),
+                Phases[i].label,
+                Phases[i].voltage,
+                Phases[i].current,
+                Phases[i].powerDelivered,
+                Phases[i].powerReturned);
+        }
+        output.printf(F(" ], \"Egas\": %0.1f, \"Pgas\": %0.0f }"), 12345.6F, 2400.0F);
+    }
+    state.setOutputSize(output.length());
+}
+
+
+BENCHMARK(JsonWriterStream)
+{
+    StringBuilder output(1536);
+    JsonWriter json(output);
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        json.beginObject();
+        json.writeName(F("Electricity"));
+        json.beginArray();
+        for (int i = 0; i < 4; i++)
+        {
+            json.beginObject();
+            json.writeMember(F("Phase"), Phases[i].label);
+            json.writeMember(F("U"), Phases[i].voltage, 1);
+            json.writeMember(F("I"), Phases[i].current, 0);
+            json.writeMember(F("Pdelivered"), Phases[i].powerDelivered, 0);
+            json.writeMember(F("Preturned"), Phases[i].powerReturned, 0);
+            json.endObject();
+        }
+        json.endArray();
+        json.writeMember(F("Egas"), 12345.6F, 1);
+        json.writeMember(F("Pgas"), 2400.0F, 0);
+        json.endObject();
+    }
+    state.setOutputSize(output.length());
+}
@@ -0,0 +1,203 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <Log.h>
+
+// Log appends modelled after the sketches' log entry types.
+
+struct RangeLogEntry
+{
+    uint32_t time;
+    uint8_t status;
+    uint16_t distance;
+};
+
+struct PowerLogEntry
+{
+    time_t time;
+    uint16_t powerDelivered[3];
+    uint16_t powerReturned[3];
+    uint16_t powerGas;
+};
+
+
+BENCHMARK(LogAddHeapEntry)
+{
+    Log<RangeLogEntry> log(25);
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        RangeLogEntry* entryPtr = new RangeLogEntry();
+        entryPtr->time = i++;
+        entryPtr->distance = 123;
+        log.add(entryPtr);
+    }
+}
+
+
+BENCHMARK(LogIterate)
+{
+    Log<RangeLogEntry> log(25);
+    for (int i = 0; i < 25; i++)
+        log.add(new RangeLogEntry { uint32_t(i), 0, uint16_t(i) });
+
+    while (state.keepRunning())
+    {
+        uint32_t sum = 0;
+        RangeLogEntry* entryPtr = log.getFirstEntry();
+        while (entryPtr != nullptr)
+        {
+            sum += entryPtr->distance;
+            entryPtr = log.getNextEntry();
+        }
+        doNotOptimize(sum);
+    }
+}
+
+
+BENCHMARK(StaticLogAdd)
+{
+    StaticLog<PowerLogEntry> log(250);
+    PowerLogEntry entry;
+    memset(&entry, 0, sizeof(entry));
+
+    while (state.keepRunning())
+    {
+        entry.time++;
+        log.add(&entry);
+    }
+}
+
+
+BENCHMARK(StaticLogIterate)
+{
+    StaticLog<PowerLogEntry> log(250);
+    PowerLogEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    for (int i = 0; i < 250; i++)
+    {
+        entry.powerGas = i;
+        log.add(&entry);
+    }
+
+    while (state.keepRunning())
+    {
+        uint32_t sum = 0;
+        PowerLogEntry* entryPtr = log.getFirstEntry();
+        while (entryPtr != nullptr)
+        {
+            sum += entryPtr->powerGas;
+            entryPtr = log.getNextEntry();
+        }
+        doNotOptimize(sum);
+    }
+}
+
+
+BENCHMARK(StaticLogRangeFor)
+{
+    StaticLog<PowerLogEntry> log(250);
+    PowerLogEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    for (int i = 0; i < 250; i++)
+    {
+        entry.powerGas = i;
+        log.add(&entry);
+    }
+
+    while (state.keepRunning())
+    {
+        uint32_t sum = 0;
+        for (PowerLogEntry* entryPtr : log)
+            sum += entryPtr->powerGas;
+        doNotOptimize(sum);
+    }
+}
+
+
+BENCHMARK(StaticLogLastPageSkip)
+{
+    StaticLog<PowerLogEntry> log(250);
+    PowerLogEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    for (int i = 0; i < 300; i++)
+        log.add(&entry);
+
+    while (state.keepRunning())
+    {
+        uint32_t sum = 0;
+        PowerLogEntry* entryPtr = log.getFirstEntry();
+        for (int i = 0; i < 200 && entryPtr != nullptr; i++)
+            entryPtr = log.getNextEntry();
+        for (int i = 0; i < 50 && entryPtr != nullptr; i++)
+        {
+            sum += entryPtr->powerGas;
+            entryPtr = log.getNextEntry();
+        }
+        doNotOptimize(sum);
+    }
+}
+
+
+BENCHMARK(StaticLogLastPageRange)
+{
+    StaticLog<PowerLogEntry> log(250);
+    PowerLogEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    for (int i = 0; i < 300; i++)
+        log.add(&entry);
+
+    while (state.keepRunning())
+    {
+        uint32_t sum = 0;
+        for (PowerLogEntry* entryPtr : log.getRange(200, 50))
+            sum += entryPtr->powerGas;
+        doNotOptimize(sum);
+    }
+}
+
+
+BENCHMARK(StringLogAdd)
+{
+    StringLog log(50, 128);
+
+    while (state.keepRunning())
+        log.add("Temperature changed to 21.5 (was 21.0)");
+}
+
+
+// Event log appends as done by WiFiStateMachine::logEvent: timestamp + message of varying length.
+
+static const char* EventMessages[] =
+{
+    "WiFi connected",
+    "Temperature changed to 21.5 (was 21.0)",
+    "Time server synchronized: 2019-01-30 12:23:34",
+    "OTA update started"
+};
+
+
+BENCHMARK(EventLogHeapAdd)
+{
+    Log<const char> log(50);
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        const char* msg = EventMessages[i++ % 4];
+        char* event = new char[23 + strlen(msg)];
+        strcpy(event, "2019-01-30 12:23:34 : ");
+        strcat(event, msg);
+        log.add(event);
+    }
+}
+
+
+BENCHMARK(EventLogArenaAdd)
+{
+    StringArenaLog log(50, 2048);
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+        log.add("2019-01-30 12:23:34 : ", EventMessages[i++ % 4]);
+}
@@ -0,0 +1,130 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <P1Telegram.h>
+
+// Parsing DsmrMonitor/test_telegram.txt and reading the values used by updateStatistics:
+// the previous String-based parser (a String per line, startsWith scan and substring per value) vs. P1Telegram.
+
+static const char TestTelegram[] =
+    "/ISK5\\2M550T-1011\r\n"
+    "\r\n"
+    "1-3:0.2.8(50)\r\n"
+    "0-0:1.0.0(181106140429W)\r\n"
+    "0-0:96.1.1(4530303334303036383130353136343136)\r\n"
+    "1-0:1.8.1(003808.351*kWh)\r\n"
+    "1-0:1.8.2(002948.827*kWh)\r\n"
+    "1-0:2.8.1(001285.951*kWh)\r\n"
+    "1-0:2.8.2(002876.514*kWh)\r\n"
+    "0-0:96.14.0(0002)\r\n"
+    "1-0:1.7.0(00.000*kW)\r\n"
+    "1-0:2.7.0(00.498*kW)\r\n"
+    "0-0:96.7.21(00006)\r\n"
+    "0-0:96.7.9(00003)\r\n"
+    "1-0:99.97.0(1)(0-0:96.7.19)(180529135630S)(0000002451*s)\r\n"
+    "1-0:32.32.0(00003)\r\n"
+    "1-0:52.32.0(00002)\r\n"
+    "1-0:72.32.0(00002)\r\n"
+    "1-0:32.36.0(00001)\r\n"
+    "1-0:52.36.0(00001)\r\n"
+    "1-0:72.36.0(00001)\r\n"
+    "0-0:96.13.0()\r\n"
+    "1-0:32.7.0(236.0*V)\r\n"
+    "1-0:52.7.0(232.6*V)\r\n"
+    "1-0:72.7.0(235.1*V)\r\n"
+    "1-0:31.7.0(002*A)\r\n"
+    "1-0:51.7.0(000*A)\r\n"
+    "1-0:71.7.0(000*A)\r\n"
+    "1-0:21.7.0(00.000*kW)\r\n"
+    "1-0:41.7.0(00.033*kW)\r\n"
+    "1-0:61.7.0(00.132*kW)\r\n"
+    "1-0:22.7.0(00.676*kW)\r\n"
+    "1-0:42.7.0(00.000*kW)\r\n"
+    "1-0:62.7.0(00.000*kW)\r\n"
+    "0-1:24.1.0(003)\r\n"
+    "0-1:96.1.0(4730303339303031373030343630313137)\r\n"
+    "0-1:24.2.1(181106140010W)(01569.646*m3)\r\n"
+    "!1F28\r\n";
+
+static const char* LegacyObisIds[] =
+{
+    "1-0:32.7.0", "1-0:31.7.0", "1-0:21.7.0", "1-0:22.7.0",
+    "1-0:52.7.0", "1-0:51.7.0", "1-0:41.7.0", "1-0:42.7.0",
+    "1-0:72.7.0", "1-0:71.7.0", "1-0:61.7.0", "1-0:62.7.0"
+};
+
+
+static String getLegacyPropertyValue(String* dataLines, size_t numDataLines, const String& obisId, String* timestampPtr)
+{
+    for (size_t i = 0; i < numDataLines; i++)
+    {
+        if (dataLines[i].startsWith(obisId))
+        {
+            String dataLine = dataLines[i];
+            int valueStartIndex = dataLine.indexOf('(');
+            if (timestampPtr != nullptr)
+            {
+                int timestampEndIndex = dataLine.indexOf(')', valueStartIndex);
+                *timestampPtr = dataLine.substring(valueStartIndex + 1, timestampEndIndex);
+                valueStartIndex = timestampEndIndex + 1;
+            }
+            int valueEndIndex = dataLine.indexOf('*', valueStartIndex);
+            if (valueEndIndex < 0)
+                valueEndIndex = dataLine.indexOf(')', valueStartIndex);
+            return dataLine.substring(valueStartIndex + 1, valueEndIndex);
+        }
+    }
+    return String();
+}
+
+
+BENCHMARK(P1TelegramStringLines)
+{
+    static String dataLines[50];
+    char dataLine[64];
+    float sum = 0;
+
+    while (state.keepRunning())
+    {
+        Serial.hostFeed(TestTelegram);
+
+        size_t numDataLines = 0;
+        do
+        {
+            size_t bytesRead = Serial.readBytesUntil('\n', dataLine, sizeof(dataLine) - 1);
+            dataLine[bytesRead] = 0;
+        } while (dataLine[0] != '/');
+        do
+        {
+            size_t bytesRead = Serial.readBytesUntil('\n', dataLine, sizeof(dataLine) - 1);
+            dataLine[bytesRead] = 0;
+            if (strlen(dataLine) > 2 && dataLine[0] != '!')
+                dataLines[numDataLines++] = dataLine;
+        } while (dataLine[0] != '!');
+
+        for (const char* obisId : LegacyObisIds)
+            sum += getLegacyPropertyValue(dataLines, numDataLines, obisId, nullptr).toFloat();
+        String gasTimestamp;
+        sum += getLegacyPropertyValue(dataLines, numDataLines, "0-1:24.2.1", &gasTimestamp).toFloat();
+    }
+    state.setOutputSize(sum > 0 ? sizeof(TestTelegram) - 1 : 0);
+}
+
+
+BENCHMARK(P1TelegramParse)
+{
+    static P1Telegram p1Telegram;
+    char gasTimestamp[P1_TIMESTAMP_SIZE];
+    float sum = 0;
+
+    while (state.keepRunning())
+    {
+        Serial.hostFeed(TestTelegram);
+        while (!p1Telegram.receive(Serial));
+
+        for (int i = static_cast<int>(P1Telegram::PropertyId::VoltageL1); i <= static_cast<int>(P1Telegram::PropertyId::PowerReturnedL3); i++)
+            sum += p1Telegram.getFloatValue(static_cast<P1Telegram::PropertyId>(i));
+        p1Telegram.getTimestamp(P1Telegram::PropertyId::Gas, gasTimestamp);
+        sum += p1Telegram.getFloatValue(P1Telegram::PropertyId::Gas);
+    }
+    state.setOutputSize(sum > 0 ? p1Telegram.getLength() : 0);
+}
@@ -0,0 +1,52 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <PersistentDataBase.h>
+
+static const char* Files[] PROGMEM = { "Logo.png", "styles.css" };
+
+struct BenchPersistentData : public WiFiSettingsWithFTP
+{
+    int ftpSyncEntries;
+    int maxPhaseCurrent;
+    float gasCalorificValue;
+    bool isThreePhase;
+
+    BenchPersistentData()
+        : WiFiSettingsWithFTP(PSTR("DsmrMonitor"))
+    {
+        addIntegerField(ftpSyncEntries, PSTR("FTP sync entries"), 0, 250, 10);
+        addIntegerField(maxPhaseCurrent, PSTR("Max phase current"), 25, 75, 35);
+        addFloatField(gasCalorificValue, PSTR("Gas calorific value"), 3, 20, 50, 35.17);
+        addBooleanField(isThreePhase, PSTR("Three phase"), true);
+    }
+};
+
+
+BENCHMARK(PersistentDataWriteRead)
+{
+    BenchPersistentData data;
+    data.begin();
+
+    while (state.keepRunning())
+    {
+        data.writeToEEPROM();
+        data.readFromEEPROM();
+    }
+}
+
+
+BENCHMARK(PersistentDataHtmlForm)
+{
+    StringBuilder output(8192);
+    HtmlWriter html(output, Files[0], Files[1], 45);
+    BenchPersistentData data;
+    data.begin();
+
+    while (state.keepRunning())
+    {
+        output.clear();
+        data.writeHtmlForm(html);
+    }
+
+    state.setOutputSize(output.length());
+}
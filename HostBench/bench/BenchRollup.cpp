@@ -0,0 +1,74 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <Rollup.h>
+#include <EnergyAccounting.h>
+#include <LoadProfile.h>
+
+// Rollup updates modelled after DsmrMonitor's energy statistics (hour/day/week/month)
+// and TempMon's half-hourly temperature statistics.
+
+BENCHMARK(RollupEnergyUpdate)
+{
+    const uint32_t intervals[] = { 3600, ROLLUP_DAY, ROLLUP_WEEK, ROLLUP_MONTH };
+    const uint16_t sizes[] = { 24, 7, 12, 12 };
+    Rollup<3> energyStats(4, intervals, sizes);
+
+    time_t time = 1700000000;
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        float power[3] = { float(i % 3000), float(i % 700), 0 };
+        energyStats.update(time, power, 10.0F / 3600);
+        time += 10; // P1 telegram interval
+        i++;
+    }
+}
+
+
+BENCHMARK(EnergyAccountingAdd)
+{
+    const uint32_t intervals[] = { 3600, ROLLUP_DAY, ROLLUP_WEEK, ROLLUP_MONTH };
+    const uint16_t sizes[] = { 24, 7, 12, 12 };
+    EnergyAccounting energyStats(4, intervals, sizes);
+
+    time_t time = 1700000000;
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        float power[3] = { float(i % 3000), float(i % 700), 0 };
+        uint32_t energy[EnergyChannelCount] = { 0, i % 9, 0, i % 2, 0 };
+        energyStats.add(time, energy, power);
+        time += 10; // P1 telegram interval
+        i++;
+    }
+}
+
+BENCHMARK(LoadProfileUpdate)
+{
+    LoadProfile phaseLoad;
+
+    time_t time = 1700000000;
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        uint16_t power[LOAD_PHASES] = { uint16_t(i % 3000), uint16_t(i % 700), uint16_t(i % 50), uint16_t(i % 3750) };
+        phaseLoad.update(time, power, 1000);
+        time += 1; // ESMR5 telegram interval
+        i++;
+    }
+}
+
+BENCHMARK(RollupTempUpdate)
+{
+    Rollup<2> hourStats(30 * 60, 48);
+
+    time_t time = 1700000000;
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        float temperatures[2] = { 20.0F + (i % 10) / 10.0F, 5.0F };
+        hourStats.update(time, temperatures);
+        time += 6; // TEMP_POLL_INTERVAL
+        i++;
+    }
+}
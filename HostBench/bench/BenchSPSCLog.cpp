@@ -0,0 +1,62 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <SPSCLog.h>
+#include <thread>
+#include <atomic>
+
+struct RangeLogEntry
+{
+    uint32_t time;
+    uint8_t status;
+    uint16_t distance;
+};
+
+
+BENCHMARK(SPSCLogAdd)
+{
+    SPSCLog<RangeLogEntry> log(25);
+    RangeLogEntry entry = { 0, 0, 123 };
+
+    while (state.keepRunning())
+    {
+        entry.time++;
+        log.add(&entry);
+    }
+}
+
+
+BENCHMARK(SPSCLogSnapshot)
+{
+    SPSCLog<RangeLogEntry> log(25);
+    RangeLogEntry entry = { 0, 0, 123 };
+    for (int i = 0; i < 25; i++)
+        log.add(&entry);
+
+    RangeLogEntry snapshot[25];
+    while (state.keepRunning())
+        doNotOptimize(log.getSnapshot(snapshot, 25));
+}
+
+
+// Snapshots while another thread appends at full rate.
+BENCHMARK(SPSCLogSnapshotConcurrent)
+{
+    SPSCLog<RangeLogEntry> log(25);
+    std::atomic<bool> stop(false);
+    std::thread producer([&log, &stop]()
+    {
+        RangeLogEntry entry = { 0, 0, 123 };
+        while (!stop.load(std::memory_order_relaxed))
+        {
+            entry.time++;
+            log.add(&entry);
+        }
+    });
+
+    RangeLogEntry snapshot[25];
+    while (state.keepRunning())
+        doNotOptimize(log.getSnapshot(snapshot, 25));
+
+    stop = true;
+    producer.join();
+}
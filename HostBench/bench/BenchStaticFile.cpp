@@ -0,0 +1,71 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <StaticFile.h>
+#include "../../DsmrMonitor/StaticFiles.h"
+
+// Serving DsmrMonitor's embedded styles.css and Logo.png, as registered by WiFiStateMachine::registerStaticFiles.
+// The output column shows the response body size; a revalidation (304) has no body at all.
+
+static const StaticFile* findStaticFile(const char* path)
+{
+    for (size_t i = 0; i < StaticFileCount; i++)
+    {
+        if (strcmp_P(path, StaticFiles[i].path) == 0) return &StaticFiles[i];
+    }
+    return nullptr;
+}
+
+
+static void registerStaticFile(ESP8266WebServer& webServer, const char* path)
+{
+    const StaticFile* filePtr = findStaticFile(path);
+    webServer.on(path, HTTP_GET, [&webServer, filePtr]() { serveStaticFile(webServer, *filePtr); });
+}
+
+
+BENCHMARK(StaticFileServeLogo)
+{
+    ESP8266WebServer webServer;
+    registerStaticFile(webServer, "/Logo.png");
+
+    size_t responseSize = 0;
+    while (state.keepRunning())
+    {
+        webServer.hostRequest("/Logo.png");
+        responseSize = webServer.hostResponse().body.length();
+    }
+    state.setOutputSize(responseSize);
+}
+
+
+BENCHMARK(StaticFileServeStyles)
+{
+    ESP8266WebServer webServer;
+    registerStaticFile(webServer, "/styles.css");
+
+    size_t responseSize = 0;
+    while (state.keepRunning())
+    {
+        webServer.hostRequest("/styles.css");
+        responseSize = webServer.hostResponse().body.length();
+    }
+    state.setOutputSize(responseSize);
+}
+
+
+BENCHMARK(StaticFileNotModified)
+{
+    ESP8266WebServer webServer;
+    registerStaticFile(webServer, "/Logo.png");
+    String etag = FPSTR(findStaticFile("/Logo.png")->etag);
+
+    size_t responseSize = 0;
+    while (state.keepRunning())
+    {
+        webServer.hostSetRequestHeader("If-None-Match", etag);
+        webServer.hostRequest("/Logo.png");
+        if (webServer.hostResponse().code != 304) abort();
+        responseSize = webServer.hostResponse().body.length();
+    }
+    state.setOutputSize(responseSize);
+}
@@ -0,0 +1,42 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <StringBuilder.h>
+
+BENCHMARK(StringBuilderPrintFlash)
+{
+    StringBuilder output(4096);
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        if ((i++ & 0x3F) == 0) output.clear();
+        output.print(F("<tr><td>Some constant text</td></tr>"));
+    }
+}
+
+
+BENCHMARK(StringBuilderPrintf)
+{
+    StringBuilder output(4096);
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        if ((i & 0x3F) == 0) output.clear();
+        output.printf(F("<td><div>+%0.1f</div><div>-%d</div></td>"), 12.5F, i++);
+    }
+}
+
+
+BENCHMARK(StringBuilderPrintString)
+{
+    StringBuilder output(4096);
+    String text = F("A String which doesn't fit in the SSO buffer");
+
+    uint32_t i = 0;
+    while (state.keepRunning())
+    {
+        if ((i++ & 0x3F) == 0) output.clear();
+        output.print(text);
+    }
+}
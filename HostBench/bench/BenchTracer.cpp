@@ -0,0 +1,43 @@
+#include "Benchmark.h"
+#include <Arduino.h>
+#include <Tracer.h>
+
+class NullPrint : public Print
+{
+    public:
+        size_t write(uint8_t) override
+        {
+            return 1;
+        }
+
+        size_t write(const uint8_t*, size_t size) override
+        {
+            return size;
+        }
+};
+
+
+BENCHMARK(TraceDisabled)
+{
+    while (state.keepRunning())
+        TRACE(F("Value: %d\n"), 42);
+}
+
+
+BENCHMARK(TracerScope)
+{
+    while (state.keepRunning())
+        Tracer tracer(F("handleHttpRootRequest"));
+}
+
+
+// Tracer has no way to detach the output again, so this must be the last benchmark
+// (BenchTracer.cpp is linked last).
+BENCHMARK(TraceEnabled)
+{
+    static NullPrint nullPrint;
+    Tracer::traceTo(nullPrint);
+
+    while (state.keepRunning())
+        TRACE(F("Value: %d\n"), 42);
+}
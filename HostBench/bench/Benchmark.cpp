@@ -0,0 +1,195 @@
+#include "Benchmark.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+
+struct BenchmarkInfo
+{
+    const char* name;
+    BenchmarkFunction function;
+};
+
+struct BenchmarkResult
+{
+    double nanosPerOp;
+    double allocsPerOp;
+    double bytesPerOp;
+};
+
+
+static std::vector<BenchmarkInfo>& getBenchmarks()
+{
+    static std::vector<BenchmarkInfo> benchmarks;
+    return benchmarks;
+}
+
+
+BenchmarkRegistration::BenchmarkRegistration(const char* name, BenchmarkFunction function)
+{
+    getBenchmarks().push_back({ name, function });
+}
+
+
+void BenchmarkState::start()
+{
+    _startHeap = hostHeapStats();
+    _startTime = std::chrono::steady_clock::now();
+}
+
+
+void BenchmarkState::stop()
+{
+    _stopTime = std::chrono::steady_clock::now();
+    _stopHeap = hostHeapStats();
+}
+
+
+static BenchmarkResult runBenchmark(const BenchmarkInfo& benchmark, double minTimeSeconds, size_t& outputSize)
+{
+    uint64_t iterations = 1;
+    while (true)
+    {
+        BenchmarkState state(iterations);
+        benchmark.function(state);
+
+        double elapsedNanos = state.elapsedNanos();
+        if ((elapsedNanos >= minTimeSeconds * 1e9) || (iterations >= (1ULL << 40)))
+        {
+            outputSize = state.outputSize();
+            BenchmarkResult result;
+            result.nanosPerOp = elapsedNanos / iterations;
+            result.allocsPerOp = double(state.allocations()) / iterations;
+            result.bytesPerOp = double(state.allocatedBytes()) / iterations;
+            return result;
+        }
+
+        // Aim a bit beyond the minimum time to avoid another round.
+        double factor = (elapsedNanos < 1000) ? 100 : (minTimeSeconds * 1e9 * 1.4 / elapsedNanos);
+        if (factor < 2) factor = 2;
+        if (factor > 100) factor = 100;
+        iterations = uint64_t(iterations * factor);
+    }
+}
+
+
+static std::map<std::string, BenchmarkResult> loadResults(const char* filename)
+{
+    std::map<std::string, BenchmarkResult> results;
+    FILE* file = fopen(filename, "r");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Unable to open '%s'\n", filename);
+        exit(2);
+    }
+
+    char name[128];
+    BenchmarkResult result;
+    while (fscanf(file, "%127s %lf %lf %lf", name, &result.nanosPerOp, &result.allocsPerOp, &result.bytesPerOp) == 4)
+        results[name] = result;
+
+    fclose(file);
+    return results;
+}
+
+
+static void printUsage(const char* program)
+{
+    printf("Usage: %s [filter] [--min-time <seconds>] [--save <file>] [--compare <file>] [--tolerance <percent>]\n", program);
+    printf("  filter       Only run benchmarks whose name contains this string.\n");
+    printf("  --save       Write the results to a file (baseline).\n");
+    printf("  --compare    Compare with a baseline file; exit code 1 if a benchmark regressed.\n");
+    printf("  --tolerance  Allowed slowdown in percent before reporting a regression (default 10).\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+    const char* filter = nullptr;
+    const char* saveFile = nullptr;
+    const char* compareFile = nullptr;
+    double minTimeSeconds = 0.2;
+    double tolerancePercent = 10;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if ((strcmp(arg, "--min-time") == 0) && hasValue)
+            minTimeSeconds = atof(argv[++i]);
+        else if ((strcmp(arg, "--save") == 0) && hasValue)
+            saveFile = argv[++i];
+        else if ((strcmp(arg, "--compare") == 0) && hasValue)
+            compareFile = argv[++i];
+        else if ((strcmp(arg, "--tolerance") == 0) && hasValue)
+            tolerancePercent = atof(argv[++i]);
+        else if ((strcmp(arg, "--help") == 0) || (arg[0] == '-'))
+        {
+            printUsage(argv[0]);
+            return (strcmp(arg, "--help") == 0) ? 0 : 2;
+        }
+        else
+            filter = arg;
+    }
+
+    std::map<std::string, BenchmarkResult> baseline;
+    if (compareFile != nullptr)
+        baseline = loadResults(compareFile);
+
+    FILE* save = nullptr;
+    if (saveFile != nullptr)
+    {
+        save = fopen(saveFile, "w");
+        if (save == nullptr)
+        {
+            fprintf(stderr, "Unable to create '%s'\n", saveFile);
+            return 2;
+        }
+    }
+
+    printf("%-40s %12s %10s %10s %8s %s\n", "Benchmark", "ns/op", "allocs/op", "bytes/op", "output", (compareFile == nullptr) ? "" : "vs. baseline");
+
+    int regressions = 0;
+    for (const BenchmarkInfo& benchmark : getBenchmarks())
+    {
+        if ((filter != nullptr) && (strstr(benchmark.name, filter) == nullptr))
+            continue;
+
+        size_t outputSize = 0;
+        BenchmarkResult result = runBenchmark(benchmark, minTimeSeconds, outputSize);
+
+        char output[24] = "";
+        if (outputSize != 0)
+            snprintf(output, sizeof(output), "%zu", outputSize);
+
+        printf("%-40s %12.1f %10.2f %10.1f %8s", benchmark.name, result.nanosPerOp, result.allocsPerOp, result.bytesPerOp, output);
+
+        auto baselineIter = baseline.find(benchmark.name);
+        if (baselineIter != baseline.end())
+        {
+            const BenchmarkResult& base = baselineIter->second;
+            double change = (base.nanosPerOp > 0) ? (result.nanosPerOp / base.nanosPerOp - 1) * 100 : 0;
+            bool slower = change > tolerancePercent;
+            bool moreAllocs = result.allocsPerOp > base.allocsPerOp + 0.5;
+            printf(" %+6.1f%%%s%s", change, slower ? " SLOWER" : "", moreAllocs ? " MORE ALLOCS" : "");
+            if (slower || moreAllocs) regressions++;
+        }
+        printf("\n");
+        fflush(stdout);
+
+        if (save != nullptr)
+            fprintf(save, "%s %.3f %.3f %.3f\n", benchmark.name, result.nanosPerOp, result.allocsPerOp, result.bytesPerOp);
+    }
+
+    if (save != nullptr)
+        fclose(save);
+
+    if (regressions != 0)
+    {
+        printf("%d benchmark(s) regressed.\n", regressions);
+        return 1;
+    }
+    return 0;
+}
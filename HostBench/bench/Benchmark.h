@@ -0,0 +1,101 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+#include <chrono>
+#include <HostHeap.h>
+
+// Minimal micro-benchmark harness for the host build.
+// Usage:
+//
+//   BENCHMARK(StaticLogAdd)
+//   {
+//       StaticLog<Entry> log(100);      // Setup; not measured
+//       Entry entry;
+//       while (state.keepRunning())     // Measured loop
+//           log.add(&entry);
+//   }
+//
+// The runner calibrates the number of iterations so each benchmark runs
+// for at least the minimum time, and reports time and heap allocations per iteration.
+class BenchmarkState
+{
+    public:
+        BenchmarkState(uint64_t iterations)
+            : _iterations(iterations), _remaining(iterations) {}
+
+        inline bool keepRunning()
+        {
+            if (_remaining == _iterations)
+                start();
+            if (_remaining-- != 0)
+                return true;
+            stop();
+            return false;
+        }
+
+        inline uint64_t iterations() const
+        {
+            return _iterations;
+        }
+
+        // Optional: size of the output produced per iteration (e.g. page size).
+        void setOutputSize(size_t size)
+        {
+            _outputSize = size;
+        }
+
+        double elapsedNanos() const
+        {
+            return std::chrono::duration<double, std::nano>(_stopTime - _startTime).count();
+        }
+
+        uint64_t allocations() const
+        {
+            return _stopHeap.allocations - _startHeap.allocations;
+        }
+
+        uint64_t allocatedBytes() const
+        {
+            return _stopHeap.allocatedBytes - _startHeap.allocatedBytes;
+        }
+
+        size_t outputSize() const
+        {
+            return _outputSize;
+        }
+
+    private:
+        uint64_t _iterations;
+        uint64_t _remaining;
+        size_t _outputSize = 0;
+        std::chrono::steady_clock::time_point _startTime;
+        std::chrono::steady_clock::time_point _stopTime;
+        HostHeapStats _startHeap;
+        HostHeapStats _stopHeap;
+
+        void start();
+        void stop();
+};
+
+
+typedef void (*BenchmarkFunction)(BenchmarkState& state);
+
+struct BenchmarkRegistration
+{
+    BenchmarkRegistration(const char* name, BenchmarkFunction function);
+};
+
+#define BENCHMARK(name) \
+    static void name(BenchmarkState& state); \
+    static BenchmarkRegistration name##Registration(#name, name); \
+    static void name(BenchmarkState& state)
+
+// Prevents the compiler from optimizing away a computed value.
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif
@@ -0,0 +1,356 @@
+#include <Arduino.h>
+#include <HostHeap.h>
+#include <Aquarea.h>
+#include <TopicPublisher.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+// Replays captured Aquarea packets through Aquarea::receive and the topic decoding.
+//
+// Capture file: one packet per line, "<time> <packet bytes in hex>" (see Aquarea::writeCaptureLine).
+// Lines starting with '#' are comments. The lines in AquaMon/test.txt are accepted as well:
+// test packets ("t <hex>") and bare hex bytes (e.g. mutilated packets), which may be separated by spaces.
+// Other lines are skipped.
+// Bytes on one line are received as a burst; a line which doesn't contain a valid packet is
+// followed by a receive gap, so it is repaired or rejected like on the real UART.
+//
+// The decoded topic values of all packets can be saved and compared later to catch decoding regressions.
+// Optionally, the changed topics are published to an MQTT broker (e.g. a local mosquitto) after each packet.
+
+#define REPLAY_GAP_MS 200 // More than the receive gap in Aquarea.cpp
+
+struct CapturedPacket
+{
+    uint32_t time;
+    std::vector<uint8_t> data;
+};
+
+
+static TopicPublisher* _mqttPublisherPtr = nullptr;
+
+
+static void onTopicsChanged(const TopicSet& changedTopics)
+{
+    if (_mqttPublisherPtr != nullptr)
+        _mqttPublisherPtr->addChangedTopics(changedTopics);
+}
+
+
+static bool parseHex(const char* hex, std::vector<uint8_t>& data)
+{
+    int nibbles = 0;
+    uint8_t byte = 0;
+    for (const char* c = hex; *c != 0; c++)
+    {
+        if (isspace(*c)) continue;
+        if (!isxdigit(*c)) return false;
+        byte = (byte << 4) | (isdigit(*c) ? (*c - '0') : (toupper(*c) - 'A' + 10));
+        if (++nibbles % 2 == 0)
+            data.push_back(byte);
+    }
+    return (nibbles != 0) && (nibbles % 2 == 0);
+}
+
+
+static std::vector<CapturedPacket> loadCapture(const char* filename, int& skippedLines)
+{
+    std::vector<CapturedPacket> packets;
+    FILE* file = fopen(filename, "r");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Unable to open '%s'\n", filename);
+        exit(2);
+    }
+
+    skippedLines = 0;
+    char line[1024];
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        if ((line[0] == '#') || (line[strspn(line, " \t\r\n")] == 0))
+            continue;
+
+        // "<time> <hex>" has exactly two fields, the first one decimal; else the line may be bare hex.
+        CapturedPacket packet;
+        packet.time = 0;
+        char* hex = line;
+        if ((line[0] == 't') && (line[1] == ' '))
+            hex = line + 2;
+        else if (isdigit(line[0]))
+        {
+            char* timeEnd;
+            uint32_t time = strtoul(line, &timeEnd, 10);
+            char* hexStart = timeEnd + strspn(timeEnd, " \t");
+            char* hexEnd = hexStart + strcspn(hexStart, " \t\r\n");
+            if ((hexStart != timeEnd) && (hexEnd[strspn(hexEnd, " \t\r\n")] == 0))
+            {
+                packet.time = time;
+                hex = hexStart;
+            }
+        }
+
+        if (!parseHex(hex, packet.data))
+        {
+            skippedLines++;
+            continue;
+        }
+
+        // Skip duplicates caused by polling faster than packets are received
+        if (!packets.empty() && (packet.time != 0) && (packet.time == packets.back().time) && (packet.data == packets.back().data))
+            continue;
+
+        packets.push_back(packet);
+    }
+
+    fclose(file);
+    return packets;
+}
+
+
+static void writeTopicValues(FILE* file, size_t packetIndex, Aquarea& heatPump)
+{
+    fprintf(file, "%zu %s", packetIndex, heatPump.isPacketValid() ? "valid" : "invalid");
+    if (heatPump.isPacketValid())
+    {
+        const TopicValues& topicValues = heatPump.getTopicValues();
+        for (int i = 0; i < NUMBER_OF_TOPICS; i++)
+            fprintf(file, " %g", topicValues.values[i]);
+    }
+    fprintf(file, "\n");
+}
+
+
+// Receives one captured packet; returns the number of packets completed (valid or rejected).
+static int replayPacket(Aquarea& heatPump, const CapturedPacket& packet, FILE* results, size_t packetIndex)
+{
+    int completed = 0;
+    Serial.hostFeed(packet.data.data(), packet.data.size());
+    do
+    {
+        if (heatPump.receive())
+        {
+            completed++;
+            if (results != nullptr)
+                writeTopicValues(results, packetIndex, heatPump);
+            if ((_mqttPublisherPtr != nullptr) && heatPump.isPacketValid())
+                _mqttPublisherPtr->publish();
+        }
+    }
+    while (Serial.available());
+
+    if (heatPump.isReceiving())
+    {
+        hostAdvanceMillis(REPLAY_GAP_MS);
+        if (heatPump.receive())
+        {
+            completed++;
+            if (results != nullptr)
+                writeTopicValues(results, packetIndex, heatPump);
+        }
+    }
+    return completed;
+}
+
+
+// Compares the results line by line; reports the topics which differ.
+static int compareResults(Aquarea& heatPump, const char* expectedFile, FILE* actual)
+{
+    FILE* expected = fopen(expectedFile, "r");
+    if (expected == nullptr)
+    {
+        fprintf(stderr, "Unable to open '%s'\n", expectedFile);
+        exit(2);
+    }
+    rewind(actual);
+
+    int differences = 0;
+    int lineNumber = 0;
+    char expectedLine[4096];
+    char actualLine[4096];
+    while (true)
+    {
+        bool hasExpected = fgets(expectedLine, sizeof(expectedLine), expected) != nullptr;
+        bool hasActual = fgets(actualLine, sizeof(actualLine), actual) != nullptr;
+        if (!hasExpected && !hasActual) break;
+        lineNumber++;
+        if (hasExpected != hasActual)
+        {
+            printf("Line %d: %s\n", lineNumber, hasExpected ? "missing" : "unexpected");
+            differences++;
+            break;
+        }
+        if (strcmp(expectedLine, actualLine) == 0)
+            continue;
+
+        differences++;
+        if (differences > 20) continue;
+
+        // Find the topics which differ (fields after packet index and state)
+        char* expectedSave;
+        char* actualSave;
+        char* expectedField = strtok_r(expectedLine, " \n", &expectedSave);
+        char* actualField = strtok_r(actualLine, " \n", &actualSave);
+        for (int field = 0; (expectedField != nullptr) || (actualField != nullptr); field++)
+        {
+            const char* e = (expectedField == nullptr) ? "-" : expectedField;
+            const char* a = (actualField == nullptr) ? "-" : actualField;
+            if (strcmp(e, a) != 0)
+            {
+                String name = (field < 2)
+                    ? String((field == 0) ? "packet" : "state")
+                    : heatPump.getTopic(static_cast<TopicId>(field - 2)).getName();
+                printf("Line %d: %s = %s, expected %s\n", lineNumber, name.c_str(), a, e);
+            }
+            if (expectedField != nullptr) expectedField = strtok_r(nullptr, " \n", &expectedSave);
+            if (actualField != nullptr) actualField = strtok_r(nullptr, " \n", &actualSave);
+        }
+    }
+
+    fclose(expected);
+    return differences;
+}
+
+
+static void printUsage(const char* program)
+{
+    printf("Usage: %s <capture file> [--repeat <count>] [--save <file>] [--compare <file>] [--mqtt <host>[:<port>]]\n", program);
+    printf("  --repeat   Replay the capture this many times to measure throughput (default 1).\n");
+    printf("  --save     Write the decoded topic values of all packets to a file.\n");
+    printf("  --compare  Compare the decoded topic values with a saved file; exit code 1 if different.\n");
+    printf("  --mqtt     Publish the changed topics of the first pass to an MQTT broker (topic prefix \"aquarea_replay\").\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+    const char* captureFile = nullptr;
+    const char* saveFile = nullptr;
+    const char* compareFile = nullptr;
+    char* mqttBroker = nullptr;
+    int repeat = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if ((strcmp(arg, "--repeat") == 0) && hasValue)
+            repeat = std::max(atoi(argv[++i]), 1);
+        else if ((strcmp(arg, "--save") == 0) && hasValue)
+            saveFile = argv[++i];
+        else if ((strcmp(arg, "--compare") == 0) && hasValue)
+            compareFile = argv[++i];
+        else if ((strcmp(arg, "--mqtt") == 0) && hasValue)
+            mqttBroker = argv[++i];
+        else if ((strcmp(arg, "--help") == 0) || (arg[0] == '-') || (captureFile != nullptr))
+        {
+            printUsage(argv[0]);
+            return (strcmp(arg, "--help") == 0) ? 0 : 2;
+        }
+        else
+            captureFile = arg;
+    }
+    if (captureFile == nullptr)
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    int skippedLines;
+    std::vector<CapturedPacket> packets = loadCapture(captureFile, skippedLines);
+    size_t totalBytes = 0;
+    for (const CapturedPacket& packet : packets)
+        totalBytes += packet.data.size();
+    printf("%zu packets (%zu bytes) loaded, %d lines skipped.\n", packets.size(), totalBytes, skippedLines);
+
+    // First pass: record the decoded topic values (not measured)
+    FILE* results = nullptr;
+    if (saveFile != nullptr)
+        results = fopen(saveFile, "w+");
+    else if (compareFile != nullptr)
+        results = tmpfile();
+    if ((results == nullptr) && ((saveFile != nullptr) || (compareFile != nullptr)))
+    {
+        fprintf(stderr, "Unable to create '%s'\n", (saveFile != nullptr) ? saveFile : "temporary file");
+        return 2;
+    }
+    Aquarea heatPump;
+    WiFiMQTTClient mqttClient;
+    TopicPublisher mqttPublisher(heatPump, mqttClient);
+    if (mqttBroker != nullptr)
+    {
+        char* portPtr = strchr(mqttBroker, ':');
+        uint16_t port = MQTT_DEFAULT_PORT;
+        if (portPtr != nullptr)
+        {
+            *portPtr++ = 0;
+            port = atoi(portPtr);
+        }
+        if (!mqttClient.begin(mqttBroker, "aquarea_replay", nullptr, nullptr, port))
+        {
+            fprintf(stderr, "MQTT: %s\n", mqttClient.getLastError());
+            return 2;
+        }
+        mqttPublisher.begin("aquarea_replay");
+        heatPump.onTopicsChanged(TopicSet().set(), onTopicsChanged);
+        _mqttPublisherPtr = &mqttPublisher;
+    }
+
+    for (size_t i = 0; i < packets.size(); i++)
+        replayPacket(heatPump, packets[i], results, i);
+    if (results != nullptr)
+        fflush(results);
+
+    printf("Valid: %u, repaired: %u, invalid: %u\n",
+        heatPump.getValidPackets(),
+        heatPump.getRepairedPackets(),
+        heatPump.getInvalidPackets());
+
+    if (_mqttPublisherPtr != nullptr)
+    {
+        printf("MQTT: %u messages in %u batches (%u bytes)\n",
+            mqttClient.getPublishedMessages(),
+            mqttClient.getSentBatches(),
+            mqttClient.getSentBytes());
+        mqttClient.end();
+        _mqttPublisherPtr = nullptr;
+    }
+
+    // Measured passes
+    uint64_t completed = 0;
+    HostHeapStats startHeap = hostHeapStats();
+    auto startTime = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < repeat; pass++)
+    {
+        for (const CapturedPacket& packet : packets)
+            completed += replayPacket(heatPump, packet, nullptr, 0);
+    }
+    auto stopTime = std::chrono::steady_clock::now();
+    HostHeapStats stopHeap = hostHeapStats();
+
+    double elapsedNanos = std::chrono::duration<double, std::nano>(stopTime - startTime).count();
+    if (completed != 0)
+    {
+        printf("%llu packets in %.1f ms: %.1f ns/packet, %.1f MB/s, %.2f allocs/packet\n",
+            static_cast<unsigned long long>(completed),
+            elapsedNanos / 1e6,
+            elapsedNanos / completed,
+            totalBytes * repeat * 1e3 / elapsedNanos,
+            double(stopHeap.allocations - startHeap.allocations) / completed);
+    }
+
+    int differences = 0;
+    if (compareFile != nullptr)
+    {
+        differences = compareResults(heatPump, compareFile, results);
+        if (differences != 0)
+            printf("%d packet(s) decoded differently.\n", differences);
+        else
+            printf("Decoded topic values match '%s'.\n", compareFile);
+    }
+    if (results != nullptr)
+        fclose(results);
+    return (differences == 0) ? 0 : 1;
+}
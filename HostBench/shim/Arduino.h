@@ -0,0 +1,62 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host shim for the Arduino core (ESP8266 flavor).
+// Only what libraries/custom and the sketches' host-buildable classes need.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <functional>
+#include <pgmspace.h>
+#include <WString.h>
+#include <Print.h>
+#include <Stream.h>
+#include <HardwareSerial.h>
+#include <Esp.h>
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x00
+#define OUTPUT 0x01
+#define INPUT_PULLUP 0x02
+#define FUNCTION_3 0x08
+#define LED_BUILTIN 2
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+inline float pow10f(float x)
+{
+    return powf(10.0F, x);
+}
+
+inline uint16_t word(uint8_t highByte, uint8_t lowByte)
+{
+    return (highByte << 8) | lowByte;
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+// Host-only: advance the simulated clock used by millis() and micros().
+// When never called, millis() and micros() follow the real monotonic clock.
+void hostAdvanceMillis(unsigned long ms);
+
+#endif
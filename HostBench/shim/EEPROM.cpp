@@ -0,0 +1,51 @@
+#include "EEPROM.h"
+
+EEPROMClass EEPROM;
+
+
+void EEPROMClass::begin(size_t size)
+{
+    if (size > sizeof(_data))
+        size = sizeof(_data);
+    if (_size == 0)
+        memset(_data, 0xFF, sizeof(_data));
+    _size = size;
+}
+
+
+uint8_t EEPROMClass::read(int address)
+{
+    if ((address < 0) || (static_cast<size_t>(address) >= _size))
+        return 0;
+    return _data[address];
+}
+
+
+void EEPROMClass::write(int address, uint8_t value)
+{
+    if ((address < 0) || (static_cast<size_t>(address) >= _size))
+        return;
+    if (_data[address] != value)
+    {
+        _data[address] = value;
+        _dirty = true;
+    }
+}
+
+
+bool EEPROMClass::commit()
+{
+    if (_size == 0)
+        return false;
+    if (_dirty)
+        _commits++;
+    _dirty = false;
+    return true;
+}
+
+
+bool EEPROMClass::end()
+{
+    bool result = commit();
+    return result;
+}
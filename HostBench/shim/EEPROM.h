@@ -0,0 +1,69 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Host shim for the emulated EEPROM of the ESP8266 core.
+// The contents live in RAM only; commit() just counts the number of commits.
+class EEPROMClass
+{
+    public:
+        void begin(size_t size);
+        uint8_t read(int address);
+        void write(int address, uint8_t value);
+        bool commit();
+        bool end();
+
+        uint8_t* getDataPtr()
+        {
+            _dirty = true;
+            return _data;
+        }
+
+        const uint8_t* getConstDataPtr() const
+        {
+            return _data;
+        }
+
+        size_t length()
+        {
+            return _size;
+        }
+
+        template <typename T>
+        T& get(int address, T& t)
+        {
+            if (address + sizeof(T) <= _size)
+                memcpy(&t, _data + address, sizeof(T));
+            return t;
+        }
+
+        template <typename T>
+        const T& put(int address, const T& t)
+        {
+            if (address + sizeof(T) <= _size)
+            {
+                memcpy(_data + address, &t, sizeof(T));
+                _dirty = true;
+            }
+            return t;
+        }
+
+        // Host-only
+        uint32_t hostCommits()
+        {
+            return _commits;
+        }
+
+    private:
+        uint8_t _data[4096];
+        size_t _size = 0;
+        bool _dirty = false;
+        uint32_t _commits = 0;
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
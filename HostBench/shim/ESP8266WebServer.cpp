@@ -0,0 +1,205 @@
+#include "ESP8266WebServer.h"
+
+
+void ESP8266WebServer::on(const String& uri, THandlerFunction handler)
+{
+    on(uri, HTTP_ANY, handler);
+}
+
+
+void ESP8266WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler)
+{
+    Route route;
+    route.uri = uri;
+    route.method = method;
+    route.handler = handler;
+    _routes.push_back(route);
+}
+
+
+void ESP8266WebServer::onNotFound(THandlerFunction handler)
+{
+    _notFoundHandler = handler;
+}
+
+
+String ESP8266WebServer::arg(const String& name) const
+{
+    for (const auto& arg : _args)
+        if (arg.first == name) return arg.second;
+    return String();
+}
+
+
+String ESP8266WebServer::arg(int index) const
+{
+    return (index < args()) ? _args[index].second : String();
+}
+
+
+String ESP8266WebServer::argName(int index) const
+{
+    return (index < args()) ? _args[index].first : String();
+}
+
+
+bool ESP8266WebServer::hasArg(const String& name) const
+{
+    for (const auto& arg : _args)
+        if (arg.first == name) return true;
+    return false;
+}
+
+
+String ESP8266WebServer::header(const String& name) const
+{
+    for (const auto& header : _requestHeaders)
+        if (header.first.equalsIgnoreCase(name)) return header.second;
+    return String();
+}
+
+
+bool ESP8266WebServer::hasHeader(const String& name) const
+{
+    for (const auto& header : _requestHeaders)
+        if (header.first.equalsIgnoreCase(name)) return true;
+    return false;
+}
+
+
+void ESP8266WebServer::sendHeader(const String& name, const String& value, bool first)
+{
+    if (first)
+        _pendingHeaders.insert(_pendingHeaders.begin(), std::make_pair(name, value));
+    else
+        _pendingHeaders.push_back(std::make_pair(name, value));
+}
+
+
+void ESP8266WebServer::startResponse(int code, const char* contentType)
+{
+    _response.code = code;
+    _response.contentType = (contentType == nullptr) ? "text/html" : contentType;
+    _response.headers = _pendingHeaders;
+    _response.chunked = (_contentLength == CONTENT_LENGTH_UNKNOWN);
+    _pendingHeaders.clear();
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+}
+
+
+void ESP8266WebServer::send(int code, const char* contentType, const String& content)
+{
+    send(code, contentType, content.c_str(), content.length());
+}
+
+
+void ESP8266WebServer::send(int code, const String& contentType, const String& content)
+{
+    send(code, contentType.c_str(), content.c_str(), content.length());
+}
+
+
+void ESP8266WebServer::send(int code, const char* contentType, const char* content)
+{
+    send(code, contentType, content, strlen(content));
+}
+
+
+void ESP8266WebServer::send(int code, const char* contentType, const char* content, size_t contentLength)
+{
+    startResponse(code, contentType);
+    _response.body.concat(content, contentLength);
+    _response.contentCalls++;
+}
+
+
+void ESP8266WebServer::send_P(int code, PGM_P contentType, PGM_P content)
+{
+    send(code, contentType, content);
+}
+
+
+void ESP8266WebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength)
+{
+    send(code, contentType, content, contentLength);
+}
+
+
+void ESP8266WebServer::sendContent(const String& content)
+{
+    sendContent(content.c_str(), content.length());
+}
+
+
+void ESP8266WebServer::sendContent(const char* content)
+{
+    sendContent(content, strlen(content));
+}
+
+
+void ESP8266WebServer::sendContent(const char* content, size_t size)
+{
+    // Like the real server: an empty chunk terminates a chunked response.
+    if (_response.chunked && (size == 0))
+        return;
+    _response.body.concat(content, size);
+    _response.contentCalls++;
+}
+
+
+void ESP8266WebServer::sendContent_P(PGM_P content)
+{
+    sendContent(content);
+}
+
+
+void ESP8266WebServer::sendContent_P(PGM_P content, size_t size)
+{
+    sendContent(content, size);
+}
+
+
+bool ESP8266WebServer::chunkedResponseModeStart(int code, const char* contentType)
+{
+    startResponse(code, contentType);
+    _response.chunked = true;
+    return true;
+}
+
+
+void ESP8266WebServer::chunkedResponseFinalize()
+{
+    _response.chunked = false;
+}
+
+
+void ESP8266WebServer::hostSetRequestHeader(const String& name, const String& value)
+{
+    _requestHeaders.push_back(std::make_pair(name, value));
+}
+
+
+bool ESP8266WebServer::hostRequest(const String& uri, HTTPMethod method, const std::vector<std::pair<String, String>>& args)
+{
+    _uri = uri;
+    _method = method;
+    _args = args;
+    _response = HostResponse();
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+
+    bool handled = false;
+    for (Route& route : _routes)
+    {
+        if ((route.uri == uri) && ((route.method == HTTP_ANY) || (route.method == method)))
+        {
+            route.handler();
+            handled = true;
+            break;
+        }
+    }
+    if (!handled && _notFoundHandler)
+        _notFoundHandler();
+
+    _requestHeaders.clear();
+    return handled;
+}
@@ -0,0 +1,128 @@
+#ifndef ESP8266WEBSERVER_H
+#define ESP8266WEBSERVER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+enum HTTPMethod
+{
+    HTTP_ANY,
+    HTTP_GET,
+    HTTP_HEAD,
+    HTTP_POST,
+    HTTP_PUT,
+    HTTP_PATCH,
+    HTTP_DELETE,
+    HTTP_OPTIONS
+};
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+// Host shim for the ESP8266 web server.
+// There is no socket; hostRequest() dispatches a request to the registered
+// handler and the response is collected in memory, so that page renderers
+// can be benchmarked and their output inspected.
+class ESP8266WebServer
+{
+    public:
+        typedef std::function<void(void)> THandlerFunction;
+
+        struct HostResponse
+        {
+            int code = 0;
+            String contentType;
+            std::vector<std::pair<String, String>> headers;
+            String body;
+            size_t contentCalls = 0;
+            bool chunked = false;
+        };
+
+        ESP8266WebServer(int = 80) {}
+
+        void begin() {}
+        void close() {}
+        void handleClient() {}
+
+        void on(const String& uri, THandlerFunction handler);
+        void on(const String& uri, HTTPMethod method, THandlerFunction handler);
+        void onNotFound(THandlerFunction handler);
+
+        const String& uri() const
+        {
+            return _uri;
+        }
+
+        HTTPMethod method() const
+        {
+            return _method;
+        }
+
+        int args() const
+        {
+            return _args.size();
+        }
+
+        String arg(const String& name) const;
+        String arg(int index) const;
+        String argName(int index) const;
+        bool hasArg(const String& name) const;
+
+        String header(const String& name) const;
+        bool hasHeader(const String& name) const;
+        void collectHeaders(const char*[], size_t) {}
+
+        void setContentLength(size_t contentLength)
+        {
+            _contentLength = contentLength;
+        }
+
+        void sendHeader(const String& name, const String& value, bool first = false);
+
+        void send(int code, const char* contentType = nullptr, const String& content = String());
+        void send(int code, const String& contentType, const String& content);
+        void send(int code, const char* contentType, const char* content);
+        void send(int code, const char* contentType, const char* content, size_t contentLength);
+        void send_P(int code, PGM_P contentType, PGM_P content);
+        void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength);
+
+        void sendContent(const String& content);
+        void sendContent(const char* content);
+        void sendContent(const char* content, size_t size);
+        void sendContent_P(PGM_P content);
+        void sendContent_P(PGM_P content, size_t size);
+
+        bool chunkedResponseModeStart(int code, const char* contentType);
+        void chunkedResponseFinalize();
+
+        // Host-only
+        bool hostRequest(const String& uri, HTTPMethod method = HTTP_GET, const std::vector<std::pair<String, String>>& args = {});
+        void hostSetRequestHeader(const String& name, const String& value);
+        HostResponse& hostResponse()
+        {
+            return _response;
+        }
+
+    private:
+        struct Route
+        {
+            String uri;
+            HTTPMethod method;
+            THandlerFunction handler;
+        };
+
+        std::vector<Route> _routes;
+        THandlerFunction _notFoundHandler;
+        String _uri;
+        HTTPMethod _method = HTTP_GET;
+        std::vector<std::pair<String, String>> _args;
+        std::vector<std::pair<String, String>> _requestHeaders;
+        std::vector<std::pair<String, String>> _pendingHeaders;
+        size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+        HostResponse _response;
+
+        void startResponse(int code, const char* contentType);
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef ESP_H
+#define ESP_H
+
+#include <stdint.h>
+#include <HostHeap.h>
+
+// Host shim for the ESP8266 EspClass.
+// Heap figures are simulated: a fixed heap size minus the bytes currently
+// allocated through malloc/new by the host process (see HostHeap.h).
+class EspClass
+{
+    public:
+        static constexpr uint32_t SIMULATED_HEAP_SIZE = 52 * 1024;
+
+        uint32_t getFreeHeap()
+        {
+            int64_t free = int64_t(SIMULATED_HEAP_SIZE) - hostHeapStats().liveBytes;
+            return (free < 0) ? 0 : free;
+        }
+
+        uint32_t getMaxFreeBlockSize()
+        {
+            return getFreeHeap();
+        }
+
+        uint8_t getHeapFragmentation()
+        {
+            return 0;
+        }
+
+        uint32_t getChipId()
+        {
+            return 0x00C0FFEE;
+        }
+
+        uint32_t getCycleCount();
+
+        void restart() {}
+        void reset() {}
+};
+
+extern EspClass ESP;
+
+#endif
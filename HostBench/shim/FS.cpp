@@ -0,0 +1,151 @@
+#include "FS.h"
+#include <map>
+#include <string>
+#include <string.h>
+
+fs::FS SPIFFS;
+
+static std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> _files;
+static uint32_t _writes = 0;
+static size_t _bytesWritten = 0;
+
+
+size_t fs::File::read(uint8_t* buffer, size_t size)
+{
+    if (!_data || (_position >= _data->size()))
+        return 0;
+    if (size > _data->size() - _position)
+        size = _data->size() - _position;
+    memcpy(buffer, _data->data() + _position, size);
+    _position += size;
+    return size;
+}
+
+
+int fs::File::read()
+{
+    uint8_t b;
+    return (read(&b, 1) == 1) ? b : -1;
+}
+
+
+size_t fs::File::write(const uint8_t* buffer, size_t size)
+{
+    if (!_data)
+        return 0;
+    if (_position + size > _data->size())
+        _data->resize(_position + size);
+    memcpy(_data->data() + _position, buffer, size);
+    _position += size;
+    _writes++;
+    _bytesWritten += size;
+    return size;
+}
+
+
+size_t fs::File::write(uint8_t b)
+{
+    return write(&b, 1);
+}
+
+
+bool fs::File::seek(uint32_t position, SeekMode mode)
+{
+    if (!_data)
+        return false;
+    size_t newPosition = position;
+    if (mode == SeekCur)
+        newPosition += _position;
+    else if (mode == SeekEnd)
+        newPosition += _data->size();
+    if (newPosition > _data->size())
+        return false;
+    _position = newPosition;
+    return true;
+}
+
+
+size_t fs::File::position() const
+{
+    return _position;
+}
+
+
+size_t fs::File::size() const
+{
+    return _data ? _data->size() : 0;
+}
+
+
+int fs::File::available()
+{
+    return _data ? _data->size() - _position : 0;
+}
+
+
+void fs::File::close()
+{
+    _data.reset();
+    _position = 0;
+}
+
+
+bool fs::FS::begin()
+{
+    return true;
+}
+
+
+void fs::FS::end()
+{
+}
+
+
+fs::File fs::FS::open(const char* path, const char* mode)
+{
+    auto it = _files.find(path);
+    if (mode[0] == 'r')
+        return (it == _files.end()) ? File() : File(it->second, false);
+
+    std::shared_ptr<std::vector<uint8_t>> data;
+    if (it == _files.end())
+    {
+        data = std::make_shared<std::vector<uint8_t>>();
+        _files[path] = data;
+    }
+    else
+        data = it->second;
+    if (mode[0] == 'w')
+        data->clear();
+    return File(data, mode[0] == 'a');
+}
+
+
+bool fs::FS::exists(const char* path)
+{
+    return _files.find(path) != _files.end();
+}
+
+
+bool fs::FS::remove(const char* path)
+{
+    return _files.erase(path) != 0;
+}
+
+
+uint32_t fs::FS::hostWrites()
+{
+    return _writes;
+}
+
+
+size_t fs::FS::hostBytesWritten()
+{
+    return _bytesWritten;
+}
+
+
+void fs::FS::hostFormat()
+{
+    _files.clear();
+}
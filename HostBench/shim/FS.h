@@ -0,0 +1,76 @@
+#ifndef FS_H
+#define FS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include <vector>
+#include <WString.h>
+
+// Host shim for the SPIFFS file system of the ESP8266 core.
+// Files live in RAM only; every write() call is counted as one flash write.
+namespace fs
+{
+    enum SeekMode
+    {
+        SeekSet = 0,
+        SeekCur = 1,
+        SeekEnd = 2
+    };
+
+    class File
+    {
+        public:
+            File() {}
+            File(std::shared_ptr<std::vector<uint8_t>> data, bool append)
+                : _data(data), _position(append ? data->size() : 0) {}
+
+            operator bool() const
+            {
+                return _data != nullptr;
+            }
+
+            size_t read(uint8_t* buffer, size_t size);
+            int read();
+            size_t write(const uint8_t* buffer, size_t size);
+            size_t write(uint8_t b);
+            bool seek(uint32_t position, SeekMode mode = SeekSet);
+            size_t position() const;
+            size_t size() const;
+            int available();
+            void close();
+
+        private:
+            std::shared_ptr<std::vector<uint8_t>> _data;
+            size_t _position = 0;
+    };
+
+    class FS
+    {
+        public:
+            bool begin();
+            void end();
+            File open(const char* path, const char* mode);
+            File open(const String& path, const char* mode)
+            {
+                return open(path.c_str(), mode);
+            }
+            bool exists(const char* path);
+            bool remove(const char* path);
+
+            // Host-only
+            uint32_t hostWrites();
+            size_t hostBytesWritten();
+            void hostFormat();
+    };
+}
+
+using fs::File;
+using fs::FS;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+extern fs::FS SPIFFS;
+
+#endif
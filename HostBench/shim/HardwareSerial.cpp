@@ -0,0 +1,68 @@
+#include "HardwareSerial.h"
+
+HardwareSerial Serial;
+
+
+int HardwareSerial::available()
+{
+    return _rxBuffer.size() - _rxIndex;
+}
+
+
+int HardwareSerial::read()
+{
+    if (_rxIndex >= _rxBuffer.size())
+        return -1;
+    return _rxBuffer[_rxIndex++];
+}
+
+
+int HardwareSerial::peek()
+{
+    if (_rxIndex >= _rxBuffer.size())
+        return -1;
+    return _rxBuffer[_rxIndex];
+}
+
+
+size_t HardwareSerial::readBytes(char* buffer, size_t length)
+{
+    // Recorded data never "arrives later", so don't wait for the timeout.
+    size_t count = std::min(length, _rxBuffer.size() - _rxIndex);
+    memcpy(buffer, _rxBuffer.data() + _rxIndex, count);
+    _rxIndex += count;
+    return count;
+}
+
+
+size_t HardwareSerial::write(uint8_t data)
+{
+    _txBuffer.push_back(data);
+    return 1;
+}
+
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size)
+{
+    _txBuffer.insert(_txBuffer.end(), buffer, buffer + size);
+    return size;
+}
+
+
+void HardwareSerial::hostFeed(const uint8_t* data, size_t size)
+{
+    if (_rxIndex == _rxBuffer.size())
+    {
+        _rxBuffer.clear();
+        _rxIndex = 0;
+    }
+    _rxBuffer.insert(_rxBuffer.end(), data, data + size);
+}
+
+
+void HardwareSerial::hostClear()
+{
+    _rxBuffer.clear();
+    _rxIndex = 0;
+    _txBuffer.clear();
+}
@@ -0,0 +1,68 @@
+#ifndef HARDWARESERIAL_H
+#define HARDWARESERIAL_H
+
+#include <Stream.h>
+#include <vector>
+
+enum SerialConfig
+{
+    SERIAL_8N1 = 0x1c,
+    SERIAL_8E1 = 0x1e
+};
+
+// Host shim for the UART.
+// Received bytes come from an in-memory buffer filled with hostFeed(),
+// transmitted bytes are collected in an in-memory buffer as well.
+// This allows benchmarks and replay drivers to push recorded data through
+// code that reads from Serial, without any real hardware.
+class HardwareSerial : public Stream
+{
+    public:
+        void begin(unsigned long baud, SerialConfig = SERIAL_8N1)
+        {
+            _baud = baud;
+        }
+
+        void end() {}
+
+        void setRxBufferSize(size_t) {}
+        void swap() {}
+        void setDebugOutput(bool) {}
+
+        int available() override;
+        int read() override;
+        int peek() override;
+        size_t readBytes(char* buffer, size_t length) override;
+        using Stream::readBytes;
+
+        size_t write(uint8_t data) override;
+        size_t write(const uint8_t* buffer, size_t size) override;
+        using Print::write;
+
+        // Host-only
+        void hostFeed(const uint8_t* data, size_t size);
+        void hostFeed(const char* str)
+        {
+            hostFeed(reinterpret_cast<const uint8_t*>(str), strlen(str));
+        }
+        void hostClear();
+        const std::vector<uint8_t>& hostTransmitted()
+        {
+            return _txBuffer;
+        }
+
+        operator bool() const
+        {
+            return true;
+        }
+
+    private:
+        unsigned long _baud = 0;
+        std::vector<uint8_t> _rxBuffer;
+        size_t _rxIndex = 0;
+        std::vector<uint8_t> _txBuffer;
+};
+
+extern HardwareSerial Serial;
+
+#endif
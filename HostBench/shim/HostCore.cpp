@@ -0,0 +1,144 @@
+#include <Arduino.h>
+#include <HostHeap.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <malloc.h>
+
+extern "C"
+{
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* ptr, size_t size);
+    void __libc_free(void* ptr);
+}
+
+EspClass ESP;
+
+static std::atomic<uint64_t> _allocations(0);
+static std::atomic<uint64_t> _frees(0);
+static std::atomic<uint64_t> _allocatedBytes(0);
+static std::atomic<int64_t> _liveBytes(0);
+static std::atomic<unsigned long> _simulatedMillis(0);
+static const auto _startTime = std::chrono::steady_clock::now();
+
+
+static inline void trackAllocation(void* ptr)
+{
+    if (ptr == nullptr) return;
+    size_t size = malloc_usable_size(ptr);
+    _allocations.fetch_add(1, std::memory_order_relaxed);
+    _allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    _liveBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+
+static inline void trackFree(void* ptr)
+{
+    if (ptr == nullptr) return;
+    _frees.fetch_add(1, std::memory_order_relaxed);
+    _liveBytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+}
+
+
+extern "C" void* malloc(size_t size)
+{
+    void* ptr = __libc_malloc(size);
+    trackAllocation(ptr);
+    return ptr;
+}
+
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+    void* ptr = __libc_calloc(count, size);
+    trackAllocation(ptr);
+    return ptr;
+}
+
+
+extern "C" void* realloc(void* ptr, size_t size)
+{
+    trackFree(ptr);
+    void* newPtr = __libc_realloc(ptr, size);
+    trackAllocation(newPtr);
+    return newPtr;
+}
+
+
+extern "C" void free(void* ptr)
+{
+    trackFree(ptr);
+    __libc_free(ptr);
+}
+
+
+HostHeapStats hostHeapStats()
+{
+    HostHeapStats result;
+    result.allocations = _allocations.load(std::memory_order_relaxed);
+    result.frees = _frees.load(std::memory_order_relaxed);
+    result.allocatedBytes = _allocatedBytes.load(std::memory_order_relaxed);
+    result.liveBytes = _liveBytes.load(std::memory_order_relaxed);
+    return result;
+}
+
+
+unsigned long micros()
+{
+    auto elapsed = std::chrono::steady_clock::now() - _startTime;
+    unsigned long realMicros = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    return realMicros + _simulatedMillis.load(std::memory_order_relaxed) * 1000;
+}
+
+
+unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+
+void hostAdvanceMillis(unsigned long ms)
+{
+    _simulatedMillis.fetch_add(ms, std::memory_order_relaxed);
+}
+
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+
+void delayMicroseconds(unsigned int us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+
+void yield()
+{
+}
+
+
+uint32_t EspClass::getCycleCount()
+{
+    // Pretend to run at 80 MHz like the ESP8266 default.
+    return micros() * 80;
+}
+
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+
+void digitalWrite(uint8_t, uint8_t)
+{
+}
+
+
+int digitalRead(uint8_t)
+{
+    return LOW;
+}
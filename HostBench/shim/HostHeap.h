@@ -0,0 +1,19 @@
+#ifndef HOSTHEAP_H
+#define HOSTHEAP_H
+
+#include <stdint.h>
+
+// Heap statistics of the host process.
+// The host core interposes malloc/calloc/realloc/free (and thereby new/delete),
+// so every heap operation performed by the code under test is counted.
+struct HostHeapStats
+{
+    uint64_t allocations;
+    uint64_t frees;
+    uint64_t allocatedBytes;
+    int64_t liveBytes;
+};
+
+HostHeapStats hostHeapStats();
+
+#endif
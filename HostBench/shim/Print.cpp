@@ -0,0 +1,199 @@
+#include "Print.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--)
+    {
+        if (write(*buffer++) == 0) break;
+        n++;
+    }
+    return n;
+}
+
+
+size_t Print::vprintf(const char* format, va_list args)
+{
+    // Same approach as the ESP8266 core: format into a small stack buffer and
+    // only fall back to the heap if the result doesn't fit.
+    char temp[64];
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    int length = vsnprintf(temp, sizeof(temp), format, argsCopy);
+    va_end(argsCopy);
+    if (length < 0)
+        return 0;
+
+    if (static_cast<size_t>(length) < sizeof(temp))
+        return write(reinterpret_cast<const uint8_t*>(temp), length);
+
+    char* buffer = static_cast<char*>(malloc(length + 1));
+    if (buffer == nullptr)
+        return 0;
+    vsnprintf(buffer, length + 1, format, args);
+    size_t result = write(reinterpret_cast<const uint8_t*>(buffer), length);
+    free(buffer);
+    return result;
+}
+
+
+size_t Print::printf(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    size_t result = vprintf(format, args);
+    va_end(args);
+    return result;
+}
+
+
+size_t Print::printf_P(PGM_P format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    size_t result = vprintf(format, args);
+    va_end(args);
+    return result;
+}
+
+
+size_t Print::print(const __FlashStringHelper* str)
+{
+    return write(reinterpret_cast<const char*>(str));
+}
+
+
+size_t Print::print(const String& str)
+{
+    return write(str.c_str(), str.length());
+}
+
+
+size_t Print::print(const char* str)
+{
+    return write(str);
+}
+
+
+size_t Print::print(char c)
+{
+    return write(static_cast<uint8_t>(c));
+}
+
+
+size_t Print::print(unsigned char value, int base)
+{
+    return print(static_cast<unsigned long>(value), base);
+}
+
+
+size_t Print::print(int value, int base)
+{
+    return print(static_cast<long>(value), base);
+}
+
+
+size_t Print::print(unsigned int value, int base)
+{
+    return print(static_cast<unsigned long>(value), base);
+}
+
+
+size_t Print::print(long value, int base)
+{
+    if (base == DEC)
+        return printf("%ld", value);
+    return print(static_cast<unsigned long>(value), base);
+}
+
+
+size_t Print::print(unsigned long value, int base)
+{
+    char buffer[8 * sizeof(long) + 1];
+    char* p = buffer + sizeof(buffer) - 1;
+    *p = 0;
+    if (base < 2) base = DEC;
+    do
+    {
+        int digit = value % base;
+        *--p = (digit < 10) ? ('0' + digit) : ('A' + digit - 10);
+        value /= base;
+    } while (value != 0);
+    return write(p);
+}
+
+
+size_t Print::print(double value, int digits)
+{
+    return printf("%.*f", digits, value);
+}
+
+
+size_t Print::println()
+{
+    return write("\r\n");
+}
+
+
+size_t Print::println(const __FlashStringHelper* str)
+{
+    return print(str) + println();
+}
+
+
+size_t Print::println(const String& str)
+{
+    return print(str) + println();
+}
+
+
+size_t Print::println(const char* str)
+{
+    return print(str) + println();
+}
+
+
+size_t Print::println(char c)
+{
+    return print(c) + println();
+}
+
+
+size_t Print::println(unsigned char value, int base)
+{
+    return print(value, base) + println();
+}
+
+
+size_t Print::println(int value, int base)
+{
+    return print(value, base) + println();
+}
+
+
+size_t Print::println(unsigned int value, int base)
+{
+    return print(value, base) + println();
+}
+
+
+size_t Print::println(long value, int base)
+{
+    return print(value, base) + println();
+}
+
+
+size_t Print::println(unsigned long value, int base)
+{
+    return print(value, base) + println();
+}
+
+
+size_t Print::println(double value, int digits)
+{
+    return print(value, digits) + println();
+}
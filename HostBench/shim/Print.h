@@ -0,0 +1,64 @@
+#ifndef PRINT_H
+#define PRINT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <WString.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print
+{
+    public:
+        virtual ~Print() {}
+
+        virtual size_t write(uint8_t) = 0;
+        virtual size_t write(const uint8_t* buffer, size_t size);
+
+        size_t write(const char* str)
+        {
+            return (str == nullptr) ? 0 : write(reinterpret_cast<const uint8_t*>(str), strlen(str));
+        }
+
+        size_t write(const char* buffer, size_t size)
+        {
+            return write(reinterpret_cast<const uint8_t*>(buffer), size);
+        }
+
+        virtual void flush() {}
+
+        size_t printf(const char* format, ...) __attribute__ ((format (printf, 2, 3)));
+        size_t printf_P(PGM_P format, ...) __attribute__ ((format (printf, 2, 3)));
+
+        size_t print(const __FlashStringHelper* str);
+        size_t print(const String& str);
+        size_t print(const char* str);
+        size_t print(char c);
+        size_t print(unsigned char value, int base = DEC);
+        size_t print(int value, int base = DEC);
+        size_t print(unsigned int value, int base = DEC);
+        size_t print(long value, int base = DEC);
+        size_t print(unsigned long value, int base = DEC);
+        size_t print(double value, int digits = 2);
+
+        size_t println(const __FlashStringHelper* str);
+        size_t println(const String& str);
+        size_t println(const char* str);
+        size_t println(char c);
+        size_t println(unsigned char value, int base = DEC);
+        size_t println(int value, int base = DEC);
+        size_t println(unsigned int value, int base = DEC);
+        size_t println(long value, int base = DEC);
+        size_t println(unsigned long value, int base = DEC);
+        size_t println(double value, int digits = 2);
+        size_t println();
+
+    protected:
+        size_t vprintf(const char* format, va_list args);
+};
+
+#endif
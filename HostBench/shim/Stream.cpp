@@ -0,0 +1,154 @@
+#include "Stream.h"
+#include <Arduino.h>
+
+
+int Stream::timedRead()
+{
+    unsigned long startMillis = millis();
+    do
+    {
+        int c = read();
+        if (c >= 0) return c;
+        yield();
+    } while (millis() - startMillis < _timeout);
+    return -1;
+}
+
+
+int Stream::timedPeek()
+{
+    unsigned long startMillis = millis();
+    do
+    {
+        int c = peek();
+        if (c >= 0) return c;
+        yield();
+    } while (millis() - startMillis < _timeout);
+    return -1;
+}
+
+
+int Stream::peekNextDigit(bool detectDecimal)
+{
+    while (true)
+    {
+        int c = timedPeek();
+        if ((c < 0) || (c == '-') || ((c >= '0') && (c <= '9')) || (detectDecimal && (c == '.')))
+            return c;
+        read();
+    }
+}
+
+
+bool Stream::find(const char* target)
+{
+    size_t targetLength = strlen(target);
+    if (targetLength == 0) return true;
+
+    size_t index = 0;
+    int c;
+    while ((c = timedRead()) >= 0)
+    {
+        if (c == target[index])
+        {
+            if (++index == targetLength) return true;
+        }
+        else
+            index = (c == target[0]) ? 1 : 0;
+    }
+    return false;
+}
+
+
+bool Stream::find(char target)
+{
+    char str[2] = { target, 0 };
+    return find(str);
+}
+
+
+long Stream::parseInt()
+{
+    int c = peekNextDigit(false);
+    if (c < 0) return 0;
+
+    bool negative = false;
+    long value = 0;
+    do
+    {
+        if (c == '-')
+            negative = true;
+        else
+            value = value * 10 + c - '0';
+        read();
+        c = timedPeek();
+    } while ((c >= '0') && (c <= '9'));
+
+    return negative ? -value : value;
+}
+
+
+float Stream::parseFloat()
+{
+    int c = peekNextDigit(true);
+    if (c < 0) return 0;
+
+    char buffer[32];
+    size_t length = 0;
+    while ((length < sizeof(buffer) - 1) && ((c == '-') || (c == '.') || ((c >= '0') && (c <= '9'))))
+    {
+        buffer[length++] = c;
+        read();
+        c = timedPeek();
+    }
+    buffer[length] = 0;
+    return atof(buffer);
+}
+
+
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+    size_t count = 0;
+    while (count < length)
+    {
+        int c = timedRead();
+        if (c < 0) break;
+        *buffer++ = c;
+        count++;
+    }
+    return count;
+}
+
+
+size_t Stream::readBytesUntil(char terminator, char* buffer, size_t length)
+{
+    size_t count = 0;
+    while (count < length)
+    {
+        int c = timedRead();
+        if ((c < 0) || (c == terminator)) break;
+        *buffer++ = c;
+        count++;
+    }
+    return count;
+}
+
+
+String Stream::readString()
+{
+    String result;
+    int c;
+    while ((c = timedRead()) >= 0)
+        result += static_cast<char>(c);
+    return result;
+}
+
+
+String Stream::readStringUntil(char terminator)
+{
+    String result;
+    int c;
+    while (((c = timedRead()) >= 0) && (c != terminator))
+        result += static_cast<char>(c);
+    return result;
+}
@@ -0,0 +1,51 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <Print.h>
+
+class Stream : public Print
+{
+    public:
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+
+        void setTimeout(unsigned long timeout)
+        {
+            _timeout = timeout;
+        }
+
+        unsigned long getTimeout()
+        {
+            return _timeout;
+        }
+
+        bool find(const char* target);
+        bool find(char target);
+
+        long parseInt();
+        float parseFloat();
+
+        virtual size_t readBytes(char* buffer, size_t length);
+        size_t readBytes(uint8_t* buffer, size_t length)
+        {
+            return readBytes(reinterpret_cast<char*>(buffer), length);
+        }
+        size_t readBytesUntil(char terminator, char* buffer, size_t length);
+        size_t readBytesUntil(char terminator, uint8_t* buffer, size_t length)
+        {
+            return readBytesUntil(terminator, reinterpret_cast<char*>(buffer), length);
+        }
+
+        virtual String readString();
+        String readStringUntil(char terminator);
+
+    protected:
+        unsigned long _timeout = 1000;
+
+        int timedRead();
+        int timedPeek();
+        int peekNextDigit(bool detectDecimal);
+};
+
+#endif
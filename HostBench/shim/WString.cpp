@@ -0,0 +1,607 @@
+#include "WString.h"
+#include <stdio.h>
+#include <ctype.h>
+
+static const char* toBase(char* buffer, size_t size, unsigned long long value, bool negative, unsigned char base)
+{
+    if ((base < 2) || (base > 36)) base = 10;
+
+    char* end = buffer + size - 1;
+    char* p = end;
+    *p = 0;
+    do
+    {
+        int digit = value % base;
+        *--p = (digit < 10) ? ('0' + digit) : ('a' + digit - 10);
+        value /= base;
+    } while ((value != 0) && (p > buffer + 1));
+
+    if (negative) *--p = '-';
+    return p;
+}
+
+
+String::String(const char* cstr)
+{
+    if (cstr != nullptr) copy(cstr, strlen(cstr));
+}
+
+
+String::String(const char* cstr, size_t length)
+{
+    if (cstr != nullptr) copy(cstr, length);
+}
+
+
+String::String(const String& str)
+{
+    copy(str._buffer, str._length);
+}
+
+
+String::String(String&& rval) noexcept
+{
+    move(rval);
+}
+
+
+String::String(const __FlashStringHelper* str)
+    : String(reinterpret_cast<const char*>(str))
+{
+}
+
+
+String::String(char c)
+{
+    char buffer[2] = { c, 0 };
+    copy(buffer, 1);
+}
+
+
+String::String(unsigned char value, unsigned char base)
+    : String(static_cast<unsigned long long>(value), base)
+{
+}
+
+
+String::String(int value, unsigned char base)
+    : String(static_cast<long long>(value), base)
+{
+}
+
+
+String::String(unsigned int value, unsigned char base)
+    : String(static_cast<unsigned long long>(value), base)
+{
+}
+
+
+String::String(long value, unsigned char base)
+    : String(static_cast<long long>(value), base)
+{
+}
+
+
+String::String(unsigned long value, unsigned char base)
+    : String(static_cast<unsigned long long>(value), base)
+{
+}
+
+
+String::String(long long value, unsigned char base)
+{
+    char buffer[72];
+    bool negative = (value < 0) && (base == 10);
+    unsigned long long magnitude = negative ? -static_cast<unsigned long long>(value) : value;
+    const char* digits = toBase(buffer, sizeof(buffer), magnitude, negative, base);
+    copy(digits, strlen(digits));
+}
+
+
+String::String(unsigned long long value, unsigned char base)
+{
+    char buffer[72];
+    const char* digits = toBase(buffer, sizeof(buffer), value, false, base);
+    copy(digits, strlen(digits));
+}
+
+
+String::String(float value, unsigned char decimalPlaces)
+    : String(static_cast<double>(value), decimalPlaces)
+{
+}
+
+
+String::String(double value, unsigned char decimalPlaces)
+{
+    char buffer[64];
+    int length = snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, value);
+    copy(buffer, length);
+}
+
+
+String::~String()
+{
+    if (!isSSO()) free(_buffer);
+}
+
+
+void String::invalidate()
+{
+    if (!isSSO()) free(_buffer);
+    _buffer = _sso;
+    _buffer[0] = 0;
+    _capacity = SSO_CAPACITY;
+    _length = 0;
+}
+
+
+bool String::reserve(size_t size)
+{
+    return ensureCapacity(size);
+}
+
+
+bool String::ensureCapacity(size_t size)
+{
+    if (_capacity >= size)
+        return true;
+
+    char* newBuffer;
+    if (isSSO())
+    {
+        newBuffer = static_cast<char*>(malloc(size + 1));
+        if (newBuffer != nullptr) memcpy(newBuffer, _sso, _length + 1);
+    }
+    else
+        newBuffer = static_cast<char*>(realloc(_buffer, size + 1));
+    if (newBuffer == nullptr)
+        return false;
+
+    _buffer = newBuffer;
+    _capacity = size;
+    return true;
+}
+
+
+String& String::copy(const char* cstr, size_t length)
+{
+    if (!ensureCapacity(length))
+    {
+        invalidate();
+        return *this;
+    }
+    _length = length;
+    memmove(_buffer, cstr, length);
+    _buffer[length] = 0;
+    return *this;
+}
+
+
+void String::move(String& rhs)
+{
+    if (rhs.isSSO())
+    {
+        copy(rhs._buffer, rhs._length);
+        return;
+    }
+
+    if (!isSSO()) free(_buffer);
+    _buffer = rhs._buffer;
+    _capacity = rhs._capacity;
+    _length = rhs._length;
+    rhs._buffer = rhs._sso;
+    rhs._buffer[0] = 0;
+    rhs._capacity = SSO_CAPACITY;
+    rhs._length = 0;
+}
+
+
+String& String::operator =(const String& rhs)
+{
+    if (this == &rhs) return *this;
+    return copy(rhs._buffer, rhs._length);
+}
+
+
+String& String::operator =(String&& rval) noexcept
+{
+    if (this != &rval) move(rval);
+    return *this;
+}
+
+
+String& String::operator =(const char* cstr)
+{
+    if (cstr == nullptr)
+        invalidate();
+    else
+        copy(cstr, strlen(cstr));
+    return *this;
+}
+
+
+String& String::operator =(const __FlashStringHelper* str)
+{
+    return operator =(reinterpret_cast<const char*>(str));
+}
+
+
+bool String::concat(const char* cstr, size_t length)
+{
+    if (cstr == nullptr) return false;
+    if (length == 0) return true;
+
+    size_t newLength = _length + length;
+    if (!ensureCapacity(newLength))
+        return false;
+
+    memmove(_buffer + _length, cstr, length);
+    _length = newLength;
+    _buffer[_length] = 0;
+    return true;
+}
+
+
+bool String::concat(const String& str)
+{
+    if (&str == this)
+    {
+        String copy(str);
+        return concat(copy._buffer, copy._length);
+    }
+    return concat(str.c_str(), str._length);
+}
+
+
+bool String::concat(const char* cstr)
+{
+    return (cstr != nullptr) && concat(cstr, strlen(cstr));
+}
+
+
+bool String::concat(char c)
+{
+    return concat(&c, 1);
+}
+
+
+bool String::concat(unsigned char value)
+{
+    return concat(String(value));
+}
+
+
+bool String::concat(int value)
+{
+    return concat(String(value));
+}
+
+
+bool String::concat(unsigned int value)
+{
+    return concat(String(value));
+}
+
+
+bool String::concat(long value)
+{
+    return concat(String(value));
+}
+
+
+bool String::concat(unsigned long value)
+{
+    return concat(String(value));
+}
+
+
+bool String::concat(float value)
+{
+    return concat(String(value));
+}
+
+
+bool String::concat(double value)
+{
+    return concat(String(value));
+}
+
+
+bool String::concat(const __FlashStringHelper* str)
+{
+    return concat(reinterpret_cast<const char*>(str));
+}
+
+
+int String::compareTo(const String& str) const
+{
+    return strcmp(c_str(), str.c_str());
+}
+
+
+bool String::equals(const String& str) const
+{
+    return (_length == str._length) && (compareTo(str) == 0);
+}
+
+
+bool String::equals(const char* cstr) const
+{
+    if (cstr == nullptr) return _length == 0;
+    return strcmp(c_str(), cstr) == 0;
+}
+
+
+bool String::equalsIgnoreCase(const String& str) const
+{
+    return (_length == str._length) && (strcasecmp(c_str(), str.c_str()) == 0);
+}
+
+
+bool String::startsWith(const String& prefix) const
+{
+    return startsWith(prefix, 0);
+}
+
+
+bool String::startsWith(const String& prefix, size_t offset) const
+{
+    if (offset + prefix._length > _length) return false;
+    return strncmp(c_str() + offset, prefix.c_str(), prefix._length) == 0;
+}
+
+
+bool String::endsWith(const String& suffix) const
+{
+    if (suffix._length > _length) return false;
+    return strcmp(c_str() + _length - suffix._length, suffix.c_str()) == 0;
+}
+
+
+char String::charAt(size_t index) const
+{
+    return operator [](index);
+}
+
+
+void String::setCharAt(size_t index, char c)
+{
+    if (index < _length) _buffer[index] = c;
+}
+
+
+char String::operator [](size_t index) const
+{
+    return (index < _length) ? _buffer[index] : 0;
+}
+
+
+char& String::operator [](size_t index)
+{
+    static char dummy;
+    if (index >= _length)
+    {
+        dummy = 0;
+        return dummy;
+    }
+    return _buffer[index];
+}
+
+
+int String::indexOf(char ch, size_t fromIndex) const
+{
+    if (fromIndex >= _length) return -1;
+    const char* found = static_cast<const char*>(memchr(_buffer + fromIndex, ch, _length - fromIndex));
+    return (found == nullptr) ? -1 : (found - _buffer);
+}
+
+
+int String::indexOf(const String& str, size_t fromIndex) const
+{
+    if (fromIndex >= _length) return -1;
+    const char* found = strstr(_buffer + fromIndex, str.c_str());
+    return (found == nullptr) ? -1 : (found - _buffer);
+}
+
+
+int String::lastIndexOf(char ch) const
+{
+    if (_length == 0) return -1;
+    const char* found = strrchr(_buffer, ch);
+    return (found == nullptr) ? -1 : (found - _buffer);
+}
+
+
+int String::lastIndexOf(const String& str) const
+{
+    int result = -1;
+    int index = indexOf(str);
+    while (index >= 0)
+    {
+        result = index;
+        index = indexOf(str, index + 1);
+    }
+    return result;
+}
+
+
+String String::substring(size_t beginIndex) const
+{
+    return substring(beginIndex, _length);
+}
+
+
+String String::substring(size_t beginIndex, size_t endIndex) const
+{
+    if (beginIndex > endIndex)
+    {
+        size_t temp = endIndex;
+        endIndex = beginIndex;
+        beginIndex = temp;
+    }
+    if (beginIndex >= _length) return String();
+    if (endIndex > _length) endIndex = _length;
+    return String(_buffer + beginIndex, endIndex - beginIndex);
+}
+
+
+void String::replace(char find, char replace)
+{
+    for (size_t i = 0; i < _length; i++)
+        if (_buffer[i] == find) _buffer[i] = replace;
+}
+
+
+void String::replace(const String& find, const String& replace)
+{
+    if ((_length == 0) || (find._length == 0)) return;
+
+    String result;
+    int start = 0;
+    int index = indexOf(find);
+    while (index >= 0)
+    {
+        result.concat(_buffer + start, index - start);
+        result.concat(replace);
+        start = index + find._length;
+        index = indexOf(find, start);
+    }
+    result.concat(_buffer + start, _length - start);
+    move(result);
+}
+
+
+void String::remove(size_t index)
+{
+    remove(index, static_cast<size_t>(-1));
+}
+
+
+void String::remove(size_t index, size_t count)
+{
+    if (index >= _length) return;
+    if (count > _length - index) count = _length - index;
+    memmove(_buffer + index, _buffer + index + count, _length - index - count);
+    _length -= count;
+    _buffer[_length] = 0;
+}
+
+
+void String::toLowerCase()
+{
+    for (size_t i = 0; i < _length; i++)
+        _buffer[i] = tolower(_buffer[i]);
+}
+
+
+void String::toUpperCase()
+{
+    for (size_t i = 0; i < _length; i++)
+        _buffer[i] = toupper(_buffer[i]);
+}
+
+
+void String::trim()
+{
+    if (_length == 0) return;
+
+    size_t begin = 0;
+    while ((begin < _length) && isspace(_buffer[begin])) begin++;
+    size_t end = _length;
+    while ((end > begin) && isspace(_buffer[end - 1])) end--;
+
+    _length = end - begin;
+    if (begin > 0) memmove(_buffer, _buffer + begin, _length);
+    _buffer[_length] = 0;
+}
+
+
+long String::toInt() const
+{
+    return atol(_buffer);
+}
+
+
+float String::toFloat() const
+{
+    return atof(_buffer);
+}
+
+
+double String::toDouble() const
+{
+    return atof(_buffer);
+}
+
+
+String operator +(const String& lhs, const String& rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const String& lhs, const char* rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const char* lhs, const String& rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const String& lhs, char rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const String& lhs, int rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const String& lhs, unsigned int rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const String& lhs, long rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const String& lhs, unsigned long rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
+
+
+String operator +(const String& lhs, const __FlashStringHelper* rhs)
+{
+    String result(lhs);
+    result.concat(rhs);
+    return result;
+}
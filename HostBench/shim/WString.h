@@ -0,0 +1,167 @@
+#ifndef WSTRING_H
+#define WSTRING_H
+
+// Host shim for the Arduino String class.
+// Mirrors the ESP8266 core: strings up to SSO_CAPACITY chars are stored inline,
+// longer ones are heap-allocated with realloc. That way String churn shows up
+// in the allocation counters of the benchmark runner as it would on the device.
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pgmspace.h>
+
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper*>(pstr_pointer))
+#define F(string_literal) (FPSTR(PSTR(string_literal)))
+
+class String
+{
+    public:
+        String(const char* cstr = "");
+        String(const char* cstr, size_t length);
+        String(const String& str);
+        String(String&& rval) noexcept;
+        String(const __FlashStringHelper* str);
+        explicit String(char c);
+        explicit String(unsigned char value, unsigned char base = 10);
+        explicit String(int value, unsigned char base = 10);
+        explicit String(unsigned int value, unsigned char base = 10);
+        explicit String(long value, unsigned char base = 10);
+        explicit String(unsigned long value, unsigned char base = 10);
+        explicit String(long long value, unsigned char base = 10);
+        explicit String(unsigned long long value, unsigned char base = 10);
+        explicit String(float value, unsigned char decimalPlaces = 2);
+        explicit String(double value, unsigned char decimalPlaces = 2);
+        ~String();
+
+        bool reserve(size_t size);
+
+        inline size_t length() const
+        {
+            return _length;
+        }
+
+        inline bool isEmpty() const
+        {
+            return _length == 0;
+        }
+
+        inline const char* c_str() const
+        {
+            return _buffer;
+        }
+
+        inline char* begin()
+        {
+            return _buffer;
+        }
+
+        inline char* end()
+        {
+            return _buffer + _length;
+        }
+
+        String& operator =(const String& rhs);
+        String& operator =(String&& rval) noexcept;
+        String& operator =(const char* cstr);
+        String& operator =(const __FlashStringHelper* str);
+
+        bool concat(const String& str);
+        bool concat(const char* cstr);
+        bool concat(const char* cstr, size_t length);
+        bool concat(char c);
+        bool concat(unsigned char value);
+        bool concat(int value);
+        bool concat(unsigned int value);
+        bool concat(long value);
+        bool concat(unsigned long value);
+        bool concat(float value);
+        bool concat(double value);
+        bool concat(const __FlashStringHelper* str);
+
+        template <typename T>
+        String& operator +=(T rhs)
+        {
+            concat(rhs);
+            return *this;
+        }
+
+        String& operator +=(const String& rhs)
+        {
+            concat(rhs);
+            return *this;
+        }
+
+        int compareTo(const String& str) const;
+        bool equals(const String& str) const;
+        bool equals(const char* cstr) const;
+        bool equalsIgnoreCase(const String& str) const;
+
+        bool operator ==(const String& rhs) const { return equals(rhs); }
+        bool operator ==(const char* cstr) const { return equals(cstr); }
+        bool operator ==(const __FlashStringHelper* rhs) const { return equals(reinterpret_cast<const char*>(rhs)); }
+        bool operator !=(const String& rhs) const { return !equals(rhs); }
+        bool operator !=(const char* cstr) const { return !equals(cstr); }
+        bool operator !=(const __FlashStringHelper* rhs) const { return !equals(reinterpret_cast<const char*>(rhs)); }
+        bool operator <(const String& rhs) const { return compareTo(rhs) < 0; }
+
+        bool startsWith(const String& prefix) const;
+        bool startsWith(const String& prefix, size_t offset) const;
+        bool endsWith(const String& suffix) const;
+
+        char charAt(size_t index) const;
+        void setCharAt(size_t index, char c);
+        char operator [](size_t index) const;
+        char& operator [](size_t index);
+
+        int indexOf(char ch, size_t fromIndex = 0) const;
+        int indexOf(const String& str, size_t fromIndex = 0) const;
+        int lastIndexOf(char ch) const;
+        int lastIndexOf(const String& str) const;
+
+        String substring(size_t beginIndex) const;
+        String substring(size_t beginIndex, size_t endIndex) const;
+
+        void replace(char find, char replace);
+        void replace(const String& find, const String& replace);
+        void remove(size_t index);
+        void remove(size_t index, size_t count);
+        void toLowerCase();
+        void toUpperCase();
+        void trim();
+
+        long toInt() const;
+        float toFloat() const;
+        double toDouble() const;
+
+    protected:
+        static constexpr size_t SSO_CAPACITY = 10;
+
+        char _sso[SSO_CAPACITY + 1] = { 0 };
+        char* _buffer = _sso;
+        size_t _capacity = SSO_CAPACITY;
+        size_t _length = 0;
+
+        inline bool isSSO() const
+        {
+            return _buffer == _sso;
+        }
+
+        void invalidate();
+        bool ensureCapacity(size_t size);
+        String& copy(const char* cstr, size_t length);
+        void move(String& rhs);
+};
+
+String operator +(const String& lhs, const String& rhs);
+String operator +(const String& lhs, const char* rhs);
+String operator +(const char* lhs, const String& rhs);
+String operator +(const String& lhs, char rhs);
+String operator +(const String& lhs, int rhs);
+String operator +(const String& lhs, unsigned int rhs);
+String operator +(const String& lhs, long rhs);
+String operator +(const String& lhs, unsigned long rhs);
+String operator +(const String& lhs, const __FlashStringHelper* rhs);
+
+#endif
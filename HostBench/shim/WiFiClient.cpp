@@ -0,0 +1,116 @@
+#include "WiFiClient.h"
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <errno.h>
+
+
+int WiFiClient::connect(const char* host, uint16_t port)
+{
+    stop();
+
+    char portString[8];
+    snprintf(portString, sizeof(portString), "%u", port);
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses;
+    if (getaddrinfo(host, portString, &hints, &addresses) != 0)
+        return 0;
+
+    for (addrinfo* address = addresses; address != nullptr; address = address->ai_next)
+    {
+        _socket = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (_socket < 0) continue;
+        if (::connect(_socket, address->ai_addr, address->ai_addrlen) == 0)
+            break;
+        close(_socket);
+        _socket = -1;
+    }
+    freeaddrinfo(addresses);
+
+    return (_socket < 0) ? 0 : 1;
+}
+
+
+uint8_t WiFiClient::connected()
+{
+    if (_socket < 0)
+        return 0;
+
+    // Still connected if data is available or the peer didn't close the connection.
+    uint8_t c;
+    ssize_t result = recv(_socket, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if ((result == 0) || ((result < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)))
+    {
+        stop();
+        return 0;
+    }
+    return 1;
+}
+
+
+void WiFiClient::stop()
+{
+    if (_socket >= 0)
+    {
+        close(_socket);
+        _socket = -1;
+    }
+}
+
+
+void WiFiClient::setNoDelay(bool noDelay)
+{
+    if (_socket < 0) return;
+    int flag = noDelay ? 1 : 0;
+    setsockopt(_socket, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+
+int WiFiClient::available()
+{
+    if (_socket < 0)
+        return 0;
+    int count = 0;
+    ioctl(_socket, FIONREAD, &count);
+    return count;
+}
+
+
+int WiFiClient::read()
+{
+    uint8_t c;
+    return (read(&c, 1) == 1) ? c : -1;
+}
+
+
+int WiFiClient::read(uint8_t* buffer, size_t size)
+{
+    if (_socket < 0)
+        return -1;
+    ssize_t result = recv(_socket, buffer, size, MSG_DONTWAIT);
+    return (result < 0) ? -1 : result;
+}
+
+
+int WiFiClient::peek()
+{
+    if (_socket < 0)
+        return -1;
+    uint8_t c;
+    return (recv(_socket, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 1) ? c : -1;
+}
+
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size)
+{
+    if (_socket < 0)
+        return 0;
+    ssize_t result = send(_socket, buffer, size, MSG_NOSIGNAL);
+    return (result < 0) ? 0 : result;
+}
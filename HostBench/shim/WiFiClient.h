@@ -0,0 +1,43 @@
+#ifndef WIFICLIENT_H
+#define WIFICLIENT_H
+
+#include <Stream.h>
+
+// Host shim for the TCP client, using a POSIX socket.
+// This allows network clients (e.g. WiFiMQTTClient) to be tested against local servers.
+class WiFiClient : public Stream
+{
+    public:
+        ~WiFiClient()
+        {
+            stop();
+        }
+
+        int connect(const char* host, uint16_t port);
+        uint8_t connected();
+        void stop();
+
+        void setNoDelay(bool noDelay);
+
+        int available() override;
+        int read() override;
+        int read(uint8_t* buffer, size_t size);
+        int peek() override;
+
+        size_t write(uint8_t data) override
+        {
+            return write(&data, 1);
+        }
+        size_t write(const uint8_t* buffer, size_t size) override;
+        using Print::write;
+
+        operator bool()
+        {
+            return connected();
+        }
+
+    private:
+        int _socket = -1;
+};
+
+#endif
@@ -0,0 +1,87 @@
+#include <Arduino.h>
+#include <P1Telegram.h>
+#include <stdio.h>
+#include <string.h>
+
+// Host tests for the P1 telegram CRC check (see P1Telegram::verifyCrc).
+
+static const char TelegramBody[] =
+    "/ISK5\\2M550T-1011\r\n"
+    "\r\n"
+    "1-3:0.2.8(50)\r\n"
+    "0-0:1.0.0(181106140429W)\r\n"
+    "1-0:1.8.1(003808.351*kWh)\r\n"
+    "1-0:1.7.0(00.000*kW)\r\n"
+    "0-1:24.2.1(181106140010W)(01569.646*m3)\r\n";
+
+// DSMR 2.2/3 telegrams have no version and no CRC
+static const char LegacyTelegram[] =
+    "/ISk5\\2ME382-1003\r\n"
+    "\r\n"
+    "0-0:96.1.1(4B413650303035303030313631383939)\r\n"
+    "1-0:1.8.1(00185.000*kWh)\r\n"
+    "!\r\n";
+
+static int _failures = 0;
+
+
+static void check(bool condition, const char* testName, const char* description)
+{
+    if (!condition)
+    {
+        printf("FAIL: %s: %s\n", testName, description);
+        _failures++;
+    }
+}
+
+
+static P1Telegram& receiveTelegram(const char* telegramBody, const char* crcLine)
+{
+    static P1Telegram p1Telegram;
+    Serial.hostFeed(telegramBody);
+    Serial.hostFeed(crcLine);
+    while (!p1Telegram.receive(Serial));
+    return p1Telegram;
+}
+
+
+static uint16_t getTelegramCrc()
+{
+    // The CRC error message reports the expected CRC
+    P1Telegram& p1Telegram = receiveTelegram(TelegramBody, "!0000\r\n");
+    unsigned int telegramCrc = 0;
+    unsigned int expectedCrc = 0;
+    sscanf(p1Telegram.getMessage(), "ERROR: P1 CRC error (%X, expected %X)", &telegramCrc, &expectedCrc);
+    return expectedCrc;
+}
+
+
+int main()
+{
+    char crcLine[16];
+    uint16_t crc = getTelegramCrc();
+    check(crc != 0, "CrcErrorMessage", "expected CRC reported");
+
+    snprintf(crcLine, sizeof(crcLine), "!%04X\r\n", crc);
+    check(receiveTelegram(TelegramBody, crcLine).isValid(), "ValidCrc", "telegram accepted");
+
+    snprintf(crcLine, sizeof(crcLine), "!%04x\r\n", crc);
+    check(receiveTelegram(TelegramBody, crcLine).isValid(), "LowerCaseCrc", "telegram accepted");
+
+    snprintf(crcLine, sizeof(crcLine), "!%04X\r\n", crc ^ 1);
+    P1Telegram& p1Telegram = receiveTelegram(TelegramBody, crcLine);
+    check(!p1Telegram.isValid(), "MismatchedCrc", "telegram rejected");
+    char expectedMessage[48];
+    snprintf(expectedMessage, sizeof(expectedMessage), "ERROR: P1 CRC error (%04X, expected %04X).", crc ^ 1, crc);
+    check(strcmp(p1Telegram.getMessage(), expectedMessage) == 0, "MismatchedCrc", "message reports telegram CRC, then expected CRC");
+
+    check(!receiveTelegram(TelegramBody, "!\r\n").isValid(), "MissingCrc", "DSMR 5 telegram rejected");
+    check(!receiveTelegram(TelegramBody, "!1G28\r\n").isValid(), "NonHexCrc", "telegram rejected");
+    check(!receiveTelegram(TelegramBody, "!1F\r\n").isValid(), "TruncatedCrc", "telegram rejected");
+    check(!receiveTelegram(TelegramBody, "!1F28A\r\n").isValid(), "LongCrc", "telegram rejected");
+    check(receiveTelegram(LegacyTelegram, "").isValid(), "LegacyWithoutCrc", "DSMR 3 telegram accepted");
+
+    if (_failures == 0)
+        printf("All P1Telegram tests passed.\n");
+    return (_failures == 0) ? 0 : 1;
+}
@@ -10,9 +10,14 @@
 #include <TimeUtils.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <ChunkedResponse.h>
 #include <Navigation.h>
 #include <HtmlWriter.h>
+#include <BinaryLogWriter.h>
+#include <LogCursor.h>
 #include <Log.h>
+#include <CompressedLog.h>
+#include <FlashLog.h>
 #include <AsyncHTTPRequest_Generic.h>
 #include <Wire.h>
 #include "PersistentData.h"
@@ -21,6 +26,7 @@
 #include "HeatMonClient.h"
 #include "WeatherAPI.h"
 #include "OTGW.h"
+#include "StaticFiles.h"
 
 constexpr int SET_BOILER_RETRY_INTERVAL = 6;
 constexpr int OTGW_WATCHDOG_INTERVAL = 10;
@@ -28,8 +34,11 @@ constexpr int OTGW_STARTUP_TIME = 5;
 constexpr int HTTP_POLL_INTERVAL = 60;
 constexpr uint16_t DATA_VALUE_NONE = 0xFFFF;
 constexpr int EVENT_LOG_LENGTH = 50;
+constexpr int EVENT_LOG_ARENA_SIZE = 2048;
 constexpr int OTGW_MESSAGE_LOG_LENGTH = 40;
-constexpr int OT_LOG_LENGTH = 250;
+constexpr int OT_LOG_LENGTH = 1000;
+constexpr int OT_LOG_BUFFER_SIZE = 8000;
+constexpr int OT_LOG_SEGMENTS = 4;
 constexpr int OT_LOG_PAGE_SIZE = 50;
 constexpr int PWM_PERIOD = 10 * SECONDS_PER_MINUTE;
 constexpr int TSET_OVERRIDE_DURATION = 20 * SECONDS_PER_MINUTE;
@@ -96,6 +105,7 @@ const char* Files[] PROGMEM =
 const char* ContentTypeHtml = "text/html;charset=UTF-8";
 const char* ContentTypeJson = "application/json";
 const char* ContentTypeText = "text/plain";
+const char* ContentTypeBinary = "application/octet-stream";
 const char* ButtonClass = "button";
 
 const char* BoilerLevelNames[5] = {"Off", "Pump-only", "Low", "High", "Thermostat"};
@@ -135,12 +145,28 @@ WiFiNTP TimeServer;
 WiFiFTPClient FTPClient(2000); // 2s timeout
 HeatMonClient HeatMon;
 WeatherAPI WeatherService;
-StringBuilder HttpResponse(12 * 1024); // 12KB HTTP response buffer
+ChunkedResponse HttpResponse(WebServer, 1536); // 1.5KB HTTP response buffer (larger responses are sent in chunks)
 HtmlWriter Html(HttpResponse, Files[FileId::Logo], Files[FileId::Styles], 40);
-Log<const char> EventLog(EVENT_LOG_LENGTH);
+StringArenaLog EventLog(EVENT_LOG_LENGTH, EVENT_LOG_ARENA_SIZE);
 StringLog OTGWMessageLog(OTGW_MESSAGE_LOG_LENGTH, 10);
-StaticLog<OpenThermLogEntry> OpenThermLog(OT_LOG_LENGTH);
+FlashLog<OpenThermLogEntry, CompressedLog<OpenThermLogEntry, uint16_t, 12>> OpenThermLog("otlog", OT_LOG_SEGMENTS, OT_LOG_LENGTH, OT_LOG_BUFFER_SIZE);
 StaticLog<StatusLogEntry> StatusLog(7); // 7 days
+const BinaryField OpenThermLogFields[] =
+{
+    BINARY_FIELD(OpenThermLogEntry, time),
+    BINARY_FIELD(OpenThermLogEntry, thermostatTSet),
+    BINARY_FIELD(OpenThermLogEntry, thermostatMaxRelModulation),
+    BINARY_FIELD(OpenThermLogEntry, boilerStatus),
+    BINARY_FIELD(OpenThermLogEntry, boilerTSet),
+    BINARY_FIELD(OpenThermLogEntry, boilerRelModulation),
+    BINARY_FIELD(OpenThermLogEntry, tBoiler),
+    BINARY_FIELD(OpenThermLogEntry, tReturn),
+    BINARY_FIELD(OpenThermLogEntry, tBuffer),
+    BINARY_FIELD(OpenThermLogEntry, tOutside),
+    BINARY_FIELD(OpenThermLogEntry, pressure),
+    BINARY_FIELD(OpenThermLogEntry, flowRate),
+    BINARY_FIELD(OpenThermLogEntry, pHeatPump)
+};
 WiFiStateMachine WiFiSM(TimeServer, WebServer, EventLog);
 Navigation Nav;
 
@@ -224,8 +250,9 @@ void setup()
     memset(otgwRequests, 0xFF, sizeof(otgwRequests));
     memset(otgwResponses, 0xFF, sizeof(otgwResponses));
 
+    WiFiSM.registerStaticFiles(StaticFiles, StaticFileCount);
     if (SPIFFS.begin())
-        WiFiSM.registerStaticFiles(Files, FileId::_Last);
+        OpenThermLog.load();
     else
         WiFiSM.logEvent(F("Failed starting SPIFFS"));
 
@@ -288,6 +315,7 @@ void setup()
     WebServer.on("/pump", handleHttpPumpRequest);
     WebServer.on("/traffic", handleHttpOpenThermTrafficRequest);
     WebServer.on("/log-otgw", handleHttpOTGWMessageLogRequest);
+    WebServer.on("/otlog.bin", handleHttpOpenThermLogBinaryRequest);
     WebServer.onNotFound(handleHttpNotFound);
 
     WiFiSM.on(WiFiInitState::TimeServerInitializing, onTimeServerInit);
@@ -657,11 +685,10 @@ void updateStatusLog(time_t time, uint16_t status)
         (time / SECONDS_PER_DAY) > (lastStatusLogEntryPtr->startTime / SECONDS_PER_DAY))
     {
         time_t startOfDay = time - (time % SECONDS_PER_DAY);
-        StatusLogEntry* logEntryPtr = new StatusLogEntry();
-        logEntryPtr->startTime = startOfDay;
-        logEntryPtr->stopTime = startOfDay;
-        lastStatusLogEntryPtr = StatusLog.add(logEntryPtr);
-        delete logEntryPtr;
+        StatusLogEntry newLogEntry;
+        newLogEntry.startTime = startOfDay;
+        newLogEntry.stopTime = startOfDay;
+        lastStatusLogEntryPtr = StatusLog.add(&newLogEntry);
     }
 
     if (status & OpenThermStatus::SlaveCHMode)
@@ -728,9 +755,9 @@ bool trySyncOpenThermLog(Print* printTo)
     {
         if (otLogEntriesToSync > 0)
         {
-            OpenThermLogEntry* prevLogEntryPtr = OpenThermLog.getEntryFromEnd(otLogEntriesToSync + 1);
-            OpenThermLogEntry* otLogEntryPtr = OpenThermLog.getEntryFromEnd(otLogEntriesToSync);
-            writeCsvDataLines(otLogEntryPtr, prevLogEntryPtr, dataClient);
+            // Include the entry before the ones to sync (if any), so step transitions can be written.
+            bool includesPrevEntry = otLogEntriesToSync < OpenThermLog.count();
+            writeCsvDataLines(OpenThermLog.getEntriesFromEnd(otLogEntriesToSync + 1), includesPrevEntry, dataClient);
             otLogEntriesToSync = 0;
         }
         else if (printTo != nullptr)
@@ -1040,7 +1067,7 @@ float getBarValue(float t, float tMin = 20, float tMax = 0)
 }
 
 
-void writeOpenThermTemperatureRow(String label, String cssClass, uint16_t dataValue, float tMin = 20, float tMax = 0)
+void writeOpenThermTemperatureRow(StringRef label, StringRef cssClass, uint16_t dataValue, float tMin = 20, float tMax = 0)
 {
     float value = getDecimal(dataValue);
     float barValue = getBarValue(value, tMin, tMax);
@@ -1067,7 +1094,7 @@ void handleHttpRootRequest()
     for (int i = 0; i <= 4; i++)
         otgwErrors += OTGW.errors[i];
 
-    String ftpSyncTime;
+    StringRef ftpSyncTime;
     if (!PersistentData.isFTPEnabled())
         ftpSyncTime = F("Disabled");
     else if (lastOTLogSyncTime == 0)
@@ -1075,6 +1102,7 @@ void handleHttpRootRequest()
     else
         ftpSyncTime = formatTime("%H:%M", lastOTLogSyncTime);
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Home"), Nav, HTTP_POLL_INTERVAL);
 
     Html.writeDivStart(F("flex-container"));
@@ -1086,7 +1114,7 @@ void handleHttpRootRequest()
     Html.writeRow(F("Uptime"), F("%0.1f days"), float(WiFiSM.getUptime()) / SECONDS_PER_DAY);
     Html.writeRow(F("OTGW Errors"), F("%u"), otgwErrors);
     Html.writeRow(F("OTGW Resets"), F("%u"), OTGW.resets);
-    Html.writeRow(F("FTP Sync"), F("%s"), ftpSyncTime.c_str());
+    Html.writeRow(F("FTP Sync"), ftpSyncTime);
     Html.writeRow(F("Sync entries"), F("%d / %d"), otLogEntriesToSync, PersistentData.ftpSyncEntries);
     if (lastHeatmonUpdateTime != 0)
         Html.writeRow(F("HeatMon"), F("%s"), formatTime("%H:%M", lastHeatmonUpdateTime));
@@ -1101,7 +1129,7 @@ void handleHttpRootRequest()
     Html.writeDivEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 void writeCurrentValues()
@@ -1205,8 +1233,7 @@ void writeStatisticsPerDay()
     Html.writeRowEnd();
 
     uint32_t maxFlameSeconds = getMaxFlameSeconds() + 1; // Prevent division by zero
-    StatusLogEntry* logEntryPtr = StatusLog.getFirstEntry();
-    while (logEntryPtr != nullptr)
+    for (StatusLogEntry* logEntryPtr : StatusLog)
     {
         Html.writeRowStart();
         Html.writeCell(formatTime("%a", logEntryPtr->startTime));
@@ -1220,8 +1247,6 @@ void writeStatisticsPerDay()
         Html.writeBar(float(logEntryPtr->flameSeconds) / maxFlameSeconds, F("flameBar"), false, false);
         Html.writeCellEnd();
         Html.writeRowEnd();
-
-        logEntryPtr = StatusLog.getNextEntry();
     }
 
     Html.writeTableEnd();
@@ -1232,11 +1257,9 @@ void writeStatisticsPerDay()
 uint32_t getMaxFlameSeconds()
 {
     uint32_t result = 0;
-    StatusLogEntry* logEntryPtr = StatusLog.getFirstEntry();
-    while (logEntryPtr != nullptr)
+    for (StatusLogEntry* logEntryPtr : StatusLog)
     {
         result = std::max(result, logEntryPtr->flameSeconds);
-        logEntryPtr = StatusLog.getNextEntry();
     }
     return result;
 }
@@ -1257,6 +1280,7 @@ void handleHttpOpenThermRequest()
         avgBurnerOnTime =  float(totalBurnerHours * 3600) / burnerStarts; 
     }
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("OpenTherm data"), Nav);
 
     Html.writeDivStart(F("flex-container"));
@@ -1318,7 +1342,7 @@ void handleHttpOpenThermRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -1370,10 +1394,10 @@ void handleHttpPumpRequest()
         WiFiSM.logEvent(F("Pump resume"));
     }
 
-    HttpResponse.clear();
+    HttpResponse.begin(200, ContentTypeJson);
     HttpResponse.printf(F("\"%s\""), BoilerLevelNames[currentBoilerLevel]);
 
-    WebServer.send(200, ContentTypeJson, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -1381,6 +1405,7 @@ void handleHttpOpenThermTrafficRequest()
 {
     Tracer tracer(F("handleHttpOpenThermTrafficRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("OpenTherm traffic"), Nav);
     
     Html.writeDivStart(F("flex-container"));
@@ -1393,7 +1418,7 @@ void handleHttpOpenThermTrafficRequest()
     Html.writeDivEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -1401,6 +1426,10 @@ void handleHttpOpenThermLogRequest()
 {
     Tracer tracer(F("handleHttpOpenThermLogRequest"));
 
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, OpenThermLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("OpenTherm log"), Nav);
     
     int currentPage = WebServer.hasArg("page") ? WebServer.arg("page").toInt() : 0;
@@ -1415,12 +1444,10 @@ void handleHttpOpenThermLogRequest()
     }
     Html.writeRowEnd();
 
-    OpenThermLogEntry* otLogEntryPtr = OpenThermLog.getFirstEntry();
-    for (int i = 0; i < (currentPage * OT_LOG_PAGE_SIZE) && otLogEntryPtr != nullptr; i++)
-    {
-        otLogEntryPtr = OpenThermLog.getNextEntry();
-    }
-    for (int j = 0; j < OT_LOG_PAGE_SIZE && otLogEntryPtr != nullptr; j++)
+    auto otLogEntries = incremental
+        ? OpenThermLog.getEntriesSince(cursor)
+        : OpenThermLog.getRange(currentPage * OT_LOG_PAGE_SIZE, OT_LOG_PAGE_SIZE);
+    for (OpenThermLogEntry* otLogEntryPtr : otLogEntries)
     {
         Html.writeRowStart();
         Html.writeCell(formatTime("%H:%M:%S", otLogEntryPtr->time));
@@ -1438,14 +1465,26 @@ void handleHttpOpenThermLogRequest()
         Html.writeCell(getInteger(otLogEntryPtr->boilerRelModulation));
         Html.writeCell(getDecimal(otLogEntryPtr->flowRate));
         Html.writeRowEnd();
-
-        otLogEntryPtr = OpenThermLog.getNextEntry();
     }
 
     Html.writeTableEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
+}
+
+
+void handleHttpOpenThermLogBinaryRequest()
+{
+    Tracer tracer(F("handleHttpOpenThermLogBinaryRequest"));
+
+    time_t since = WebServer.hasArg("since") ? WebServer.arg("since").toInt() : 0;
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, OpenThermLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeBinary);
+    writeBinaryLog(HttpResponse, incremental ? OpenThermLog.getEntriesSince(cursor) : OpenThermLog.getRange(), OpenThermLogFields, since);
+    HttpResponse.end();
 }
 
 
@@ -1453,6 +1492,7 @@ void handleHttpOpenThermLogSyncRequest()
 {
     Tracer tracer(F("handleHttpOpenThermLogSyncRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("FTP Sync"), Nav);
 
     Html.writeParagraph(
@@ -1483,26 +1523,32 @@ void handleHttpOpenThermLogSyncRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
-void writeCsvDataLines(OpenThermLogEntry* otLogEntryPtr, OpenThermLogEntry* prevLogEntryPtr, Print& destination)
+void writeCsvDataLines(CompressedLog<OpenThermLogEntry, uint16_t, 12>::Range otLogEntries, bool firstIsPrevEntry, Print& destination)
 {
-    while (otLogEntryPtr != nullptr)
+    // Log entries are decoded on the fly, so keep a copy of the previous one.
+    OpenThermLogEntry prevLogEntry;
+    bool hasPrevLogEntry = false;
+    for (OpenThermLogEntry* otLogEntryPtr : otLogEntries)
     {
         time_t otLogEntryTime = otLogEntryPtr->time;
         time_t oneSecEarlier = otLogEntryTime - 1;
-        if ((prevLogEntryPtr != nullptr) && (prevLogEntryPtr->time < oneSecEarlier))
+        if (!firstIsPrevEntry || hasPrevLogEntry)
         {
-            // Repeat previous log entry, but one second before this one.
-            // This enforces steep step transitions.
-            writeCsvDataLine(prevLogEntryPtr, oneSecEarlier, destination);
+            if (hasPrevLogEntry && (prevLogEntry.time < oneSecEarlier))
+            {
+                // Repeat previous log entry, but one second before this one.
+                // This enforces steep step transitions.
+                writeCsvDataLine(&prevLogEntry, oneSecEarlier, destination);
+            }
+            writeCsvDataLine(otLogEntryPtr, otLogEntryTime, destination);
         }
-        writeCsvDataLine(otLogEntryPtr, otLogEntryTime, destination);
-        
-        prevLogEntryPtr = otLogEntryPtr;
-        otLogEntryPtr = OpenThermLog.getNextEntry();
+
+        prevLogEntry = *otLogEntryPtr;
+        hasPrevLogEntry = true;
     }
 }
 
@@ -1532,18 +1578,16 @@ void handleHttpOTGWMessageLogRequest()
 {
     Tracer tracer(F("handleHttpOTGWMessageLogRequest"));
 
-    HttpResponse.clear();
+    HttpResponse.begin(200, ContentTypeText);
 
-    const char* otgwMessage = OTGWMessageLog.getFirstEntry();
-    while (otgwMessage != nullptr)
+    for (const char* otgwMessage : OTGWMessageLog)
     {
         HttpResponse.println(otgwMessage);
-        otgwMessage = OTGWMessageLog.getNextEntry();
     }
 
     OTGWMessageLog.clear();
 
-    WebServer.send(200, ContentTypeText, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -1557,20 +1601,21 @@ void handleHttpEventLogRequest()
         WiFiSM.logEvent(F("Event log cleared."));
     }
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Event log"), Nav);
 
-    const char* event = EventLog.getFirstEntry();
-    while (event != nullptr)
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, EventLog, cursor);
+    for (const char* event : incremental ? EventLog.getEntriesSince(cursor) : EventLog.getRange())
     {
         Html.writeDiv(F("%s"), event);
-        event = EventLog.getNextEntry();
     }
 
     Html.writeActionLink(F("clear"), F("Clear event log"), currentTime, ButtonClass);
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -1590,6 +1635,7 @@ void handleHttpCommandFormRequest()
     String tsetLowHref = F("?cmd=CS&value=");
     tsetLowHref += boilerTSet[BoilerLevel::Low];
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("OTGW Command"), Nav);
 
     Html.writeLink(F("?cmd=PR&value=A"), F("OTGW version"), ButtonClass);
@@ -1613,7 +1659,7 @@ void handleHttpCommandFormRequest()
 
     otgwResponse = String();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
@@ -1647,6 +1693,7 @@ void handleHttpConfigFormRequest()
 {
     Tracer tracer(F("handleHttpConfigFormRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Settings"), Nav);
 
     Html.writeFormStart(F("/config"));
@@ -1657,6 +1704,7 @@ void handleHttpConfigFormRequest()
     if (WiFiSM.shouldPerformAction(F("reset")))
     {
         Html.writeParagraph(F("Resetting..."));
+        OpenThermLog.flush();
         WiFiSM.reset();
     }
     else
@@ -1664,7 +1712,7 @@ void handleHttpConfigFormRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse.c_str());
+    HttpResponse.end();
 }
 
 
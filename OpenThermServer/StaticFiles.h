@@ -0,0 +1,1165 @@
+// Generated by tools/embed_static_files.py from data/; do not edit.
+#ifndef STATIC_FILES_H
+#define STATIC_FILES_H
+
+#include <StaticFile.h>
+
+// Calibrate.svg: 951 bytes, 577 bytes gzipped
+static const char Calibrate_svg_Path[] PROGMEM = "/Calibrate.svg";
+static const char Calibrate_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Calibrate_svg_ETag[] PROGMEM = "\"696005dfc9e7601f\"";
+static const uint8_t Calibrate_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x53, 0x4D, 0x8F, 0xDB, 0x20,
+    0x10, 0xBD, 0xE7, 0x57, 0x50, 0x2A, 0xED, 0x09, 0x30, 0x1F, 0xFE, 0x20, 0x59, 0x3B, 0xAB, 0xF6,
+    0xD0, 0xBD, 0x24, 0x97, 0xED, 0xB6, 0x87, 0x5C, 0x56, 0xD4, 0x26, 0x89, 0x25, 0x62, 0x22, 0x9B,
+    0x26, 0xA9, 0xAA, 0xFE, 0xF7, 0x0E, 0x76, 0xBB, 0xEB, 0x4A, 0xB5, 0x61, 0x04, 0x6F, 0x1E, 0x33,
+    0x6F, 0xD0, 0x50, 0x3E, 0xDC, 0x4E, 0x0E, 0x5D, 0x6C, 0x3F, 0xB4, 0xBE, 0xAB, 0xB0, 0x60, 0x1C,
+    0x23, 0xDB, 0xD5, 0xBE, 0x69, 0xBB, 0x43, 0x85, 0xBF, 0x87, 0x3D, 0xD5, 0xF8, 0x61, 0x5D, 0xBE,
+    0xA3, 0x14, 0x7D, 0x39, 0x3B, 0x6F, 0x1A, 0xDB, 0xA0, 0xE0, 0x57, 0xE8, 0xF3, 0xD7, 0x47, 0xF4,
+    0x64, 0xCF, 0x9E, 0xA0, 0xEB, 0xF5, 0xCA, 0x86, 0xCB, 0xA1, 0x87, 0x0D, 0xAB, 0xFD, 0x89, 0xA0,
+    0x47, 0xDB, 0xD9, 0xDE, 0x04, 0xDF, 0xBF, 0xB1, 0xD0, 0xB6, 0xBD, 0xD9, 0x1E, 0x3D, 0x7B, 0xEF,
+    0x06, 0x44, 0xE9, 0x7A, 0x51, 0xC2, 0x09, 0xB4, 0x6F, 0x9D, 0xAB, 0xF0, 0xFB, 0x4F, 0xE3, 0x87,
+    0xD1, 0xB5, 0x6D, 0xC2, 0xB1, 0xC2, 0x9A, 0xF3, 0xF3, 0x0D, 0xA3, 0xA3, 0x6D, 0x0F, 0xC7, 0xF0,
+    0xBA, 0xBD, 0xB4, 0xF6, 0xFA, 0xD1, 0xDF, 0x2A, 0xCC, 0x11, 0x47, 0x4A, 0xC2, 0xC0, 0xA8, 0x6D,
+    0x2A, 0xDC, 0xD6, 0xBE, 0xC3, 0x08, 0x6A, 0xE8, 0x86, 0x0A, 0x1F, 0x43, 0x38, 0xAF, 0x92, 0x24,
+    0x2A, 0xBA, 0x2A, 0xE6, 0xFB, 0x43, 0x22, 0x39, 0xE7, 0x09, 0xE4, 0xC2, 0x90, 0xB2, 0xB1, 0xFB,
+    0x61, 0x5D, 0x0E, 0xE1, 0x87, 0xB3, 0x6B, 0x56, 0xBB, 0x81, 0x8A, 0x9F, 0x51, 0xC1, 0xAA, 0xF3,
+    0x9D, 0xBD, 0xFF, 0x55, 0x26, 0x93, 0xA7, 0x4C, 0x46, 0xDE, 0xA2, 0x0C, 0x6D, 0x80, 0x6D, 0x6D,
+    0x5C, 0xFB, 0x0D, 0xAA, 0xB1, 0x65, 0x32, 0x01, 0x8B, 0xF2, 0x6C, 0xC2, 0x11, 0x41, 0xEA, 0xAD,
+    0xD4, 0x4C, 0x2B, 0x22, 0x05, 0x13, 0x05, 0x91, 0x19, 0x11, 0x05, 0x53, 0x85, 0x63, 0x79, 0x41,
+    0x61, 0x1A, 0x41, 0x04, 0xE1, 0xD3, 0x4F, 0x05, 0x4B, 0x85, 0xA3, 0x39, 0xCD, 0xDF, 0xD0, 0x11,
+    0x23, 0xFC, 0xC8, 0x1D, 0x65, 0xC5, 0x12, 0xC6, 0x46, 0x70, 0x56, 0x08, 0xA2, 0x98, 0x5C, 0xFE,
+    0x97, 0x95, 0x92, 0x94, 0x32, 0x21, 0x99, 0xC8, 0x60, 0x39, 0x0B, 0x44, 0x00, 0x24, 0x82, 0xC9,
+    0xDC, 0x29, 0xA2, 0x66, 0x30, 0x9C, 0x94, 0x84, 0x43, 0x54, 0x22, 0x54, 0x4C, 0x2F, 0x19, 0x5F,
+    0x92, 0x68, 0x68, 0xCA, 0x34, 0x49, 0x21, 0xE3, 0x5C, 0x22, 0x19, 0x25, 0x4A, 0x22, 0x3F, 0xCC,
+    0x22, 0x70, 0x22, 0xD3, 0x79, 0xA2, 0x4C, 0x82, 0x82, 0xCC, 0xA5, 0x4C, 0x29, 0x2A, 0x59, 0x0E,
+    0xD1, 0xD2, 0x34, 0x9A, 0xEC, 0xDF, 0xB4, 0x93, 0xE0, 0xF1, 0x1E, 0x0A, 0xA8, 0xA7, 0x58, 0x82,
+    0xD1, 0xCA, 0x40, 0x01, 0x7F, 0x38, 0x19, 0xCB, 0x73, 0x1A, 0xCD, 0x6E, 0x1B, 0xE5, 0x71, 0x96,
+    0x69, 0x47, 0x33, 0x92, 0x6D, 0x62, 0xF1, 0x51, 0xAE, 0x2E, 0x48, 0xCE, 0x0A, 0x4D, 0x34, 0xCB,
+    0x55, 0x94, 0x91, 0x45, 0x71, 0x79, 0x2C, 0x20, 0x9A, 0x0D, 0x30, 0xE0, 0xB6, 0x53, 0xC6, 0xF5,
+    0xEE, 0xA4, 0x89, 0x10, 0x20, 0x46, 0xA7, 0x93, 0xC9, 0x88, 0xDA, 0x2C, 0x63, 0xE5, 0x12, 0x24,
+    0x41, 0xAC, 0x51, 0x8E, 0x04, 0x3E, 0xAC, 0xF3, 0xDD, 0x69, 0x74, 0x8D, 0x6A, 0x80, 0x31, 0xE9,
+    0x8D, 0xE7, 0xD4, 0x74, 0xC5, 0xE0, 0xA0, 0xA3, 0xDE, 0x08, 0x4D, 0x38, 0x40, 0x63, 0x09, 0x6F,
+    0x7C, 0x98, 0xD1, 0xB3, 0xC3, 0x09, 0xB4, 0x42, 0x6F, 0xEB, 0x30, 0xB6, 0xE1, 0xCB, 0x73, 0x6F,
+    0xBA, 0xE1, 0x6C, 0x7A, 0xDB, 0x85, 0x97, 0x27, 0x40, 0x4D, 0x77, 0x70, 0xF6, 0x05, 0xA3, 0xC6,
+    0x04, 0x43, 0x3B, 0x73, 0xB2, 0x15, 0xBE, 0x73, 0xE1, 0x7E, 0x46, 0x43, 0xAF, 0xB4, 0xBB, 0x43,
+    0xB8, 0xC7, 0xA8, 0x76, 0x66, 0x80, 0x1E, 0x1E, 0x1B, 0xF3, 0xF5, 0x31, 0xC4, 0x36, 0xFF, 0xFB,
+    0x12, 0x60, 0x1D, 0x73, 0xC6, 0x76, 0x5E, 0xFF, 0x06, 0xAF, 0x36, 0x14, 0x45, 0xB7, 0x03, 0x00,
+    0x00,
+};
+
+// Graph.svg: 493 bytes, 302 bytes gzipped
+static const char Graph_svg_Path[] PROGMEM = "/Graph.svg";
+static const char Graph_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Graph_svg_ETag[] PROGMEM = "\"03a7c9b308f8d649\"";
+static const uint8_t Graph_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x90, 0xCB, 0x6E, 0xC2, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xE9, 0x74, 0x4B, 0x1C, 0x3B, 0x71, 0x44, 0x82, 0x30, 0x48, 0xAD,
+    0x54, 0xBA, 0x80, 0x4D, 0x1F, 0xEC, 0x23, 0x62, 0x12, 0xB7, 0xC1, 0x13, 0x39, 0x86, 0xE4, 0xF3,
+    0x6B, 0x50, 0x4B, 0xDB, 0x0F, 0xE8, 0x95, 0x65, 0x69, 0x8E, 0x6D, 0xDD, 0x23, 0xCF, 0x97, 0xE3,
+    0xA1, 0x85, 0x93, 0x76, 0xBD, 0x21, 0xAB, 0x50, 0x30, 0x8E, 0xA0, 0xED, 0x8E, 0x2A, 0x63, 0x6B,
+    0x85, 0x47, 0xBF, 0x8F, 0x72, 0x5C, 0x2E, 0xE6, 0xB7, 0x51, 0x04, 0x6F, 0x5D, 0x4B, 0x65, 0xA5,
+    0x2B, 0xF0, 0x34, 0x83, 0x97, 0xED, 0x0A, 0x9E, 0x75, 0x47, 0x13, 0x18, 0x86, 0x81, 0xF5, 0xA7,
+    0xDA, 0x85, 0x81, 0xED, 0xE8, 0x30, 0x81, 0x95, 0xB6, 0xDA, 0x95, 0x9E, 0xDC, 0xCF, 0x2D, 0xD8,
+    0x98, 0x51, 0x3B, 0x78, 0x25, 0x6A, 0x7B, 0x88, 0xA2, 0xC5, 0xCD, 0x3C, 0xBC, 0x80, 0xC1, 0x54,
+    0xBE, 0x51, 0x98, 0x73, 0xDE, 0x8D, 0x08, 0x8D, 0x36, 0x75, 0xE3, 0xAF, 0xE3, 0xC9, 0xE8, 0xE1,
+    0x9E, 0x46, 0x85, 0x1C, 0x38, 0x24, 0x32, 0x2C, 0x84, 0xBD, 0x69, 0x5B, 0x85, 0x77, 0xFC, 0x12,
+    0x84, 0x60, 0x6E, 0x7B, 0x85, 0x8D, 0xF7, 0xDD, 0x2C, 0x8E, 0xCF, 0x1E, 0x43, 0xCA, 0xC8, 0xD5,
+    0x71, 0x12, 0x8E, 0xE3, 0xD0, 0x80, 0xA1, 0xA8, 0x2B, 0x7D, 0x03, 0x95, 0xC2, 0x8D, 0x84, 0x6C,
+    0x2B, 0x8A, 0x07, 0x09, 0xA2, 0x60, 0x59, 0x96, 0xA4, 0x20, 0x99, 0x94, 0xD3, 0x69, 0x02, 0x09,
+    0x87, 0x2C, 0x6C, 0x4F, 0xA2, 0x40, 0xE8, 0xBD, 0xA3, 0x0F, 0x1D, 0x3A, 0x1E, 0x2F, 0xF9, 0x06,
+    0xD1, 0x97, 0x6A, 0x72, 0x05, 0xAD, 0xB1, 0x7A, 0x57, 0x76, 0x0A, 0x1D, 0x1D, 0x6D, 0xF5, 0x07,
+    0xBF, 0x93, 0xB1, 0xDF, 0x3C, 0xFE, 0x6D, 0x20, 0x72, 0x28, 0xD6, 0x22, 0x05, 0x91, 0xB2, 0x22,
+    0x64, 0x2D, 0x38, 0xCB, 0x40, 0x08, 0x26, 0x8B, 0x22, 0x5F, 0x4F, 0x41, 0xC8, 0x33, 0xCE, 0xFF,
+    0x47, 0xE2, 0xFC, 0x1D, 0x8B, 0x4F, 0x9B, 0x87, 0x3D, 0xE7, 0xED, 0x01, 0x00, 0x00,
+};
+
+// Home.svg: 1891 bytes, 864 bytes gzipped
+static const char Home_svg_Path[] PROGMEM = "/Home.svg";
+static const char Home_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Home_svg_ETag[] PROGMEM = "\"7fcea6beaa9c719f\"";
+static const uint8_t Home_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x65, 0x55, 0x4D, 0x6F, 0x23, 0x37,
+    0x0C, 0xBD, 0xF7, 0x57, 0xA8, 0xD3, 0xEB, 0x5A, 0xA6, 0x24, 0xEA, 0x83, 0x8B, 0x38, 0x0B, 0x74,
+    0x80, 0x6E, 0x0E, 0xD9, 0x4B, 0x3F, 0x72, 0xE8, 0x2D, 0x58, 0x7B, 0x63, 0x03, 0x5E, 0x8F, 0xE1,
+    0xB8, 0x71, 0x7E, 0x7E, 0x49, 0x4A, 0xF2, 0x6C, 0xDD, 0x20, 0xF0, 0xE8, 0x49, 0x24, 0xDF, 0x1B,
+    0xF2, 0xC9, 0xBE, 0xFB, 0xF4, 0xFE, 0x7D, 0x6F, 0xDE, 0x36, 0xA7, 0xD7, 0xDD, 0x74, 0x58, 0x0D,
+    0xCE, 0xC2, 0x60, 0x36, 0x87, 0xAF, 0xD3, 0x7A, 0x77, 0x78, 0x59, 0x0D, 0xFF, 0x9C, 0xBF, 0x2D,
+    0xCA, 0xF0, 0xE9, 0xFE, 0xEE, 0xE7, 0xC5, 0xC2, 0xFC, 0x75, 0xDC, 0x4F, 0xCF, 0xEB, 0xCD, 0xDA,
+    0x9C, 0xA7, 0x8F, 0xE6, 0x8F, 0xA7, 0xCF, 0xE6, 0xF7, 0xCD, 0x71, 0xFA, 0x60, 0x2E, 0x97, 0x8B,
+    0x7D, 0x7D, 0x7B, 0x39, 0x31, 0xB0, 0x5F, 0xA7, 0xEF, 0x1F, 0xCC, 0xE7, 0xCD, 0x61, 0x73, 0x7A,
+    0x3E, 0x4F, 0xA7, 0x39, 0xCA, 0x7C, 0xD9, 0xBD, 0x6F, 0x4E, 0xE6, 0xCF, 0x69, 0xDA, 0xBF, 0x9A,
+    0xC5, 0xE2, 0xFE, 0xA7, 0x3B, 0xCE, 0x30, 0x97, 0xDD, 0xFA, 0xBC, 0x5D, 0x0D, 0x05, 0xE0, 0xF8,
+    0x3E, 0x98, 0xED, 0x66, 0xF7, 0xB2, 0x3D, 0x5F, 0xE1, 0xDB, 0x6E, 0x73, 0xF9, 0x75, 0x7A, 0x5F,
+    0x0D, 0x60, 0xC0, 0x78, 0xE4, 0xFF, 0xC1, 0x7C, 0xDB, 0xED, 0xF7, 0xAB, 0xE1, 0x97, 0xDF, 0xF4,
+    0x6F, 0x30, 0xAC, 0xFC, 0xF0, 0xBA, 0x1A, 0xB6, 0xE7, 0xF3, 0xF1, 0xE3, 0x72, 0x29, 0x3A, 0x2E,
+    0xC1, 0x4E, 0xA7, 0x97, 0xA5, 0x07, 0x80, 0x25, 0x33, 0x0C, 0x4C, 0x74, 0x7C, 0x3E, 0x6F, 0xCD,
+    0x7A, 0x35, 0x7C, 0xF1, 0x60, 0x9C, 0xB3, 0x39, 0x8E, 0x8E, 0x6C, 0x09, 0x39, 0x55, 0x04, 0xD9,
+    0x30, 0x4E, 0x99, 0xA2, 0xE0, 0x44, 0x45, 0x60, 0xAC, 0xE0, 0xD1, 0x79, 0x13, 0x2D, 0xE1, 0x23,
+    0x5A, 0xAC, 0x3B, 0x23, 0x5A, 0x4F, 0x50, 0xB2, 0xE6, 0x3A, 0x0A, 0x06, 0x2D, 0x30, 0xD6, 0xC3,
+    0x9C, 0x21, 0x99, 0x60, 0x0B, 0x05, 0x42, 0xC5, 0xE8, 0xE3, 0x18, 0xB8, 0x64, 0x06, 0x5F, 0xE3,
+    0x31, 0xF0, 0x79, 0xE4, 0xB4, 0x5A, 0x0C, 0xC8, 0x31, 0xD6, 0x58, 0x94, 0x48, 0x5F, 0x20, 0xA9,
+    0x2A, 0xA6, 0x20, 0x3E, 0xF1, 0x9E, 0xD0, 0x09, 0x16, 0x0A, 0xC1, 0x31, 0x47, 0x8E, 0x06, 0xA5,
+    0xD0, 0xF8, 0x98, 0xB2, 0x60, 0xA6, 0xE0, 0xE3, 0x50, 0x85, 0x81, 0x32, 0x08, 0x51, 0x14, 0x80,
+    0x8F, 0x5C, 0x80, 0x97, 0xFC, 0x0A, 0xA3, 0x90, 0x66, 0x7E, 0x43, 0xB4, 0x01, 0x7C, 0x0A, 0x52,
+    0x9A, 0x1B, 0x91, 0x19, 0x7B, 0x8E, 0xF5, 0xFA, 0x1C, 0x9D, 0xB7, 0x2E, 0xF9, 0xD0, 0x37, 0x6D,
+    0xF0, 0xE0, 0xE7, 0x0C, 0x2F, 0x9D, 0xE0, 0x5A, 0x8F, 0x1E, 0xB4, 0x27, 0xFC, 0x39, 0xF2, 0x32,
+    0x52, 0xF4, 0x95, 0x3A, 0x93, 0xF1, 0xA2, 0xC8, 0x39, 0x55, 0x56, 0xA2, 0xE2, 0xEC, 0x0A, 0xA9,
+    0xF2, 0x0C, 0x24, 0xF1, 0x19, 0xEB, 0x9B, 0x42, 0x6C, 0xE7, 0x80, 0xDA, 0x23, 0x8F, 0x98, 0x34,
+    0x5F, 0x9B, 0xA2, 0x95, 0x43, 0x15, 0x1A, 0x21, 0xC8, 0x01, 0x62, 0xD1, 0xC0, 0x58, 0x4A, 0x11,
+    0x1C, 0x30, 0x68, 0x6C, 0x42, 0x2A, 0x12, 0xEE, 0x03, 0xD5, 0x5E, 0x83, 0x1E, 0x3B, 0xEF, 0xEA,
+    0x28, 0x58, 0x5E, 0x9F, 0xFF, 0xDF, 0x83, 0x59, 0xFE, 0xE8, 0x0B, 0xA7, 0x23, 0xCF, 0xF1, 0x21,
+    0x8D, 0xD1, 0x16, 0x50, 0xA5, 0x8C, 0x31, 0x23, 0x0F, 0x3F, 0x39, 0x7D, 0x6D, 0x76, 0x48, 0x62,
+    0xC7, 0x44, 0x8B, 0xD9, 0x47, 0xC5, 0xD1, 0xB3, 0x93, 0xA2, 0x0D, 0x81, 0x25, 0x0B, 0x0E, 0x45,
+    0xE3, 0x7D, 0xF4, 0x51, 0xF3, 0x1D, 0x15, 0xA7, 0x98, 0xC1, 0x13, 0x87, 0x8F, 0xBA, 0xE6, 0x38,
+    0x70, 0x3C, 0x5C, 0x4E, 0xE4, 0x21, 0x7B, 0xC6, 0xCE, 0x41, 0x10, 0x97, 0x61, 0x22, 0x1E, 0x66,
+    0xB1, 0x24, 0xCF, 0x51, 0x88, 0x65, 0xBF, 0xD8, 0xA2, 0x71, 0x2A, 0x8C, 0xF3, 0x0A, 0xEB, 0x34,
+    0x49, 0x1F, 0x63, 0x12, 0x0E, 0xB6, 0x50, 0xDD, 0x63, 0x01, 0x94, 0xCA, 0x35, 0x21, 0x71, 0xE3,
+    0x20, 0x84, 0x6B, 0xC1, 0xC4, 0x93, 0x07, 0x1E, 0x7D, 0x27, 0x4C, 0x92, 0xD4, 0xD5, 0x34, 0x10,
+    0x9F, 0x5C, 0x61, 0x91, 0x0F, 0x2E, 0xF3, 0xA7, 0x6A, 0xD6, 0xD5, 0x35, 0x8C, 0x11, 0xAB, 0xBE,
+    0x96, 0x60, 0x88, 0xE2, 0xBC, 0x4E, 0xC1, 0x58, 0x44, 0x5F, 0x25, 0x30, 0x66, 0xD1, 0x4D, 0x9F,
+    0x2B, 0x55, 0x34, 0x33, 0x88, 0xEA, 0xBE, 0x29, 0xAA, 0xF3, 0x9C, 0x51, 0x54, 0xF5, 0x5C, 0xB1,
+    0xB0, 0x6A, 0x37, 0x13, 0x96, 0x1F, 0x45, 0x77, 0xC4, 0xAA, 0x49, 0x22, 0x75, 0x60, 0xBD, 0xF1,
+    0x92, 0x29, 0x03, 0xEB, 0x83, 0x91, 0xCA, 0x5E, 0x18, 0xDB, 0xE0, 0x94, 0xB9, 0xC6, 0xD7, 0xB8,
+    0xD2, 0xF2, 0xDA, 0xE0, 0xBB, 0x27, 0xFE, 0xE7, 0x15, 0xAC, 0xFB, 0xA3, 0x0B, 0xF2, 0x72, 0xB3,
+    0x53, 0x18, 0x8B, 0x55, 0xE6, 0x82, 0x41, 0xAD, 0x32, 0x13, 0x06, 0xB5, 0xCA, 0x2C, 0x48, 0xAE,
+    0x73, 0x8D, 0xAF, 0xC4, 0xA1, 0x59, 0x85, 0x6F, 0x18, 0x5B, 0x91, 0xAF, 0x4A, 0xAE, 0x2F, 0x06,
+    0xB6, 0xCA, 0xD6, 0xAE, 0xC9, 0x8D, 0xCA, 0xAE, 0x16, 0xA1, 0x7A, 0xD7, 0xA5, 0x5F, 0x42, 0xC2,
+    0x4F, 0x09, 0xAE, 0xFB, 0x54, 0xC3, 0xA0, 0x65, 0x91, 0xD6, 0x80, 0x26, 0x9D, 0x9A, 0x97, 0xEA,
+    0x36, 0x35, 0xA7, 0xB5, 0x1C, 0x6A, 0x46, 0xEC, 0x25, 0xA9, 0x19, 0xB5, 0x53, 0x52, 0x95, 0x59,
+    0x0B, 0xD3, 0x55, 0xF3, 0x48, 0xDD, 0xF9, 0xAE, 0xF6, 0x85, 0xFA, 0xCD, 0x70, 0xB5, 0x2F, 0xD4,
+    0x6F, 0x8E, 0xD3, 0xC5, 0x48, 0xFD, 0x66, 0xB9, 0xDA, 0x17, 0xEA, 0x37, 0xCF, 0xB5, 0xBE, 0x40,
+    0x5D, 0x3E, 0x38, 0xFE, 0xDA, 0xC2, 0xD6, 0xA3, 0x7E, 0x86, 0xAD, 0x87, 0x2D, 0x97, 0x71, 0x1D,
+    0x6E, 0xAB, 0xCD, 0xB8, 0xCE, 0xA0, 0x71, 0x33, 0xAE, 0x33, 0x6A, 0xDA, 0x04, 0xCB, 0x57, 0x9B,
+    0xF6, 0x17, 0x6F, 0x8C, 0x83, 0x37, 0xC6, 0xC1, 0x1B, 0xE3, 0xE0, 0x8D, 0x71, 0xF0, 0xC6, 0x38,
+    0xF8, 0x1F, 0xE3, 0xC8, 0x8F, 0xD0, 0xFD, 0xBF, 0x00, 0x20, 0x89, 0x5E, 0x63, 0x07, 0x00, 0x00,
+};
+
+// LogFile.svg: 1064 bytes, 392 bytes gzipped
+static const char LogFile_svg_Path[] PROGMEM = "/LogFile.svg";
+static const char LogFile_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char LogFile_svg_ETag[] PROGMEM = "\"e9ab3d26f6d62e2e\"";
+static const uint8_t LogFile_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xB5, 0x93, 0xCB, 0x4E, 0xC3, 0x30,
+    0x10, 0x45, 0xF7, 0xFD, 0x8A, 0xC1, 0x6C, 0x9B, 0x89, 0x1F, 0x79, 0x56, 0x49, 0x90, 0x58, 0x40,
+    0x37, 0x6C, 0x78, 0x74, 0xC1, 0xA6, 0xAA, 0x1A, 0x37, 0x89, 0x94, 0xC6, 0x51, 0x62, 0x9A, 0xF2,
+    0xF7, 0x38, 0x6D, 0x45, 0x03, 0x12, 0x90, 0x2E, 0xB0, 0x2C, 0x59, 0x33, 0x9A, 0xA3, 0x7B, 0xEF,
+    0x48, 0x8E, 0x6E, 0xF6, 0xDB, 0x12, 0x76, 0xB2, 0x69, 0x0B, 0x55, 0xC5, 0x84, 0x21, 0x25, 0x20,
+    0xAB, 0xB5, 0x4A, 0x8B, 0x2A, 0x8B, 0xC9, 0x9B, 0xDE, 0x58, 0x01, 0xB9, 0x49, 0xA2, 0x2B, 0xCB,
+    0x82, 0x97, 0xBA, 0x54, 0xAB, 0x54, 0xA6, 0xA0, 0xD5, 0x0C, 0x9E, 0x16, 0xF7, 0xF0, 0x28, 0x6B,
+    0x35, 0x85, 0xAE, 0xEB, 0xB0, 0xDD, 0x65, 0x8D, 0x29, 0x70, 0xAD, 0xB6, 0x53, 0xB8, 0x97, 0x95,
+    0x6C, 0x56, 0x5A, 0x35, 0xE7, 0x29, 0x78, 0x28, 0xF6, 0xB2, 0x81, 0x67, 0xA5, 0xCA, 0x16, 0x2C,
+    0x2B, 0x99, 0x44, 0x86, 0x80, 0x4D, 0x51, 0x96, 0x31, 0xB9, 0xBE, 0x3B, 0x1C, 0x02, 0x5D, 0x91,
+    0xEA, 0x3C, 0x26, 0x01, 0xA5, 0xF5, 0x9E, 0x40, 0x2E, 0x8B, 0x2C, 0xD7, 0x9F, 0xE5, 0xAE, 0x90,
+    0xDD, 0xAD, 0xDA, 0xC7, 0x84, 0x02, 0x05, 0xC1, 0xCD, 0x25, 0x60, 0x9C, 0x57, 0x6D, 0x4C, 0x72,
+    0xAD, 0xEB, 0x99, 0x6D, 0xF7, 0x3E, 0x3A, 0x81, 0xAA, 0xC9, 0x6C, 0x4E, 0x29, 0xB5, 0x8D, 0x02,
+    0x31, 0x42, 0xBA, 0xD0, 0xA5, 0x4C, 0x8C, 0x94, 0x5C, 0xEA, 0xF7, 0x5A, 0x2E, 0x4B, 0x95, 0x45,
+    0xF6, 0xB1, 0x39, 0x89, 0xEA, 0x95, 0xCE, 0x21, 0x8D, 0xC9, 0x03, 0x0F, 0xD1, 0x99, 0x72, 0x1F,
+    0xBD, 0x39, 0x47, 0x77, 0xE1, 0xA0, 0x3B, 0xEF, 0x3B, 0xAF, 0x5B, 0x8B, 0xBB, 0x18, 0x5A, 0x6C,
+    0xCE, 0x03, 0x74, 0x16, 0xAE, 0x69, 0x0B, 0x74, 0x5F, 0x89, 0x6D, 0xD0, 0x46, 0xAE, 0x35, 0x18,
+    0x3F, 0x66, 0x9E, 0xC0, 0x7B, 0x4C, 0xDC, 0xFE, 0x3D, 0x45, 0xE0, 0x1E, 0x86, 0xE7, 0x04, 0xAC,
+    0x2F, 0x86, 0x08, 0x63, 0x28, 0x84, 0x38, 0x50, 0xE1, 0x80, 0x0A, 0x90, 0x79, 0xFE, 0x00, 0xFB,
+    0x11, 0x62, 0x1C, 0x69, 0x20, 0x3E, 0x39, 0x76, 0xB0, 0x30, 0x02, 0x73, 0xD0, 0x3F, 0xAB, 0x31,
+    0x8A, 0x1E, 0x1B, 0x27, 0xE7, 0xA3, 0x3B, 0x94, 0x73, 0xC6, 0xFA, 0xE4, 0x74, 0x90, 0x2E, 0xC4,
+    0x40, 0x38, 0xBF, 0x51, 0xC7, 0x35, 0x72, 0xF1, 0x3D, 0xDB, 0x6F, 0x62, 0xEE, 0x89, 0x1A, 0xAE,
+    0xD1, 0x39, 0xEA, 0xFF, 0x41, 0x7C, 0xDB, 0xE1, 0x7F, 0x42, 0x0E, 0x7A, 0x7D, 0x84, 0xCB, 0x20,
+    0x1F, 0xF9, 0xA5, 0x91, 0xBE, 0xAC, 0x7B, 0x24, 0x22, 0x46, 0x04, 0xEA, 0x7F, 0x52, 0xF2, 0x01,
+    0x93, 0x18, 0xC4, 0xA1, 0x28, 0x04, 0x00, 0x00,
+};
+
+// Logo.png: 12165 bytes, 12007 bytes gzipped
+static const char Logo_png_Path[] PROGMEM = "/Logo.png";
+static const char Logo_png_ContentType[] PROGMEM = "image/png";
+static const char Logo_png_ETag[] PROGMEM = "\"f19678c7f9c380dd\"";
+static const uint8_t Logo_png_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0xBA, 0x05, 0x50, 0x1C, 0x51,
+    0xD7, 0x2D, 0x3A, 0x10, 0x74, 0x90, 0xE0, 0x0C, 0xAE, 0x03, 0x04, 0xF7, 0xE0, 0xEE, 0xEE, 0x2E,
+    0xC1, 0xDD, 0x5D, 0x83, 0xBB, 0xBB, 0x6B, 0x08, 0xC1, 0x65, 0x70, 0x02, 0x41, 0x06, 0x77, 0x08,
+    0xEE, 0xEE, 0x4E, 0x90, 0x40, 0xC8, 0x23, 0xDF, 0xF7, 0xBF, 0xFB, 0xAA, 0xDE, 0xBD, 0xB7, 0xAB,
+    0x7A, 0xBA, 0xCF, 0x39, 0x7B, 0xAF, 0xDD, 0x6B, 0xF5, 0xEA, 0x73, 0xBA, 0xAB, 0x26, 0x5A, 0x45,
+    0x49, 0x1A, 0x0D, 0x48, 0x08, 0x04, 0x00, 0x00, 0x68, 0xB2, 0x32, 0x12, 0x6A, 0x6F, 0x47, 0xE8,
+    0xBF, 0x1D, 0x09, 0xE1, 0xED, 0xB7, 0xE7, 0x6B, 0x82, 0xDD, 0xDB, 0x01, 0xCE, 0x4A, 0x54, 0x51,
+    0x14, 0x00, 0x68, 0x48, 0xF0, 0x7F, 0x56, 0x4D, 0x7D, 0x6B, 0x93, 0x9B, 0xC9, 0xA8, 0x29, 0x02,
+    0x00, 0x91, 0x18, 0x00, 0x40, 0x1C, 0x16, 0x00, 0x06, 0x06, 0x0C, 0x00, 0x04, 0x8B, 0x01, 0x00,
+    0x81, 0x1F, 0x01, 0x80, 0xDB, 0x4C, 0x00, 0x40, 0xE0, 0x1B, 0x00, 0x40, 0x94, 0xFF, 0xCE, 0xEC,
+    0xCB, 0x32, 0x00, 0x00, 0x2C, 0xB2, 0x11, 0x17, 0x57, 0x91, 0x15, 0x17, 0x27, 0x57, 0x71, 0x75,
+    0xB2, 0xB4, 0xB1, 0xB7, 0x00, 0x00, 0x64, 0x86, 0x6A, 0x32, 0xBC, 0x54, 0xD4, 0x8F, 0x09, 0x07,
+    0x7F, 0xB8, 0xCD, 0x12, 0x61, 0x60, 0x61, 0x24, 0x61, 0xF9, 0x5E, 0x32, 0x05, 0xDD, 0x11, 0x76,
+    0xB8, 0xD7, 0x63, 0x62, 0xC9, 0xD1, 0x51, 0x20, 0x84, 0xC4, 0x2C, 0x25, 0x0D, 0xE0, 0x1A, 0xA0,
+    0x50, 0x52, 0x16, 0x55, 0x0F, 0xAB, 0xE1, 0x1A, 0xA4, 0x53, 0xDA, 0xC1, 0x30, 0xEA, 0xE8, 0xC0,
+    0x11, 0xDD, 0xA3, 0x35, 0x22, 0xD1, 0x2D, 0x0E, 0x84, 0xA0, 0xA5, 0xFB, 0x05, 0xC9, 0xB7, 0x3D,
+    0x4C, 0x9E, 0x91, 0x79, 0x1D, 0x74, 0x73, 0x38, 0xDD, 0x8C, 0xF1, 0x5F, 0xFA, 0xDC, 0xE4, 0xED,
+    0xF9, 0x73, 0xBC, 0x07, 0xEC, 0x05, 0xB6, 0x88, 0x24, 0x01, 0xC7, 0x00, 0x49, 0x83, 0x53, 0x38,
+    0x11, 0xDE, 0x9D, 0x6C, 0x25, 0x25, 0x66, 0xA0, 0x36, 0x61, 0x00, 0xA9, 0x0A, 0x0C, 0x81, 0x08,
+    0x60, 0xEA, 0xC0, 0x1C, 0xC9, 0x20, 0x34, 0xF4, 0x4F, 0xEF, 0xE6, 0x42, 0xE4, 0xF3, 0x30, 0xA9,
+    0x9A, 0x57, 0x9C, 0x55, 0x73, 0xCF, 0x5F, 0x2D, 0x0D, 0x47, 0x7F, 0x04, 0x44, 0x00, 0x1D, 0x68,
+    0x9B, 0xC7, 0x11, 0x81, 0x16, 0x6D, 0x9B, 0x43, 0xA6, 0xD5, 0x15, 0xAE, 0x4F, 0x01, 0xA0, 0x02,
+    0xF1, 0xCD, 0x39, 0x65, 0x87, 0x87, 0x7C, 0xC7, 0x37, 0xE9, 0xC0, 0x60, 0x8B, 0x72, 0xFE, 0xC5,
+    0x48, 0x3B, 0xE9, 0xF6, 0xCC, 0x38, 0x34, 0xE1, 0x76, 0xB9, 0xA6, 0xA4, 0x13, 0xC5, 0xDF, 0x67,
+    0x0A, 0xB8, 0x32, 0xE7, 0xD6, 0xCF, 0x42, 0x02, 0xD8, 0xC0, 0x66, 0x73, 0x34, 0xF2, 0x44, 0x47,
+    0xA1, 0x67, 0xC7, 0xD5, 0x13, 0x14, 0x8E, 0xED, 0x52, 0x7D, 0x47, 0x35, 0xA1, 0x55, 0xC2, 0xCA,
+    0x8D, 0x75, 0x46, 0xEF, 0x93, 0xB2, 0xB1, 0x39, 0x86, 0x18, 0x44, 0xD6, 0x1B, 0xAD, 0xFD, 0x38,
+    0xA6, 0x7E, 0x8D, 0xB4, 0xCC, 0x93, 0x48, 0x9D, 0x50, 0x4A, 0xBB, 0x7A, 0xE9, 0x1A, 0xC7, 0xDD,
+    0x08, 0xCD, 0xA4, 0x90, 0xB1, 0x70, 0x02, 0xFC, 0xBD, 0x94, 0x93, 0xC7, 0x65, 0xF2, 0x8F, 0x44,
+    0x98, 0xDD, 0xA3, 0x2E, 0x56, 0x46, 0xBA, 0x61, 0x0E, 0x7F, 0xB1, 0xF4, 0xF8, 0x70, 0x1C, 0x88,
+    0x75, 0x30, 0x04, 0x8F, 0xC0, 0xC4, 0x9A, 0xC8, 0xDF, 0x2A, 0x3C, 0x24, 0x4B, 0x59, 0x78, 0x05,
+    0x7F, 0x60, 0xDE, 0x36, 0xC4, 0xC8, 0x9A, 0x79, 0xBE, 0xDD, 0xDA, 0x53, 0x92, 0xE6, 0xBC, 0x08,
+    0x6F, 0x89, 0x82, 0x5F, 0xB7, 0x6F, 0xD1, 0xD8, 0x87, 0xA7, 0x93, 0x45, 0x4A, 0x39, 0x93, 0x38,
+    0x75, 0x85, 0x9A, 0x7E, 0x34, 0x04, 0x79, 0x01, 0x93, 0xAA, 0xBD, 0x03, 0xE7, 0xF5, 0xDC, 0x9A,
+    0x32, 0x39, 0x7B, 0xAA, 0xE9, 0xEC, 0xC1, 0x5A, 0x5D, 0x53, 0xC2, 0xE2, 0xF3, 0x50, 0x81, 0x7F,
+    0x3A, 0xB9, 0x0C, 0x19, 0xB2, 0xE3, 0xC7, 0x88, 0x51, 0x17, 0x60, 0x87, 0x19, 0xA5, 0xF8, 0x29,
+    0x8C, 0xE9, 0xDC, 0x0D, 0x9A, 0xB0, 0xF8, 0x0E, 0x2B, 0x00, 0x6F, 0x75, 0xEF, 0xF0, 0xC0, 0xD7,
+    0x3D, 0xF1, 0x0F, 0x57, 0x69, 0xE3, 0x4F, 0xDB, 0x29, 0x01, 0xA2, 0x5F, 0x73, 0x25, 0xD4, 0x93,
+    0x08, 0x19, 0x97, 0x13, 0x95, 0x7F, 0x65, 0x8C, 0x73, 0x34, 0x8A, 0x81, 0x17, 0x2D, 0x29, 0xDF,
+    0x2F, 0xC1, 0xD2, 0x42, 0x02, 0x42, 0xF1, 0x3D, 0x42, 0xC0, 0x3F, 0xDE, 0x5F, 0xC1, 0xF4, 0x06,
+    0xC1, 0x98, 0x06, 0xC1, 0xD7, 0xC3, 0x0A, 0x00, 0xD8, 0x77, 0x17, 0xAD, 0x26, 0x73, 0x3C, 0x94,
+    0xF1, 0xED, 0x31, 0x6E, 0xB0, 0x52, 0xD9, 0x09, 0x6A, 0x87, 0x6D, 0xA2, 0xAD, 0xEA, 0x1F, 0x89,
+    0xB1, 0xA9, 0x22, 0xC2, 0xB3, 0xDB, 0xB9, 0x00, 0x10, 0x2B, 0xA7, 0xD7, 0xBA, 0x00, 0x2F, 0xBB,
+    0x0B, 0x05, 0x51, 0xA0, 0x4B, 0x2C, 0x07, 0xC5, 0x4D, 0xF5, 0x0A, 0xC5, 0x21, 0x0C, 0xA1, 0x5E,
+    0x5E, 0x0D, 0x1F, 0x4A, 0x4F, 0x36, 0x05, 0xE0, 0x0B, 0x04, 0xDF, 0x8A, 0x6F, 0xD8, 0xEA, 0xC4,
+    0x06, 0xD0, 0x81, 0xC0, 0x43, 0x69, 0xB2, 0xF0, 0x82, 0x2A, 0xF8, 0x1C, 0x02, 0x23, 0x41, 0x8E,
+    0x76, 0x24, 0x82, 0xF9, 0x0D, 0x56, 0xB1, 0x08, 0x31, 0x0E, 0xD3, 0x89, 0xBB, 0x07, 0xA6, 0x0D,
+    0xA0, 0xBC, 0x85, 0x12, 0x22, 0x02, 0x8A, 0x42, 0xA8, 0x82, 0x41, 0xA4, 0x0E, 0xE6, 0x24, 0x87,
+    0x3B, 0x15, 0x41, 0x5F, 0x42, 0xB8, 0x11, 0xA5, 0x58, 0x42, 0x41, 0x0F, 0x62, 0x57, 0x41, 0x4E,
+    0x08, 0xE6, 0x73, 0x86, 0xCD, 0x83, 0x75, 0xD8, 0x22, 0x3E, 0x82, 0xD5, 0xEE, 0x55, 0x9C, 0x7E,
+    0x7F, 0x11, 0x3C, 0x24, 0x82, 0x2A, 0xD5, 0xC3, 0xC0, 0x8A, 0x2C, 0x14, 0x64, 0x83, 0x14, 0xE2,
+    0x8C, 0x01, 0x5F, 0x22, 0x1A, 0x93, 0x44, 0xF8, 0x05, 0x8D, 0x40, 0x0C, 0x0F, 0x03, 0xDB, 0x35,
+    0x44, 0x80, 0xE2, 0x33, 0x1D, 0x5C, 0x4C, 0x84, 0x69, 0xB1, 0x44, 0xD4, 0xFB, 0xE8, 0x22, 0x62,
+    0x6B, 0x7E, 0x0D, 0x24, 0x5C, 0x51, 0x8B, 0x69, 0xD5, 0x6F, 0xA4, 0xBF, 0x71, 0xF9, 0x50, 0x3C,
+    0x44, 0x17, 0x8B, 0x61, 0x8E, 0x28, 0x38, 0xE1, 0xE2, 0xC5, 0x9D, 0x8A, 0x59, 0x58, 0x81, 0x34,
+    0xFD, 0xEE, 0x3A, 0xF0, 0x0B, 0xC1, 0x8A, 0x26, 0x34, 0x67, 0xC0, 0xE7, 0x5E, 0x93, 0x2B, 0x7A,
+    0x1E, 0x4C, 0x23, 0x14, 0xAB, 0x7E, 0x9F, 0x2B, 0xC7, 0x36, 0x9C, 0xDA, 0x90, 0xC4, 0xFE, 0x1A,
+    0x67, 0x7C, 0x7F, 0xEC, 0x6E, 0xC4, 0xD8, 0x6D, 0xED, 0x2B, 0x1C, 0x60, 0x91, 0x0C, 0x9D, 0x4F,
+    0x1A, 0xDF, 0x28, 0x68, 0x40, 0xA2, 0xBD, 0x34, 0x44, 0x85, 0xED, 0x1B, 0x5C, 0x1A, 0x46, 0x33,
+    0x81, 0x66, 0x10, 0xBD, 0xA8, 0x66, 0x71, 0x8E, 0x0A, 0xC9, 0x37, 0xD2, 0x9F, 0x24, 0x69, 0x20,
+    0xAE, 0xE0, 0xDF, 0x71, 0x83, 0x25, 0x36, 0xD6, 0x08, 0x2B, 0xA0, 0xF3, 0xA0, 0x7B, 0xD1, 0xC8,
+    0x52, 0xDE, 0xA3, 0xE6, 0xA3, 0x89, 0x23, 0xC3, 0x23, 0x76, 0x77, 0x92, 0x0E, 0xDC, 0x00, 0x82,
+    0x00, 0x44, 0xC1, 0xB0, 0x02, 0x89, 0xCF, 0x43, 0x2A, 0xAC, 0xA3, 0x20, 0xF1, 0x38, 0xC1, 0x88,
+    0xF0, 0xE8, 0x3E, 0x6A, 0xD3, 0x05, 0x93, 0x1B, 0x36, 0x70, 0x16, 0xA1, 0x02, 0xCA, 0x01, 0xF0,
+    0x80, 0xD4, 0x12, 0xEE, 0x16, 0x26, 0x76, 0x60, 0xD4, 0xCC, 0xA3, 0xA1, 0x45, 0x87, 0xCC, 0x9E,
+    0x93, 0x9B, 0xA0, 0x13, 0xB3, 0x13, 0xC5, 0x0F, 0xB4, 0x1A, 0x77, 0x0E, 0x45, 0xFF, 0x14, 0xD9,
+    0xA0, 0xCE, 0x43, 0xAC, 0x84, 0x69, 0x15, 0xE5, 0x06, 0x85, 0xDF, 0x5E, 0x6A, 0x53, 0x30, 0x10,
+    0xBA, 0xC0, 0xB8, 0xE0, 0xB9, 0xA0, 0xBC, 0xE0, 0x76, 0x84, 0x7B, 0x40, 0x56, 0xEE, 0xAB, 0xDA,
+    0x66, 0xBA, 0x32, 0x7A, 0x04, 0x09, 0x90, 0x15, 0xC6, 0xB2, 0xF4, 0x7E, 0xDC, 0x62, 0xD9, 0x72,
+    0xDA, 0x95, 0xBE, 0x9E, 0x83, 0x23, 0x08, 0xE1, 0xEE, 0x2D, 0xC0, 0x90, 0xD8, 0xC2, 0xE2, 0xC6,
+    0xB8, 0xC7, 0xA8, 0x44, 0x26, 0x09, 0xD3, 0x0F, 0xC3, 0xEC, 0xE3, 0x4C, 0x96, 0xFB, 0x09, 0xE6,
+    0xC3, 0xEA, 0x8F, 0x1A, 0x81, 0x3A, 0x40, 0xD5, 0x4C, 0xB1, 0xAF, 0x81, 0xD7, 0xC8, 0xD7, 0x24,
+    0xD1, 0x12, 0xB3, 0xE4, 0xCB, 0xC9, 0x19, 0xA9, 0xDE, 0x5F, 0x6A, 0xBE, 0xA8, 0xCD, 0xCA, 0xCE,
+    0x72, 0xCD, 0x62, 0x1C, 0x73, 0xE8, 0x66, 0xD8, 0x8B, 0x78, 0xD2, 0xD6, 0x51, 0xC7, 0x0E, 0x77,
+    0x8E, 0x34, 0xEF, 0x29, 0xDD, 0x88, 0xDF, 0xF0, 0x03, 0xC3, 0x4B, 0xC4, 0x5D, 0x8A, 0xA1, 0x2A,
+    0xEC, 0x1F, 0x3A, 0x3F, 0xFC, 0x4A, 0x93, 0x4F, 0xB3, 0x4A, 0x53, 0x56, 0xE3, 0xFC, 0x80, 0xFD,
+    0x21, 0x03, 0x47, 0xDB, 0x36, 0x56, 0xA3, 0x5D, 0xA3, 0xEA, 0xA7, 0x43, 0xC5, 0xE2, 0x2C, 0x9C,
+    0x8D, 0x83, 0x8D, 0xF6, 0xF1, 0xFC, 0xEC, 0xF2, 0x2C, 0x78, 0xB6, 0xBC, 0xCC, 0x49, 0x56, 0x79,
+    0x18, 0xC3, 0xDC, 0xDD, 0x7C, 0xCD, 0x62, 0x89, 0x3D, 0xD7, 0x62, 0xD4, 0x62, 0x72, 0x14, 0x75,
+    0x54, 0x41, 0xD5, 0x46, 0xC3, 0xCD, 0x16, 0x83, 0x2B, 0xBE, 0x23, 0x76, 0x45, 0xA4, 0x4B, 0x89,
+    0x24, 0x75, 0x60, 0xE4, 0x64, 0xD8, 0x77, 0xD4, 0xD5, 0xE2, 0xD6, 0x3C, 0x71, 0xC4, 0x28, 0x85,
+    0xE4, 0x6B, 0xB1, 0x75, 0x0E, 0xA7, 0x17, 0x61, 0x64, 0x4B, 0xBE, 0x96, 0x62, 0xA7, 0x18, 0x51,
+    0xB1, 0xD9, 0x71, 0x87, 0x3B, 0x9E, 0x60, 0xB6, 0x91, 0x8C, 0xB0, 0xE8, 0x65, 0xA9, 0xF2, 0xE8,
+    0xC8, 0xA8, 0xEE, 0x88, 0xE4, 0x70, 0x4D, 0x26, 0x43, 0x26, 0x3F, 0x0B, 0x6D, 0x86, 0xF4, 0xC8,
+    0xE9, 0x30, 0x64, 0x4F, 0x7D, 0xFF, 0x61, 0xB8, 0x30, 0xE5, 0x07, 0xCB, 0x5F, 0x8B, 0xE8, 0x51,
+    0xAC, 0x45, 0xF0, 0xB5, 0xBC, 0x27, 0xB3, 0x8D, 0x9E, 0xAB, 0xDF, 0x88, 0x74, 0x78, 0x19, 0x90,
+    0x19, 0x78, 0x0D, 0x84, 0x07, 0x4E, 0x00, 0x1F, 0x70, 0xBA, 0xE9, 0xD8, 0x71, 0x04, 0x71, 0xD5,
+    0x71, 0x1E, 0x3E, 0xB4, 0x7C, 0x10, 0xD2, 0x14, 0x63, 0x20, 0xA0, 0x63, 0xD2, 0xD6, 0x2B, 0x77,
+    0x97, 0x38, 0x8E, 0x99, 0x85, 0xAA, 0xFD, 0x56, 0x8B, 0x2C, 0xCB, 0x2B, 0x83, 0x97, 0x57, 0x66,
+    0x0A, 0xF8, 0x82, 0xCA, 0x40, 0x44, 0x17, 0x49, 0xE7, 0xA4, 0x21, 0xF4, 0x75, 0xAD, 0x4A, 0xA0,
+    0xAC, 0xA4, 0x72, 0xA7, 0x86, 0x52, 0x85, 0xF7, 0x8B, 0xAB, 0xAC, 0x85, 0x98, 0xA6, 0xD1, 0xBC,
+    0x24, 0x97, 0x6E, 0xB3, 0xCE, 0xAF, 0x90, 0x93, 0x36, 0x42, 0xC5, 0x09, 0xD9, 0xF8, 0x72, 0xAD,
+    0x6A, 0x4F, 0xD5, 0x73, 0xB0, 0x78, 0xC2, 0xF6, 0xA8, 0x8C, 0x45, 0x1A, 0x3B, 0x33, 0x07, 0xCD,
+    0x7C, 0xFA, 0x7C, 0xC0, 0x4F, 0xC9, 0x13, 0xE9, 0xF9, 0xE7, 0x9F, 0xE5, 0x5C, 0xEE, 0x5C, 0x7D,
+    0x5C, 0xAE, 0x5C, 0x39, 0x5C, 0x05, 0xB6, 0x58, 0x5C, 0xD9, 0x39, 0xC8, 0x39, 0x03, 0x39, 0xEB,
+    0x39, 0xA9, 0x7A, 0xB6, 0x7A, 0x30, 0x7A, 0xBC, 0x7A, 0xF1, 0x7A, 0x89, 0x4D, 0xC8, 0x2B, 0x0A,
+    0xE7, 0xD4, 0xE7, 0xA1, 0x2B, 0x82, 0x2B, 0x64, 0x1E, 0xEE, 0x1E, 0x94, 0x1E, 0x9E, 0x47, 0x4D,
+    0xC7, 0x71, 0xC7, 0xF4, 0x47, 0x8D, 0xEE, 0x10, 0x0F, 0x22, 0x8F, 0xC2, 0x23, 0xD5, 0xBB, 0xBC,
+    0x5F, 0x0B, 0x27, 0x9A, 0xC7, 0xEB, 0xF3, 0x43, 0x27, 0x1C, 0xBF, 0xD4, 0xEF, 0xDE, 0x9F, 0x3E,
+    0x10, 0xF5, 0x20, 0x2C, 0x20, 0xC8, 0x22, 0xEC, 0x23, 0xB4, 0xA2, 0x9A, 0x88, 0x13, 0x89, 0x17,
+    0x6C, 0x9B, 0xF4, 0xC3, 0x50, 0xC5, 0x25, 0xE7, 0x63, 0x6E, 0x7E, 0x1B, 0xB5, 0x9E, 0xCE, 0xB2,
+    0x3F, 0xB3, 0xCD, 0xB3, 0x58, 0xB3, 0x16, 0x30, 0xA7, 0x74, 0xDA, 0x71, 0x4A, 0xB1, 0x9B, 0xB5,
+    0xBC, 0x59, 0xD1, 0x18, 0xE3, 0x1C, 0x74, 0x2F, 0xB4, 0x49, 0x3C, 0xF6, 0xE2, 0xB0, 0x83, 0x68,
+    0x40, 0x6C, 0x21, 0x43, 0x07, 0x8D, 0x07, 0xDD, 0x07, 0xED, 0x07, 0x24, 0x07, 0x4E, 0x4C, 0xA8,
+    0x8C, 0x3C, 0x78, 0xFB, 0x78, 0x5E, 0x4C, 0x1F, 0x32, 0x8C, 0x32, 0xF4, 0x19, 0x57, 0x99, 0x36,
+    0x75, 0x08, 0xF4, 0x06, 0xF4, 0x49, 0x1A, 0x7C, 0x3F, 0x29, 0x42, 0xD0, 0xEB, 0x37, 0x4C, 0xD6,
+    0x1D, 0xFE, 0x4C, 0x0C, 0x2E, 0x48, 0x59, 0xCF, 0x99, 0x73, 0x38, 0x56, 0x59, 0x10, 0xD9, 0xE9,
+    0x9B, 0xF0, 0x0F, 0x7F, 0xE1, 0x08, 0xCD, 0xEE, 0xCC, 0x5A, 0x3C, 0x63, 0xF5, 0x74, 0xF4, 0xD4,
+    0x3F, 0x9B, 0x5C, 0x0E, 0x68, 0x69, 0x6D, 0x98, 0x6A, 0x12, 0xB6, 0xF8, 0x9B, 0x19, 0xDA, 0x20,
+    0x1E, 0x23, 0x1E, 0xDA, 0xBF, 0xC4, 0xBE, 0x6E, 0x71, 0x3D, 0x56, 0x99, 0x89, 0xC6, 0x6F, 0xCB,
+    0xD3, 0x48, 0x92, 0xC8, 0x17, 0x93, 0x0F, 0x52, 0x6A, 0x50, 0x12, 0xE6, 0x8F, 0xCE, 0x9F, 0xCF,
+    0x5F, 0x9E, 0xD4, 0x9C, 0x9C, 0x32, 0xE4, 0x34, 0x6C, 0x63, 0xE6, 0x62, 0x2E, 0xAD, 0xFD, 0x5D,
+    0x3B, 0x52, 0x3B, 0x64, 0x68, 0xDC, 0x99, 0xDD, 0x8E, 0xBC, 0xAE, 0xB7, 0x26, 0xD4, 0xB1, 0xDA,
+    0xE9, 0xE4, 0x7A, 0x79, 0x27, 0xE2, 0xE3, 0xED, 0x87, 0xE3, 0x7D, 0xE7, 0x33, 0xEA, 0x1B, 0xE1,
+    0x97, 0xE1, 0x23, 0x74, 0x3B, 0x7B, 0x25, 0x77, 0x67, 0x7B, 0x97, 0x73, 0xD7, 0x72, 0xBF, 0x71,
+    0xB4, 0x7E, 0x1C, 0x7A, 0x7D, 0x7D, 0xBB, 0x7C, 0xC8, 0x31, 0xAC, 0x66, 0xE2, 0xA2, 0xF3, 0xAB,
+    0x5A, 0xD6, 0x58, 0x7F, 0x53, 0xB1, 0x3B, 0xF3, 0xCF, 0x70, 0x60, 0x71, 0xA0, 0x45, 0xE0, 0xD4,
+    0x1F, 0xB4, 0x97, 0xF0, 0x57, 0x12, 0x18, 0xE7, 0x20, 0xA7, 0x9E, 0xD7, 0x20, 0xDA, 0xE0, 0x95,
+    0xE0, 0x97, 0x9E, 0x16, 0x72, 0x0C, 0x28, 0x70, 0x85, 0xEC, 0x8E, 0x53, 0xE7, 0xA3, 0xB7, 0xC3,
+    0x95, 0xD3, 0x58, 0xC3, 0x58, 0x68, 0x66, 0x26, 0xCB, 0x67, 0x4C, 0x53, 0xD2, 0x14, 0xEC, 0x59,
+    0x6C, 0x39, 0x14, 0x43, 0xEC, 0x15, 0x8C, 0xDF, 0x14, 0xE3, 0x4C, 0xF6, 0xCA, 0x4B, 0xBB, 0xCE,
+    0x5D, 0xCE, 0xAA, 0xDE, 0x5E, 0x61, 0xEE, 0xD0, 0xD1, 0xA8, 0xDF, 0x51, 0x89, 0xC9, 0xA4, 0xC9,
+    0x92, 0xC9, 0x3B, 0x74, 0x73, 0xDF, 0x14, 0x55, 0x3F, 0x96, 0xA6, 0x97, 0xF8, 0xCC, 0x9C, 0xB3,
+    0xB5, 0x65, 0x45, 0x65, 0xE5, 0x64, 0x55, 0xE0, 0x16, 0x30, 0xA0, 0x57, 0x83, 0x74, 0x6D, 0xBA,
+    0xD8, 0x3F, 0xEF, 0xFF, 0xD1, 0xEC, 0xA8, 0x5A, 0xA8, 0xEB, 0xE8, 0xD6, 0xB3, 0xF1, 0x38, 0x39,
+    0xB9, 0xB5, 0xFB, 0xB2, 0x58, 0xBF, 0x98, 0x97, 0x30, 0x00, 0x95, 0x1A, 0xE4, 0x86, 0x06, 0x5A,
+    0x20, 0x36, 0x54, 0x2D, 0xA9, 0xBB, 0x54, 0xB7, 0xC5, 0xB4, 0xC9, 0x26, 0xF0, 0x1F, 0x92, 0x1F,
+    0xE2, 0x2E, 0x86, 0xEB, 0x8F, 0x93, 0x24, 0x7A, 0xC5, 0xB1, 0xC4, 0x90, 0x29, 0x3A, 0x2B, 0xD0,
+    0xC9, 0x81, 0xE4, 0xDD, 0x15, 0xD6, 0x0A, 0x79, 0x0A, 0xF6, 0xF2, 0x34, 0x52, 0x38, 0x7B, 0xDD,
+    0x0E, 0xD3, 0xAF, 0x37, 0xA8, 0x9F, 0xA9, 0xB5, 0x69, 0x3E, 0x2B, 0x20, 0xCB, 0x55, 0x28, 0x66,
+    0xCB, 0xC6, 0x2B, 0x38, 0x28, 0xF5, 0x97, 0x0F, 0x7C, 0xCD, 0xDF, 0x1F, 0xBB, 0x51, 0x7F, 0xCC,
+    0x9C, 0xD3, 0x9C, 0x5B, 0x2C, 0x7F, 0x8F, 0x84, 0x0A, 0xFF, 0x04, 0x7B, 0xAD, 0xF7, 0xDC, 0x8C,
+    0xB8, 0xA0, 0x04, 0xFC, 0x13, 0xC6, 0x45, 0xA0, 0x32, 0x58, 0x19, 0x77, 0xAF, 0xC0, 0x87, 0xE5,
+    0xEA, 0x2B, 0xE9, 0x5B, 0x42, 0x26, 0x21, 0xAE, 0xAB, 0xA4, 0xBB, 0xAF, 0x5B, 0xB8, 0x20, 0x59,
+    0xCD, 0xDF, 0x55, 0xD0, 0x51, 0xF0, 0xA3, 0xDB, 0x2B, 0xB4, 0x37, 0x22, 0x9F, 0x48, 0x0A, 0xD2,
+    0xD5, 0xF8, 0x79, 0x39, 0x6A, 0x63, 0x78, 0x79, 0x29, 0xBF, 0xB4, 0x00, 0xC2, 0x64, 0x65, 0x9D,
+    0x7A, 0xFA, 0xB5, 0x34, 0xB7, 0x78, 0xC2, 0x25, 0xB7, 0xB3, 0xD5, 0xDA, 0x71, 0x64, 0x95, 0xBD,
+    0x71, 0xDE, 0xCF, 0x6E, 0x9D, 0x7B, 0xA7, 0x25, 0xCD, 0xE1, 0xC7, 0x61, 0xCE, 0x3E, 0xDE, 0x7E,
+    0xF7, 0x26, 0x69, 0x7B, 0x17, 0x95, 0x32, 0xD8, 0xC9, 0x6E, 0xE3, 0xEA, 0xFD, 0x86, 0x30, 0xE7,
+    0x81, 0xFC, 0x3E, 0xCA, 0x2D, 0xA2, 0x17, 0xCF, 0xD9, 0xB7, 0x17, 0xCC, 0x3F, 0x54, 0x97, 0x43,
+    0xDD, 0xF9, 0x19, 0xFC, 0xEF, 0xCF, 0x5F, 0x8C, 0x7A, 0x98, 0xDA, 0x54, 0xAD, 0xB5, 0x74, 0xD4,
+    0x1E, 0x3D, 0xF0, 0xAD, 0x16, 0xE3, 0x0B, 0xC7, 0x3F, 0xD3, 0xFF, 0xB1, 0xB1, 0xF4, 0xEA, 0xBB,
+    0xE8, 0x16, 0xE4, 0xF6, 0x4B, 0x38, 0x1B, 0xB8, 0xD8, 0xBF, 0xEC, 0xFA, 0x31, 0xE5, 0x63, 0x6C,
+    0x88, 0xD9, 0x4C, 0xD7, 0x69, 0xED, 0xFD, 0xB9, 0xE7, 0x75, 0xC1, 0x54, 0xCA, 0x45, 0xF4, 0xFA,
+    0xF9, 0x9D, 0x1D, 0xBA, 0x01, 0x4B, 0x03, 0x7D, 0x85, 0x80, 0x8C, 0x00, 0x1D, 0x1F, 0x1D, 0xF3,
+    0x2F, 0x16, 0x07, 0xE1, 0x2F, 0x1E, 0xD6, 0x97, 0xC5, 0x75, 0x16, 0xB2, 0x16, 0x0F, 0xA3, 0xEB,
+    0xA3, 0xB9, 0x0C, 0x69, 0x0C, 0x9E, 0x5A, 0xFE, 0x02, 0xE3, 0x82, 0xFE, 0xCF, 0x51, 0x63, 0xC9,
+    0x5F, 0xE5, 0xD2, 0x47, 0xFB, 0x46, 0x59, 0x84, 0x6F, 0x03, 0x03, 0x9D, 0x7F, 0x3E, 0x5B, 0xDB,
+    0xA5, 0x2B, 0x69, 0x8E, 0xB0, 0x9D, 0x35, 0x54, 0x9B, 0xB1, 0x54, 0x52, 0x55, 0xFA, 0x05, 0x9A,
+    0xBC, 0xAA, 0x19, 0x97, 0x6A, 0xA8, 0xEB, 0xDC, 0xD6, 0x64, 0x18, 0x33, 0xD4, 0xA2, 0x54, 0x74,
+    0x1A, 0x38, 0xE9, 0x1B, 0x6F, 0x16, 0xAD, 0xD5, 0x97, 0x63, 0x3A, 0xE2, 0x70, 0x25, 0x90, 0x19,
+    0xFB, 0x7C, 0xFF, 0x1B, 0x36, 0x14, 0x7D, 0x4F, 0xB3, 0xFB, 0xB5, 0x74, 0xE2, 0x66, 0x22, 0x9C,
+    0xB6, 0x57, 0x76, 0x66, 0x24, 0xF3, 0xC7, 0xE0, 0xAB, 0xEF, 0xDF, 0xB4, 0xCD, 0x8A, 0x8B, 0xB9,
+    0xF1, 0x39, 0x45, 0xAB, 0xA6, 0x29, 0x8D, 0xA6, 0x69, 0x3D, 0xA0, 0x5E, 0xF1, 0x02, 0x5A, 0x4D,
+    0xAA, 0x83, 0xAC, 0xC3, 0xCE, 0xFD, 0xD1, 0x7D, 0x30, 0xA4, 0xDB, 0xAA, 0x93, 0x9F, 0x98, 0x4F,
+    0x2F, 0x90, 0xE3, 0xA9, 0xE6, 0x3E, 0xEF, 0x77, 0xFB, 0xCD, 0xAD, 0xEB, 0xE1, 0x83, 0x01, 0xB9,
+    0xD1, 0x70, 0x27, 0xAB, 0x1B, 0xDB, 0xF3, 0x8E, 0x46, 0x79, 0x91, 0x5B, 0x09, 0x43, 0x83, 0x5D,
+    0x9B, 0x9F, 0xE2, 0xC3, 0xAE, 0xBC, 0x6A, 0xE6, 0x85, 0x91, 0x51, 0x60, 0xFB, 0x65, 0xCC, 0x66,
+    0xBA, 0x9D, 0x76, 0x57, 0xAD, 0xD1, 0x89, 0xCB, 0x79, 0xBB, 0xF7, 0xC4, 0xF5, 0x4A, 0xFB, 0xE9,
+    0xFD, 0xE2, 0xD4, 0xC6, 0xA7, 0x0D, 0xEB, 0x4E, 0x1B, 0x37, 0x48, 0xF3, 0x62, 0x47, 0xEB, 0xBE,
+    0xD7, 0xE9, 0xA6, 0xFE, 0x6F, 0xFB, 0xDF, 0x7A, 0x4E, 0xCB, 0x1B, 0xB6, 0x97, 0xAD, 0xA7, 0x97,
+    0x20, 0x1D, 0x6E, 0xE7, 0xED, 0x96, 0xDB, 0xF3, 0x5A, 0x7E, 0x52, 0xAF, 0xDA, 0x0D, 0x8B, 0xF5,
+    0x2E, 0x1F, 0x96, 0xAB, 0x8D, 0x9E, 0x3F, 0x57, 0xCF, 0xEF, 0x11, 0xB4, 0xD1, 0x63, 0xC8, 0x9C,
+    0xC9, 0xE2, 0x04, 0x15, 0x02, 0x1E, 0x0F, 0x54, 0x17, 0x4A, 0x8F, 0x87, 0xF4, 0x0B, 0x3F, 0x15,
+    0xE0, 0x08, 0xA4, 0xFB, 0xE8, 0xDD, 0x28, 0x3C, 0xE9, 0xCE, 0x93, 0xFD, 0xFE, 0xCC, 0x19, 0xEB,
+    0x00, 0x3D, 0x8C, 0x14, 0x88, 0xF0, 0x2D, 0x8C, 0x14, 0xFA, 0x2C, 0x30, 0x4E, 0x10, 0xF8, 0xCB,
+    0x6A, 0xB0, 0xD0, 0x58, 0xFA, 0xC6, 0x48, 0xC5, 0x28, 0x2D, 0xAE, 0x32, 0x7E, 0x21, 0x51, 0x37,
+    0x2E, 0x9F, 0xE8, 0x81, 0xF0, 0xF2, 0x73, 0xFB, 0xCE, 0xFE, 0x30, 0x43, 0x6F, 0xD5, 0x71, 0xF4,
+    0xCB, 0x67, 0x95, 0xBF, 0xAA, 0xD7, 0x7A, 0x97, 0xBF, 0xB2, 0x7F, 0x18, 0xBC, 0x9E, 0xE4, 0xC7,
+    0xE5, 0x10, 0xFB, 0x50, 0xF9, 0x73, 0xDC, 0x7A, 0x2E, 0xF2, 0x0F, 0x78, 0x35, 0x5F, 0xD6, 0x6C,
+    0x78, 0x29, 0xC3, 0x2B, 0x0B, 0x3E, 0x27, 0xDD, 0x9B, 0xFC, 0x36, 0xEB, 0xA5, 0x1D, 0x50, 0xF6,
+    0x28, 0xCC, 0x2E, 0xF4, 0xEB, 0x96, 0x08, 0x24, 0xC8, 0x37, 0x7A, 0xC0, 0x7D, 0x68, 0xBE, 0xCB,
+    0x7D, 0x6D, 0x4D, 0xB8, 0x0C, 0xDC, 0x2C, 0x1C, 0xFF, 0x32, 0x31, 0x8E, 0xB4, 0x24, 0x76, 0x6F,
+    0x80, 0x23, 0x42, 0x81, 0x46, 0x4B, 0x0D, 0xB8, 0x6A, 0xC1, 0x03, 0xC8, 0x71, 0x02, 0x9A, 0x02,
+    0x01, 0x51, 0x6A, 0xB7, 0xCB, 0xDE, 0xB5, 0x45, 0x4F, 0x02, 0xC2, 0xD2, 0x5B, 0x97, 0xDE, 0x42,
+    0xC2, 0x53, 0xE9, 0x68, 0x80, 0x28, 0x1C, 0xA4, 0x53, 0x38, 0x72, 0xC0, 0x71, 0xE5, 0x32, 0xEA,
+    0x0E, 0x6C, 0x10, 0xEA, 0x2C, 0x64, 0x06, 0x29, 0x5A, 0xA2, 0xBE, 0xAC, 0xEC, 0xCB, 0x5F, 0x4D,
+    0x02, 0xE4, 0x0C, 0xBC, 0x5B, 0x3D, 0x73, 0x30, 0x75, 0x8E, 0xFB, 0xE4, 0xF8, 0xF7, 0x7C, 0x18,
+    0x00, 0x3E, 0x4A, 0x4F, 0x6B, 0x77, 0x76, 0xF6, 0xF1, 0x6C, 0x76, 0xB6, 0x13, 0x38, 0x6A, 0xF9,
+    0x01, 0x60, 0x80, 0x9A, 0x37, 0xB5, 0xE7, 0x96, 0xEC, 0x85, 0x15, 0x7D, 0x91, 0x0E, 0xE1, 0xDC,
+    0xB2, 0x7C, 0x36, 0x1E, 0x01, 0x05, 0x7D, 0x86, 0x3D, 0x93, 0x85, 0x09, 0x48, 0x55, 0x08, 0xD1,
+    0x7A, 0x7B, 0xAF, 0x45, 0x76, 0x96, 0xD1, 0x75, 0x03, 0x00, 0xD0, 0xA1, 0xFF, 0x76, 0x98, 0x74,
+    0x06, 0x74, 0x22, 0x00, 0x00, 0x26, 0xDF, 0x46, 0x43, 0xC7, 0x5D, 0x47, 0x51, 0x81, 0xCF, 0xCC,
+    0xC9, 0x81, 0xD9, 0xC4, 0xDC, 0xC9, 0xD4, 0x82, 0xD9, 0xDB, 0xC1, 0x19, 0xF0, 0x6F, 0x13, 0xF0,
+    0xE6, 0x7B, 0x3B, 0x75, 0xB0, 0x70, 0x37, 0x21, 0xF7, 0x76, 0xB0, 0x77, 0x74, 0xE3, 0xF3, 0x16,
+    0xA4, 0xFC, 0x4F, 0x04, 0xDF, 0xDB, 0xF9, 0xBF, 0x6E, 0x16, 0x4A, 0xF2, 0xFF, 0x84, 0xB8, 0xDB,
+    0x09, 0x52, 0xEA, 0x28, 0xAA, 0x90, 0x8B, 0x3B, 0xB9, 0x5A, 0x90, 0x73, 0x31, 0x73, 0x32, 0xB3,
+    0x52, 0x0A, 0x01, 0xC9, 0xC9, 0xC9, 0x05, 0x5C, 0xCD, 0x2D, 0xF9, 0xD4, 0x24, 0xA4, 0xFE, 0x27,
+    0xFD, 0xAD, 0x25, 0x48, 0x69, 0xED, 0xEE, 0xEE, 0xCC, 0xC7, 0xC2, 0xE2, 0xE5, 0xE5, 0xC5, 0xEC,
+    0xC5, 0xC1, 0xEC, 0xE4, 0x6A, 0xC5, 0xC2, 0xC6, 0xCB, 0xCB, 0xCB, 0xC2, 0xCA, 0xCE, 0xC2, 0xCE,
+    0xCE, 0xF4, 0x16, 0xC1, 0xE4, 0xE6, 0xE3, 0xE8, 0x6E, 0xE2, 0xCD, 0xE4, 0xE8, 0x46, 0xF5, 0x5F,
+    0x90, 0xFF, 0x17, 0x47, 0xC2, 0xC2, 0xCD, 0xCC, 0xD5, 0xC6, 0xD9, 0xDD, 0xC6, 0xC9, 0x91, 0xFC,
+    0x5F, 0xDB, 0xC4, 0xD4, 0xC9, 0xC3, 0x5D, 0x90, 0x92, 0xF2, 0x7F, 0x62, 0xFE, 0xBB, 0xFD, 0xB7,
+    0x90, 0x85, 0xB7, 0xCD, 0xFF, 0x57, 0xC9, 0xD1, 0xED, 0x7F, 0x68, 0xBD, 0x11, 0x64, 0xF9, 0x37,
+    0xC2, 0xC2, 0xC6, 0xCC, 0xCA, 0xF2, 0xBF, 0xB0, 0xFF, 0xC1, 0xFF, 0xEB, 0xE5, 0x53, 0xB1, 0xF1,
+    0xB6, 0xB0, 0xD7, 0x91, 0xB0, 0x71, 0xB0, 0x70, 0x74, 0x7B, 0xAB, 0x21, 0xC4, 0xC3, 0xCA, 0x2A,
+    0xC0, 0xF2, 0x7F, 0x1C, 0xF9, 0x3F, 0x66, 0xEA, 0xFE, 0x5F, 0x33, 0x75, 0xFF, 0xB7, 0x4C, 0x01,
+    0x96, 0xFF, 0x1F, 0xA1, 0xFF, 0xAA, 0xC5, 0xF2, 0x3F, 0x72, 0x09, 0x01, 0x05, 0x58, 0xFE, 0x97,
+    0xF4, 0x42, 0xC0, 0x77, 0x37, 0x08, 0x04, 0x00, 0x00, 0xE5, 0x57, 0x59, 0x09, 0x51, 0x0D, 0x6F,
+    0xA3, 0xF3, 0x7C, 0xE4, 0x20, 0x8D, 0xFD, 0xF4, 0xCB, 0xBF, 0xAD, 0x95, 0x1D, 0x95, 0xC5, 0xA2,
+    0x19, 0x78, 0xE6, 0x9B, 0x5F, 0x44, 0xF1, 0xB4, 0x93, 0x06, 0xC0, 0xF4, 0xB1, 0x72, 0x18, 0x12,
+    0x70, 0xF8, 0x71, 0xD9, 0xD4, 0x09, 0x34, 0x83, 0x59, 0x16, 0x3B, 0x71, 0x63, 0xA0, 0x4D, 0x79,
+    0xCE, 0xE8, 0x9C, 0xFD, 0x78, 0x21, 0x2B, 0xCE, 0x03, 0xC5, 0x71, 0x73, 0x0A, 0x3A, 0x72, 0x24,
+    0x47, 0x24, 0x4A, 0xD5, 0x9F, 0x41, 0xB0, 0x4C, 0xB1, 0xC9, 0x86, 0x9E, 0xE6, 0x91, 0x46, 0x76,
+    0x5D, 0x97, 0x2F, 0x4E, 0x9B, 0xC0, 0x69, 0xC3, 0xF9, 0x80, 0xD6, 0xCA, 0xDA, 0xCA, 0xD7, 0x40,
+    0xF7, 0x19, 0xCD, 0x79, 0xCD, 0x56, 0xC7, 0x80, 0x87, 0x97, 0x1F, 0x6E, 0x93, 0xAD, 0xB6, 0x1D,
+    0x80, 0x70, 0x31, 0x93, 0x22, 0xB8, 0x62, 0x6B, 0x4F, 0x4F, 0x4D, 0xDA, 0x7A, 0x08, 0x21, 0x9D,
+    0x70, 0x86, 0x88, 0x22, 0x31, 0x9D, 0x5D, 0x55, 0xB1, 0x71, 0x74, 0x84, 0xDB, 0xEA, 0xD3, 0xB8,
+    0xB6, 0xF9, 0x7B, 0x30, 0x92, 0xA4, 0xD6, 0x32, 0xD3, 0xE0, 0xDF, 0xB3, 0x05, 0xB8, 0x0C, 0x12,
+    0xB9, 0xAD, 0xD0, 0x50, 0xE4, 0x22, 0xA9, 0x82, 0x2F, 0xEB, 0x76, 0xE5, 0x6B, 0xD6, 0xC9, 0x37,
+    0xB4, 0x1B, 0x7C, 0x4D, 0x8B, 0xCE, 0x7F, 0x45, 0x84, 0x2F, 0x84, 0x69, 0xC9, 0x95, 0xCD, 0x49,
+    0xDF, 0x82, 0x07, 0x97, 0x55, 0xCB, 0x76, 0x2B, 0x98, 0xD8, 0x5E, 0x2C, 0xAC, 0x60, 0x9F, 0x13,
+    0x63, 0xDA, 0x67, 0x5A, 0xFE, 0xB8, 0x72, 0x10, 0x07, 0xD1, 0x05, 0x51, 0xCA, 0xC0, 0x33, 0xA5,
+    0x1E, 0x10, 0xD4, 0xF8, 0x3D, 0x9E, 0x7D, 0x03, 0x74, 0x7B, 0x78, 0x5A, 0x86, 0x17, 0xC3, 0x15,
+    0x0F, 0x83, 0x94, 0x9D, 0x12, 0xB6, 0xF1, 0x73, 0x77, 0x96, 0x02, 0x74, 0x14, 0xAA, 0x65, 0x0A,
+    0x8A, 0x90, 0x9A, 0xA4, 0xE0, 0xA6, 0x41, 0x9C, 0xEA, 0xD7, 0x34, 0xDA, 0x0F, 0xBF, 0x4C, 0x66,
+    0xF6, 0x45, 0x6F, 0x47, 0x52, 0x19, 0x9F, 0x28, 0x13, 0x5C, 0xAC, 0xAE, 0xDF, 0xAD, 0xBD, 0x25,
+    0x5C, 0xE5, 0x65, 0x7A, 0x0E, 0xB8, 0xDC, 0xFA, 0xA9, 0xD5, 0xCC, 0x35, 0xEA, 0x14, 0x3F, 0x13,
+    0xC7, 0x90, 0xE3, 0x36, 0xF3, 0x0D, 0xFE, 0xBA, 0x33, 0xB9, 0xC6, 0x45, 0x93, 0x9C, 0xF1, 0x34,
+    0x62, 0xA2, 0x77, 0xA4, 0xE3, 0x26, 0xE3, 0xA5, 0x7A, 0xD6, 0x8D, 0x2D, 0xD9, 0xF2, 0xF1, 0xCC,
+    0x35, 0x1F, 0xC4, 0x11, 0x91, 0x79, 0xBD, 0xF5, 0xA3, 0x43, 0xC0, 0xC2, 0x72, 0x22, 0x2F, 0xC6,
+    0xC7, 0xBE, 0xFA, 0x6D, 0xE0, 0xF9, 0xF5, 0x7D, 0x6F, 0x7B, 0xF3, 0x01, 0x95, 0xD5, 0x5E, 0x78,
+    0x64, 0x9B, 0x9F, 0x07, 0xCE, 0x54, 0xF4, 0xE9, 0x3C, 0xAC, 0x51, 0x46, 0x75, 0x1F, 0x0A, 0xEA,
+    0x6E, 0xF4, 0xF1, 0xB4, 0x13, 0xAF, 0x2E, 0x87, 0xB2, 0x01, 0x69, 0xEF, 0x69, 0xE7, 0xC0, 0x27,
+    0x0E, 0x8F, 0xAE, 0x12, 0xBE, 0x6E, 0xA3, 0x83, 0xA1, 0xCB, 0x08, 0x0E, 0x74, 0xFE, 0x91, 0x83,
+    0x18, 0x38, 0x84, 0xF1, 0xF8, 0x22, 0x0F, 0x7E, 0x34, 0xCD, 0x8F, 0x51, 0xAE, 0xC4, 0x49, 0xF8,
+    0xA4, 0x94, 0x8E, 0x2D, 0x3C, 0x47, 0xC8, 0x1F, 0xBC, 0x3D, 0xC6, 0x2A, 0x88, 0xBC, 0xB1, 0x23,
+    0x93, 0x34, 0xA9, 0x51, 0xFD, 0x4C, 0xD4, 0xC7, 0xFD, 0x9D, 0x53, 0x1A, 0x5B, 0x4C, 0x27, 0x4B,
+    0x42, 0x6D, 0x91, 0xAB, 0x60, 0xDD, 0xF2, 0x7C, 0x62, 0xBE, 0x63, 0xC0, 0x89, 0xAB, 0xF4, 0x9F,
+    0xDF, 0x24, 0x74, 0xEC, 0x2F, 0x4C, 0xD8, 0xA4, 0xD8, 0xE3, 0x23, 0xB0, 0xEF, 0x44, 0x63, 0x24,
+    0x13, 0x39, 0x74, 0x61, 0xF1, 0x10, 0x67, 0x3C, 0xFF, 0xB2, 0x56, 0x67, 0xA4, 0xA5, 0x6A, 0xF7,
+    0x30, 0xB8, 0x2B, 0x99, 0x68, 0x61, 0x01, 0xA6, 0x8B, 0xD3, 0xB9, 0xE2, 0xFB, 0x92, 0x01, 0x8B,
+    0xA4, 0x1C, 0x53, 0x4A, 0x8D, 0xE7, 0xD6, 0x23, 0xCB, 0x99, 0xD1, 0xB7, 0x52, 0x65, 0x45, 0x8F,
+    0xBC, 0xF0, 0x4A, 0xD3, 0x78, 0xE5, 0x04, 0xA5, 0x32, 0x46, 0xDD, 0xE2, 0xE8, 0x40, 0xB5, 0x23,
+    0x4E, 0xE7, 0x92, 0x31, 0x25, 0xC5, 0xCE, 0xB3, 0xFF, 0xA4, 0x64, 0x3A, 0x42, 0xA6, 0x96, 0x16,
+    0x49, 0x4F, 0x98, 0xAC, 0xE1, 0x7C, 0x79, 0x84, 0x55, 0x07, 0x70, 0xC4, 0x5C, 0x1F, 0xEC, 0x8B,
+    0xFA, 0xB7, 0x32, 0x06, 0xDD, 0xAE, 0xC4, 0x2E, 0xCF, 0x72, 0x94, 0x6D, 0x55, 0x2A, 0xDD, 0x7C,
+    0x04, 0x86, 0xB0, 0x16, 0xE3, 0x37, 0xE9, 0x9A, 0xCC, 0x64, 0x70, 0xA9, 0xD2, 0x89, 0xD2, 0xE5,
+    0x90, 0x11, 0x32, 0x74, 0xC1, 0x88, 0x93, 0x5F, 0xC3, 0x79, 0xA1, 0x5F, 0x99, 0x0D, 0x35, 0x91,
+    0x77, 0x67, 0xE1, 0xF4, 0x51, 0x85, 0x2A, 0xC2, 0xE8, 0xEC, 0x9D, 0x71, 0x53, 0x86, 0xA8, 0x3B,
+    0x6C, 0xDA, 0xEF, 0xDF, 0xFC, 0x05, 0xC7, 0xAD, 0x78, 0xCF, 0x95, 0xA8, 0x84, 0xA8, 0x70, 0x92,
+    0x8D, 0x7C, 0x17, 0x29, 0xC9, 0x69, 0x11, 0x45, 0x4B, 0x34, 0x04, 0xB1, 0x0A, 0xF4, 0xDE, 0xF6,
+    0xC7, 0x4C, 0x57, 0x41, 0xB3, 0x6D, 0x2E, 0x2A, 0x33, 0x76, 0xE7, 0xBD, 0x48, 0x71, 0xC2, 0xA9,
+    0x77, 0x6A, 0xA0, 0xEA, 0x79, 0x45, 0x0F, 0x36, 0x70, 0x6F, 0x5E, 0xB8, 0x97, 0x05, 0x16, 0x4B,
+    0x99, 0x06, 0x22, 0xBB, 0xB4, 0x28, 0xA3, 0xED, 0x40, 0xD3, 0x30, 0x5E, 0x0D, 0xBF, 0x07, 0xEB,
+    0x6F, 0x08, 0x91, 0x5F, 0xAB, 0xD1, 0x57, 0x59, 0xBE, 0x13, 0xC1, 0x9C, 0xBE, 0x18, 0xA8, 0x7F,
+    0x92, 0xB0, 0x4D, 0x23, 0xC7, 0x59, 0xA6, 0xCA, 0x26, 0x8B, 0xC2, 0xA0, 0x79, 0xB8, 0x33, 0xB9,
+    0xBC, 0xC3, 0x78, 0xE5, 0xE6, 0x8E, 0x12, 0x42, 0xEF, 0x12, 0xA5, 0x27, 0x3C, 0xFF, 0x5D, 0x44,
+    0x17, 0x86, 0x2F, 0xE4, 0xB4, 0x64, 0x9E, 0x2B, 0x81, 0x2C, 0x96, 0xEC, 0x93, 0x22, 0x96, 0x34,
+    0x7D, 0x34, 0x28, 0x24, 0xA4, 0x31, 0x89, 0xB4, 0x9D, 0x2E, 0x1F, 0x7A, 0x44, 0x2F, 0x0B, 0x59,
+    0x3C, 0xB3, 0x28, 0x55, 0x33, 0x8B, 0xC4, 0x65, 0xB9, 0x1E, 0x8B, 0x3F, 0xE6, 0x57, 0x7A, 0xC3,
+    0xCA, 0x16, 0xE7, 0x04, 0xD0, 0x34, 0xEE, 0x60, 0x3A, 0x9E, 0x1F, 0x46, 0x06, 0xFA, 0x21, 0xB9,
+    0x49, 0x21, 0xAA, 0xA6, 0xF4, 0x62, 0x22, 0x9E, 0x26, 0x8E, 0x1D, 0x72, 0x6D, 0x83, 0x85, 0xD6,
+    0xEB, 0x4A, 0x63, 0x28, 0xF4, 0x81, 0xFF, 0x02, 0x83, 0xEF, 0xB5, 0x4A, 0x4B, 0x4B, 0xBD, 0x83,
+    0x13, 0x69, 0xE1, 0xD9, 0xDC, 0xA8, 0x23, 0x75, 0xCD, 0x95, 0x90, 0x64, 0x4B, 0xEC, 0x2B, 0x6C,
+    0xCF, 0xCC, 0x1E, 0x3F, 0x0A, 0xD7, 0xDF, 0xC8, 0x34, 0x3A, 0xDC, 0xBB, 0xBF, 0xC5, 0x15, 0xB8,
+    0x85, 0xDC, 0xE2, 0x43, 0xAF, 0x5E, 0xB9, 0xD9, 0xA2, 0xFA, 0x53, 0xC5, 0x41, 0x0B, 0x14, 0xFC,
+    0x96, 0xDC, 0x9F, 0x13, 0xC3, 0xC4, 0x9A, 0x6E, 0x39, 0x03, 0x70, 0xFE, 0x8A, 0x28, 0x1D, 0x52,
+    0x4D, 0x8E, 0xC9, 0x04, 0x63, 0x85, 0xF5, 0xB9, 0xD5, 0x5E, 0x1E, 0x84, 0x06, 0xCA, 0x23, 0x51,
+    0xC9, 0x43, 0xEC, 0x8C, 0x72, 0x19, 0x06, 0x86, 0x6B, 0xFC, 0xBF, 0x78, 0x47, 0xB5, 0x13, 0xFB,
+    0x67, 0xC1, 0x82, 0x91, 0xC2, 0x0F, 0xD7, 0x3E, 0x26, 0x4D, 0x94, 0x67, 0xBF, 0x4F, 0x3C, 0x81,
+    0xFC, 0xCE, 0x92, 0x14, 0x1D, 0xB6, 0xD3, 0x22, 0xD5, 0x0A, 0x51, 0xC1, 0xE1, 0xF9, 0xBC, 0x4F,
+    0xEC, 0x20, 0x8F, 0xC7, 0x64, 0xAA, 0x38, 0x77, 0x53, 0x09, 0x57, 0x4C, 0x87, 0x94, 0x20, 0xED,
+    0x71, 0x66, 0x66, 0x34, 0xAD, 0xF1, 0x9A, 0x44, 0x3D, 0x31, 0xF6, 0x56, 0x1E, 0xBE, 0xF7, 0xEF,
+    0x32, 0x35, 0x72, 0x33, 0x9B, 0x55, 0xE7, 0x85, 0xCB, 0x6E, 0x94, 0xF3, 0xD2, 0xC7, 0x94, 0x37,
+    0x34, 0x49, 0xD1, 0xAB, 0xD3, 0x09, 0x4A, 0xA4, 0x2A, 0x2A, 0x61, 0xEA, 0x46, 0x42, 0x9D, 0x1C,
+    0x5F, 0xD1, 0x7F, 0x7D, 0x1B, 0x90, 0x66, 0xF6, 0xE0, 0x18, 0x6C, 0xEE, 0x3E, 0x30, 0x26, 0x34,
+    0x4B, 0xA9, 0xC2, 0xB8, 0xEA, 0xCD, 0x15, 0x7E, 0xA4, 0x7A, 0x2C, 0x04, 0x8D, 0xF9, 0x81, 0xC2,
+    0x98, 0xD0, 0xF0, 0xF3, 0xF4, 0x37, 0xB4, 0x51, 0x79, 0xFD, 0x81, 0xBE, 0x9A, 0x08, 0xF9, 0x71,
+    0x92, 0xBD, 0xC3, 0xC9, 0x6E, 0x7A, 0x73, 0x35, 0x1C, 0x72, 0x65, 0x36, 0x2F, 0x72, 0xEE, 0xBE,
+    0xB2, 0xDB, 0x29, 0x2C, 0x88, 0xF2, 0xAD, 0xEF, 0x1B, 0x90, 0xD1, 0xED, 0x55, 0x84, 0xB5, 0x61,
+    0x9B, 0x39, 0x6E, 0x74, 0xED, 0x6B, 0x19, 0x63, 0xB3, 0x17, 0xB9, 0x1C, 0x46, 0xCC, 0x77, 0x8B,
+    0x81, 0x6D, 0x38, 0x7A, 0x86, 0xBD, 0x04, 0xCD, 0xCB, 0x4F, 0x11, 0xF2, 0xC6, 0xE7, 0xA5, 0x6F,
+    0xD7, 0x2A, 0x72, 0xC1, 0xD4, 0x5A, 0xA8, 0x90, 0x78, 0xB6, 0xD2, 0x36, 0xC2, 0x20, 0x4A, 0x77,
+    0x83, 0x35, 0x19, 0xFF, 0x6A, 0x9D, 0xA8, 0xE3, 0xFD, 0x7B, 0xB4, 0x9B, 0x02, 0x73, 0xCB, 0xEA,
+    0x90, 0xFB, 0x15, 0xE1, 0x1F, 0xD8, 0xCD, 0x1F, 0xE5, 0x94, 0x8D, 0x5E, 0x5B, 0x76, 0xA6, 0x06,
+    0x35, 0x36, 0xD6, 0xAF, 0x10, 0xAC, 0xB0, 0x12, 0x80, 0xCF, 0x36, 0x07, 0x91, 0xE0, 0x9C, 0xC4,
+    0xDD, 0x6D, 0x50, 0xB8, 0xA2, 0xF6, 0x1B, 0x47, 0x9F, 0x21, 0xF1, 0xD3, 0x12, 0x8F, 0x0C, 0x3B,
+    0xDA, 0x6C, 0x3C, 0xD1, 0x17, 0x6F, 0x99, 0xB9, 0xEB, 0x74, 0xAC, 0x30, 0xCA, 0xCB, 0xC7, 0x27,
+    0xBD, 0x6B, 0x74, 0xCF, 0x1C, 0x3D, 0xF0, 0x3C, 0x68, 0x61, 0x3D, 0xB2, 0xA8, 0xFD, 0x44, 0xCA,
+    0xEC, 0xCD, 0xB2, 0x37, 0x31, 0x85, 0xAF, 0x86, 0x95, 0xBE, 0xA6, 0xCB, 0xFC, 0xC3, 0x8A, 0x29,
+    0xC7, 0xE5, 0x93, 0xAD, 0x19, 0x01, 0xFF, 0x8A, 0xC7, 0x44, 0x2E, 0x46, 0x91, 0x13, 0x3A, 0x92,
+    0xA6, 0x91, 0x22, 0x67, 0x8A, 0x81, 0x7B, 0xCA, 0xAC, 0xE8, 0x45, 0xE9, 0x80, 0x71, 0x88, 0x0B,
+    0xCB, 0x77, 0xE8, 0x12, 0xB3, 0xF1, 0xC6, 0xF9, 0x4E, 0x82, 0xCF, 0x6F, 0x72, 0xEF, 0x21, 0xF3,
+    0x15, 0x14, 0x79, 0xD5, 0xA7, 0xF2, 0x83, 0x04, 0xE7, 0xF8, 0x2E, 0x1A, 0x1A, 0xDC, 0x2A, 0xDE,
+    0x0A, 0xB1, 0xB4, 0x39, 0xB6, 0xF3, 0x5A, 0x8E, 0x24, 0x78, 0x61, 0xFC, 0x79, 0x81, 0x4C, 0xFC,
+    0xA9, 0x79, 0x93, 0x89, 0x77, 0xAA, 0xF6, 0x04, 0xCE, 0x88, 0x23, 0xC2, 0x7B, 0x15, 0xE3, 0x5D,
+    0x57, 0x28, 0xF5, 0xDC, 0x0F, 0x92, 0xDA, 0x37, 0xBE, 0xAC, 0x83, 0xDD, 0x0C, 0x9A, 0x82, 0x0F,
+    0xEE, 0x4D, 0xC5, 0x88, 0xBE, 0x91, 0x75, 0xA8, 0xA6, 0x94, 0x0E, 0x87, 0x8A, 0x6F, 0xD2, 0x10,
+    0x5B, 0xCD, 0x27, 0xC3, 0x71, 0x13, 0xC9, 0xAF, 0xAD, 0x3E, 0xA0, 0x7F, 0x26, 0x36, 0x99, 0xE2,
+    0xC7, 0x78, 0xA3, 0xAD, 0xC4, 0xB1, 0x2F, 0x3E, 0x42, 0xD2, 0xD6, 0x5F, 0xAB, 0x78, 0xE9, 0x9C,
+    0xFB, 0xEE, 0x52, 0xE4, 0x8D, 0x25, 0xEF, 0x98, 0x1F, 0x22, 0xF6, 0x52, 0x80, 0x84, 0xAD, 0x5F,
+    0xE7, 0x86, 0x28, 0xE7, 0x5D, 0x79, 0xEC, 0x39, 0xA7, 0x74, 0xFE, 0x3F, 0x63, 0x43, 0x14, 0xCA,
+    0xBC, 0x3E, 0xD1, 0xE6, 0xBD, 0x45, 0xCE, 0x01, 0xAE, 0xD1, 0xEF, 0xF3, 0x43, 0xDF, 0xDC, 0x44,
+    0x49, 0x9B, 0x0D, 0xE1, 0x4F, 0x10, 0x5F, 0x3B, 0xED, 0x5D, 0x93, 0xFD, 0x89, 0x65, 0x79, 0x71,
+    0xF5, 0x1C, 0x7B, 0x7E, 0x88, 0x2E, 0xFB, 0x0F, 0x66, 0xC4, 0xFD, 0x9E, 0x9F, 0xD5, 0xAB, 0x5E,
+    0x9C, 0x18, 0xB4, 0xB9, 0x18, 0xA9, 0xE5, 0x29, 0xA1, 0xF1, 0x6F, 0x96, 0x9E, 0x74, 0x59, 0x1C,
+    0xA2, 0x8C, 0x08, 0x5B, 0x6B, 0xC8, 0xE5, 0x0F, 0x3B, 0x26, 0xC9, 0xDB, 0xFF, 0x6F, 0xE8, 0x40,
+    0xEF, 0x0A, 0x5C, 0xE0, 0x73, 0xC5, 0xC4, 0xF6, 0xBA, 0xC4, 0x46, 0x1F, 0xC5, 0xC6, 0xBA, 0xC1,
+    0x85, 0x7E, 0xF9, 0x9B, 0x2B, 0x3E, 0x30, 0xFB, 0xD0, 0x2E, 0x8F, 0xDB, 0x0A, 0x7B, 0x3D, 0x8E,
+    0xC9, 0x1C, 0xB6, 0x8B, 0x63, 0xFD, 0xCB, 0x67, 0xB5, 0xB3, 0x22, 0xD6, 0x47, 0x8F, 0x76, 0x59,
+    0x45, 0x4E, 0x8F, 0xF2, 0x8E, 0x74, 0x09, 0xF0, 0xA7, 0xB3, 0x3B, 0xDD, 0xC8, 0xFB, 0xA7, 0x45,
+    0x48, 0x82, 0xFE, 0x26, 0xF6, 0xE5, 0x27, 0xAF, 0xA8, 0x88, 0xE5, 0xCB, 0xAB, 0x93, 0xB2, 0x0B,
+    0xD7, 0x48, 0xEA, 0x37, 0xD6, 0x79, 0x5B, 0x95, 0x16, 0xA6, 0xF3, 0x4D, 0x52, 0xFC, 0xC5, 0x58,
+    0xC9, 0xAD, 0x01, 0x7E, 0x51, 0x64, 0x14, 0xF8, 0x4C, 0xF2, 0xE5, 0x25, 0xFF, 0x96, 0x93, 0x0C,
+    0xD2, 0x28, 0xB3, 0x65, 0xA5, 0xDC, 0x52, 0x5D, 0xE4, 0xAE, 0xD0, 0xEF, 0xFB, 0xC2, 0x2C, 0x37,
+    0x83, 0xFF, 0x91, 0x04, 0xC2, 0xE1, 0x59, 0x11, 0xAA, 0x12, 0x1D, 0x16, 0x5C, 0xEE, 0x80, 0x7E,
+    0xE9, 0x08, 0xFC, 0xD7, 0x73, 0xB3, 0xFF, 0x40, 0xA9, 0x40, 0x06, 0xC5, 0x72, 0xA8, 0xA4, 0x28,
+    0xEE, 0xDF, 0x04, 0xB6, 0xB5, 0x2A, 0x20, 0x8B, 0xA9, 0x92, 0x33, 0x2E, 0x11, 0x0D, 0x11, 0xAD,
+    0xE6, 0x85, 0xC9, 0xB9, 0x62, 0x5F, 0x5E, 0x8D, 0x82, 0x37, 0xC2, 0xE5, 0xFE, 0x91, 0x99, 0x08,
+    0x4B, 0x38, 0xCD, 0x94, 0xF9, 0xF6, 0x53, 0xEF, 0x62, 0x05, 0x2D, 0x1D, 0xCA, 0x7F, 0x77, 0xF4,
+    0xCD, 0xC4, 0x54, 0xDB, 0x8E, 0xC1, 0x66, 0x49, 0x14, 0x59, 0x6C, 0x86, 0xF1, 0xCE, 0x5B, 0x51,
+    0x0C, 0xDC, 0x49, 0xE2, 0x0C, 0xBD, 0x43, 0x77, 0x32, 0xBE, 0xE8, 0xFA, 0x8F, 0x67, 0xAB, 0x6F,
+    0x4B, 0x7F, 0xB1, 0x9D, 0x6D, 0x17, 0xCC, 0x2A, 0xE5, 0xC8, 0xED, 0xF2, 0x31, 0x9F, 0x1E, 0xF7,
+    0x07, 0x71, 0xB0, 0x9B, 0x75, 0xFC, 0x1B, 0xE9, 0x83, 0x7F, 0x47, 0xAA, 0x0F, 0x2E, 0x56, 0x1B,
+    0x0E, 0x06, 0xC5, 0x29, 0xF1, 0x90, 0x5C, 0x1A, 0x65, 0x13, 0xFC, 0xE7, 0x1E, 0xE9, 0x5A, 0x5C,
+    0xE9, 0xDB, 0x9B, 0xE2, 0xB2, 0xF1, 0x4C, 0xBF, 0x13, 0x2F, 0xA3, 0x95, 0xC6, 0x91, 0x4D, 0xDB,
+    0xDF, 0x9B, 0x58, 0x78, 0x9B, 0xFA, 0xDA, 0x24, 0x6C, 0x1D, 0x90, 0xCD, 0xAA, 0xAF, 0xB6, 0x3A,
+    0xE8, 0xE8, 0xAB, 0x88, 0x23, 0xE4, 0x52, 0x64, 0x32, 0xD3, 0xAC, 0x1F, 0x17, 0x83, 0x37, 0xB8,
+    0x21, 0x0B, 0xD2, 0xC8, 0x62, 0xDB, 0x09, 0x7A, 0x5B, 0xC5, 0x28, 0xB9, 0xE8, 0x26, 0xF7, 0x8B,
+    0x34, 0x57, 0x8F, 0x39, 0x6D, 0x5D, 0x1E, 0xBA, 0xA9, 0x2A, 0x4E, 0x5C, 0x3D, 0x2B, 0xD7, 0xD9,
+    0x28, 0xE9, 0x29, 0x6F, 0xB6, 0xCD, 0xA3, 0xBA, 0x7E, 0xB9, 0x72, 0x14, 0x7A, 0x71, 0xB7, 0x9E,
+    0x6B, 0xBE, 0x6F, 0x47, 0x4D, 0xCF, 0x6B, 0xA2, 0xC7, 0x7C, 0xCA, 0xD3, 0x9F, 0xBA, 0x2E, 0x36,
+    0xCE, 0x1D, 0xCF, 0xAD, 0x7A, 0x9B, 0x3E, 0x08, 0xD6, 0x4A, 0xE4, 0xDC, 0xAF, 0x66, 0x96, 0xBE,
+    0x56, 0xBD, 0xFC, 0xED, 0xA2, 0x88, 0x10, 0xA7, 0xCD, 0x8B, 0x94, 0x1B, 0xFF, 0x68, 0x99, 0xE0,
+    0xBE, 0xA3, 0x77, 0xF6, 0xF6, 0xB4, 0xD5, 0xBF, 0xD7, 0xF7, 0xA3, 0xD6, 0xE0, 0x73, 0x0D, 0x98,
+    0x4B, 0x2D, 0x68, 0xD5, 0xA4, 0xB9, 0xDA, 0xD5, 0x64, 0x7B, 0xBE, 0x2D, 0x8D, 0x26, 0xA0, 0x67,
+    0x22, 0xCA, 0x7C, 0x52, 0xF9, 0x10, 0xFD, 0x86, 0x40, 0xCA, 0x39, 0x6B, 0xBB, 0x85, 0xCB, 0x36,
+    0x8B, 0xDE, 0xFB, 0xD5, 0xEE, 0x05, 0x62, 0x9C, 0x98, 0xF5, 0xEE, 0x81, 0xD8, 0x3B, 0x32, 0x2B,
+    0xC1, 0xEE, 0xF9, 0xC9, 0x59, 0x92, 0xF6, 0xD2, 0xEF, 0xCB, 0xDC, 0xDB, 0x42, 0x51, 0x2F, 0xAD,
+    0x33, 0xD4, 0x1A, 0xF1, 0x9B, 0xAD, 0x5D, 0x7F, 0x4E, 0x8A, 0xEF, 0xD5, 0x10, 0x33, 0x74, 0x6F,
+    0xA6, 0x05, 0xF1, 0x02, 0xD3, 0x97, 0xE2, 0xC9, 0x67, 0xF7, 0xE6, 0x2C, 0xEC, 0x3F, 0x52, 0x2F,
+    0x24, 0x13, 0x76, 0x7E, 0xAE, 0x88, 0xB0, 0x8A, 0xE4, 0x22, 0xE9, 0x7B, 0xB1, 0x91, 0x46, 0x95,
+    0x17, 0xF2, 0x62, 0x75, 0x4E, 0xCC, 0x32, 0x3A, 0x9A, 0x60, 0x5B, 0xFE, 0x2F, 0x9D, 0x6A, 0x13,
+    0x9A, 0xD6, 0x5C, 0x5A, 0xCE, 0x7C, 0x54, 0x8D, 0x68, 0x67, 0xC7, 0xBF, 0x55, 0x7B, 0x68, 0x35,
+    0x7B, 0xC1, 0xEF, 0x04, 0x55, 0xBC, 0xB5, 0xEF, 0xEE, 0xB7, 0x73, 0x98, 0xFF, 0x27, 0x28, 0x67,
+    0x50, 0xA6, 0xC4, 0xC3, 0xDF, 0x84, 0x22, 0x9A, 0x26, 0x1F, 0x2F, 0x2C, 0xFF, 0x63, 0x83, 0x9A,
+    0x77, 0x5F, 0x23, 0x03, 0x84, 0x88, 0x1E, 0xAC, 0xFA, 0xB6, 0x94, 0xA0, 0x0F, 0x90, 0x6F, 0x8F,
+    0x11, 0x69, 0x47, 0x4E, 0x67, 0x8B, 0x33, 0xE7, 0x7C, 0xDA, 0xB9, 0x41, 0xB2, 0xB5, 0xDD, 0x4F,
+    0x48, 0xA5, 0xD1, 0x82, 0xFC, 0x3A, 0x09, 0xAD, 0xCA, 0x95, 0x46, 0xFD, 0xF7, 0x60, 0x90, 0x6A,
+    0x2D, 0x98, 0x16, 0xBD, 0x7F, 0x8F, 0xB2, 0xB5, 0xC2, 0xAC, 0x98, 0x3B, 0x7A, 0xD9, 0x32, 0x74,
+    0xC5, 0x47, 0xFB, 0xA2, 0x63, 0x1D, 0x20, 0x17, 0xBD, 0xB7, 0x65, 0x4C, 0xB4, 0x37, 0x74, 0x34,
+    0x7B, 0xC0, 0x21, 0xFF, 0xE6, 0x23, 0xDF, 0x12, 0xBE, 0xDA, 0xB3, 0xFD, 0xFE, 0x52, 0x3C, 0xDF,
+    0x92, 0x87, 0xF9, 0xA3, 0xB6, 0x50, 0xFE, 0x3F, 0xAC, 0x4E, 0xCE, 0x62, 0x06, 0xD2, 0x55, 0x5A,
+    0x84, 0x46, 0xCE, 0xED, 0x38, 0x65, 0xFA, 0x6F, 0x9C, 0x2A, 0x92, 0xA1, 0x2D, 0x01, 0xD1, 0x11,
+    0x5E, 0xB5, 0xF5, 0x78, 0xDD, 0xEE, 0x66, 0x1B, 0x9F, 0xA8, 0x67, 0xD0, 0xC5, 0xC1, 0x3E, 0xCF,
+    0x07, 0xC8, 0x13, 0x0C, 0x08, 0xFF, 0x5C, 0x8B, 0x84, 0xAD, 0xFF, 0xC4, 0x6B, 0xCB, 0x16, 0x4D,
+    0xDA, 0x22, 0x61, 0x4A, 0xD2, 0x19, 0x8B, 0x4D, 0x6B, 0xA2, 0x43, 0x63, 0xFA, 0xB8, 0x3C, 0x00,
+    0xE3, 0xEE, 0x34, 0xFF, 0x72, 0xF0, 0x0D, 0xAE, 0x98, 0x87, 0x64, 0x61, 0x81, 0xAB, 0xE7, 0x30,
+    0xB5, 0xC6, 0x27, 0x62, 0x48, 0x38, 0xD6, 0xE4, 0x97, 0x50, 0xE4, 0x1F, 0x34, 0x09, 0x31, 0xF0,
+    0xBD, 0x83, 0x00, 0x0F, 0x1D, 0xA4, 0xBF, 0xA3, 0xE6, 0x0D, 0x84, 0x07, 0xD9, 0xEE, 0xD4, 0xF6,
+    0xD3, 0xFD, 0x12, 0xE5, 0x1D, 0xB3, 0xCD, 0x0A, 0x27, 0xB7, 0x26, 0xF5, 0xD5, 0x16, 0x70, 0x84,
+    0x28, 0xAF, 0xBA, 0x42, 0x82, 0x4E, 0x08, 0x79, 0xA2, 0xFA, 0xCE, 0xC1, 0x1C, 0x05, 0x8C, 0x34,
+    0x20, 0xDB, 0xC7, 0x77, 0xC1, 0x3B, 0x95, 0x68, 0x23, 0x58, 0xED, 0x11, 0x85, 0xB6, 0xC7, 0x03,
+    0x1E, 0xF2, 0x09, 0x5D, 0x93, 0xF0, 0xAF, 0x4B, 0xB4, 0xEB, 0xA6, 0x59, 0xD0, 0x78, 0x93, 0xED,
+    0x24, 0xEA, 0x84, 0xE7, 0x2F, 0x23, 0x59, 0x41, 0x03, 0xEB, 0x72, 0x24, 0xAA, 0x57, 0xEA, 0x47,
+    0x8C, 0xA7, 0xEF, 0xA7, 0xBF, 0x9F, 0x59, 0x8B, 0x09, 0x7C, 0x4B, 0x89, 0xC4, 0x91, 0xC5, 0x4C,
+    0xA0, 0xD7, 0x42, 0x15, 0xDF, 0xC6, 0x86, 0xF4, 0xAB, 0x6A, 0x0A, 0x93, 0xBE, 0x9B, 0xA4, 0xE7,
+    0x7E, 0xEF, 0xCD, 0x93, 0x6F, 0xB8, 0x9A, 0x5D, 0xBB, 0x41, 0x97, 0x40, 0x2E, 0x29, 0xEB, 0xE7,
+    0x11, 0xA2, 0x9F, 0x19, 0xC3, 0xB1, 0x73, 0x79, 0x29, 0xA7, 0xC5, 0xF2, 0xEE, 0x71, 0xD8, 0x50,
+    0x29, 0xDD, 0x2D, 0x1A, 0xC0, 0xAB, 0xB6, 0x2F, 0x85, 0x9B, 0x49, 0x29, 0x76, 0x91, 0x23, 0xFE,
+    0xB1, 0x33, 0x26, 0x99, 0x91, 0x91, 0xBA, 0xB8, 0xBF, 0x99, 0xA4, 0x6D, 0x78, 0x80, 0xC6, 0xD5,
+    0xF3, 0xD7, 0x80, 0x00, 0x9A, 0xAD, 0x94, 0x51, 0x3C, 0x02, 0x2B, 0x87, 0xC1, 0x84, 0x3B, 0xC7,
+    0xF3, 0x59, 0x90, 0x2F, 0x08, 0x93, 0xA4, 0x66, 0xE0, 0xDA, 0xE1, 0x20, 0x1A, 0xF4, 0xA8, 0x86,
+    0xEF, 0xD3, 0xFF, 0x05, 0x12, 0xF0, 0x68, 0x7B, 0xB9, 0x36, 0x4A, 0xA4, 0x24, 0xF9, 0x56, 0x01,
+    0x6B, 0x86, 0xAD, 0x66, 0x3C, 0x92, 0x0C, 0xB5, 0x7E, 0xE1, 0x55, 0xF8, 0xE4, 0x9C, 0xB5, 0x12,
+    0xFC, 0xD3, 0x85, 0xD3, 0x3A, 0x51, 0xA6, 0x40, 0x8D, 0xB2, 0xC0, 0x42, 0x14, 0xFD, 0x00, 0xED,
+    0x6D, 0x12, 0x98, 0xC1, 0x32, 0x89, 0x55, 0xB3, 0x42, 0x83, 0x48, 0xEB, 0x73, 0x4C, 0x5E, 0xD6,
+    0x45, 0x9B, 0x0E, 0x08, 0x61, 0x86, 0xCE, 0x89, 0xFA, 0xA1, 0x4E, 0x40, 0xDB, 0xCF, 0x0A, 0xD3,
+    0x72, 0x7D, 0xFA, 0x2B, 0xE8, 0x44, 0x9B, 0x38, 0x4D, 0xF9, 0x56, 0x9A, 0x67, 0x55, 0x84, 0x36,
+    0x72, 0x5C, 0x26, 0x97, 0x71, 0x87, 0xD4, 0xED, 0x76, 0x27, 0x33, 0x0A, 0xA8, 0xA5, 0xB0, 0xD0,
+    0xBE, 0xF3, 0xB5, 0x20, 0x39, 0xE4, 0xB5, 0xC8, 0x59, 0x60, 0x82, 0xA3, 0x32, 0xC2, 0x78, 0x4F,
+    0xCF, 0xB3, 0x06, 0xF0, 0xCA, 0x48, 0x34, 0x91, 0x15, 0x0E, 0x2F, 0x84, 0x94, 0x32, 0xAA, 0x95,
+    0xB1, 0x10, 0xBA, 0xFD, 0x6A, 0xC9, 0xB0, 0x99, 0xC6, 0x7B, 0x27, 0xE1, 0xD3, 0xC8, 0xF5, 0x80,
+    0xD5, 0x15, 0xFD, 0x7C, 0x09, 0x8A, 0xCD, 0x84, 0x2D, 0x47, 0x47, 0x90, 0x1E, 0xC9, 0x58, 0xAC,
+    0xE4, 0x69, 0xFB, 0xA8, 0x30, 0x4B, 0x65, 0xDD, 0xB3, 0xB3, 0xB1, 0x7F, 0xE3, 0xB0, 0x96, 0xB7,
+    0x27, 0x1D, 0x23, 0x14, 0x4D, 0x0C, 0x8D, 0x96, 0x6B, 0xEB, 0x4B, 0xDF, 0x47, 0x33, 0xF9, 0x1C,
+    0x54, 0x4B, 0x3E, 0x62, 0x95, 0xD7, 0xBF, 0x9E, 0xAC, 0x4D, 0xFD, 0x87, 0xD2, 0x34, 0x66, 0xA7,
+    0x84, 0xE6, 0x7A, 0x50, 0x57, 0xF1, 0x79, 0xB5, 0xE1, 0xC5, 0x31, 0x99, 0x54, 0xFD, 0x65, 0xDB,
+    0xF7, 0x19, 0x9B, 0x71, 0x65, 0x98, 0x05, 0x58, 0x63, 0x1D, 0x62, 0xB6, 0x5C, 0x79, 0x3A, 0x51,
+    0x1C, 0x3E, 0x2E, 0xBE, 0x40, 0x6E, 0xFA, 0x4F, 0x3E, 0x3D, 0x1B, 0x4E, 0xAD, 0x03, 0x6C, 0x56,
+    0x90, 0x58, 0x9B, 0x22, 0x9C, 0x22, 0xEA, 0x19, 0xB7, 0x41, 0x9C, 0x62, 0x37, 0x97, 0xD7, 0xEC,
+    0x4C, 0x2C, 0x09, 0x0A, 0x2A, 0xD3, 0x36, 0xB7, 0x28, 0xB2, 0xF7, 0x05, 0x66, 0x35, 0x75, 0x26,
+    0x6E, 0x92, 0xB0, 0x5E, 0x2E, 0xDA, 0x2A, 0x54, 0x4E, 0xDF, 0xFC, 0x26, 0xB9, 0x53, 0xCA, 0xD7,
+    0xD8, 0x96, 0x12, 0x89, 0x98, 0x80, 0xAC, 0x8B, 0x2A, 0x21, 0x74, 0x1A, 0x50, 0x56, 0xDA, 0xBB,
+    0xEB, 0x6D, 0x1F, 0x94, 0xD8, 0x98, 0xF9, 0x62, 0xB3, 0x1E, 0xB1, 0x18, 0xD1, 0xB4, 0x2D, 0xCE,
+    0xE8, 0x84, 0xE3, 0x23, 0xFD, 0xCA, 0xED, 0xBF, 0x68, 0x53, 0x85, 0xD4, 0x1D, 0x42, 0x72, 0x18,
+    0xE1, 0x32, 0x12, 0x43, 0xF5, 0x10, 0x7F, 0xEF, 0xF5, 0x41, 0xF6, 0x24, 0x12, 0x63, 0x4C, 0xB6,
+    0x69, 0xC2, 0x35, 0xEA, 0x99, 0x1B, 0x08, 0x53, 0x24, 0xCD, 0x33, 0x8F, 0xE8, 0xDB, 0x15, 0x47,
+    0x9D, 0x1C, 0xCD, 0x28, 0xF5, 0x0F, 0x71, 0xD3, 0x6C, 0x38, 0xA3, 0x2D, 0x94, 0xAE, 0x2D, 0x0F,
+    0x29, 0x62, 0x19, 0xD6, 0x98, 0x15, 0x0E, 0xBC, 0xC6, 0x1B, 0x48, 0x21, 0x97, 0x24, 0x25, 0x25,
+    0x95, 0x79, 0x34, 0x44, 0x18, 0x62, 0xD7, 0x10, 0x1D, 0x94, 0x16, 0x0E, 0xD6, 0x9B, 0x47, 0x8E,
+    0x51, 0x77, 0x10, 0x3E, 0xDE, 0x66, 0x91, 0x77, 0xB0, 0xAE, 0x8D, 0xBA, 0xA5, 0x91, 0x03, 0xE1,
+    0x2F, 0x6E, 0x69, 0xB4, 0x21, 0x27, 0x08, 0xA7, 0xA6, 0x3A, 0x9E, 0xE4, 0x09, 0xD2, 0x42, 0xEC,
+    0x87, 0xDC, 0x3C, 0x92, 0xAE, 0xE9, 0x9F, 0x09, 0xF7, 0x86, 0xE2, 0x8C, 0x9E, 0xB2, 0x25, 0x16,
+    0xA5, 0x91, 0x4B, 0x30, 0x8A, 0x40, 0x7B, 0xE5, 0xF7, 0x52, 0xA7, 0xA6, 0x3C, 0xCC, 0x3E, 0x83,
+    0x9A, 0x6B, 0x07, 0xA3, 0xA0, 0x8C, 0xED, 0x7A, 0xCB, 0xCC, 0xAB, 0xB3, 0xB5, 0x49, 0xC2, 0x40,
+    0x61, 0xCA, 0xCF, 0xA9, 0x47, 0xBF, 0xF7, 0xAA, 0xC9, 0xBB, 0xBF, 0x95, 0xB1, 0x68, 0x71, 0x22,
+    0xA7, 0xEA, 0x46, 0x7B, 0xD3, 0x97, 0x87, 0x33, 0x2A, 0xDE, 0xC8, 0xCE, 0x06, 0x2A, 0x81, 0x8A,
+    0x48, 0xF8, 0x71, 0x43, 0xA3, 0xEA, 0x35, 0x65, 0xFA, 0x57, 0x04, 0x4E, 0xA3, 0x1D, 0x63, 0xF2,
+    0x70, 0xA0, 0xE3, 0x24, 0x2E, 0x2F, 0x67, 0x1C, 0x17, 0x4D, 0xC5, 0xD6, 0x38, 0x31, 0xA2, 0xF4,
+    0x4F, 0x66, 0x94, 0x11, 0x58, 0xB9, 0xC8, 0xD7, 0xFE, 0x8E, 0x81, 0x93, 0x92, 0xD1, 0xD9, 0x18,
+    0xAB, 0x03, 0x38, 0x26, 0xF3, 0x68, 0x4F, 0x8B, 0xD8, 0xEB, 0x38, 0xBC, 0xB4, 0x51, 0xBB, 0x3B,
+    0x11, 0x4E, 0xFA, 0xC4, 0xA2, 0x0F, 0xB0, 0x32, 0xD3, 0xEC, 0xC0, 0x78, 0xB5, 0xBE, 0x02, 0x71,
+    0x4A, 0x84, 0xAA, 0xDD, 0x54, 0xA5, 0xFD, 0xDF, 0x8E, 0x81, 0xDF, 0x85, 0x55, 0x25, 0x54, 0xA9,
+    0xDE, 0x7B, 0x33, 0x56, 0x65, 0xF5, 0xB3, 0xB7, 0x28, 0xA2, 0xC7, 0xB8, 0x7D, 0xF8, 0x6E, 0x97,
+    0xE6, 0x16, 0x62, 0x2D, 0xAC, 0x6C, 0xE0, 0xD3, 0xF0, 0x35, 0x25, 0x77, 0xB0, 0x08, 0x46, 0x9E,
+    0x8D, 0x04, 0x83, 0x2D, 0xAD, 0x23, 0x2B, 0xD7, 0x7F, 0x24, 0x3B, 0xD0, 0x3E, 0x8B, 0xB2, 0xD9,
+    0x5F, 0x82, 0x54, 0x07, 0x13, 0xDE, 0x58, 0x0D, 0x8D, 0x91, 0x58, 0x3B, 0xAC, 0x1B, 0x0F, 0x8F,
+    0x7D, 0x4C, 0xDA, 0xF5, 0x44, 0x1F, 0xCD, 0x90, 0x5A, 0x7B, 0x79, 0x29, 0xB5, 0xFA, 0xA2, 0x81,
+    0x12, 0x9E, 0xD3, 0xA0, 0xA2, 0xF8, 0x41, 0x09, 0xA5, 0x24, 0x15, 0xD1, 0x2C, 0x1C, 0xA1, 0x70,
+    0xBB, 0x9F, 0x94, 0x66, 0x17, 0xCB, 0x97, 0x8B, 0x1E, 0xF8, 0x5A, 0x21, 0x35, 0x64, 0x46, 0x05,
+    0xDB, 0xC6, 0xAC, 0x7C, 0xC0, 0xCD, 0x43, 0x61, 0xA5, 0x70, 0x59, 0xEC, 0xA1, 0x6A, 0xCF, 0x43,
+    0x57, 0x56, 0x80, 0x08, 0xA9, 0xCC, 0x41, 0x53, 0x47, 0xE5, 0x77, 0x44, 0x2D, 0xA9, 0x8A, 0x44,
+    0x79, 0xE7, 0x95, 0x7A, 0xD5, 0x74, 0x63, 0x89, 0x09, 0xCF, 0x40, 0xD5, 0xA2, 0x33, 0x1F, 0xA9,
+    0x1C, 0xEE, 0xE1, 0x6F, 0x56, 0x4F, 0xF6, 0xB7, 0x80, 0xCA, 0xAE, 0xDE, 0x32, 0x26, 0x0F, 0x43,
+    0xE2, 0x69, 0x06, 0x2E, 0xB0, 0x3B, 0x67, 0x0E, 0x67, 0x3F, 0x78, 0x56, 0xDC, 0x56, 0x81, 0xCD,
+    0x1E, 0x9F, 0xED, 0xCE, 0x96, 0xD3, 0x60, 0xE6, 0x7A, 0x3C, 0x83, 0xA7, 0xD6, 0xE7, 0x63, 0x08,
+    0x8C, 0x53, 0x58, 0xFC, 0xAA, 0xC5, 0xA5, 0xC4, 0xD5, 0xD1, 0xA6, 0x19, 0x0F, 0xA3, 0x54, 0x3E,
+    0x3A, 0xCD, 0xFE, 0xEF, 0x1A, 0xCB, 0x58, 0xD5, 0xB3, 0xB4, 0xC5, 0xEB, 0xDA, 0x3D, 0x0F, 0xED,
+    0xBB, 0xAB, 0xED, 0x1F, 0xB7, 0xDE, 0x71, 0x29, 0x9A, 0x9C, 0x86, 0xAC, 0x97, 0x1F, 0x89, 0x56,
+    0x14, 0xDA, 0x67, 0xAB, 0xBD, 0x53, 0x76, 0xAD, 0xA9, 0x75, 0x5F, 0x06, 0xEA, 0x29, 0xD7, 0x3E,
+    0xD6, 0x4F, 0x72, 0x7D, 0xB6, 0xD3, 0xC4, 0xF9, 0xB1, 0x4C, 0x1D, 0xE2, 0x92, 0x24, 0x80, 0x07,
+    0x87, 0x13, 0x2A, 0x91, 0xBA, 0x5A, 0x8E, 0x30, 0x43, 0x1B, 0x0F, 0x4A, 0x90, 0xCD, 0x0E, 0xF0,
+    0xF1, 0xC1, 0x21, 0xBB, 0x48, 0x71, 0x2D, 0xC9, 0xB4, 0x98, 0x01, 0xC7, 0xC6, 0x6A, 0xF3, 0x50,
+    0x7C, 0x44, 0x8E, 0x45, 0x28, 0x28, 0xDB, 0xDE, 0x9F, 0x91, 0x04, 0xAD, 0x0D, 0xAF, 0x45, 0x4D,
+    0x8F, 0x99, 0x48, 0xEC, 0x79, 0x0F, 0xBA, 0x48, 0xA0, 0xFE, 0x59, 0xB1, 0x5B, 0xCA, 0x39, 0x34,
+    0x4B, 0xAB, 0x9E, 0x3D, 0x23, 0x35, 0xDD, 0xCA, 0x75, 0x2D, 0xF3, 0xC1, 0x53, 0x42, 0x4C, 0xC7,
+    0xE5, 0xFB, 0x0A, 0x6A, 0xD9, 0x48, 0x32, 0x42, 0x7D, 0x5F, 0x1D, 0x5B, 0xDC, 0x3F, 0xCE, 0x2A,
+    0x24, 0x40, 0xAE, 0xB5, 0xA9, 0x67, 0xD4, 0x2F, 0xB1, 0x8A, 0x11, 0xEE, 0xB3, 0x1B, 0x80, 0x3E,
+    0x61, 0x5D, 0x63, 0xB2, 0xEB, 0x42, 0x22, 0x7E, 0x20, 0xED, 0x3C, 0xA2, 0xC6, 0x6B, 0x4D, 0xD8,
+    0xA7, 0x2E, 0x7E, 0x44, 0x57, 0xB7, 0x2F, 0x15, 0x4B, 0x0C, 0x9C, 0x55, 0x83, 0x8A, 0xE4, 0x68,
+    0x62, 0x28, 0x3B, 0xC6, 0x99, 0xA4, 0x8E, 0x12, 0xCD, 0x9A, 0xC5, 0x98, 0xC4, 0x46, 0xBD, 0x2D,
+    0x7A, 0x3F, 0x33, 0x6D, 0x6F, 0x9E, 0x31, 0x05, 0x54, 0x49, 0x53, 0xB3, 0xA4, 0x49, 0xEB, 0x89,
+    0x89, 0x18, 0xE4, 0x5E, 0xE3, 0x61, 0x31, 0xCD, 0xFE, 0x3A, 0xFF, 0x48, 0x40, 0xAF, 0xFB, 0x82,
+    0x3F, 0xB0, 0x3D, 0x42, 0x61, 0x26, 0xD4, 0x94, 0x5F, 0x4C, 0x1E, 0x2E, 0x02, 0x41, 0x0E, 0x11,
+    0x47, 0xBC, 0x30, 0x3E, 0x76, 0x25, 0x56, 0xA4, 0x70, 0x8B, 0x01, 0x4D, 0x2A, 0x51, 0x45, 0x18,
+    0x3B, 0xC4, 0x98, 0x6C, 0x6B, 0x5D, 0x03, 0x3D, 0x0F, 0x59, 0xAF, 0xCA, 0x76, 0xD8, 0x12, 0x34,
+    0x8F, 0x23, 0x8A, 0x66, 0x4D, 0x3C, 0x84, 0xEE, 0x8A, 0xA5, 0x5C, 0x53, 0xFD, 0x4B, 0x97, 0xE1,
+    0xD8, 0xDC, 0x1B, 0x0C, 0x90, 0x3C, 0xDD, 0xF1, 0x3E, 0x1D, 0x26, 0xD8, 0x31, 0x46, 0x51, 0x10,
+    0x2F, 0xBA, 0x6C, 0x22, 0xAA, 0x15, 0x3B, 0x7B, 0xE6, 0xAA, 0x53, 0xD3, 0xEA, 0xB7, 0x81, 0x83,
+    0xE3, 0x71, 0x15, 0x58, 0xF3, 0xE6, 0xA2, 0xFB, 0x45, 0x80, 0x61, 0x96, 0x98, 0xD0, 0xD4, 0xC2,
+    0x81, 0xFA, 0xE7, 0x6F, 0x06, 0xEE, 0xE5, 0x63, 0x94, 0x78, 0xEC, 0x38, 0xA1, 0x3F, 0x71, 0xC7,
+    0x09, 0x66, 0xA3, 0x83, 0xD7, 0xDA, 0xE5, 0xA0, 0x3D, 0xC0, 0x35, 0xC5, 0xF0, 0xBE, 0xD6, 0x51,
+    0xB6, 0x8B, 0x47, 0x9D, 0x84, 0xFD, 0xA4, 0xFB, 0x5B, 0x49, 0x54, 0x81, 0x43, 0x58, 0x8A, 0xD3,
+    0x90, 0x4F, 0x76, 0xC3, 0x7F, 0x88, 0x5D, 0xD7, 0x1A, 0xC5, 0xD4, 0xED, 0xB2, 0x4C, 0x97, 0x3E,
+    0xC8, 0x3A, 0x74, 0xE4, 0x51, 0x8C, 0x90, 0xF1, 0x2E, 0x8C, 0xC5, 0x32, 0xC3, 0x08, 0x5F, 0xBD,
+    0xD6, 0x86, 0x6D, 0xBB, 0x9C, 0xB9, 0x5E, 0xE8, 0x9B, 0x10, 0xD7, 0x31, 0x57, 0xC7, 0x30, 0x9D,
+    0x86, 0x80, 0x7A, 0xB4, 0xC0, 0xB8, 0xF4, 0x5C, 0x50, 0x9C, 0x7E, 0xFC, 0xB9, 0x90, 0xA3, 0x11,
+    0xBC, 0x02, 0xA9, 0x2C, 0x88, 0x3E, 0xB4, 0x87, 0xE1, 0x50, 0x92, 0xE0, 0x06, 0x44, 0x59, 0x5D,
+    0xDE, 0x3A, 0xCC, 0xE6, 0xC0, 0xBA, 0xDD, 0x85, 0xB4, 0x00, 0x11, 0xFD, 0xD2, 0x93, 0xD3, 0x07,
+    0xA1, 0x8F, 0x42, 0x5C, 0x94, 0x74, 0xB9, 0x0A, 0x5B, 0x53, 0x2D, 0x9E, 0x3D, 0x56, 0x41, 0x55,
+    0xDD, 0x1A, 0x56, 0x14, 0x95, 0x97, 0x6F, 0x4D, 0x23, 0x4B, 0x5D, 0xF4, 0xF3, 0xD9, 0xDF, 0x73,
+    0xAD, 0xE6, 0xB5, 0x14, 0x4C, 0x6C, 0xB3, 0xF2, 0xC0, 0x71, 0x0A, 0x64, 0xAE, 0xF3, 0xE2, 0x1B,
+    0x63, 0x8E, 0x1C, 0xC9, 0x21, 0xF7, 0xD4, 0xA0, 0xBD, 0xF2, 0x6E, 0xFC, 0xA8, 0xE7, 0x82, 0xA5,
+    0x8E, 0x4A, 0xCC, 0x37, 0x43, 0x61, 0x7D, 0xEE, 0x6A, 0x5F, 0x81, 0x63, 0x76, 0x37, 0x8B, 0xB7,
+    0x6F, 0xD6, 0xAA, 0x95, 0xF3, 0x90, 0xBB, 0x55, 0x31, 0xC1, 0xF6, 0xB2, 0xE8, 0xDB, 0x9E, 0xA0,
+    0xE4, 0x85, 0x31, 0xEA, 0xD2, 0x48, 0x13, 0xD5, 0xED, 0xE8, 0x59, 0xCD, 0xA8, 0x01, 0x6A, 0x8D,
+    0x75, 0x98, 0xDF, 0xB0, 0x75, 0x12, 0x0A, 0xDD, 0x3C, 0x65, 0x4F, 0x9B, 0xAB, 0xDF, 0x69, 0xCA,
+    0xF4, 0xC7, 0x1C, 0x7A, 0x48, 0x65, 0xD2, 0x87, 0xF7, 0x25, 0x81, 0x50, 0x46, 0x5D, 0x56, 0x47,
+    0x8B, 0x59, 0x8D, 0xE5, 0x9D, 0xC4, 0x0B, 0x21, 0x0F, 0xA1, 0xC8, 0xFA, 0x50, 0x3B, 0x7E, 0x90,
+    0x1A, 0xB6, 0x6C, 0xBF, 0x63, 0x48, 0x5E, 0x1C, 0x5B, 0x15, 0x14, 0x4F, 0x98, 0x4F, 0x24, 0xF1,
+    0x8B, 0xEF, 0x49, 0xEF, 0x19, 0x62, 0xC1, 0xD2, 0x3E, 0xB0, 0x1C, 0xB5, 0x21, 0x4D, 0x72, 0x11,
+    0x3D, 0xAB, 0x5C, 0xB8, 0x2E, 0x2C, 0x94, 0xA9, 0x51, 0x0B, 0xBA, 0xFE, 0x4A, 0x65, 0x3D, 0x8C,
+    0x49, 0xB2, 0xBE, 0x6A, 0x3D, 0x5D, 0x1E, 0x49, 0xBC, 0xBC, 0x30, 0xAC, 0xE6, 0x93, 0xDA, 0x59,
+    0x1B, 0x3A, 0x97, 0x6C, 0x16, 0xCF, 0xA8, 0xE8, 0x04, 0x44, 0x36, 0x94, 0x2E, 0x7C, 0xDA, 0xD9,
+    0x8E, 0x67, 0xAD, 0xA8, 0xAF, 0x33, 0x1B, 0x84, 0x57, 0x1D, 0xD4, 0x02, 0xB7, 0xE4, 0xD0, 0x09,
+    0x46, 0x81, 0x24, 0xD0, 0x9A, 0xF9, 0x6A, 0x4F, 0x2E, 0xFA, 0x2F, 0x4E, 0xF3, 0x68, 0xD5, 0x17,
+    0x3D, 0x7E, 0x2D, 0x22, 0x8F, 0xC5, 0xBA, 0x64, 0x0B, 0x44, 0x84, 0x39, 0x3C, 0xDC, 0x2B, 0x0B,
+    0x0F, 0xF5, 0x4E, 0x25, 0xB4, 0xAA, 0x23, 0x1A, 0xE3, 0xB1, 0x12, 0xE0, 0x42, 0xFF, 0xD8, 0x95,
+    0x22, 0xB9, 0xC5, 0x94, 0x00, 0xD3, 0x4F, 0x50, 0x95, 0x47, 0x77, 0xF8, 0xC5, 0xFF, 0xE8, 0xF8,
+    0x86, 0x3F, 0xB7, 0x0F, 0x3F, 0x0C, 0xBB, 0xC4, 0xC9, 0x0A, 0x3A, 0x62, 0xB2, 0x19, 0xAC, 0x66,
+    0x5A, 0x26, 0xFD, 0x26, 0xFC, 0xE5, 0xAF, 0x08, 0x25, 0xAF, 0xB3, 0xF9, 0xC0, 0x14, 0x4A, 0x80,
+    0x0D, 0xC7, 0xBF, 0x55, 0x60, 0x40, 0x05, 0xD6, 0xF5, 0xBE, 0x9D, 0x3E, 0x17, 0x67, 0xD3, 0x78,
+    0xF7, 0xA3, 0x9D, 0x31, 0xE8, 0xEF, 0xE9, 0xCC, 0x01, 0xC5, 0x94, 0x01, 0x9D, 0xA6, 0xA7, 0x46,
+    0xC2, 0xE9, 0xA0, 0xFC, 0x55, 0x97, 0xE9, 0xE5, 0xF1, 0x82, 0x29, 0x49, 0x33, 0x67, 0xC8, 0xBA,
+    0x63, 0xC6, 0xC0, 0x94, 0x38, 0x3B, 0x4D, 0xD4, 0x2D, 0x8F, 0xD6, 0x88, 0xCD, 0xF8, 0x87, 0xC5,
+    0xA2, 0x41, 0xD1, 0x29, 0x1B, 0xA5, 0x3E, 0xCB, 0x79, 0xBD, 0xAD, 0xAE, 0x68, 0xD1, 0xB5, 0xF9,
+    0xA9, 0xD8, 0xDA, 0x7D, 0x6A, 0xC2, 0xD7, 0x9E, 0x74, 0x0E, 0x09, 0xEB, 0x04, 0x6C, 0x7B, 0xCC,
+    0xFE, 0x45, 0xC4, 0x67, 0x75, 0xE6, 0x23, 0xE7, 0x7E, 0x44, 0xD5, 0xEA, 0x25, 0xFD, 0xAC, 0x00,
+    0xB4, 0xF8, 0x64, 0x4C, 0xD1, 0x17, 0x47, 0x3F, 0xE2, 0xCE, 0x84, 0x61, 0x4D, 0x57, 0x2C, 0x7A,
+    0x02, 0xB6, 0x9A, 0x04, 0xFE, 0xE7, 0xAF, 0x89, 0x36, 0xB7, 0x08, 0x31, 0x7A, 0xF6, 0xB6, 0x53,
+    0x4D, 0xE4, 0xCC, 0xFC, 0x73, 0xCF, 0x25, 0xDD, 0x5D, 0x5E, 0x80, 0x87, 0x3C, 0xDA, 0x7D, 0xE8,
+    0x36, 0xB6, 0xA7, 0x40, 0xF8, 0x36, 0x81, 0x3B, 0x2A, 0x8F, 0x7A, 0xFF, 0x25, 0xB3, 0xE3, 0x11,
+    0x49, 0xB7, 0x36, 0xE9, 0xC0, 0x4B, 0xCD, 0xCE, 0xBA, 0x9B, 0xBB, 0xDB, 0x2F, 0x85, 0x14, 0x18,
+    0xD1, 0xA3, 0x36, 0x71, 0x5B, 0x7C, 0x69, 0x92, 0x8F, 0xDF, 0xBF, 0xAA, 0xED, 0x76, 0xF1, 0x75,
+    0x03, 0x16, 0x90, 0xD3, 0x9D, 0xBF, 0xB6, 0xC9, 0xBC, 0x7D, 0x80, 0xB2, 0x75, 0xF8, 0xF0, 0xFC,
+    0x6D, 0x17, 0x9A, 0x92, 0x41, 0xBA, 0x1F, 0x2F, 0xDB, 0xF1, 0x81, 0xA2, 0x70, 0x11, 0x88, 0x5D,
+    0x3B, 0xD9, 0x5F, 0xA4, 0x1B, 0x58, 0x46, 0x50, 0xCF, 0x10, 0xD5, 0x39, 0x64, 0x2D, 0x09, 0x37,
+    0xB0, 0x45, 0x94, 0xB7, 0x9F, 0x5A, 0x37, 0xA4, 0x7D, 0x1E, 0x9B, 0x0B, 0x7D, 0x08, 0x69, 0x7B,
+    0x0D, 0xC0, 0x7C, 0x97, 0x78, 0x42, 0xAD, 0x91, 0xF2, 0x7D, 0x57, 0x49, 0x16, 0x8F, 0xB6, 0x11,
+    0x17, 0x5C, 0x98, 0xBC, 0xF2, 0x90, 0x97, 0x20, 0xF4, 0x53, 0x67, 0x63, 0x6B, 0x9A, 0xE4, 0xE1,
+    0xEE, 0xBD, 0xC8, 0x0F, 0xC1, 0xB0, 0xDC, 0x6C, 0x62, 0x8E, 0x99, 0x83, 0xCA, 0x48, 0x9C, 0xC8,
+    0x99, 0x6B, 0xAB, 0x8D, 0xC3, 0x3C, 0x78, 0xCC, 0x89, 0x47, 0x47, 0x21, 0xE2, 0x0E, 0xDE, 0x30,
+    0xE1, 0x44, 0xFB, 0x23, 0x82, 0xD7, 0x36, 0xAA, 0x04, 0xC4, 0xD7, 0xC1, 0x84, 0xD6, 0x8C, 0x0F,
+    0x08, 0x3B, 0xC7, 0x79, 0xB6, 0xE8, 0x1F, 0xE8, 0xFC, 0xB2, 0x05, 0x67, 0xD1, 0x81, 0x1A, 0xCC,
+    0x06, 0x8B, 0x0B, 0x84, 0xF7, 0x5F, 0x97, 0xD6, 0xF8, 0x9D, 0x0E, 0x34, 0x20, 0xD4, 0x03, 0x20,
+    0xDA, 0x5F, 0xB7, 0x5C, 0xA7, 0x09, 0x7F, 0x50, 0xEE, 0x07, 0x1B, 0x9C, 0x8D, 0x61, 0xC9, 0xC8,
+    0x2A, 0x4E, 0xAB, 0x41, 0xB3, 0x93, 0x91, 0xD7, 0xF9, 0x01, 0x8F, 0x72, 0x4E, 0xC6, 0x2B, 0x46,
+    0x8E, 0xF7, 0x62, 0x44, 0x24, 0x4E, 0x9E, 0x7E, 0xC5, 0x4F, 0xF9, 0x92, 0xCE, 0xBF, 0xE3, 0xFA,
+    0xB2, 0x8E, 0xF7, 0x2B, 0xC8, 0x3B, 0xBA, 0x09, 0x07, 0x03, 0x2F, 0x38, 0x3E, 0xB5, 0x46, 0x27,
+    0x94, 0x93, 0x3B, 0x7E, 0xFF, 0xDD, 0x62, 0xDA, 0x24, 0xB7, 0x4D, 0x7C, 0x23, 0x86, 0xF1, 0x82,
+    0xAE, 0xD9, 0x93, 0xC8, 0x8C, 0xBE, 0x45, 0x2B, 0xFE, 0x5D, 0xA1, 0xE0, 0x74, 0x2B, 0x86, 0x80,
+    0xC3, 0x6B, 0xD0, 0xC5, 0x89, 0x00, 0x65, 0x78, 0xD5, 0x55, 0x07, 0xDC, 0x47, 0x30, 0x69, 0x28,
+    0x9D, 0x8F, 0x3A, 0x42, 0xC7, 0x2A, 0xEA, 0x8D, 0xC7, 0x3E, 0xB1, 0x46, 0xD0, 0x1F, 0xA8, 0xF4,
+    0xDB, 0x25, 0x45, 0x26, 0x32, 0xD8, 0x38, 0x0E, 0xF5, 0x0B, 0x8E, 0xB8, 0x51, 0x4F, 0x06, 0x35,
+    0x66, 0x7F, 0x75, 0x83, 0x51, 0xB4, 0xE8, 0xD0, 0x8D, 0x38, 0xB2, 0x40, 0x23, 0x45, 0xC4, 0x8C,
+    0x3C, 0xD5, 0xF4, 0xAB, 0x5A, 0x2C, 0x87, 0x55, 0xF8, 0xF5, 0xFA, 0x7C, 0xDE, 0xF0, 0x6E, 0x0D,
+    0xA8, 0x45, 0xA3, 0x0D, 0x43, 0x1C, 0x66, 0x27, 0x3B, 0x72, 0xDA, 0x52, 0x36, 0x48, 0xCE, 0x67,
+    0x19, 0x37, 0x2C, 0x4C, 0x6E, 0x5D, 0x8E, 0xF3, 0xCC, 0xE6, 0xCB, 0x21, 0xB7, 0x95, 0x20, 0x9C,
+    0x7C, 0x02, 0x5B, 0xC7, 0x8B, 0x7D, 0x2E, 0x8E, 0xC4, 0x26, 0x0D, 0xCD, 0xAF, 0x2F, 0x66, 0x76,
+    0x65, 0x09, 0x92, 0xCF, 0xBB, 0x3A, 0xFE, 0x22, 0x43, 0xFA, 0x58, 0x1D, 0x1A, 0xDA, 0xC3, 0xA9,
+    0x52, 0xBA, 0xA3, 0xF1, 0xE9, 0x70, 0x9F, 0x63, 0xF1, 0x2E, 0x48, 0x8F, 0x86, 0x3E, 0x1B, 0xEE,
+    0x29, 0x0A, 0x23, 0x6C, 0x03, 0x4F, 0x0D, 0x2D, 0xE5, 0x1D, 0xA0, 0x25, 0x5E, 0x2B, 0x3E, 0xA3,
+    0xEC, 0x2A, 0xA4, 0x3B, 0xEE, 0x6D, 0xA8, 0x31, 0x33, 0xB9, 0x36, 0xAD, 0x2A, 0x15, 0x92, 0xED,
+    0xA4, 0x44, 0x75, 0x13, 0xFD, 0x1B, 0xFC, 0x05, 0x7E, 0x12, 0xD2, 0x97, 0x2D, 0x06, 0x5B, 0x55,
+    0x4B, 0xC1, 0x20, 0x77, 0xD4, 0x00, 0x06, 0xD4, 0xF3, 0xF7, 0x5C, 0x47, 0xC2, 0x2C, 0x71, 0x7E,
+    0x5A, 0x83, 0xAC, 0xC6, 0x62, 0x25, 0xB6, 0x34, 0x03, 0xD5, 0x35, 0xCB, 0x7B, 0x23, 0x42, 0x80,
+    0x88, 0xC2, 0xEA, 0xF6, 0xB2, 0xA8, 0xCB, 0xAB, 0xFA, 0x0F, 0x1D, 0x72, 0x71, 0x6D, 0x63, 0x06,
+    0x99, 0xA6, 0x74, 0x22, 0x02, 0x98, 0x61, 0x0D, 0xA8, 0x31, 0xD8, 0xB9, 0x19, 0xA7, 0xD7, 0xDF,
+    0xA0, 0x6B, 0x0E, 0x37, 0x35, 0xB4, 0x69, 0xA6, 0xDF, 0xF0, 0xDE, 0xA5, 0x13, 0x3E, 0xBB, 0x11,
+    0xAD, 0x6A, 0x83, 0x2B, 0x30, 0xCC, 0x7E, 0x52, 0xC3, 0xAD, 0x38, 0xEB, 0x24, 0xF4, 0xD3, 0xE8,
+    0x72, 0x8B, 0x4D, 0x3F, 0xEA, 0xA2, 0x73, 0x2A, 0x01, 0x45, 0x02, 0x5F, 0x61, 0x84, 0x95, 0x29,
+    0x1B, 0x4C, 0x48, 0x04, 0xDA, 0x0D, 0x64, 0x64, 0xA2, 0x16, 0x23, 0x4C, 0x3F, 0xB9, 0x97, 0x43,
+    0x9D, 0x09, 0x6B, 0xE5, 0xBD, 0x4F, 0x10, 0xB1, 0x3E, 0x37, 0x7E, 0x3A, 0x1F, 0x2C, 0xC4, 0xB2,
+    0x4D, 0x2B, 0x80, 0x11, 0xC8, 0x73, 0xB2, 0x0B, 0x67, 0x97, 0x48, 0x51, 0xD9, 0xDD, 0x77, 0x91,
+    0x4C, 0x68, 0x29, 0x5C, 0x77, 0x16, 0x08, 0xE6, 0x30, 0xC2, 0x31, 0x33, 0x1F, 0xE1, 0x80, 0x6B,
+    0x52, 0xB3, 0xDF, 0x09, 0xA8, 0xBB, 0xB8, 0x88, 0x07, 0xED, 0x50, 0x32, 0xFF, 0x95, 0xBF, 0x79,
+    0x7A, 0x31, 0xE0, 0x72, 0x6B, 0x80, 0xA9, 0x95, 0xF3, 0xF1, 0xF2, 0x80, 0xBD, 0x6D, 0x3B, 0xED,
+    0x5A, 0x27, 0xDC, 0x40, 0x4D, 0x5F, 0x88, 0x9F, 0x2A, 0x55, 0x91, 0x55, 0x5A, 0xB6, 0x9E, 0xCA,
+    0xFC, 0xB6, 0x3F, 0xAD, 0x38, 0xD0, 0x56, 0xDC, 0xF9, 0xE7, 0x6A, 0xBF, 0x39, 0xC0, 0x05, 0x75,
+    0x9F, 0xD5, 0x36, 0xD0, 0x81, 0x9F, 0x0B, 0x82, 0xB4, 0x63, 0x17, 0xB0, 0x16, 0x29, 0x7F, 0x87,
+    0x0A, 0x13, 0xA3, 0x1A, 0x4D, 0xC1, 0x54, 0x0B, 0x77, 0x5D, 0x66, 0x81, 0xEE, 0xF7, 0x65, 0x80,
+    0xE6, 0xA2, 0xB3, 0xE7, 0xF2, 0x18, 0xB8, 0x40, 0x10, 0x0E, 0x8B, 0x57, 0xE7, 0xEC, 0x62, 0x45,
+    0x76, 0x67, 0x33, 0x90, 0x70, 0x6F, 0xFE, 0xF8, 0xEB, 0x2B, 0xA8, 0x56, 0xFE, 0xE2, 0xD8, 0x52,
+    0x1A, 0xF5, 0xC5, 0xBE, 0xC2, 0xCD, 0xF1, 0x7C, 0xBF, 0xB6, 0x9A, 0xA7, 0x5C, 0xD4, 0x27, 0xE2,
+    0xAB, 0x8B, 0xC1, 0x28, 0xCA, 0xC3, 0x60, 0xC3, 0x1F, 0x0C, 0x3B, 0x85, 0xDC, 0x70, 0x86, 0x66,
+    0x0D, 0x86, 0xE8, 0xEC, 0xCF, 0x2E, 0x05, 0x5E, 0x35, 0x60, 0x82, 0x70, 0x84, 0x0F, 0x4F, 0x7D,
+    0x54, 0xF8, 0x4F, 0x0D, 0xAE, 0xD5, 0x1C, 0x89, 0xF7, 0x13, 0x9A, 0xAA, 0x2F, 0x49, 0x82, 0x3D,
+    0x4A, 0x96, 0xB9, 0xD1, 0xA0, 0xDF, 0x5E, 0x3B, 0x7E, 0x79, 0x44, 0x6C, 0xFA, 0xE1, 0x7F, 0x46,
+    0x39, 0x74, 0xFA, 0x1A, 0xC8, 0x69, 0x7E, 0x58, 0xF9, 0x22, 0xF2, 0x0F, 0x87, 0x6F, 0x5F, 0x05,
+    0xDF, 0x5C, 0xFB, 0x50, 0x22, 0x1C, 0xA0, 0x98, 0x4A, 0x93, 0x19, 0xE1, 0x43, 0x13, 0x23, 0x79,
+    0xF8, 0x0F, 0x19, 0x32, 0x25, 0xAF, 0x5E, 0x36, 0xC1, 0x07, 0x6C, 0xBE, 0x97, 0x24, 0x20, 0xAA,
+    0xFE, 0xB2, 0x8D, 0xC9, 0x7E, 0x70, 0x84, 0xEC, 0x2B, 0x7E, 0xD9, 0x74, 0x3A, 0x88, 0x71, 0x5B,
+    0x06, 0x63, 0xCA, 0x85, 0x9A, 0x3A, 0x17, 0xF1, 0xBC, 0x45, 0x05, 0xEA, 0xAE, 0xC0, 0x70, 0x6B,
+    0x22, 0xB2, 0x4A, 0xFC, 0x3E, 0x9D, 0x6E, 0x2D, 0x2A, 0xE1, 0x7E, 0x80, 0x10, 0xAB, 0x35, 0x9C,
+    0xB5, 0x32, 0xF9, 0x38, 0x3D, 0x7E, 0xE6, 0xB9, 0x99, 0xF5, 0x75, 0x94, 0xE2, 0xA7, 0x12, 0xE2,
+    0xE8, 0xB5, 0x00, 0xB4, 0xC1, 0xBF, 0x26, 0x71, 0xEE, 0x06, 0x8B, 0xAD, 0xBE, 0x50, 0x34, 0xBA,
+    0x97, 0x3D, 0x41, 0xEE, 0xF7, 0x45, 0xA2, 0x04, 0x9A, 0x67, 0x29, 0x62, 0x04, 0xE9, 0x0D, 0x87,
+    0x9F, 0x7B, 0x82, 0x1F, 0x62, 0x81, 0x55, 0x7C, 0xC2, 0x07, 0xD3, 0x30, 0xE9, 0xBA, 0xC3, 0x3C,
+    0x2B, 0xAB, 0x0C, 0xE2, 0x2C, 0xF5, 0xD8, 0x7C, 0xDA, 0x3D, 0x1D, 0xC7, 0x03, 0xEC, 0xE1, 0x76,
+    0x38, 0xB9, 0xA0, 0x8B, 0x04, 0x57, 0x26, 0x12, 0x42, 0x37, 0x84, 0x12, 0xE8, 0x27, 0x82, 0x55,
+    0xF0, 0x9F, 0x35, 0x2D, 0xC4, 0x7C, 0xE7, 0xEA, 0xE3, 0xBD, 0x95, 0x97, 0x29, 0xB0, 0xD4, 0x73,
+    0xF5, 0xB5, 0x86, 0x52, 0x1F, 0x46, 0x05, 0x82, 0xF7, 0xB6, 0xBC, 0x64, 0x96, 0x57, 0x34, 0xC4,
+    0xDF, 0xC4, 0x4F, 0x13, 0x76, 0x65, 0x9C, 0x75, 0x87, 0x91, 0xAA, 0x55, 0xF0, 0xD4, 0x35, 0x6E,
+    0xD5, 0x97, 0x17, 0x39, 0x13, 0xCA, 0xE1, 0x4C, 0xCA, 0x39, 0x74, 0xFF, 0x81, 0x6D, 0xA9, 0xAF,
+    0x85, 0xFC, 0xE2, 0xA0, 0xA3, 0xDA, 0x93, 0xC1, 0xA7, 0xE2, 0x78, 0xA5, 0x09, 0xA6, 0x7B, 0x85,
+    0x56, 0xFA, 0x99, 0x98, 0x4E, 0x07, 0x39, 0x39, 0x66, 0xDF, 0x8F, 0xA4, 0x0B, 0xBC, 0xD7, 0x16,
+    0xED, 0xB6, 0x30, 0xC9, 0xF3, 0x1B, 0x4C, 0xBB, 0xD7, 0xC9, 0x25, 0xE1, 0x5B, 0xA9, 0x47, 0xB2,
+    0x79, 0x66, 0xB5, 0xC9, 0xEF, 0x8C, 0x58, 0x14, 0x66, 0x40, 0xD3, 0x7C, 0x19, 0x11, 0x60, 0x9F,
+    0x7E, 0x7F, 0x29, 0x9C, 0x49, 0x1F, 0x0B, 0x7F, 0xDE, 0xC3, 0x3F, 0x3E, 0x36, 0xAF, 0x12, 0x1D,
+    0xA1, 0x5D, 0xB3, 0x6B, 0xC9, 0xF6, 0x3D, 0xA7, 0x62, 0xC0, 0xFA, 0x92, 0x15, 0xDA, 0xEE, 0xA7,
+    0x89, 0xD3, 0xDA, 0xDD, 0x6F, 0xA9, 0xE9, 0xF3, 0x63, 0x7D, 0xAD, 0x52, 0x48, 0xA0, 0x9C, 0x7E,
+    0x6B, 0xCA, 0x2C, 0x04, 0x64, 0x68, 0xAB, 0x9C, 0xE7, 0x70, 0xE8, 0xC6, 0xCF, 0xD8, 0x5E, 0x0A,
+    0xDD, 0x42, 0xD2, 0x0F, 0x79, 0xEC, 0x48, 0x5D, 0xA3, 0x28, 0x2E, 0x75, 0xE3, 0x47, 0xDB, 0x9D,
+    0x74, 0xDD, 0x6C, 0xD8, 0xFB, 0x80, 0x43, 0x6F, 0x95, 0x18, 0xAD, 0xB3, 0xD9, 0xF1, 0x15, 0x09,
+    0x22, 0xC5, 0x8B, 0x92, 0x8C, 0xA4, 0xDD, 0x1B, 0x98, 0xC0, 0x24, 0x6B, 0xC4, 0xB8, 0x33, 0xC0,
+    0xAD, 0x86, 0xBC, 0xAA, 0xA5, 0x80, 0x6E, 0x1A, 0x31, 0xB1, 0x50, 0xA6, 0xC5, 0xB2, 0x58, 0xA2,
+    0xF6, 0x3D, 0x06, 0x2B, 0xD4, 0x8D, 0x11, 0xC5, 0x94, 0x5B, 0x3B, 0x0F, 0x6F, 0xB7, 0xE1, 0x9C,
+    0xC4, 0x36, 0x78, 0x00, 0x2B, 0xF5, 0x10, 0xA7, 0x3A, 0xB8, 0x9F, 0xCF, 0xD7, 0xF5, 0xD3, 0x86,
+    0xB6, 0x18, 0x68, 0x73, 0x20, 0x5B, 0x87, 0x17, 0x35, 0x64, 0xE4, 0xD6, 0x37, 0x41, 0x96, 0x5D,
+    0x2F, 0xC5, 0x80, 0x90, 0xD2, 0x0D, 0x74, 0xDD, 0xE3, 0xF7, 0x35, 0x92, 0xB5, 0xA4, 0x34, 0xBF,
+    0x43, 0x6E, 0xD2, 0xCC, 0x91, 0xC9, 0x36, 0xDD, 0xCA, 0x39, 0x7E, 0x5F, 0xED, 0xAF, 0x95, 0x63,
+    0xA5, 0x49, 0x2B, 0x56, 0x3A, 0x8A, 0x40, 0x49, 0x79, 0xC4, 0xED, 0xCA, 0xAA, 0xAB, 0x44, 0x76,
+    0x38, 0x97, 0x33, 0x97, 0xF3, 0xDF, 0xA7, 0xC0, 0x33, 0x4E, 0x84, 0x03, 0x5E, 0x8E, 0xA2, 0x29,
+    0x7A, 0x2C, 0x24, 0xEF, 0x74, 0x01, 0x6C, 0x33, 0x1B, 0x79, 0xDE, 0x2E, 0x02, 0x0A, 0xB3, 0x4D,
+    0xEB, 0xD3, 0xA3, 0x69, 0xCB, 0x31, 0x9F, 0x7A, 0x02, 0x83, 0xE8, 0x5E, 0xAE, 0x0C, 0xC6, 0xF4,
+    0x67, 0x99, 0xC2, 0x6F, 0x49, 0x28, 0x96, 0xE5, 0x08, 0x9C, 0xB6, 0x26, 0x5B, 0x75, 0xA4, 0x8C,
+    0xA3, 0xFB, 0xC8, 0xAE, 0x7C, 0x0A, 0x79, 0x23, 0x07, 0x15, 0xA2, 0x02, 0x81, 0xB5, 0x6E, 0x75,
+    0x5C, 0x7E, 0xDA, 0xC4, 0xA1, 0x3C, 0x9A, 0x19, 0x91, 0x57, 0x25, 0xB8, 0xB4, 0x95, 0xA5, 0xA9,
+    0x7B, 0xA4, 0xBF, 0xEF, 0x4C, 0x93, 0xCB, 0x15, 0xD9, 0xEA, 0x11, 0x73, 0x6A, 0x64, 0xE5, 0x50,
+    0x0B, 0x3E, 0xC9, 0x62, 0xFC, 0x6D, 0x5C, 0xB0, 0xD7, 0x6D, 0x54, 0x3F, 0xB8, 0xC9, 0xE0, 0x47,
+    0x78, 0x56, 0xCD, 0x43, 0x99, 0x08, 0xC4, 0x79, 0x33, 0x04, 0x72, 0x97, 0xFF, 0xB4, 0x13, 0xBD,
+    0xD4, 0x67, 0x7C, 0x92, 0x50, 0x83, 0xF8, 0xAB, 0xAF, 0x65, 0x0A, 0x05, 0xFB, 0xC1, 0xAB, 0x7B,
+    0xD9, 0x32, 0x47, 0xDC, 0xDF, 0x4A, 0x23, 0xDE, 0xA5, 0x9E, 0xA3, 0x51, 0x1D, 0x7E, 0x67, 0x46,
+    0xA7, 0xF8, 0xA8, 0xA2, 0x58, 0x55, 0x30, 0xF3, 0xC5, 0x02, 0x4A, 0x0D, 0xF5, 0xB6, 0x8A, 0xD4,
+    0x10, 0xF5, 0x04, 0xE6, 0x23, 0xD0, 0x71, 0xDF, 0xBE, 0x5C, 0x11, 0x5B, 0x5B, 0x5A, 0xD0, 0x51,
+    0xA6, 0x3F, 0xBD, 0x34, 0x48, 0x7A, 0xFF, 0x61, 0xF7, 0xDA, 0x38, 0xB9, 0xF1, 0xA2, 0xF4, 0xBE,
+    0xC1, 0xA6, 0x99, 0x52, 0xC3, 0x73, 0xBC, 0x85, 0xE7, 0x63, 0x90, 0x0D, 0x1A, 0xBA, 0xBF, 0xDB,
+    0x9E, 0xB3, 0x3B, 0x9B, 0xAA, 0xB8, 0xAA, 0x08, 0xF6, 0x25, 0x28, 0x96, 0x15, 0x75, 0x36, 0x72,
+    0x5A, 0xF7, 0x8F, 0xEC, 0x18, 0xCA, 0xC0, 0xC8, 0xCD, 0x9E, 0x5E, 0x64, 0xC1, 0xB5, 0xE6, 0x30,
+    0x62, 0x9C, 0x63, 0x48, 0x6B, 0xCE, 0x54, 0x91, 0xD8, 0xB9, 0x39, 0x25, 0x41, 0x5D, 0x54, 0xEA,
+    0xAB, 0xC8, 0x58, 0x39, 0xD3, 0x63, 0xDC, 0x64, 0xC1, 0x0D, 0x4D, 0xC5, 0x95, 0x3C, 0x11, 0x67,
+    0x1B, 0x6E, 0x0F, 0x30, 0x2B, 0x22, 0x93, 0xEF, 0x36, 0xD7, 0xFE, 0x72, 0x16, 0x5C, 0x5B, 0xD3,
+    0x59, 0x05, 0xDD, 0xE2, 0x55, 0x04, 0xEE, 0x1C, 0x7A, 0x7E, 0x7C, 0xD8, 0x1D, 0xC8, 0x18, 0x3D,
+    0x7D, 0x32, 0x99, 0xF8, 0x39, 0x3E, 0x3A, 0x55, 0xAE, 0x8D, 0x91, 0xEB, 0x63, 0x2A, 0x01, 0xC8,
+    0x6D, 0x03, 0x65, 0xA2, 0x98, 0xB8, 0xE2, 0xF6, 0x31, 0xC7, 0xCD, 0xF9, 0x18, 0xB0, 0xA4, 0x58,
+    0x01, 0x9B, 0xF5, 0x86, 0x12, 0x99, 0x81, 0x5B, 0x3F, 0xD4, 0xAB, 0x73, 0x16, 0x71, 0x2A, 0x11,
+    0xF9, 0x20, 0x9C, 0xF4, 0x51, 0x65, 0x88, 0x12, 0xA8, 0xD5, 0x71, 0x67, 0xA0, 0xB4, 0x99, 0xC6,
+    0x3D, 0xF1, 0xC4, 0x85, 0xC9, 0x5D, 0xF7, 0xA1, 0x2C, 0xA3, 0x6D, 0x83, 0xE8, 0x11, 0xBB, 0x01,
+    0x86, 0x97, 0x55, 0x11, 0x2F, 0x8A, 0xD5, 0xE6, 0x4B, 0x29, 0x67, 0x44, 0xE9, 0x5F, 0xBE, 0xE9,
+    0x2C, 0x59, 0x01, 0xA8, 0x6E, 0x60, 0xFF, 0xE7, 0x11, 0x95, 0xE7, 0xC3, 0x05, 0xB9, 0x5F, 0x22,
+    0x56, 0x79, 0x52, 0x35, 0x0B, 0x3A, 0x02, 0x41, 0xA4, 0xEB, 0xB6, 0x4F, 0x10, 0xBC, 0x74, 0xE0,
+    0x59, 0x59, 0xB2, 0xEE, 0x24, 0xC9, 0x63, 0x7B, 0xDE, 0x04, 0x4D, 0x0B, 0xBF, 0x9F, 0x02, 0xE6,
+    0x82, 0x11, 0x89, 0xD8, 0xB0, 0x24, 0xDA, 0xE8, 0x08, 0x27, 0xD8, 0xD4, 0x3F, 0xD6, 0x93, 0x56,
+    0x9C, 0xFA, 0x3D, 0x6A, 0x92, 0x91, 0x7C, 0xE0, 0xFD, 0x3A, 0x4E, 0xDF, 0x4F, 0xD2, 0xFB, 0xAE,
+    0x43, 0x82, 0xDB, 0xFE, 0x6F, 0x16, 0x0C, 0xD9, 0x58, 0xE2, 0x52, 0xB2, 0x0C, 0x51, 0x7A, 0x15,
+    0xC7, 0xC2, 0x2B, 0x0C, 0xF8, 0x3D, 0x4A, 0x92, 0x4E, 0xF7, 0xFC, 0x77, 0xCC, 0x23, 0x25, 0x5E,
+    0x9F, 0x6A, 0xF4, 0xCB, 0xCC, 0x52, 0xBC, 0xC1, 0xCC, 0xE1, 0xEC, 0x13, 0xC1, 0x0D, 0xF9, 0x40,
+    0xFC, 0xF3, 0x9B, 0x29, 0xD4, 0xD2, 0x1C, 0xD8, 0x5D, 0x56, 0xF4, 0xD6, 0x7B, 0xDA, 0x48, 0x93,
+    0x1B, 0x81, 0xA0, 0xF6, 0xF1, 0x89, 0x81, 0xA3, 0x3E, 0x74, 0x01, 0xA2, 0x2B, 0x3E, 0x56, 0xAB,
+    0x6F, 0x2A, 0x82, 0xD3, 0xBA, 0x14, 0x35, 0xFB, 0x42, 0x83, 0xC5, 0x48, 0x4D, 0x4C, 0xFC, 0xCD,
+    0x66, 0x12, 0xAE, 0x88, 0xEF, 0x17, 0xD1, 0x6C, 0x71, 0x22, 0xA4, 0x0D, 0xEA, 0x34, 0x1E, 0xCD,
+    0xE5, 0x30, 0x50, 0x0C, 0x5A, 0xC8, 0x93, 0x8D, 0xDF, 0x5E, 0xA9, 0x1F, 0xC5, 0x9E, 0xB0, 0x04,
+    0xD2, 0xF0, 0xD9, 0x3A, 0xB2, 0x59, 0xD6, 0xB8, 0xE8, 0x7E, 0xF5, 0xF5, 0x29, 0x36, 0xD4, 0xB0,
+    0x07, 0x6B, 0xD9, 0xEB, 0xED, 0x2F, 0x6A, 0x98, 0x0E, 0x03, 0x6D, 0xE0, 0xAF, 0xE7, 0x94, 0x27,
+    0x16, 0xC0, 0x55, 0x32, 0x8A, 0xEB, 0x5F, 0x6B, 0x22, 0x6E, 0x39, 0xD6, 0x19, 0x14, 0x77, 0x93,
+    0xF4, 0x52, 0x43, 0x37, 0xBB, 0x39, 0x96, 0x9C, 0xEE, 0x18, 0xBC, 0x67, 0xB0, 0x03, 0x9B, 0xF7,
+    0x50, 0xFE, 0x76, 0x88, 0x75, 0x43, 0xF0, 0x77, 0x93, 0x91, 0x06, 0xC8, 0x0B, 0xEC, 0x32, 0xC2,
+    0x9C, 0x7F, 0x10, 0x58, 0xFE, 0x48, 0xD1, 0xF1, 0x25, 0x0F, 0x86, 0x1C, 0xFA, 0x2E, 0x3D, 0x95,
+    0xD7, 0x4B, 0xC8, 0xC9, 0xEB, 0xD1, 0xE0, 0xF7, 0xDF, 0xB7, 0x81, 0xA3, 0x37, 0xC9, 0x76, 0xB9,
+    0x95, 0xB3, 0xA1, 0x77, 0xC0, 0x73, 0x31, 0xC2, 0xFB, 0x35, 0xE2, 0x1B, 0xF3, 0x8F, 0x05, 0x4C,
+    0xE9, 0x1E, 0x14, 0x23, 0x3B, 0x82, 0xE3, 0xF8, 0x7B, 0xC8, 0x2C, 0x50, 0x91, 0x5E, 0xB9, 0x27,
+    0x87, 0x2C, 0xC2, 0xBE, 0x09, 0xC1, 0xF3, 0xCC, 0x11, 0x88, 0xBE, 0x19, 0xE8, 0xB9, 0x83, 0xB8,
+    0xA7, 0xCA, 0xDC, 0xC8, 0x24, 0x3B, 0x2D, 0xC4, 0x3B, 0x2A, 0xE0, 0xBD, 0xA7, 0x7D, 0x7C, 0x04,
+    0xBD, 0xF0, 0x26, 0x07, 0xDE, 0xCE, 0x04, 0x06, 0x56, 0x6F, 0x43, 0xF8, 0x01, 0x2D, 0x3E, 0xBC,
+    0xB3, 0x7D, 0xCC, 0xFA, 0xB5, 0x50, 0x85, 0x8F, 0xB3, 0x21, 0x8E, 0x85, 0xDB, 0x04, 0x77, 0x80,
+    0x59, 0x3C, 0xF5, 0xFB, 0xB8, 0xC4, 0x11, 0x08, 0x31, 0x0D, 0x3B, 0x55, 0x58, 0xAF, 0xD5, 0xD2,
+    0x83, 0x81, 0x30, 0x5D, 0xE2, 0xCE, 0xEA, 0x58, 0xD9, 0x4B, 0x76, 0xA4, 0x8F, 0x8B, 0x10, 0x50,
+    0x9F, 0xB3, 0xCD, 0x94, 0xB8, 0xF7, 0x89, 0x42, 0x5F, 0xFB, 0x6C, 0xA9, 0x05, 0x74, 0xCA, 0x63,
+    0x96, 0x9D, 0x36, 0x6E, 0xD0, 0x13, 0xAA, 0xA6, 0x9B, 0x21, 0xC7, 0xA3, 0xE5, 0x62, 0x87, 0x24,
+    0x4C, 0x78, 0xD6, 0x0D, 0x1F, 0xDB, 0x4F, 0xDA, 0xA6, 0xF6, 0xB4, 0x2B, 0x55, 0x07, 0xC9, 0x6B,
+    0xC5, 0x6F, 0xAE, 0x3F, 0xDA, 0x22, 0xA3, 0xB2, 0x06, 0xC7, 0x31, 0xB8, 0x3A, 0x8F, 0xDB, 0x51,
+    0xDB, 0x3F, 0x27, 0x7A, 0x08, 0xD0, 0xFA, 0xD4, 0xCD, 0x8A, 0x41, 0xA6, 0x45, 0x30, 0x94, 0xEB,
+    0xA9, 0x26, 0x95, 0xD8, 0x15, 0xC5, 0x93, 0x9C, 0x8F, 0x69, 0x49, 0x41, 0xB6, 0x7C, 0xA0, 0x18,
+    0x92, 0x0E, 0xA1, 0x30, 0x6E, 0x52, 0xF7, 0x38, 0x17, 0x4D, 0x87, 0xCD, 0xC2, 0x09, 0x8B, 0xE7,
+    0xAE, 0x15, 0x70, 0x24, 0x69, 0xA3, 0xD4, 0xD0, 0x1D, 0x24, 0xE0, 0x00, 0x49, 0xEF, 0x19, 0xD5,
+    0x9F, 0x23, 0xA4, 0xD5, 0x13, 0x9C, 0xEB, 0x33, 0x41, 0x8B, 0xAB, 0x5B, 0x1E, 0x4C, 0x6E, 0x64,
+    0xC9, 0xE8, 0x30, 0xC4, 0x3F, 0x0D, 0x8A, 0x09, 0x9E, 0x21, 0x58, 0x12, 0x67, 0x1A, 0x21, 0x47,
+    0x2C, 0x96, 0xA6, 0x07, 0x25, 0x18, 0xBC, 0xE6, 0x50, 0x57, 0x36, 0xE9, 0xD6, 0x61, 0x69, 0x1E,
+    0xA0, 0x60, 0x79, 0x4C, 0x74, 0x54, 0x22, 0xB1, 0xF0, 0xE6, 0x99, 0x6B, 0xB0, 0xB3, 0xC4, 0x29,
+    0x4A, 0x97, 0xAD, 0xE9, 0x6F, 0x15, 0x38, 0xB6, 0x4B, 0xBD, 0x93, 0xD7, 0x07, 0x73, 0x59, 0x9F,
+    0x8C, 0x53, 0xA2, 0x61, 0x5D, 0x74, 0x9C, 0x63, 0x4E, 0x0A, 0xF0, 0x21, 0x7C, 0x27, 0x18, 0xFC,
+    0x5C, 0xAD, 0x1C, 0x41, 0x45, 0x0A, 0x22, 0x15, 0x34, 0x93, 0x90, 0x56, 0x15, 0xE9, 0xDF, 0xCE,
+    0xCD, 0x03, 0x4F, 0x49, 0xEF, 0xFD, 0x59, 0x89, 0x6D, 0xFE, 0x66, 0x79, 0xDB, 0x80, 0xDF, 0x2F,
+    0x86, 0x53, 0xCB, 0x3B, 0x71, 0xD7, 0x0E, 0xC6, 0x7B, 0xC6, 0xB2, 0x0F, 0x97, 0x37, 0x35, 0x7B,
+    0x5F, 0x90, 0xDA, 0x6B, 0xBE, 0x02, 0xBE, 0xF5, 0x1C, 0x8A, 0xD7, 0x64, 0xE5, 0x26, 0x2B, 0xA5,
+    0x2D, 0x05, 0x8D, 0x0B, 0xB7, 0xF5, 0xA2, 0x26, 0x0F, 0xDE, 0x5F, 0x51, 0xB8, 0x9A, 0x21, 0x91,
+    0x90, 0xFC, 0x3C, 0x63, 0x48, 0xA4, 0x56, 0xC9, 0x31, 0x50, 0x54, 0xFE, 0xC5, 0xB6, 0x87, 0x5A,
+    0x8E, 0xBC, 0xB3, 0x1E, 0xCA, 0xDD, 0x5F, 0x16, 0x96, 0x40, 0x4A, 0xC2, 0x39, 0x84, 0x7D, 0xCB,
+    0x11, 0x03, 0x3A, 0xAF, 0x07, 0x63, 0x2A, 0xEC, 0xAF, 0xC1, 0xB7, 0x64, 0xF9, 0x58, 0xB8, 0x9F,
+    0x11, 0xD4, 0x21, 0x14, 0x74, 0x53, 0x6F, 0x7D, 0xFA, 0x62, 0x4B, 0x32, 0xE5, 0x14, 0x6B, 0x42,
+    0xCD, 0x0F, 0x68, 0xBF, 0x29, 0xB6, 0xD5, 0x9A, 0xF8, 0xA0, 0x84, 0x0D, 0xFD, 0x2A, 0xD7, 0xBE,
+    0xE4, 0x59, 0x9B, 0x78, 0x64, 0x15, 0x51, 0xEA, 0x11, 0xCA, 0x8E, 0xB2, 0x7A, 0xCD, 0x25, 0x9B,
+    0xA7, 0xCD, 0xF1, 0x72, 0x6B, 0xCB, 0x88, 0x65, 0x92, 0x5A, 0xE9, 0x0D, 0x8D, 0x57, 0x0F, 0x6D,
+    0x6B, 0xFD, 0x01, 0x61, 0xBD, 0x5E, 0xAD, 0x2A, 0x7D, 0xA4, 0xC9, 0xD5, 0xEC, 0x3A, 0x01, 0x68,
+    0x78, 0x8F, 0xDA, 0x84, 0x80, 0x26, 0x49, 0x8D, 0xDB, 0x0F, 0x32, 0x92, 0x4F, 0x7D, 0xE5, 0xA7,
+    0xE6, 0xD0, 0x67, 0xAA, 0x59, 0xF7, 0x4E, 0x9B, 0xC8, 0xE3, 0x9C, 0x3E, 0xD3, 0xD1, 0x0E, 0x42,
+    0xB3, 0x8D, 0x7A, 0x51, 0x72, 0xCD, 0xB2, 0x65, 0xF2, 0x36, 0xC7, 0xD6, 0x98, 0x86, 0x8F, 0xD5,
+    0xF2, 0x32, 0xBB, 0xB0, 0x7B, 0x21, 0x85, 0x31, 0x25, 0xDF, 0x71, 0x2A, 0xFA, 0xD4, 0x95, 0x3A,
+    0x1B, 0x45, 0xB5, 0xEE, 0xB5, 0xE0, 0x7B, 0x79, 0xF4, 0x8C, 0x3E, 0x17, 0x4B, 0x77, 0xAE, 0xB4,
+    0x89, 0x0F, 0x85, 0x3D, 0x50, 0xD2, 0xE5, 0x12, 0xF5, 0x52, 0x44, 0x9F, 0xC7, 0x2F, 0x10, 0xD6,
+    0xA1, 0x4E, 0x12, 0x0B, 0x3C, 0x2A, 0x8E, 0xA4, 0x7A, 0xF2, 0xD8, 0xAB, 0x81, 0xCF, 0x0F, 0x22,
+    0xAF, 0x5F, 0x85, 0xAE, 0x75, 0x06, 0xDB, 0xB3, 0x95, 0xE9, 0x5D, 0x13, 0xE6, 0xAA, 0x9F, 0x4E,
+    0x20, 0x7B, 0x14, 0xF0, 0xA2, 0x66, 0x4E, 0xC0, 0x8A, 0xA3, 0xEE, 0x9F, 0x35, 0x4F, 0x03, 0x3D,
+    0x01, 0xF8, 0x4D, 0xC2, 0x61, 0xD7, 0x34, 0xFC, 0xD8, 0x04, 0x11, 0xF5, 0xBC, 0xF3, 0x28, 0xA1,
+    0x66, 0x04, 0xCE, 0xD0, 0x2A, 0xFF, 0x29, 0x2E, 0xF5, 0x10, 0xEF, 0xC9, 0x5E, 0x6F, 0xEA, 0xC6,
+    0x39, 0x9D, 0x95, 0x46, 0x3C, 0xDA, 0xA5, 0x94, 0xBD, 0x81, 0x23, 0x5D, 0x49, 0x29, 0xDE, 0x89,
+    0x92, 0x76, 0x72, 0x91, 0x67, 0x8E, 0xBD, 0x18, 0xDD, 0xE9, 0x77, 0x68, 0xFB, 0x85, 0xBE, 0x1F,
+    0x0B, 0xC9, 0x3D, 0xA3, 0x8A, 0x9B, 0xF3, 0xB5, 0x63, 0xC9, 0x6A, 0xD3, 0xAE, 0xA2, 0xCC, 0x92,
+    0xBE, 0x13, 0xFA, 0x8A, 0xC6, 0x69, 0x51, 0x6F, 0x01, 0x31, 0x05, 0xC4, 0xBF, 0xA0, 0x10, 0xA3,
+    0x93, 0xE6, 0x41, 0xF8, 0x23, 0x36, 0xDC, 0xA8, 0x7D, 0x2C, 0x3B, 0x8A, 0x11, 0x8E, 0xF6, 0xE1,
+    0xD1, 0x6A, 0xEF, 0x0A, 0xA5, 0x86, 0xE7, 0xCD, 0xE6, 0xEC, 0xCC, 0x54, 0x58, 0xD5, 0x28, 0x94,
+    0xBD, 0x78, 0x1F, 0x7A, 0x3E, 0xB4, 0xD6, 0xC5, 0x95, 0x24, 0x82, 0xF4, 0x2C, 0x34, 0x48, 0xBD,
+    0x1B, 0x44, 0x74, 0xB0, 0x02, 0x59, 0x68, 0x26, 0x4D, 0xD8, 0x0E, 0xD8, 0x24, 0x75, 0x0E, 0x4C,
+    0x91, 0xF3, 0x2F, 0x6B, 0xA3, 0x4D, 0x7F, 0xAF, 0x5A, 0xDE, 0x54, 0xEB, 0xA5, 0xDC, 0x44, 0xA4,
+    0x3D, 0x6B, 0xCC, 0x0D, 0x10, 0x35, 0xEB, 0x75, 0xA0, 0x8C, 0xB4, 0xE9, 0xBD, 0x42, 0x3D, 0xC2,
+    0x1A, 0x47, 0x50, 0x56, 0x77, 0x1F, 0x07, 0x37, 0x25, 0xE0, 0x05, 0xCC, 0xFA, 0xA9, 0x7E, 0x0A,
+    0x5E, 0x22, 0x33, 0x22, 0x60, 0x8A, 0xFD, 0x50, 0x43, 0xD3, 0xA7, 0x55, 0x41, 0x9A, 0x7C, 0x1F,
+    0xB8, 0xBD, 0x83, 0x34, 0xFA, 0xC3, 0x9A, 0xE2, 0x09, 0xB6, 0x2E, 0x3C, 0x2C, 0x03, 0xBE, 0x4B,
+    0xF9, 0x17, 0x3D, 0x61, 0x58, 0x18, 0xAA, 0x8D, 0x1B, 0x72, 0xFB, 0x42, 0x6A, 0xA7, 0xC5, 0x14,
+    0x7F, 0x35, 0x6F, 0x8E, 0x48, 0xA4, 0xB6, 0xED, 0x75, 0xFC, 0x3E, 0x25, 0x02, 0x70, 0xFE, 0x54,
+    0x27, 0x0F, 0xF6, 0xA3, 0xF4, 0xAC, 0x63, 0x7E, 0x0F, 0x74, 0x79, 0xB9, 0x37, 0x31, 0xD6, 0xC4,
+    0xDA, 0xCD, 0x56, 0x75, 0xF2, 0xC0, 0xA8, 0x8E, 0x0F, 0x06, 0x57, 0x17, 0x5C, 0x46, 0xCE, 0x7C,
+    0xB2, 0xD5, 0x0F, 0xEB, 0xE8, 0x37, 0x30, 0x1D, 0x6D, 0xE6, 0x71, 0x72, 0x2A, 0x76, 0x13, 0xC9,
+    0xE2, 0x35, 0xE2, 0xFF, 0xDA, 0x23, 0x60, 0xF2, 0x73, 0x15, 0xD3, 0xA0, 0x89, 0x35, 0xC4, 0x4C,
+    0xCD, 0xCF, 0x6F, 0xC3, 0xC0, 0xC6, 0x1B, 0x9E, 0x04, 0x66, 0xE6, 0xFE, 0xF0, 0x23, 0x82, 0x61,
+    0xFC, 0x17, 0xC3, 0x26, 0xE1, 0x84, 0xFB, 0xBC, 0x75, 0x1A, 0x8B, 0xD2, 0x08, 0x93, 0x3D, 0x16,
+    0x9B, 0x1A, 0xDF, 0x14, 0xEF, 0xA0, 0x00, 0xF5, 0x50, 0x6B, 0xF1, 0xD6, 0xA9, 0xAF, 0x0A, 0x2D,
+    0x6D, 0xF5, 0x34, 0x65, 0x3C, 0x5F, 0x60, 0xBF, 0x37, 0xBA, 0x1D, 0xC0, 0xA9, 0xD2, 0x86, 0xB1,
+    0xFE, 0x1E, 0x8F, 0xFF, 0x04, 0xEF, 0x37, 0xF5, 0x01, 0x8E, 0x65, 0xD7, 0x39, 0x10, 0xF1, 0x00,
+    0xB8, 0x83, 0x7B, 0x41, 0x72, 0x26, 0x7D, 0x37, 0x68, 0xAA, 0x7D, 0xDB, 0x73, 0xA9, 0x4F, 0xD4,
+    0xDF, 0x1C, 0x0B, 0xF5, 0x63, 0xB3, 0x55, 0x19, 0x71, 0x33, 0x4A, 0x65, 0x8F, 0xFC, 0x36, 0x45,
+    0x8F, 0xAC, 0x1B, 0xD8, 0xFC, 0x21, 0x01, 0xDF, 0x6B, 0x20, 0xF9, 0x5B, 0x06, 0x2D, 0xD4, 0xEE,
+    0xC8, 0xD8, 0x6A, 0x2E, 0xE1, 0xED, 0xD3, 0x58, 0x7E, 0xAB, 0x56, 0x93, 0xCD, 0x1F, 0x8A, 0xD9,
+    0x8A, 0xBA, 0xDB, 0x65, 0x2B, 0x26, 0x88, 0x1B, 0xA3, 0xA7, 0xF6, 0xE5, 0xB6, 0xC3, 0x5A, 0x27,
+    0x50, 0x13, 0xC3, 0xC1, 0x70, 0xE1, 0xA0, 0x3F, 0x23, 0xAC, 0xC1, 0xF7, 0x07, 0x31, 0xA4, 0xEC,
+    0x9E, 0x65, 0xDA, 0x17, 0x48, 0x17, 0x59, 0x4F, 0x1D, 0xA5, 0x5E, 0x3C, 0xD3, 0xED, 0x46, 0x1E,
+    0x4C, 0x86, 0xEA, 0x4C, 0x6A, 0xF4, 0xF3, 0x10, 0x8C, 0xB9, 0xD2, 0xB5, 0xCF, 0x46, 0xCC, 0x43,
+    0x5F, 0x9E, 0xF2, 0x81, 0xE2, 0xCA, 0x8E, 0x1D, 0x2E, 0x4D, 0xC6, 0x79, 0x04, 0x57, 0x34, 0xCE,
+    0xA2, 0x30, 0x16, 0x25, 0x41, 0x12, 0x8B, 0xCE, 0x10, 0x43, 0x34, 0x84, 0xC9, 0xD0, 0xE8, 0x57,
+    0xD4, 0x21, 0x15, 0x93, 0x21, 0xC6, 0x46, 0xF1, 0x6E, 0x32, 0x9A, 0x8B, 0x40, 0x87, 0x10, 0x0D,
+    0x3C, 0xFD, 0xFB, 0xE5, 0xCB, 0x81, 0x7A, 0x3A, 0xEC, 0x88, 0x81, 0x2B, 0x19, 0xE8, 0x95, 0x13,
+    0xFE, 0xE3, 0x75, 0x18, 0xE2, 0xB3, 0x19, 0x87, 0x71, 0x9B, 0x67, 0x43, 0x9E, 0xBB, 0xDA, 0x77,
+    0x26, 0x02, 0x30, 0x92, 0x97, 0x7D, 0xAD, 0xCC, 0x56, 0x24, 0x96, 0x1B, 0xCB, 0x1A, 0x8D, 0x09,
+    0x26, 0x51, 0xE5, 0x91, 0x75, 0x16, 0x9D, 0x55, 0x5F, 0xED, 0xF8, 0x42, 0x29, 0x4A, 0xA7, 0xDD,
+    0xA3, 0x48, 0x1F, 0x15, 0x8B, 0x16, 0xE5, 0x8F, 0xCB, 0x54, 0xBA, 0x40, 0x4D, 0xE6, 0x6C, 0x08,
+    0x61, 0x9E, 0x76, 0x24, 0x56, 0x18, 0x47, 0x60, 0x27, 0x93, 0x63, 0x35, 0x9C, 0xF7, 0x5E, 0x9B,
+    0x7F, 0x9E, 0x2A, 0x64, 0x94, 0x49, 0x1D, 0xC1, 0x43, 0xCE, 0xBB, 0xE9, 0x6E, 0x94, 0xBC, 0xF6,
+    0xE6, 0x1B, 0xCC, 0xA7, 0xAB, 0x12, 0xD6, 0xD7, 0x40, 0x95, 0x04, 0x87, 0xA6, 0x71, 0x7A, 0x36,
+    0x50, 0x13, 0xA7, 0xA8, 0x33, 0xFA, 0x0D, 0x6D, 0xCA, 0xC7, 0x35, 0x33, 0xB3, 0x36, 0xB7, 0x70,
+    0x9C, 0xE9, 0x41, 0x20, 0x09, 0xCA, 0x03, 0x38, 0xEE, 0x57, 0x78, 0x06, 0x87, 0xEC, 0xD7, 0x3F,
+    0xAC, 0x7A, 0xDB, 0x97, 0x0A, 0xC0, 0xE0, 0x89, 0x02, 0x93, 0xAD, 0x57, 0x94, 0x77, 0xDE, 0x2F,
+    0x02, 0x4E, 0x37, 0x79, 0xCA, 0x89, 0xB4, 0xAC, 0x61, 0xEA, 0xCA, 0x15, 0x55, 0x0A, 0x7B, 0x1F,
+    0x9F, 0x14, 0xE4, 0xB1, 0xE1, 0x7C, 0x7C, 0xDD, 0x50, 0x37, 0xF5, 0x89, 0x7B, 0xD3, 0xC5, 0x61,
+    0x8F, 0x8C, 0xAA, 0x8B, 0xAB, 0x6B, 0x2C, 0x97, 0xA4, 0xEA, 0x16, 0x08, 0x5B, 0xB4, 0x8E, 0x07,
+    0x03, 0x80, 0x45, 0x6A, 0x71, 0xD7, 0xF3, 0x5D, 0x37, 0x64, 0xFA, 0x25, 0x47, 0x30, 0x8F, 0x88,
+    0xFD, 0x51, 0x7B, 0x19, 0x23, 0x84, 0xE9, 0x9B, 0x41, 0xDB, 0xC9, 0x48, 0xDB, 0x21, 0x8E, 0x42,
+    0xD5, 0xC4, 0xEA, 0x7B, 0xD6, 0xF3, 0xB1, 0x1A, 0x02, 0x4D, 0xCC, 0x31, 0x85, 0x75, 0xEC, 0xE2,
+    0xD4, 0x5C, 0x70, 0xA5, 0x14, 0x4C, 0xAA, 0x18, 0xE6, 0xCB, 0xC1, 0x3C, 0xB5, 0x3B, 0x8C, 0x2C,
+    0x93, 0xB2, 0x4A, 0xDD, 0xA1, 0x3F, 0x52, 0xB9, 0xC5, 0xFA, 0x95, 0x5F, 0x27, 0x33, 0xB6, 0xAF,
+    0x6E, 0x15, 0x29, 0xDC, 0xCF, 0x8B, 0xB6, 0xF7, 0xE5, 0x63, 0x58, 0x2B, 0x39, 0x7D, 0x28, 0x2F,
+    0x8E, 0x1F, 0x7C, 0x41, 0xAB, 0x89, 0xC3, 0xD7, 0xF3, 0x49, 0xE7, 0x77, 0x57, 0x84, 0x4D, 0x3F,
+    0x89, 0x4D, 0xFB, 0xA3, 0xE1, 0x22, 0x26, 0xF1, 0x55, 0xAF, 0x3A, 0x3F, 0x5A, 0x39, 0x64, 0xE3,
+    0x84, 0xE4, 0x01, 0xC3, 0x59, 0xBD, 0xDC, 0x31, 0xA5, 0xFC, 0xE8, 0xC2, 0x70, 0x23, 0xB1, 0x41,
+    0xCD, 0xC3, 0xA8, 0xC9, 0x3F, 0xFD, 0x0F, 0x07, 0x3F, 0xB0, 0x8A, 0x2E, 0x35, 0x96, 0x50, 0x58,
+    0x3D, 0xD6, 0xFF, 0xA5, 0x19, 0x89, 0x5A, 0x56, 0x18, 0xA5, 0x20, 0x59, 0x8E, 0x20, 0x1B, 0x99,
+    0xAA, 0x99, 0x99, 0x91, 0xEE, 0x6B, 0x79, 0xA0, 0xC5, 0x31, 0xB9, 0xF4, 0xA0, 0x50, 0x1E, 0xB8,
+    0xFA, 0x73, 0x43, 0x27, 0xD5, 0x45, 0x6F, 0xFA, 0xE9, 0x77, 0x31, 0x74, 0x7A, 0xC7, 0xF9, 0xE7,
+    0x28, 0x0E, 0x66, 0x29, 0xAA, 0x0B, 0x2D, 0x51, 0x37, 0x07, 0x91, 0x54, 0xAA, 0x42, 0xC6, 0x80,
+    0x52, 0xA4, 0xFB, 0xF5, 0xB6, 0x32, 0x3E, 0xA2, 0x73, 0xF0, 0x10, 0xC7, 0x2F, 0x7A, 0x53, 0x4A,
+    0x76, 0xD9, 0xBC, 0xC4, 0x7A, 0xB7, 0xE9, 0xA7, 0xC7, 0xEE, 0x0C, 0x44, 0x87, 0x20, 0xD2, 0x9D,
+    0xAA, 0x8D, 0x44, 0x03, 0x6B, 0x74, 0x62, 0xE4, 0x12, 0x74, 0x92, 0x01, 0x96, 0x48, 0x4C, 0x3C,
+    0x43, 0x73, 0x73, 0x56, 0xA2, 0xA9, 0x98, 0x72, 0x29, 0x27, 0x6A, 0x85, 0x93, 0xF3, 0x7E, 0x96,
+    0xA9, 0xF7, 0x3C, 0x05, 0x53, 0x6B, 0x20, 0x2E, 0xCA, 0x2B, 0x22, 0xA1, 0x28, 0xC2, 0x68, 0x6F,
+    0x3B, 0x6E, 0x00, 0x1D, 0x63, 0xFF, 0x18, 0x54, 0x90, 0x11, 0xCF, 0x60, 0xB4, 0xE5, 0xEE, 0x65,
+    0x28, 0x9C, 0xFC, 0xE4, 0xA8, 0x83, 0x35, 0xEE, 0xCF, 0x5A, 0xFF, 0x4A, 0x55, 0x99, 0x75, 0x16,
+    0x11, 0x74, 0xAF, 0x75, 0x6D, 0x32, 0xE5, 0x65, 0xEB, 0x33, 0xDA, 0xFD, 0xEE, 0x05, 0x24, 0xDE,
+    0x92, 0x7E, 0x77, 0x0A, 0x28, 0x49, 0xE3, 0xC2, 0x84, 0xE4, 0xFA, 0xAA, 0x8F, 0x59, 0xBD, 0x8F,
+    0x9E, 0x8F, 0xCA, 0x95, 0x65, 0xBF, 0xDA, 0x6C, 0x58, 0x00, 0x2B, 0x49, 0xBE, 0x41, 0xFE, 0x53,
+    0x6A, 0xE7, 0xB1, 0x11, 0xD0, 0xBD, 0xB8, 0x99, 0x58, 0x4B, 0xBC, 0x5F, 0xA9, 0x62, 0x8E, 0xA9,
+    0x0C, 0x27, 0xCA, 0xD3, 0x7D, 0xA8, 0x5F, 0x65, 0xF6, 0x98, 0x27, 0xD8, 0xAE, 0x20, 0x13, 0xAF,
+    0xD4, 0xC6, 0xB9, 0xC3, 0x2A, 0xA4, 0xFA, 0x8A, 0x8D, 0x46, 0x40, 0x91, 0xCC, 0x13, 0xC4, 0x3F,
+    0xFA, 0xE2, 0xED, 0xAD, 0x02, 0x08, 0x90, 0x4B, 0x43, 0xC2, 0x99, 0x88, 0xB4, 0x0A, 0x91, 0xE9,
+    0x73, 0x28, 0xCA, 0x88, 0xA6, 0xBB, 0x60, 0x4A, 0x2C, 0xF9, 0x1D, 0x26, 0x20, 0xFA, 0x7C, 0x10,
+    0x5F, 0x2C, 0x0C, 0xDF, 0xA3, 0xBC, 0x6B, 0x86, 0x39, 0x51, 0xAF, 0x24, 0x84, 0x19, 0x4C, 0xA6,
+    0x6E, 0x70, 0x46, 0x51, 0xA3, 0xE2, 0x1D, 0x7D, 0x18, 0xF2, 0x6D, 0x8A, 0x8D, 0xF9, 0x88, 0xE1,
+    0xC7, 0x66, 0x52, 0x92, 0xAD, 0x7B, 0x45, 0xC4, 0x86, 0x11, 0x13, 0x77, 0xB5, 0x8A, 0x79, 0x50,
+    0x1C, 0x8A, 0x58, 0xF1, 0x30, 0x59, 0xD0, 0xDF, 0xF7, 0xE8, 0x11, 0xBA, 0xBF, 0x4E, 0x90, 0x48,
+    0xAA, 0xFF, 0xFD, 0x81, 0x48, 0x56, 0x52, 0x49, 0xA2, 0x56, 0xEC, 0x53, 0xC8, 0xFF, 0x03, 0x78,
+    0x3D, 0x2D, 0x05, 0x85, 0x2F, 0x00, 0x00,
+};
+
+// Settings.svg: 3119 bytes, 1546 bytes gzipped
+static const char Settings_svg_Path[] PROGMEM = "/Settings.svg";
+static const char Settings_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Settings_svg_ETag[] PROGMEM = "\"d3fcd6b67580bb45\"";
+static const uint8_t Settings_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x56, 0xDB, 0x6E, 0xDB, 0x46,
+    0x10, 0x7D, 0xB6, 0xBF, 0x82, 0x65, 0x5F, 0x97, 0xD4, 0xDE, 0x2F, 0x81, 0xE5, 0x00, 0x71, 0xDA,
+    0xA4, 0x40, 0xD2, 0x06, 0x75, 0xE2, 0xA2, 0x4F, 0x85, 0x42, 0x2B, 0x96, 0x10, 0x46, 0x12, 0x24,
+    0x45, 0x76, 0xF3, 0xF5, 0x3D, 0x67, 0x48, 0xF9, 0x92, 0x26, 0x8E, 0xE9, 0x59, 0xEE, 0x70, 0x2E,
+    0x67, 0xCE, 0xCC, 0xEE, 0xD9, 0xF3, 0xBB, 0x2F, 0x7D, 0x75, 0x98, 0x6F, 0x77, 0xCB, 0xF5, 0x6A,
+    0x5A, 0x9B, 0x56, 0xD7, 0xD5, 0x7C, 0xD5, 0xAD, 0xAF, 0x97, 0xAB, 0x9B, 0x69, 0xFD, 0x75, 0xFF,
+    0xA9, 0xC9, 0xF5, 0xF3, 0xF3, 0xD3, 0xD3, 0xB3, 0x9F, 0x5E, 0xFE, 0x71, 0xF1, 0xFE, 0xEF, 0x77,
+    0xBF, 0x54, 0xBB, 0xC3, 0x4D, 0xF5, 0xEE, 0xC3, 0x8B, 0x37, 0xBF, 0x5D, 0x54, 0x75, 0x33, 0x99,
+    0xFC, 0xE5, 0x2E, 0x26, 0x93, 0x97, 0xEF, 0x5F, 0x56, 0x97, 0x57, 0xAF, 0x2A, 0xD3, 0x9A, 0xC9,
+    0xE4, 0x97, 0xDF, 0xEB, 0xAA, 0x5E, 0xEC, 0xF7, 0x9B, 0x67, 0x93, 0xC9, 0xED, 0xED, 0x6D, 0x7B,
+    0xEB, 0xDA, 0xF5, 0xF6, 0x66, 0xF2, 0x6A, 0x3B, 0xDB, 0x2C, 0x96, 0xDD, 0x6E, 0x02, 0xC5, 0x09,
+    0x15, 0xF1, 0xD1, 0x04, 0xC6, 0x8C, 0x69, 0xAF, 0xF7, 0xD7, 0xF5, 0x39, 0x5C, 0x34, 0x4D, 0xF5,
+    0x61, 0xD3, 0xAF, 0x67, 0xD7, 0xF3, 0xEB, 0x6A, 0xBF, 0x7E, 0x26, 0x26, 0xFF, 0x9C, 0x6F, 0xD6,
+    0xAA, 0xA2, 0x1D, 0xE8, 0x6E, 0xB1, 0x68, 0xBB, 0xF5, 0x17, 0x55, 0xBD, 0x9A, 0xAF, 0xE6, 0xDB,
+    0xD9, 0x7E, 0xBD, 0x7D, 0xD0, 0xAA, 0xDE, 0x2E, 0xEF, 0xE6, 0xDB, 0xEA, 0xFD, 0x7A, 0xDD, 0xEF,
+    0xAA, 0xA6, 0x81, 0x41, 0x86, 0xFA, 0x69, 0xD9, 0xF7, 0xD3, 0xFA, 0xE7, 0x5F, 0xE5, 0x5F, 0xFD,
+    0x38, 0x53, 0x53, 0x57, 0xCB, 0xEB, 0x69, 0xFD, 0x66, 0xF6, 0xEF, 0x7C, 0xFB, 0x0F, 0x16, 0x00,
+    0x62, 0xB5, 0x9B, 0xFE, 0x20, 0x72, 0xAB, 0xB5, 0x66, 0xA4, 0xA3, 0xCA, 0xB3, 0xBB, 0x7E, 0xB9,
+    0xFA, 0xFC, 0x23, 0x45, 0x53, 0x4A, 0x99, 0xC8, 0x6E, 0x5D, 0x9D, 0x9E, 0x54, 0xB7, 0xCB, 0xEB,
+    0xFD, 0x62, 0x5A, 0x67, 0xAD, 0x37, 0x77, 0x75, 0xB5, 0x98, 0x2F, 0x6F, 0x16, 0xFB, 0xFB, 0xE5,
+    0x61, 0x39, 0xBF, 0x7D, 0xB1, 0xBE, 0x9B, 0xD6, 0xBA, 0xD2, 0x55, 0xE2, 0x7F, 0x02, 0x3F, 0xFB,
+    0xD8, 0xCF, 0x9B, 0x8F, 0xB3, 0xEE, 0xF3, 0xCD, 0x76, 0xFD, 0x75, 0x85, 0xE8, 0x56, 0xF3, 0xDB,
+    0xEA, 0x91, 0x06, 0x02, 0x78, 0xB6, 0xDB, 0xCC, 0xBA, 0xF9, 0xB4, 0xDE, 0x6C, 0xE7, 0xBB, 0xF9,
+    0xF6, 0x30, 0x27, 0x72, 0x37, 0xE7, 0xA7, 0x27, 0x67, 0x9B, 0xD9, 0x7E, 0x51, 0xE1, 0x93, 0xB7,
+    0x2E, 0xB4, 0x2E, 0x26, 0x65, 0x63, 0xEB, 0x6D, 0xEE, 0x1A, 0xDF, 0xC6, 0x9C, 0x94, 0x6E, 0x72,
+    0x1B, 0x94, 0x6B, 0xB3, 0x71, 0x22, 0xE1, 0x77, 0x27, 0x2B, 0x35, 0xAE, 0xE4, 0x0D, 0x7E, 0x9B,
+    0xFB, 0xB7, 0xD4, 0xBB, 0xF4, 0xBA, 0xD5, 0xC1, 0x8F, 0xC6, 0xD4, 0x13, 0xD3, 0xDF, 0x4E, 0x4F,
+    0x4E, 0xAA, 0xA3, 0x37, 0x6F, 0x06, 0x6F, 0xAE, 0x0D, 0x05, 0xCE, 0x22, 0x3E, 0xB7, 0x6D, 0x31,
+    0x22, 0xE0, 0x77, 0x77, 0x5C, 0xA8, 0xE3, 0x0B, 0xCA, 0x7C, 0xA9, 0xC6, 0x97, 0x97, 0x2E, 0xB7,
+    0x25, 0x1C, 0x0D, 0xA9, 0x27, 0x66, 0xBF, 0xD5, 0x93, 0x27, 0x19, 0x7A, 0x87, 0x0F, 0x11, 0x86,
+    0x69, 0x4B, 0x81, 0x4F, 0xDD, 0xFA, 0x68, 0xF0, 0x74, 0x3A, 0x36, 0x60, 0x70, 0xB6, 0x90, 0x4D,
+    0x86, 0xE8, 0x72, 0x54, 0xBA, 0xB5, 0xD9, 0x76, 0xB2, 0x1B, 0x14, 0x35, 0xB9, 0x99, 0x8A, 0xA2,
+    0xE2, 0xB0, 0xA9, 0x44, 0x11, 0xC9, 0x74, 0xAE, 0xC5, 0x86, 0x6D, 0x83, 0x61, 0x54, 0x4C, 0x3B,
+    0xB6, 0xC9, 0x1E, 0x65, 0x10, 0xD5, 0x46, 0xDB, 0x69, 0x7C, 0x14, 0x82, 0xA3, 0x29, 0x9F, 0x94,
+    0xE1, 0xCF, 0x8E, 0xCE, 0x65, 0xD5, 0x98, 0x8B, 0xA0, 0xDB, 0x4C, 0x88, 0x4A, 0x9B, 0x8C, 0x57,
+    0x3E, 0xB7, 0x16, 0x0B, 0xDF, 0xE6, 0x6C, 0xD4, 0x93, 0xB0, 0xBF, 0xCF, 0xE9, 0x08, 0xED, 0x80,
+    0xA3, 0x6E, 0x8B, 0x57, 0x1A, 0x91, 0x65, 0x06, 0xA9, 0x4B, 0x46, 0x58, 0xA9, 0x04, 0x09, 0xB8,
+    0x60, 0x57, 0xC7, 0xC2, 0xF7, 0x86, 0x6F, 0x8C, 0x13, 0x1D, 0x04, 0x8A, 0x5D, 0x1D, 0x07, 0xB9,
+    0x63, 0xAA, 0x88, 0x12, 0xAB, 0x9C, 0x0A, 0xD3, 0xB7, 0x8C, 0xB9, 0xA4, 0x0C, 0x19, 0x96, 0x98,
+    0x2E, 0x3E, 0x05, 0x1B, 0x90, 0x8E, 0xC7, 0xC3, 0x3A, 0x4B, 0xF0, 0x12, 0xB7, 0x93, 0x83, 0x68,
+    0xB2, 0xEF, 0xF8, 0xC6, 0xF3, 0x6B, 0x6B, 0x0D, 0xEA, 0x69, 0x2C, 0xB7, 0x1D, 0x34, 0x1D, 0x3C,
+    0x85, 0x41, 0x26, 0xB6, 0x02, 0x48, 0x63, 0x06, 0x50, 0xF0, 0xD7, 0x5C, 0x3A, 0xA4, 0x8C, 0xFC,
+    0xED, 0x93, 0x6A, 0xDA, 0x1F, 0x56, 0x33, 0xFA, 0xD6, 0x1A, 0xE0, 0x9E, 0xDA, 0x90, 0xDD, 0x02,
+    0xE4, 0xB0, 0x31, 0x0E, 0x45, 0x45, 0x0D, 0x19, 0x08, 0x3C, 0x87, 0xC0, 0xD2, 0x66, 0x94, 0xD6,
+    0xB7, 0x5A, 0x9B, 0xDE, 0xC2, 0x90, 0x67, 0x44, 0xC1, 0x74, 0xA6, 0x0D, 0x91, 0x01, 0xE3, 0xA9,
+    0x06, 0x19, 0x38, 0x07, 0xC1, 0x44, 0x9B, 0x26, 0xB4, 0xC1, 0x9A, 0x9E, 0xAC, 0x2E, 0x91, 0x4F,
+    0x9B, 0x98, 0x3A, 0xB3, 0x0C, 0xC3, 0xC3, 0xB4, 0x89, 0x8E, 0x00, 0x63, 0x81, 0xC1, 0x6C, 0xCB,
+    0x20, 0xEF, 0xB0, 0xD0, 0x89, 0x28, 0xFB, 0xE3, 0x86, 0x22, 0x28, 0xA5, 0xC7, 0x22, 0xB2, 0x8C,
+    0xD8, 0x10, 0x84, 0xBC, 0x17, 0x4B, 0x99, 0x7E, 0x93, 0x27, 0x8A, 0x1E, 0xD8, 0xF8, 0x51, 0xCE,
+    0xC9, 0x5F, 0x25, 0xA6, 0x2D, 0x88, 0xE3, 0x5B, 0xAB, 0x8B, 0xA8, 0x18, 0xA8, 0x64, 0xCF, 0x7E,
+    0x8B, 0xA3, 0xC8, 0xDC, 0x83, 0x06, 0xA1, 0x45, 0x09, 0x80, 0x3A, 0x66, 0x0C, 0xAF, 0xD1, 0xC5,
+    0x51, 0x76, 0xD4, 0x3B, 0x8C, 0x10, 0x59, 0xE1, 0x33, 0x83, 0x8B, 0x41, 0x82, 0x83, 0x19, 0xA3,
+    0xBD, 0xB0, 0xC6, 0xF5, 0x62, 0x85, 0x5D, 0xE8, 0x6D, 0xFC, 0x5F, 0xCA, 0x31, 0x24, 0xA6, 0x99,
+    0x2C, 0xF6, 0x93, 0xF4, 0x0A, 0x64, 0x29, 0x77, 0x44, 0x15, 0x99, 0xBA, 0xD0, 0xC5, 0x5B, 0x51,
+    0x48, 0xB4, 0x09, 0x05, 0x81, 0x31, 0x66, 0x25, 0x60, 0x76, 0x4F, 0x20, 0xC7, 0xD3, 0x67, 0x85,
+    0xE2, 0x08, 0x49, 0x49, 0xCC, 0x40, 0x27, 0x70, 0xCC, 0x5A, 0x39, 0xC3, 0xA0, 0x92, 0xF4, 0x6A,
+    0x92, 0x94, 0x08, 0x1A, 0x51, 0x48, 0x30, 0xC6, 0x32, 0x71, 0x3B, 0x28, 0x29, 0xEE, 0xEB, 0x48,
+    0x3E, 0x3C, 0x46, 0x01, 0xF9, 0xAB, 0xA1, 0xFA, 0x83, 0x4C, 0x37, 0xE6, 0x40, 0xB0, 0x12, 0xFA,
+    0x71, 0xD0, 0x63, 0x9E, 0x34, 0xE6, 0xB5, 0xC5, 0x3E, 0xB5, 0x44, 0x46, 0x00, 0x8B, 0x00, 0xB8,
+    0x82, 0x34, 0x44, 0x61, 0xBB, 0x02, 0x23, 0x33, 0x2A, 0x0A, 0x52, 0x8A, 0xE0, 0xC7, 0x5E, 0x90,
+    0xF2, 0x6C, 0xFF, 0xE4, 0x1F, 0xE7, 0x66, 0x46, 0x19, 0xD8, 0x46, 0xB6, 0x02, 0x22, 0x44, 0x6E,
+    0xC9, 0x99, 0x5E, 0x60, 0x80, 0xA5, 0xE2, 0xDC, 0xD0, 0x4E, 0x89, 0xB9, 0xE3, 0x21, 0x94, 0xA2,
+    0xA3, 0x62, 0xD5, 0x3D, 0x73, 0x8A, 0xDD, 0x09, 0xA3, 0xC8, 0x6C, 0x76, 0xC6, 0x91, 0x6A, 0xD1,
+    0xF7, 0x18, 0x08, 0xD9, 0x8B, 0xFF, 0x4E, 0x90, 0x51, 0x42, 0x27, 0xA8, 0x0C, 0xD5, 0xF4, 0x86,
+    0xC8, 0x1E, 0x2B, 0x9B, 0x0E, 0xCC, 0x47, 0x4A, 0xFA, 0x90, 0x7B, 0x4C, 0x0E, 0x81, 0x98, 0x40,
+    0x08, 0x07, 0x9E, 0x40, 0x46, 0xE2, 0xA4, 0xD3, 0x88, 0xA3, 0x12, 0xA2, 0x71, 0xB0, 0xC4, 0x41,
+    0x14, 0x9D, 0x43, 0x23, 0xD6, 0x3A, 0x19, 0x61, 0xC0, 0x07, 0x8D, 0x5D, 0x84, 0x1A, 0xEA, 0x9E,
+    0xC0, 0xE0, 0x12, 0x40, 0xB1, 0xEA, 0x9E, 0x49, 0x8F, 0x13, 0xCD, 0xE8, 0x04, 0xE1, 0x06, 0x13,
+    0x92, 0xB1, 0x4A, 0x22, 0x8D, 0x3C, 0x92, 0x0C, 0xC4, 0xB2, 0x95, 0xFD, 0x60, 0x07, 0xA2, 0x01,
+    0xB9, 0x82, 0x2E, 0x18, 0x68, 0x44, 0x74, 0xED, 0x23, 0xBC, 0x63, 0x73, 0xCF, 0x22, 0xED, 0x1B,
+    0xB2, 0x88, 0x4E, 0xA5, 0x3C, 0x86, 0x5C, 0x4F, 0xD6, 0x77, 0xC2, 0x22, 0x69, 0x3D, 0x27, 0xF8,
+    0x48, 0x7B, 0xF8, 0x81, 0x24, 0x41, 0x9A, 0x29, 0x8E, 0x55, 0x7F, 0x48, 0xDE, 0x45, 0x4F, 0xEF,
+    0xC5, 0x8D, 0xB2, 0x30, 0x80, 0xE9, 0x83, 0x45, 0x70, 0x70, 0x11, 0x23, 0xE7, 0x8F, 0x72, 0xC4,
+    0x01, 0x27, 0xD2, 0x70, 0xE0, 0x0D, 0x43, 0x49, 0x3D, 0x19, 0x51, 0xDF, 0xAA, 0xB7, 0xD1, 0x0E,
+    0xBA, 0xE3, 0xC8, 0x4A, 0x70, 0x68, 0x64, 0x64, 0xA1, 0x00, 0xEC, 0x85, 0xC4, 0x43, 0x23, 0x26,
+    0x3A, 0x49, 0x90, 0x0B, 0x5C, 0xF9, 0x1E, 0xAC, 0x2C, 0x52, 0x1F, 0xEF, 0xC7, 0x79, 0x44, 0xEE,
+    0x24, 0x2B, 0xD9, 0xE1, 0x75, 0xE1, 0x51, 0x1D, 0x0D, 0x89, 0x9F, 0x1C, 0xF1, 0xD2, 0xC0, 0x05,
+    0xBD, 0x50, 0x58, 0x15, 0x87, 0x21, 0x5D, 0x46, 0x39, 0x9B, 0x43, 0x02, 0xC3, 0x2D, 0xE6, 0xC5,
+    0xA1, 0x11, 0x09, 0xE7, 0xEE, 0xE0, 0x1D, 0xE9, 0x94, 0x21, 0x00, 0x9C, 0xDE, 0x51, 0x46, 0x21,
+    0x02, 0xA0, 0x79, 0x2F, 0xED, 0x15, 0x4B, 0x7A, 0x63, 0xE8, 0x46, 0x05, 0x92, 0x8E, 0xAE, 0x3D,
+    0x27, 0x82, 0xC7, 0x91, 0xE4, 0xE8, 0x19, 0x75, 0x13, 0xFF, 0x9C, 0xF0, 0x11, 0xDE, 0x11, 0x38,
+    0x6D, 0x98, 0xD0, 0x48, 0x12, 0xAF, 0x05, 0xA4, 0x43, 0x13, 0x17, 0x05, 0x87, 0x87, 0xED, 0x06,
+    0xA7, 0x2C, 0x42, 0xE2, 0xA8, 0xCD, 0xD2, 0x82, 0x49, 0xBC, 0x87, 0x48, 0xB7, 0x48, 0x99, 0xCE,
+    0xAD, 0xED, 0x8F, 0x13, 0x38, 0xC5, 0xC1, 0xAB, 0xC5, 0x99, 0x0A, 0xDF, 0x31, 0x75, 0x92, 0xAF,
+    0xF8, 0xB6, 0x9C, 0x1A, 0x12, 0xB5, 0xF5, 0x45, 0xDD, 0x67, 0xA0, 0xFD, 0x95, 0xF8, 0x5D, 0xC4,
+    0x43, 0xC1, 0x41, 0x66, 0x3A, 0x99, 0x4D, 0x41, 0xEE, 0x0D, 0x31, 0x8A, 0x73, 0x75, 0x04, 0x87,
+    0xE9, 0xC2, 0x6C, 0xB1, 0xE2, 0x3C, 0x91, 0x6A, 0x3E, 0x0C, 0x13, 0x6B, 0x04, 0x9A, 0xBD, 0x82,
+    0x76, 0xF2, 0xEC, 0x0C, 0xD2, 0x74, 0x80, 0x1B, 0x10, 0x7B, 0x36, 0x76, 0x60, 0x55, 0x12, 0x6A,
+    0xC3, 0x0C, 0x16, 0x52, 0xD9, 0xAB, 0xA1, 0xCE, 0xDF, 0x9F, 0x5B, 0x36, 0x23, 0x2F, 0xF4, 0x09,
+    0x42, 0xC6, 0x99, 0xCC, 0x38, 0x49, 0x4F, 0x5C, 0x1E, 0x1A, 0xB9, 0x30, 0x34, 0x72, 0x79, 0x18,
+    0xE5, 0xE3, 0xE5, 0x61, 0x38, 0x2B, 0x9B, 0xF1, 0x9C, 0xE4, 0xCF, 0xEE, 0xF1, 0xB1, 0x89, 0x8E,
+    0x06, 0x6D, 0x65, 0x3A, 0x04, 0x9C, 0xF9, 0x06, 0x3D, 0x80, 0x6B, 0x45, 0xC4, 0x71, 0xA6, 0x0C,
+    0x2E, 0x4B, 0xE3, 0x98, 0x41, 0xCB, 0xF1, 0xE8, 0xE6, 0xF8, 0x77, 0x6C, 0x33, 0xCC, 0x90, 0x28,
+    0xB7, 0x92, 0x51, 0xEE, 0x78, 0xDA, 0x7B, 0x39, 0xFB, 0xA3, 0xA7, 0x33, 0x13, 0xF8, 0x45, 0x76,
+    0x41, 0x1C, 0xE7, 0x0B, 0x5C, 0x4E, 0x34, 0x6E, 0x3F, 0x1E, 0x1C, 0xC5, 0xA0, 0x46, 0x1E, 0x1C,
+    0x19, 0xC8, 0xA3, 0x14, 0x59, 0x3D, 0x64, 0x25, 0x29, 0x9F, 0x4D, 0x6E, 0xF8, 0xC0, 0x0D, 0xF8,
+    0xFC, 0x3F, 0x3D, 0x3D, 0xE7, 0xA3, 0x2F, 0x0C, 0x00, 0x00,
+};
+
+// Upload.svg: 1184 bytes, 605 bytes gzipped
+static const char Upload_svg_Path[] PROGMEM = "/Upload.svg";
+static const char Upload_svg_ContentType[] PROGMEM = "image/svg+xml";
+static const char Upload_svg_ETag[] PROGMEM = "\"b159a9612bc4888c\"";
+static const uint8_t Upload_svg_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5D, 0x53, 0xCB, 0x6E, 0xDB, 0x30,
+    0x10, 0xBC, 0xF7, 0x2B, 0xB6, 0xEC, 0x35, 0xA6, 0xB9, 0x24, 0xC5, 0x47, 0x10, 0x25, 0x40, 0x05,
+    0xB4, 0x3E, 0x38, 0x97, 0x3E, 0x7C, 0xC8, 0x2D, 0x88, 0x14, 0x5B, 0x80, 0x62, 0x19, 0xB2, 0x62,
+    0xFB, 0xF3, 0xBB, 0x4B, 0xEB, 0x61, 0xD4, 0x30, 0xC8, 0x1D, 0x6A, 0x76, 0x67, 0x76, 0x45, 0x3D,
+    0x3C, 0x5D, 0x3E, 0x1A, 0x38, 0x55, 0xDD, 0xB1, 0x6E, 0xF7, 0xB9, 0x40, 0xA9, 0x04, 0x54, 0xFB,
+    0xB7, 0xB6, 0xAC, 0xF7, 0xDB, 0x5C, 0x7C, 0xF6, 0xEF, 0x8B, 0x20, 0x9E, 0x1E, 0x1F, 0xBE, 0x2E,
+    0x16, 0xF0, 0xF7, 0xD0, 0xB4, 0xAF, 0x65, 0x55, 0x42, 0xDF, 0xDE, 0xC3, 0xEF, 0xCD, 0x4F, 0xF8,
+    0x55, 0x1D, 0xDA, 0x3B, 0x38, 0x9F, 0xCF, 0xF2, 0x78, 0xDA, 0x76, 0x04, 0xE4, 0x5B, 0xFB, 0x71,
+    0x07, 0x3F, 0xAB, 0x7D, 0xD5, 0xBD, 0xF6, 0x6D, 0x37, 0xB3, 0xE0, 0xB9, 0xBE, 0x54, 0x1D, 0xFC,
+    0x69, 0xDB, 0xE6, 0x08, 0x8B, 0xC5, 0xE3, 0x97, 0x07, 0xCA, 0x80, 0x73, 0x5D, 0xF6, 0xBB, 0x5C,
+    0x04, 0xA5, 0x0E, 0x17, 0x01, 0xBB, 0xAA, 0xDE, 0xEE, 0xFA, 0x09, 0x9E, 0xEA, 0xEA, 0xFC, 0xBD,
+    0xBD, 0xE4, 0x42, 0x81, 0x02, 0x6D, 0xE9, 0x2F, 0xE0, 0xBD, 0x6E, 0x9A, 0x5C, 0x7C, 0xFB, 0x91,
+    0x7E, 0x02, 0xC8, 0xF9, 0xFE, 0x98, 0x8B, 0x5D, 0xDF, 0x1F, 0xEE, 0x97, 0x4B, 0xF6, 0x71, 0x36,
+    0xB2, 0xED, 0xB6, 0x4B, 0xAD, 0x94, 0x5A, 0x92, 0x82, 0x20, 0xA1, 0xC3, 0x6B, 0xBF, 0x4B, 0x89,
+    0x8B, 0xEE, 0xB3, 0xA9, 0x72, 0x51, 0x9D, 0xAA, 0x7D, 0x5B, 0x96, 0x02, 0xDE, 0x9A, 0xFA, 0xF0,
+    0xFF, 0x59, 0x99, 0x8B, 0xE7, 0x00, 0xA8, 0x8A, 0x00, 0x5E, 0xFA, 0xA8, 0x82, 0x83, 0x38, 0xEC,
+    0x0E, 0x50, 0x83, 0x2B, 0xD0, 0x4A, 0xAD, 0x22, 0x32, 0x74, 0x13, 0x87, 0x42, 0x54, 0x1B, 0xC4,
+    0x15, 0xFA, 0x02, 0x83, 0x8C, 0xC6, 0x00, 0x22, 0x68, 0x25, 0x33, 0x4A, 0x92, 0x99, 0xF3, 0x43,
+    0x6C, 0x65, 0x56, 0x5C, 0x23, 0x27, 0x2D, 0x93, 0x06, 0x2E, 0x49, 0x7A, 0x5A, 0x57, 0x48, 0xF5,
+    0x33, 0x69, 0xAD, 0xF7, 0xE9, 0x2C, 0x63, 0xC2, 0x15, 0x51, 0x18, 0x8B, 0xB4, 0xCA, 0x2C, 0xD3,
+    0x94, 0x32, 0xD0, 0xB4, 0x62, 0x71, 0xAD, 0x58, 0x99, 0x2A, 0x2B, 0xE3, 0x19, 0x81, 0xD6, 0x2C,
+    0xE2, 0x65, 0x96, 0xB0, 0x9E, 0xB4, 0x53, 0x84, 0xD2, 0xFB, 0x68, 0x92, 0x25, 0x6D, 0x33, 0x6A,
+    0x30, 0xC3, 0x18, 0x3D, 0xD3, 0xA3, 0x8E, 0xDC, 0xB0, 0xF2, 0x41, 0xDB, 0x82, 0xB0, 0x0D, 0x8E,
+    0x7A, 0xA6, 0x86, 0x35, 0x26, 0x49, 0x1A, 0xAB, 0x01, 0xCB, 0x83, 0xB0, 0x05, 0x59, 0xA7, 0x2C,
+    0x4B, 0xD0, 0x51, 0x01, 0x13, 0x70, 0x22, 0x3A, 0x2A, 0xA0, 0xCC, 0x5C, 0xC8, 0x48, 0xEB, 0xB3,
+    0x0C, 0x67, 0xA1, 0x1B, 0x13, 0x38, 0x5A, 0xC3, 0x1B, 0xC3, 0x46, 0x46, 0xA7, 0x2D, 0x3B, 0x04,
+    0xEE, 0x70, 0x15, 0x48, 0x8C, 0xBA, 0xD6, 0x81, 0x4F, 0xE2, 0x34, 0x03, 0x8E, 0x8A, 0x38, 0xCD,
+    0x68, 0xE4, 0xD0, 0xE4, 0x78, 0x59, 0xF9, 0x82, 0x0C, 0xBB, 0x34, 0x49, 0x33, 0x8F, 0xDC, 0x8C,
+    0x82, 0x66, 0x7E, 0x39, 0x03, 0x0F, 0x81, 0x97, 0x55, 0xD8, 0xA0, 0x7A, 0x79, 0xA6, 0x6E, 0xBD,
+    0xF2, 0x08, 0x68, 0xA4, 0xA6, 0xB1, 0xAC, 0x89, 0x7A, 0xC5, 0x2A, 0xE1, 0x82, 0xB0, 0x41, 0xC7,
+    0x4D, 0x46, 0xA5, 0x0D, 0x27, 0x4A, 0x17, 0x8C, 0xBD, 0xC5, 0xCC, 0x1B, 0xF9, 0xEB, 0xC0, 0x5B,
+    0x88, 0x63, 0xBD, 0xC2, 0x8F, 0x3C, 0x73, 0xCD, 0x9B, 0xB0, 0xBD, 0xD6, 0x9D, 0xF8, 0x36, 0xE9,
+    0xD2, 0x04, 0x98, 0xA6, 0xD3, 0x5B, 0x88, 0x9E, 0x75, 0x89, 0x96, 0x85, 0x1B, 0xCC, 0x34, 0x1C,
+    0xF9, 0x6B, 0x4C, 0xD6, 0x2D, 0x5A, 0xBD, 0xE1, 0x9B, 0x83, 0xF3, 0xCD, 0xC1, 0xF9, 0xE6, 0x68,
+    0x5A, 0xB9, 0x93, 0xF4, 0x80, 0x0F, 0xCC, 0x4C, 0xE3, 0x70, 0x33, 0x94, 0x58, 0xF3, 0xAD, 0x4F,
+    0xDD, 0x0C, 0x6E, 0x68, 0x4F, 0xAE, 0x47, 0x75, 0xDA, 0x93, 0xEB, 0x1B, 0x7C, 0x9D, 0xD6, 0xC8,
+    0x77, 0xC3, 0xF9, 0xD0, 0xDD, 0x84, 0xCD, 0x54, 0xE7, 0x76, 0xDA, 0x2F, 0x62, 0x49, 0x5F, 0x2E,
+    0x7F, 0xC1, 0x8F, 0xFF, 0x00, 0xAD, 0x8D, 0x35, 0x6E, 0xA0, 0x04, 0x00, 0x00,
+};
+
+// styles.css: 3147 bytes, 931 bytes gzipped
+static const char styles_css_Path[] PROGMEM = "/styles.css";
+static const char styles_css_ContentType[] PROGMEM = "text/css";
+static const char styles_css_ETag[] PROGMEM = "\"e43a9f766d2ef3ad\"";
+static const uint8_t styles_css_Data[] PROGMEM =
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x56, 0xC1, 0x8E, 0xDB, 0x36,
+    0x10, 0x3D, 0xEF, 0x02, 0xFB, 0x0F, 0x04, 0x8A, 0x02, 0x49, 0x50, 0x29, 0xF6, 0x06, 0x0B, 0x04,
+    0xF6, 0xA5, 0xCD, 0x21, 0x87, 0xA2, 0xB7, 0x7C, 0xC1, 0x48, 0x1C, 0x4B, 0x44, 0x29, 0x52, 0x20,
+    0xA9, 0xB5, 0x9D, 0x22, 0xFF, 0xDE, 0xA1, 0x44, 0x51, 0x94, 0x25, 0x2B, 0xDB, 0xFA, 0x64, 0x0D,
+    0xC9, 0x37, 0x33, 0x6F, 0xDE, 0x0C, 0x59, 0xBB, 0x46, 0xB2, 0xA7, 0xC7, 0x7F, 0x9E, 0x1E, 0x19,
+    0xFD, 0x0A, 0x28, 0xFF, 0xAE, 0x8C, 0xEE, 0x14, 0xCF, 0x4A, 0x2D, 0xB5, 0x39, 0x30, 0x6D, 0x40,
+    0x55, 0x78, 0x1C, 0x96, 0x4F, 0x5A, 0xB9, 0xEC, 0x04, 0x8D, 0x90, 0xD7, 0x03, 0xB3, 0xA0, 0x6C,
+    0x66, 0xD1, 0x88, 0x13, 0xAD, 0xFE, 0x78, 0x7A, 0x7C, 0x7A, 0xAC, 0x11, 0x38, 0x9A, 0x09, 0xAD,
+    0xDF, 0x6E, 0xC5, 0x77, 0x3C, 0xB0, 0x67, 0x6C, 0x52, 0x8C, 0x33, 0x8A, 0xAA, 0x76, 0x07, 0x56,
+    0x68, 0xC9, 0x8F, 0xF7, 0x5C, 0x9F, 0x6B, 0xE1, 0x46, 0xCF, 0xC1, 0xF4, 0xCB, 0x6E, 0xF7, 0xC7,
+    0x97, 0xAF, 0x9F, 0x83, 0xB1, 0x05, 0xCE, 0x85, 0xAA, 0x0E, 0x6C, 0x97, 0x3F, 0xBF, 0x44, 0x07,
+    0x0D, 0x98, 0x4A, 0xA8, 0xAC, 0xD0, 0xCE, 0xE9, 0xC6, 0xAF, 0x0D, 0x4B, 0x69, 0x84, 0xB9, 0x6E,
+    0x51, 0x15, 0x4E, 0xC5, 0x48, 0x03, 0x3C, 0x07, 0x43, 0x31, 0xC0, 0x35, 0x20, 0x39, 0xBC, 0xB8,
+    0x8C, 0x63, 0x49, 0x1C, 0x38, 0xA1, 0xD5, 0x81, 0x29, 0xAD, 0x70, 0xEE, 0x3B, 0x33, 0x43, 0x22,
+    0xAB, 0x5E, 0xA4, 0xAE, 0x74, 0xE2, 0x42, 0x39, 0x54, 0xB4, 0xB5, 0x33, 0xF2, 0xDD, 0x5F, 0xB4,
+    0x92, 0xB7, 0xAA, 0x7A, 0x1F, 0xD0, 0xEA, 0xC0, 0xC7, 0x3E, 0x4D, 0xE4, 0x24, 0x35, 0x90, 0xAD,
+    0xF7, 0x30, 0x42, 0x2B, 0x78, 0x5D, 0xA3, 0x77, 0x9F, 0x4F, 0xC7, 0x22, 0xD6, 0x6E, 0xF7, 0x6B,
+    0x30, 0x9D, 0x05, 0x77, 0x35, 0x05, 0x79, 0x64, 0x1F, 0x3F, 0xB0, 0x6F, 0x0E, 0x8C, 0x63, 0xB5,
+    0xE0, 0x1C, 0xD5, 0x91, 0x95, 0xB5, 0xAF, 0x2F, 0x67, 0xC5, 0x95, 0xFD, 0x09, 0xAF, 0xF0, 0xAD,
+    0x34, 0xA2, 0x75, 0xEC, 0xC3, 0xC7, 0x90, 0xA5, 0xB6, 0x62, 0x48, 0xFD, 0x24, 0x2E, 0x38, 0x96,
+    0xEA, 0x7B, 0x26, 0x14, 0xC7, 0x0B, 0xB9, 0x18, 0x89, 0xD2, 0xAD, 0x47, 0x1F, 0x3E, 0x24, 0x9E,
+    0xDC, 0xF4, 0xB5, 0x2C, 0x6B, 0x21, 0xC9, 0x14, 0x56, 0xF5, 0x2B, 0x1A, 0x4A, 0xF3, 0x9C, 0x11,
+    0x58, 0x88, 0x68, 0x4E, 0x6F, 0x8F, 0x3C, 0x89, 0xC7, 0x91, 0x1A, 0xC7, 0x88, 0x88, 0x72, 0x3B,
+    0xD0, 0xC2, 0x58, 0x4F, 0x0C, 0xCB, 0x4B, 0xA9, 0x2D, 0xA6, 0x75, 0x9D, 0xE2, 0x87, 0xC2, 0x6A,
+    0xD9, 0x45, 0x3D, 0xCD, 0x22, 0x5E, 0xAB, 0xA1, 0xC7, 0x83, 0x09, 0x67, 0x52, 0xDA, 0x44, 0xF4,
+    0x96, 0x3C, 0x42, 0xAE, 0x89, 0x98, 0xB8, 0xB0, 0xAD, 0x84, 0xAB, 0xCF, 0x5F, 0xF7, 0xF9, 0x27,
+    0x81, 0xC3, 0xA1, 0xF6, 0x4C, 0xDC, 0xCA, 0x71, 0x6C, 0x80, 0x3E, 0xA0, 0x5C, 0x90, 0x82, 0xA6,
+    0xDE, 0x0A, 0x25, 0xDD, 0xC7, 0x68, 0x16, 0x82, 0x5C, 0x2A, 0xC9, 0x57, 0x26, 0xC2, 0x15, 0x1D,
+    0xF5, 0xC7, 0xC4, 0x54, 0x0C, 0x4F, 0x28, 0x29, 0x14, 0x66, 0x63, 0x94, 0x1B, 0x42, 0xBB, 0xD7,
+    0xC9, 0x6F, 0xE0, 0x25, 0xD5, 0xC0, 0x52, 0x21, 0x09, 0x6B, 0xAB, 0xC4, 0x17, 0xDA, 0x50, 0x7F,
+    0xCD, 0x70, 0x07, 0x53, 0x66, 0x80, 0x8B, 0xCE, 0xCE, 0x77, 0x0F, 0xF3, 0xE0, 0xA6, 0xBC, 0xF9,
+    0x49, 0xE2, 0x25, 0xF3, 0x3D, 0x09, 0x94, 0xAD, 0x59, 0xD2, 0xE0, 0xD7, 0x23, 0x7B, 0xB4, 0xD5,
+    0xAB, 0x94, 0x7A, 0x51, 0x9F, 0xD9, 0xD9, 0x40, 0x3B, 0xC2, 0x58, 0x2C, 0x7D, 0x8A, 0x1B, 0xF3,
+    0x53, 0x7A, 0x7A, 0x92, 0x84, 0x74, 0x0B, 0xA5, 0x70, 0xE4, 0xE0, 0x73, 0xEC, 0xCE, 0x9F, 0xA7,
+    0xB3, 0xDF, 0xB5, 0x97, 0x5B, 0x42, 0x12, 0xDB, 0xCD, 0xC4, 0x5B, 0xAE, 0x98, 0x71, 0x22, 0xF4,
+    0x0B, 0x69, 0xE4, 0xAC, 0xDE, 0xFF, 0x6C, 0x9E, 0xF4, 0xE5, 0x04, 0xCA, 0x83, 0x38, 0x2C, 0x69,
+    0x82, 0xA1, 0x99, 0x83, 0xCF, 0x5A, 0x69, 0x6B, 0xF8, 0xE6, 0x2D, 0x54, 0x09, 0xD5, 0x77, 0xDC,
+    0xC5, 0x04, 0x5F, 0xEE, 0xE5, 0xF7, 0x32, 0x65, 0x31, 0x40, 0x32, 0xDB, 0x82, 0x5A, 0xF6, 0xEA,
+    0x04, 0xF0, 0x9F, 0xCB, 0x92, 0x82, 0xC3, 0x16, 0xF2, 0x3D, 0xAD, 0xCF, 0x00, 0xDE, 0xD0, 0xDD,
+    0x27, 0x6D, 0x9A, 0xA5, 0x08, 0x2B, 0x23, 0xC6, 0xA6, 0xF2, 0x7F, 0x33, 0x87, 0x0D, 0x2D, 0x38,
+    0xF4, 0x59, 0x74, 0x8D, 0xEA, 0x95, 0x81, 0x0D, 0x83, 0xCE, 0xE9, 0x48, 0xD5, 0x25, 0x0B, 0xA3,
+    0xE1, 0xD3, 0x2E, 0x72, 0xDA, 0x1F, 0xAE, 0xA0, 0xBD, 0x29, 0x88, 0x77, 0xCA, 0x24, 0x14, 0x98,
+    0xBC, 0x00, 0xFA, 0xAD, 0x03, 0x7C, 0x32, 0xDF, 0x13, 0x09, 0xCC, 0xAE, 0xA3, 0x1E, 0x41, 0xA8,
+    0xB6, 0x73, 0xEB, 0x00, 0xCF, 0xE3, 0xC6, 0xD6, 0xE0, 0x7A, 0xE1, 0x9F, 0x57, 0x2A, 0x3F, 0xEB,
+    0xF5, 0xB7, 0x3C, 0x0B, 0xC6, 0x71, 0xD2, 0xBB, 0x72, 0x50, 0xC8, 0xC9, 0x59, 0xE8, 0x24, 0xDA,
+    0x28, 0xA1, 0xB5, 0xE4, 0x72, 0xFC, 0x17, 0xB7, 0xF3, 0xDF, 0x5C, 0xDD, 0x6F, 0x7F, 0x18, 0x47,
+    0x68, 0xB8, 0xC1, 0x42, 0x14, 0x0F, 0x77, 0xAE, 0xFA, 0xB4, 0x75, 0x5D, 0x2D, 0x14, 0xA3, 0x0B,
+    0x46, 0xF0, 0x71, 0x78, 0x05, 0xEC, 0x18, 0xC7, 0x5D, 0x0A, 0x1D, 0xCF, 0xE9, 0x48, 0x5B, 0xAF,
+    0xEE, 0x0C, 0x13, 0x7B, 0x65, 0x4A, 0xF4, 0x67, 0x7F, 0x6F, 0x90, 0x0B, 0x60, 0xB6, 0x34, 0x88,
+    0x8A, 0x81, 0xE2, 0xEC, 0x5D, 0x22, 0x00, 0x7A, 0x00, 0x50, 0xC3, 0xBF, 0x9F, 0x80, 0xA3, 0x27,
+    0xFF, 0x15, 0x8C, 0x33, 0xBD, 0x25, 0x13, 0xE8, 0x47, 0x70, 0x41, 0x2A, 0xB6, 0xE8, 0xBE, 0xC0,
+    0x20, 0xDF, 0x87, 0x65, 0x39, 0xAE, 0x28, 0x69, 0x34, 0xCE, 0xEB, 0x11, 0x6D, 0xE3, 0xAC, 0x85,
+    0x06, 0x37, 0x20, 0x4C, 0x7C, 0x59, 0xCC, 0x0C, 0xA1, 0x87, 0xF4, 0x19, 0xCD, 0xFF, 0x3D, 0x7C,
+    0xA6, 0x66, 0xD9, 0x3A, 0x5C, 0xC8, 0x6E, 0x21, 0xA5, 0x6E, 0xEA, 0x5F, 0xDD, 0x39, 0x2B, 0xF8,
+    0x56, 0xE8, 0x95, 0x67, 0xFE, 0xF6, 0xCE, 0x1F, 0x4C, 0x21, 0x7C, 0x83, 0xD6, 0x76, 0x66, 0x0B,
+    0x63, 0x45, 0xD0, 0xF3, 0x9B, 0xDF, 0x4F, 0x0F, 0xB3, 0x1D, 0x47, 0x7A, 0xA1, 0xAE, 0x35, 0x45,
+    0x5E, 0x80, 0xF9, 0x2A, 0xA4, 0xBC, 0x9F, 0x47, 0x1C, 0x85, 0x73, 0xCB, 0x70, 0x9A, 0xE6, 0x8E,
+    0xBB, 0x8E, 0xEE, 0x67, 0xF3, 0x72, 0x77, 0x8C, 0x42, 0xF9, 0x17, 0x6A, 0xBB, 0xC9, 0xBF, 0x4B,
+    0x0C, 0x00, 0x00,
+};
+
+const StaticFile StaticFiles[] =
+{
+    { Calibrate_svg_Path, Calibrate_svg_ContentType, Calibrate_svg_ETag, Calibrate_svg_Data, sizeof(Calibrate_svg_Data), true },
+    { Graph_svg_Path, Graph_svg_ContentType, Graph_svg_ETag, Graph_svg_Data, sizeof(Graph_svg_Data), true },
+    { Home_svg_Path, Home_svg_ContentType, Home_svg_ETag, Home_svg_Data, sizeof(Home_svg_Data), true },
+    { LogFile_svg_Path, LogFile_svg_ContentType, LogFile_svg_ETag, LogFile_svg_Data, sizeof(LogFile_svg_Data), true },
+    { Logo_png_Path, Logo_png_ContentType, Logo_png_ETag, Logo_png_Data, sizeof(Logo_png_Data), true },
+    { Settings_svg_Path, Settings_svg_ContentType, Settings_svg_ETag, Settings_svg_Data, sizeof(Settings_svg_Data), true },
+    { Upload_svg_Path, Upload_svg_ContentType, Upload_svg_ETag, Upload_svg_Data, sizeof(Upload_svg_Data), true },
+    { styles_css_Path, styles_css_ContentType, styles_css_ETag, styles_css_Data, sizeof(styles_css_Data), true },
+};
+
+const size_t StaticFileCount = sizeof(StaticFiles) / sizeof(StaticFiles[0]);
+
+#endif
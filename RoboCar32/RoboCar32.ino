@@ -6,7 +6,9 @@
 #include <WiFiNTP.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <ChunkedResponse.h>
 #include <Log.h>
+#include <SPSCLog.h>
 #include <WiFiStateMachine.h>
 #include <Adafruit_VL53L0X.h>
 #include "PersistentData.h"
@@ -14,9 +16,10 @@
 
 #define DEBUG_ESP_PORT Serial
 #define MAX_EVENT_LOG_SIZE 100
+#define EVENT_LOG_ARENA_SIZE 4096
 #define ICON "/apple-touch-icon.png"
 #define NTP_SERVER "fritz.box"
-#define CONTENT_TYPE_HTML F("text/html")
+#define CONTENT_TYPE_HTML "text/html"
 #define RANGE_LOG_SIZE 25
 
 #define SCRIPT_TOKEN_SEPARATORS " ,\r\n"
@@ -84,11 +87,11 @@ struct RangeLogEntry
 
 WebServer WebServer(80); // Default HTTP port
 WiFiNTP TimeServer(NTP_SERVER, 24 * 3600); // Synchronize daily
-StringBuilder HttpResponse(16384); // 16KB HTTP response buffer
-Log<const char> EventLog(MAX_EVENT_LOG_SIZE);
+ChunkedResponse HttpResponse(WebServer, 1536); // 1.5KB HTTP response buffer (larger responses are sent in chunks)
+StringArenaLog EventLog(MAX_EVENT_LOG_SIZE, EVENT_LOG_ARENA_SIZE);
 WiFiStateMachine WiFiSM(TimeServer, WebServer, EventLog);
 Adafruit_VL53L0X DistanceSensor = Adafruit_VL53L0X();
-Log<RangeLogEntry> RangeLog(RANGE_LOG_SIZE);
+SPSCLog<RangeLogEntry> RangeLog(RANGE_LOG_SIZE); // Written by Range Monitor task, read by web server
 
 bool rangingInitialized;
 volatile VL53L0X_Error lastRangingResult;
@@ -588,11 +591,11 @@ void monitorRange(void* taskParams)
 
         if (engineSpeed != 0)
         {
-            RangeLogEntry* rangeLogEntryPtr = new RangeLogEntry();
-            rangeLogEntryPtr->time = millis();
-            rangeLogEntryPtr->status = lastRangingMeasurement.RangeStatus;
-            rangeLogEntryPtr->distance = distance;
-            RangeLog.add(rangeLogEntryPtr);
+            RangeLogEntry rangeLogEntry;
+            rangeLogEntry.time = millis();
+            rangeLogEntry.status = lastRangingMeasurement.RangeStatus;
+            rangeLogEntry.distance = distance;
+            RangeLog.add(&rangeLogEntry);
         }
 
         if (pursuitMode)
@@ -809,7 +812,7 @@ bool parseScript()
 
 void writeHtmlHeader(String title, bool includeHomePageLink, bool includeHeading)
 {
-    HttpResponse.clear();
+    HttpResponse.begin(200, CONTENT_TYPE_HTML);
     HttpResponse.println(F("<html>"));
     
     HttpResponse.println(F("<head>"));
@@ -884,7 +887,7 @@ void handleHttpRootRequest()
 
     writeHtmlFooter();
 
-    WebServer.send(200, CONTENT_TYPE_HTML, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -927,16 +930,17 @@ void renderRangeLogTable()
     HttpResponse.println(F("<table>"));
     HttpResponse.println(F("<tr><th>Time (ms)</th><th>Distance (mm)</th><th>Status</th></tr>"));
 
-    RangeLogEntry* lastRangeLogEntryPtr = RangeLog.getEntryFromEnd(1);
-    RangeLogEntry* rangeLogEntryPtr = RangeLog.getFirstEntry();
+    RangeLogEntry rangeLogEntries[RANGE_LOG_SIZE];
+    uint16_t count = RangeLog.getSnapshot(rangeLogEntries, RANGE_LOG_SIZE);
 
     uint32_t timeOffset = 0;
-    if (lastRangeLogEntryPtr != nullptr)
-        timeOffset = lastRangeLogEntryPtr->time;
+    if (count > 0)
+        timeOffset = rangeLogEntries[count - 1].time;
 
-    lastRangeLogEntryPtr = rangeLogEntryPtr;
-    while (rangeLogEntryPtr != nullptr)
+    RangeLogEntry* lastRangeLogEntryPtr = rangeLogEntries;
+    for (int i = 0; i < count; i++)
     {
+        RangeLogEntry* rangeLogEntryPtr = rangeLogEntries + i;
         HttpResponse.printf(
             F("<tr><td>%d (+%d)</td><td>%d (%d)</td><td>%d</td></tr>\r\n"), 
             rangeLogEntryPtr->time - timeOffset,
@@ -947,7 +951,6 @@ void renderRangeLogTable()
             );
 
         lastRangeLogEntryPtr = rangeLogEntryPtr;
-        rangeLogEntryPtr = RangeLog.getNextEntry();
     }
 
     HttpResponse.println(F("</table>"));
@@ -978,7 +981,7 @@ void handleHttpScriptRequest()
 
     writeHtmlFooter();
 
-    WebServer.send(200, CONTENT_TYPE_HTML, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -996,11 +999,9 @@ void handleHttpScriptPostRequest()
 
 void renderEventLog()
 {
-    const char* event = EventLog.getFirstEntry();
-    while (event != nullptr)
+    for (const char* event : EventLog)
     {
         HttpResponse.printf(F("<div>%s</div>\r\n"), event);
-        event = EventLog.getNextEntry();
     }
 
     HttpResponse.println(F("<p><a href=\"/events/clear\">Clear event log</a></p>"));
@@ -1049,7 +1050,7 @@ void handleHttpConfigFormRequest()
 
     writeHtmlFooter();
 
-    WebServer.send(200, CONTENT_TYPE_HTML, HttpResponse);
+    HttpResponse.end();
 }
 
 
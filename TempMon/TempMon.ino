@@ -8,29 +8,38 @@
 #include <TimeUtils.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <ChunkedResponse.h>
 #include <HtmlWriter.h>
+#include <JsonWriter.h>
+#include <LogCursor.h>
 #include <Navigation.h>
 #include <Log.h>
+#include <FlashLog.h>
+#include <Rollup.h>
 #include <Wire.h>
 #include <U8g2lib.h>
 #include <OneWire.h>
 #include <DallasTemperature.h>
 #include "PersistentData.h"
 #include "TempLogEntry.h"
-#include "TempStatsEntry.h"
 #include "DayStatistics.h"
 #include "GoodWeUDP.h"
+#include "StaticFiles.h"
 
 #define SECONDS_PER_DAY (24 * 3600)
 #define HTTP_POLL_INTERVAL 60
 #define GOODWE_POLL_INTERVAL (6 * 3600)
 #define GOODWE_RETRY_INTERVAL (5 * 60)
 #define EVENT_LOG_LENGTH 50
+#define EVENT_LOG_ARENA_SIZE 2048
 #define FTP_RETRY_INTERVAL (15 * 60)
 #define HOUR_LOG_INTERVAL (30 * 60)
+#define T_INSIDE 0
+#define T_OUTSIDE 1
 #define TEMP_POLL_INTERVAL 6
 #define TEMP_LOG_AGGREGATIONS 10
 #define TEMP_LOG_SIZE 200
+#define TEMP_LOG_SEGMENTS 4
 #define NIGHT_OFFSET_DELAY (10 * 60)
 
 #define LED_ON 0
@@ -78,11 +87,12 @@ const char* Files[] PROGMEM =
 ESPWebServer WebServer(80); // Default HTTP port
 WiFiNTP TimeServer;
 WiFiFTPClient FTPClient(2000); // 2 sec timeout
-StringBuilder HttpResponse(16384); // 16KB HTTP response buffer
+ChunkedResponse HttpResponse(WebServer, 1536); // 1.5KB HTTP response buffer (larger responses are sent in chunks)
 HtmlWriter Html(HttpResponse, Files[Logo], Files[Styles], 40);
-Log<const char> EventLog(EVENT_LOG_LENGTH);
-StaticLog<TempLogEntry> TempLog(TEMP_LOG_SIZE);
-StaticLog<TempStatsEntry> HourStats(24 * 2); // 24 hrs
+JsonWriter Json(HttpResponse);
+StringArenaLog EventLog(EVENT_LOG_LENGTH, EVENT_LOG_ARENA_SIZE);
+FlashLog<TempLogEntry> TempLog("templog", TEMP_LOG_SEGMENTS, TEMP_LOG_SIZE);
+Rollup<2> HourStats(HOUR_LOG_INTERVAL, 24 * 2); // 24 hrs; T inside & outside
 DayStatistics DayStats;
 WiFiStateMachine WiFiSM(TimeServer, WebServer, EventLog);
 Navigation Nav;
@@ -105,7 +115,6 @@ int ftpSyncEntries = 0;
 TempLogEntry newTempLogEntry;
 
 TempLogEntry* lastTempLogEntryPtr = nullptr;
-TempStatsEntry* lastHoutStatsEntryPtr = nullptr;
 
 bool newSensorFound = false;
 bool hasOutsideSensor = false;
@@ -247,7 +256,11 @@ void setup()
     WebServer.on("/json", handleHttpJsonRequest);
     WebServer.onNotFound(handleHttpNotFound);
     
-    WiFiSM.registerStaticFiles(Files, _LastFile);    
+    WiFiSM.registerStaticFiles(StaticFiles, StaticFileCount);
+    if (SPIFFS.begin())
+        TempLog.load();
+    else
+        WiFiSM.logEvent(F("Starting SPIFFS failed"));
     WiFiSM.on(WiFiInitState::TimeServerSynced, onWiFiTimeSynced);
     WiFiSM.on(WiFiInitState::Initialized, onWiFiInitialized);
     WiFiSM.begin(PersistentData.wifiSSID, PersistentData.wifiKey, PersistentData.hostName);
@@ -576,17 +589,15 @@ void drawTempGraph()
 
     uint8_t x = graphX;
     uint8_t lastY = 0;
-    TempStatsEntry* hourStatsEntryPtr = HourStats.getFirstEntry();
-    while (hourStatsEntryPtr != nullptr)
+    for (RollupEntry<2>* hourStatsEntryPtr : HourStats.getLog())
     {
-        uint8_t y = graphY - getBarValue(hourStatsEntryPtr->getAvgTInside(), tMin, tMax) * graphHeight;
+        uint8_t y = graphY - getBarValue(hourStatsEntryPtr->getAvg(T_INSIDE), tMin, tMax) * graphHeight;
 
         if (lastY != 0)
             Display.drawLine(x-2, lastY, x, y);
 
         x += 2;
         lastY = y;
-        hourStatsEntryPtr = HourStats.getNextEntry();
     }
 }
 
@@ -614,7 +625,7 @@ bool trySyncFTP(Print* printTo)
     {
         if (ftpSyncEntries > 0)
         {
-            writeTempLogCsv(TempLog.getEntryFromEnd(ftpSyncEntries), dataClient);
+            writeTempLogCsv(TempLog.getEntriesFromEnd(ftpSyncEntries), dataClient);
             ftpSyncEntries = 0;            
         }
         else if (printTo != nullptr)
@@ -652,13 +663,8 @@ void updateTempLog()
         newTempLogEntry.reset(); // Moving average
     }
 
-    if ((lastHoutStatsEntryPtr == nullptr) || (currentTime >= lastHoutStatsEntryPtr->time + HOUR_LOG_INTERVAL))
-    {
-        TempStatsEntry newHourStatsEntry;
-        newHourStatsEntry.time = currentTime - (currentTime % HOUR_LOG_INTERVAL);
-        lastHoutStatsEntryPtr = HourStats.add(&newHourStatsEntry);
-    }
-    lastHoutStatsEntryPtr->update(tInside, tOutside);
+    float temperatures[2] = { tInside, tOutside };
+    HourStats.update(currentTime, temperatures);
 }
 
 
@@ -677,17 +683,17 @@ void test(String message)
     else if (message.startsWith("testT"))
     {
         float tInside = 15;
+        HourStats.clear();
         for (int i = 0; i < 48; i++)
         {
-            TempStatsEntry tempLogEntry;
-            tempLogEntry.time = currentTime + (i * 1800);
-            tempLogEntry.update(tInside, tInside - 10);
-            lastHoutStatsEntryPtr = HourStats.add(&tempLogEntry);
+            float temperatures[2] = { tInside, tInside - 10 };
+            HourStats.update(currentTime + (i * 1800), temperatures);
             if (tInside++ == 40) tInside = 15;
         }
     }
     else if (message.startsWith("testR"))
     {
+        TempLog.flush();
         WiFiSM.reset();
     }
 }
@@ -697,19 +703,17 @@ void getTemperatureRange(float& tMin, float& tMax)
 {
     tMin = 100;
     tMax = -100;
-    TempStatsEntry* logEntryPtr = HourStats.getFirstEntry();
-    while (logEntryPtr != nullptr)
+    for (RollupEntry<2>* logEntryPtr : HourStats.getLog())
     {
-        float avgTInside = logEntryPtr->getAvgTInside();
+        float avgTInside = logEntryPtr->getAvg(T_INSIDE);
         tMin = std::min(tMin, avgTInside);
         tMax = std::max(tMax, avgTInside);
         if (hasOutsideSensor)
         {
-            float avgTOutside = logEntryPtr->getAvgTOutside();
+            float avgTOutside = logEntryPtr->getAvg(T_OUTSIDE);
             tMin = std::min(tMin, avgTOutside);
             tMax = std::max(tMax, avgTOutside);
         }
-        logEntryPtr = HourStats.getNextEntry();
     }
 
     tMax = std::max(tMax, tMin + 0.1F); // Prevent division by zero
@@ -740,6 +744,7 @@ void handleHttpRootRequest()
     else
         ftpSync = formatTime("%H:%M", lastFTPSyncTime);
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Home"), Nav, HTTP_POLL_INTERVAL);
 
     Html.writeDivStart(F("flex-container"));
@@ -762,7 +767,7 @@ void handleHttpRootRequest()
     Html.writeDivEnd();
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -825,23 +830,22 @@ void writeHourStats()
     }
     Html.writeRowEnd();
 
-    TempStatsEntry* logEntryPtr = HourStats.getFirstEntry();
-    while (logEntryPtr != nullptr)
+    for (RollupEntry<2>* logEntryPtr : HourStats.getLog())
     {
         Html.writeRowStart();
         Html.writeCell(formatTime("%H:%M", logEntryPtr->time));
-        Html.writeCell(logEntryPtr->minTInside);
-        Html.writeCell(logEntryPtr->maxTInside);
-        Html.writeCell(logEntryPtr->getAvgTInside());
+        Html.writeCell(logEntryPtr->min[T_INSIDE]);
+        Html.writeCell(logEntryPtr->max[T_INSIDE]);
+        Html.writeCell(logEntryPtr->getAvg(T_INSIDE));
         if (hasOutsideSensor)
         {
-            Html.writeCell(logEntryPtr->minTOutside);
-            Html.writeCell(logEntryPtr->maxTOutside);
-            Html.writeCell(logEntryPtr->getAvgTOutside());
+            Html.writeCell(logEntryPtr->min[T_OUTSIDE]);
+            Html.writeCell(logEntryPtr->max[T_OUTSIDE]);
+            Html.writeCell(logEntryPtr->getAvg(T_OUTSIDE));
         }
 
-        float outsideBar = hasOutsideSensor ? getBarValue(logEntryPtr->getAvgTOutside(), tMin, tMax) : 0;
-        float insideBar = getBarValue(logEntryPtr->getAvgTInside(), tMin, tMax);  
+        float outsideBar = hasOutsideSensor ? getBarValue(logEntryPtr->getAvg(T_OUTSIDE), tMin, tMax) : 0;
+        float insideBar = getBarValue(logEntryPtr->getAvg(T_INSIDE), tMin, tMax);  
 
         Html.writeCellStart(F("graph"));
         Html.writeStackedBar(
@@ -855,36 +859,28 @@ void writeHourStats()
         Html.writeCellEnd();
 
         Html.writeRowEnd();
-
-        logEntryPtr = HourStats.getNextEntry();
     }
     HttpResponse.println(F("</table>"));
 }
 
 
-void writeJsonFloat(String name, float value)
-{
-    HttpResponse.printf(F("\"%s\": %0.1f"), name.c_str(), value);
-}
-
 void handleHttpJsonRequest()
 {
     Tracer tracer(F("handleHttpJsonRequest"));
 
-    HttpResponse.clear();
-    HttpResponse.print(F("{ "));
-    writeJsonFloat(F("Tin"), tInside);
-    HttpResponse.print(F(", "));
-    writeJsonFloat(F("Tout"), tOutside);
-    HttpResponse.print(F(" }"));
+    HttpResponse.begin(200, ContentTypeJson);
+    Json.beginObject();
+    Json.writeMember(F("Tin"), tInside, 1);
+    Json.writeMember(F("Tout"), tOutside, 1);
+    Json.endObject();
 
-    WebServer.send(200, ContentTypeJson, HttpResponse);
+    HttpResponse.end();
 }
 
 
-void writeTempLogCsv(TempLogEntry* tempLogEntryPtr, Print& destination)
+void writeTempLogCsv(StaticLog<TempLogEntry>::Range tempLogEntries, Print& destination)
 {
-    while (tempLogEntryPtr != nullptr)
+    for (TempLogEntry* tempLogEntryPtr : tempLogEntries)
     {
         destination.printf(
             "%s;%0.1f;%0.1f\r\n",
@@ -892,8 +888,6 @@ void writeTempLogCsv(TempLogEntry* tempLogEntryPtr, Print& destination)
             tempLogEntryPtr->getAvgTinside(),
             tempLogEntryPtr->getAvgToutside()
             );
-
-        tempLogEntryPtr = TempLog.getNextEntry();
     }
 }
 
@@ -902,12 +896,15 @@ void handleHttpTempLogRequest()
 {
     Tracer tracer(F("handleHttpTempLogRequest"));
 
-    HttpResponse.clear();
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, TempLog, cursor);
+
+    HttpResponse.begin(200, ContentTypeText);
     HttpResponse.println(F("Time;Tinside;Toutside"));
 
-    writeTempLogCsv(TempLog.getFirstEntry(), HttpResponse);
+    writeTempLogCsv(incremental ? TempLog.getEntriesSince(cursor) : TempLog.getRange(), HttpResponse);
 
-    WebServer.send(200, ContentTypeText, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -915,6 +912,7 @@ void handleHttpFtpSyncRequest()
 {
     Tracer tracer(F("handleHttpFtpSyncRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("FTP Sync"), Nav);
 
     Html.writePreStart();
@@ -935,7 +933,7 @@ void handleHttpFtpSyncRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -943,6 +941,7 @@ void handleHttpCalibrateFormRequest()
 {
     Tracer tracer(F("handleHttpCalibrateFormRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Calibrate"), Nav);
 
     if (TempSensors.getDS18Count() < 1)
@@ -1002,7 +1001,7 @@ void handleHttpCalibrateFormRequest()
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -1045,20 +1044,21 @@ void handleHttpEventLogRequest()
         WiFiSM.logEvent(F("Event log cleared."));
     }
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Event log"), Nav);
 
-    const char* event = EventLog.getFirstEntry();
-    while (event != nullptr)
+    uint32_t cursor;
+    bool incremental = getLogCursor(WebServer, EventLog, cursor);
+    for (const char* event : incremental ? EventLog.getEntriesSince(cursor) : EventLog.getRange())
     {
         Html.writeDiv(F("%s"), event);
-        event = EventLog.getNextEntry();
     }
 
     Html.writeActionLink(F("clear"), F("Clear event log"), currentTime, ButtonClass);
 
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -1066,6 +1066,7 @@ void handleHttpConfigFormRequest()
 {
     Tracer tracer(F("handleHttpConfigFormRequest"));
 
+    HttpResponse.begin(200, ContentTypeHtml);
     Html.writeHeader(F("Settings"), Nav);
 
     Html.writeFormStart(F("/config"), F("grid"));
@@ -1083,6 +1084,7 @@ void handleHttpConfigFormRequest()
     if (WiFiSM.shouldPerformAction(F("reset")))
     {
         Html.writeParagraph(F("Resetting..."));
+        TempLog.flush();
         WiFiSM.reset();
     }
     else
@@ -1090,7 +1092,7 @@ void handleHttpConfigFormRequest()
         
     Html.writeFooter();
 
-    WebServer.send(200, ContentTypeHtml, HttpResponse);
+    HttpResponse.end();
 }
 
 
@@ -0,0 +1,28 @@
+#include <Arduino.h>
+#include <BinaryLogWriter.h>
+
+static void writeUInt16(Print& output, uint16_t value)
+{
+    output.write(uint8_t(value));
+    output.write(uint8_t(value >> 8));
+}
+
+
+void writeBinaryLogHeader(Print& output, uint16_t entrySize, const BinaryField* fields, uint8_t fieldCount)
+{
+    output.write(reinterpret_cast<const uint8_t*>("BLOG"), 4);
+    output.write(uint8_t(BINARY_LOG_VERSION));
+    output.write(fieldCount);
+    writeUInt16(output, entrySize);
+
+    for (int i = 0; i < fieldCount; i++)
+    {
+        const BinaryField& field = fields[i];
+        size_t nameLength = strlen(field.name);
+        output.write(field.type);
+        output.write(field.count);
+        writeUInt16(output, field.offset);
+        output.write(uint8_t(nameLength));
+        output.write(reinterpret_cast<const uint8_t*>(field.name), nameLength);
+    }
+}
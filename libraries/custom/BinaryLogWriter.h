@@ -0,0 +1,60 @@
+#ifndef BINARYLOGWRITER_H
+#define BINARYLOGWRITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+#include <type_traits>
+#include <Print.h>
+
+// Binary export of log entries: a schema header followed by the raw entries (little-endian, as in RAM).
+// Header: "BLOG", version (uint8), field count (uint8), entry size (uint16),
+// followed per field by: type (uint8), count (uint8), offset (uint16), name length (uint8), name.
+// The type's low nibble is the size in bytes; the high nibble is 0 (unsigned), 1 (signed) or 2 (float).
+// The schema makes the export independent of the struct layout (padding, packing, sizeof(time_t)).
+// Reference parser: tools/parse_binary_log.py
+
+#define BINARY_LOG_VERSION 1
+
+#define BINARY_FIELD(TEntry, member) \
+    BinaryField \
+    { \
+        #member, \
+        getBinaryFieldType<std::remove_extent<decltype(TEntry::member)>::type>(), \
+        (std::extent<decltype(TEntry::member)>::value == 0) ? uint8_t(1) : uint8_t(std::extent<decltype(TEntry::member)>::value), \
+        uint16_t(offsetof(TEntry, member)) \
+    }
+
+struct BinaryField
+{
+    const char* name;
+    uint8_t type;
+    uint8_t count;
+    uint16_t offset;
+};
+
+template<typename T>
+constexpr uint8_t getBinaryFieldType()
+{
+    return (std::is_floating_point<T>::value ? 0x20 : (std::is_signed<T>::value ? 0x10 : 0)) | sizeof(T);
+}
+
+void writeBinaryLogHeader(Print& output, uint16_t entrySize, const BinaryField* fields, uint8_t fieldCount);
+
+// Writes the schema header and all entries with time > since (entries must have a "time" member).
+// The entries can be a log or a range of it (e.g. getEntriesSince).
+// The last entry may still be updated (aggregated) after it has been exported.
+template<class TEntries, size_t FieldCount>
+void writeBinaryLog(Print& output, const TEntries& entries, const BinaryField (&fields)[FieldCount], time_t since = 0)
+{
+    typedef typename std::remove_pointer<typename std::decay<decltype(*entries.begin())>::type>::type TEntry;
+
+    writeBinaryLogHeader(output, sizeof(TEntry), fields, FieldCount);
+    for (TEntry* entryPtr : entries)
+    {
+        if (entryPtr->time > since)
+            output.write(reinterpret_cast<const uint8_t*>(entryPtr), sizeof(TEntry));
+    }
+}
+
+#endif
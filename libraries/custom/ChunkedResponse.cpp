@@ -0,0 +1,61 @@
+#include <Arduino.h>
+#include "ChunkedResponse.h"
+
+// Constructor
+ChunkedResponse::ChunkedResponse(ESPWebServer& webServer, size_t size)
+    : StringBuilder(size), _webServer(webServer)
+{
+    _active = false;
+    _chunks = 0;
+}
+
+
+void ChunkedResponse::begin(int code, const char* contentType)
+{
+    clear();
+    _code = code;
+    _contentType = contentType;
+    _active = true;
+    _chunks = 0;
+}
+
+
+void ChunkedResponse::end()
+{
+    if (!_active)
+        return;
+
+    if (_chunks == 0)
+    {
+        // Everything fits in the buffer; send a regular response.
+        _webServer.setContentLength(_length);
+        _webServer.send(_code, _contentType, "");
+        _webServer.sendContent(_buffer, _length);
+    }
+    else
+    {
+        if (_length != 0)
+            _webServer.sendContent(_buffer, _length);
+        _webServer.sendContent(""); // Last chunk
+    }
+
+    clear();
+    _active = false;
+}
+
+
+bool ChunkedResponse::flushBuffer()
+{
+    if (!_active)
+        return false;
+
+    if (_chunks++ == 0)
+    {
+        _webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        _webServer.send(_code, _contentType, "");
+    }
+
+    _webServer.sendContent(_buffer, _length);
+    clear();
+    return true;
+}
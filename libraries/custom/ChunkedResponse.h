@@ -0,0 +1,39 @@
+#ifndef CHUNKEDRESPONSE_H
+#define CHUNKEDRESPONSE_H
+
+#include <ESPWebServer.h>
+#include <StringBuilder.h>
+
+// StringBuilder which sends its content as HTTP response.
+// If the content fits in the buffer, it is sent as a regular response (with Content-Length).
+// Otherwise the buffer is flushed to the web server using chunked transfer encoding whenever it is full,
+// so the buffer size only determines the chunk size and no longer limits the response size.
+// Only the output of a single printf is still limited to the buffer size.
+class ChunkedResponse : public StringBuilder
+{
+  public:
+    // Constructor
+    ChunkedResponse(ESPWebServer& webServer, size_t size);
+
+    // Starts a new response; all content written until end() is sent with the given status code and content type.
+    void begin(int code, const char* contentType);
+
+    // Sends the (remaining) content and completes the response.
+    void end();
+
+    inline size_t chunks()
+    {
+        return _chunks;
+    }
+
+  protected:
+    ESPWebServer& _webServer;
+    int _code;
+    const char* _contentType;
+    bool _active;
+    size_t _chunks;
+
+    virtual bool flushBuffer();
+};
+
+#endif
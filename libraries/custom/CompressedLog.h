@@ -0,0 +1,465 @@
+#ifndef COMPRESSEDLOG_H
+#define COMPRESSEDLOG_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+// Variant of StaticLog for time series, which stores the entries delta-compressed in a byte ring buffer.
+// T must start with a time_t member "time", followed by ValueCount values of type TValue (uint16_t, int16_t or float),
+// without padding (i.e. T is typically packed).
+// Timestamps are stored as delta-of-delta and values as delta from the previous entry, both as zigzag varints.
+// A bit mask indicates which values changed; unchanged values take no space at all.
+// Float values are stored as scaled integers (value * Scale), so they are rounded to 1/Scale.
+// Every KEYFRAME_INTERVAL entries a keyframe with absolute values starts a new block.
+// A block is the unit of random access (getRange) and of eviction: if the buffer is full or the log
+// contains size entries, the oldest block is dropped. The buffer must hold at least MAX_ENTRY_SIZE bytes.
+// Iterators yield a pointer to a decoded copy of the entry, which is valid until the iterator advances.
+template <class T, class TValue, uint16_t ValueCount, int Scale = 1>
+class CompressedLog
+{
+    static_assert(sizeof(T) == sizeof(time_t) + ValueCount * sizeof(TValue), "T must be a time_t followed by ValueCount TValues");
+
+    private:
+        struct CodecState
+        {
+            time_t time;
+            int32_t timeDelta;
+            int32_t values[ValueCount];
+        };
+
+    public:
+        static const uint16_t KEYFRAME_INTERVAL = 16;
+        static const uint16_t MASK_SIZE = (ValueCount + 7) / 8;
+        static const uint16_t MAX_ENTRY_SIZE = 10 + MASK_SIZE + ValueCount * 5;
+
+        class Iterator
+        {
+            public:
+                Iterator(const CompressedLog& log, uint16_t block, uint16_t skip, uint16_t remaining)
+                    : _log(log), _remaining(remaining)
+                {
+                    if (remaining == 0) return;
+                    _offset = log._blockOffsets[block];
+                    _entryInBlock = 0;
+                    decode();
+                    while (skip-- != 0) decode();
+                }
+
+                inline T* operator*()
+                {
+                    return &_entry;
+                }
+
+                inline Iterator& operator++()
+                {
+                    if (--_remaining != 0) decode();
+                    return *this;
+                }
+
+                inline bool operator==(const Iterator& other) const
+                {
+                    return _remaining == other._remaining;
+                }
+
+                inline bool operator!=(const Iterator& other) const
+                {
+                    return _remaining != other._remaining;
+                }
+
+            private:
+                const CompressedLog& _log;
+                uint16_t _offset;
+                uint16_t _entryInBlock;
+                uint16_t _remaining;
+                CodecState _state;
+                T _entry;
+
+                void decode()
+                {
+                    _log.decode(_offset, _entryInBlock == 0, _state, _entry);
+                    if (++_entryInBlock == KEYFRAME_INTERVAL) _entryInBlock = 0;
+                }
+        };
+
+        class Range
+        {
+            public:
+                Range(const CompressedLog& log, uint16_t first, uint16_t count)
+                    : _log(log), _first(first), _count(count) {}
+
+                inline Iterator begin() const
+                {
+                    if (_count == 0) return end();
+                    uint16_t block = _log._firstBlock + _first / KEYFRAME_INTERVAL;
+                    if (block >= _log._maxBlocks) block -= _log._maxBlocks;
+                    return Iterator(_log, block, _first % KEYFRAME_INTERVAL, _count);
+                }
+
+                inline Iterator end() const
+                {
+                    return Iterator(_log, 0, 0, 0);
+                }
+
+                inline uint16_t count() const
+                {
+                    return _count;
+                }
+
+            private:
+                const CompressedLog& _log;
+                uint16_t _first;
+                uint16_t _count;
+        };
+
+        // Constructor
+        CompressedLog(uint16_t size, uint16_t bufferSize)
+        {
+            _size = size;
+            _bufferSize = bufferSize;
+            _maxBlocks = size / KEYFRAME_INTERVAL + 2;
+            _buffer = new uint8_t[bufferSize];
+            _blockOffsets = new uint16_t[_maxBlocks];
+            _generation = 0;
+            clear();
+        }
+
+        // Destructor
+        ~CompressedLog()
+        {
+            delete[] _blockOffsets;
+            delete[] _buffer;
+        }
+
+        uint16_t count() const
+        {
+            return _count;
+        }
+
+        // Number of entries added since the log was created or cleared (see LogBase::sequence).
+        uint32_t sequence() const
+        {
+            return _sequence;
+        }
+
+        // Incremented each time the log is cleared (see LogBase::generation).
+        uint16_t generation() const
+        {
+            return _generation;
+        }
+
+        // Number of bytes used by the compressed entries
+        uint16_t bytesUsed() const
+        {
+            return _used;
+        }
+
+        void clear()
+        {
+            reset();
+            _sequence = 0;
+            _generation++;
+        }
+
+        // Returns a pointer to an (uncompressed) copy of the added entry, which is valid until the next add.
+        T* add(const T* entry)
+        {
+            uint8_t encoded[MAX_ENTRY_SIZE];
+            CodecState newState = _state;
+            bool keyframe = (_blockCount == 0) || (_lastBlockEntries == KEYFRAME_INTERVAL);
+            uint16_t length = encode(entry, keyframe, newState, encoded);
+
+            while ((_count == _size) || (length > _bufferSize - _used))
+            {
+                if (!keyframe && (_blockCount == 1))
+                {
+                    // The block we're appending to must be dropped; start a new one.
+                    reset();
+                    keyframe = true;
+                    length = encode(entry, keyframe, newState, encoded);
+                }
+                else
+                    dropOldestBlock();
+            }
+
+            uint16_t offset = _head + _used;
+            if (offset >= _bufferSize) offset -= _bufferSize;
+
+            if (keyframe)
+            {
+                uint16_t block = _firstBlock + _blockCount;
+                if (block >= _maxBlocks) block -= _maxBlocks;
+                _blockOffsets[block] = offset;
+                _blockCount++;
+                _lastBlockEntries = 0;
+            }
+
+            uint16_t tailSpace = _bufferSize - offset;
+            if (length <= tailSpace)
+                memcpy(_buffer + offset, encoded, length);
+            else
+            {
+                memcpy(_buffer + offset, encoded, tailSpace);
+                memcpy(_buffer, encoded + tailSpace, length - tailSpace);
+            }
+
+            _used += length;
+            _lastBlockEntries++;
+            _count++;
+            _sequence++;
+            _state = newState;
+
+            memcpy(&_lastEntry, entry, sizeof(T));
+            return &_lastEntry;
+        }
+
+        Iterator begin() const
+        {
+            return getRange().begin();
+        }
+
+        Iterator end() const
+        {
+            return getRange().end();
+        }
+
+        // All entries, oldest first
+        Range getRange() const
+        {
+            return Range(*this, 0, _count);
+        }
+
+        // Max. count entries, starting at the offset-th entry (0 = oldest)
+        Range getRange(uint16_t offset, uint16_t count) const
+        {
+            if (offset > _count) offset = _count;
+            if (count > _count - offset) count = _count - offset;
+            return Range(*this, offset, count);
+        }
+
+        // The last n entries, oldest first
+        Range getEntriesFromEnd(uint16_t n) const
+        {
+            if (n > _count) n = _count;
+            return Range(*this, _count - n, n);
+        }
+
+        // Entries added after sequence() returned the given cursor, oldest first (see LogBase::getEntriesSince).
+        Range getEntriesSince(uint32_t cursor) const
+        {
+            uint32_t newEntries = (cursor > _sequence) ? _count : _sequence - cursor;
+            return getEntriesFromEnd((newEntries > _count) ? _count : newEntries);
+        }
+
+    protected:
+        uint16_t _size;
+        uint16_t _bufferSize;
+        uint16_t _maxBlocks;
+        uint16_t _head;
+        uint16_t _used;
+        uint16_t _count;
+        uint16_t _firstBlock;
+        uint16_t _blockCount;
+        uint16_t _lastBlockEntries;
+        uint32_t _sequence;
+        uint16_t _generation;
+        uint8_t* _buffer;
+        uint16_t* _blockOffsets;
+        CodecState _state;
+        T _lastEntry;
+
+        void reset()
+        {
+            _head = 0;
+            _used = 0;
+            _count = 0;
+            _firstBlock = 0;
+            _blockCount = 0;
+            _lastBlockEntries = 0;
+            memset(&_state, 0, sizeof(_state));
+        }
+
+        void dropOldestBlock()
+        {
+            _count -= (_blockCount == 1) ? _lastBlockEntries : KEYFRAME_INTERVAL;
+            if (--_blockCount == 0)
+            {
+                reset();
+                return;
+            }
+
+            if (++_firstBlock == _maxBlocks) _firstBlock = 0;
+            uint16_t newHead = _blockOffsets[_firstBlock];
+            _used -= (newHead >= _head) ? newHead - _head : newHead + _bufferSize - _head;
+            _head = newHead;
+        }
+
+        static inline TValue* valuesPtr(T& entry)
+        {
+            return reinterpret_cast<TValue*>(reinterpret_cast<uint8_t*>(&entry) + sizeof(time_t));
+        }
+
+        static inline const TValue* valuesPtr(const T* entryPtr)
+        {
+            return reinterpret_cast<const TValue*>(reinterpret_cast<const uint8_t*>(entryPtr) + sizeof(time_t));
+        }
+
+        uint16_t encode(const T* entry, bool keyframe, CodecState& state, uint8_t* buffer) const
+        {
+            uint8_t* p = buffer;
+            const TValue* values = valuesPtr(entry);
+
+            if (keyframe)
+            {
+                writeVarint(zigzag(int64_t(entry->time)), p);
+                state.timeDelta = 0;
+            }
+            else
+            {
+                int32_t timeDelta = int32_t(entry->time - state.time);
+                writeVarint(zigzag(int64_t(timeDelta - state.timeDelta)), p);
+                state.timeDelta = timeDelta;
+            }
+            state.time = entry->time;
+
+            int32_t deltas[ValueCount];
+            for (int i = 0; i < ValueCount; i++)
+            {
+                TValue value;
+                memcpy(&value, values + i, sizeof(TValue)); // T may be packed
+                int32_t intValue = toInt(value);
+                deltas[i] = keyframe ? intValue : int32_t(uint32_t(intValue) - uint32_t(state.values[i]));
+                state.values[i] = intValue;
+            }
+
+            if (keyframe)
+            {
+                for (int i = 0; i < ValueCount; i++)
+                    writeVarint(zigzag(int64_t(deltas[i])), p);
+            }
+            else
+            {
+                // Bit mask of changed values, followed by the deltas of changed values only
+                uint8_t* mask = p;
+                memset(mask, 0, MASK_SIZE);
+                p += MASK_SIZE;
+                for (int i = 0; i < ValueCount; i++)
+                {
+                    if (deltas[i] == 0) continue;
+                    mask[i / 8] |= 1 << (i % 8);
+                    writeVarint(zigzag(int64_t(deltas[i])), p);
+                }
+            }
+
+            return p - buffer;
+        }
+
+        void decode(uint16_t& offset, bool keyframe, CodecState& state, T& entry) const
+        {
+            if (keyframe)
+            {
+                state.time = time_t(unzigzag(readVarint(offset)));
+                state.timeDelta = 0;
+            }
+            else
+            {
+                state.timeDelta += int32_t(unzigzag(readVarint(offset)));
+                state.time += state.timeDelta;
+            }
+
+            memset(&entry, 0, sizeof(T));
+            entry.time = state.time;
+
+            uint8_t mask[MASK_SIZE];
+            if (!keyframe)
+            {
+                for (int i = 0; i < MASK_SIZE; i++)
+                {
+                    mask[i] = _buffer[offset];
+                    if (++offset == _bufferSize) offset = 0;
+                }
+            }
+
+            TValue* values = valuesPtr(entry);
+            for (int i = 0; i < ValueCount; i++)
+            {
+                if (keyframe)
+                    state.values[i] = int32_t(unzigzag(readVarint(offset)));
+                else if (mask[i / 8] & (1 << (i % 8)))
+                    state.values[i] = int32_t(uint32_t(state.values[i]) + uint32_t(unzigzag(readVarint(offset))));
+                TValue value = fromInt(state.values[i], values);
+                memcpy(values + i, &value, sizeof(TValue));
+            }
+        }
+
+
+        uint64_t readVarint(uint16_t& offset) const
+        {
+            uint64_t result = 0;
+            int shift = 0;
+            uint8_t b;
+            do
+            {
+                b = _buffer[offset];
+                if (++offset == _bufferSize) offset = 0;
+                result |= uint64_t(b & 0x7F) << shift;
+                shift += 7;
+            }
+            while (b & 0x80);
+            return result;
+        }
+
+        static inline void writeVarint(uint64_t value, uint8_t*& p)
+        {
+            while (value >= 0x80)
+            {
+                *p++ = uint8_t(value) | 0x80;
+                value >>= 7;
+            }
+            *p++ = uint8_t(value);
+        }
+
+        static inline uint64_t zigzag(int64_t value)
+        {
+            return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+        }
+
+        static inline int64_t unzigzag(uint64_t value)
+        {
+            return int64_t(value >> 1) ^ -int64_t(value & 1);
+        }
+
+        // OpenTherm f8.8 values are two's complement, so uint16_t is sign-extended to keep deltas around zero small.
+        static inline int32_t toInt(uint16_t value)
+        {
+            return int16_t(value);
+        }
+
+        static inline int32_t toInt(int16_t value)
+        {
+            return value;
+        }
+
+        static inline int32_t toInt(float value)
+        {
+            return lroundf(value * Scale);
+        }
+
+        static inline uint16_t fromInt(int32_t value, const uint16_t*)
+        {
+            return uint16_t(value);
+        }
+
+        static inline int16_t fromInt(int32_t value, const int16_t*)
+        {
+            return int16_t(value);
+        }
+
+        static inline float fromInt(int32_t value, const float*)
+        {
+            return float(value) / Scale;
+        }
+};
+
+#endif
@@ -0,0 +1,278 @@
+#include "FlashLog.h"
+#include "Tracer.h"
+#include <ESPFileSystem.h>
+
+constexpr uint32_t FLASH_LOG_MAGIC = 0x474F4C46; // "FLOG"
+constexpr uint16_t FLASH_LOG_VERSION = 1;
+
+struct FlashLogHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entrySize;
+    uint32_t sequence;
+    uint32_t crc;
+};
+
+
+static uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0)
+{
+    crc = ~crc;
+    while (length-- != 0)
+    {
+        crc ^= *data++;
+        for (int i = 0; i < 8; i++)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+
+// Constructor
+FlashLogStore::FlashLogStore(const char* name, uint16_t entrySize, uint8_t segmentCount, uint32_t segmentSize, uint16_t pageSize)
+{
+    strncpy(_name, name, sizeof(_name) - 1);
+    _name[sizeof(_name) - 1] = 0;
+    _entrySize = entrySize;
+    _segmentCount = segmentCount;
+    _segmentSize = segmentSize;
+
+    _entriesPerPage = getEntriesPerPage(entrySize, pageSize);
+    _page = new uint8_t[6 + _entriesPerPage * entrySize];
+
+    _pageEntries = 0;
+    _segment = -1;
+    _segmentSequence = 0;
+    _segmentBytes = 0;
+    _pagesWritten = 0;
+}
+
+
+// Destructor
+FlashLogStore::~FlashLogStore()
+{
+    delete[] _page;
+}
+
+
+uint16_t FlashLogStore::getEntriesPerPage(uint16_t entrySize, uint16_t pageSize)
+{
+    // Page layout: entry count (uint16), entries, CRC (uint32)
+    uint16_t entriesPerPage = (pageSize - 6) / entrySize;
+    return (entriesPerPage == 0) ? 1 : entriesPerPage;
+}
+
+
+uint32_t FlashLogStore::getSegmentSize(uint16_t entrySize, uint32_t entries, uint16_t pageSize)
+{
+    uint16_t entriesPerPage = getEntriesPerPage(entrySize, pageSize);
+    uint32_t pages = (entries + entriesPerPage - 1) / entriesPerPage;
+    return sizeof(FlashLogHeader) + pages * (6 + entriesPerPage * entrySize);
+}
+
+
+void FlashLogStore::getSegmentPath(uint8_t segment, char* path)
+{
+    snprintf(path, 32, "/%s.%u", _name, segment);
+}
+
+
+bool FlashLogStore::begin(std::function<void(const uint8_t*)> onEntry)
+{
+    Tracer tracer(F("FlashLogStore::begin"), _name);
+
+    _pageEntries = 0;
+    _segment = -1;
+    _segmentSequence = 0;
+
+    uint32_t* sequences = new uint32_t[_segmentCount];
+    for (int i = 0; i < _segmentCount; i++)
+    {
+        sequences[i] = 0; // Invalid/absent
+        char path[32];
+        getSegmentPath(i, path);
+        File file = SPIFFS.open(path, "r");
+        if (!file) continue;
+
+        FlashLogHeader header;
+        if ((file.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) == sizeof(header))
+            && (header.magic == FLASH_LOG_MAGIC)
+            && (header.version == FLASH_LOG_VERSION)
+            && (header.entrySize == _entrySize)
+            && (header.crc == crc32(reinterpret_cast<uint8_t*>(&header), sizeof(header) - sizeof(header.crc))))
+            sequences[i] = header.sequence;
+        file.close();
+    }
+
+    // Replay the segments in sequence order
+    bool lastSegmentComplete = true;
+    uint32_t lastSequence = 0;
+    while (true)
+    {
+        int nextSegment = -1;
+        for (int i = 0; i < _segmentCount; i++)
+        {
+            if ((sequences[i] > lastSequence) && ((nextSegment < 0) || (sequences[i] < sequences[nextSegment])))
+                nextSegment = i;
+        }
+        if (nextSegment < 0) break;
+
+        lastSequence = sequences[nextSegment];
+        lastSegmentComplete = replaySegment(nextSegment, onEntry);
+        _segment = nextSegment;
+        _segmentSequence = lastSequence;
+    }
+    delete[] sequences;
+
+    TRACE(F("Segment %d, sequence %u, %u bytes\n"), _segment, _segmentSequence, _segmentBytes);
+
+    // Don't append to a torn segment; the new pages would be unreachable.
+    if (!lastSegmentComplete)
+        return startSegment((_segment + 1) % _segmentCount, _segmentSequence + 1);
+
+    return true;
+}
+
+
+bool FlashLogStore::replaySegment(uint8_t segment, std::function<void(const uint8_t*)> onEntry)
+{
+    char path[32];
+    getSegmentPath(segment, path);
+    File file = SPIFFS.open(path, "r");
+    if (!file) return false;
+
+    _segmentBytes = sizeof(FlashLogHeader);
+    file.seek(_segmentBytes);
+
+    bool complete = true;
+    uint16_t count;
+    while (file.read(reinterpret_cast<uint8_t*>(&count), sizeof(count)) == sizeof(count))
+    {
+        size_t recordSize = 6 + count * _entrySize;
+        if ((count == 0) || (count > _entriesPerPage)
+            || (file.read(_page + 2, recordSize - 2) != recordSize - 2))
+        {
+            complete = false;
+            break;
+        }
+
+        memcpy(_page, &count, sizeof(count));
+        uint32_t crc;
+        memcpy(&crc, _page + recordSize - 4, sizeof(crc));
+        if (crc != crc32(_page, recordSize - 4))
+        {
+            complete = false;
+            break;
+        }
+
+        for (int i = 0; i < count; i++)
+            onEntry(_page + 2 + i * _entrySize);
+        _segmentBytes += recordSize;
+    }
+
+    if (_segmentBytes != file.size()) complete = false;
+    file.close();
+
+    if (!complete)
+        TRACE(F("Segment %s is torn at %u\n"), path, _segmentBytes);
+
+    return complete;
+}
+
+
+bool FlashLogStore::startSegment(uint8_t segment, uint32_t sequence)
+{
+    char path[32];
+    getSegmentPath(segment, path);
+
+    _segment = segment;
+    _segmentSequence = sequence;
+    _segmentBytes = _segmentSize; // Ensures a retry if creating the segment fails.
+
+    File file = SPIFFS.open(path, "w");
+    if (!file) return false;
+
+    FlashLogHeader header;
+    header.magic = FLASH_LOG_MAGIC;
+    header.version = FLASH_LOG_VERSION;
+    header.entrySize = _entrySize;
+    header.sequence = sequence;
+    header.crc = crc32(reinterpret_cast<uint8_t*>(&header), sizeof(header) - sizeof(header.crc));
+    size_t written = file.write(reinterpret_cast<uint8_t*>(&header), sizeof(header));
+    file.close();
+
+    if (written != sizeof(header)) return false;
+    _segmentBytes = sizeof(header);
+    return true;
+}
+
+
+bool FlashLogStore::add(const uint8_t* entry)
+{
+    memcpy(_page + 2 + _pageEntries * _entrySize, entry, _entrySize);
+    if (++_pageEntries < _entriesPerPage) return true;
+    return flush();
+}
+
+
+bool FlashLogStore::flush()
+{
+    if (_pageEntries == 0) return true;
+
+    size_t recordSize = 6 + _pageEntries * _entrySize;
+    if ((_segment < 0) || (_segmentBytes + recordSize > _segmentSize))
+    {
+        uint8_t nextSegment = (_segment < 0) ? 0 : (_segment + 1) % _segmentCount;
+        if (!startSegment(nextSegment, _segmentSequence + 1))
+        {
+            _pageEntries = 0;
+            return false;
+        }
+    }
+
+    memcpy(_page, &_pageEntries, sizeof(_pageEntries));
+    uint32_t crc = crc32(_page, recordSize - 4);
+    memcpy(_page + recordSize - 4, &crc, sizeof(crc));
+    _pageEntries = 0;
+
+    char path[32];
+    getSegmentPath(_segment, path);
+    File file = SPIFFS.open(path, "a");
+    if (!file)
+    {
+        _segmentBytes = _segmentSize;
+        return false;
+    }
+    size_t written = file.write(_page, recordSize);
+    file.close();
+
+    if (written != recordSize)
+    {
+        // Continue in a new segment
+        _segmentBytes = _segmentSize;
+        return false;
+    }
+
+    _segmentBytes += recordSize;
+    _pagesWritten++;
+    return true;
+}
+
+
+void FlashLogStore::clear()
+{
+    Tracer tracer(F("FlashLogStore::clear"), _name);
+
+    for (int i = 0; i < _segmentCount; i++)
+    {
+        char path[32];
+        getSegmentPath(i, path);
+        if (SPIFFS.exists(path))
+            SPIFFS.remove(path);
+    }
+
+    _pageEntries = 0;
+    _segment = -1;
+    _segmentSequence = 0;
+    _segmentBytes = 0;
+}
@@ -0,0 +1,129 @@
+#ifndef FLASHLOG_H
+#define FLASHLOG_H
+
+#include <stdint.h>
+#include <string.h>
+#include <functional>
+#include <Log.h>
+
+// Append-only store for fixed-size records on SPIFFS, used by FlashLog.
+// Records are buffered in RAM and written in pages of (at most) pageSize bytes, each with a CRC.
+// The data is spread over a ring of segment files ("/<name>.0" ... "/<name>.<n-1>");
+// when the current segment is full, the oldest segment is overwritten (rotated).
+// Each segment starts with a header containing a sequence number, so the order survives a reboot.
+// A page which was torn by a power loss or reset fails the CRC check and ends the replay;
+// appending then continues in a fresh segment.
+class FlashLogStore
+{
+    public:
+        // Constructor
+        FlashLogStore(const char* name, uint16_t entrySize, uint8_t segmentCount, uint32_t segmentSize, uint16_t pageSize = 512);
+
+        // Destructor
+        ~FlashLogStore();
+
+        // Reads all stored entries (oldest first) and prepares for appending.
+        // Must be invoked after the file system is mounted.
+        bool begin(std::function<void(const uint8_t*)> onEntry);
+
+        bool add(const uint8_t* entry);
+        bool flush();
+        void clear();
+
+        uint16_t entriesPerPage() const
+        {
+            return _entriesPerPage;
+        }
+
+        uint16_t bufferedEntries() const
+        {
+            return _pageEntries;
+        }
+
+        uint32_t pagesWritten() const
+        {
+            return _pagesWritten;
+        }
+
+        static uint16_t getEntriesPerPage(uint16_t entrySize, uint16_t pageSize = 512);
+
+        // Segment size (in bytes) which holds at least the given number of entries in full pages.
+        static uint32_t getSegmentSize(uint16_t entrySize, uint32_t entries, uint16_t pageSize = 512);
+
+    private:
+        char _name[24];
+        uint16_t _entrySize;
+        uint8_t _segmentCount;
+        uint32_t _segmentSize;
+        uint16_t _entriesPerPage;
+        uint8_t* _page;
+        uint16_t _pageEntries;
+        int _segment;
+        uint32_t _segmentSequence;
+        uint32_t _segmentBytes;
+        uint32_t _pagesWritten;
+
+        void getSegmentPath(uint8_t segment, char* path);
+        bool startSegment(uint8_t segment, uint32_t sequence);
+        bool replaySegment(uint8_t segment, std::function<void(const uint8_t*)> onEntry);
+};
+
+
+// A log (StaticLog or CompressedLog) which is persisted in a FlashLogStore.
+// The RAM log holds the most recent entries as before; after a reboot load() restores them from flash.
+// Entries are written to flash a page at a time, so at most one page is lost if the device resets unexpectedly.
+// Use flush() before an intentional reset.
+// The segments are sized to the RAM log: all but the segment being rotated hold (at least) size entries,
+// so the flash keeps no more than load() can restore.
+template <class T, class TLog = StaticLog<T>>
+class FlashLog : public TLog
+{
+    public:
+        // Constructor; segmentCount must be at least 2. The size and further arguments are passed to the RAM log.
+        template <class... TLogArgs>
+        FlashLog(const char* name, uint8_t segmentCount, uint16_t size, TLogArgs... logArgs)
+            : TLog(size, logArgs...),
+            _store(name, sizeof(T), segmentCount, FlashLogStore::getSegmentSize(sizeof(T), (size + segmentCount - 2) / (segmentCount - 1)))
+        {
+        }
+
+        // Restores the RAM log from flash. Must be invoked after the file system is mounted.
+        bool load()
+        {
+            TLog::clear();
+            return _store.begin(
+                [this](const uint8_t* data)
+                {
+                    T entry;
+                    memcpy(&entry, data, sizeof(T));
+                    TLog::add(&entry);
+                });
+        }
+
+        T* add(T* entry)
+        {
+            _store.add(reinterpret_cast<const uint8_t*>(entry));
+            return TLog::add(entry);
+        }
+
+        bool flush()
+        {
+            return _store.flush();
+        }
+
+        void clear()
+        {
+            TLog::clear();
+            _store.clear();
+        }
+
+        FlashLogStore& getStore()
+        {
+            return _store;
+        }
+
+    private:
+        FlashLogStore _store;
+};
+
+#endif
@@ -5,7 +5,7 @@
 
 // Constructor
 HtmlWriter::HtmlWriter(StringBuilder& output, PGM_P icon, PGM_P css, size_t maxBarLength)
-    : _output(output), _icon(FPSTR(icon)), _css(FPSTR(css))
+    : _output(output), _icon(icon), _css(css)
 {
     _titlePrefix = F("ESP");
     _maxBarLength = std::min(maxBarLength, (size_t)(sizeof(_strBuffer) - 1));
@@ -18,17 +18,27 @@ void HtmlWriter::setTitlePrefix(const String& prefix)
 }
 
 
-void HtmlWriter::writeHeader(const String& title, bool includeHomePageLink, bool includeHeading, uint16_t refreshInterval)
+void HtmlWriter::writeHeader(StringRef title, bool includeHomePageLink, bool includeHeading, uint16_t refreshInterval)
 {
     _output.clear();
     _output.println(F("<!DOCTYPE html>"));
     _output.println(F("<html lang=\"en-US\">"));
     
     _output.println(F("<head>"));
-    _output.printf(F("<title>%s - %s</title>\r\n"), _titlePrefix.c_str(), title.c_str());
-    _output.printf(F("<link rel=\"stylesheet\" type=\"text/css\" href=\"%s\">\r\n"), _css.c_str());
-    _output.printf(F("<link rel=\"icon\" sizes=\"128x128\" href=\"%s\">\r\n"), _icon.c_str());
-    _output.printf(F("<link rel=\"apple-touch-icon-precomposed\" sizes=\"128x128\" href=\"%s\">\r\n"), _icon.c_str());
+    _output.print(F("<title>"));
+    _output.print(_titlePrefix);
+    _output.print(F(" - "));
+    title.printTo(_output);
+    _output.println(F("</title>"));
+    _output.print(F("<link rel=\"stylesheet\" type=\"text/css\" href=\""));
+    _output.print(FPSTR(_css));
+    _output.println(F("\">"));
+    _output.print(F("<link rel=\"icon\" sizes=\"128x128\" href=\""));
+    _output.print(FPSTR(_icon));
+    _output.println(F("\">"));
+    _output.print(F("<link rel=\"apple-touch-icon-precomposed\" sizes=\"128x128\" href=\""));
+    _output.print(FPSTR(_icon));
+    _output.println(F("\">"));
     _output.println(F("<meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">"));
     if (refreshInterval > 0)
         _output.printf(F("<meta http-equiv=\"refresh\" content=\"%d\">\r\n") , refreshInterval);
@@ -36,13 +46,21 @@ void HtmlWriter::writeHeader(const String& title, bool includeHomePageLink, bool
     
     _output.println(F("<body>"));
     if (includeHomePageLink)
-        _output.printf(F("<a href=\"/\"><img src=\"%s\"></a>"), _icon.c_str());
+    {
+        _output.print(F("<a href=\"/\"><img src=\""));
+        _output.print(FPSTR(_icon));
+        _output.print(F("\"></a>"));
+    }
     if (includeHeading)
-        _output.printf(F("<h1>%s</h1>\r\n"), title.c_str());
+    {
+        _output.print(F("<h1>"));
+        title.printTo(_output);
+        _output.println(F("</h1>"));
+    }
 }
 
 
-void HtmlWriter::writeHeader(const String& title, const Navigation& navigation, uint16_t refreshInterval)
+void HtmlWriter::writeHeader(StringRef title, const Navigation& navigation, uint16_t refreshInterval)
 {
     writeHeader(title, false, false, refreshInterval);
 
@@ -52,28 +70,29 @@ void HtmlWriter::writeHeader(const String& title, const Navigation& navigation,
 
     _output.println(F("<header>"));
 
-    const char* heading = (title == F("Home")) ? _titlePrefix.c_str() : title.c_str();
-
-    _output.printf(
-        F("<a href=\"javascript:setNavWidth('%s')\" class=\"openbtn\">&#9776;</a>%s<a href=\"/\" class=\"logo\"></a>\r\n"),
-        navigation.width.c_str(),
-        heading
-        );
+    _output.print(F("<a href=\"javascript:setNavWidth('"));
+    _output.print(navigation.width);
+    _output.print(F("')\" class=\"openbtn\">&#9776;</a>"));
+    if (title.equals(F("Home")))
+        _output.print(_titlePrefix);
+    else
+        title.printTo(_output);
+    _output.println(F("<a href=\"/\" class=\"logo\"></a>"));
 
     _output.println(F("</header>"));
     _output.println(F("<nav id=\"nav\">"));
     _output.println(F("<a href=\"javascript:setNavWidth('0')\" class=\"closebtn\">&times;</a>"));
     for (const MenuItem& menuItem : navigation.menuItems)
     {
-        String urlPath = F("/");
+        _output.print(F("<a href=\"/"));
         if (menuItem.urlPath != nullptr)
-            urlPath += FPSTR(menuItem.urlPath);
-        _output.printf(F("<a href=\"%s\">"), urlPath.c_str());
+            _output.print(FPSTR(menuItem.urlPath));
+        _output.print(F("\">"));
         if (menuItem.icon != nullptr)
         {
-            char icon[32];
-            strncpy_P(icon, menuItem.icon, sizeof(icon));
-            _output.printf(F("<img class=\"icon\" src=\"%s\">"), icon);
+            _output.print(F("<img class=\"icon\" src=\""));
+            _output.print(FPSTR(menuItem.icon));
+            _output.print(F("\">"));
         }
         _output.print(FPSTR(menuItem.label));
         _output.println(F("</a>"));
@@ -89,7 +108,7 @@ void HtmlWriter::writeFooter()
 }
 
 
-void HtmlWriter::writeBar(float value, const String& cssClass, bool fill, bool useDiv, size_t maxBarLength)
+void HtmlWriter::writeBar(float value, StringRef cssClass, bool fill, bool useDiv, size_t maxBarLength)
 {
     char* bar = _strBuffer;
     maxBarLength = (maxBarLength == 0) ? _maxBarLength : std::min(maxBarLength, (size_t)(sizeof(_strBuffer) - 1));
@@ -102,7 +121,7 @@ void HtmlWriter::writeBar(float value, const String& cssClass, bool fill, bool u
 
     if (useDiv) writeDivStart();
 
-    _output.printf(F("<span class=\"%s\">%s</span>"), cssClass.c_str(), bar);
+    writeSpan(cssClass, bar);
 
     if (fill)
     {
@@ -121,7 +140,7 @@ void HtmlWriter::writeBar(float value, const String& cssClass, bool fill, bool u
 }
 
 
-void HtmlWriter::writeStackedBar(float value1, float value2, const String& cssClass1, const String& cssClass2, bool fill, bool useDiv)
+void HtmlWriter::writeStackedBar(float value1, float value2, StringRef cssClass1, StringRef cssClass2, bool fill, bool useDiv)
 {
     char* bar = _strBuffer;
     value1 = std::max(std::min(value1, 1.0f), 0.0f);
@@ -134,12 +153,12 @@ void HtmlWriter::writeStackedBar(float value1, float value2, const String& cssCl
     memset(bar, 'o', barLength1);
     bar[barLength1] = 0;
 
-    _output.printf(F("<span class=\"%s\">%s</span>"), cssClass1.c_str(), bar);
+    writeSpan(cssClass1, bar);
 
     memset(bar, 'o', barLength2);
     bar[barLength2] = 0;
 
-    _output.printf(F("<span class=\"%s\">%s</span>"), cssClass2.c_str(), bar);
+    writeSpan(cssClass2, bar);
 
     if (fill)
     {
@@ -158,7 +177,7 @@ void HtmlWriter::writeStackedBar(float value1, float value2, const String& cssCl
 }
 
 
-void HtmlWriter::writeGraphCell(float value, const String& barCssClass, bool fill, size_t maxBarLength)
+void HtmlWriter::writeGraphCell(float value, StringRef barCssClass, bool fill, size_t maxBarLength)
 {
     writeCellStart(F("graph"));
     writeBar(value, barCssClass, fill, false, maxBarLength);
@@ -166,7 +185,7 @@ void HtmlWriter::writeGraphCell(float value, const String& barCssClass, bool fil
 }
 
 
-void HtmlWriter::writeGraphCell(float value1, float value2, const String& barCssClass1, const String& barCssClass2, bool fill)
+void HtmlWriter::writeGraphCell(float value1, float value2, StringRef barCssClass1, StringRef barCssClass2, bool fill)
 {
     writeCellStart(F("graph"));
     writeStackedBar(value1, value2, barCssClass1, barCssClass2, fill, false);
@@ -174,12 +193,13 @@ void HtmlWriter::writeGraphCell(float value1, float value2, const String& barCss
 }
 
 
-void HtmlWriter::writeFormStart(const String& action, const String& cssClass)
+void HtmlWriter::writeFormStart(StringRef action, StringRef cssClass)
 {
-    _output.printf(
-        F("<form action=\"%s\" method=\"POST\" class=\"%s\">\r\n"),
-        action.c_str(),
-        cssClass.c_str());
+    _output.print(F("<form action=\""));
+    action.printTo(_output);
+    _output.print(F("\" method=\"POST\" class=\""));
+    cssClass.printTo(_output);
+    _output.println(F("\">"));
 }
 
 
@@ -195,45 +215,46 @@ void HtmlWriter::writeSubmitButton()
 }
 
 
-void HtmlWriter::writeSubmitButton(const String& label, const String& cssClass)
+void HtmlWriter::writeSubmitButton(StringRef label, StringRef cssClass)
 {
-    _output.printf(
-        F("<input type=\"submit\" value=\"%s\" class=\"%s\">\r\n"),
-        label.c_str(),
-        cssClass.c_str());
+    _output.print(F("<input type=\"submit\" value=\""));
+    label.printTo(_output);
+    _output.print(F("\" class=\""));
+    cssClass.printTo(_output);
+    _output.println(F("\">"));
 }
 
 
-void HtmlWriter::writeLabel(const String& label, const String& forId)
+void HtmlWriter::writeLabel(StringRef label, StringRef forId)
 {
-    _output.printf(
-        F("<label for=\"%s\">%s</label>"), 
-        forId.c_str(),
-        label.c_str());
+    _output.print(F("<label for=\""));
+    forId.printTo(_output);
+    _output.print(F("\">"));
+    label.printTo(_output);
+    _output.print(F("</label>"));
 }
 
 
 void HtmlWriter::writeTextBox(
-    const String& name,
-    const String& label,
-    const String& value,
+    StringRef name,
+    StringRef label,
+    StringRef value,
     uint16_t maxLength,
-    const String& type)
+    StringRef type)
 {
     writeLabel(label, name);
-    _output.printf(
-        F("<input type=\"%s\" id=\"%s\" name=\"%s\" value=\"%s\" maxlength=\"%d\">\r\n"), 
-        type.c_str(),
-        name.c_str(),
-        name.c_str(),
-        value.c_str(),
-        maxLength);
+    _output.print(F("<input type=\""));
+    type.printTo(_output);
+    writeIdAndName(name);
+    _output.print(F(" value=\""));
+    value.printTo(_output);
+    _output.printf(F("\" maxlength=\"%d\">\r\n"), maxLength);
 }
 
 
 void HtmlWriter::writeNumberBox(
-    const String& name,
-    const String& label,
+    StringRef name,
+    StringRef label,
     float value,
     float minValue,
     float maxValue,
@@ -244,15 +265,15 @@ void HtmlWriter::writeNumberBox(
     int length = snprintf(
         _strBuffer,
         sizeof(_strBuffer) - 1,
-        "<input type=\"number\" id=\"%%s\" name=\"%%s\" value=\"%%0.%df\" min=\"%%0.%df\" max=\"%%0.%df\" step=\"%%0.%df\">\r\n",
+        " value=\"%%0.%df\" min=\"%%0.%df\" max=\"%%0.%df\" step=\"%%0.%df\">\r\n",
         decimals, decimals, decimals, decimals);
     _strBuffer[length] = 0;
 
     writeLabel(label, name);
+    _output.print(F("<input type=\"number"));
+    writeIdAndName(name);
     _output.printf(
         FPSTR(_strBuffer), 
-        name.c_str(),
-        name.c_str(),
         value,
         minValue,
         maxValue,
@@ -260,20 +281,18 @@ void HtmlWriter::writeNumberBox(
 }
 
 
-void HtmlWriter::writeCheckbox(const String& name, const String& label, bool value)
+void HtmlWriter::writeCheckbox(StringRef name, StringRef label, bool value)
 {
     const char* checked = value ? "checked" : "";
 
     writeLabel(label, name);
-    _output.printf(
-        F("<input type=\"checkbox\" id=\"%s\" name=\"%s\" value=\"true\" %s>\r\n"), 
-        name.c_str(),
-        name.c_str(),
-        checked);
+    _output.print(F("<input type=\"checkbox"));
+    writeIdAndName(name);
+    _output.printf(F(" value=\"true\" %s>\r\n"), checked);
 }
 
 
-void HtmlWriter::writeRadioButtons(const String& name, const String& label, const char** values, int numValues, int index)
+void HtmlWriter::writeRadioButtons(StringRef name, StringRef label, const char** values, int numValues, int index)
 {
     writeLabel(label, name);
     writeDivStart();
@@ -283,16 +302,15 @@ void HtmlWriter::writeRadioButtons(const String& name, const String& label, cons
         const char* checked = (i == index) ? "checked" : "";
 
         writeDivStart();
-        _output.printf(
-            F("<input type=\"radio\" id=\"%s%d\" name=\"%s\" value=\"%d\" %s><label for=\"%s%d\">%s</label>"), 
-            name.c_str(),
-            i,
-            name.c_str(),
-            i,
-            checked,
-            name.c_str(),
-            i,
-            values[i]);
+        _output.print(F("<input type=\"radio\" id=\""));
+        name.printTo(_output);
+        _output.print(i);
+        _output.print(F("\" name=\""));
+        name.printTo(_output);
+        _output.printf(F("\" value=\"%d\" %s><label for=\""), i, checked);
+        name.printTo(_output);
+        _output.print(i);
+        _output.printf(F("\">%s</label>"), values[i]);
         writeDivEnd();
     }
 
@@ -300,39 +318,40 @@ void HtmlWriter::writeRadioButtons(const String& name, const String& label, cons
 }
 
 
-void HtmlWriter::writeSlider(const String& name, const String& label, const String& unitOfMeasure, int value, int minValue, int maxValue, int denominator)
+void HtmlWriter::writeSlider(StringRef name, StringRef label, StringRef unitOfMeasure, int value, int minValue, int maxValue, int denominator)
 {
     writeLabel(label, name);
     writeDivStart();
 
+    _output.print(F("<div><input name=\""));
+    name.printTo(_output);
     _output.printf(
-        F("<div><input name=\"%s\" type=\"range\" min=\"%d\" max=\"%d\" value=\"%d\"></div>"),
-        name.c_str(),
+        F("\" type=\"range\" min=\"%d\" max=\"%d\" value=\"%d\"></div>"),
         minValue,
         maxValue,
         value
         );
     
     if (denominator == 1)
-        _output.printf(F("<div>%d %s</div></td></tr>\r\n"), value, unitOfMeasure.c_str());
+        _output.printf(F("<div>%d "), value);
     else
-        _output.printf(F("<div>%0.3f %s</div></td></tr>\r\n"), float(value) / denominator, unitOfMeasure.c_str());
+        _output.printf(F("<div>%0.3f "), float(value) / denominator);
+    unitOfMeasure.printTo(_output);
+    _output.println(F("</div></td></tr>"));
 
     writeDivEnd();
 }
 
 
-void HtmlWriter::writeHeading(const String& title, int level)
+void HtmlWriter::writeHeading(StringRef title, int level)
 {
-    _output.printf(
-        F("<h%d>%s</h%d>\r\n"),
-        level,
-        title.c_str(),
-        level);
+    _output.printf(F("<h%d>"), level);
+    title.printTo(_output);
+    _output.printf(F("</h%d>\r\n"), level);
 }
 
 
-void HtmlWriter::writeSectionStart(const String& title)
+void HtmlWriter::writeSectionStart(StringRef title)
 {
     _output.println(F("<section>"));
     writeHeading(title, 1);
@@ -345,12 +364,16 @@ void HtmlWriter::writeSectionEnd()
 }
 
 
-void HtmlWriter::writeDivStart(const String& cssClass)
+void HtmlWriter::writeDivStart(StringRef cssClass)
 {
-    if (cssClass.length() == 0)
+    if (cssClass.isEmpty())
         _output.println(F("<div>"));
     else
-        _output.printf(F("<div class=\"%s\">\r\n"), cssClass.c_str());
+    {
+        _output.print(F("<div class=\""));
+        cssClass.printTo(_output);
+        _output.println(F("\">"));
+    }
 }
 
 
@@ -360,12 +383,11 @@ void HtmlWriter::writeDivEnd()
 }
 
 
-void HtmlWriter::writeDiv(const String& format, ...)
+void HtmlWriter::writeDiv(StringRef format, ...)
 {
     va_list args;
     va_start(args, format);
-    int length = vsnprintf(_strBuffer, sizeof(_strBuffer) - 1, format.c_str(), args);
-    _strBuffer[length] = 0;
+    vsnprintf_P(_strBuffer, sizeof(_strBuffer), (PGM_P) format.format(), args);
     va_end(args);
 
     writeDivStart();
@@ -374,12 +396,16 @@ void HtmlWriter::writeDiv(const String& format, ...)
 }
 
 
-void HtmlWriter::writePreStart(const String& cssClass)
+void HtmlWriter::writePreStart(StringRef cssClass)
 {
-    if (cssClass.length() == 0)
+    if (cssClass.isEmpty())
         _output.println(F("<pre>"));
     else
-        _output.printf(F("<pre class=\"%s\">\r\n"), cssClass.c_str());
+    {
+        _output.print(F("<pre class=\""));
+        cssClass.printTo(_output);
+        _output.println(F("\">"));
+    }
 }
 
 
@@ -413,11 +439,11 @@ void HtmlWriter::writeRowEnd()
 }
 
 
-void HtmlWriter::writeCellStart(const String& cssClass)
+void HtmlWriter::writeCellStart(StringRef cssClass)
 {
-    _output.printf(
-        F("<td class=\"%s\">"),
-        cssClass.c_str());
+    _output.print(F("<td class=\""));
+    cssClass.printTo(_output);
+    _output.print(F("\">"));
 }
 
 
@@ -427,23 +453,22 @@ void HtmlWriter::writeCellEnd()
 }
 
 
-void HtmlWriter::writeHeaderCell(const String& value, int colspan, int rowspan)
+void HtmlWriter::writeHeaderCell(StringRef value, int colspan, int rowspan)
 {
     _output.print(F("<th"));
     if (colspan > 0) _output.printf(F(" colspan=\"%d\""), colspan);
     if (rowspan > 0) _output.printf(F(" rowspan=\"%d\""), rowspan);
     _output.print(F(">"));
-    _output.print(value);
+    value.printTo(_output);
     _output.print(F("</th>"));
 }
 
 
-void HtmlWriter::writeCell(const String& format, ...)
+void HtmlWriter::writeCell(StringRef format, ...)
 {
     va_list args;
     va_start(args, format);
-    int length = vsnprintf(_strBuffer, sizeof(_strBuffer) - 1, format.c_str(), args);
-    _strBuffer[length] = 0;
+    vsnprintf_P(_strBuffer, sizeof(_strBuffer), (PGM_P) format.format(), args);
     va_end(args);
 
     return writeCell(_strBuffer);
@@ -484,18 +509,18 @@ void HtmlWriter::writeCell(float value, const __FlashStringHelper* format)
 }
 
 
-void HtmlWriter::writeRow(const String& name, const String& format, ...)
+void HtmlWriter::writeRow(StringRef name, StringRef format, ...)
 {
     va_list args;
     va_start(args, format);
-    int length = vsnprintf(_strBuffer, sizeof(_strBuffer) - 1, format.c_str(), args);
-    _strBuffer[length] = 0;
+    vsnprintf_P(_strBuffer, sizeof(_strBuffer), (PGM_P) format.format(), args);
     va_end(args);
 
-    _output.printf(
-        F("<tr><th>%s</th><td>%s</td></tr>\r\n"),
-        name.c_str(),
-        _strBuffer);
+    _output.print(F("<tr><th>"));
+    name.printTo(_output);
+    _output.print(F("</th><td>"));
+    _output.print(_strBuffer);
+    _output.println(F("</td></tr>"));
 }
 
 
@@ -513,12 +538,11 @@ void HtmlWriter::writePager(int totalPages, int currentPage)
 }
 
 
-void HtmlWriter::writeParagraph(const String& format, ...)
+void HtmlWriter::writeParagraph(StringRef format, ...)
 {
     va_list args;
     va_start(args, format);
-    int length = vsnprintf(_strBuffer, sizeof(_strBuffer) - 1, format.c_str(), args);
-    _strBuffer[length] = 0;
+    vsnprintf_P(_strBuffer, sizeof(_strBuffer), (PGM_P) format.format(), args);
     va_end(args);
 
     _output.print(F("<p>"));
@@ -527,30 +551,56 @@ void HtmlWriter::writeParagraph(const String& format, ...)
 }
 
 
-void HtmlWriter::writeLink(const String& href, const String& label, const String& cssClass)
+void HtmlWriter::writeLink(StringRef href, StringRef label, StringRef cssClass)
 {
-    _output.printf(
-        F("<a class=\"%s\" href=\"%s\">%s</a>"),
-        cssClass.c_str(),
-        href.c_str(),
-        label.c_str());
+    _output.print(F("<a class=\""));
+    cssClass.printTo(_output);
+    _output.print(F("\" href=\""));
+    href.printTo(_output);
+    _output.print(F("\">"));
+    label.printTo(_output);
+    _output.print(F("</a>"));
 }
 
 
 void HtmlWriter::writeActionLink(
-    const String& action,
-    const String& label,
+    StringRef action,
+    StringRef label,
     time_t currentTime,
-    const String& cssClass,
-    const String& icon)
-{
-    _output.printf(
-        F("<a class=\"%s\" href=\"?%s=%u\">"),
-        cssClass.c_str(),
-        action.c_str(),
-        currentTime);
-    if (icon.length() != 0)
-        _output.printf(F("<img class=\"icon\" src=\"%s\">"), icon.c_str());
-    _output.print(label);
+    StringRef cssClass,
+    StringRef icon)
+{
+    _output.print(F("<a class=\""));
+    cssClass.printTo(_output);
+    _output.print(F("\" href=\"?"));
+    action.printTo(_output);
+    _output.printf(F("=%u\">"), currentTime);
+    if (!icon.isEmpty())
+    {
+        _output.print(F("<img class=\"icon\" src=\""));
+        icon.printTo(_output);
+        _output.print(F("\">"));
+    }
+    label.printTo(_output);
     _output.print(F("</a>"));
+}
+
+
+void HtmlWriter::writeSpan(StringRef cssClass, const char* content)
+{
+    _output.print(F("<span class=\""));
+    cssClass.printTo(_output);
+    _output.print(F("\">"));
+    _output.print(content);
+    _output.print(F("</span>"));
+}
+
+
+void HtmlWriter::writeIdAndName(StringRef name)
+{
+    _output.print(F("\" id=\""));
+    name.printTo(_output);
+    _output.print(F("\" name=\""));
+    name.printTo(_output);
+    _output.print(F("\""));
 }
\ No newline at end of file
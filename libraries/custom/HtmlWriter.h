@@ -2,6 +2,7 @@
 #define HTMLWRITER_H
 
 #include <StringBuilder.h>
+#include <StringRef.h>
 #include <Navigation.h>
 
 class HtmlWriter
@@ -12,68 +13,71 @@ class HtmlWriter
 
         void setTitlePrefix(const String& prefix);
 
-        void writeHeader(const String& title, bool includeHomePageLink, bool includeHeading, uint16_t refreshInterval = 0);
-        void writeHeader(const String& title, const Navigation& navigation, uint16_t refreshInterval = 0);
+        void writeHeader(StringRef title, bool includeHomePageLink, bool includeHeading, uint16_t refreshInterval = 0);
+        void writeHeader(StringRef title, const Navigation& navigation, uint16_t refreshInterval = 0);
         void writeFooter();
 
-        void writeBar(float value, const String& cssClass, bool fill, bool useDiv = true, size_t maxBarLength = 0);
-        void writeStackedBar(float value1, float value2, const String& cssClass1, const String& cssClass2, bool fill, bool useDiv = true);
-        void writeGraphCell(float value, const String& barCssClass, bool fill, size_t maxBarLength = 0);
-        void writeGraphCell(float value1, float value2, const String& barCssClass1, const String& barCssClass2, bool fill);
+        void writeBar(float value, StringRef cssClass, bool fill, bool useDiv = true, size_t maxBarLength = 0);
+        void writeStackedBar(float value1, float value2, StringRef cssClass1, StringRef cssClass2, bool fill, bool useDiv = true);
+        void writeGraphCell(float value, StringRef barCssClass, bool fill, size_t maxBarLength = 0);
+        void writeGraphCell(float value1, float value2, StringRef barCssClass1, StringRef barCssClass2, bool fill);
 
-        void writeFormStart(const String& action, const String& cssClass = String());
+        void writeFormStart(StringRef action, StringRef cssClass = StringRef());
         void writeFormEnd();
         void writeSubmitButton();
-        void writeSubmitButton(const String& label, const String& cssClass = String("submit"));
-        void writeLabel(const String& label, const String& forId);
-        void writeTextBox(const String& name, const String& label, const String& value, uint16_t maxLength, const String& type = String("text"));
-        void writeNumberBox(const String& name, const String& label, float value, float minValue, float maxValue, int decimals = 0);
-        void writeCheckbox(const String& name, const String& label, bool value);
-        void writeRadioButtons(const String& name, const String& label, const char** values, int numValues, int index);
-        void writeSlider(const String& name, const String& label, const String& unitOfMeasure, int value, int minValue, int maxValue, int denominator = 1);
+        void writeSubmitButton(StringRef label, StringRef cssClass = "submit");
+        void writeLabel(StringRef label, StringRef forId);
+        void writeTextBox(StringRef name, StringRef label, StringRef value, uint16_t maxLength, StringRef type = "text");
+        void writeNumberBox(StringRef name, StringRef label, float value, float minValue, float maxValue, int decimals = 0);
+        void writeCheckbox(StringRef name, StringRef label, bool value);
+        void writeRadioButtons(StringRef name, StringRef label, const char** values, int numValues, int index);
+        void writeSlider(StringRef name, StringRef label, StringRef unitOfMeasure, int value, int minValue, int maxValue, int denominator = 1);
 
-        void writeHeading(const String& title, int level = 1);
-        void writeSectionStart(const String& title);
+        void writeHeading(StringRef title, int level = 1);
+        void writeSectionStart(StringRef title);
         void writeSectionEnd();
-        void writeDivStart(const String& cssClass = String());
+        void writeDivStart(StringRef cssClass = StringRef());
         void writeDivEnd();
-        void writeDiv(const String& format, ...);
-        void writePreStart(const String& cssClass = String());
+        void writeDiv(StringRef format, ...);
+        void writePreStart(StringRef cssClass = StringRef());
         void writePreEnd();
 
         void writeTableStart();
         void writeTableEnd();
         void writeRowStart();
         void writeRowEnd();
-        void writeCellStart(const String& cssClass);
+        void writeCellStart(StringRef cssClass);
         void writeCellEnd();
-        void writeHeaderCell(const String& value, int colspan = 0, int rowspan = 0);
-        void writeCell(const String& format, ...);
+        void writeHeaderCell(StringRef value, int colspan = 0, int rowspan = 0);
+        void writeCell(StringRef format, ...);
         void writeCell(const char* value);
         void writeCell(int value);
         void writeCell(uint32_t value);
         void writeCell(float value, const __FlashStringHelper* format = nullptr);
-        void writeRow(const String& name, const String& format, ...);
+        void writeRow(StringRef name, StringRef format, ...);
 
         void writePager(int totalPages, int currentPage);
 
-        void writeParagraph(const String& format, ...);
+        void writeParagraph(StringRef format, ...);
 
-        void writeLink(const String& href, const String& label, const String& cssClass = String());
+        void writeLink(StringRef href, StringRef label, StringRef cssClass = StringRef());
         void writeActionLink(
-            const String& action,
-            const String& label,
+            StringRef action,
+            StringRef label,
             time_t currentTime,
-            const String& cssClass = String("actionLink"),
-            const String& icon = String());
+            StringRef cssClass = "actionLink",
+            StringRef icon = StringRef());
 
     private:
         StringBuilder& _output;
-        String _icon;
-        String _css;
+        PGM_P _icon;
+        PGM_P _css;
         String _titlePrefix;
         char _strBuffer[256];
         size_t _maxBarLength;
+
+        void writeSpan(StringRef cssClass, const char* content);
+        void writeIdAndName(StringRef name);
 };
 
 #endif
\ No newline at end of file
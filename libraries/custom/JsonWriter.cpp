@@ -0,0 +1,208 @@
+#include <Arduino.h>
+#include <JsonWriter.h>
+#include <math.h>
+
+static const uint32_t PowersOf10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000 };
+
+// Constructor
+JsonWriter::JsonWriter(StringBuilder& output)
+    : _output(output)
+{
+    _hasElements = 0;
+    _depth = 0;
+    _afterName = false;
+}
+
+
+void JsonWriter::beginObject()
+{
+    writeSeparator();
+    _output.write('{');
+    _hasElements &= ~(1UL << ++_depth);
+}
+
+
+void JsonWriter::endObject()
+{
+    _depth--;
+    _output.write('}');
+}
+
+
+void JsonWriter::beginArray()
+{
+    writeSeparator();
+    _output.write('[');
+    _hasElements &= ~(1UL << ++_depth);
+}
+
+
+void JsonWriter::endArray()
+{
+    _depth--;
+    _output.write(']');
+}
+
+
+void JsonWriter::writeName(StringRef name)
+{
+    writeSeparator();
+    writeString(name.c_str());
+    _output.write(':');
+    _afterName = true;
+}
+
+
+void JsonWriter::writeValue(const char* value)
+{
+    writeSeparator();
+    writeString(value);
+}
+
+
+void JsonWriter::writeValue(const __FlashStringHelper* value)
+{
+    writeSeparator();
+    writeString(reinterpret_cast<PGM_P>(value));
+}
+
+
+void JsonWriter::writeValue(const String& value)
+{
+    writeSeparator();
+    writeString(value.c_str());
+}
+
+
+void JsonWriter::writeValue(float value, int decimals)
+{
+    writeSeparator();
+
+    if (isnan(value) || isinf(value))
+    {
+        _output.print(F("null"));
+        return;
+    }
+
+    decimals = std::max(0, std::min(decimals, 6));
+    float scaled = fabsf(value) * PowersOf10[decimals] + 0.5F;
+    if (scaled >= 4.0E9F)
+    {
+        // Doesn't fit in fixed-point
+        _output.printf(F("%0.*f"), decimals, value);
+        return;
+    }
+
+    uint32_t fixedPoint = uint32_t(scaled);
+    if ((value < 0) && (fixedPoint != 0)) _output.write('-');
+    writeUnsigned(fixedPoint / PowersOf10[decimals]);
+    if (decimals == 0) return;
+
+    char fraction[8];
+    uint32_t remainder = fixedPoint % PowersOf10[decimals];
+    fraction[0] = '.';
+    for (int i = decimals; i > 0; i--)
+    {
+        fraction[i] = '0' + remainder % 10;
+        remainder /= 10;
+    }
+    _output.write(reinterpret_cast<const uint8_t*>(fraction), decimals + 1);
+}
+
+
+void JsonWriter::writeValue(int32_t value)
+{
+    writeSeparator();
+    if (value < 0) _output.write('-');
+    writeUnsigned((value < 0) ? -uint32_t(value) : uint32_t(value));
+}
+
+
+void JsonWriter::writeValue(uint32_t value)
+{
+    writeSeparator();
+    writeUnsigned(value);
+}
+
+
+void JsonWriter::writeValue(bool value)
+{
+    writeSeparator();
+    _output.print(value ? F("true") : F("false"));
+}
+
+
+void JsonWriter::writeNull()
+{
+    writeSeparator();
+    _output.print(F("null"));
+}
+
+
+void JsonWriter::writeSeparator()
+{
+    if (_afterName)
+    {
+        _afterName = false;
+        return;
+    }
+    if (_depth == 0) return; // Top-level value
+
+    uint32_t mask = 1UL << _depth;
+    if (_hasElements & mask)
+        _output.write(',');
+    else
+        _hasElements |= mask;
+}
+
+
+void JsonWriter::writeString(PGM_P value)
+{
+    // Characters are copied (and escaped) in batches to limit the number of writes.
+    char buffer[32];
+    size_t length = 0;
+    buffer[length++] = '"';
+
+    char c;
+    while ((c = pgm_read_byte(value++)) != 0)
+    {
+        if (length > sizeof(buffer) - 7)
+        {
+            _output.write(reinterpret_cast<const uint8_t*>(buffer), length);
+            length = 0;
+        }
+
+        if (c == '"' || c == '\\')
+        {
+            buffer[length++] = '\\';
+            buffer[length++] = c;
+        }
+        else if (uint8_t(c) < 0x20)
+        {
+            static const char hexDigits[] PROGMEM = "0123456789abcdef";
+            memcpy_P(buffer + length, PSTR("\\u00"), 4);
+            buffer[length + 4] = pgm_read_byte(hexDigits + (c >> 4));
+            buffer[length + 5] = pgm_read_byte(hexDigits + (c & 0xF));
+            length += 6;
+        }
+        else
+            buffer[length++] = c;
+    }
+
+    buffer[length++] = '"';
+    _output.write(reinterpret_cast<const uint8_t*>(buffer), length);
+}
+
+
+void JsonWriter::writeUnsigned(uint32_t value)
+{
+    char digits[10];
+    int i = sizeof(digits);
+    do
+    {
+        digits[--i] = '0' + value % 10;
+        value /= 10;
+    }
+    while (value != 0);
+    _output.write(reinterpret_cast<const uint8_t*>(digits + i), sizeof(digits) - i);
+}
@@ -0,0 +1,58 @@
+#ifndef JSONWRITER_H
+#define JSONWRITER_H
+
+#include <StringBuilder.h>
+#include <StringRef.h>
+
+// Streaming JSON writer; writes directly to the output (e.g. a ChunkedResponse) without building a DOM.
+// Separators between members/elements are inserted automatically; strings are escaped while writing.
+// Floats are written as fixed-point with the given number of decimals; NaN and infinity are written as null.
+// Objects and arrays can be nested up to 31 levels deep.
+class JsonWriter
+{
+    public:
+        // Constructor
+        JsonWriter(StringBuilder& output);
+
+        void beginObject();
+        void endObject();
+        void beginArray();
+        void endArray();
+
+        // Writes a member name; must be followed by a value, object or array.
+        void writeName(StringRef name);
+
+        void writeValue(const char* value);
+        void writeValue(const __FlashStringHelper* value);
+        void writeValue(const String& value);
+        void writeValue(float value, int decimals = 1);
+        void writeValue(int32_t value);
+        void writeValue(uint32_t value);
+        void writeValue(bool value);
+        void writeNull();
+
+        template<typename T> void writeMember(StringRef name, const T& value)
+        {
+            writeName(name);
+            writeValue(value);
+        }
+
+        void writeMember(StringRef name, float value, int decimals)
+        {
+            writeName(name);
+            writeValue(value, decimals);
+        }
+
+    private:
+        StringBuilder& _output;
+        uint32_t _hasElements; // Bit per nesting level
+        uint8_t _depth;
+        bool _afterName;
+
+        void writeSeparator();
+        void writeString(PGM_P value);
+        void writeEscaped(char c);
+        void writeUnsigned(uint32_t value);
+};
+
+#endif
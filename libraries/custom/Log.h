@@ -2,33 +2,240 @@
 #define LOG_H
 
 #include <stdint.h>
+#include <string.h>
+
+// Iterator over (a range of) log entries.
+// Holds its own position, so multiple iterators can walk the same log at the same time
+// (e.g. an FTP sync and an HTTP request) without affecting each other or getFirstEntry/getNextEntry.
+// Dereferencing yields a pointer to the entry, like getFirstEntry/getNextEntry do.
+template <class TLog, class TEntryPtr, bool Reverse = false>
+class LogIterator
+{
+    public:
+        LogIterator(const TLog& log, uint16_t index, uint16_t remaining)
+            : _log(log), _index(index), _remaining(remaining) {}
 
-template <class T>
-class Log
+        inline TEntryPtr operator*() const
+        {
+            return _log.getEntryAt(_index);
+        }
+
+        inline LogIterator& operator++()
+        {
+            _index = Reverse ? _log.prevIndex(_index) : _log.nextIndex(_index);
+            _remaining--;
+            return *this;
+        }
+
+        inline bool operator==(const LogIterator& other) const
+        {
+            return _remaining == other._remaining;
+        }
+
+        inline bool operator!=(const LogIterator& other) const
+        {
+            return _remaining != other._remaining;
+        }
+
+    private:
+        const TLog& _log;
+        uint16_t _index;
+        uint16_t _remaining;
+};
+
+
+// A range of consecutive log entries; can be used in range-based for loops.
+// The range is fixed when it is created; entries added afterwards are not included.
+template <class TLog, class TEntryPtr, bool Reverse = false>
+class LogRange
 {
     public:
-        // Constructor 
-        Log(uint16_t size)
-            : _size(size)
+        typedef LogIterator<TLog, TEntryPtr, Reverse> Iterator;
+
+        LogRange(const TLog& log, uint16_t first, uint16_t count)
+            : _log(log), _first(first), _count(count) {}
+
+        inline Iterator begin() const
+        {
+            return Iterator(_log, _first, _count);
+        }
+
+        inline Iterator end() const
+        {
+            return Iterator(_log, _first, 0);
+        }
+
+        inline uint16_t count() const
+        {
+            return _count;
+        }
+
+    private:
+        const TLog& _log;
+        uint16_t _first;
+        uint16_t _count;
+};
+
+
+// Ring buffer index administration and range accessors shared by the log types below.
+// Stepping uses compare-and-wrap instead of modulo, so no division is needed for any log size.
+template <class TLog, class TEntryPtr>
+class LogBase
+{
+    public:
+        typedef LogRange<TLog, TEntryPtr> Range;
+        typedef LogRange<TLog, TEntryPtr, true> ReverseRange;
+
+        uint16_t count() const
+        {
+            return _count;
+        }
+
+        // Number of entries added since the log was created or cleared.
+        // Can be used as cursor for getEntriesSince; it only increases (until the log is cleared).
+        uint32_t sequence() const
+        {
+            return _sequence;
+        }
+
+        // Incremented each time the log is cleared, so a cursor can be checked against the log it was obtained from.
+        uint16_t generation() const
+        {
+            return _generation;
+        }
+
+        typename Range::Iterator begin() const
+        {
+            return getRange().begin();
+        }
+
+        typename Range::Iterator end() const
+        {
+            return getRange().end();
+        }
+
+        // All entries, oldest first
+        Range getRange() const
+        {
+            return Range(log(), _start, _count);
+        }
+
+        // Max. count entries, starting at the offset-th entry (0 = oldest)
+        Range getRange(uint16_t offset, uint16_t count) const
+        {
+            if (offset > _count) offset = _count;
+            if (count > _count - offset) count = _count - offset;
+            return Range(log(), indexFromStart(offset), count);
+        }
+
+        // The last n entries, oldest first
+        Range getEntriesFromEnd(uint16_t n) const
+        {
+            if (n > _count) n = _count;
+            return Range(log(), indexFromEnd(n), n);
+        }
+
+        // Entries added after sequence() returned the given cursor, oldest first.
+        // The cursor must be from the current generation (see LogCursor.h); if it is newer than the log, all entries are returned.
+        Range getEntriesSince(uint32_t cursor) const
+        {
+            uint32_t newEntries = (cursor > _sequence) ? _count : _sequence - cursor;
+            return getEntriesFromEnd((newEntries > _count) ? _count : newEntries);
+        }
+
+        // All entries, newest first
+        ReverseRange getReverseRange() const
+        {
+            return ReverseRange(log(), indexFromEnd(1), _count);
+        }
+
+        inline uint16_t nextIndex(uint16_t index) const
+        {
+            return (++index == _size) ? 0 : index;
+        }
+
+        inline uint16_t prevIndex(uint16_t index) const
+        {
+            return (index == 0) ? _size - 1 : index - 1;
+        }
+
+    protected:
+        uint16_t _size;
+        uint16_t _start;
+        uint16_t _end;
+        uint16_t _count;
+        uint16_t _iterator;
+        uint32_t _sequence;
+        uint16_t _generation;
+
+        LogBase(uint16_t size)
+            : _size(size), _generation(0)
+        {
+            reset();
+        }
+
+        inline const TLog& log() const
+        {
+            return static_cast<const TLog&>(*this);
+        }
+
+        void reset()
         {
-            _entriesPtr = new T*[size];
-            memset(_entriesPtr, 0, size * 4);
             _start = 0;
             _end = 0;
             _count = 0;
             _iterator = 0;
+            _sequence = 0;
+            _generation++;
         }
 
-        // Destructor 
-        ~Log()
+        // Advances _end for a new entry and drops the oldest entry if the log is full.
+        // Returns the index for the new entry.
+        uint16_t advance()
         {
-            clear();
-            delete[] _entriesPtr;
+            if ((_end == _start) && (_count != 0))
+                _start = nextIndex(_start);
+            else
+                _count++;
+
+            uint16_t index = _end;
+            _end = nextIndex(_end);
+            _sequence++;
+            return index;
         }
 
-        uint16_t count()
+        // Index of the n-th entry from the start (0 = oldest)
+        inline uint16_t indexFromStart(uint16_t n) const
         {
-            return _count;
+            uint16_t index = _start + n;
+            return (index >= _size) ? index - _size : index;
+        }
+
+        // Index of the n-th entry from the end (1 = newest)
+        inline uint16_t indexFromEnd(uint16_t n) const
+        {
+            return (_end < n) ? _end + _size - n : _end - n;
+        }
+};
+
+
+template <class T>
+class Log : public LogBase<Log<T>, T*>
+{
+    public:
+        // Constructor
+        Log(uint16_t size)
+            : LogBase<Log<T>, T*>(size)
+        {
+            _entriesPtr = new T*[size];
+            memset(_entriesPtr, 0, size * sizeof(T*));
+        }
+
+        // Destructor
+        ~Log()
+        {
+            clear();
+            delete[] _entriesPtr;
         }
 
         void clear()
@@ -42,10 +249,7 @@ class Log
                 _entriesPtr[i] = nullptr;
             }
 
-            _start = 0;
-            _end = 0;
-            _count = 0;
-            _iterator = 0;
+            reset();
         }
 
         void add(T* entry)
@@ -54,14 +258,9 @@ class Log
             {
                 // Log is full; drop oldest entry.
                 delete _entriesPtr[_start];
-                _start = (_start + 1) % _size;
             }
-            else
-                _count++;
-                
-            _entriesPtr[_end] = entry;
 
-            _end = (_end + 1) % _size;
+            _entriesPtr[advance()] = entry;
         }
 
         T* getFirstEntry()
@@ -74,83 +273,75 @@ class Log
         {
             if ((n == 0) || (n > _count))
                 return nullptr;
-            
-            if (_end < n)
-                _iterator = _end + _size - n;
-            else
-                _iterator = _end - n;
 
+            _iterator = indexFromEnd(n);
             return _entriesPtr[_iterator];
         }
 
         T* getNextEntry()
         {
-            _iterator = (_iterator + 1) % _size;
+            _iterator = this->nextIndex(_iterator);
             if (_iterator == _end)
                 return nullptr;
-            else 
+            else
                 return _entriesPtr[_iterator];
         }
 
+        inline T* getEntryAt(uint16_t index) const
+        {
+            return _entriesPtr[index];
+        }
+
     protected:
-        uint16_t _size;
-        uint16_t _start;
-        uint16_t _end;
-        uint16_t _count;
-        uint16_t _iterator; 
+        typedef LogBase<Log<T>, T*> Base;
+        using Base::_size;
+        using Base::_start;
+        using Base::_end;
+        using Base::_count;
+        using Base::_iterator;
+        using Base::reset;
+        using Base::advance;
+        using Base::indexFromEnd;
+
         T** _entriesPtr;
 };
 
 
 template <class T>
-class StaticLog
+class StaticLog : public LogBase<StaticLog<T>, T*>
 {
     public:
-        // Constructor 
+        // Constructor
         StaticLog(uint16_t size)
+            : LogBase<StaticLog<T>, T*>(size)
         {
-            _size = size;
             _entries = new T[size];
-            _start = 0;
-            _end = 0;
-            _count = 0;
-            _iterator = 0;
         }
 
-        // Destructor 
+        // Destructor
         ~StaticLog()
         {
             delete[] _entries;
         }
 
-        uint16_t count()
-        {
-            return _count;
-        }
-
         void clear()
         {
-            _start = 0;
-            _end = 0;
-            _count = 0;
-            _iterator = 0;
+            reset();
         }
 
         T* add(T* entry)
         {
-            if ((_end == _start) && (_count != 0))
-                _start = (_start + 1) % _size;
-            else
-                _count++;
-
-            T* newEntryPtr = _entries + _end;
-            _end = (_end + 1) % _size;
-
-            memcpy(newEntryPtr, entry, sizeof(T));                
-
+            T* newEntryPtr = _entries + advance();
+            memcpy(newEntryPtr, entry, sizeof(T));
             return newEntryPtr;
         }
 
+        // Adds an entry without copying it; the caller initializes the returned entry.
+        T* add()
+        {
+            return _entries + advance();
+        }
+
         T* getFirstEntry()
         {
             _iterator = _start;
@@ -164,79 +355,68 @@ class StaticLog
         {
             if ((n == 0) || (n > _count))
                 return nullptr;
-            
-            if (_end < n)
-                _iterator = _end + _size - n;
-            else
-                _iterator = _end - n;
 
+            _iterator = indexFromEnd(n);
             return _entries + _iterator;
         }
 
         T* getNextEntry()
         {
-            _iterator = (_iterator + 1) % _size;
+            _iterator = this->nextIndex(_iterator);
             if (_iterator == _end)
                 return nullptr;
-            else 
+            else
                 return _entries + _iterator;
         }
 
+        inline T* getEntryAt(uint16_t index) const
+        {
+            return _entries + index;
+        }
+
     protected:
-        uint16_t _size;
-        uint16_t _start;
-        uint16_t _end;
-        uint16_t _count;
-        uint16_t _iterator; 
+        typedef LogBase<StaticLog<T>, T*> Base;
+        using Base::_size;
+        using Base::_start;
+        using Base::_end;
+        using Base::_count;
+        using Base::_iterator;
+        using Base::reset;
+        using Base::advance;
+        using Base::indexFromEnd;
+
         T* _entries;
 };
 
-class StringLog
+
+class StringLog : public LogBase<StringLog, const char*>
 {
     public:
-        // Constructor 
+        // Constructor
         StringLog(uint16_t size, uint16_t entrySize)
+            : LogBase(size)
         {
-            _size = size;
             _entrySize = entrySize;
             _entries = new char[entrySize * size];
-            _start = 0;
-            _end = 0;
-            _count = 0;
-            _iterator = 0;
         }
 
-        // Destructor 
+        // Destructor
         ~StringLog()
         {
             delete[] _entries;
         }
 
-        uint16_t count()
-        {
-            return _count;
-        }
-
         void clear()
         {
-            _start = 0;
-            _end = 0;
-            _count = 0;
-            _iterator = 0;
+            reset();
         }
 
         const char* add(const char* entry)
         {
-            if ((_end == _start) && (_count != 0))
-                _start = (_start + 1) % _size;
-            else
-                _count++;
-
-            char* newEntryPtr = _entries + _end * _entrySize;
-            _end = (_end + 1) % _size;
+            char* newEntryPtr = _entries + advance() * _entrySize;
 
             strncpy(newEntryPtr, entry, _entrySize);
-            newEntryPtr[_entrySize - 1] = 0;               
+            newEntryPtr[_entrySize - 1] = 0;
 
             return newEntryPtr;
         }
@@ -254,31 +434,154 @@ class StringLog
         {
             if ((n == 0) || (n > _count))
                 return nullptr;
-            
-            if (_end < n)
-                _iterator = _end + _size - n;
-            else
-                _iterator = _end - n;
 
+            _iterator = indexFromEnd(n);
             return _entries + _iterator * _entrySize;
         }
 
         const char* getNextEntry()
         {
-            _iterator = (_iterator + 1) % _size;
+            _iterator = nextIndex(_iterator);
             if (_iterator == _end)
                 return nullptr;
-            else 
+            else
                 return _entries + _iterator * _entrySize;
         }
 
+        inline const char* getEntryAt(uint16_t index) const
+        {
+            return _entries + index * _entrySize;
+        }
+
     protected:
-        uint16_t _size;
         uint16_t _entrySize;
-        uint16_t _start;
-        uint16_t _end;
-        uint16_t _count;
-        uint16_t _iterator; 
         char* _entries;
 };
-#endif
\ No newline at end of file
+
+
+// Log of variable-length strings stored back-to-back in a preallocated byte arena.
+// The arena is used as a ring: a new entry is placed after the newest one (or at the arena start
+// if it doesn't fit at the end) and the oldest entries are dropped until there is room.
+// Free space is therefore always contiguous; adding an entry never allocates from the heap.
+class StringArenaLog : public LogBase<StringArenaLog, const char*>
+{
+    public:
+        // Constructor
+        StringArenaLog(uint16_t size, uint16_t arenaSize)
+            : LogBase(size)
+        {
+            _arenaSize = arenaSize;
+            _arena = new char[arenaSize];
+            _offsets = new uint16_t[size];
+            _writeOffset = 0;
+        }
+
+        // Destructor
+        ~StringArenaLog()
+        {
+            delete[] _offsets;
+            delete[] _arena;
+        }
+
+        void clear()
+        {
+            reset();
+            _writeOffset = 0;
+        }
+
+        const char* add(const char* entry)
+        {
+            return add(nullptr, entry);
+        }
+
+        // Adds the concatenation of prefix and entry (prefix may be nullptr).
+        // Entries larger than the arena are truncated.
+        const char* add(const char* prefix, const char* entry)
+        {
+            size_t prefixLength = (prefix == nullptr) ? 0 : strlen(prefix);
+            size_t length = prefixLength + strlen(entry) + 1;
+            if (length > _arenaSize) length = _arenaSize;
+            if (prefixLength >= length) prefixLength = length - 1;
+
+            if (_count == _size) dropOldest();
+            uint16_t offset = reserve(length);
+
+            char* newEntryPtr = _arena + offset;
+            if (prefixLength != 0) memcpy(newEntryPtr, prefix, prefixLength);
+            memcpy(newEntryPtr + prefixLength, entry, length - prefixLength - 1);
+            newEntryPtr[length - 1] = 0;
+
+            _offsets[advance()] = offset;
+            _writeOffset = offset + length;
+
+            return newEntryPtr;
+        }
+
+        const char* getFirstEntry()
+        {
+            _iterator = _start;
+            if (_count == 0)
+                return nullptr;
+            else
+                return _arena + _offsets[_iterator];
+        }
+
+        const char* getEntryFromEnd(uint16_t n)
+        {
+            if ((n == 0) || (n > _count))
+                return nullptr;
+
+            _iterator = indexFromEnd(n);
+            return _arena + _offsets[_iterator];
+        }
+
+        const char* getNextEntry()
+        {
+            _iterator = nextIndex(_iterator);
+            if (_iterator == _end)
+                return nullptr;
+            else
+                return _arena + _offsets[_iterator];
+        }
+
+        inline const char* getEntryAt(uint16_t index) const
+        {
+            return _arena + _offsets[index];
+        }
+
+    protected:
+        uint16_t _arenaSize;
+        uint16_t _writeOffset;
+        char* _arena;
+        uint16_t* _offsets;
+
+        void dropOldest()
+        {
+            _start = nextIndex(_start);
+            if (--_count == 0) _writeOffset = 0;
+        }
+
+        // Drops oldest entries until length bytes are free at _writeOffset or at the arena start.
+        // Returns the offset for the new entry.
+        uint16_t reserve(size_t length)
+        {
+            while (_count != 0)
+            {
+                uint16_t startOffset = _offsets[_start];
+                if (_writeOffset > startOffset)
+                {
+                    // Used space is [startOffset, _writeOffset)
+                    if (static_cast<size_t>(_arenaSize - _writeOffset) >= length) return _writeOffset;
+                    if (startOffset >= length) return 0;
+                }
+                else if (static_cast<size_t>(startOffset - _writeOffset) >= length)
+                {
+                    // Used space wraps around; free space is [_writeOffset, startOffset)
+                    return _writeOffset;
+                }
+                dropOldest();
+            }
+            return 0;
+        }
+};
+#endif
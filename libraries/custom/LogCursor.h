@@ -0,0 +1,43 @@
+#ifndef LOGCURSOR_H
+#define LOGCURSOR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <Arduino.h>
+#include <ESPWebServer.h>
+
+// Random ID which differs after each restart (hardware RNG on ESP8266/ESP32; randomSeed is not used).
+inline uint32_t getLogBootId()
+{
+    static uint32_t bootId = random(1, 0x7FFFFFFF);
+    return bootId;
+}
+
+
+// Incremental log requests: a request with "cursor=<id>.<n>" only gets the log entries added since cursor n.
+// The cursor for the next request is sent in the X-Log-Cursor response header (see LogBase::sequence).
+// The ID identifies the boot and log generation; if it doesn't match (the device restarted or the log
+// was cleared since), the cursor is ignored and the entire log should be returned.
+// Must be called before the response is sent. Returns true (and the cursor) if the request has a valid cursor.
+template<class TLog>
+bool getLogCursor(ESPWebServer& webServer, const TLog& log, uint32_t& cursor)
+{
+    uint32_t id = getLogBootId() + log.generation();
+
+    char nextCursor[20];
+    snprintf(nextCursor, sizeof(nextCursor), "%08X.%u", static_cast<unsigned int>(id), static_cast<unsigned int>(log.sequence()));
+    webServer.sendHeader(F("X-Log-Cursor"), nextCursor);
+
+    if (!webServer.hasArg("cursor"))
+        return false;
+
+    String cursorArg = webServer.arg("cursor");
+    char* sequencePtr;
+    if ((strtoul(cursorArg.c_str(), &sequencePtr, 16) != id) || (*sequencePtr != '.'))
+        return false;
+
+    cursor = strtoul(sequencePtr + 1, nullptr, 10);
+    return true;
+}
+
+#endif
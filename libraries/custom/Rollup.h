@@ -0,0 +1,216 @@
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <Log.h>
+
+#define ROLLUP_MONTH 0 // Interval for calendar months
+#define ROLLUP_DAY (24 * 3600)
+#define ROLLUP_WEEK (7 * ROLLUP_DAY)
+
+// Aggregates of N values over one interval
+template <int N>
+struct RollupEntry
+{
+    time_t time; // Start of the interval
+    uint32_t count; // Number of samples
+    float weight; // Sum of sample weights
+    float min[N];
+    float max[N];
+    float sum[N]; // Weighted sum
+
+    float getAvg(int i)
+    {
+        return (weight == 0) ? 0.0F : sum[i] / weight;
+    }
+
+    void reset(time_t startTime)
+    {
+        time = startTime;
+        count = 0;
+        weight = 0;
+        memset(sum, 0, sizeof(sum));
+    }
+
+    void update(const float* values, float sampleWeight)
+    {
+        for (int i = 0; i < N; i++)
+        {
+            float value = values[i];
+            if ((count == 0) || (value < min[i])) min[i] = value;
+            if ((count == 0) || (value > max[i])) max[i] = value;
+            sum[i] += value * sampleWeight;
+        }
+        weight += sampleWeight;
+        count++;
+    }
+};
+
+
+// Maintains aggregates (TEntry) of a series of samples at one or more resolutions (levels).
+// Each level is a StaticLog with one entry per interval; intervals are aligned to the epoch,
+// weeks start on Monday and ROLLUP_MONTH denotes calendar months.
+// Each sample updates the current entry of every level, so the cost per sample is O(levels).
+// TEntry must provide reset(time_t startTime) and update(...) for the sample arguments.
+template <class TEntry>
+class RollupBase
+{
+    public:
+        typedef TEntry Entry;
+
+        // Constructor
+        RollupBase(uint32_t interval, uint16_t size)
+        {
+            initialize(1, &interval, &size);
+        }
+
+        // Constructor
+        RollupBase(uint8_t levels, const uint32_t* intervals, const uint16_t* sizes)
+        {
+            initialize(levels, intervals, sizes);
+        }
+
+        // Destructor
+        ~RollupBase()
+        {
+            for (int i = 0; i < _levels; i++)
+                delete _logs[i];
+            delete[] _logs;
+            delete[] _currentEntryPtrs;
+            delete[] _endTimes;
+            delete[] _intervals;
+        }
+
+        uint8_t levels() const
+        {
+            return _levels;
+        }
+
+        uint32_t getInterval(uint8_t level) const
+        {
+            return _intervals[level];
+        }
+
+        StaticLog<Entry>& getLog(uint8_t level = 0)
+        {
+            return *_logs[level];
+        }
+
+        // The entry for the current interval; nullptr if there were no samples yet.
+        Entry* getCurrent(uint8_t level = 0)
+        {
+            return _currentEntryPtrs[level];
+        }
+
+        // The finest level which covers the given time span with at most maxEntries entries.
+        uint8_t selectLevel(uint32_t timeSpan, uint16_t maxEntries) const
+        {
+            for (int i = 0; i < _levels; i++)
+            {
+                uint32_t interval = (_intervals[i] == ROLLUP_MONTH) ? 31 * ROLLUP_DAY : _intervals[i];
+                if (timeSpan / interval <= maxEntries) return i;
+            }
+            return _levels - 1;
+        }
+
+        void clear()
+        {
+            for (int i = 0; i < _levels; i++)
+            {
+                _logs[i]->clear();
+                _currentEntryPtrs[i] = nullptr;
+                _endTimes[i] = 0;
+            }
+        }
+
+        template <typename... TArgs>
+        void update(time_t time, TArgs... args)
+        {
+            for (int i = 0; i < _levels; i++)
+            {
+                if ((_currentEntryPtrs[i] == nullptr) || (time >= _endTimes[i]))
+                    startEntry(i, time);
+                _currentEntryPtrs[i]->update(args...);
+            }
+        }
+
+    protected:
+        uint8_t _levels;
+        uint32_t* _intervals;
+        time_t* _endTimes;
+        Entry** _currentEntryPtrs;
+        StaticLog<Entry>** _logs;
+
+        void initialize(uint8_t levels, const uint32_t* intervals, const uint16_t* sizes)
+        {
+            _levels = levels;
+            _intervals = new uint32_t[levels];
+            _endTimes = new time_t[levels];
+            _currentEntryPtrs = new Entry*[levels];
+            _logs = new StaticLog<Entry>*[levels];
+            for (int i = 0; i < levels; i++)
+            {
+                _intervals[i] = intervals[i];
+                _logs[i] = new StaticLog<Entry>(sizes[i]);
+            }
+            clear();
+        }
+
+        void startEntry(uint8_t level, time_t time)
+        {
+            time_t startTime;
+            uint32_t interval = _intervals[level];
+            if (interval == ROLLUP_MONTH)
+            {
+                // Avoid mktime; it depends on the time zone.
+                static const uint8_t daysPerMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+                tm* tmPtr = gmtime(&time);
+                int year = tmPtr->tm_year + 1900;
+                bool isLeapYear = (year % 4 == 0) && ((year % 100 != 0) || (year % 400 == 0));
+                int days = daysPerMonth[tmPtr->tm_mon] + ((tmPtr->tm_mon == 1) && isLeapYear ? 1 : 0);
+                startTime = time - (tmPtr->tm_mday - 1) * ROLLUP_DAY - time % ROLLUP_DAY;
+                interval = days * ROLLUP_DAY;
+            }
+            else if (interval % ROLLUP_WEEK == 0)
+            {
+                // The epoch is a Thursday; Monday is 4 days later.
+                startTime = time - (time - 4 * ROLLUP_DAY) % interval;
+            }
+            else
+                startTime = time - time % interval;
+
+            // Initialize the entry in place; entries can be too large for the stack.
+            _currentEntryPtrs[level] = _logs[level]->add();
+            _currentEntryPtrs[level]->reset(startTime);
+            _endTimes[level] = startTime + interval;
+        }
+};
+
+
+// Maintains min/max/sum aggregates of a series of N values (see RollupBase).
+// A sample weight can be used to obtain time-weighted sums (e.g. power * hours = energy).
+template <int N>
+class Rollup : public RollupBase<RollupEntry<N>>
+{
+    public:
+        // Constructor
+        Rollup(uint32_t interval, uint16_t size)
+            : RollupBase<RollupEntry<N>>(interval, size)
+        {
+        }
+
+        // Constructor
+        Rollup(uint8_t levels, const uint32_t* intervals, const uint16_t* sizes)
+            : RollupBase<RollupEntry<N>>(levels, intervals, sizes)
+        {
+        }
+
+        void update(time_t time, const float* values, float weight = 1)
+        {
+            RollupBase<RollupEntry<N>>::update(time, values, weight);
+        }
+};
+
+#endif
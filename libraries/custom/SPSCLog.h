@@ -0,0 +1,102 @@
+#ifndef SPSCLOG_H
+#define SPSCLOG_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+// Variant of StaticLog for one producer task and one reader task, possibly on different cores.
+// The producer appends without locking; when the log is full the oldest entry is overwritten.
+// The reader takes a snapshot (copy) of the most recent entries. Entries which the producer
+// overwrote while they were being copied are detected and dropped, so a snapshot never contains torn entries.
+//
+// Both sides use monotonic sequence numbers (number of entries added so far):
+//  _reserved is incremented before the producer writes an entry, _published after it.
+// This is the classic seqlock protocol, applied per entry instead of to the whole buffer.
+// The tail (oldest entry) is implicit: _published - size. The counters wrap after 2^32 entries.
+template <class T>
+class SPSCLog
+{
+    public:
+        // Constructor
+        SPSCLog(uint16_t size)
+            : _size(size), _reserved(0), _published(0)
+        {
+            _entries = new T[size];
+        }
+
+        // Destructor
+        ~SPSCLog()
+        {
+            delete[] _entries;
+        }
+
+        uint16_t size() const
+        {
+            return _size;
+        }
+
+        uint16_t count() const
+        {
+            uint32_t published = _published.load(std::memory_order_acquire);
+            return (published < _size) ? published : _size;
+        }
+
+        // Total number of entries added; can be used to detect new entries.
+        uint32_t getSequenceNumber() const
+        {
+            return _published.load(std::memory_order_acquire);
+        }
+
+        // Producer side. Must only be called from one task.
+        void add(const T* entry)
+        {
+            uint32_t seq = _reserved.load(std::memory_order_relaxed);
+            _reserved.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            memcpy(_entries + _writeIndex, entry, sizeof(T));
+            if (++_writeIndex == _size) _writeIndex = 0;
+
+            _published.store(seq + 1, std::memory_order_release);
+        }
+
+        // Reader side. Copies max. maxEntries of the most recent entries into the given buffer (oldest first).
+        // Returns the number of entries copied.
+        uint16_t getSnapshot(T* buffer, uint16_t maxEntries) const
+        {
+            uint32_t published = _published.load(std::memory_order_acquire);
+            uint32_t available = (published < _size) ? published : _size;
+            uint16_t n = (available < maxEntries) ? available : maxEntries;
+            uint32_t firstSeq = published - n;
+
+            uint16_t index = firstSeq % _size;
+            for (uint16_t i = 0; i < n; i++)
+            {
+                memcpy(buffer + i, _entries + index, sizeof(T));
+                if (++index == _size) index = 0;
+            }
+
+            // Entries the producer started to overwrite during the copy are not valid.
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint32_t distance = _reserved.load(std::memory_order_relaxed) - firstSeq;
+            if (distance > _size)
+            {
+                uint32_t overwritten = distance - _size;
+                if (overwritten >= n) return 0;
+                memmove(buffer, buffer + overwritten, (n - overwritten) * sizeof(T));
+                n -= overwritten;
+            }
+
+            return n;
+        }
+
+    protected:
+        uint16_t _size;
+        uint16_t _writeIndex = 0; // Producer only
+        std::atomic<uint32_t> _reserved;
+        std::atomic<uint32_t> _published;
+        T* _entries;
+};
+
+#endif
@@ -0,0 +1,30 @@
+#include "StaticFile.h"
+#include <Arduino.h>
+
+static const char* IfNoneMatch = "If-None-Match";
+
+
+void collectStaticFileHeaders(ESPWebServer& webServer)
+{
+    const char* headerKeys[] = { IfNoneMatch };
+    webServer.collectHeaders(headerKeys, 1);
+}
+
+
+void serveStaticFile(ESPWebServer& webServer, const StaticFile& file)
+{
+    // The URLs don't change when the firmware is updated, so the browser revalidates after a week.
+    webServer.sendHeader(F("Cache-Control"), F("max-age=604800, public"));
+    webServer.sendHeader(F("ETag"), FPSTR(file.etag));
+
+    // If-None-Match may contain multiple (weak) ETags; W/"<hash>" also matches
+    if (webServer.hasHeader(IfNoneMatch) && (strstr_P(webServer.header(IfNoneMatch).c_str(), file.etag) != nullptr))
+    {
+        webServer.send(304);
+        return;
+    }
+
+    if (file.isGzipped)
+        webServer.sendHeader(F("Content-Encoding"), F("gzip"));
+    webServer.send_P(200, file.contentType, reinterpret_cast<PGM_P>(file.data), file.size);
+}
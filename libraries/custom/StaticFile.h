@@ -0,0 +1,27 @@
+#ifndef STATICFILE_H
+#define STATICFILE_H
+
+#include <stdint.h>
+#include <ESPWebServer.h>
+
+// File embedded in PROGMEM, generated from a sketch's data/ folder by tools/embed_static_files.py.
+// Files are stored gzipped, unless that doesn't make them smaller (e.g. PNG).
+// The ETag is a (quoted) hash of the uncompressed content, so it changes whenever the file does.
+struct StaticFile
+{
+    PGM_P path;
+    PGM_P contentType;
+    PGM_P etag;
+    const uint8_t* data;
+    size_t size;
+    bool isGzipped;
+};
+
+// Sends the file with its ETag and a long Cache-Control.
+// If the request's If-None-Match matches the ETag, only a 304 (Not Modified) is sent.
+// The web server must collect the If-None-Match header (see collectStaticFileHeaders).
+void serveStaticFile(ESPWebServer& webServer, const StaticFile& file);
+
+void collectStaticFileHeaders(ESPWebServer& webServer);
+
+#endif
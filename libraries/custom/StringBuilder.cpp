@@ -20,16 +20,23 @@ void StringBuilder::clear()
 
 void StringBuilder::printf(const __FlashStringHelper* fformat, ...)
 {
-    if (_space == 0)
-        return;
-
-    char* end = _buffer + _length;
-
     va_list args;
     va_start(args, fformat);
-    size_t additional = vsnprintf_P(end, _space, (PGM_P) fformat, args);
+    size_t additional = vsnprintf_P(_buffer + _length, _space, (PGM_P) fformat, args);
     va_end(args);
 
+    if ((additional >= _space) && (_length != 0) && flushBuffer())
+    {
+        // Didn't fit; try again in the flushed buffer.
+        va_start(args, fformat);
+        additional = vsnprintf_P(_buffer, _space, (PGM_P) fformat, args);
+        va_end(args);
+    }
+
+    // Truncated output
+    if (additional >= _space)
+        additional = _space - 1;
+
     update_length(additional);
 }
 
@@ -42,19 +49,31 @@ size_t StringBuilder::write(uint8_t data)
 
 size_t StringBuilder::write(const uint8_t* dataPtr, size_t size)
 {
-    if (_space <= 1) 
-        return 0;
- 
-    if (size >= _space)
-        size = (_space - 1);
+    size_t written = 0;
+    while (size >= _space)
+    {
+        // Fill up the buffer and try to flush it.
+        size_t partSize = _space - 1;
+        append(dataPtr, partSize);
+        dataPtr += partSize;
+        size -= partSize;
+        written += partSize;
+        if (!flushBuffer())
+            return written;
+    }
+
+    append(dataPtr, size);
+    return written + size;
+}
+
 
+void StringBuilder::append(const uint8_t* dataPtr, size_t size)
+{
     char* end = _buffer + _length;
     memcpy(end, dataPtr, size);
     end[size] = 0; 
 
     update_length(size);
-
-    return size;
 }
 
 
@@ -50,6 +50,13 @@ class StringBuilder : public Print
     size_t _length;
     
     void update_length(size_t additional);
+    void append(const uint8_t* dataPtr, size_t size);
+
+    // Invoked when the buffer is full. Derived classes can empty the buffer (and return true) to prevent truncation.
+    virtual bool flushBuffer()
+    {
+        return false;
+    }
 };
 
 #endif
\ No newline at end of file
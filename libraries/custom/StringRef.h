@@ -0,0 +1,68 @@
+#ifndef STRINGREF_H
+#define STRINGREF_H
+
+#include <Arduino.h>
+#include <WString.h>
+#include <Print.h>
+
+// Non-owning reference to a string in flash (F(), FPSTR) or RAM (char*, String).
+// Unlike a const String& parameter, passing a flash string doesn't create a temporary String on the heap.
+// The referenced string must outlive the StringRef.
+class StringRef
+{
+  public:
+    StringRef()
+        : _str(nullptr), _isFlash(false) {}
+
+    StringRef(const char* str)
+        : _str(str), _isFlash(false) {}
+
+    StringRef(const __FlashStringHelper* str)
+        : _str(reinterpret_cast<PGM_P>(str)), _isFlash(true) {}
+
+    StringRef(const String& str)
+        : _str(str.c_str()), _isFlash(false) {}
+
+    inline bool isEmpty() const
+    {
+        return (_str == nullptr) || (pgm_read_byte(_str) == 0);
+    }
+
+    // The characters may be in flash, so read them using pgm_read_byte.
+    inline PGM_P c_str() const
+    {
+        return (_str == nullptr) ? "" : _str;
+    }
+
+    // Can be used as printf format (vsnprintf_P also accepts RAM strings).
+    inline const __FlashStringHelper* format() const
+    {
+        return reinterpret_cast<const __FlashStringHelper*>(_str);
+    }
+
+    inline size_t printTo(Print& output) const
+    {
+        if (_str == nullptr) return 0;
+        return _isFlash ? output.print(format()) : output.print(_str);
+    }
+
+    bool equals(const __FlashStringHelper* other) const
+    {
+        PGM_P p1 = c_str();
+        PGM_P p2 = reinterpret_cast<PGM_P>(other);
+        char c;
+        do
+        {
+            c = pgm_read_byte(p1++);
+            if (c != pgm_read_byte(p2++)) return false;
+        }
+        while (c != 0);
+        return true;
+    }
+
+  private:
+    const char* _str;
+    bool _isFlash;
+};
+
+#endif
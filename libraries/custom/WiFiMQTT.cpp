@@ -0,0 +1,212 @@
+#include "WiFiMQTT.h"
+#include <Tracer.h>
+
+#define MQTT_CONNECT 0x10
+#define MQTT_CONNACK 0x20
+#define MQTT_PUBLISH 0x30
+#define MQTT_PINGREQ 0xC0
+#define MQTT_DISCONNECT 0xE0
+
+#define MQTT_RETAIN 0x01
+#define MQTT_CONNECT_CLEAN_SESSION 0x02
+#define MQTT_CONNECT_PASSWORD 0x40
+#define MQTT_CONNECT_USER_NAME 0x80
+
+
+WiFiMQTTClient::WiFiMQTTClient(int timeout)
+{
+    _client.setTimeout(timeout);
+    _lastError[0] = 0;
+}
+
+
+bool WiFiMQTTClient::begin(const char* host, const char* clientId, const char* userName, const char* password, uint16_t port, uint16_t keepAlive)
+{
+    Tracer tracer(F("WiFiMQTTClient::begin"), host);
+
+    if (!_client.connect(host, port))
+    {
+        setLastError("Cannot connect to %s:%d", host, port);
+        return false;
+    }
+    // Packets are batched in our buffer already
+    _client.setNoDelay(true);
+
+    bool hasUserName = (userName != nullptr) && (userName[0] != 0);
+    bool hasPassword = hasUserName && (password != nullptr) && (password[0] != 0);
+    size_t clientIdLength = strlen(clientId);
+    size_t userNameLength = hasUserName ? strlen(userName) : 0;
+    size_t passwordLength = hasPassword ? strlen(password) : 0;
+
+    // Variable header: protocol name, level, flags and keep alive; payload: client ID, user name and password.
+    size_t remainingLength = 10 + 2 + clientIdLength;
+    if (hasUserName) remainingLength += 2 + userNameLength;
+    if (hasPassword) remainingLength += 2 + passwordLength;
+
+    _bufferLength = 0;
+    if (!startPacket(MQTT_CONNECT, remainingLength))
+    {
+        _client.stop();
+        return false;
+    }
+    appendString("MQTT", 4);
+    _buffer[_bufferLength++] = 4; // Protocol level 3.1.1
+    _buffer[_bufferLength++] = MQTT_CONNECT_CLEAN_SESSION
+        | (hasUserName ? MQTT_CONNECT_USER_NAME : 0)
+        | (hasPassword ? MQTT_CONNECT_PASSWORD : 0);
+    _buffer[_bufferLength++] = keepAlive >> 8;
+    _buffer[_bufferLength++] = keepAlive & 0xFF;
+    appendString(clientId, clientIdLength);
+    if (hasUserName) appendString(userName, userNameLength);
+    if (hasPassword) appendString(password, passwordLength);
+
+    _keepAlive = keepAlive;
+    if (!flush() || !awaitConnAck())
+    {
+        _client.stop();
+        return false;
+    }
+
+    return true;
+}
+
+
+void WiFiMQTTClient::end()
+{
+    Tracer tracer(F("WiFiMQTTClient::end"));
+
+    if (_client.connected())
+    {
+        flush();
+        if (startPacket(MQTT_DISCONNECT, 0))
+            flush();
+        _client.stop();
+    }
+    _bufferLength = 0;
+}
+
+
+bool WiFiMQTTClient::isConnected()
+{
+    return _client.connected();
+}
+
+
+bool WiFiMQTTClient::awaitConnAck()
+{
+    uint8_t connAck[4];
+    if (_client.readBytes(connAck, sizeof(connAck)) != sizeof(connAck))
+    {
+        setLastError("No CONNACK received");
+        return false;
+    }
+    if ((connAck[0] != MQTT_CONNACK) || (connAck[1] != 2))
+    {
+        setLastError("Unexpected response: 0x%02X", connAck[0]);
+        return false;
+    }
+    if (connAck[3] != 0)
+    {
+        // E.g. 4 = bad user name or password, 5 = not authorized
+        setLastError("Connection refused: %d", connAck[3]);
+        return false;
+    }
+    return true;
+}
+
+
+// Appends the fixed header; returns false if the packet doesn't fit in the buffer (even after flushing).
+bool WiFiMQTTClient::startPacket(uint8_t header, size_t remainingLength)
+{
+    size_t packetLength = 1 + ((remainingLength < 128) ? 1 : (remainingLength < 16384) ? 2 : 3) + remainingLength;
+    if (packetLength > MQTT_BUFFER_SIZE)
+    {
+        setLastError("Packet too long: %u bytes", static_cast<unsigned>(packetLength));
+        return false;
+    }
+    if ((_bufferLength + packetLength > MQTT_BUFFER_SIZE) && !flush())
+        return false;
+
+    _buffer[_bufferLength++] = header;
+    do
+    {
+        uint8_t encodedByte = remainingLength % 128;
+        remainingLength /= 128;
+        if (remainingLength > 0) encodedByte |= 0x80;
+        _buffer[_bufferLength++] = encodedByte;
+    }
+    while (remainingLength > 0);
+    return true;
+}
+
+
+void WiFiMQTTClient::appendString(const char* str, size_t length)
+{
+    _buffer[_bufferLength++] = length >> 8;
+    _buffer[_bufferLength++] = length & 0xFF;
+    memcpy(_buffer + _bufferLength, str, length);
+    _bufferLength += length;
+}
+
+
+bool WiFiMQTTClient::publish(const char* topic, const char* payload, bool retain)
+{
+    size_t topicLength = strlen(topic);
+    size_t payloadLength = strlen(payload);
+    if (!startPacket(MQTT_PUBLISH | (retain ? MQTT_RETAIN : 0), 2 + topicLength + payloadLength))
+        return false;
+
+    // QoS 0: no packet identifier
+    appendString(topic, topicLength);
+    memcpy(_buffer + _bufferLength, payload, payloadLength);
+    _bufferLength += payloadLength;
+    _publishedMessages++;
+    return true;
+}
+
+
+bool WiFiMQTTClient::flush()
+{
+    if (_bufferLength == 0)
+        return true;
+
+    size_t bytesSent = _client.write(_buffer, _bufferLength);
+    bool success = (bytesSent == _bufferLength);
+    if (!success)
+    {
+        setLastError("Sent %u of %u bytes", static_cast<unsigned>(bytesSent), static_cast<unsigned>(_bufferLength));
+        _client.stop();
+    }
+
+    _sentBatches++;
+    _sentBytes += bytesSent;
+    _bufferLength = 0;
+    _lastSendMillis = millis();
+    return success;
+}
+
+
+void WiFiMQTTClient::run()
+{
+    // We don't subscribe, so only PINGRESP is expected.
+    uint8_t discard[16];
+    while (_client.available() > 0)
+        _client.read(discard, sizeof(discard));
+
+    if ((_keepAlive != 0) && (millis() - _lastSendMillis >= _keepAlive * 500UL))
+    {
+        if (startPacket(MQTT_PINGREQ, 0))
+            flush();
+    }
+}
+
+
+void WiFiMQTTClient::setLastError(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vsnprintf(_lastError, sizeof(_lastError), format, args);
+    va_end(args);
+
+    TRACE(F("ERROR: %s\n"), _lastError);
+}
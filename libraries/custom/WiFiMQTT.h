@@ -0,0 +1,74 @@
+#ifndef WIFIMQTT_H
+#define WIFIMQTT_H
+
+#include <stdint.h>
+#include <WiFiClient.h>
+
+#define MQTT_DEFAULT_PORT 1883
+#define MQTT_DEFAULT_KEEP_ALIVE 60
+#define MQTT_BUFFER_SIZE 1024
+
+// Minimal MQTT 3.1.1 client which only publishes (QoS 0).
+// Published messages are collected in a buffer which is written in one go (see flush),
+// so a batch of messages takes only a few TCP segments.
+class WiFiMQTTClient
+{
+    public:
+        // Constructor
+        WiFiMQTTClient(int timeout = 5000);
+
+        // Connects to the broker and awaits its CONNACK (blocking; at most the timeout).
+        bool begin(const char* host, const char* clientId, const char* userName = nullptr, const char* password = nullptr,
+            uint16_t port = MQTT_DEFAULT_PORT, uint16_t keepAlive = MQTT_DEFAULT_KEEP_ALIVE);
+        void end();
+
+        bool isConnected();
+
+        // Adds a PUBLISH packet to the buffer; the buffer is flushed first if there is no room.
+        bool publish(const char* topic, const char* payload, bool retain = false);
+
+        // Sends the buffered packets.
+        bool flush();
+
+        // Discards data received from the broker and sends a PINGREQ if nothing was sent for a while.
+        // Should be called regularly to keep the connection alive.
+        void run();
+
+        inline const char* getLastError()
+        {
+            return _lastError;
+        }
+
+        inline uint32_t getPublishedMessages()
+        {
+            return _publishedMessages;
+        }
+
+        inline uint32_t getSentBatches()
+        {
+            return _sentBatches;
+        }
+
+        inline uint32_t getSentBytes()
+        {
+            return _sentBytes;
+        }
+
+    private:
+        WiFiClient _client;
+        uint8_t _buffer[MQTT_BUFFER_SIZE];
+        size_t _bufferLength = 0;
+        uint16_t _keepAlive;
+        uint32_t _lastSendMillis;
+        uint32_t _publishedMessages = 0;
+        uint32_t _sentBatches = 0;
+        uint32_t _sentBytes = 0;
+        char _lastError[64];
+
+        bool startPacket(uint8_t header, size_t remainingLength);
+        void appendString(const char* str, size_t length);
+        bool awaitConnAck();
+        void setLastError(const char* format, ...);
+};
+
+#endif
@@ -6,6 +6,7 @@
 #include <ESPCoreDump.h>
 #include <Tracer.h>
 #include <StringBuilder.h>
+#include <StaticFile.h>
 
 #ifdef ESP32
     #include <rom/rtc.h>
@@ -30,6 +31,7 @@ WiFiStateMachine::WiFiStateMachine(WiFiNTP& timeServer, ESPWebServer& webServer,
 {
     _eventLogPtr = &eventLog;
     _eventStringLogPtr = nullptr;
+    _eventArenaLogPtr = nullptr;
     memset(_handlers, 0, sizeof(_handlers));
 }
 
@@ -39,6 +41,17 @@ WiFiStateMachine::WiFiStateMachine(WiFiNTP& timeServer, ESPWebServer& webServer,
 {
     _eventStringLogPtr = &eventLog;
     _eventLogPtr = nullptr;
+    _eventArenaLogPtr = nullptr;
+    memset(_handlers, 0, sizeof(_handlers));
+}
+
+// Constructor
+WiFiStateMachine::WiFiStateMachine(WiFiNTP& timeServer, ESPWebServer& webServer, StringArenaLog& eventLog)
+    : _timeServer(timeServer), _webServer(webServer)
+{
+    _eventArenaLogPtr = &eventLog;
+    _eventLogPtr = nullptr;
+    _eventStringLogPtr = nullptr;
     memset(_handlers, 0, sizeof(_handlers));
 }
 
@@ -49,19 +62,14 @@ void WiFiStateMachine::on(WiFiInitState state, void (*handler)(void))
 }
 
 
-void WiFiStateMachine::registerStaticFiles(PGM_P* files, size_t count)
+void WiFiStateMachine::registerStaticFiles(const StaticFile* files, size_t count)
 {
-    if (!SPIFFS.begin())
-    {
-        logEvent(F("Starting SPIFFS failed"));
-        return;
-    }
+    collectStaticFileHeaders(_webServer);
 
     for (int i = 0; i < count; i++)
     {
-        String path = F("/");
-        path += FPSTR(files[i]);
-        _webServer.serveStatic(path.c_str(), SPIFFS, path.c_str(), "max-age=86400, public");
+        const StaticFile* filePtr = files + i;
+        _webServer.on(String(FPSTR(filePtr->path)), HTTP_GET, [this, filePtr]() { serveStaticFile(_webServer, *filePtr); });
     }
 }
 
@@ -195,18 +203,27 @@ void WiFiStateMachine::logEvent(const char* msg)
 {
     Tracer tracer(F("WiFiStateMachine::logEvent"), msg);
 
-    size_t timestamp_size = 23; // strlen("2019-01-30 12:23:34 : ") + 1;
-
-    char* event = new char[timestamp_size + strlen(msg)];
+    const size_t timestamp_size = 23; // strlen("2019-01-30 12:23:34 : ") + 1;
 
+    char timestamp[timestamp_size];
     if (_isTimeServerAvailable)
     {
         time_t currentTime = _timeServer.getCurrentTime();
-        strftime(event, timestamp_size, "%F %H:%M:%S : ", localtime(&currentTime));
+        strftime(timestamp, timestamp_size, "%F %H:%M:%S : ", localtime(&currentTime));
     }
     else
-        snprintf(event, timestamp_size, "@ %u ms : ", static_cast<uint32_t>(millis()));
-    
+        snprintf(timestamp, timestamp_size, "@ %u ms : ", static_cast<uint32_t>(millis()));
+
+    if (_eventArenaLogPtr != nullptr)
+    {
+        // Timestamp and message are copied into the arena directly; no heap allocation.
+        _eventArenaLogPtr->add(timestamp, msg);
+        TRACE(F("%u event log entries\n"), _eventArenaLogPtr->count());
+        return;
+    }
+
+    char* event = new char[timestamp_size + strlen(msg)];
+    strcpy(event, timestamp);
     strcat(event, msg);
 
     if (_eventStringLogPtr == nullptr)
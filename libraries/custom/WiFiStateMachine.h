@@ -5,6 +5,7 @@
 #include <ESPWebServer.h>
 #include <WiFiNTP.h>
 #include <Log.h>
+#include <StaticFile.h>
 
 enum struct WiFiInitState
 {
@@ -35,9 +36,12 @@ class WiFiStateMachine
         // Constructor
         WiFiStateMachine(WiFiNTP& timeServer, ESPWebServer& webServer, StringLog& eventLog);
 
+        // Constructor
+        WiFiStateMachine(WiFiNTP& timeServer, ESPWebServer& webServer, StringArenaLog& eventLog);
+
         void on(WiFiInitState state, void (*handler)(void));
 
-        void registerStaticFiles(PGM_P* files, size_t count);
+        void registerStaticFiles(const StaticFile* files, size_t count);
  
         void begin(String ssid, String password, String hostName, uint32_t reconnectInterval = 60);
         void run();
@@ -107,6 +111,7 @@ class WiFiStateMachine
         ESPWebServer& _webServer;
         Log<const char>* _eventLogPtr;
         StringLog* _eventStringLogPtr;
+        StringArenaLog* _eventArenaLogPtr;
         void (*_handlers[static_cast<int>(WiFiInitState::Updating) + 1])(void); // function pointers indexed by state
         bool _isTimeServerAvailable = false;
         bool _isInAccessPointMode = false;
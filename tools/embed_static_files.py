@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Embeds the files in a sketch's data/ folder as (gzipped) PROGMEM arrays.
+
+Usage: tools/embed_static_files.py <sketch folder> [...]
+
+Writes <sketch folder>/StaticFiles.h, which defines StaticFiles[] and StaticFileCount
+for WiFiStateMachine::registerStaticFiles. Run it again whenever a file in data/ changes.
+The output is deterministic, so unchanged files yield the same ETag and an unchanged header.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+CONTENT_TYPES = {
+    ".css": "text/css",
+    ".gif": "image/gif",
+    ".htm": "text/html",
+    ".html": "text/html",
+    ".ico": "image/x-icon",
+    ".jpg": "image/jpeg",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".png": "image/png",
+    ".svg": "image/svg+xml",
+    ".txt": "text/plain",
+}
+
+BYTES_PER_LINE = 16
+
+
+def to_identifier(file_name):
+    return re.sub(r"\W", "_", file_name)
+
+
+def embed_file(file_name, content):
+    ext = os.path.splitext(file_name)[1].lower()
+    if ext not in CONTENT_TYPES:
+        raise ValueError("Unknown content type for " + file_name)
+
+    identifier = to_identifier(file_name)
+    etag = '"' + hashlib.sha256(content).hexdigest()[:16] + '"'
+    gzipped = gzip.compress(content, compresslevel=9, mtime=0)
+    is_gzipped = len(gzipped) < len(content) # Already compressed formats (e.g. PNG) don't shrink
+    data = gzipped if is_gzipped else content
+
+    lines = [
+        "// %s: %d bytes, %d bytes gzipped%s"
+            % (file_name, len(content), len(gzipped), "" if is_gzipped else " (stored uncompressed)"),
+        'static const char %s_Path[] PROGMEM = "/%s";' % (identifier, file_name),
+        'static const char %s_ContentType[] PROGMEM = "%s";' % (identifier, CONTENT_TYPES[ext]),
+        'static const char %s_ETag[] PROGMEM = "%s";' % (identifier, etag.replace('"', '\\"')),
+        "static const uint8_t %s_Data[] PROGMEM =" % identifier,
+        "{",
+    ]
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[i:i + BYTES_PER_LINE]
+        lines.append("    " + ", ".join("0x%02X" % b for b in chunk) + ",")
+    lines.append("};")
+    lines.append("")
+    return identifier, is_gzipped, "\n".join(lines)
+
+
+def embed_sketch(sketch_dir):
+    data_dir = os.path.join(sketch_dir, "data")
+    file_names = sorted(f for f in os.listdir(data_dir) if os.path.isfile(os.path.join(data_dir, f)))
+
+    output = [
+        "// Generated by tools/embed_static_files.py from data/; do not edit.",
+        "#ifndef STATIC_FILES_H",
+        "#define STATIC_FILES_H",
+        "",
+        "#include <StaticFile.h>",
+        "",
+    ]
+    entries = []
+    for file_name in file_names:
+        with open(os.path.join(data_dir, file_name), "rb") as f:
+            identifier, is_gzipped, code = embed_file(file_name, f.read())
+        entries.append((identifier, is_gzipped))
+        output.append(code)
+
+    output.append("const StaticFile StaticFiles[] =")
+    output.append("{")
+    for identifier, is_gzipped in entries:
+        output.append(
+            "    { %s_Path, %s_ContentType, %s_ETag, %s_Data, sizeof(%s_Data), %s },"
+            % (identifier, identifier, identifier, identifier, identifier, "true" if is_gzipped else "false"))
+    output.append("};")
+    output.append("")
+    output.append("const size_t StaticFileCount = sizeof(StaticFiles) / sizeof(StaticFiles[0]);")
+    output.append("")
+    output.append("#endif")
+    output.append("")
+
+    header_path = os.path.join(sketch_dir, "StaticFiles.h")
+    with open(header_path, "w", newline="\n") as f:
+        f.write("\n".join(output))
+    print("%s: %d files" % (header_path, len(entries)))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print(__doc__)
+        sys.exit(1)
+    for sketch_dir in sys.argv[1:]:
+        embed_sketch(sketch_dir)
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""Reference parser for the binary log export (see libraries/custom/BinaryLogWriter.h).
+
+Usage: tools/parse_binary_log.py <file or URL> [--since <time>] [--cursor <id>.<n>] [--delimiter <c>]
+
+Examples:
+    tools/parse_binary_log.py http://otgw/otlog.bin --since 1700000000 > otlog.csv
+    curl -s http://dsmr/powerlog.bin -o powerlog.bin && tools/parse_binary_log.py powerlog.bin
+
+Writes the entries as CSV to stdout; array fields are expanded to name[0], name[1], ...
+Fields named "time" are also written as ISO 8601 (UTC) in a "timestamp" column.
+For URLs, the X-Log-Cursor response header is written to stderr; pass it as --cursor to fetch only newer entries.
+The cursor is "<id>.<n>"; if the device restarted or cleared the log since, the ID doesn't match and all entries are returned.
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+import urllib.parse
+import urllib.request
+
+MAGIC = b"BLOG"
+VERSION = 1
+
+# Type: low nibble is the size, high nibble 0 (unsigned), 1 (signed) or 2 (float).
+STRUCT_FORMATS = {
+    0x01: "B", 0x02: "H", 0x04: "I", 0x08: "Q",
+    0x11: "b", 0x12: "h", 0x14: "i", 0x18: "q",
+    0x24: "f", 0x28: "d",
+}
+
+
+class Field:
+    def __init__(self, name, type, count, offset):
+        self.name = name
+        self.type = type
+        self.count = count
+        self.offset = offset
+        self.format = "<%d%s" % (count, STRUCT_FORMATS[type])
+
+    def column_names(self):
+        if self.count == 1:
+            return [self.name]
+        return ["%s[%d]" % (self.name, i) for i in range(self.count)]
+
+
+def parse_header(data):
+    """Returns (entry size, fields, header size)."""
+    if data[0:4] != MAGIC:
+        raise ValueError("Not a binary log export (bad magic)")
+    version, field_count, entry_size = struct.unpack_from("<BBH", data, 4)
+    if version != VERSION:
+        raise ValueError("Unsupported version: %d" % version)
+
+    offset = 8
+    fields = []
+    for _ in range(field_count):
+        type, count, field_offset, name_length = struct.unpack_from("<BBHB", data, offset)
+        offset += 5
+        name = data[offset:offset + name_length].decode("ascii")
+        offset += name_length
+        fields.append(Field(name, type, count, field_offset))
+    return entry_size, fields, offset
+
+
+def parse(data):
+    """Yields (fields, values) for each entry; values is a flat list matching the column names."""
+    entry_size, fields, offset = parse_header(data)
+    if (len(data) - offset) % entry_size != 0:
+        print("Warning: truncated entry at end of data", file=sys.stderr)
+
+    while offset + entry_size <= len(data):
+        values = []
+        for field in fields:
+            values.extend(struct.unpack_from(field.format, data, offset + field.offset))
+        yield fields, values
+        offset += entry_size
+
+
+def log_cursor(value):
+    id, separator, sequence = value.partition(".")
+    try:
+        int(id, 16)
+        int(sequence)
+    except ValueError:
+        separator = None
+    if not separator:
+        raise argparse.ArgumentTypeError("expected <id>.<n> (the X-Log-Cursor of a previous request)")
+    return value
+
+
+def read_input(source, since, cursor):
+    if source.startswith("http://") or source.startswith("https://"):
+        query = {}
+        if since is not None:
+            query["since"] = since
+        if cursor is not None:
+            query["cursor"] = cursor
+        if query:
+            separator = "&" if "?" in source else "?"
+            source += separator + urllib.parse.urlencode(query)
+        with urllib.request.urlopen(source) as response:
+            next_cursor = response.headers.get("X-Log-Cursor")
+            if next_cursor is not None:
+                print("X-Log-Cursor: %s" % next_cursor, file=sys.stderr)
+            return response.read()
+    with open(source, "rb") as f:
+        return f.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Converts a binary log export to CSV.")
+    parser.add_argument("source", help="File name or URL (e.g. http://host/otlog.bin)")
+    parser.add_argument("--since", type=int, help="Only fetch entries with time > since (URL only)")
+    parser.add_argument("--cursor", type=log_cursor, help="Only fetch entries added since the given X-Log-Cursor (URL only)")
+    parser.add_argument("--delimiter", default=";", help="CSV delimiter (default ';')")
+    args = parser.parse_args()
+
+    data = read_input(args.source, args.since, args.cursor)
+    _, fields, _ = parse_header(data)
+    has_time = any(field.name == "time" for field in fields)
+
+    columns = [name for field in fields for name in field.column_names()]
+    if has_time:
+        columns.insert(0, "timestamp")
+    print(args.delimiter.join(columns))
+
+    time_index = columns.index("time") - 1 if has_time else -1
+    for _, values in parse(data):
+        row = [("%g" % v) if isinstance(v, float) else str(v) for v in values]
+        if has_time:
+            timestamp = datetime.datetime.fromtimestamp(values[time_index], datetime.timezone.utc)
+            row.insert(0, timestamp.strftime("%Y-%m-%dT%H:%M:%SZ"))
+        print(args.delimiter.join(row))
+
+
+if __name__ == "__main__":
+    main()